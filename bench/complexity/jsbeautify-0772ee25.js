@@ -0,0 +1,2 @@
+/* complexity 0 1 0 0 0 expect 2 */
+[
\ No newline at end of file
@@ -0,0 +1,281 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_BENCH_CORPUS_H
+#define EIGHTPACK_BENCH_CORPUS_H
+
+// The tools the benchmarks run and generators of synthetic JavaScript and
+// CSS for them. The generators are seeded, so the same arguments give the
+// same source on every machine.
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <ctype.h>
+
+// Bump when the generators or the way the tools are run over their
+// output change, so that results are not compared across the two.
+static const int kCorpusVersion = 2;
+
+enum Language {
+    JavaScript,
+    Css
+};
+
+// The linters stop after a number of warnings, which would leave most
+// of a large input unchecked.
+struct Tool
+{
+    const char* name;
+    Language language;
+    const char* option;
+};
+
+static const Tool tools[] = {
+    { "jshint", JavaScript, "--maxerr=1000000000" },
+    { "jslint", JavaScript, "--maxerr=1000000000" },
+    { "jsbeautify", JavaScript, 0 },
+    { "jsmin", JavaScript, 0 },
+    { "cssbeautify", Css, 0 },
+    { "cssmin", Css, 0 }
+};
+
+// Deterministic pseudo-random numbers; rand() differs between C libraries.
+class Random
+{
+public:
+    Random(unsigned seed) : m_state(seed) { }
+
+    unsigned next(unsigned range)
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return (m_state >> 8) % range;
+    }
+
+    const char* pick(const char* const* words, unsigned count) { return words[next(count)]; }
+
+private:
+    unsigned m_state;
+};
+
+// Writes source either laid out, with indentation and comments, or
+// compact on a single line like the output of a minifier.
+class SourceWriter
+{
+public:
+    SourceWriter(bool compact) : m_compact(compact), m_indent(0) { }
+
+    void line(const std::string& text)
+    {
+        if (m_compact) {
+            m_out += text;
+            return;
+        }
+        m_out.append(4 * m_indent, ' ');
+        m_out += text;
+        m_out += '\n';
+    }
+
+    void comment(const std::string& text)
+    {
+        if (!m_compact)
+            line(text);
+    }
+
+    void open(const std::string& text) { line(text); ++m_indent; }
+    void close(const std::string& text) { --m_indent; line(text); }
+    void reopen(const std::string& text) { --m_indent; line(text); ++m_indent; }
+
+    bool compact() const { return m_compact; }
+    const std::string& str() const { return m_out; }
+    size_t size() const { return m_out.size(); }
+
+private:
+    bool m_compact;
+    int m_indent;
+    std::string m_out;
+};
+
+static const char* const nouns[] = {
+    "item", "node", "list", "value", "count", "index", "result", "options",
+    "buffer", "token", "entry", "child", "parent", "width", "height", "name"
+};
+static const unsigned kNounCount = sizeof(nouns) / sizeof(nouns[0]);
+
+static const char* const verbs[] = {
+    "get", "set", "find", "update", "render", "parse", "create", "remove",
+    "apply", "compute", "format", "load"
+};
+static const unsigned kVerbCount = sizeof(verbs) / sizeof(verbs[0]);
+
+inline std::string number(unsigned n)
+{
+    std::ostringstream out;
+    out << n;
+    return out.str();
+}
+
+inline std::string identifier(Random& random)
+{
+    std::string name = random.pick(nouns, kNounCount);
+    if (random.next(3) == 0) {
+        std::string second = random.pick(nouns, kNounCount);
+        second[0] = toupper(second[0]);
+        name += second;
+    }
+    return name;
+}
+
+inline std::string expression(Random& random, const std::string& a, const std::string& b)
+{
+    switch (random.next(6)) {
+    case 0: return a + " + " + number(random.next(100));
+    case 1: return a + " * " + b + " - 1";
+    case 2: return "'" + std::string(random.pick(nouns, kNounCount)) + " " + random.pick(verbs, kVerbCount) + "'";
+    case 3: return a + ".length";
+    case 4: return "[" + a + ", " + b + ", " + number(random.next(10)) + "]";
+    default: return std::string(random.pick(verbs, kVerbCount)) + "(" + a + ", " + b + ")";
+    }
+}
+
+inline void javascript_function(SourceWriter& out, Random& random, unsigned id)
+{
+    std::string name = std::string(random.pick(verbs, kVerbCount)) + "Item" + number(id);
+    std::string a = identifier(random);
+    std::string b = identifier(random) + "2";
+
+    out.comment("/**");
+    out.comment(" * " + std::string(random.pick(verbs, kVerbCount)) + "s the " + a + " and returns the " + b + ".");
+    out.comment(" */");
+    out.open("function " + name + "(" + a + ", " + b + ") {");
+    out.line("var total = 0, i, copy = {};");
+    unsigned statements = 3 + random.next(6);
+    for (unsigned s = 0; s < statements; ++s) {
+        switch (random.next(5)) {
+        case 0:
+            out.open("if (" + a + " > " + number(random.next(50)) + ") {");
+            out.line("total += " + expression(random, a, b) + ";");
+            out.reopen("} else {");
+            out.line("total -= 1;");
+            out.close("}");
+            break;
+        case 1:
+            out.open("for (i = 0; i < " + b + ".length; i += 1) {");
+            out.line("total += " + b + "[i] * 2;");
+            out.close("}");
+            break;
+        case 2:
+            out.comment("// " + std::string(random.pick(nouns, kNounCount)) + " handling");
+            out.line("copy." + identifier(random) + " = " + expression(random, a, b) + ";");
+            break;
+        case 3:
+            out.open("copy = {");
+            out.line(identifier(random) + ": " + expression(random, a, b) + ",");
+            out.line(identifier(random) + ": \"" + random.pick(nouns, kNounCount) + "\"");
+            out.close("};");
+            break;
+        default:
+            out.open("while (total > " + number(100 + random.next(900)) + ") {");
+            out.line("total = Math.floor(total / 2);");
+            out.close("}");
+            break;
+        }
+    }
+    out.line("return total;");
+    out.close("}");
+    if (!out.compact())
+        out.line("");
+}
+
+inline std::string javascript_source(unsigned seed, size_t size, bool compact)
+{
+    Random random(seed);
+    SourceWriter out(compact);
+    for (unsigned id = 0; out.size() < size; ++id)
+        javascript_function(out, random, id);
+    return out.str();
+}
+
+static const char* const properties[] = {
+    "color: #3a7bd5;", "margin: 0 4px 8px 12px;", "padding: 6px 12px;",
+    "font: bold 14px/1.5 \"Helvetica Neue\", Arial, sans-serif;",
+    "background: url(\"img/bg.png\") no-repeat left top;", "border: 1px solid #ccc;",
+    "border-radius: 4px;", "display: inline-block;", "text-align: center;",
+    "line-height: 20px;", "vertical-align: middle;", "opacity: 0.65;",
+    "box-shadow: inset 0 1px 0 rgba(255, 255, 255, 0.15);", "cursor: pointer;"
+};
+static const unsigned kPropertyCount = sizeof(properties) / sizeof(properties[0]);
+
+static const char* const elements[] = {
+    "a", "li", "span", "div", "input", "button", "ul", "table", "td", "label"
+};
+static const unsigned kElementCount = sizeof(elements) / sizeof(elements[0]);
+
+static const char* const states[] = {
+    "", ":hover", ":focus", ":active", ":first-child", " > ", " + "
+};
+static const unsigned kStateCount = sizeof(states) / sizeof(states[0]);
+
+inline void css_rule(SourceWriter& out, Random& random, unsigned id)
+{
+    std::string selector = "." + std::string(random.pick(nouns, kNounCount)) + "-" + number(id);
+    std::string state = random.pick(states, kStateCount);
+    selector += state;
+    if (state.size() > 1 && state[1] != ':')
+        selector += random.pick(elements, kElementCount);
+    if (random.next(3) == 0)
+        selector += ", #" + std::string(random.pick(nouns, kNounCount)) + number(id) + " " + random.pick(elements, kElementCount);
+
+    out.open(selector + " {");
+    unsigned count = 2 + random.next(6);
+    for (unsigned p = 0; p < count; ++p)
+        out.line(random.pick(properties, kPropertyCount));
+    out.close("}");
+}
+
+inline std::string css_source(unsigned seed, size_t size, bool compact)
+{
+    Random random(seed);
+    SourceWriter out(compact);
+    for (unsigned id = 0; out.size() < size; ++id) {
+        if (id % 50 == 0)
+            out.comment("/* " + std::string(random.pick(nouns, kNounCount)) + " components */");
+        if (id % 40 == 39) {
+            out.open("@media (max-width: " + number(480 + 160 * random.next(6)) + "px) {");
+            css_rule(out, random, id);
+            out.close("}");
+        } else {
+            css_rule(out, random, id);
+        }
+    }
+    return out.str();
+}
+
+inline bool write_file(const std::string& path, const std::string& contents)
+{
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out << contents;
+    return out.good();
+}
+
+#endif
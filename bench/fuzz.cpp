@@ -0,0 +1,578 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Complexity fuzzer: looks for inputs on which the running time of a tool
+// grows faster than n log n. An input is a pattern whose unit (and an
+// optional closing unit, for nesting) is repeated k times; the pattern is
+// measured at k, 2k and 4k repetitions. Patterns are mutated from a few
+// seeds, and those that scale worse than their parent are kept as seeds
+// themselves. A pattern that crosses the threshold is minimized and saved
+// in the regression corpus, which --check runs again.
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <errno.h>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "corpus.h"
+
+// Growing like n log n gives an exponent of a little over 1 between the
+// sizes that get measured, and timing noise adds some more.
+static const double kFlagExponent = 1.4;
+
+// How far a reproducer may scale past the exponent it expects before it
+// counts as worse again.
+static const double kExpectedNoise = 0.4;
+
+// Below this much time above start-up, the measurement is mostly noise,
+// so the pattern is repeated more often first.
+static const double kMinimumSignalMs = 50;
+
+static const int kDefaultBudgetSeconds = 60;
+static const int kDefaultTimeoutSeconds = 10;
+static const int kDefaultRepeat = 2;
+static const size_t kDefaultMaxSize = 1024 * 1024;
+static const int kMinimizeBudget = 100;
+
+enum Part {
+    Prefix,
+    Unit,
+    Middle,
+    CloseUnit,
+    Suffix,
+    PartCount
+};
+
+struct Pattern
+{
+    Pattern() : expected(0) { }
+
+    std::string parts[PartCount];
+    // The exponent a reproducer is known to have, when the tool can't do
+    // better: one whose output grows faster than its input, say. 0 for none.
+    double expected;
+};
+
+struct Scaling
+{
+    size_t size;
+    double exponent;
+    bool flagged;
+    bool crashed;
+};
+
+static std::string build_dir = ".";
+static std::string work_file;
+static int timeout_seconds = kDefaultTimeoutSeconds;
+static int repeat = kDefaultRepeat;
+static size_t max_size = kDefaultMaxSize;
+
+static Pattern pattern(const char* prefix, const char* unit, const char* middle = "",
+                       const char* close = "", const char* suffix = "")
+{
+    Pattern p;
+    p.parts[Prefix] = prefix;
+    p.parts[Unit] = unit;
+    p.parts[Middle] = middle;
+    p.parts[CloseUnit] = close;
+    p.parts[Suffix] = suffix;
+    return p;
+}
+
+static std::vector<Pattern> seeds(Language language)
+{
+    std::vector<Pattern> result;
+    if (language == JavaScript) {
+        result.push_back(pattern("", "a = 1;\n"));
+        result.push_back(pattern("", "a + ", "1;"));
+        result.push_back(pattern("", "x", " = 1;\n"));
+        result.push_back(pattern("s = '", "a b ", "';\n"));
+        result.push_back(pattern("/*", "a\n", "*/\n"));
+        result.push_back(pattern("", "// a\n"));
+        result.push_back(pattern("", "{", "", "}"));
+        result.push_back(pattern("a = ", "[", "0", "]", ";\n"));
+        result.push_back(pattern("", "if (a) { b(); }\n"));
+        result.push_back(pattern("f(", "a, ", "b);\n"));
+        result.push_back(pattern("", "a = /x+/g;  \n"));
+    } else {
+        result.push_back(pattern("", "a { color: red; }\n"));
+        result.push_back(pattern("a {", " color: red;", " }\n"));
+        result.push_back(pattern("", ".a, ", ".b { color: red; }\n"));
+        result.push_back(pattern("/*", "x ", "*/\n"));
+        result.push_back(pattern("a { background: url(", "x", "); }\n"));
+        result.push_back(pattern("@media screen {", " a { b: c; }", " }\n"));
+        result.push_back(pattern("a { content: \"", "x ", "\"; }\n"));
+        result.push_back(pattern("a { margin: ", "0 ", "; }\n"));
+    }
+    return result;
+}
+
+static const char* const javascript_tokens[] = {
+    "{", "}", "(", ")", "[", "]", ";", ",", "'", "\"", "/", "*", "/*", "*/", "//",
+    "\n", " ", "    ", "\t", "a", "x1", "=", "+", ".", ":", "var ", "function ",
+    "return ", "if (", "\\", "0", "1e5", "/a/g", "<!--", "-->"
+};
+
+static const char* const css_tokens[] = {
+    "{", "}", ":", ";", ",", " ", "\n", "\t", "/*", "*/", "\"", "'", "(", ")", "url(",
+    "#", ".", "a", "0", "px", "@media ", "!important", ">", "\\", "-"
+};
+
+static std::string expand(const Pattern& p, size_t count)
+{
+    std::string result = p.parts[Prefix];
+    for (size_t i = 0; i < count; ++i)
+        result += p.parts[Unit];
+    result += p.parts[Middle];
+    for (size_t i = 0; i < count; ++i)
+        result += p.parts[CloseUnit];
+    return result + p.parts[Suffix];
+}
+
+static void mutate(Pattern& p, Random& random, Language language, const std::vector<Pattern>& pool)
+{
+    const char* const* tokens = language == JavaScript ? javascript_tokens : css_tokens;
+    unsigned count = language == JavaScript
+        ? sizeof(javascript_tokens) / sizeof(javascript_tokens[0])
+        : sizeof(css_tokens) / sizeof(css_tokens[0]);
+
+    // The repeated units matter most, so they are mutated most often.
+    static const Part targets[] = { Unit, Unit, Unit, CloseUnit, Prefix, Middle, Suffix };
+    std::string& part = p.parts[targets[random.next(sizeof(targets) / sizeof(targets[0]))]];
+    size_t at = part.empty() ? 0 : random.next(part.size() + 1);
+    switch (random.next(5)) {
+    case 0:
+        part.insert(at, random.pick(tokens, count));
+        break;
+    case 1:
+        if (!part.empty()) {
+            size_t length = 1 + random.next(std::min<size_t>(part.size() - std::min(at, part.size() - 1), 4));
+            part.erase(std::min(at, part.size() - 1), length);
+        }
+        break;
+    case 2:
+        if (!part.empty()) {
+            size_t from = random.next(part.size());
+            part.insert(at, part.substr(from, 1 + random.next(part.size() - from)));
+        }
+        break;
+    case 3:
+        if (!part.empty()) {
+            size_t from = std::min(at, part.size() - 1);
+            part.replace(from, 1, random.pick(tokens, count));
+        }
+        break;
+    default:
+        part += pool[random.next(pool.size())].parts[Unit];
+        break;
+    }
+}
+
+static double wall_time()
+{
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+// Runs the tool once on the input and returns the time it took in ms, or
+// a negative number if it crashed. Taking longer than the timeout counts
+// as infinitely slow.
+static double run_once(const Tool& tool, const std::string& input)
+{
+    if (!write_file(work_file, input)) {
+        std::cerr << "Error: can't write " << work_file << std::endl;
+        exit(1);
+    }
+
+    std::string executable = build_dir + "/" + tool.name + "/" + tool.name;
+    double start = wall_time();
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(null, 2);
+        // A pending alarm survives exec, so the tool gets killed when it
+        // runs for too long.
+        alarm(timeout_seconds);
+        if (tool.option)
+            execl(executable.c_str(), executable.c_str(), tool.option, work_file.c_str(), (char*)0);
+        else
+            execl(executable.c_str(), executable.c_str(), work_file.c_str(), (char*)0);
+        _exit(127);
+    }
+    if (pid < 0)
+        return -1;
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR)
+            return -1;
+    }
+    double elapsed = wall_time() - start;
+    if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+        return HUGE_VAL;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) == 127)
+        return -1;
+    return elapsed;
+}
+
+static double run(const Tool& tool, const std::string& input)
+{
+    double best = HUGE_VAL;
+    for (int i = 0; i < repeat; ++i) {
+        double elapsed = run_once(tool, input);
+        if (elapsed < 0)
+            return elapsed;
+        best = std::min(best, elapsed);
+        if (elapsed == HUGE_VAL)
+            break;
+    }
+    return best;
+}
+
+// Measures the pattern at k, 2k and 4k repetitions, with k large enough
+// for the time beyond start-up to be measurable. Start-up itself, the
+// time for a trivial input, is taken off.
+static Scaling measure(const Tool& tool, const Pattern& p, double startup)
+{
+    Scaling result = { 0, 0, false, false };
+    size_t unit = p.parts[Unit].size() + p.parts[CloseUnit].size();
+    if (unit == 0)
+        return result;
+
+    size_t count = 1;
+    double first = 0;
+    for (;;) {
+        std::string input = expand(p, count);
+        if (4 * input.size() > max_size)
+            return result;
+        first = run(tool, input);
+        if (first < 0) {
+            result.crashed = true;
+            return result;
+        }
+        first -= startup;
+        if (first >= kMinimumSignalMs)
+            break;
+        count *= 2;
+    }
+
+    double times[3] = { first, 0, 0 };
+    for (int i = 1; i < 3; ++i) {
+        std::string input = expand(p, count << i);
+        result.size = input.size();
+        times[i] = run(tool, input);
+        if (times[i] < 0) {
+            result.crashed = true;
+            return result;
+        }
+        times[i] -= startup;
+    }
+
+    // Both steps have to be steep, so that a single noisy run does not
+    // flag the pattern.
+    double step1 = log(std::max(times[1], 0.1) / times[0]) / log(2.0);
+    double step2 = log(std::max(times[2], 0.1) / std::max(times[1], 0.1)) / log(2.0);
+    result.exponent = (step1 + step2) / 2;
+    result.flagged = times[2] == HUGE_VAL || (std::min(step1, step2) > kFlagExponent - 0.2 && result.exponent > kFlagExponent);
+    return result;
+}
+
+// Removes as much of the pattern as possible while it stays flagged.
+static Pattern minimize(const Tool& tool, Pattern p, double startup)
+{
+    static const Part order[] = { Unit, CloseUnit, Prefix, Middle, Suffix };
+    int budget = kMinimizeBudget;
+    for (size_t o = 0; o < sizeof(order) / sizeof(order[0]); ++o) {
+        std::string& part = p.parts[order[o]];
+        for (size_t chunk = std::max<size_t>(part.size() / 2, 1); chunk > 0 && budget > 0; chunk /= 2) {
+            for (size_t at = 0; at < part.size() && budget > 0; ) {
+                Pattern candidate = p;
+                candidate.parts[order[o]].erase(at, chunk);
+                --budget;
+                if (measure(tool, candidate, startup).flagged)
+                    part = candidate.parts[order[o]];
+                else
+                    at += chunk;
+            }
+        }
+    }
+    return p;
+}
+
+static const char* extension(const Tool& tool)
+{
+    return tool.language == JavaScript ? ".js" : ".css";
+}
+
+// A reproducer is the pattern with one repetition, behind a comment that
+// says where its parts are and, optionally, "expect E" for the exponent it
+// is known to have.
+static std::string serialize(const Pattern& p)
+{
+    std::ostringstream out;
+    out << "/* complexity";
+    for (int i = 0; i < PartCount; ++i)
+        out << " " << p.parts[i].size();
+    if (p.expected > 0)
+        out << " expect " << p.expected;
+    out << " */\n";
+    for (int i = 0; i < PartCount; ++i)
+        out << p.parts[i];
+    return out.str();
+}
+
+static bool deserialize(const std::string& text, Pattern& p)
+{
+    size_t lengths[PartCount];
+    int consumed = 0;
+    if (sscanf(text.c_str(), "/* complexity %lu %lu %lu %lu %lu%n",
+               &lengths[0], &lengths[1], &lengths[2], &lengths[3], &lengths[4], &consumed) != 5
+        || !consumed)
+        return false;
+    int expect = 0;
+    p.expected = 0;
+    sscanf(text.c_str() + consumed, " expect %lf%n", &p.expected, &expect);
+    consumed += expect;
+    int end = 0;
+    sscanf(text.c_str() + consumed, " */%n", &end);
+    if (!end || text[consumed + end] != '\n')
+        return false;
+    size_t at = consumed + end + 1;
+    for (int i = 0; i < PartCount; ++i) {
+        if (at + lengths[i] > text.size())
+            return false;
+        p.parts[i] = text.substr(at, lengths[i]);
+        at += lengths[i];
+    }
+    return true;
+}
+
+static std::string save(const std::string& dir, const Tool& tool, const Pattern& p)
+{
+    std::string text = serialize(p);
+    unsigned hash = 2166136261u;
+    for (size_t i = 0; i < text.size(); ++i)
+        hash = (hash ^ static_cast<unsigned char>(text[i])) * 16777619u;
+    char name[64];
+    sprintf(name, "/%s-%08x%s", tool.name, hash, extension(tool));
+    std::string path = dir + name;
+    if (!write_file(path, text))
+        std::cerr << "Error: can't write " << path << std::endl;
+    return path;
+}
+
+// The reproducers of the tool in the regression corpus.
+static std::vector<std::pair<std::string, Pattern> > load(const std::string& dir, const Tool& tool)
+{
+    std::vector<std::pair<std::string, Pattern> > result;
+    DIR* d = opendir(dir.c_str());
+    if (!d)
+        return result;
+    std::string start = std::string(tool.name) + "-";
+    std::vector<std::string> names;
+    while (dirent* entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.compare(0, start.size(), start) == 0 && name.size() > strlen(extension(tool))
+            && name.compare(name.size() - strlen(extension(tool)), std::string::npos, extension(tool)) == 0)
+            names.push_back(name);
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        std::string path = dir + "/" + names[i];
+        std::ifstream in(path.c_str(), std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        Pattern p;
+        if (deserialize(buffer.str(), p))
+            result.push_back(std::make_pair(path, p));
+        else
+            std::cerr << "Warning: " << path << " is not a reproducer" << std::endl;
+    }
+    return result;
+}
+
+static double startup_time(const Tool& tool)
+{
+    double t = run(tool, tool.language == JavaScript ? "var a = 1;\n" : "a { color: red; }\n");
+    if (t < 0 || t == HUGE_VAL) {
+        std::cerr << "Error: can't run " << tool.name << std::endl;
+        exit(1);
+    }
+    return t;
+}
+
+// Runs every reproducer of the tool again; returns how many still scale
+// badly, or worse than they are expected to.
+static int check(const Tool& tool, const std::string& corpus_dir)
+{
+    std::vector<std::pair<std::string, Pattern> > entries = load(corpus_dir, tool);
+    if (entries.empty())
+        return 0;
+    double startup = startup_time(tool);
+    int flagged = 0;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        double expected = entries[i].second.expected;
+        Scaling s = measure(tool, entries[i].second, startup);
+        bool worse = s.flagged && (!expected || s.exponent > expected + kExpectedNoise);
+        if (worse)
+            ++flagged;
+        fprintf(stderr, "%-12s %-48s input^%.2f%s\n", tool.name, entries[i].first.c_str(),
+                s.exponent, worse ? "  super-linear!" : s.flagged ? "  as expected" : "");
+    }
+    return flagged;
+}
+
+static int fuzz(const Tool& tool, const std::string& corpus_dir, Random& random, int budget_seconds)
+{
+    double startup = startup_time(tool);
+    std::vector<Pattern> pool = seeds(tool.language);
+    std::vector<double> exponents(pool.size(), 0);
+    std::vector<std::pair<std::string, Pattern> > known = load(corpus_dir, tool);
+    for (size_t i = 0; i < known.size(); ++i) {
+        pool.push_back(known[i].second);
+        exponents.push_back(std::max(kFlagExponent, known[i].second.expected));
+    }
+
+    int found = 0;
+    int tried = 0;
+    double deadline = wall_time() + 1000.0 * budget_seconds;
+    while (wall_time() < deadline) {
+        size_t parent = random.next(pool.size());
+        Pattern candidate = pool[parent];
+        for (unsigned m = 1 + random.next(3); m > 0; --m)
+            mutate(candidate, random, tool.language, pool);
+        ++tried;
+
+        Scaling s = measure(tool, candidate, startup);
+        if (s.crashed || s.exponent <= exponents[parent] + 0.1)
+            continue;
+        if (!s.flagged) {
+            pool.push_back(candidate);
+            exponents.push_back(s.exponent);
+            continue;
+        }
+        if (!measure(tool, candidate, startup).flagged)
+            continue;
+
+        Pattern minimal = minimize(tool, candidate, startup);
+        std::string path = save(corpus_dir, tool, minimal);
+        ++found;
+        fprintf(stderr, "%-12s input^%.2f at %lu bytes, saved as %s\n", tool.name, s.exponent,
+                static_cast<unsigned long>(s.size), path.c_str());
+    }
+    fprintf(stderr, "%-12s %d patterns tried, %d super-linear\n", tool.name, tried, found);
+    return found;
+}
+
+static void usage()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    complexityfuzz [options]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --build-dir=DIR       Where the tools were built (default: .)" << std::endl;
+    std::cout << "    --corpus=DIR          The regression corpus (default: complexity)" << std::endl;
+    std::cout << "    --check               Only run the reproducers in the corpus again" << std::endl;
+    std::cout << "    --time=SECONDS        How long to fuzz each tool (default: 60)" << std::endl;
+    std::cout << "    --timeout=SECONDS     Longest a single run may take (default: 10)" << std::endl;
+    std::cout << "    --repeat=N            Runs per measurement, the fastest counts (default: 2)" << std::endl;
+    std::cout << "    --max-size=BYTES      Largest input to try (default: 1048576)" << std::endl;
+    std::cout << "    --seed=N              Seed of the mutations (default: 1)" << std::endl;
+    std::cout << "    --tools=A,B           Only fuzz these tools" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Exits with 1 if an input scales worse than n log n." << std::endl;
+    std::cout << std::endl;
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string corpus_dir = "complexity";
+    std::string only;
+    bool check_only = false;
+    int budget_seconds = kDefaultBudgetSeconds;
+    unsigned seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string option = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        if (option == "--build-dir")
+            build_dir = value;
+        else if (option == "--corpus")
+            corpus_dir = value;
+        else if (option == "--check")
+            check_only = true;
+        else if (option == "--time")
+            budget_seconds = atoi(value.c_str());
+        else if (option == "--timeout")
+            timeout_seconds = atoi(value.c_str());
+        else if (option == "--repeat")
+            repeat = atoi(value.c_str());
+        else if (option == "--max-size")
+            max_size = strtoul(value.c_str(), 0, 10);
+        else if (option == "--seed")
+            seed = strtoul(value.c_str(), 0, 10);
+        else if (option == "--tools")
+            only = "," + value + ",";
+        else
+            usage();
+    }
+    if (timeout_seconds < 1 || repeat < 1 || budget_seconds < 0)
+        usage();
+
+    mkdir(corpus_dir.c_str(), 0755);
+    std::ostringstream name;
+    name << "complexity-input-" << getpid();
+
+    Random random(seed);
+    int flagged = 0;
+    for (size_t t = 0; t < sizeof(tools) / sizeof(tools[0]); ++t) {
+        const Tool& tool = tools[t];
+        if (!only.empty() && only.find(std::string(",") + tool.name + ",") == std::string::npos)
+            continue;
+        work_file = name.str() + extension(tool);
+        flagged += check_only ? check(tool, corpus_dir) : fuzz(tool, corpus_dir, random, budget_seconds);
+        unlink(work_file.c_str());
+    }
+
+    return flagged ? 1 : 0;
+}
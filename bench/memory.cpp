@@ -0,0 +1,349 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Memory scaling benchmark: runs each tool on generated inputs of
+// geometrically growing size and records the peak resident set size, the
+// peak V8 heap and the number of collections of every run. It then fits
+// how memory grows with the input, so that tools growing faster than the
+// input can be spotted.
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "corpus.h"
+#include "report.h"
+
+static const double kDefaultMinSize = 1024;
+static const double kDefaultMaxSize = 64 * 1024 * 1024;
+static const double kDefaultFactor = 4;
+
+// Memory growing with a higher power of the input than this is reported
+// as super-linear; a little above 1 so that noise does not trigger it.
+static const double kSuperLinearExponent = 1.2;
+
+// Growth below this is start-up noise and is left out of the fit.
+static const double kMinimumGrowthKB = 1024;
+
+struct Sample
+{
+    double input_bytes;
+    double seconds;
+    double peak_rss_kb;
+    Metrics stats;
+};
+
+static double wall_time()
+{
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+// Writes an input of at least the given size, unless an earlier run
+// already did, and sets the size it actually has. The generators stop at
+// the end of a function or rule, so the source stays valid.
+static std::string input_file(const std::string& dir, Language language, double& size)
+{
+    std::ostringstream name;
+    name << dir << "/scale-" << static_cast<long>(size) << (language == JavaScript ? ".js" : ".css");
+    struct stat info;
+    if (stat(name.str().c_str(), &info) != 0) {
+        std::string source = language == JavaScript
+            ? javascript_source(700, static_cast<size_t>(size), false)
+            : css_source(800, static_cast<size_t>(size), false);
+        if (!write_file(name.str(), source) || stat(name.str().c_str(), &info) != 0) {
+            std::cerr << "Error: can't write " << name.str() << std::endl;
+            exit(1);
+        }
+    }
+    size = info.st_size;
+    return name.str();
+}
+
+// Runs the tool once with --stats=json. Fails if the tool did not exit
+// normally, e.g. because V8 ran out of memory.
+static bool run_tool(const std::string& executable, const char* option, const std::string& file,
+                     Sample& sample)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+
+    double start = wall_time();
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(fds[1], 2);
+        close(fds[0]);
+        if (option)
+            execl(executable.c_str(), executable.c_str(), "--stats=json", option, file.c_str(), (char*)0);
+        else
+            execl(executable.c_str(), executable.c_str(), "--stats=json", file.c_str(), (char*)0);
+        _exit(127);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        return false;
+    }
+
+    std::string stats;
+    char buffer[4096];
+    for (;;) {
+        ssize_t count = read(fds[0], buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            break;
+        stats.append(buffer, count);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    rusage usage;
+    while (wait4(pid, &status, 0, &usage) < 0) {
+        if (errno != EINTR)
+            return false;
+    }
+    sample.seconds = wall_time() - start;
+#ifdef __APPLE__
+    sample.peak_rss_kb = usage.ru_maxrss / 1024;
+#else
+    sample.peak_rss_kb = usage.ru_maxrss;
+#endif
+    if (!WIFEXITED(status) || WEXITSTATUS(status) == 127)
+        return false;
+
+    // The report is the last thing on stderr.
+    size_t begin = stats.rfind("\n{\n");
+    begin = begin == std::string::npos ? 0 : begin + 1;
+    return ReportReader(stats.substr(begin)).read(sample.stats) && sample.stats.count("heap.peak_used");
+}
+
+// Least-squares fit of y = a + b * x; returns b and sets a.
+static double fit_line(const std::vector<double>& x, const std::vector<double>& y, double& a)
+{
+    double n = x.size();
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        sx += x[i];
+        sy += y[i];
+        sxx += x[i] * x[i];
+        sxy += x[i] * y[i];
+    }
+    double d = n * sxx - sx * sx;
+    double b = d ? (n * sxy - sx * sy) / d : 0;
+    a = (sy - b * sx) / n;
+    return b;
+}
+
+// The power of the input size with which memory grows beyond what the
+// smallest input needed, from the samples where it grew noticeably. Zero
+// if it did not.
+static double growth_exponent(const std::vector<Sample>& samples, const std::vector<double>& kb)
+{
+    std::vector<double> x, y;
+    for (size_t i = 1; i < samples.size(); ++i) {
+        double growth = kb[i] - kb[0];
+        if (growth < kMinimumGrowthKB)
+            continue;
+        x.push_back(log(samples[i].input_bytes));
+        y.push_back(log(growth));
+    }
+    if (x.size() < 2)
+        return 0;
+    double a;
+    return fit_line(x, y, a);
+}
+
+static double parse_size(const std::string& value)
+{
+    char* end = 0;
+    double size = strtod(value.c_str(), &end);
+    if (*end == 'K' || *end == 'k')
+        size *= 1024;
+    else if (*end == 'M' || *end == 'm')
+        size *= 1024 * 1024;
+    return size;
+}
+
+static void usage()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    memorybench [options]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --build-dir=DIR       Where the tools were built (default: .)" << std::endl;
+    std::cout << "    --corpus=DIR          Where to generate the inputs (default: scaling)" << std::endl;
+    std::cout << "    --min-size=SIZE       Smallest input, e.g. 1K (default: 1K)" << std::endl;
+    std::cout << "    --max-size=SIZE       Largest input, e.g. 64M (default: 64M)" << std::endl;
+    std::cout << "    --factor=N            Growth from one input to the next (default: 4)" << std::endl;
+    std::cout << "    --tools=A,B           Only benchmark these tools" << std::endl;
+    std::cout << "    --output=FILE         Write the JSON report to FILE instead of stdout" << std::endl;
+    std::cout << std::endl;
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string build_dir = ".";
+    std::string corpus_dir = "scaling";
+    std::string output_file;
+    std::string only;
+    double min_size = kDefaultMinSize;
+    double max_size = kDefaultMaxSize;
+    double factor = kDefaultFactor;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string option = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        if (option == "--build-dir")
+            build_dir = value;
+        else if (option == "--corpus")
+            corpus_dir = value;
+        else if (option == "--min-size")
+            min_size = parse_size(value);
+        else if (option == "--max-size")
+            max_size = parse_size(value);
+        else if (option == "--factor")
+            factor = atof(value.c_str());
+        else if (option == "--tools")
+            only = "," + value + ",";
+        else if (option == "--output")
+            output_file = value;
+        else
+            usage();
+    }
+    if (min_size < 1 || max_size < min_size || factor <= 1)
+        usage();
+
+    mkdir(corpus_dir.c_str(), 0755);
+
+    std::ostringstream report;
+    report << "{\n  \"corpus_version\": " << kCorpusVersion << ",\n  \"tools\": {";
+    std::vector<std::string> flagged;
+
+    bool first_tool = true;
+    for (size_t t = 0; t < sizeof(tools) / sizeof(tools[0]); ++t) {
+        const Tool& tool = tools[t];
+        if (!only.empty() && only.find(std::string(",") + tool.name + ",") == std::string::npos)
+            continue;
+
+        std::string executable = build_dir + "/" + tool.name + "/" + tool.name;
+        if (access(executable.c_str(), X_OK) != 0) {
+            std::cerr << "Error: can't run " << executable << std::endl;
+            return 1;
+        }
+
+        fprintf(stderr, "%-12s %12s %10s %12s %12s %10s %6s %6s\n", tool.name, "Input (KB)", "Time (s)",
+                "RSS (KB)", "Heap (KB)", "Used (KB)", "Scav", "MS");
+        std::vector<Sample> samples;
+        double failed_at = 0;
+        for (double size = min_size; size <= max_size; size *= factor) {
+            Sample sample;
+            sample.input_bytes = floor(size);
+            std::string file = input_file(corpus_dir, tool.language, sample.input_bytes);
+            if (!run_tool(executable, tool.option, file, sample)) {
+                // Larger inputs would only fail the same way, more slowly.
+                fprintf(stderr, "%-12s %12.0f %10s\n", "", sample.input_bytes / 1024, "failed");
+                failed_at = sample.input_bytes;
+                break;
+            }
+            samples.push_back(sample);
+            fprintf(stderr, "%-12s %12.0f %10.2f %12.0f %12.0f %10.0f %6.0f %6.0f\n", "",
+                    sample.input_bytes / 1024, sample.seconds, sample.peak_rss_kb,
+                    sample.stats["heap.peak_total"] / 1024, sample.stats["heap.peak_used"] / 1024,
+                    sample.stats["heap.scavenges"], sample.stats["heap.mark_sweeps"]);
+        }
+        if (samples.empty()) {
+            std::cerr << "Error: " << tool.name << " failed on the smallest input" << std::endl;
+            return 1;
+        }
+
+        std::vector<double> sizes, rss, heap;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            sizes.push_back(samples[i].input_bytes);
+            rss.push_back(samples[i].peak_rss_kb);
+            heap.push_back(samples[i].stats["heap.peak_used"] / 1024);
+        }
+        double rss_base_kb;
+        double rss_per_byte = 1024 * fit_line(sizes, rss, rss_base_kb);
+        double rss_exponent = growth_exponent(samples, rss);
+        double heap_exponent = growth_exponent(samples, heap);
+        bool superlinear = rss_exponent > kSuperLinearExponent || heap_exponent > kSuperLinearExponent;
+        if (superlinear)
+            flagged.push_back(tool.name);
+        fprintf(stderr, "%-12s RSS = %.0f KB + %.2f x input, grows with input^%.2f (heap ^%.2f)%s\n\n", "",
+                rss_base_kb, rss_per_byte, rss_exponent, heap_exponent, superlinear ? "  super-linear!" : "");
+
+        report << (first_tool ? "" : ",") << "\n    \"" << tool.name << "\": {\n      \"runs\": [";
+        first_tool = false;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            Sample& sample = samples[i];
+            char buffer[512];
+            sprintf(buffer, "{ \"input_bytes\": %.0f, \"seconds\": %.3f, \"peak_rss_kb\": %.0f, "
+                    "\"heap_total\": %.0f, \"heap_used\": %.0f, "
+                    "\"scavenges\": %.0f, \"mark_sweeps\": %.0f }",
+                    sample.input_bytes, sample.seconds, sample.peak_rss_kb,
+                    sample.stats["heap.peak_total"], sample.stats["heap.peak_used"],
+                    sample.stats["heap.scavenges"], sample.stats["heap.mark_sweeps"]);
+            report << (i ? "," : "") << "\n        " << buffer;
+        }
+        char buffer[512];
+        sprintf(buffer, "\"rss_base_kb\": %.0f, \"rss_per_input_byte\": %.3f, \"rss_exponent\": %.3f, "
+                "\"heap_exponent\": %.3f, \"superlinear\": %s, \"failed_at\": %.0f",
+                rss_base_kb, rss_per_byte, rss_exponent, heap_exponent,
+                superlinear ? "true" : "false", failed_at);
+        report << "\n      ],\n      " << buffer << "\n    }";
+    }
+    report << "\n  }\n}\n";
+
+    if (output_file.empty()) {
+        std::cout << report.str();
+    } else if (!write_file(output_file, report.str())) {
+        std::cerr << "Error: can't write " << output_file << std::endl;
+        return 1;
+    }
+
+    for (size_t i = 0; i < flagged.size(); ++i)
+        std::cerr << "Warning: memory of " << flagged[i] << " grows faster than its input" << std::endl;
+
+    return 0;
+}
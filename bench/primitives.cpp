@@ -0,0 +1,184 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Microbenchmarks of the V8 operations that the hot paths of the tools
+// come down to. Each one runs a loop in JavaScript over realistic input,
+// generated source of the size of a typical script, and reports the time
+// per operation. Names given on the command line select benchmarks.
+
+#include <v8.h>
+
+#include <iostream>
+#include <string>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "corpus.h"
+
+using namespace v8;
+
+static const double kMinimumSeconds = 0.5;
+static const double kBatchSeconds = 0.02;
+static const size_t kSourceSize = 64 * 1024;
+
+struct Benchmark
+{
+    const char* name;
+    // The body of a function that has the input as `source` and the lines
+    // of it as `lines`, and returns the number of operations it did.
+    const char* body;
+};
+
+static const Benchmark benchmarks[] = {
+    { "charAt",
+      "var i, c, n = source.length;"
+      "for (i = 0; i < n; i += 1) { c = source.charAt(i); }"
+      "return n;" },
+    { "indexOf char",
+      "var ops = 0, i = 0;"
+      "while ((i = source.indexOf('\\n', i) + 1) > 0) { ops += 1; }"
+      "return ops;" },
+    { "indexOf string",
+      "var ops = 0, i = 0;"
+      "while ((i = source.indexOf('return', i) + 1) > 0) { ops += 1; }"
+      "return ops;" },
+    { "substr rest of line",
+      "var i, s, ops = 0;"
+      "for (i = 0; i < lines.length; i += 1) {"
+      "    s = lines[i];"
+      "    while (s.length > 0) { s = s.substr(4); ops += 1; }"
+      "}"
+      "return ops;" },
+    { "substr token",
+      "var i, t, n = source.length - 8;"
+      "for (i = 0; i < n; i += 8) { t = source.substr(i, 8); }"
+      "return Math.floor(n / 8);" },
+    { "slice token",
+      "var i, t, n = source.length - 8;"
+      "for (i = 0; i < n; i += 8) { t = source.slice(i, i + 8); }"
+      "return Math.floor(n / 8);" },
+    { "RegExp.exec tokens",
+      "var re = /\\s*([a-zA-Z_$][a-zA-Z0-9_$]*|[0-9]+|.)/g, ops = 0;"
+      "while (re.exec(source)) { ops += 1; }"
+      "return ops;" },
+    { "RegExp.exec per line",
+      "var re = /^\\s*(\\/\\/.*|[a-z]+)/, i;"
+      "for (i = 0; i < lines.length; i += 1) { re.exec(lines[i]); }"
+      "return lines.length;" },
+    { "replace callback",
+      "var ops = 0;"
+      "source.replace(/[a-z]+/g, function (w) { ops += 1; return w.toUpperCase(); });"
+      "return ops;" },
+    { "replace string",
+      "var ops = source.match(/\\s+/g).length;"
+      "source.replace(/\\s+/g, ' ');"
+      "return ops;" },
+    { "Array.push + join",
+      "var out = [], i, n = source.length - 8;"
+      "for (i = 0; i < n; i += 8) { out.push(source.substr(i, 8)); }"
+      "out.join('');"
+      "return out.length;" },
+    { "Object.create",
+      "var proto = { id: 'x', led: null, nud: null }, o, i;"
+      "for (i = 0; i < 100000; i += 1) { o = Object.create(proto); o.value = i; }"
+      "return 100000;" },
+    { "string +=",
+      "var out = '', i, n = source.length - 8;"
+      "for (i = 0; i < n; i += 8) { out += source.substr(i, 8); }"
+      "return Math.floor(n / 8);" }
+};
+
+static void measure(const Benchmark& benchmark)
+{
+    HandleScope handle_scope;
+    std::string code = "(function () {" + std::string(benchmark.body) + "})";
+    Handle<Script> script = Script::Compile(String::New(code.c_str()), String::New(benchmark.name));
+    if (script.IsEmpty()) {
+        std::cerr << benchmark.name << ": syntax error" << std::endl;
+        return;
+    }
+    Handle<Function> function = Handle<Function>::Cast(script->Run());
+
+    // Calls are batched so that a batch takes long enough for the clock,
+    // and the fastest batch is reported; the first ones include compiling.
+    double best = 0;
+    double ops = 0;
+    clock_t total = 0;
+    int batches = 0;
+    do {
+        HandleScope batch_scope;
+        clock_t start = clock();
+        clock_t elapsed;
+        double batch_ops = 0;
+        do {
+            Handle<Value> result = function->Call(Context::GetCurrent()->Global(), 0, 0);
+            if (result.IsEmpty()) {
+                std::cerr << benchmark.name << ": exception" << std::endl;
+                return;
+            }
+            ops = result->NumberValue();
+            batch_ops += ops;
+            elapsed = clock() - start;
+        } while (elapsed < kBatchSeconds * CLOCKS_PER_SEC);
+        double ns = 1e9 * elapsed / CLOCKS_PER_SEC / batch_ops;
+        if (batches == 0 || ns < best)
+            best = ns;
+        total += elapsed;
+        ++batches;
+    } while (total < kMinimumSeconds * CLOCKS_PER_SEC);
+
+    printf("%-24s %10.0f ops %10.2f ns/op\n", benchmark.name, ops, best);
+}
+
+static bool selected(int argc, char* argv[], const char* name)
+{
+    if (argc < 2)
+        return true;
+    for (int i = 1; i < argc; ++i) {
+        if (strstr(name, argv[i]))
+            return true;
+    }
+    return false;
+}
+
+int main(int argc, char* argv[])
+{
+    HandleScope handle_scope;
+    Persistent<Context> context = Context::New();
+    Context::Scope context_scope(context);
+
+    std::string source = javascript_source(900, kSourceSize, false);
+    Handle<String> string = String::New(source.data(), source.length());
+    context->Global()->Set(String::New("source"), string);
+    Handle<Script> split = Script::Compile(String::New("source.split('\\n')"));
+    context->Global()->Set(String::New("lines"), split->Run());
+
+    for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); ++i) {
+        if (selected(argc, argv, benchmarks[i].name))
+            measure(benchmarks[i]);
+    }
+
+    context.Dispose();
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_BENCH_REPORT_H
+#define EIGHTPACK_BENCH_REPORT_H
+
+// The JSON reports of the benchmarks, flattened into numbers by path, and
+// the comparison of a report with a saved baseline.
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef std::map<std::string, double> Metrics;
+
+// Reads the numbers of a JSON report, the ones written by the benchmarks
+// as well as the --stats=json one of the tools, keyed by their path, e.g.
+// "tools.jshint.mb_per_s". Strings are skipped.
+class ReportReader
+{
+public:
+    ReportReader(const std::string& text) : m_text(text), m_pos(0) { }
+
+    bool read(Metrics& metrics)
+    {
+        skip();
+        return value("", metrics) && (skip(), m_pos == m_text.size());
+    }
+
+private:
+    void skip()
+    {
+        while (m_pos < m_text.size() && isspace(static_cast<unsigned char>(m_text[m_pos])))
+            ++m_pos;
+    }
+
+    bool string(std::string& result)
+    {
+        if (m_text[m_pos] != '"')
+            return false;
+        size_t end = m_text.find('"', m_pos + 1);
+        if (end == std::string::npos)
+            return false;
+        result = m_text.substr(m_pos + 1, end - m_pos - 1);
+        m_pos = end + 1;
+        return true;
+    }
+
+    bool value(const std::string& path, Metrics& metrics)
+    {
+        skip();
+        if (m_pos >= m_text.size())
+            return false;
+        char c = m_text[m_pos];
+        if (c == '{') {
+            ++m_pos;
+            skip();
+            if (m_text[m_pos] == '}') {
+                ++m_pos;
+                return true;
+            }
+            for (;;) {
+                std::string key;
+                skip();
+                if (!string(key))
+                    return false;
+                skip();
+                if (m_text[m_pos++] != ':')
+                    return false;
+                if (!value(path.empty() ? key : path + "." + key, metrics))
+                    return false;
+                skip();
+                if (m_text[m_pos] == ',') {
+                    ++m_pos;
+                    continue;
+                }
+                return m_text[m_pos++] == '}';
+            }
+        }
+        if (c == '"') {
+            std::string ignored;
+            return string(ignored);
+        }
+        const char* start = m_text.c_str() + m_pos;
+        char* end = 0;
+        double number = strtod(start, &end);
+        if (end == start)
+            return false;
+        m_pos += end - start;
+        metrics[path] = number;
+        return true;
+    }
+
+    std::string m_text;
+    size_t m_pos;
+};
+
+inline bool load_report(const std::string& file, Metrics& metrics)
+{
+    std::ifstream in(file.c_str());
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return in && ReportReader(buffer.str()).read(metrics);
+}
+
+inline bool higher_is_better(const std::string& metric)
+{
+    return metric.find("_per_s") != std::string::npos;
+}
+
+// Prints the change of every metric the baseline has too. Returns the
+// number of metrics that got worse by more than the allowed percentage.
+inline int compare(const Metrics& baseline, const Metrics& current, double allowed)
+{
+    int regressions = 0;
+    fprintf(stderr, "%-44s %12s %12s %9s\n", "Metric", "Baseline", "Current", "Change");
+    for (Metrics::const_iterator i = current.begin(); i != current.end(); ++i) {
+        Metrics::const_iterator base = baseline.find(i->first);
+        if (base == baseline.end() || base->second == 0)
+            continue;
+        double change = 100 * (i->second - base->second) / base->second;
+        double worse = higher_is_better(i->first) ? -change : change;
+        bool regressed = allowed >= 0 && worse > allowed;
+        if (regressed)
+            ++regressions;
+        fprintf(stderr, "%-44s %12.3f %12.3f %+8.1f%%%s\n", i->first.c_str(),
+                base->second, i->second, change, regressed ? "  !" : "");
+    }
+    return regressions;
+}
+
+#endif
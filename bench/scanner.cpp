@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Scanner microbenchmark: pre-parses the embedded tool scripts and a few
+// synthetic inputs dominated by white space and comments, and reports the
+// scanning throughput of each. Extra files given on the command line are
+// measured as well.
+
+#include <v8.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <stdio.h>
+#include <time.h>
+
+#include "jshint/jshint_script.h"
+#include "jslint/jslint_script.h"
+
+using namespace v8;
+
+static const double kMinimumSeconds = 0.5;
+
+static std::string indented_source()
+{
+    std::string source;
+    for (int i = 0; i < 20000; ++i) {
+        source += "function f" + std::string(1, 'a' + i % 26) + "() {\n";
+        source += "                if (x) {\n";
+        source += "                        return  x  +  1 ;\n";
+        source += "                }\n";
+        source += "}\n\n";
+    }
+    return source;
+}
+
+static std::string line_comment_source()
+{
+    std::string source;
+    for (int i = 0; i < 20000; ++i) {
+        source += "// The quick brown fox jumps over the lazy dog, again and again.\n";
+        source += "var a = 1; // trailing remark about the assignment above\n";
+    }
+    return source;
+}
+
+static std::string block_comment_source()
+{
+    std::string source;
+    for (int i = 0; i < 10000; ++i) {
+        source += "/**\n";
+        source += " * Returns the sum of its two arguments. Both must be numbers,\n";
+        source += " * otherwise the result is unspecified.\n";
+        source += " */\n";
+        source += "function add(a, b) { return a + b; }\n";
+    }
+    return source;
+}
+
+static void measure(const char* name, const std::string& source)
+{
+    HandleScope handle_scope;
+    Handle<String> string = String::New(source.data(), source.length());
+
+    // Report the fastest pass; the others mostly measure the machine.
+    clock_t best = 0;
+    clock_t total = 0;
+    int iterations = 0;
+    do {
+        clock_t start = clock();
+        ScriptData* data = ScriptData::PreCompile(string);
+        clock_t elapsed = clock() - start;
+        bool error = data->HasError();
+        delete data;
+        if (error) {
+            std::cerr << name << ": syntax error" << std::endl;
+            return;
+        }
+        if (iterations == 0 || elapsed < best)
+            best = elapsed;
+        total += elapsed;
+        ++iterations;
+    } while (total < kMinimumSeconds * CLOCKS_PER_SEC);
+
+    double seconds = static_cast<double>(best) / CLOCKS_PER_SEC;
+    double ms = 1000 * seconds;
+    double mb = static_cast<double>(source.length()) / (1024 * 1024);
+    printf("%-24s %9d chars %9.3f ms %8.1f MB/s\n",
+           name, static_cast<int>(source.length()), ms, mb / seconds);
+}
+
+int main(int argc, char* argv[])
+{
+    HandleScope handle_scope;
+    Persistent<Context> context = Context::New();
+    Context::Scope context_scope(context);
+
+    measure("jshint", jshint_script);
+    measure("jslint", jslint_script);
+    measure("indentation", indented_source());
+    measure("line comments", line_comment_source());
+    measure("block comments", block_comment_source());
+
+    for (int i = 1; i < argc; ++i) {
+        std::ifstream file(argv[i]);
+        if (!file) {
+            std::cerr << argv[i] << ": can't open the file" << std::endl;
+            continue;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        measure(argv[i], buffer.str());
+    }
+
+    context.Dispose();
+    return 0;
+}
@@ -0,0 +1,317 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Cold-start benchmark: launches each tool many times on a trivial input
+// and reports how long it takes until the process has exited, broken down
+// into the steps of starting up. The breakdown comes from the --stats=json
+// report of every run.
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "report.h"
+
+static const int kDefaultRuns = 20;
+
+struct Tool
+{
+    const char* name;
+    const char* input;
+};
+
+static const Tool tools[] = {
+    { "jshint", "trivial.js" },
+    { "jslint", "trivial.js" },
+    { "jsbeautify", "trivial.js" },
+    { "jsmin", "trivial.js" },
+    { "cssbeautify", "trivial.css" },
+    { "cssmin", "trivial.css" }
+};
+
+// The steps of a start, in the order they happen. "exec" runs from the
+// fork until the runner got control, "natives" is compiling the built-in
+// library as part of creating the context, and "first_output" and "exit"
+// are measured from the fork.
+enum Step {
+    Exec,
+    Initialize,
+    Natives,
+    Context,
+    Setup,
+    Compile,
+    FirstOutput,
+    Exit,
+    StepCount
+};
+
+static const char* step_names[StepCount] = {
+    "exec",
+    "initialize",
+    "natives",
+    "context",
+    "setup",
+    "compile",
+    "first_output",
+    "exit"
+};
+
+static double wall_time()
+{
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+static bool write_file(const std::string& path, const std::string& contents)
+{
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out << contents;
+    return out.good();
+}
+
+// Runs the tool once with its output discarded and returns the --stats
+// report it printed, along with the times of the fork and of the exit.
+static bool run_tool(const std::string& executable, const std::string& file,
+                     double& forked_at, double& exited_at, std::string& stats)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+        return false;
+
+    forked_at = wall_time();
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(fds[1], 2);
+        close(fds[0]);
+        execl(executable.c_str(), executable.c_str(), "--stats=json", file.c_str(), (char*)0);
+        _exit(127);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        return false;
+    }
+
+    stats.clear();
+    char buffer[4096];
+    for (;;) {
+        ssize_t count = read(fds[0], buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            break;
+        stats.append(buffer, count);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR)
+            return false;
+    }
+    exited_at = wall_time();
+    return WIFEXITED(status) && WEXITSTATUS(status) != 127;
+}
+
+// Turns the --stats report of one run into the time of each step. Steps
+// that did not happen, such as output from a linter with nothing to say,
+// are negative.
+static bool breakdown(const std::string& stats, double forked_at, double exited_at, double steps[StepCount])
+{
+    // The report is the last thing on stderr.
+    size_t start = stats.rfind("\n{\n");
+    start = start == std::string::npos ? 0 : start + 1;
+    Metrics metrics;
+    if (!ReportReader(stats.substr(start)).read(metrics) || !metrics.count("milestones.start"))
+        return false;
+
+    double natives = metrics["counters.c:V8.NativesBootstrapMicroseconds"] / 1000;
+    steps[Exec] = metrics["milestones.start"] - forked_at;
+    steps[Initialize] = metrics["phases.initialize.wall"];
+    steps[Natives] = natives;
+    steps[Context] = std::max(0.0, metrics["phases.context.wall"] - natives);
+    steps[Setup] = metrics["phases.setup.wall"];
+    steps[Compile] = metrics["phases.compile.wall"];
+    steps[FirstOutput] = metrics.count("milestones.first_output") ? metrics["milestones.first_output"] - forked_at : -1;
+    steps[Exit] = exited_at - forked_at;
+    return true;
+}
+
+static double percentile(const std::vector<double>& sorted, double fraction)
+{
+    return sorted[static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5)];
+}
+
+static void usage()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    startupbench [options]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --build-dir=DIR       Where the tools were built (default: .)" << std::endl;
+    std::cout << "    --runs=N              Launches per tool (default: 20)" << std::endl;
+    std::cout << "    --tools=A,B           Only benchmark these tools" << std::endl;
+    std::cout << "    --output=FILE         Write the JSON report to FILE instead of stdout" << std::endl;
+    std::cout << "    --baseline=FILE       Compare against a previous report" << std::endl;
+    std::cout << "    --max-regression=PCT  Fail if a step is slower than the baseline by more" << std::endl;
+    std::cout << "                          than PCT percent" << std::endl;
+    std::cout << std::endl;
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string build_dir = ".";
+    std::string output_file;
+    std::string baseline_file;
+    std::string only;
+    int runs = kDefaultRuns;
+    double allowed = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string option = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        if (option == "--build-dir")
+            build_dir = value;
+        else if (option == "--runs")
+            runs = atoi(value.c_str());
+        else if (option == "--tools")
+            only = "," + value + ",";
+        else if (option == "--output")
+            output_file = value;
+        else if (option == "--baseline")
+            baseline_file = value;
+        else if (option == "--max-regression")
+            allowed = atof(value.c_str());
+        else
+            usage();
+    }
+    if (runs < 1)
+        usage();
+
+    // Small enough that reading and processing it is noise.
+    if (!write_file("trivial.js", "var answer = 42;\n") || !write_file("trivial.css", "a { color: red; }\n")) {
+        std::cerr << "Error: can't write the input files" << std::endl;
+        return 1;
+    }
+
+    std::ostringstream report;
+    Metrics metrics;
+    report << "{\n  \"runs\": " << runs << ",\n  \"tools\": {";
+
+    fprintf(stderr, "%-12s %-14s %10s %10s %10s %10s\n", "Tool", "Step", "Min (ms)", "p50 (ms)", "p99 (ms)", "Max (ms)");
+    bool first_tool = true;
+    for (size_t t = 0; t < sizeof(tools) / sizeof(tools[0]); ++t) {
+        const Tool& tool = tools[t];
+        if (!only.empty() && only.find(std::string(",") + tool.name + ",") == std::string::npos)
+            continue;
+
+        std::string executable = build_dir + "/" + tool.name + "/" + tool.name;
+        if (access(executable.c_str(), X_OK) != 0) {
+            std::cerr << "Error: can't run " << executable << std::endl;
+            return 1;
+        }
+
+        std::vector<double> samples[StepCount];
+        for (int i = 0; i < runs; ++i) {
+            double forked_at, exited_at;
+            std::string stats;
+            double steps[StepCount];
+            if (!run_tool(executable, tool.input, forked_at, exited_at, stats)
+                || !breakdown(stats, forked_at, exited_at, steps)) {
+                std::cerr << "Error: " << tool.name << " failed to run" << std::endl;
+                return 1;
+            }
+            for (int s = 0; s < StepCount; ++s) {
+                if (steps[s] >= 0)
+                    samples[s].push_back(steps[s]);
+            }
+        }
+
+        report << (first_tool ? "" : ",") << "\n    \"" << tool.name << "\": {";
+        first_tool = false;
+        bool first_step = true;
+        for (int s = 0; s < StepCount; ++s) {
+            std::vector<double>& values = samples[s];
+            if (values.empty())
+                continue;
+            std::sort(values.begin(), values.end());
+            double mean = 0;
+            for (size_t i = 0; i < values.size(); ++i)
+                mean += values[i] / values.size();
+
+            char buffer[256];
+            sprintf(buffer, "\"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f",
+                    values.front(), percentile(values, 0.5), percentile(values, 0.9),
+                    percentile(values, 0.99), values.back(), mean);
+            report << (first_step ? "" : ",") << "\n      \"" << step_names[s] << "\": { " << buffer << " }";
+            first_step = false;
+
+            std::string prefix = std::string("tools.") + tool.name + "." + step_names[s];
+            metrics[prefix + ".p50"] = percentile(values, 0.5);
+            metrics[prefix + ".p99"] = percentile(values, 0.99);
+
+            fprintf(stderr, "%-12s %-14s %10.3f %10.3f %10.3f %10.3f\n", s ? "" : tool.name, step_names[s],
+                    values.front(), percentile(values, 0.5), percentile(values, 0.99), values.back());
+        }
+        report << "\n    }";
+    }
+    report << "\n  }\n}\n";
+
+    if (output_file.empty()) {
+        std::cout << report.str();
+    } else if (!write_file(output_file, report.str())) {
+        std::cerr << "Error: can't write " << output_file << std::endl;
+        return 1;
+    }
+
+    if (!baseline_file.empty()) {
+        Metrics baseline;
+        if (!load_report(baseline_file, baseline)) {
+            std::cerr << "Error: can't read the baseline " << baseline_file << std::endl;
+            return 1;
+        }
+        std::cerr << std::endl;
+        if (compare(baseline, metrics, allowed) > 0)
+            return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+// Tool throughput benchmark: runs every tool over a generated corpus a
+// number of times and reports throughput, latency and peak memory use as
+// JSON, optionally compared against a saved baseline.
+//
+// The corpus is synthetic and comes from a fixed seed, so it is the same
+// on every machine and for every revision of the tools. Each tool is run
+// as its own process, the way it is used, so start-up is part of the
+// measurement.
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include "corpus.h"
+#include "report.h"
+
+static const int kDefaultIterations = 3;
+
+struct CorpusFile
+{
+    std::string group;
+    std::string path;
+    size_t size;
+};
+
+static void add_file(std::vector<CorpusFile>& corpus, const std::string& dir,
+                     const std::string& group, const std::string& name, const std::string& contents)
+{
+    CorpusFile file;
+    file.group = group;
+    file.path = dir + "/" + name;
+    file.size = contents.size();
+    if (!write_file(file.path, contents)) {
+        std::cerr << "Error: can't write " << file.path << std::endl;
+        exit(1);
+    }
+    corpus.push_back(file);
+}
+
+static std::vector<CorpusFile> generate_corpus(const std::string& dir, Language language)
+{
+    mkdir(dir.c_str(), 0755);
+
+    std::vector<CorpusFile> corpus;
+    if (language == JavaScript) {
+        for (unsigned i = 0; i < 10; ++i)
+            add_file(corpus, dir, "small", "small" + number(i) + ".js", javascript_source(100 + i, 4 * 1024, false));
+        add_file(corpus, dir, "medium", "medium.js", javascript_source(200, 128 * 1024, false));
+        add_file(corpus, dir, "huge", "huge.js", javascript_source(300, 1024 * 1024, false));
+        add_file(corpus, dir, "minified", "bundle.min.js", javascript_source(400, 256 * 1024, true));
+    } else {
+        for (unsigned i = 0; i < 10; ++i)
+            add_file(corpus, dir, "small", "small" + number(i) + ".css", css_source(500 + i, 2 * 1024, false));
+        add_file(corpus, dir, "framework", "framework.css", css_source(600, 256 * 1024, false));
+        add_file(corpus, dir, "minified", "framework.min.css", css_source(600, 256 * 1024, true));
+    }
+    return corpus;
+}
+
+struct Run
+{
+    double seconds;
+    long peak_rss_kb;
+    bool ok;
+};
+
+static double now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Runs the tool on one file with its output discarded.
+static Run run_tool(const std::string& executable, const char* option, const std::string& file)
+{
+    Run run = { 0, 0, false };
+    double start = now();
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(null, 2);
+        if (option)
+            execl(executable.c_str(), executable.c_str(), option, file.c_str(), (char*)0);
+        else
+            execl(executable.c_str(), executable.c_str(), file.c_str(), (char*)0);
+        _exit(127);
+    }
+    if (pid < 0)
+        return run;
+
+    int status = 0;
+    rusage usage;
+    while (wait4(pid, &status, 0, &usage) < 0) {
+        if (errno != EINTR)
+            return run;
+    }
+    run.seconds = now() - start;
+#ifdef __APPLE__
+    run.peak_rss_kb = usage.ru_maxrss / 1024;
+#else
+    run.peak_rss_kb = usage.ru_maxrss;
+#endif
+    // The linters exit with a failure status when they find problems.
+    run.ok = WIFEXITED(status) && WEXITSTATUS(status) != 127;
+    return run;
+}
+
+struct Measurement
+{
+    Measurement() : bytes(0), seconds(0), peak_rss_kb(0) { }
+
+    double bytes;
+    double seconds;
+    long peak_rss_kb;
+    std::vector<double> latencies;
+
+    void add(const Run& run, size_t size)
+    {
+        bytes += size;
+        seconds += run.seconds;
+        peak_rss_kb = std::max(peak_rss_kb, run.peak_rss_kb);
+        latencies.push_back(run.seconds);
+    }
+};
+
+static double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(fraction * (values.size() - 1) + 0.5);
+    return values[index];
+}
+
+static void metrics_of(const std::string& prefix, const Measurement& m, Metrics& metrics)
+{
+    metrics[prefix + ".mb_per_s"] = m.seconds ? m.bytes / (1024 * 1024) / m.seconds : 0;
+    metrics[prefix + ".files_per_s"] = m.seconds ? m.latencies.size() / m.seconds : 0;
+    metrics[prefix + ".p50_ms"] = 1000 * percentile(m.latencies, 0.5);
+    metrics[prefix + ".p99_ms"] = 1000 * percentile(m.latencies, 0.99);
+    metrics[prefix + ".peak_rss_kb"] = m.peak_rss_kb;
+}
+
+static void write_measurement(std::ostream& out, const Measurement& m)
+{
+    char buffer[512];
+    sprintf(buffer, "\"runs\": %d, \"bytes\": %.0f, \"mb_per_s\": %.3f, \"files_per_s\": %.3f, "
+            "\"p50_ms\": %.3f, \"p99_ms\": %.3f, \"peak_rss_kb\": %ld",
+            static_cast<int>(m.latencies.size()), m.bytes,
+            m.seconds ? m.bytes / (1024 * 1024) / m.seconds : 0,
+            m.seconds ? m.latencies.size() / m.seconds : 0,
+            1000 * percentile(m.latencies, 0.5), 1000 * percentile(m.latencies, 0.99), m.peak_rss_kb);
+    out << buffer;
+}
+
+static void usage()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    toolbench [options]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --build-dir=DIR       Where the tools were built (default: .)" << std::endl;
+    std::cout << "    --corpus=DIR          Where to generate the corpus (default: corpus)" << std::endl;
+    std::cout << "    --iterations=N        Runs per tool and file (default: 3)" << std::endl;
+    std::cout << "    --tools=A,B           Only benchmark these tools" << std::endl;
+    std::cout << "    --output=FILE         Write the JSON report to FILE instead of stdout" << std::endl;
+    std::cout << "    --baseline=FILE       Compare against a previous report" << std::endl;
+    std::cout << "    --max-regression=PCT  Fail if a metric is worse than the baseline by more" << std::endl;
+    std::cout << "                          than PCT percent" << std::endl;
+    std::cout << std::endl;
+    exit(1);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string build_dir = ".";
+    std::string corpus_dir = "corpus";
+    std::string output_file;
+    std::string baseline_file;
+    std::string only;
+    int iterations = kDefaultIterations;
+    double allowed = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string option = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        if (option == "--build-dir")
+            build_dir = value;
+        else if (option == "--corpus")
+            corpus_dir = value;
+        else if (option == "--iterations")
+            iterations = atoi(value.c_str());
+        else if (option == "--tools")
+            only = "," + value + ",";
+        else if (option == "--output")
+            output_file = value;
+        else if (option == "--baseline")
+            baseline_file = value;
+        else if (option == "--max-regression")
+            allowed = atof(value.c_str());
+        else
+            usage();
+    }
+    if (iterations < 1)
+        usage();
+
+    mkdir(corpus_dir.c_str(), 0755);
+    std::vector<CorpusFile> corpora[2];
+    corpora[JavaScript] = generate_corpus(corpus_dir + "/js", JavaScript);
+    corpora[Css] = generate_corpus(corpus_dir + "/css", Css);
+
+    std::ostringstream report;
+    Metrics metrics;
+    report << "{\n  \"corpus_version\": " << kCorpusVersion << ",\n  \"iterations\": " << iterations << ",\n  \"tools\": {";
+
+    bool first_tool = true;
+    for (size_t t = 0; t < sizeof(tools) / sizeof(tools[0]); ++t) {
+        const Tool& tool = tools[t];
+        if (!only.empty() && only.find(std::string(",") + tool.name + ",") == std::string::npos)
+            continue;
+
+        std::string executable = build_dir + "/" + tool.name + "/" + tool.name;
+        if (access(executable.c_str(), X_OK) != 0) {
+            std::cerr << "Error: can't run " << executable << std::endl;
+            return 1;
+        }
+
+        const std::vector<CorpusFile>& corpus = corpora[tool.language];
+        Measurement total;
+        std::map<std::string, Measurement> groups;
+        std::vector<std::string> group_order;
+        for (size_t f = 0; f < corpus.size(); ++f) {
+            const CorpusFile& file = corpus[f];
+            if (groups.find(file.group) == groups.end())
+                group_order.push_back(file.group);
+            for (int i = 0; i < iterations; ++i) {
+                Run run = run_tool(executable, tool.option, file.path);
+                if (!run.ok) {
+                    std::cerr << "Error: " << tool.name << " failed on " << file.path << std::endl;
+                    return 1;
+                }
+                total.add(run, file.size);
+                groups[file.group].add(run, file.size);
+            }
+        }
+        std::cerr << tool.name << ": " << total.latencies.size() << " runs in " << total.seconds << " s" << std::endl;
+
+        report << (first_tool ? "" : ",") << "\n    \"" << tool.name << "\": { ";
+        first_tool = false;
+        write_measurement(report, total);
+        report << ",\n      \"groups\": {";
+        metrics_of(std::string("tools.") + tool.name, total, metrics);
+        for (size_t g = 0; g < group_order.size(); ++g) {
+            const std::string& group = group_order[g];
+            report << (g ? "," : "") << "\n        \"" << group << "\": { ";
+            write_measurement(report, groups[group]);
+            report << " }";
+            metrics_of(std::string("tools.") + tool.name + ".groups." + group, groups[group], metrics);
+        }
+        report << "\n      }\n    }";
+    }
+    report << "\n  }\n}\n";
+
+    if (output_file.empty()) {
+        std::cout << report.str();
+    } else if (!write_file(output_file, report.str())) {
+        std::cerr << "Error: can't write " << output_file << std::endl;
+        return 1;
+    }
+
+    if (!baseline_file.empty()) {
+        Metrics baseline;
+        if (!load_report(baseline_file, baseline)) {
+            std::cerr << "Error: can't read the baseline " << baseline_file << std::endl;
+            return 1;
+        }
+        if (baseline["corpus_version"] != kCorpusVersion) {
+            std::cerr << "Error: the baseline was measured on a different corpus" << std::endl;
+            return 1;
+        }
+        if (compare(baseline, metrics, allowed) > 0)
+            return 1;
+    }
+
+    return 0;
+}
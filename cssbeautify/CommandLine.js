@@ -18,6 +18,7 @@ function help() {
     console.log();
     console.log('General options:');
     console.log('    --help          Show this help screen');
+    console.log('    --check         Only check that the file is formatted already');
     console.log();
     console.log('Formatting options:');
     for (opt in settings) {
@@ -42,6 +43,40 @@ function help() {
     system.exit(-1);
 }
 
+// With --check, the file as it is and how much of it the output has
+// matched so far. This and the two functions below are the same in
+// jsbeautify/CommandLine.js and cssbeautify/CommandLine.js on purpose:
+// each tool script is packed on its own, so there is nowhere to share
+// them. Change both together.
+var expected, checked = 0;
+
+function report_difference(text) {
+    'use strict';
+    var i = 0, line = 1, start = 0, next;
+    while (i < text.length && text.charAt(i) === expected.charAt(checked + i)) {
+        i += 1;
+    }
+    i += checked;
+    next = expected.indexOf('\n');
+    while (next >= 0 && next < i) {
+        line += 1;
+        start = next + 1;
+        next = expected.indexOf('\n', start);
+    }
+    console.log(fname + ': not formatted, first difference at line', line, 'column', i - start + 1);
+    system.exit(1);
+}
+
+// Compares the output, piece by piece as the beautifier hands it over,
+// with the file and stops at the first difference.
+function check_output(text) {
+    'use strict';
+    if (expected.substr(checked, text.length) !== text) {
+        report_difference(text);
+    }
+    checked += text.length;
+}
+
 if (system.args.length < 1) {
     help();
 }
@@ -61,6 +96,11 @@ system.args.forEach(function (arg) {
                 help();
             }
 
+            if (option === 'check') {
+                options.check = check_output;
+                return;
+            }
+
             i = option.indexOf('=');
             if (i >= 0) {
                 str = option.substring(i + 1, option.length);
@@ -126,8 +166,25 @@ while (options.indent_size > 0) {
 
 try {
     style = system.readFile(fname);
+    if (options.check) {
+        // system.readFile() ends the text with a newline of its own, the
+        // one console.log() would print.
+        expected = style.substring(0, style.length - 1);
+    }
     result = cssbeautify(style, options);
-    console.log(result);
+    if (options.check) {
+        // cssbeautify keeps the blank lines at the end, which would grow
+        // by one each time; a file that ends in one newline is formatted.
+        check_output(result.replace(/\s+$/, '') + '\n');
+        if (checked !== expected.length) {
+            report_difference('');
+        }
+    } else {
+        console.log(result);
+    }
 } catch (e) {
     console.log(e);
+    if (options.check) {
+        system.exit(-1);
+    }
 }
@@ -23,11 +23,11 @@
 
 #include "cssbeautify_script.h"
 
-extern void eightpack_run(int argc, char** argv, const char* cmd);
+extern void eightpack_run(int argc, char** argv, const char* cmd, const char* tool);
 
 int main(int argc, char* argv[])
 {
-    eightpack_run(argc, argv, cssbeautify_script);
+    eightpack_run(argc, argv, cssbeautify_script, "cssbeautify");
     return 0;
 }
 
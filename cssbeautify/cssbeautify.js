@@ -29,7 +29,7 @@ function cssbeautify(style, opt) {
     var options, index = 0, length = style.length, formatted = '',
         ch, ch2, str, state, State, depth, quote, comment,
         openbracesuffix = true,
-        trimRight;
+        trimRight, parts = [], flushAt = 4096;
 
     options = arguments.length > 1 ? opt : {};
     if (typeof options.indent === 'undefined') {
@@ -77,6 +77,24 @@ function cssbeautify(style, opt) {
         depth += 1;
     }
 
+    // Nothing takes back the output up to its last character that isn't
+    // blank, so the part before it is moved out of the way as it goes:
+    // handed over with options.check, kept for the end otherwise. What is
+    // left stays short, so trimRight() doesn't copy all of the output for
+    // every declaration.
+    function flushOutput() {
+        var end = formatted.search(/\S\s*$/);
+        if (end > 0) {
+            if (typeof options.check === 'function') {
+                options.check(formatted.substr(0, end));
+            } else {
+                parts.push(formatted.substr(0, end));
+            }
+            formatted = formatted.substr(end);
+        }
+        flushAt = formatted.length + 4096;
+    }
+
     function closeBlock() {
         depth -= 1;
         formatted = trimRight(formatted);
@@ -115,6 +133,9 @@ function cssbeautify(style, opt) {
     style = style.replace(/\r\n/g, '\n');
 
     while (index < length) {
+        if (formatted.length > flushAt) {
+            flushOutput();
+        }
         ch = style.charAt(index);
         ch2 = style.charAt(index + 1);
         index += 1;
@@ -382,5 +403,5 @@ function cssbeautify(style, opt) {
         formatted += ch;
     }
 
-    return formatted;
+    return parts.join('') + formatted;
 }
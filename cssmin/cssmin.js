@@ -25,6 +25,7 @@ YAHOO.compressor.cssmin = function (css, linebreakpos) {
         i = 0, max = 0,
         preservedTokens = [],
         comments = [],
+        parts = [],
         token = '',
         totallen = css.length,
         placeholder = '';
@@ -196,8 +197,23 @@ YAHOO.compressor.cssmin = function (css, linebreakpos) {
     // shorter opacity IE filter
     css = css.replace(/progid:DXImageTransform\.Microsoft\.Alpha\(Opacity=/gi, "alpha(opacity=");
 
-    // Remove empty rules.
-    css = css.replace(/[^\};\{\/]+\{\}/g, "");
+    // Remove empty rules: the run of characters other than "}", ";", "{"
+    // and "/" before each "{}". Done by hand, since the regular expression
+    // /[^\};\{\/]+\{\}/g tries every position of a long run with no "{}"
+    // after it, which takes quadratic time.
+    startIndex = 0;
+    for (endIndex = css.indexOf("{}"); endIndex >= 0; endIndex = css.indexOf("{}", endIndex + 2)) {
+        i = endIndex;
+        while (i > startIndex && "};{/".indexOf(css.charAt(i - 1)) < 0) {
+            i = i - 1;
+        }
+        if (i < endIndex) {
+            parts.push(css.slice(startIndex, i));
+            startIndex = endIndex + 2;
+        }
+    }
+    parts.push(css.slice(startIndex));
+    css = parts.join("");
 
     if (linebreakpos >= 0) {
         // Some source control tools don't like it when files containing lines longer
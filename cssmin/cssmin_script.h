@@ -46,6 +46,7 @@ static const char cssmin_script[] = \
 	"\x69\x20\x3D\x20\x30\x2C\x20\x6D\x61\x78\x20\x3D\x20\x30\x2C\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x70\x72\x65\x73\x65\x72\x76\x65\x64\x54\x6F\x6B\x65\x6E\x73\x20"\
 	"\x3D\x20\x5B\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65\x6E"\
+	"\x74\x73\x20\x3D\x20\x5B\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72"\
 	"\x74\x73\x20\x3D\x20\x5B\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B"\
 	"\x65\x6E\x20\x3D\x20\x27\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x74"\
 	"\x61\x6C\x6C\x65\x6E\x20\x3D\x20\x63\x73\x73\x2E\x6C\x65\x6E\x67\x74\x68\x2C\x0A"\
@@ -409,147 +410,179 @@ static const char cssmin_script[] = \
 	"\x61\x5C\x28\x4F\x70\x61\x63\x69\x74\x79\x3D\x2F\x67\x69\x2C\x20\x22\x61\x6C\x70"\
 	"\x68\x61\x28\x6F\x70\x61\x63\x69\x74\x79\x3D\x22\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
 	"\x2F\x2F\x20\x52\x65\x6D\x6F\x76\x65\x20\x65\x6D\x70\x74\x79\x20\x72\x75\x6C\x65"\
-	"\x73\x2E\x0A\x20\x20\x20\x20\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x72\x65\x70"\
-	"\x6C\x61\x63\x65\x28\x2F\x5B\x5E\x5C\x7D\x3B\x5C\x7B\x5C\x2F\x5D\x2B\x5C\x7B\x5C"\
-	"\x7D\x2F\x67\x2C\x20\x22\x22\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
-	"\x69\x6E\x65\x62\x72\x65\x61\x6B\x70\x6F\x73\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x53\x6F\x6D\x65\x20\x73\x6F\x75\x72"\
-	"\x63\x65\x20\x63\x6F\x6E\x74\x72\x6F\x6C\x20\x74\x6F\x6F\x6C\x73\x20\x64\x6F\x6E"\
-	"\x27\x74\x20\x6C\x69\x6B\x65\x20\x69\x74\x20\x77\x68\x65\x6E\x20\x66\x69\x6C\x65"\
-	"\x73\x20\x63\x6F\x6E\x74\x61\x69\x6E\x69\x6E\x67\x20\x6C\x69\x6E\x65\x73\x20\x6C"\
-	"\x6F\x6E\x67\x65\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x68\x61"\
-	"\x6E\x2C\x20\x73\x61\x79\x20\x38\x30\x30\x30\x20\x63\x68\x61\x72\x61\x63\x74\x65"\
-	"\x72\x73\x2C\x20\x61\x72\x65\x20\x63\x68\x65\x63\x6B\x65\x64\x20\x69\x6E\x2E\x20"\
-	"\x54\x68\x65\x20\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x20\x6F\x70\x74\x69\x6F\x6E"\
-	"\x20\x69\x73\x20\x75\x73\x65\x64\x20\x69\x6E\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x74\x68\x61\x74\x20\x63\x61\x73\x65\x20\x74\x6F\x20\x73\x70\x6C\x69"\
-	"\x74\x20\x6C\x6F\x6E\x67\x20\x6C\x69\x6E\x65\x73\x20\x61\x66\x74\x65\x72\x20\x61"\
-	"\x20\x73\x70\x65\x63\x69\x66\x69\x63\x20\x63\x6F\x6C\x75\x6D\x6E\x2E\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x3D\x20\x30"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x20\x3C\x20\x63\x73\x73\x2E"\
-	"\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x20\x3D\x20\x69\x20\x2B\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x73\x73\x5B\x69\x20\x2D\x20\x31\x5D\x20"\
-	"\x3D\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x69\x20\x2D\x20\x73\x74\x61\x72\x74"\
-	"\x49\x6E\x64\x65\x78\x20\x3E\x20\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x70\x6F\x73"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x73\x6C\x69\x63\x65\x28\x30\x2C\x20\x69"\
-	"\x29\x20\x2B\x20\x27\x5C\x6E\x27\x20\x2B\x20\x63\x73\x73\x2E\x73\x6C\x69\x63\x65"\
-	"\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x3D\x20\x69\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x52\x65\x70\x6C\x61"\
-	"\x63\x65\x20\x6D\x75\x6C\x74\x69\x70\x6C\x65\x20\x73\x65\x6D\x69\x2D\x63\x6F\x6C"\
-	"\x6F\x6E\x73\x20\x69\x6E\x20\x61\x20\x72\x6F\x77\x20\x62\x79\x20\x61\x20\x73\x69"\
-	"\x6E\x67\x6C\x65\x20\x6F\x6E\x65\x0A\x20\x20\x20\x20\x2F\x2F\x20\x53\x65\x65\x20"\
-	"\x53\x46\x20\x62\x75\x67\x20\x23\x31\x39\x38\x30\x39\x38\x39\x0A\x20\x20\x20\x20"\
-	"\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x3B"\
-	"\x3B\x2B\x2F\x67\x2C\x20\x22\x3B\x22\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x72\x65\x73\x74\x6F\x72\x65\x20\x70\x72\x65\x73\x65\x72\x76\x65\x64\x20\x63\x6F"\
-	"\x6D\x6D\x65\x6E\x74\x73\x20\x61\x6E\x64\x20\x73\x74\x72\x69\x6E\x67\x73\x0A\x20"\
-	"\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x2C\x20\x6D\x61\x78\x20\x3D"\
-	"\x20\x70\x72\x65\x73\x65\x72\x76\x65\x64\x54\x6F\x6B\x65\x6E\x73\x2E\x6C\x65\x6E"\
-	"\x67\x74\x68\x3B\x20\x69\x20\x3C\x20\x6D\x61\x78\x3B\x20\x69\x20\x3D\x20\x69\x20"\
-	"\x2B\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x73\x73\x20\x3D"\
-	"\x20\x63\x73\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x22\x5F\x5F\x5F\x59\x55\x49"\
-	"\x43\x53\x53\x4D\x49\x4E\x5F\x50\x52\x45\x53\x45\x52\x56\x45\x44\x5F\x54\x4F\x4B"\
-	"\x45\x4E\x5F\x22\x20\x2B\x20\x69\x20\x2B\x20\x22\x5F\x5F\x5F\x22\x2C\x20\x70\x72"\
-	"\x65\x73\x65\x72\x76\x65\x64\x54\x6F\x6B\x65\x6E\x73\x5B\x69\x5D\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x54\x72\x69\x6D\x20\x74\x68"\
-	"\x65\x20\x66\x69\x6E\x61\x6C\x20\x73\x74\x72\x69\x6E\x67\x20\x28\x66\x6F\x72\x20"\
-	"\x61\x6E\x79\x20\x6C\x65\x61\x64\x69\x6E\x67\x20\x6F\x72\x20\x74\x72\x61\x69\x6C"\
-	"\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x20\x73\x70\x61\x63\x65\x73\x29\x0A\x20\x20"\
+	"\x73\x3A\x20\x74\x68\x65\x20\x72\x75\x6E\x20\x6F\x66\x20\x63\x68\x61\x72\x61\x63"\
+	"\x74\x65\x72\x73\x20\x6F\x74\x68\x65\x72\x20\x74\x68\x61\x6E\x20\x22\x7D\x22\x2C"\
+	"\x20\x22\x3B\x22\x2C\x20\x22\x7B\x22\x0A\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64"\
+	"\x20\x22\x2F\x22\x20\x62\x65\x66\x6F\x72\x65\x20\x65\x61\x63\x68\x20\x22\x7B\x7D"\
+	"\x22\x2E\x20\x44\x6F\x6E\x65\x20\x62\x79\x20\x68\x61\x6E\x64\x2C\x20\x73\x69\x6E"\
+	"\x63\x65\x20\x74\x68\x65\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65"\
+	"\x73\x73\x69\x6F\x6E\x0A\x20\x20\x20\x20\x2F\x2F\x20\x2F\x5B\x5E\x5C\x7D\x3B\x5C"\
+	"\x7B\x5C\x2F\x5D\x2B\x5C\x7B\x5C\x7D\x2F\x67\x20\x74\x72\x69\x65\x73\x20\x65\x76"\
+	"\x65\x72\x79\x20\x70\x6F\x73\x69\x74\x69\x6F\x6E\x20\x6F\x66\x20\x61\x20\x6C\x6F"\
+	"\x6E\x67\x20\x72\x75\x6E\x20\x77\x69\x74\x68\x20\x6E\x6F\x20\x22\x7B\x7D\x22\x0A"\
+	"\x20\x20\x20\x20\x2F\x2F\x20\x61\x66\x74\x65\x72\x20\x69\x74\x2C\x20\x77\x68\x69"\
+	"\x63\x68\x20\x74\x61\x6B\x65\x73\x20\x71\x75\x61\x64\x72\x61\x74\x69\x63\x20\x74"\
+	"\x69\x6D\x65\x2E\x0A\x20\x20\x20\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20"\
+	"\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x65\x6E\x64\x49\x6E\x64"\
+	"\x65\x78\x20\x3D\x20\x63\x73\x73\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x22\x7B\x7D"\
+	"\x22\x29\x3B\x20\x65\x6E\x64\x49\x6E\x64\x65\x78\x20\x3E\x3D\x20\x30\x3B\x20\x65"\
+	"\x6E\x64\x49\x6E\x64\x65\x78\x20\x3D\x20\x63\x73\x73\x2E\x69\x6E\x64\x65\x78\x4F"\
+	"\x66\x28\x22\x7B\x7D\x22\x2C\x20\x65\x6E\x64\x49\x6E\x64\x65\x78\x20\x2B\x20\x32"\
+	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x65\x6E\x64"\
+	"\x49\x6E\x64\x65\x78\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
+	"\x20\x28\x69\x20\x3E\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x26\x26\x20"\
+	"\x22\x7D\x3B\x7B\x2F\x22\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x63\x73\x73\x2E\x63"\
+	"\x68\x61\x72\x41\x74\x28\x69\x20\x2D\x20\x31\x29\x29\x20\x3C\x20\x30\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x69\x20\x2D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x69\x20\x3C\x20\x65\x6E\x64\x49\x6E\x64\x65\x78\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x74\x73\x2E"\
+	"\x70\x75\x73\x68\x28\x63\x73\x73\x2E\x73\x6C\x69\x63\x65\x28\x73\x74\x61\x72\x74"\
+	"\x49\x6E\x64\x65\x78\x2C\x20\x69\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x3D\x20\x65\x6E\x64"\
+	"\x49\x6E\x64\x65\x78\x20\x2B\x20\x32\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x70\x61\x72\x74\x73\x2E\x70\x75\x73"\
+	"\x68\x28\x63\x73\x73\x2E\x73\x6C\x69\x63\x65\x28\x73\x74\x61\x72\x74\x49\x6E\x64"\
+	"\x65\x78\x29\x29\x3B\x0A\x20\x20\x20\x20\x63\x73\x73\x20\x3D\x20\x70\x61\x72\x74"\
+	"\x73\x2E\x6A\x6F\x69\x6E\x28\x22\x22\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x70\x6F\x73\x20\x3E\x3D\x20\x30\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x53\x6F\x6D\x65\x20\x73\x6F"\
+	"\x75\x72\x63\x65\x20\x63\x6F\x6E\x74\x72\x6F\x6C\x20\x74\x6F\x6F\x6C\x73\x20\x64"\
+	"\x6F\x6E\x27\x74\x20\x6C\x69\x6B\x65\x20\x69\x74\x20\x77\x68\x65\x6E\x20\x66\x69"\
+	"\x6C\x65\x73\x20\x63\x6F\x6E\x74\x61\x69\x6E\x69\x6E\x67\x20\x6C\x69\x6E\x65\x73"\
+	"\x20\x6C\x6F\x6E\x67\x65\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74"\
+	"\x68\x61\x6E\x2C\x20\x73\x61\x79\x20\x38\x30\x30\x30\x20\x63\x68\x61\x72\x61\x63"\
+	"\x74\x65\x72\x73\x2C\x20\x61\x72\x65\x20\x63\x68\x65\x63\x6B\x65\x64\x20\x69\x6E"\
+	"\x2E\x20\x54\x68\x65\x20\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x20\x6F\x70\x74\x69"\
+	"\x6F\x6E\x20\x69\x73\x20\x75\x73\x65\x64\x20\x69\x6E\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x74\x68\x61\x74\x20\x63\x61\x73\x65\x20\x74\x6F\x20\x73\x70"\
+	"\x6C\x69\x74\x20\x6C\x6F\x6E\x67\x20\x6C\x69\x6E\x65\x73\x20\x61\x66\x74\x65\x72"\
+	"\x20\x61\x20\x73\x70\x65\x63\x69\x66\x69\x63\x20\x63\x6F\x6C\x75\x6D\x6E\x2E\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x3D"\
+	"\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x30\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x20\x3C\x20\x63\x73"\
+	"\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x20\x3D\x20\x69\x20\x2B\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x73\x73\x5B\x69\x20\x2D\x20\x31"\
+	"\x5D\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x69\x20\x2D\x20\x73\x74\x61"\
+	"\x72\x74\x49\x6E\x64\x65\x78\x20\x3E\x20\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x70"\
+	"\x6F\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x73\x6C\x69\x63\x65\x28\x30\x2C"\
+	"\x20\x69\x29\x20\x2B\x20\x27\x5C\x6E\x27\x20\x2B\x20\x63\x73\x73\x2E\x73\x6C\x69"\
+	"\x63\x65\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x74\x61\x72\x74\x49\x6E\x64\x65\x78\x20\x3D\x20\x69\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x52\x65\x70"\
+	"\x6C\x61\x63\x65\x20\x6D\x75\x6C\x74\x69\x70\x6C\x65\x20\x73\x65\x6D\x69\x2D\x63"\
+	"\x6F\x6C\x6F\x6E\x73\x20\x69\x6E\x20\x61\x20\x72\x6F\x77\x20\x62\x79\x20\x61\x20"\
+	"\x73\x69\x6E\x67\x6C\x65\x20\x6F\x6E\x65\x0A\x20\x20\x20\x20\x2F\x2F\x20\x53\x65"\
+	"\x65\x20\x53\x46\x20\x62\x75\x67\x20\x23\x31\x39\x38\x30\x39\x38\x39\x0A\x20\x20"\
 	"\x20\x20\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28"\
-	"\x2F\x5E\x5C\x73\x2B\x7C\x5C\x73\x2B\x24\x2F\x67\x2C\x20\x22\x22\x29\x3B\x0A\x0A"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x63\x73\x73\x3B\x0A\x0A\x7D\x3B\x0A"\
-	"\x0A\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20\x74\x72"\
-	"\x75\x65\x2C\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x20\x2A\x2F"\
-	"\x0A\x76\x61\x72\x20\x63\x73\x73\x6D\x69\x6E\x2C\x20\x66\x6E\x61\x6D\x65\x2C\x20"\
-	"\x73\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x73\x74\x79\x6C\x65\x2C\x20\x72\x65\x73"\
-	"\x75\x6C\x74\x3B\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x68\x65\x6C\x70\x28"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x2C\x20\x73\x74\x72\x3B\x0A"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x73\x61"\
-	"\x67\x65\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
-	"\x6F\x67\x28\x27\x20\x20\x20\x20\x63\x73\x73\x6D\x69\x6E\x20\x5B\x6F\x70\x74\x69"\
-	"\x6F\x6E\x73\x5D\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x2F\x3B\x3B\x2B\x2F\x67\x2C\x20\x22\x3B\x22\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x72\x65\x73\x74\x6F\x72\x65\x20\x70\x72\x65\x73\x65\x72\x76\x65\x64\x20"\
+	"\x63\x6F\x6D\x6D\x65\x6E\x74\x73\x20\x61\x6E\x64\x20\x73\x74\x72\x69\x6E\x67\x73"\
+	"\x0A\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x2C\x20\x6D\x61\x78"\
+	"\x20\x3D\x20\x70\x72\x65\x73\x65\x72\x76\x65\x64\x54\x6F\x6B\x65\x6E\x73\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x3C\x20\x6D\x61\x78\x3B\x20\x69\x20\x3D\x20"\
+	"\x69\x20\x2B\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x73\x73"\
+	"\x20\x3D\x20\x63\x73\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x22\x5F\x5F\x5F\x59"\
+	"\x55\x49\x43\x53\x53\x4D\x49\x4E\x5F\x50\x52\x45\x53\x45\x52\x56\x45\x44\x5F\x54"\
+	"\x4F\x4B\x45\x4E\x5F\x22\x20\x2B\x20\x69\x20\x2B\x20\x22\x5F\x5F\x5F\x22\x2C\x20"\
+	"\x70\x72\x65\x73\x65\x72\x76\x65\x64\x54\x6F\x6B\x65\x6E\x73\x5B\x69\x5D\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x54\x72\x69\x6D\x20"\
+	"\x74\x68\x65\x20\x66\x69\x6E\x61\x6C\x20\x73\x74\x72\x69\x6E\x67\x20\x28\x66\x6F"\
+	"\x72\x20\x61\x6E\x79\x20\x6C\x65\x61\x64\x69\x6E\x67\x20\x6F\x72\x20\x74\x72\x61"\
+	"\x69\x6C\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x20\x73\x70\x61\x63\x65\x73\x29\x0A"\
+	"\x20\x20\x20\x20\x63\x73\x73\x20\x3D\x20\x63\x73\x73\x2E\x72\x65\x70\x6C\x61\x63"\
+	"\x65\x28\x2F\x5E\x5C\x73\x2B\x7C\x5C\x73\x2B\x24\x2F\x67\x2C\x20\x22\x22\x29\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x63\x73\x73\x3B\x0A\x0A\x7D"\
+	"\x3B\x0A\x0A\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20"\
+	"\x74\x72\x75\x65\x2C\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x20"\
+	"\x2A\x2F\x0A\x76\x61\x72\x20\x63\x73\x73\x6D\x69\x6E\x2C\x20\x66\x6E\x61\x6D\x65"\
+	"\x2C\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x73\x74\x79\x6C\x65\x2C\x20\x72"\
+	"\x65\x73\x75\x6C\x74\x3B\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x68\x65\x6C"\
+	"\x70\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63"\
+	"\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x2C\x20\x73\x74\x72"\
+	"\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55"\
+	"\x73\x61\x67\x65\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
+	"\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x63\x73\x73\x6D\x69\x6E\x20\x5B\x6F\x70"\
+	"\x74\x69\x6F\x6E\x73\x5D\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x54\x68\x65\x20\x63"\
+	"\x6F\x6E\x74\x65\x6E\x74\x20\x6F\x66\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x20\x77"\
+	"\x69\x6C\x6C\x20\x62\x65\x20\x6D\x69\x6E\x69\x66\x69\x65\x64\x20\x61\x6E\x64\x20"\
+	"\x70\x72\x69\x6E\x74\x65\x64\x20\x74\x6F\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"\
+	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x73\x74\x61\x6E\x64\x61\x72\x64\x20"\
+	"\x6F\x75\x74\x70\x75\x74\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
+	"\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C"\
+	"\x65\x2E\x6C\x6F\x67\x28\x27\x47\x65\x6E\x65\x72\x61\x6C\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x68\x65\x6C\x70\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x53\x68\x6F\x77\x20\x74\x68\x69\x73\x20\x68\x65\x6C\x70\x20\x73"\
+	"\x63\x72\x65\x65\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
+	"\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x76\x65\x72\x73\x69\x6F\x6E\x20"\
+	"\x20\x20\x20\x20\x20\x20\x44\x69\x73\x70\x6C\x61\x79\x20\x76\x65\x72\x73\x69\x6F"\
+	"\x6E\x20\x6E\x75\x6D\x62\x65\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
+	"\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x46\x6F\x72\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66"\
+	"\x6F\x72\x6D\x61\x74\x69\x6F\x6E\x2C\x20\x67\x6F\x20\x74\x6F\x20\x68\x74\x74\x70"\
+	"\x3A\x2F\x2F\x77\x77\x77\x2E\x70\x68\x70\x69\x65\x64\x2E\x63\x6F\x6D\x2F\x79\x75"\
+	"\x69\x63\x6F\x6D\x70\x72\x65\x73\x73\x6F\x72\x2D\x63\x73\x73\x6D\x69\x6E\x2E\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31"\
+	"\x29\x3B\x0A\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67"\
+	"\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72"\
+	"\x67\x73\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x28\x61\x72\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72"\
+	"\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x2C\x20\x69\x2C\x20\x73\x74\x72\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61"\
+	"\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E"\
+	"\x67\x74\x68\x20\x3E\x20\x32\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x2D\x27\x20\x26\x26\x20\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31"\
+	"\x29\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75"\
+	"\x62\x73\x74\x72\x69\x6E\x67\x28\x32\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65"\
+	"\x6C\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74"\
+	"\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x76\x65\x72\x73\x69\x6F\x6E\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x63\x73\x73\x6D\x69\x6E\x2E\x6A\x73\x20"\
+	"\x66\x72\x6F\x6D\x20\x59\x55\x49\x43\x6F\x6D\x70\x72\x65\x73\x73\x6F\x72\x20\x32"\
+	"\x2E\x34\x2E\x36\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
+	"\x28\x27\x55\x6E\x6B\x6E\x6F\x77\x6E\x20\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x2D\x2D"\
+	"\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x52\x75"\
+	"\x6E\x20\x63\x73\x73\x6D\x69\x6E\x20\x2D\x2D\x68\x65\x6C\x70\x20\x74\x6F\x20\x6C"\
+	"\x69\x73\x74\x20\x61\x6C\x6C\x20\x70\x6F\x73\x73\x69\x62\x6C\x65\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x54\x68\x65\x20\x63\x6F\x6E"\
-	"\x74\x65\x6E\x74\x20\x6F\x66\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x20\x77\x69\x6C"\
-	"\x6C\x20\x62\x65\x20\x6D\x69\x6E\x69\x66\x69\x65\x64\x20\x61\x6E\x64\x20\x70\x72"\
-	"\x69\x6E\x74\x65\x64\x20\x74\x6F\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73"\
-	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x73\x74\x61\x6E\x64\x61\x72\x64\x20\x6F\x75"\
-	"\x74\x70\x75\x74\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
-	"\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x27\x47\x65\x6E\x65\x72\x61\x6C\x20\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
-	"\x28\x27\x20\x20\x20\x20\x2D\x2D\x68\x65\x6C\x70\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x53\x68\x6F\x77\x20\x74\x68\x69\x73\x20\x68\x65\x6C\x70\x20\x73\x63\x72"\
-	"\x65\x65\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
-	"\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x76\x65\x72\x73\x69\x6F\x6E\x20\x20\x20"\
-	"\x20\x20\x20\x20\x44\x69\x73\x70\x6C\x61\x79\x20\x76\x65\x72\x73\x69\x6F\x6E\x20"\
-	"\x6E\x75\x6D\x62\x65\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C"\
-	"\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
-	"\x2E\x6C\x6F\x67\x28\x27\x46\x6F\x72\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x72"\
-	"\x6D\x61\x74\x69\x6F\x6E\x2C\x20\x67\x6F\x20\x74\x6F\x20\x68\x74\x74\x70\x3A\x2F"\
-	"\x2F\x77\x77\x77\x2E\x70\x68\x70\x69\x65\x64\x2E\x63\x6F\x6D\x2F\x79\x75\x69\x63"\
-	"\x6F\x6D\x70\x72\x65\x73\x73\x6F\x72\x2D\x63\x73\x73\x6D\x69\x6E\x2E\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B"\
-	"\x0A\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73\x2E"\
-	"\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65"\
-	"\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73"\
-	"\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x61"\
-	"\x72\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63"\
-	"\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x20"\
-	"\x69\x2C\x20\x73\x74\x72\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61\x6C\x75"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74"\
-	"\x68\x20\x3E\x20\x32\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2D\x27\x20\x26\x26\x20\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75\x62\x73"\
-	"\x74\x72\x69\x6E\x67\x28\x32\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x29"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65\x6C\x70"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F"\
-	"\x6E\x20\x3D\x3D\x3D\x20\x27\x76\x65\x72\x73\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
-	"\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x63\x73\x73\x6D\x69\x6E\x2E\x6A\x73\x20\x66\x72"\
-	"\x6F\x6D\x20\x59\x55\x49\x43\x6F\x6D\x70\x72\x65\x73\x73\x6F\x72\x20\x32\x2E\x34"\
-	"\x2E\x36\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F"\
-	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x6E\x6B\x6E\x6F\x77\x6E\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x3A\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C"\
-	"\x65\x2E\x6C\x6F\x67\x28\x27\x52\x75\x6E\x20\x63\x73\x73\x6D\x69\x6E\x20\x2D\x2D"\
-	"\x68\x65\x6C\x70\x20\x74\x6F\x20\x6C\x69\x73\x74\x20\x61\x6C\x6C\x20\x70\x6F\x73"\
-	"\x73\x69\x62\x6C\x65\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
-	"\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73"\
-	"\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
-	"\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x21\x3D\x3D\x20\x27\x75\x6E\x64"\
-	"\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x50\x6C\x65\x61\x73\x65\x20\x6F"\
-	"\x6E\x6C\x79\x20\x73\x70\x65\x63\x69\x66\x79\x20\x6F\x6E\x65\x20\x66\x69\x6C\x65"\
-	"\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E\x61\x6D\x65\x20\x3D\x20\x61\x72\x67\x3B\x0A"\
-	"\x7D\x29\x3B\x0A\x0A\x0A\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61"\
-	"\x6D\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x74\x72\x79"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x73\x74\x79\x6C\x65\x20\x3D\x20\x73\x79\x73\x74\x65"\
-	"\x6D\x2E\x72\x65\x61\x64\x46\x69\x6C\x65\x28\x66\x6E\x61\x6D\x65\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x59\x41\x48\x4F\x4F\x2E\x63\x6F"\
-	"\x6D\x70\x72\x65\x73\x73\x6F\x72\x2E\x63\x73\x73\x6D\x69\x6E\x28\x73\x74\x79\x6C"\
-	"\x65\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
-	"\x72\x65\x73\x75\x6C\x74\x29\x3B\x0A\x7D\x20\x63\x61\x74\x63\x68\x20\x28\x65\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x65"\
-	"\x29\x3B\x0A\x7D\x0A";
\ No newline at end of file
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28"\
+	"\x2D\x31\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61"\
+	"\x6D\x65\x20\x21\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x27\x50\x6C\x65\x61\x73\x65\x20\x6F\x6E\x6C\x79\x20\x73\x70\x65\x63\x69"\
+	"\x66\x79\x20\x6F\x6E\x65\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78"\
+	"\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E"\
+	"\x61\x6D\x65\x20\x3D\x20\x61\x72\x67\x3B\x0A\x7D\x29\x3B\x0A\x0A\x0A\x69\x66\x20"\
+	"\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x3D\x3D\x3D\x20\x27\x75"\
+	"\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C"\
+	"\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x74\x72\x79\x20\x7B\x0A\x20\x20\x20\x20\x73\x74"\
+	"\x79\x6C\x65\x20\x3D\x20\x73\x79\x73\x74\x65\x6D\x2E\x72\x65\x61\x64\x46\x69\x6C"\
+	"\x65\x28\x66\x6E\x61\x6D\x65\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74"\
+	"\x20\x3D\x20\x59\x41\x48\x4F\x4F\x2E\x63\x6F\x6D\x70\x72\x65\x73\x73\x6F\x72\x2E"\
+	"\x63\x73\x73\x6D\x69\x6E\x28\x73\x74\x79\x6C\x65\x29\x3B\x0A\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x72\x65\x73\x75\x6C\x74\x29\x3B\x0A"\
+	"\x7D\x20\x63\x61\x74\x63\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F"\
+	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x65\x29\x3B\x0A\x7D\x0A";
\ No newline at end of file
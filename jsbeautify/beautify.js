@@ -51,6 +51,7 @@ function js_beautify(js_source_text, options) {
     var prefix, token_type, do_block_just_closed;
     var wanted_newline, just_added_newline, n_newlines;
     var preindent_string = '';
+    var flushed = false, flushed_parts = [];
 
 
     // Some interpreters have unexpected results with foo = baz || bar;
@@ -74,6 +75,7 @@ function js_beautify(js_source_text, options) {
     var opt_max_preserve_newlines = typeof options.max_preserve_newlines === 'undefined' ? false : options.max_preserve_newlines;
     var opt_jslint_happy = options.jslint_happy === 'undefined' ? false : options.jslint_happy;
     var opt_keep_array_indentation = typeof options.keep_array_indentation === 'undefined' ? false : options.keep_array_indentation;
+    var opt_check = typeof options.check === 'function' ? options.check : false;
 
     just_added_newline = false;
 
@@ -154,6 +156,25 @@ function js_beautify(js_source_text, options) {
         just_added_newline = false;
         flags.eat_next_space = false;
         output.push(token_text);
+        if (output.length > 1024 && /\S/.test(token_text)) {
+            flush_output();
+        }
+    }
+
+    // Nothing takes back the output before a token that isn't blank, so it
+    // is joined up as it goes (or, with options.check, handed over and
+    // dropped) instead of piling up one array element per indentation step.
+    function flush_output() {
+        var text = output.splice(0, output.length - 1).join('');
+        if (!flushed) {
+            text = preindent_string + text;
+            flushed = true;
+        }
+        if (opt_check) {
+            opt_check(text);
+        } else {
+            flushed_parts.push(text);
+        }
     }
 
     function indent() {
@@ -1159,8 +1180,12 @@ function js_beautify(js_source_text, options) {
         last_text = token_text;
     }
 
-    var sweet_code = preindent_string + output.join('').replace(/[\n ]+$/, '');
-    return sweet_code;
+    // Only the rest of the output, if options.check had the beginning.
+    var sweet_code = output.join('').replace(/[\n ]+$/, '');
+    if (!flushed) {
+        sweet_code = preindent_string + sweet_code;
+    }
+    return flushed_parts.join('') + sweet_code;
 
 }
 
@@ -87,2154 +87,2290 @@ static const char jsbeautify_script[] = \
 	"\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x2C\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65"\
 	"\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x2C\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
 	"\x73\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x70\x72\x65\x69\x6E\x64\x65\x6E\x74"\
-	"\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x27\x27\x3B\x0A\x0A\x0A\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x53\x6F\x6D\x65\x20\x69\x6E\x74\x65\x72\x70\x72\x65\x74\x65\x72\x73"\
-	"\x20\x68\x61\x76\x65\x20\x75\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x72\x65\x73"\
-	"\x75\x6C\x74\x73\x20\x77\x69\x74\x68\x20\x66\x6F\x6F\x20\x3D\x20\x62\x61\x7A\x20"\
-	"\x7C\x7C\x20\x62\x61\x72\x3B\x0A\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x20"\
-	"\x3A\x20\x7B\x7D\x3B\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x62"\
-	"\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x63\x6F\x6D\x70\x61\x74\x69\x62\x69\x6C\x69\x74\x79\x0A\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x73\x70\x61\x63\x65\x5F\x61\x66\x74\x65"\
-	"\x72\x5F\x61\x6E\x6F\x6E\x5F\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x21\x3D\x3D\x20"\
-	"\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x2E\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x20\x3D\x3D\x3D\x20\x75\x6E"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x73\x70\x61\x63\x65\x5F\x61\x66\x74\x65"\
-	"\x72\x5F\x61\x6E\x6F\x6E\x5F\x66\x75\x6E\x63\x74\x69\x6F\x6E\x3B\x0A\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62"\
-	"\x72\x61\x63\x65\x73\x5F\x6F\x6E\x5F\x6F\x77\x6E\x5F\x6C\x69\x6E\x65\x20\x21\x3D"\
-	"\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x29\x20\x7B\x20\x2F\x2F\x67\x72\x61"\
-	"\x63\x65\x66\x75\x6C\x20\x68\x61\x6E\x64\x6C\x69\x6E\x67\x20\x6F\x66\x20\x64\x65"\
-	"\x70\x72\x69\x63\x61\x74\x65\x64\x20\x6F\x70\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65\x73\x5F\x6F\x6E\x5F"\
-	"\x6F\x77\x6E\x5F\x6C\x69\x6E\x65\x20\x3F\x20\x22\x65\x78\x70\x61\x6E\x64\x22\x20"\
-	"\x3A\x20\x22\x63\x6F\x6C\x6C\x61\x70\x73\x65\x22\x3B\x0A\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C"\
-	"\x65\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65\x5F\x73\x74"\
-	"\x79\x6C\x65\x20\x3A\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79"\
-	"\x6C\x65\x20\x3F\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65"\
-	"\x20\x3A\x20\x22\x63\x6F\x6C\x6C\x61\x70\x73\x65\x22\x29\x3B\x0A\x0A\x0A\x20\x20"\
-	"\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A"\
-	"\x65\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x73"\
-	"\x69\x7A\x65\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74"\
-	"\x5F\x73\x69\x7A\x65\x20\x3A\x20\x34\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F"\
-	"\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20\x3D\x20\x6F\x70\x74"\
-	"\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20\x3F\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20\x3A"\
-	"\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x70\x72"\
-	"\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20\x74\x79"\
-	"\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x70\x72\x65\x73\x65\x72\x76"\
-	"\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65"\
-	"\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x74\x72\x75\x65\x20\x3A\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x73\x2E\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
-	"\x73\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x6D\x61\x78\x5F\x70"\
-	"\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20\x74"\
-	"\x79\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6D\x61\x78\x5F\x70\x72"\
+	"\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x66\x6C\x75\x73\x68\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x2C\x20\x66"\
+	"\x6C\x75\x73\x68\x65\x64\x5F\x70\x61\x72\x74\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x0A"\
+	"\x0A\x20\x20\x20\x20\x2F\x2F\x20\x53\x6F\x6D\x65\x20\x69\x6E\x74\x65\x72\x70\x72"\
+	"\x65\x74\x65\x72\x73\x20\x68\x61\x76\x65\x20\x75\x6E\x65\x78\x70\x65\x63\x74\x65"\
+	"\x64\x20\x72\x65\x73\x75\x6C\x74\x73\x20\x77\x69\x74\x68\x20\x66\x6F\x6F\x20\x3D"\
+	"\x20\x62\x61\x7A\x20\x7C\x7C\x20\x62\x61\x72\x3B\x0A\x20\x20\x20\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x73\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x20\x3F\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x73\x20\x3A\x20\x7B\x7D\x3B\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20"\
+	"\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x63\x6F\x6D\x70\x61\x74\x69\x62\x69\x6C\x69\x74\x79\x0A\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x73\x70\x61\x63\x65"\
+	"\x5F\x61\x66\x74\x65\x72\x5F\x61\x6E\x6F\x6E\x5F\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x21\x3D\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x20\x26\x26\x20\x6F\x70"\
+	"\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x20\x3D"\
+	"\x3D\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E\x74\x5F\x68"\
+	"\x61\x70\x70\x79\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x73\x70\x61\x63\x65"\
+	"\x5F\x61\x66\x74\x65\x72\x5F\x61\x6E\x6F\x6E\x5F\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65\x73\x5F\x6F\x6E\x5F\x6F\x77\x6E\x5F\x6C\x69"\
+	"\x6E\x65\x20\x21\x3D\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x29\x20\x7B\x20"\
+	"\x2F\x2F\x67\x72\x61\x63\x65\x66\x75\x6C\x20\x68\x61\x6E\x64\x6C\x69\x6E\x67\x20"\
+	"\x6F\x66\x20\x64\x65\x70\x72\x69\x63\x61\x74\x65\x64\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73"\
+	"\x74\x79\x6C\x65\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65"\
+	"\x73\x5F\x6F\x6E\x5F\x6F\x77\x6E\x5F\x6C\x69\x6E\x65\x20\x3F\x20\x22\x65\x78\x70"\
+	"\x61\x6E\x64\x22\x20\x3A\x20\x22\x63\x6F\x6C\x6C\x61\x70\x73\x65\x22\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73"\
+	"\x74\x79\x6C\x65\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61\x63\x65"\
+	"\x5F\x73\x74\x79\x6C\x65\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x62\x72\x61"\
+	"\x63\x65\x5F\x73\x74\x79\x6C\x65\x20\x3A\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63"\
+	"\x65\x5F\x73\x74\x79\x6C\x65\x20\x3F\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F"\
+	"\x73\x74\x79\x6C\x65\x20\x3A\x20\x22\x63\x6F\x6C\x6C\x61\x70\x73\x65\x22\x29\x3B"\
+	"\x0A\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E"\
+	"\x74\x5F\x73\x69\x7A\x65\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64"\
+	"\x65\x6E\x74\x5F\x73\x69\x7A\x65\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A\x65\x20\x3A\x20\x34\x3B\x0A\x20\x20\x20\x20"\
+	"\x76\x61\x72\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20"\
+	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61"\
+	"\x72\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63"\
+	"\x68\x61\x72\x20\x3A\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F"\
+	"\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
+	"\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x70\x72"\
 	"\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x3D\x3D\x20"\
-	"\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x66\x61\x6C\x73\x65\x20"\
-	"\x3A\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72"\
-	"\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x3B\x0A\x20\x20\x20\x20\x76\x61\x72"\
-	"\x20\x6F\x70\x74\x5F\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x20\x3D\x20"\
-	"\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79"\
-	"\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x66"\
-	"\x61\x6C\x73\x65\x20\x3A\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E"\
-	"\x74\x5F\x68\x61\x70\x70\x79\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74"\
-	"\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x2E\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20"\
-	"\x3F\x20\x66\x61\x6C\x73\x65\x20\x3A\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6B\x65"\
-	"\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65"\
-	"\x77\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x63\x61\x63\x68\x65\x20\x74\x68\x65\x20\x73\x6F\x75\x72\x63\x65\x27"\
-	"\x73\x20\x6C\x65\x6E\x67\x74\x68\x2E\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x69\x6E"\
-	"\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x3D\x20\x6A\x73\x5F\x73\x6F\x75\x72"\
-	"\x63\x65\x5F\x74\x65\x78\x74\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75"\
-	"\x74\x28\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D"\
-	"\x20\x74\x79\x70\x65\x6F\x66\x20\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
+	"\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x74\x72\x75\x65\x20\x3A"\
+	"\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x73\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F"\
+	"\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x73\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6D"\
+	"\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
 	"\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x66"\
-	"\x61\x6C\x73\x65\x20\x3A\x20\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6F\x75\x74\x70"\
-	"\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x28\x6F\x75\x74\x70\x75\x74"\
-	"\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20"\
-	"\x3D\x3D\x3D\x20\x27\x20\x27\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7C\x7C\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E"\
-	"\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x5F"\
-	"\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7C"\
-	"\x7C\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67"\
-	"\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x70\x72\x65\x69\x6E\x64\x65\x6E"\
-	"\x74\x5F\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7C\x7C\x20\x28\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x26\x26"\
-	"\x20\x28\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67"\
-	"\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x27\x5C\x6E\x27\x20\x7C\x7C\x20"\
+	"\x61\x6C\x73\x65\x20\x3A\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6D\x61\x78\x5F\x70"\
+	"\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x3B\x0A\x20\x20"\
+	"\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70"\
+	"\x70\x79\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x6A\x73\x6C\x69\x6E\x74\x5F"\
+	"\x68\x61\x70\x70\x79\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64"\
+	"\x27\x20\x3F\x20\x66\x61\x6C\x73\x65\x20\x3A\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E"\
+	"\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x3B\x0A\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64"\
+	"\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x70"\
+	"\x74\x69\x6F\x6E\x73\x2E\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64"\
+	"\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69"\
+	"\x6E\x65\x64\x27\x20\x3F\x20\x66\x61\x6C\x73\x65\x20\x3A\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x73\x2E\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74"\
+	"\x61\x74\x69\x6F\x6E\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x5F\x63"\
+	"\x68\x65\x63\x6B\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x73\x2E\x63\x68\x65\x63\x6B\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F"\
+	"\x6E\x27\x20\x3F\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x63\x68\x65\x63\x6B\x20\x3A"\
+	"\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64"\
+	"\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x63\x61\x63\x68\x65\x20\x74\x68\x65\x20\x73"\
+	"\x6F\x75\x72\x63\x65\x27\x73\x20\x6C\x65\x6E\x67\x74\x68\x2E\x0A\x20\x20\x20\x20"\
+	"\x76\x61\x72\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x3D\x20\x6A"\
+	"\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x72\x69\x6D"\
+	"\x5F\x6F\x75\x74\x70\x75\x74\x28\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x65\x61\x74\x5F\x6E\x65\x77\x6C"\
+	"\x69\x6E\x65\x73\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x65\x61\x74\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x73\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65"\
+	"\x64\x27\x20\x3F\x20\x66\x61\x6C\x73\x65\x20\x3A\x20\x65\x61\x74\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
+	"\x20\x28\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x28"\
 	"\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68"\
-	"\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x27\x5C\x72\x27\x29\x29\x29\x29\x20\x7B"\
+	"\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x27\x20\x27\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7C\x7C\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70"\
+	"\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x69"\
+	"\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7C\x7C\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75"\
+	"\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x70\x72"\
+	"\x65\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7C\x7C\x20\x28\x65\x61\x74\x5F\x6E\x65\x77\x6C\x69"\
+	"\x6E\x65\x73\x20\x26\x26\x20\x28\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75"\
+	"\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x27\x5C"\
+	"\x6E\x27\x20\x7C\x7C\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E"\
+	"\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x27\x5C\x72\x27"\
+	"\x29\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F"\
+	"\x75\x74\x70\x75\x74\x2E\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x74\x72\x69\x6D\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5E"\
+	"\x5C\x73\x5C\x73\x2A\x7C\x5C\x73\x5C\x73\x2A\x24\x2F\x2C\x20\x27\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x66\x6F\x72\x63\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x0A\x20\x20\x20\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x6C\x64\x5F\x6B\x65"\
+	"\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
+	"\x20\x3D\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E"\
+	"\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F"\
+	"\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74"\
+	"\x61\x74\x69\x6F\x6E\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61"\
+	"\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x6C\x64\x5F"\
+	"\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69"\
+	"\x6F\x6E\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x69\x67"\
+	"\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x29\x20\x7B\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74"\
+	"\x5F\x73\x70\x61\x63\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72"\
+	"\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x26\x26\x20\x69\x73"\
+	"\x5F\x61\x72\x72\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x20\x3D\x20\x74"\
+	"\x79\x70\x65\x6F\x66\x20\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20"\
+	"\x74\x72\x75\x65\x20\x3A\x20\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74"\
+	"\x65\x64\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69"\
+	"\x66\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x75\x74\x70\x75\x74\x2E"\
+	"\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C"\
+	"\x69\x6E\x65\x20\x6F\x6E\x20\x73\x74\x61\x72\x74\x20\x6F\x66\x20\x66\x69\x6C\x65"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65"\
+	"\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x21\x3D\x3D\x20\x22\x5C\x6E\x22\x20\x7C"\
+	"\x7C\x20\x21\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61"\
+	"\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E"\
-	"\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x72\x69"\
-	"\x6D\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5E\x5C\x73\x5C\x73\x2A\x7C"\
-	"\x5C\x73\x5C\x73\x2A\x24\x2F\x2C\x20\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x66\x6F\x72\x63\x65\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x0A\x20\x20\x20\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x6C\x64\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72"\
-	"\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x70\x74"\
-	"\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x6B\x65\x65"\
-	"\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20"\
-	"\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
-	"\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65"\
-	"\x6E\x74\x61\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x6C\x64\x5F\x6B\x65\x65\x70\x5F\x61"\
-	"\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x72"\
-	"\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x69\x67\x6E\x6F\x72\x65\x5F\x72"\
-	"\x65\x70\x65\x61\x74\x65\x64\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65"\
-	"\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64"\
-	"\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x26\x26\x20\x69\x73\x5F\x61\x72\x72\x61\x79"\
-	"\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x67\x6E\x6F\x72"\
-	"\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20"\
-	"\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x20\x3D\x3D\x3D\x20"\
-	"\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x3F\x20\x74\x72\x75\x65\x20\x3A"\
-	"\x20\x69\x67\x6E\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x3B\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65"\
-	"\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72"\
-	"\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
-	"\x72\x6E\x3B\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x6F\x6E"\
-	"\x20\x73\x74\x61\x72\x74\x20\x6F\x66\x20\x66\x69\x6C\x65\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x75"\
-	"\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D"\
-	"\x20\x31\x5D\x20\x21\x3D\x3D\x20\x22\x5C\x6E\x22\x20\x7C\x7C\x20\x21\x69\x67\x6E"\
-	"\x6F\x72\x65\x5F\x72\x65\x70\x65\x61\x74\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E"\
-	"\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x22"\
-	"\x5C\x6E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74"\
-	"\x72\x69\x6E\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x70\x72\x65\x69\x6E\x64\x65\x6E"\
-	"\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20"\
-	"\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E"\
-	"\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x3B\x20\x69\x20\x2B\x3D\x20\x31"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70"\
-	"\x75\x74\x2E\x70\x75\x73\x68\x28\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E"\
-	"\x67\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65"\
-	"\x20\x26\x26\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72"\
-	"\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x69\x6E\x64"\
-	"\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x20\x2F\x2F\x20\x73\x6B\x69\x70"\
-	"\x20\x73\x70\x61\x63\x65\x2D\x73\x74\x75\x66\x66\x69\x6E\x67\x2C\x20\x69\x66\x20"\
-	"\x69\x6E\x64\x65\x6E\x74\x69\x6E\x67\x20\x77\x69\x74\x68\x20\x61\x20\x74\x61\x62"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x0A"\
-	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x72\x69\x6E\x74\x5F\x73"\
-	"\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65"\
-	"\x78\x74\x5F\x73\x70\x61\x63\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73"\
-	"\x70\x61\x63\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6C\x61\x73\x74"\
-	"\x5F\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74"\
-	"\x5F\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x6F\x75\x74\x70\x75\x74\x5B\x6F\x75\x74"\
-	"\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
-	"\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x21\x3D\x3D\x20\x27\x20\x27\x20\x26"\
-	"\x26\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x21\x3D\x3D\x20\x27\x5C"\
-	"\x6E\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x21\x3D"\
-	"\x3D\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x20\x7B\x20\x2F"\
-	"\x2F\x20\x70\x72\x65\x76\x65\x6E\x74\x20\x6F\x63\x63\x61\x73\x73\x69\x6F\x6E\x61"\
-	"\x6C\x20\x64\x75\x70\x6C\x69\x63\x61\x74\x65\x20\x73\x70\x61\x63\x65\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73"\
-	"\x68\x28\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E"\
-	"\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65\x20"\
-	"\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74"\
-	"\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C"\
-	"\x65\x76\x65\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20"\
-	"\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x6D\x6F\x76\x65\x5F\x69"\
-	"\x6E\x64\x65\x6E\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x6F"\
-	"\x75\x74\x70\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20"\
-	"\x2D\x20\x31\x5D\x20\x3D\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69"\
-	"\x6E\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75"\
-	"\x74\x70\x75\x74\x2E\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x5F\x73\x74\x6F"\
-	"\x72\x65\x2E\x70\x75\x73\x68\x28\x66\x6C\x61\x67\x73\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x20"\
-	"\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x76"\
-	"\x69\x6F\x75\x73\x5F\x6D\x6F\x64\x65\x3A\x20\x66\x6C\x61\x67\x73\x20\x3F\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3A\x20\x27\x42\x4C\x4F\x43\x4B\x27\x2C"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x6F\x64\x65\x3A\x20\x6D"\
-	"\x6F\x64\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
-	"\x5F\x6C\x69\x6E\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74"\
-	"\x65\x64\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74"\
-	"\x65\x64\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x3A\x20"\
-	"\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x5F\x6C\x69\x6E\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x5F\x63\x61\x73\x65\x3A\x20\x66\x61\x6C\x73"\
-	"\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x61\x74\x5F\x6E"\
-	"\x65\x78\x74\x5F\x73\x70\x61\x63\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F"\
-	"\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x3A\x20\x2D\x31\x2C\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F"\
-	"\x6C\x65\x76\x65\x6C\x3A\x20\x28\x66\x6C\x61\x67\x73\x20\x3F\x20\x66\x6C\x61\x67"\
-	"\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x20"\
-	"\x2B\x20\x28\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x26"\
-	"\x26\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69"\
-	"\x6E\x64\x65\x6E\x74\x65\x64\x29\x20\x3F\x20\x31\x20\x3A\x20\x30\x29\x20\x3A\x20"\
-	"\x30\x29\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x65\x72\x6E"\
-	"\x61\x72\x79\x5F\x64\x65\x70\x74\x68\x3A\x20\x30\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x69\x73\x5F\x61\x72\x72\x61\x79\x28\x6D\x6F\x64\x65\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6D\x6F\x64\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20"\
-	"\x7C\x7C\x20\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54"\
-	"\x45\x44\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20"\
-	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x73\x5F"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6D\x6F\x64\x65\x20\x3D"\
-	"\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20\x7C\x7C"\
-	"\x20\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44"\
-	"\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20\x7C\x7C\x20\x6D\x6F\x64"\
-	"\x65\x20\x3D\x3D\x3D\x20\x27\x28\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x29\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x72\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74"\
-	"\x5F\x63\x6C\x6F\x73\x65\x64\x20\x3D\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x27\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x5F\x73\x74\x6F\x72\x65\x2E"\
-	"\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x20\x3D\x20\x66\x6C\x61\x67\x5F\x73"\
-	"\x74\x6F\x72\x65\x2E\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x61\x6C\x6C\x5F\x6C\x69\x6E\x65\x73\x5F\x73\x74\x61\x72\x74\x5F\x77\x69"\
-	"\x74\x68\x28\x6C\x69\x6E\x65\x73\x2C\x20\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20\x3D\x20\x30\x3B\x20\x69"\
-	"\x20\x3C\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x74\x72\x69\x6D\x28\x6C\x69\x6E\x65\x73\x5B\x69\x5D\x29\x5B\x30\x5D\x20\x21\x3D"\
-	"\x20\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x77\x68\x61\x74\x2C\x20\x61\x72\x72\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20"\
-	"\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x61\x72\x72\x2E\x6C\x65\x6E\x67\x74"\
-	"\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x72\x5B\x69\x5D\x20\x3D\x3D\x3D\x20"\
-	"\x77\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x61\x6C\x73"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x20\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
-	"\x20\x3D\x20\x30\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70"\
-	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C"\
-	"\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x27\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46"\
-	"\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20"\
-	"\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
-	"\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72"\
-	"\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61"\
-	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6B\x65\x65\x70\x5F\x77\x68\x69\x74\x65\x73"\
-	"\x70\x61\x63\x65\x20\x3D\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61"\
-	"\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x26\x26\x20\x69\x73\x5F"\
-	"\x61\x72\x72\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x3B\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6B\x65\x65\x70\x5F\x77\x68\x69"\
-	"\x74\x65\x73\x70\x61\x63\x65\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
-	"\x2F\x20\x73\x6C\x69\x67\x68\x74\x20\x6D\x65\x73\x73\x20\x74\x6F\x20\x61\x6C\x6C"\
-	"\x6F\x77\x20\x6E\x69\x63\x65\x20\x70\x72\x65\x73\x65\x72\x76\x61\x74\x69\x6F\x6E"\
-	"\x20\x6F\x66\x20\x61\x72\x72\x61\x79\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F"\
-	"\x6E\x20\x61\x6E\x64\x20\x72\x65\x69\x6E\x64\x65\x6E\x74\x20\x74\x68\x61\x74\x20"\
-	"\x63\x6F\x72\x72\x65\x63\x74\x6C\x79\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x66\x69\x72\x73\x74\x20\x74\x69\x6D\x65\x20\x77\x68\x65\x6E"\
-	"\x20\x77\x65\x20\x67\x65\x74\x20\x74\x6F\x20\x74\x68\x65\x20\x61\x72\x72\x61\x79"\
-	"\x73\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x76\x61"\
-	"\x72\x20\x61\x20\x3D\x20\x5B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x2E\x2E\x2E\x2E\x27\x73\x6F\x6D\x65\x74\x68\x69\x6E\x67\x27\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x6D\x61\x6B"\
-	"\x65\x20\x6E\x6F\x74\x65\x20\x6F\x66\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65"\
-	"\x5F\x63\x6F\x75\x6E\x74\x20\x3D\x20\x34\x20\x69\x6E\x74\x6F\x20\x66\x6C\x61\x67"\
-	"\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69"\
-	"\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x6F"\
-	"\x20\x77\x65\x20\x6B\x6E\x6F\x77\x20\x74\x68\x61\x74\x20\x34\x20\x77\x68\x69\x74"\
-	"\x65\x73\x70\x61\x63\x65\x73\x20\x69\x6E\x20\x6F\x72\x69\x67\x69\x6E\x61\x6C\x20"\
-	"\x73\x6F\x75\x72\x63\x65\x20\x6D\x61\x74\x63\x68\x20\x69\x6E\x64\x65\x6E\x74\x5F"\
-	"\x6C\x65\x76\x65\x6C\x20\x6F\x66\x20\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x20"\
-	"\x73\x6F\x75\x72\x63\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
-	"\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64"\
-	"\x20\x61\x66\x74\x65\x72\x77\x61\x72\x64\x73\x2C\x20\x77\x68\x65\x6E\x20\x77\x65"\
-	"\x20\x67\x65\x74\x20\x74\x6F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x20\x20\x20\x27\x73\x6F\x6D\x65\x74\x68\x69\x6E\x67\x2C\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E"\
-	"\x27\x73\x6F\x6D\x65\x74\x68\x69\x6E\x67\x20\x65\x6C\x73\x65\x27\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x6B\x6E\x6F\x77\x20"\
-	"\x74\x68\x61\x74\x20\x74\x68\x69\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20"\
-	"\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x74\x6F\x20\x69\x6E\x64\x65\x6E\x74\x5F\x6C"\
-	"\x65\x76\x65\x6C\x20\x2B\x20\x28\x37\x20\x2D\x20\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x29\x20\x73\x70\x61\x63\x65\x73"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x77\x68\x69\x74\x65\x73\x70\x61"\
-	"\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x3D\x20\x30\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x6E\x5F\x61\x72\x72"\
-	"\x61\x79\x28\x63\x2C\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x29\x29\x20\x7B"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x63\x20\x3D\x3D\x3D\x20\x22\x5C\x6E\x22\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D"\
-	"\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x75\x73\x68\x28\x22\x5C\x6E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x69\x6E\x64"\
+	"\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x70\x72"\
+	"\x65\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
+	"\x76\x61\x72\x20\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x66\x6C\x61\x67\x73"\
+	"\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x3B\x20"\
+	"\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x69\x6E\x64\x65\x6E\x74"\
+	"\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61"\
+	"\x72\x5F\x6C\x69\x6E\x65\x20\x26\x26\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F"\
+	"\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75"\
-	"\x73\x68\x28\x22\x5C\x6E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64"\
-	"\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69"\
-	"\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x3D\x20\x30\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
-	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x74\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F\x75"\
-	"\x6E\x74\x20\x2B\x3D\x20\x34\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F"\
-	"\x20\x6E\x6F\x74\x68\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x73\x68\x28\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x20\x2F"\
+	"\x2F\x20\x73\x6B\x69\x70\x20\x73\x70\x61\x63\x65\x2D\x73\x74\x75\x66\x66\x69\x6E"\
+	"\x67\x2C\x20\x69\x66\x20\x69\x6E\x64\x65\x6E\x74\x69\x6E\x67\x20\x77\x69\x74\x68"\
+	"\x20\x61\x20\x74\x61\x62\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70"\
+	"\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E"\
+	"\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F"\
+	"\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x27\x20\x27\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x75\x74\x70\x75\x74\x2E"\
+	"\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x6F\x75\x74\x70"\
+	"\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31"\
+	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20\x21\x3D\x3D"\
+	"\x20\x27\x20\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74\x70\x75\x74\x20"\
+	"\x21\x3D\x3D\x20\x27\x5C\x6E\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x6F\x75\x74"\
+	"\x70\x75\x74\x20\x21\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E"\
+	"\x67\x29\x20\x7B\x20\x2F\x2F\x20\x70\x72\x65\x76\x65\x6E\x74\x20\x6F\x63\x63\x61"\
+	"\x73\x73\x69\x6F\x6E\x61\x6C\x20\x64\x75\x70\x6C\x69\x63\x61\x74\x65\x20\x73\x70"\
+	"\x61\x63\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70"\
+	"\x75\x74\x2E\x70\x75\x73\x68\x28\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F"\
+	"\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F"\
+	"\x73\x70\x61\x63\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x74\x6F\x6B\x65\x6E"\
+	"\x5F\x74\x65\x78\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x31\x30\x32\x34"\
+	"\x20\x26\x26\x20\x2F\x5C\x53\x2F\x2E\x74\x65\x73\x74\x28\x74\x6F\x6B\x65\x6E\x5F"\
+	"\x74\x65\x78\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6C\x75\x73\x68\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F"\
+	"\x20\x4E\x6F\x74\x68\x69\x6E\x67\x20\x74\x61\x6B\x65\x73\x20\x62\x61\x63\x6B\x20"\
+	"\x74\x68\x65\x20\x6F\x75\x74\x70\x75\x74\x20\x62\x65\x66\x6F\x72\x65\x20\x61\x20"\
+	"\x74\x6F\x6B\x65\x6E\x20\x74\x68\x61\x74\x20\x69\x73\x6E\x27\x74\x20\x62\x6C\x61"\
+	"\x6E\x6B\x2C\x20\x73\x6F\x20\x69\x74\x0A\x20\x20\x20\x20\x2F\x2F\x20\x69\x73\x20"\
+	"\x6A\x6F\x69\x6E\x65\x64\x20\x75\x70\x20\x61\x73\x20\x69\x74\x20\x67\x6F\x65\x73"\
+	"\x20\x28\x6F\x72\x2C\x20\x77\x69\x74\x68\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x63"\
+	"\x68\x65\x63\x6B\x2C\x20\x68\x61\x6E\x64\x65\x64\x20\x6F\x76\x65\x72\x20\x61\x6E"\
+	"\x64\x0A\x20\x20\x20\x20\x2F\x2F\x20\x64\x72\x6F\x70\x70\x65\x64\x29\x20\x69\x6E"\
+	"\x73\x74\x65\x61\x64\x20\x6F\x66\x20\x70\x69\x6C\x69\x6E\x67\x20\x75\x70\x20\x6F"\
+	"\x6E\x65\x20\x61\x72\x72\x61\x79\x20\x65\x6C\x65\x6D\x65\x6E\x74\x20\x70\x65\x72"\
+	"\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x73\x74\x65\x70\x2E\x0A\x20"\
+	"\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x66\x6C\x75\x73\x68\x5F\x6F\x75"\
+	"\x74\x70\x75\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x74\x65\x78\x74\x20\x3D\x20\x6F\x75\x74\x70\x75\x74\x2E\x73\x70\x6C\x69\x63"\
+	"\x65\x28\x30\x2C\x20\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D"\
+	"\x20\x31\x29\x2E\x6A\x6F\x69\x6E\x28\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x21\x66\x6C\x75\x73\x68\x65\x64\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x65\x78\x74\x20\x3D\x20\x70\x72\x65"\
+	"\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x20\x74\x65\x78\x74"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x75\x73\x68\x65"\
+	"\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x63\x68\x65\x63"\
+	"\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74"\
+	"\x5F\x63\x68\x65\x63\x6B\x28\x74\x65\x78\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6C\x75\x73\x68\x65\x64\x5F\x70\x61\x72\x74\x73\x2E\x70\x75\x73"\
+	"\x68\x28\x74\x65\x78\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69"\
+	"\x6E\x64\x65\x6E\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
+	"\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65"\
+	"\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65"\
+	"\x6E\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
+	"\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x6F\x75\x74\x70"\
+	"\x75\x74\x5B\x6F\x75\x74\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31"\
+	"\x5D\x20\x3D\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75"\
+	"\x74\x2E\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73"\
+	"\x65\x74\x5F\x6D\x6F\x64\x65\x28\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x5F\x73\x74\x6F\x72\x65\x2E"\
+	"\x70\x75\x73\x68\x28\x66\x6C\x61\x67\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x20\x3D\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x76\x69\x6F\x75"\
+	"\x73\x5F\x6D\x6F\x64\x65\x3A\x20\x66\x6C\x61\x67\x73\x20\x3F\x20\x66\x6C\x61\x67"\
+	"\x73\x2E\x6D\x6F\x64\x65\x20\x3A\x20\x27\x42\x4C\x4F\x43\x4B\x27\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x6F\x64\x65\x3A\x20\x6D\x6F\x64\x65"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x5F\x6C\x69"\
+	"\x6E\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x3A"\
+	"\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x3A"\
+	"\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x3A\x20\x66\x61\x6C"\
+	"\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x5F\x6C"\
+	"\x69\x6E\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x6E\x5F\x63\x61\x73\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x61\x74\x5F\x6E\x65\x78\x74"\
+	"\x5F\x73\x70\x61\x63\x65\x3A\x20\x66\x61\x6C\x73\x65\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62"\
+	"\x61\x73\x65\x6C\x69\x6E\x65\x3A\x20\x2D\x31\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76"\
+	"\x65\x6C\x3A\x20\x28\x66\x6C\x61\x67\x73\x20\x3F\x20\x66\x6C\x61\x67\x73\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x20\x2B\x20\x28"\
+	"\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x26\x26\x20\x66"\
+	"\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65"\
+	"\x6E\x74\x65\x64\x29\x20\x3F\x20\x31\x20\x3A\x20\x30\x29\x20\x3A\x20\x30\x29\x2C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x65\x72\x6E\x61\x72\x79"\
+	"\x5F\x64\x65\x70\x74\x68\x3A\x20\x30\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x69\x73\x5F\x61\x72\x72\x61\x79\x28\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6D\x6F\x64\x65\x20\x3D\x3D"\
+	"\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20\x7C\x7C\x20"\
+	"\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D"\
+	"\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x73\x5F\x65\x78\x70"\
+	"\x72\x65\x73\x73\x69\x6F\x6E\x28\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20"\
+	"\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20\x7C\x7C\x20\x6D\x6F"\
+	"\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D\x45\x58"\
+	"\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x20\x7C\x7C\x20\x6D\x6F\x64\x65\x20\x3D"\
+	"\x3D\x3D\x20\x27\x28\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x29\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"\
+	"\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74\x5F\x63\x6C"\
+	"\x6F\x73\x65\x64\x20\x3D\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D"\
+	"\x3D\x20\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x5F\x73\x74\x6F\x72\x65\x2E\x6C\x65\x6E"\
+	"\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6C\x61\x67\x73\x20\x3D\x20\x66\x6C\x61\x67\x5F\x73\x74\x6F\x72"\
+	"\x65\x2E\x70\x6F\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61"\
+	"\x6C\x6C\x5F\x6C\x69\x6E\x65\x73\x5F\x73\x74\x61\x72\x74\x5F\x77\x69\x74\x68\x28"\
+	"\x6C\x69\x6E\x65\x73\x2C\x20\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20"\
+	"\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x72\x69"\
+	"\x6D\x28\x6C\x69\x6E\x65\x73\x5B\x69\x5D\x29\x5B\x30\x5D\x20\x21\x3D\x20\x63\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E"\
+	"\x5F\x61\x72\x72\x61\x79\x28\x77\x68\x61\x74\x2C\x20\x61\x72\x72\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20\x3D"\
+	"\x20\x30\x3B\x20\x69\x20\x3C\x20\x61\x72\x72\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20"\
+	"\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x61\x72\x72\x5B\x69\x5D\x20\x3D\x3D\x3D\x20\x77\x68\x61"\
+	"\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x61\x6C\x73\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20"\
+	"\x30\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67"\
+	"\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x5B\x27\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x5D\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C"\
+	"\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x20\x3D"\
+	"\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72"\
+	"\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65"\
+	"\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x76\x61\x72\x20\x6B\x65\x65\x70\x5F\x77\x68\x69\x74\x65\x73\x70\x61\x63"\
+	"\x65\x20\x3D\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69"\
+	"\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x26\x26\x20\x69\x73\x5F\x61\x72\x72"\
+	"\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6B\x65\x65\x70\x5F\x77\x68\x69\x74\x65\x73"\
+	"\x70\x61\x63\x65\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73"\
+	"\x6C\x69\x67\x68\x74\x20\x6D\x65\x73\x73\x20\x74\x6F\x20\x61\x6C\x6C\x6F\x77\x20"\
+	"\x6E\x69\x63\x65\x20\x70\x72\x65\x73\x65\x72\x76\x61\x74\x69\x6F\x6E\x20\x6F\x66"\
+	"\x20\x61\x72\x72\x61\x79\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x61"\
+	"\x6E\x64\x20\x72\x65\x69\x6E\x64\x65\x6E\x74\x20\x74\x68\x61\x74\x20\x63\x6F\x72"\
+	"\x72\x65\x63\x74\x6C\x79\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x66\x69\x72\x73\x74\x20\x74\x69\x6D\x65\x20\x77\x68\x65\x6E\x20\x77\x65"\
+	"\x20\x67\x65\x74\x20\x74\x6F\x20\x74\x68\x65\x20\x61\x72\x72\x61\x79\x73\x3A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x76\x61\x72\x20\x61"\
+	"\x20\x3D\x20\x5B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x2E\x2E\x2E\x2E\x27\x73\x6F\x6D\x65\x74\x68\x69\x6E\x67\x27\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x6D\x61\x6B\x65\x20\x6E"\
+	"\x6F\x74\x65\x20\x6F\x66\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F"\
+	"\x75\x6E\x74\x20\x3D\x20\x34\x20\x69\x6E\x74\x6F\x20\x66\x6C\x61\x67\x73\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x6F\x20\x77\x65"\
+	"\x20\x6B\x6E\x6F\x77\x20\x74\x68\x61\x74\x20\x34\x20\x77\x68\x69\x74\x65\x73\x70"\
+	"\x61\x63\x65\x73\x20\x69\x6E\x20\x6F\x72\x69\x67\x69\x6E\x61\x6C\x20\x73\x6F\x75"\
+	"\x72\x63\x65\x20\x6D\x61\x74\x63\x68\x20\x69\x6E\x64\x65\x6E\x74\x5F\x6C\x65\x76"\
+	"\x65\x6C\x20\x6F\x66\x20\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x73\x6F\x75"\
+	"\x72\x63\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64\x20\x61\x66"\
+	"\x74\x65\x72\x77\x61\x72\x64\x73\x2C\x20\x77\x68\x65\x6E\x20\x77\x65\x20\x67\x65"\
+	"\x74\x20\x74\x6F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x20\x20\x20\x27\x73\x6F\x6D\x65\x74\x68\x69\x6E\x67\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x2E\x2E\x2E\x2E\x2E\x2E\x2E\x27\x73\x6F"\
+	"\x6D\x65\x74\x68\x69\x6E\x67\x20\x65\x6C\x73\x65\x27\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x6B\x6E\x6F\x77\x20\x74\x68\x61"\
+	"\x74\x20\x74\x68\x69\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x69\x6E\x64"\
+	"\x65\x6E\x74\x65\x64\x20\x74\x6F\x20\x69\x6E\x64\x65\x6E\x74\x5F\x6C\x65\x76\x65"\
+	"\x6C\x20\x2B\x20\x28\x37\x20\x2D\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
+	"\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x29\x20\x73\x70\x61\x63\x65\x73\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F"\
+	"\x63\x6F\x75\x6E\x74\x20\x3D\x20\x30\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28"\
+	"\x63\x2C\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x29\x29\x20\x7B\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63"\
+	"\x20\x3D\x3D\x3D\x20\x22\x5C\x6E\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75"\
+	"\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28"\
+	"\x22\x5C\x6E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x74\x65\x73"\
+	"\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x74\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20"\
-	"\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
-	"\x72\x6E\x20\x5B\x27\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x5D\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E"\
-	"\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
-	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74"\
-	"\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x20\x3D\x3D\x3D\x20\x2D"\
-	"\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62"\
-	"\x61\x73\x65\x6C\x69\x6E\x65\x20\x3D\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65"\
-	"\x5F\x63\x6F\x75\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A"\
-	"\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
-	"\x20\x69\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x66\x6C\x61\x67"\
-	"\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x20"\
-	"\x2B\x20\x31\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75"\
-	"\x74\x2E\x70\x75\x73\x68\x28\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62"\
-	"\x61\x73\x65\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x2D\x31\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F"\
-	"\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x77\x68\x69\x74\x65\x73"\
-	"\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x2D\x20\x66\x6C\x61\x67\x73\x2E\x69"\
-	"\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x3B"\
-	"\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20"\
+	"\x2B\x3D\x20\x34\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x63\x20\x3D"\
+	"\x3D\x3D\x20\x27\x5C\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F"\
+	"\x74\x68\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F\x75\x6E\x74\x20\x2B\x3D\x20\x31"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70"\
+	"\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x5B\x27\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x5D\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E\x70\x75\x74"\
+	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72"\
+	"\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69"\
+	"\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x20\x3D\x3D\x3D\x20\x2D\x31\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
+	"\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65"\
+	"\x6C\x69\x6E\x65\x20\x3D\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x5F\x63\x6F"\
+	"\x75\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x75\x73\x74"\
+	"\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
+	"\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x66\x6C\x61\x67\x73\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x20\x2B\x20\x31"\
+	"\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70"\
-	"\x75\x73\x68\x28\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20"\
-	"\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x63\x2C\x20\x77\x68\x69\x74\x65\x73\x70"\
-	"\x61\x63\x65\x29\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x22\x5C\x6E\x22\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x2B\x3D\x20\x28\x20\x28"\
-	"\x6F\x70\x74\x5F\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77"\
-	"\x6C\x69\x6E\x65\x73\x29\x20\x3F\x20\x28\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
-	"\x20\x3C\x3D\x20\x6F\x70\x74\x5F\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65"\
-	"\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x29\x20\x3F\x20\x31\x3A\x20\x30\x3A\x20\x31"\
-	"\x20\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E"\
-	"\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x5B\x27\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x5D\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E\x70\x75"\
-	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61"\
-	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x5F\x6E\x65\x77\x6C\x69\x6E"\
-	"\x65\x73\x20\x3E\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30"\
-	"\x3B\x20\x69\x20\x3C\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x3B\x20\x69\x20"\
-	"\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
-	"\x77\x6C\x69\x6E\x65\x28\x69\x20\x3D\x3D\x3D\x20\x30\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6A\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D"\
-	"\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x75\x73\x68\x28\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C"\
+	"\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65"\
+	"\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x2D\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
+	"\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63"\
+	"\x65\x5F\x63\x6F\x75\x6E\x74\x20\x2D\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65"\
+	"\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x62\x61\x73\x65\x6C\x69\x6E\x65\x3B\x20\x69\x2B"\
+	"\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68"\
+	"\x28\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x6E\x74\x65\x64\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
-	"\x20\x3E\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x63"\
-	"\x2C\x20\x77\x6F\x72\x64\x63\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
-	"\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C"\
-	"\x65\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69\x6E\x70\x75\x74\x2E\x63\x68"\
-	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x2C\x20\x77\x6F"\
-	"\x72\x64\x63\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x2B\x3D\x20\x69\x6E\x70\x75"\
-	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x6E"\
+	"\x5F\x61\x72\x72\x61\x79\x28\x63\x2C\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65"\
+	"\x29\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x22\x5C\x6E\x22\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x2B\x3D\x20\x28\x20\x28\x6F\x70\x74"\
+	"\x5F\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E"\
+	"\x65\x73\x29\x20\x3F\x20\x28\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3C\x3D"\
+	"\x20\x6F\x70\x74\x5F\x6D\x61\x78\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x73\x29\x20\x3F\x20\x31\x3A\x20\x30\x3A\x20\x31\x20\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74"\
+	"\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x27"\
+	"\x27\x2C\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63"\
+	"\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65"\
+	"\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6F\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20"\
+	"\x3E\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69"\
+	"\x20\x3C\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x3B\x20\x69\x20\x2B\x3D\x20"\
+	"\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69"\
+	"\x6E\x65\x28\x69\x20\x3D\x3D\x3D\x20\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x75\x73"\
+	"\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72"\
+	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x20\x3D\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3E\x20"\
+	"\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x63\x2C\x20\x77"\
+	"\x6F\x72\x64\x63\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C"\
+	"\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28"\
+	"\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41"\
+	"\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x2C\x20\x77\x6F\x72\x64\x63"\
+	"\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63"\
+	"\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3D\x3D\x3D\x20\x69\x6E\x70\x75\x74"\
+	"\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3D\x3D\x3D\x20\x69\x6E"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x6D\x61\x6C\x6C\x20\x61\x6E"\
+	"\x64\x20\x73\x75\x72\x70\x72\x69\x73\x69\x6E\x67\x6C\x79\x20\x75\x6E\x75\x67\x6C"\
+	"\x79\x20\x68\x61\x63\x6B\x20\x66\x6F\x72\x20\x31\x45\x2D\x31\x30\x20\x72\x65\x70"\
+	"\x72\x65\x73\x65\x6E\x74\x61\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x21"\
+	"\x3D\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x63"\
+	"\x2E\x6D\x61\x74\x63\x68\x28\x2F\x5E\x5B\x30\x2D\x39\x5D\x2B\x5B\x45\x65\x5D\x24"\
+	"\x2F\x29\x20\x26\x26\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28"\
+	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x20"\
+	"\x7C\x7C\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x2B\x27\x29\x29\x20\x7B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x73\x69\x67\x6E\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
+	"\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x67\x65\x74\x5F\x6E\x65\x78\x74"\
+	"\x5F\x74\x6F\x6B\x65\x6E\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x2B\x3D"\
+	"\x20\x73\x69\x67\x6E\x20\x2B\x20\x74\x5B\x30\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C"\
+	"\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x69\x6E\x27\x29\x20\x7B\x20\x2F\x2F"\
+	"\x20\x68\x61\x63\x6B\x20\x66\x6F\x72\x20\x27\x69\x6E\x27\x20\x6F\x70\x65\x72\x61"\
+	"\x74\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41"\
+	"\x54\x4F\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61\x6E"\
+	"\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x26\x26\x20\x6C\x61\x73\x74\x5F"\
+	"\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F"\
+	"\x52\x27\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x26"\
+	"\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F"\
+	"\x45\x51\x55\x41\x4C\x53\x27\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x26\x26\x20\x21\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E"\
+	"\x65\x20\x26\x26\x20\x28\x6F\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x73\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
+	"\x20\x21\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x63\x20\x3D\x3D\x3D\x20\x27\x28\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27"\
+	"\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45"\
+	"\x58\x50\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x29\x27\x20"\
+	"\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27"\
+	"\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20"\
+	"\x3D\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x53\x54"\
+	"\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D"\
+	"\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F"\
+	"\x42\x4C\x4F\x43\x4B\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x3B"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F"\
+	"\x4E\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x6F\x6D"\
+	"\x6D\x65\x6E\x74\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x2F\x2F\x20\x70\x65\x65\x6B\x20\x66\x6F\x72\x20\x63\x6F\x6D\x6D\x65"\
+	"\x6E\x74\x20\x2F\x2A\x20\x2E\x2E\x2E\x20\x2A\x2F\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x6E\x6C\x69\x6E\x65\x5F\x63\x6F\x6D\x6D"\
+	"\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x2A\x27"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72"\
+	"\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67"\
+	"\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x21\x20\x28\x69\x6E\x70\x75"\
+	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
+	"\x20\x3D\x3D\x3D\x20\x27\x2A\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68"\
+	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29"\
+	"\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72"\
+	"\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27\x2F\x27"\
+	"\x29\x20\x26\x26\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E"\
 	"\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x6D\x61\x6C\x6C"\
-	"\x20\x61\x6E\x64\x20\x73\x75\x72\x70\x72\x69\x73\x69\x6E\x67\x6C\x79\x20\x75\x6E"\
-	"\x75\x67\x6C\x79\x20\x68\x61\x63\x6B\x20\x66\x6F\x72\x20\x31\x45\x2D\x31\x30\x20"\
-	"\x72\x65\x70\x72\x65\x73\x65\x6E\x74\x61\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
-	"\x73\x20\x21\x3D\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x26"\
-	"\x26\x20\x63\x2E\x6D\x61\x74\x63\x68\x28\x2F\x5E\x5B\x30\x2D\x39\x5D\x2B\x5B\x45"\
-	"\x65\x5D\x24\x2F\x29\x20\x26\x26\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72"\
-	"\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2D\x27\x20\x7C\x7C\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70"\
-	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x2B\x27\x29\x29"\
-	"\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x73\x69\x67\x6E\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61"\
-	"\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F"\
-	"\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x67\x65\x74\x5F\x6E"\
-	"\x65\x78\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x20\x2B\x3D\x20\x73\x69\x67\x6E\x20\x2B\x20\x74\x5B\x30\x5D\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x69\x6E\x27\x29\x20\x7B"\
-	"\x20\x2F\x2F\x20\x68\x61\x63\x6B\x20\x66\x6F\x72\x20\x27\x69\x6E\x27\x20\x6F\x70"\
-	"\x65\x72\x61\x74\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x4F\x50"\
-	"\x45\x52\x41\x54\x4F\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x26\x26\x20\x6C\x61"\
-	"\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52"\
-	"\x41\x54\x4F\x52\x27\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27"\
-	"\x54\x4B\x5F\x45\x51\x55\x41\x4C\x53\x27\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x26\x26\x20\x21\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F"\
-	"\x6C\x69\x6E\x65\x20\x26\x26\x20\x28\x6F\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76"\
-	"\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74"\
-	"\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x28\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D"\
-	"\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x53\x54\x41\x52"\
-	"\x54\x5F\x45\x58\x50\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27"\
-	"\x29\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63"\
-	"\x2C\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x5D\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x63\x20\x3D\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B"\
-	"\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x5D\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63"\
-	"\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x45"\
-	"\x4E\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D"\
-	"\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43"\
-	"\x4F\x4C\x4F\x4E\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2F\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
-	"\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x65\x65\x6B\x20\x66\x6F\x72\x20\x63\x6F"\
-	"\x6D\x6D\x65\x6E\x74\x20\x2F\x2A\x20\x2E\x2E\x2E\x20\x2A\x2F\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x6E\x6C\x69\x6E\x65\x5F\x63"\
-	"\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61"\
-	"\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20"\
-	"\x27\x2A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C"\
-	"\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x21\x20\x28\x69"\
-	"\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70"\
-	"\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x2A\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74"\
-	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B"\
-	"\x20\x31\x29\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28"\
-	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29\x20\x3D\x3D\x3D\x20"\
-	"\x27\x2F\x27\x29\x20\x26\x26\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C"\
-	"\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20"\
+	"\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65"\
+	"\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20"\
+	"\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20"\
+	"\x27\x5C\x78\x30\x64\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x78\x30"\
+	"\x61\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x6C\x69\x6E\x65"\
+	"\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B"\
+	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F"\
+	"\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x6C"\
+	"\x69\x6E\x65\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x5B\x27\x2F\x2A\x27\x20\x2B\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2B\x20"\
+	"\x27\x2A\x2F\x27\x2C\x20\x27\x54\x4B\x5F\x49\x4E\x4C\x49\x4E\x45\x5F\x43\x4F\x4D"\
+	"\x4D\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x5B\x27\x2F\x2A\x27\x20\x2B\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2B\x20\x27\x2A"\
+	"\x2F\x27\x2C\x20\x27\x54\x4B\x5F\x42\x4C\x4F\x43\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E"\
+	"\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x65\x65\x6B\x20\x66\x6F\x72"\
+	"\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2F\x2F\x20\x2E\x2E\x2E\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68"\
+	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x63\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28"\
+	"\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F"\
+	"\x70\x6F\x73\x29\x20\x21\x3D\x3D\x20\x27\x5C\x72\x27\x20\x26\x26\x20\x69\x6E\x70"\
+	"\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
+	"\x29\x20\x21\x3D\x3D\x20\x27\x5C\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65\x6E"\
+	"\x74\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61"\
 	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65"\
-	"\x6E\x74\x20\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D"\
-	"\x3D\x3D\x20\x27\x5C\x78\x30\x64\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27"\
-	"\x5C\x78\x30\x61\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x6C"\
-	"\x69\x6E\x65\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
 	"\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73"\
-	"\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67"\
-	"\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x69\x6E\x6C\x69\x6E\x65\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x5B\x27\x2F\x2A\x27\x20\x2B\x20\x63\x6F\x6D\x6D\x65\x6E\x74"\
-	"\x20\x2B\x20\x27\x2A\x2F\x27\x2C\x20\x27\x54\x4B\x5F\x49\x4E\x4C\x49\x4E\x45\x5F"\
-	"\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
-	"\x72\x6E\x20\x5B\x27\x2F\x2A\x27\x20\x2B\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2B"\
-	"\x20\x27\x2A\x2F\x27\x2C\x20\x27\x54\x4B\x5F\x42\x4C\x4F\x43\x4B\x5F\x43\x4F\x4D"\
-	"\x4D\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x65\x65\x6B\x20"\
-	"\x66\x6F\x72\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2F\x2F\x20\x2E\x2E\x2E\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74"\
-	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x63\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C"\
-	"\x65\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73"\
-	"\x65\x72\x5F\x70\x6F\x73\x29\x20\x21\x3D\x3D\x20\x27\x5C\x72\x27\x20\x26\x26\x20"\
-	"\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F"\
-	"\x70\x6F\x73\x29\x20\x21\x3D\x3D\x20\x27\x5C\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D"\
-	"\x6D\x65\x6E\x74\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
-	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72"\
-	"\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65"\
-	"\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74"\
-	"\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70"\
-	"\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C"\
-	"\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x5B\x63\x6F\x6D\x6D\x65\x6E\x74\x2C\x20\x27\x54\x4B\x5F\x43"\
-	"\x4F\x4D\x4D\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x22\x27\x22\x20\x7C\x7C"\
-	"\x20\x2F\x2F\x20\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x20\x3D\x3D\x3D\x20\x27\x22\x27\x20\x7C\x7C\x20\x2F\x2F\x20\x73\x74\x72\x69\x6E"\
-	"\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2F\x27"\
-	"\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x28\x6C\x61"\
-	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44"\
-	"\x27\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x65\x78\x74\x2C\x20\x5B\x27\x72\x65\x74\x75\x72\x6E\x27\x2C\x20\x27\x64\x6F\x27"\
-	"\x5D\x29\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54"\
-	"\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74"\
-	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58"\
-	"\x50\x52\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D"\
-	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C"\
-	"\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45"\
-	"\x4E\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79"\
-	"\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70"\
+	"\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20"\
+	"\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x5B\x63\x6F\x6D\x6D\x65\x6E\x74\x2C\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D"\
+	"\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x22\x27\x22\x20\x7C\x7C\x20\x2F\x2F"\
+	"\x20\x73\x74\x72\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x3D"\
+	"\x3D\x20\x27\x22\x27\x20\x7C\x7C\x20\x2F\x2F\x20\x73\x74\x72\x69\x6E\x67\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x20\x26\x26"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x28\x6C\x61\x73\x74\x5F"\
+	"\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x20\x26"\
+	"\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
+	"\x2C\x20\x5B\x27\x72\x65\x74\x75\x72\x6E\x27\x2C\x20\x27\x64\x6F\x27\x5D\x29\x29"\
+	"\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x43"\
+	"\x4F\x4D\x4D\x45\x4E\x54\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
+	"\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27"\
 	"\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54"\
-	"\x4B\x5F\x45\x51\x55\x41\x4C\x53\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79"\
-	"\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x20\x7C\x7C\x20\x6C"\
-	"\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D"\
-	"\x49\x43\x4F\x4C\x4F\x4E\x27\x29\x29\x29\x29\x20\x7B\x20\x2F\x2F\x20\x72\x65\x67"\
-	"\x65\x78\x70\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
-	"\x73\x65\x70\x20\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x65\x73\x75\x6C\x74"\
-	"\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x63\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F"\
-	"\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x73\x65\x70\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x68\x61\x6E\x64\x6C\x65\x20\x72\x65\x67\x65\x78\x70\x20\x73\x65\x70"\
-	"\x61\x72\x61\x74\x65\x6C\x79\x2E\x2E\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x6E"\
-	"\x5F\x63\x68\x61\x72\x5F\x63\x6C\x61\x73\x73\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x77\x68\x69\x6C\x65\x20\x28\x65\x73\x63\x20\x7C\x7C\x20\x69\x6E\x5F\x63\x68"\
-	"\x61\x72\x5F\x63\x6C\x61\x73\x73\x20\x7C\x7C\x20\x69\x6E\x70\x75\x74\x2E\x63\x68"\
-	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x21\x3D\x3D"\
-	"\x20\x73\x65\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x69\x6E"\
-	"\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68"\
-	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x65\x73\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x65\x73\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
-	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x5C\x5C"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74"\
-	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61"\
+	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F"\
+	"\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20"\
+	"\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x20\x7C\x7C"\
+	"\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45"\
+	"\x51\x55\x41\x4C\x53\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20"\
+	"\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4F\x46\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74"\
+	"\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F"\
+	"\x4C\x4F\x4E\x27\x29\x29\x29\x29\x20\x7B\x20\x2F\x2F\x20\x72\x65\x67\x65\x78\x70"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x65\x70"\
+	"\x20\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x65\x73\x75\x6C\x74\x69\x6E\x67"\
+	"\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x63\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
+	"\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
+	"\x65\x70\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x68\x61\x6E\x64\x6C\x65\x20\x72\x65\x67\x65\x78\x70\x20\x73\x65\x70\x61\x72\x61"\
+	"\x74\x65\x6C\x79\x2E\x2E\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x6E\x5F\x63\x68"\
+	"\x61\x72\x5F\x63\x6C\x61\x73\x73\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68"\
+	"\x69\x6C\x65\x20\x28\x65\x73\x63\x20\x7C\x7C\x20\x69\x6E\x5F\x63\x68\x61\x72\x5F"\
+	"\x63\x6C\x61\x73\x73\x20\x7C\x7C\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41"\
+	"\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x21\x3D\x3D\x20\x73\x65"\
+	"\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73"\
+	"\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41"\
+	"\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x21\x65\x73\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65"\
+	"\x73\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61"\
+	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x5C\x5C\x27\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x6E\x5F\x63\x68\x61\x72\x5F\x63\x6C\x61\x73\x73\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72"\
-	"\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68"\
+	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x5F\x63\x68\x61\x72\x5F"\
-	"\x63\x6C\x61\x73\x73\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x69\x6E\x5F\x63\x68\x61\x72\x5F\x63\x6C\x61\x73\x73\x20\x3D\x20\x74\x72\x75\x65"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
+	"\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72"\
+	"\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x5F\x63\x68\x61\x72\x5F\x63\x6C\x61"\
+	"\x73\x73\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20"\
-	"\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72"\
-	"\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x69\x6E\x63\x6F\x6D"\
-	"\x70\x6C\x65\x74\x65\x20\x73\x74\x72\x69\x6E\x67\x2F\x72\x65\x78\x70\x20\x77\x68"\
-	"\x65\x6E\x20\x65\x6E\x64\x2D\x6F\x66\x2D\x66\x69\x6C\x65\x20\x72\x65\x61\x63\x68"\
-	"\x65\x64\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x62\x61\x69\x6C\x20"\
-	"\x6F\x75\x74\x20\x77\x69\x74\x68\x20\x77\x68\x61\x74\x20\x68\x61\x64\x20\x62\x65"\
-	"\x65\x6E\x20\x72\x65\x63\x65\x69\x76\x65\x64\x20\x73\x6F\x20\x66\x61\x72\x2E\x0A"\
+	"\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x72\x65\x73\x75"\
-	"\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x2C\x20\x27\x54\x4B\x5F\x53\x54"\
-	"\x52\x49\x4E\x47\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64\x20\x68\x61\x6E\x64\x6C\x65\x20\x73"\
-	"\x74\x72\x69\x6E\x67\x20\x61\x6C\x73\x6F\x20\x73\x65\x70\x61\x72\x61\x74\x65\x6C"\
-	"\x79\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x65\x73\x63\x20\x7C\x7C\x20\x69"\
-	"\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70"\
-	"\x6F\x73\x29\x20\x21\x3D\x3D\x20\x73\x65\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x69"\
-	"\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70"\
-	"\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x65\x73\x63\x29\x20\x7B"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
+	"\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x69\x6E\x70\x75\x74"\
-	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x5C\x5C\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C"\
-	"\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72"\
-	"\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70"\
-	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C"\
-	"\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x69\x6E\x63\x6F\x6D\x70\x6C\x65\x74\x65\x20\x73\x74\x72\x69\x6E\x67\x2F\x72\x65"\
-	"\x78\x70\x20\x77\x68\x65\x6E\x20\x65\x6E\x64\x2D\x6F\x66\x2D\x66\x69\x6C\x65\x20"\
-	"\x72\x65\x61\x63\x68\x65\x64\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x62\x61\x69\x6C\x20\x6F\x75\x74\x20\x77\x69\x74\x68\x20\x77\x68\x61\x74\x20\x68"\
-	"\x61\x64\x20\x62\x65\x65\x6E\x20\x72\x65\x63\x65\x69\x76\x65\x64\x20\x73\x6F\x20"\
-	"\x66\x61\x72\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x5B\x72\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x2C\x20\x27"\
-	"\x54\x4B\x5F\x53\x54\x52\x49\x4E\x47\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20"\
-	"\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x73"\
-	"\x65\x70\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x73\x65\x70\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x72\x65\x67\x65\x78"\
-	"\x70\x73\x20\x6D\x61\x79\x20\x68\x61\x76\x65\x20\x6D\x6F\x64\x69\x66\x69\x65\x72"\
-	"\x73\x20\x2F\x72\x65\x67\x65\x78\x70\x2F\x4D\x4F\x44\x20\x2C\x20\x73\x6F\x20\x66"\
-	"\x65\x74\x63\x68\x20\x74\x68\x6F\x73\x65\x2C\x20\x74\x6F\x6F\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x70"\
-	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65"\
-	"\x6E\x67\x74\x68\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69\x6E\x70"\
-	"\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
-	"\x29\x2C\x20\x77\x6F\x72\x64\x63\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x69\x6E\x63\x6F\x6D\x70\x6C\x65"\
+	"\x74\x65\x20\x73\x74\x72\x69\x6E\x67\x2F\x72\x65\x78\x70\x20\x77\x68\x65\x6E\x20"\
+	"\x65\x6E\x64\x2D\x6F\x66\x2D\x66\x69\x6C\x65\x20\x72\x65\x61\x63\x68\x65\x64\x2E"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x62\x61\x69\x6C\x20\x6F\x75\x74"\
+	"\x20\x77\x69\x74\x68\x20\x77\x68\x61\x74\x20\x68\x61\x64\x20\x62\x65\x65\x6E\x20"\
+	"\x72\x65\x63\x65\x69\x76\x65\x64\x20\x73\x6F\x20\x66\x61\x72\x2E\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x72\x65\x73\x75\x6C\x74\x69"\
+	"\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x2C\x20\x27\x54\x4B\x5F\x53\x54\x52\x49\x4E"\
+	"\x47\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x61\x6E\x64\x20\x68\x61\x6E\x64\x6C\x65\x20\x73\x74\x72\x69"\
+	"\x6E\x67\x20\x61\x6C\x73\x6F\x20\x73\x65\x70\x61\x72\x61\x74\x65\x6C\x79\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x65\x73\x63\x20\x7C\x7C\x20\x69\x6E\x70\x75"\
+	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
+	"\x20\x21\x3D\x3D\x20\x73\x65\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"\
 	"\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x69\x6E\x70\x75"\
 	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x72\x65\x73\x75\x6C\x74\x69\x6E\x67"\
-	"\x5F\x73\x74\x72\x69\x6E\x67\x2C\x20\x27\x54\x4B\x5F\x53\x54\x52\x49\x4E\x47\x27"\
-	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x23\x27\x29\x20\x7B\x0A\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x75\x74"\
-	"\x70\x75\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x20\x26\x26\x20"\
-	"\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F"\
-	"\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x68\x65\x62\x61"\
-	"\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x63\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69"\
-	"\x6C\x65\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70"\
-	"\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x63\x20\x21\x3D\x20\x27\x5C"\
-	"\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72"\
-	"\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"\
-	"\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x63\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x65\x73\x63\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68"\
+	"\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x5C\x5C\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
+	"\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67"\
+	"\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x69\x6E\x63"\
+	"\x6F\x6D\x70\x6C\x65\x74\x65\x20\x73\x74\x72\x69\x6E\x67\x2F\x72\x65\x78\x70\x20"\
+	"\x77\x68\x65\x6E\x20\x65\x6E\x64\x2D\x6F\x66\x2D\x66\x69\x6C\x65\x20\x72\x65\x61"\
+	"\x63\x68\x65\x64\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x62\x61\x69"\
+	"\x6C\x20\x6F\x75\x74\x20\x77\x69\x74\x68\x20\x77\x68\x61\x74\x20\x68\x61\x64\x20"\
+	"\x62\x65\x65\x6E\x20\x72\x65\x63\x65\x69\x76\x65\x64\x20\x73\x6F\x20\x66\x61\x72"\
+	"\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x72\x65"\
+	"\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x2C\x20\x27\x54\x4B\x5F"\
+	"\x53\x54\x52\x49\x4E\x47\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20"\
+	"\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"\
+	"\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x73\x65\x70\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65"\
+	"\x70\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x72\x65\x67\x65\x78\x70\x73\x20"\
+	"\x6D\x61\x79\x20\x68\x61\x76\x65\x20\x6D\x6F\x64\x69\x66\x69\x65\x72\x73\x20\x2F"\
+	"\x72\x65\x67\x65\x78\x70\x2F\x4D\x4F\x44\x20\x2C\x20\x73\x6F\x20\x66\x65\x74\x63"\
+	"\x68\x20\x74\x68\x6F\x73\x65\x2C\x20\x74\x6F\x6F\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74"\
+	"\x68\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69\x6E\x70\x75\x74\x2E"\
+	"\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x2C\x20"\
+	"\x77\x6F\x72\x64\x63\x68\x61\x72\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x69"\
+	"\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63"\
+	"\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
 	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73"\
-	"\x68\x28\x74\x72\x69\x6D\x28\x72\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72"\
-	"\x69\x6E\x67\x29\x20\x2B\x20\x27\x5C\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C"\
-	"\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74"\
-	"\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x53\x70\x69\x64\x65\x72\x6D\x6F\x6E\x6B\x65\x79\x2D\x73\x70\x65\x63\x69\x66\x69"\
-	"\x63\x20\x73\x68\x61\x72\x70\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x73\x20\x66\x6F"\
-	"\x72\x20\x63\x69\x72\x63\x75\x6C\x61\x72\x20\x72\x65\x66\x65\x72\x65\x6E\x63\x65"\
-	"\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x74\x74"\
-	"\x70\x73\x3A\x2F\x2F\x64\x65\x76\x65\x6C\x6F\x70\x65\x72\x2E\x6D\x6F\x7A\x69\x6C"\
-	"\x6C\x61\x2E\x6F\x72\x67\x2F\x45\x6E\x2F\x53\x68\x61\x72\x70\x5F\x76\x61\x72\x69"\
-	"\x61\x62\x6C\x65\x73\x5F\x69\x6E\x5F\x4A\x61\x76\x61\x53\x63\x72\x69\x70\x74\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x74\x74\x70\x3A"\
-	"\x2F\x2F\x6D\x78\x72\x2E\x6D\x6F\x7A\x69\x6C\x6C\x61\x2E\x6F\x72\x67\x2F\x6D\x6F"\
-	"\x7A\x69\x6C\x6C\x61\x2D\x63\x65\x6E\x74\x72\x61\x6C\x2F\x73\x6F\x75\x72\x63\x65"\
-	"\x2F\x6A\x73\x2F\x73\x72\x63\x2F\x6A\x73\x73\x63\x61\x6E\x2E\x63\x70\x70\x20\x61"\
-	"\x72\x6F\x75\x6E\x64\x20\x6C\x69\x6E\x65\x20\x31\x39\x33\x35\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x68\x61\x72\x70\x20\x3D\x20"\
-	"\x27\x23\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F"\
-	"\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69"\
-	"\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70"\
-	"\x6F\x73\x29\x2C\x20\x64\x69\x67\x69\x74\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D"\
-	"\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72"\
-	"\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20\x2B\x3D\x20\x63\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x77\x68\x69\x6C\x65\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x5B\x72\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74"\
+	"\x72\x69\x6E\x67\x2C\x20\x27\x54\x4B\x5F\x53\x54\x52\x49\x4E\x47\x27\x5D\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x23\x27\x29\x20\x7B\x0A\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x75\x74\x70\x75\x74"\
+	"\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x20\x26\x26\x20\x69\x6E\x70"\
+	"\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
+	"\x29\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x68\x65\x62\x61\x6E\x67\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75"\
+	"\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x63\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20"\
 	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F"\
-	"\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x63\x20\x21\x3D\x3D\x20\x27\x23\x27\x20"\
-	"\x26\x26\x20\x63\x20\x21\x3D\x3D\x20\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D"\
-	"\x20\x27\x23\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E"\
+	"\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x63\x20\x21\x3D\x20\x27\x5C\x6E\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x20\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28"\
+	"\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x69"\
+	"\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x74"\
+	"\x72\x69\x6D\x28\x72\x65\x73\x75\x6C\x74\x69\x6E\x67\x5F\x73\x74\x72\x69\x6E\x67"\
+	"\x29\x20\x2B\x20\x27\x5C\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74\x6F\x6B\x65"\
+	"\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x53\x70\x69"\
+	"\x64\x65\x72\x6D\x6F\x6E\x6B\x65\x79\x2D\x73\x70\x65\x63\x69\x66\x69\x63\x20\x73"\
+	"\x68\x61\x72\x70\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x73\x20\x66\x6F\x72\x20\x63"\
+	"\x69\x72\x63\x75\x6C\x61\x72\x20\x72\x65\x66\x65\x72\x65\x6E\x63\x65\x73\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x74\x74\x70\x73\x3A"\
+	"\x2F\x2F\x64\x65\x76\x65\x6C\x6F\x70\x65\x72\x2E\x6D\x6F\x7A\x69\x6C\x6C\x61\x2E"\
+	"\x6F\x72\x67\x2F\x45\x6E\x2F\x53\x68\x61\x72\x70\x5F\x76\x61\x72\x69\x61\x62\x6C"\
+	"\x65\x73\x5F\x69\x6E\x5F\x4A\x61\x76\x61\x53\x63\x72\x69\x70\x74\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x74\x74\x70\x3A\x2F\x2F\x6D"\
+	"\x78\x72\x2E\x6D\x6F\x7A\x69\x6C\x6C\x61\x2E\x6F\x72\x67\x2F\x6D\x6F\x7A\x69\x6C"\
+	"\x6C\x61\x2D\x63\x65\x6E\x74\x72\x61\x6C\x2F\x73\x6F\x75\x72\x63\x65\x2F\x6A\x73"\
+	"\x2F\x73\x72\x63\x2F\x6A\x73\x73\x63\x61\x6E\x2E\x63\x70\x70\x20\x61\x72\x6F\x75"\
+	"\x6E\x64\x20\x6C\x69\x6E\x65\x20\x31\x39\x33\x35\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x68\x61\x72\x70\x20\x3D\x20\x27\x23\x27"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x61"\
+	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E"\
+	"\x67\x74\x68\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x69\x6E\x70\x75"\
+	"\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29"\
+	"\x2C\x20\x64\x69\x67\x69\x74\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x69\x6E"\
 	"\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F"\
-	"\x73\x29\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E"\
-	"\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20"\
-	"\x31\x29\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20"\
-	"\x2B\x3D\x20\x27\x5B\x5D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20"\
-	"\x2B\x3D\x20\x32\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63"\
-	"\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D"\
-	"\x3D\x20\x27\x7B\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41"\
-	"\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29\x20\x3D\x3D"\
-	"\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20\x2B\x3D\x20\x27\x7B"\
-	"\x7D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x5B\x73\x68\x61\x72\x70\x2C\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63"\
-	"\x20\x3D\x3D\x3D\x20\x27\x3C\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x73\x75"\
-	"\x62\x73\x74\x72\x69\x6E\x67\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2D"\
-	"\x20\x31\x2C\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x33\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x3C\x21\x2D\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73"\
+	"\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x77\x68\x69\x6C\x65\x20\x28\x70\x61"\
+	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E"\
+	"\x67\x74\x68\x20\x26\x26\x20\x63\x20\x21\x3D\x3D\x20\x27\x23\x27\x20\x26\x26\x20"\
+	"\x63\x20\x21\x3D\x3D\x20\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x23"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x2F\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74"\
+	"\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20"\
+	"\x3D\x3D\x3D\x20\x27\x5B\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61"\
+	"\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29\x20"\
+	"\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20\x2B\x3D\x20"\
+	"\x27\x5B\x5D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20"\
-	"\x33\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73"\
-	"\x2E\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x5B\x27\x3C\x21\x2D\x2D\x27\x2C\x20\x27\x54\x4B\x5F\x43\x4F\x4D"\
-	"\x4D\x45\x4E\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2D\x27"\
-	"\x20\x26\x26\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F"\
-	"\x6D\x6D\x65\x6E\x74\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x73\x75\x62\x73\x74"\
+	"\x32\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72"\
+	"\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x20\x3D\x3D\x3D\x20\x27"\
+	"\x7B\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70"\
+	"\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27"\
+	"\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x68\x61\x72\x70\x20\x2B\x3D\x20\x27\x7B\x7D\x27\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B"\
+	"\x73\x68\x61\x72\x70\x2C\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x5D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D"\
+	"\x3D\x20\x27\x3C\x27\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x73\x75\x62\x73\x74"\
 	"\x72\x69\x6E\x67\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2D\x20\x31\x2C"\
-	"\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x32\x29\x20\x3D\x3D\x3D"\
-	"\x20\x27\x2D\x2D\x3E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D"\
-	"\x65\x6E\x74\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61"\
-	"\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
-	"\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x5B\x27\x2D\x2D\x3E\x27\x2C\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E"\
+	"\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x33\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x3C\x21\x2D\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x33\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E"\
+	"\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x5B\x27\x3C\x21\x2D\x2D\x27\x2C\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E"\
 	"\x54\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x63\x2C\x20"\
-	"\x70\x75\x6E\x63\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20"\
-	"\x3C\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x69\x6E"\
-	"\x5F\x61\x72\x72\x61\x79\x28\x63\x20\x2B\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61"\
-	"\x72\x41\x74\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x2C\x20\x70\x75\x6E"\
-	"\x63\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x20\x26\x26"\
+	"\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65"\
+	"\x6E\x74\x20\x26\x26\x20\x69\x6E\x70\x75\x74\x2E\x73\x75\x62\x73\x74\x72\x69\x6E"\
+	"\x67\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2D\x20\x31\x2C\x20\x70\x61"\
+	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x20\x32\x29\x20\x3D\x3D\x3D\x20\x27\x2D"\
+	"\x2D\x3E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6C\x61\x67\x73\x2E\x69\x6E\x5F\x68\x74\x6D\x6C\x5F\x63\x6F\x6D\x6D\x65\x6E\x74"\
+	"\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D\x20\x32\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61\x6E\x74\x65"\
+	"\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69"\
+	"\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B"\
+	"\x27\x2D\x2D\x3E\x27\x2C\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x5D"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x63\x2C\x20\x70\x75\x6E"\
+	"\x63\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x68\x69\x6C\x65\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3C\x20\x69"\
+	"\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x20\x26\x26\x20\x69\x6E\x5F\x61\x72"\
+	"\x72\x61\x79\x28\x63\x20\x2B\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x2C\x20\x70\x75\x6E\x63\x74\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x20\x2B\x3D\x20\x69\x6E\x70\x75\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x70\x61"\
+	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x2B\x3D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D\x20\x69\x6E"\
+	"\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x45\x51\x55\x41\x4C\x53"\
+	"\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52"\
+	"\x41\x54\x4F\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x55\x4E\x4B\x4E"\
+	"\x4F\x57\x4E\x27\x5D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F"\
+	"\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D"\
+	"\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x0A\x20\x20\x20\x20\x69"\
+	"\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x27\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74"\
+	"\x5F\x73\x69\x7A\x65\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x6F\x70"\
+	"\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A\x65\x20\x2D"\
+	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x77\x68\x69\x6C"\
+	"\x65\x20\x28\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x20\x26\x26"\
+	"\x20\x28\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x5B\x30\x5D\x20"\
+	"\x3D\x3D\x3D\x20\x27\x20\x27\x20\x7C\x7C\x20\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65"\
+	"\x5F\x74\x65\x78\x74\x5B\x30\x5D\x20\x3D\x3D\x3D\x20\x27\x5C\x74\x27\x29\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x69\x6E\x64\x65\x6E\x74\x5F"\
+	"\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F"\
+	"\x74\x65\x78\x74\x5B\x30\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x5F"\
+	"\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x20\x3D\x20\x6A\x73\x5F\x73\x6F\x75"\
+	"\x72\x63\x65\x5F\x74\x65\x78\x74\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x31"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x6E\x70\x75\x74\x20\x3D"\
+	"\x20\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x20\x27\x27\x3B\x20\x2F\x2F"\
+	"\x20\x6C\x61\x73\x74\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x20\x70\x61\x73\x73"\
+	"\x65\x64\x0A\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x20\x27"\
+	"\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x3B\x20\x2F\x2F\x20\x6C"\
+	"\x61\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20\x74\x79\x70\x65\x0A\x20\x20\x20\x20\x6C"\
+	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x27\x27\x3B\x20\x2F\x2F\x20\x6C\x61"\
+	"\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20\x74\x65\x78\x74\x0A\x20\x20\x20\x20\x6C\x61"\
+	"\x73\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x27\x27\x3B\x20\x2F"\
+	"\x2F\x20\x70\x72\x65\x2D\x6C\x61\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20\x74\x65\x78"\
+	"\x74\x0A\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x5B\x5D\x3B\x0A\x0A"\
+	"\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74\x5F\x63\x6C"\
+	"\x6F\x73\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x77"\
+	"\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x3D\x20\x22\x5C\x6E\x5C\x72\x5C\x74\x20"\
+	"\x22\x2E\x73\x70\x6C\x69\x74\x28\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x77\x6F\x72"\
+	"\x64\x63\x68\x61\x72\x20\x3D\x20\x27\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6A\x6B"\
+	"\x6C\x6D\x6E\x6F\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7A\x41\x42\x43\x44\x45"\
+	"\x46\x47\x48\x49\x4A\x4B\x4C\x4D\x4E\x4F\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59"\
+	"\x5A\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x5F\x24\x27\x2E\x73\x70\x6C\x69\x74"\
+	"\x28\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x69\x67\x69\x74\x73\x20\x3D\x20\x27"\
+	"\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x27\x2E\x73\x70\x6C\x69\x74\x28\x27\x27"\
+	"\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x75\x6E\x63\x74\x20\x3D\x20\x27\x2B\x20\x2D"\
+	"\x20\x2A\x20\x2F\x20\x25\x20\x26\x20\x2B\x2B\x20\x2D\x2D\x20\x3D\x20\x2B\x3D\x20"\
+	"\x2D\x3D\x20\x2A\x3D\x20\x2F\x3D\x20\x25\x3D\x20\x3D\x3D\x20\x3D\x3D\x3D\x20\x21"\
+	"\x3D\x20\x21\x3D\x3D\x20\x3E\x20\x3C\x20\x3E\x3D\x20\x3C\x3D\x20\x3E\x3E\x20\x3C"\
+	"\x3C\x20\x3E\x3E\x3E\x20\x3E\x3E\x3E\x3D\x20\x3E\x3E\x3D\x20\x3C\x3C\x3D\x20\x26"\
+	"\x26\x20\x26\x3D\x20\x7C\x20\x7C\x7C\x20\x21\x20\x21\x21\x20\x2C\x20\x3A\x20\x3F"\
+	"\x20\x5E\x20\x5E\x3D\x20\x7C\x3D\x20\x3A\x3A\x27\x2E\x73\x70\x6C\x69\x74\x28\x27"\
+	"\x20\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x77\x6F\x72\x64\x73\x20\x77"\
+	"\x68\x69\x63\x68\x20\x73\x68\x6F\x75\x6C\x64\x20\x61\x6C\x77\x61\x79\x73\x20\x73"\
+	"\x74\x61\x72\x74\x20\x6F\x6E\x20\x6E\x65\x77\x20\x6C\x69\x6E\x65\x2E\x0A\x20\x20"\
+	"\x20\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x20\x3D\x20\x27\x63"\
+	"\x6F\x6E\x74\x69\x6E\x75\x65\x2C\x74\x72\x79\x2C\x74\x68\x72\x6F\x77\x2C\x72\x65"\
+	"\x74\x75\x72\x6E\x2C\x76\x61\x72\x2C\x69\x66\x2C\x73\x77\x69\x74\x63\x68\x2C\x63"\
+	"\x61\x73\x65\x2C\x64\x65\x66\x61\x75\x6C\x74\x2C\x66\x6F\x72\x2C\x77\x68\x69\x6C"\
+	"\x65\x2C\x62\x72\x65\x61\x6B\x2C\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x2E\x73\x70"\
+	"\x6C\x69\x74\x28\x27\x2C\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x73\x74"\
+	"\x61\x74\x65\x73\x20\x73\x68\x6F\x77\x69\x6E\x67\x20\x69\x66\x20\x77\x65\x20\x61"\
+	"\x72\x65\x20\x63\x75\x72\x72\x65\x6E\x74\x6C\x79\x20\x69\x6E\x20\x65\x78\x70\x72"\
+	"\x65\x73\x73\x69\x6F\x6E\x20\x28\x69\x2E\x65\x2E\x20\x22\x69\x66\x22\x20\x63\x61"\
+	"\x73\x65\x29\x20\x2D\x20\x27\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x27\x2C\x20"\
+	"\x6F\x72\x20\x69\x6E\x20\x75\x73\x75\x61\x6C\x20\x62\x6C\x6F\x63\x6B\x20\x28\x6C"\
+	"\x69\x6B\x65\x2C\x20\x70\x72\x6F\x63\x65\x64\x75\x72\x65\x29\x2C\x20\x27\x42\x4C"\
+	"\x4F\x43\x4B\x27\x2E\x0A\x20\x20\x20\x20\x2F\x2F\x20\x73\x6F\x6D\x65\x20\x66\x6F"\
+	"\x72\x6D\x61\x74\x74\x69\x6E\x67\x20\x64\x65\x70\x65\x6E\x64\x73\x20\x6F\x6E\x20"\
+	"\x74\x68\x61\x74\x2E\x0A\x20\x20\x20\x20\x66\x6C\x61\x67\x5F\x73\x74\x6F\x72\x65"\
+	"\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28"\
+	"\x27\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x61\x72\x73\x65"\
+	"\x72\x5F\x70\x6F\x73\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
+	"\x20\x28\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x74\x20\x3D\x20\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74\x6F\x6B\x65\x6E"\
 	"\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73"\
-	"\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3E\x3D"\
-	"\x20\x69\x6E\x70\x75\x74\x5F\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27"\
-	"\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x45\x51\x55"\
-	"\x41\x4C\x53\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x4F"\
-	"\x50\x45\x52\x41\x54\x4F\x52\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x5B\x63\x2C\x20\x27\x54\x4B\x5F\x55"\
-	"\x4E\x4B\x4E\x4F\x57\x4E\x27\x5D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x2F\x2F\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D"\
-	"\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x2D\x0A\x20\x20"\
-	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x3D\x20\x27\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6F\x70\x74\x5F\x69\x6E\x64"\
-	"\x65\x6E\x74\x5F\x73\x69\x7A\x65\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D"\
-	"\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x69\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A"\
-	"\x65\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x77"\
-	"\x68\x69\x6C\x65\x20\x28\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74"\
-	"\x20\x26\x26\x20\x28\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x5B"\
-	"\x30\x5D\x20\x3D\x3D\x3D\x20\x27\x20\x27\x20\x7C\x7C\x20\x6A\x73\x5F\x73\x6F\x75"\
-	"\x72\x63\x65\x5F\x74\x65\x78\x74\x5B\x30\x5D\x20\x3D\x3D\x3D\x20\x27\x5C\x74\x27"\
-	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x69\x6E\x64\x65"\
-	"\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x3D\x20\x6A\x73\x5F\x73\x6F\x75\x72"\
-	"\x63\x65\x5F\x74\x65\x78\x74\x5B\x30\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x20\x3D\x20\x6A\x73\x5F"\
-	"\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x2E\x73\x75\x62\x73\x74\x72\x69\x6E"\
-	"\x67\x28\x31\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x6E\x70\x75"\
-	"\x74\x20\x3D\x20\x6A\x73\x5F\x73\x6F\x75\x72\x63\x65\x5F\x74\x65\x78\x74\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x20\x27\x27\x3B"\
-	"\x20\x2F\x2F\x20\x6C\x61\x73\x74\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x20\x70"\
-	"\x61\x73\x73\x65\x64\x0A\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20"\
-	"\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x3B\x20\x2F"\
-	"\x2F\x20\x6C\x61\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20\x74\x79\x70\x65\x0A\x20\x20"\
-	"\x20\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x27\x27\x3B\x20\x2F\x2F"\
-	"\x20\x6C\x61\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20\x74\x65\x78\x74\x0A\x20\x20\x20"\
-	"\x20\x6C\x61\x73\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x27\x27"\
-	"\x3B\x20\x2F\x2F\x20\x70\x72\x65\x2D\x6C\x61\x73\x74\x20\x74\x6F\x6B\x65\x6E\x20"\
-	"\x74\x65\x78\x74\x0A\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x20\x3D\x20\x5B\x5D"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74"\
-	"\x5F\x63\x6C\x6F\x73\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x3D\x20\x22\x5C\x6E\x5C\x72"\
-	"\x5C\x74\x20\x22\x2E\x73\x70\x6C\x69\x74\x28\x27\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x77\x6F\x72\x64\x63\x68\x61\x72\x20\x3D\x20\x27\x61\x62\x63\x64\x65\x66\x67\x68"\
-	"\x69\x6A\x6B\x6C\x6D\x6E\x6F\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7A\x41\x42"\
-	"\x43\x44\x45\x46\x47\x48\x49\x4A\x4B\x4C\x4D\x4E\x4F\x50\x51\x52\x53\x54\x55\x56"\
-	"\x57\x58\x59\x5A\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x5F\x24\x27\x2E\x73\x70"\
-	"\x6C\x69\x74\x28\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x69\x67\x69\x74\x73\x20"\
-	"\x3D\x20\x27\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x27\x2E\x73\x70\x6C\x69\x74"\
-	"\x28\x27\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x75\x6E\x63\x74\x20\x3D\x20\x27"\
-	"\x2B\x20\x2D\x20\x2A\x20\x2F\x20\x25\x20\x26\x20\x2B\x2B\x20\x2D\x2D\x20\x3D\x20"\
-	"\x2B\x3D\x20\x2D\x3D\x20\x2A\x3D\x20\x2F\x3D\x20\x25\x3D\x20\x3D\x3D\x20\x3D\x3D"\
-	"\x3D\x20\x21\x3D\x20\x21\x3D\x3D\x20\x3E\x20\x3C\x20\x3E\x3D\x20\x3C\x3D\x20\x3E"\
-	"\x3E\x20\x3C\x3C\x20\x3E\x3E\x3E\x20\x3E\x3E\x3E\x3D\x20\x3E\x3E\x3D\x20\x3C\x3C"\
-	"\x3D\x20\x26\x26\x20\x26\x3D\x20\x7C\x20\x7C\x7C\x20\x21\x20\x21\x21\x20\x2C\x20"\
-	"\x3A\x20\x3F\x20\x5E\x20\x5E\x3D\x20\x7C\x3D\x20\x3A\x3A\x27\x2E\x73\x70\x6C\x69"\
-	"\x74\x28\x27\x20\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x77\x6F\x72\x64"\
-	"\x73\x20\x77\x68\x69\x63\x68\x20\x73\x68\x6F\x75\x6C\x64\x20\x61\x6C\x77\x61\x79"\
-	"\x73\x20\x73\x74\x61\x72\x74\x20\x6F\x6E\x20\x6E\x65\x77\x20\x6C\x69\x6E\x65\x2E"\
-	"\x0A\x20\x20\x20\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x20\x3D"\
-	"\x20\x27\x63\x6F\x6E\x74\x69\x6E\x75\x65\x2C\x74\x72\x79\x2C\x74\x68\x72\x6F\x77"\
-	"\x2C\x72\x65\x74\x75\x72\x6E\x2C\x76\x61\x72\x2C\x69\x66\x2C\x73\x77\x69\x74\x63"\
-	"\x68\x2C\x63\x61\x73\x65\x2C\x64\x65\x66\x61\x75\x6C\x74\x2C\x66\x6F\x72\x2C\x77"\
-	"\x68\x69\x6C\x65\x2C\x62\x72\x65\x61\x6B\x2C\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
-	"\x2E\x73\x70\x6C\x69\x74\x28\x27\x2C\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F"\
-	"\x20\x73\x74\x61\x74\x65\x73\x20\x73\x68\x6F\x77\x69\x6E\x67\x20\x69\x66\x20\x77"\
-	"\x65\x20\x61\x72\x65\x20\x63\x75\x72\x72\x65\x6E\x74\x6C\x79\x20\x69\x6E\x20\x65"\
-	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x28\x69\x2E\x65\x2E\x20\x22\x69\x66\x22"\
-	"\x20\x63\x61\x73\x65\x29\x20\x2D\x20\x27\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E"\
-	"\x27\x2C\x20\x6F\x72\x20\x69\x6E\x20\x75\x73\x75\x61\x6C\x20\x62\x6C\x6F\x63\x6B"\
-	"\x20\x28\x6C\x69\x6B\x65\x2C\x20\x70\x72\x6F\x63\x65\x64\x75\x72\x65\x29\x2C\x20"\
-	"\x27\x42\x4C\x4F\x43\x4B\x27\x2E\x0A\x20\x20\x20\x20\x2F\x2F\x20\x73\x6F\x6D\x65"\
-	"\x20\x66\x6F\x72\x6D\x61\x74\x74\x69\x6E\x67\x20\x64\x65\x70\x65\x6E\x64\x73\x20"\
-	"\x6F\x6E\x20\x74\x68\x61\x74\x2E\x0A\x20\x20\x20\x20\x66\x6C\x61\x67\x5F\x73\x74"\
-	"\x6F\x72\x65\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F"\
-	"\x64\x65\x28\x27\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x61"\
-	"\x72\x73\x65\x72\x5F\x70\x6F\x73\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x77\x68"\
-	"\x69\x6C\x65\x20\x28\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x67\x65\x74\x5F\x6E\x65\x78\x74\x5F\x74\x6F"\
-	"\x6B\x65\x6E\x28\x70\x61\x72\x73\x65\x72\x5F\x70\x6F\x73\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x20\x74\x5B"\
-	"\x30\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x79"\
-	"\x70\x65\x20\x3D\x20\x74\x5B\x31\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54"\
-	"\x4B\x5F\x45\x4F\x46\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x74\x6F\x6B\x65"\
-	"\x6E\x5F\x74\x79\x70\x65\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x3A"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F"\
-	"\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57"\
-	"\x4F\x52\x44\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
-	"\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x68\x69\x73\x20\x69\x73\x20"\
-	"\x61\x72\x72\x61\x79\x20\x69\x6E\x64\x65\x78\x20\x73\x70\x65\x63\x69\x66\x69\x65"\
-	"\x72\x2C\x20\x62\x72\x65\x61\x6B\x20\x69\x6D\x6D\x65\x64\x69\x61\x74\x65\x6C\x79"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x2F\x2F\x20\x61\x5B\x78\x5D\x2C\x20\x66\x6E\x28\x29\x5B\x78\x5D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
-	"\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61"\
-	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x28\x45"\
-	"\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
-	"\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x20\x74\x5B\x30\x5D\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x79\x70\x65\x20"\
+	"\x3D\x20\x74\x5B\x31\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x6F\x6B\x65\x6E\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45"\
+	"\x4F\x46\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74"\
+	"\x79\x70\x65\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x3A\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
+	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61"\
+	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44"\
+	"\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
+	"\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x68\x69\x73\x20\x69\x73\x20\x61\x72\x72"\
+	"\x61\x79\x20\x69\x6E\x64\x65\x78\x20\x73\x70\x65\x63\x69\x66\x69\x65\x72\x2C\x20"\
+	"\x62\x72\x65\x61\x6B\x20\x69\x6D\x6D\x65\x64\x69\x61\x74\x65\x6C\x79\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F"\
+	"\x20\x61\x5B\x78\x5D\x2C\x20\x66\x6E\x28\x29\x5B\x78\x5D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69"\
+	"\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x2C\x20\x6C"\
+	"\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x28\x45\x58\x50\x52"\
+	"\x45\x53\x53\x49\x4F\x4E\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B"\
+	"\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F"\
+	"\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D"\
+	"\x27\x20\x7C\x7C\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20"\
+	"\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F"\
+	"\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x6C\x61\x73\x74"\
+	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x20\x26\x26\x20\x6C\x61\x73"\
+	"\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x5D\x2C\x20\x5B\x20\x67\x6F\x65\x73\x20\x74\x6F\x20\x6E\x65"\
+	"\x77\x20\x6C\x69\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73"\
 	"\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49"\
-	"\x4F\x4E\x5D\x27\x20\x7C\x7C\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D"\
-	"\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D\x45\x58\x50\x52\x45\x53"\
-	"\x53\x49\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x6C"\
-	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x20\x26\x26\x20"\
-	"\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x5D\x2C\x20\x5B\x20\x67\x6F\x65\x73\x20\x74\x6F"\
-	"\x20\x6E\x65\x77\x20\x6C\x69\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C"\
-	"\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45"\
-	"\x53\x53\x49\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54"\
-	"\x45\x44\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20"\
+	"\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67"\
+	"\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D"\
+	"\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61"\
-	"\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B\x0A"\
+	"\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61"\
+	"\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B\x45\x58\x50\x52\x45\x53\x53"\
-	"\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74"\
-	"\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74"\
-	"\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
-	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D"\
-	"\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C"\
-	"\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45"\
-	"\x53\x53\x49\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54"\
-	"\x45\x44\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
+	"\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E"\
+	"\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B\x65"\
+	"\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20"\
+	"\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73"\
+	"\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49"\
+	"\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67"\
+	"\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44\x2D"\
+	"\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61"\
-	"\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B\x0A"\
+	"\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61"\
+	"\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
+	"\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E"\
+	"\x5D\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x5F\x6B"\
+	"\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F"\
+	"\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B"\
+	"\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B\x45\x58\x50\x52\x45\x53\x53"\
-	"\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70"\
-	"\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61"\
-	"\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x28\x45\x58\x50"\
+	"\x52\x45\x53\x53\x49\x4F\x4E\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3B\x27"\
+	"\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54"\
+	"\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
+	"\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
+	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52"\
+	"\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27"\
+	"\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x20\x7C\x7C\x20\x6C\x61"\
+	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F"\
+	"\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20"\
+	"\x3D\x3D\x3D\x20\x27\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F\x20\x6E\x6F\x74\x68\x69\x6E\x67"\
+	"\x20\x6F\x6E\x20\x28\x28\x20\x61\x6E\x64\x20\x29\x28\x20\x61\x6E\x64\x20\x5D\x5B"\
+	"\x20\x61\x6E\x64\x20\x5D\x28\x20\x61\x6E\x64\x20\x2E\x28\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61"\
+	"\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44"\
+	"\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27"\
+	"\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69"\
+	"\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73"\
+	"\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27"\
+	"\x74\x79\x70\x65\x6F\x66\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x28\x29"\
+	"\x20\x76\x73\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F"\
+	"\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69"\
+	"\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x2C\x20\x6C"\
+	"\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x20\x7C\x7C\x20\x6C\x61\x73"\
+	"\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x63\x61\x74\x63\x68\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
+	"\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x45"\
+	"\x4E\x44\x5F\x45\x58\x50\x52\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D"\
+	"\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72"\
+	"\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75"\
+	"\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x6D"\
+	"\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
+	"\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73"\
+	"\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73"\
+	"\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E\x54\x45\x44"\
+	"\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
+	"\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x74\x6F\x72"\
+	"\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
+	"\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65"\
-	"\x28\x27\x5B\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
-	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x5B\x45\x58\x50\x52"\
-	"\x45\x53\x53\x49\x4F\x4E\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64\x65\x28\x27\x28"\
-	"\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20"\
-	"\x27\x3B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D"\
-	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
-	"\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73"\
-	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45"\
-	"\x58\x50\x52\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D"\
-	"\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x20\x7C\x7C"\
-	"\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45"\
-	"\x4E\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65"\
-	"\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F\x20\x6E\x6F\x74\x68"\
-	"\x69\x6E\x67\x20\x6F\x6E\x20\x28\x28\x20\x61\x6E\x64\x20\x29\x28\x20\x61\x6E\x64"\
-	"\x20\x5D\x5B\x20\x61\x6E\x64\x20\x5D\x28\x20\x61\x6E\x64\x20\x2E\x28\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
-	"\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x57"\
-	"\x4F\x52\x44\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D"\
-	"\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74"\
-	"\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D"\
-	"\x3D\x20\x27\x74\x79\x70\x65\x6F\x66\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x28\x29\x20\x76\x73\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x5F\x6A\x73\x6C\x69\x6E\x74\x5F\x68\x61\x70\x70\x79\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
-	"\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
-	"\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x20\x7C\x7C\x20"\
-	"\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x63\x61\x74\x63\x68"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74"\
+	"\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x3A\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74"\
+	"\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x64\x6F\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F"\
+	"\x64\x65\x28\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F\x6D\x6F\x64"\
+	"\x65\x28\x27\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22"\
+	"\x65\x78\x70\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
+	"\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20"\
+	"\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
+	"\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
+	"\x77\x6C\x69\x6E\x65\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E"\
-	"\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54"\
-	"\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20"\
-	"\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x6B\x65\x65\x70\x5F"\
-	"\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
-	"\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x72\x69\x6D\x5F\x6F\x75"\
-	"\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x72\x69\x6E\x74"\
-	"\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
+	"\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x20\x26"\
+	"\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F"\
+	"\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
+	"\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41"\
+	"\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
+	"\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F"\
+	"\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x69"\
+	"\x66\x20\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x20\x6F\x72\x20\x54\x4B\x5F"\
+	"\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x61\x72"\
+	"\x72\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x70\x72\x65\x76\x69\x6F\x75\x73\x5F\x6D"\
+	"\x6F\x64\x65\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
+	"\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73"\
+	"\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7D\x2C\x20\x7B\x20\x69"\
+	"\x6E\x20\x61\x72\x72\x61\x79\x20\x63\x6F\x6E\x74\x65\x78\x74\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61"\
+	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x28\x29\x3B\x20\x2F\x2F\x20\x5B\x61\x2C\x20\x62\x2C\x20\x63\x2C\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x42\x4C"\
+	"\x4F\x43\x4B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F"\
+	"\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
+	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C"\
-	"\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x5B\x49\x4E\x44\x45\x4E"\
-	"\x54\x45\x44\x2D\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x5D\x27\x29\x20\x7B\x0A"\
+	"\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B"\
+	"\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D"\
+	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x2F\x2F\x20\x6E\x6F\x74\x68\x69\x6E\x67\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x75\x73\x74"\
+	"\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
-	"\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73"\
-	"\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7B\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x61\x72\x72\x61\x79\x28\x66\x6C\x61"\
+	"\x67\x73\x2E\x6D\x6F\x64\x65\x29\x20\x26\x26\x20\x6F\x70\x74\x5F\x6B\x65\x65\x70"\
+	"\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x52\x45\x41\x4C\x4C\x59\x20\x6E"\
+	"\x65\x65\x64\x20\x61\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x68\x65\x72\x65\x2C\x20"\
+	"\x62\x75\x74\x20\x6E\x65\x77\x6C\x69\x6E\x65\x72\x20\x77\x6F\x75\x6C\x64\x20\x73"\
+	"\x6B\x69\x70\x20\x74\x68\x61\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x6B\x65\x65"\
+	"\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20"\
+	"\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F\x6B\x65"\
+	"\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
+	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
+	"\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54"\
+	"\x4B\x5F\x57\x4F\x52\x44\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x6E\x6F\x2C\x20\x69\x74\x27\x73\x20\x6E\x6F\x74\x20\x79\x6F"\
+	"\x75\x2E\x20\x65\x76\x65\x6E\x20\x49\x20\x68\x61\x76\x65\x20\x70\x72\x6F\x62\x6C"\
+	"\x65\x6D\x73\x20\x75\x6E\x64\x65\x72\x73\x74\x61\x6E\x64\x69\x6E\x67\x20\x68\x6F"\
+	"\x77\x20\x74\x68\x69\x73\x20\x77\x6F\x72\x6B\x73\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64\x20\x77\x68\x61\x74\x20\x64\x6F\x65"\
+	"\x73\x20\x77\x68\x61\x74\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74\x5F\x63\x6C"\
+	"\x6F\x73\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F\x20\x7B\x7D\x20\x23\x23\x20\x77\x68\x69\x6C"\
+	"\x65\x20\x28\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67"\
+	"\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73"\
+	"\x74\x5F\x63\x6C\x6F\x73\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65"\
+	"\x78\x74\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65"\
+	"\x6E\x74\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x6A\x75\x73\x74\x5F\x61\x64\x64"\
+	"\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74"\
+	"\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x20\x26\x26\x20\x6C\x61\x73\x74"\
+	"\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x6D\x61\x6B\x65\x20\x73\x75\x72\x65\x20\x74\x68\x65\x72\x65\x20\x69\x73\x20\x61"\
+	"\x20\x6E\x69\x63\x65\x20\x63\x6C\x65\x61\x6E\x20\x73\x70\x61\x63\x65\x20\x6F\x66"\
+	"\x20\x61\x74\x20\x6C\x65\x61\x73\x74\x20\x6F\x6E\x65\x20\x62\x6C\x61\x6E\x6B\x20"\
+	"\x6C\x69\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x62\x65\x66\x6F\x72\x65\x20\x61\x20\x6E\x65\x77"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x66\x69\x6E\x69\x74\x69\x6F\x6E"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20\x6A\x75\x73\x74\x5F\x61"\
+	"\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3F\x20\x6E\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x73\x20\x3A\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x20\x21\x20\x6F\x70"\
+	"\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20\x3D\x20\x30"\
+	"\x3B\x20\x69\x20\x3C\x20\x32\x20\x2D\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
+	"\x3B\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x28\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D"\
+	"\x20\x27\x63\x61\x73\x65\x27\x20\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
+	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27"\
-	"\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
-	"\x61\x73\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x64\x6F\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74"\
-	"\x5F\x6D\x6F\x64\x65\x28\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x20"\
+	"\x2F\x2F\x20\x73\x77\x69\x74\x63\x68\x20\x63\x61\x73\x65\x73\x20\x66\x6F\x6C\x6C"\
+	"\x6F\x77\x69\x6E\x67\x20\x6F\x6E\x65\x20\x61\x6E\x6F\x74\x68\x65\x72\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x74\x5F"\
-	"\x6D\x6F\x64\x65\x28\x27\x42\x4C\x4F\x43\x4B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65"\
-	"\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D"\
-	"\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29"\
+	"\x2F\x2F\x20\x63\x61\x73\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x73\x74"\
+	"\x61\x72\x74\x73\x20\x69\x6E\x20\x74\x68\x65\x20\x73\x61\x6D\x65\x20\x6C\x69\x6E"\
+	"\x65\x20\x77\x68\x65\x72\x65\x20\x73\x77\x69\x74\x63\x68\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73"\
+	"\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65\x6C\x2D\x2D"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74"\
-	"\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F"\
-	"\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52"\
-	"\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27"\
-	"\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76"\
+	"\x65\x6C\x2B\x2B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x5F"\
+	"\x63\x61\x73\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x4F\x4E\x45\x27\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73"\
+	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x42"\
+	"\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x69\x6E\x5F\x61\x72\x72\x61\x79\x28"\
+	"\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2E\x74\x6F\x4C\x6F\x77\x65\x72\x43\x61"\
+	"\x73\x65\x28\x29\x2C\x20\x5B\x27\x65\x6C\x73\x65\x27\x2C\x20\x27\x63\x61\x74\x63"\
+	"\x68\x27\x2C\x20\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x5D\x29\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74"\
+	"\x79\x6C\x65\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x20\x7C\x7C\x20\x6F\x70\x74"\
+	"\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x6E\x64\x2D\x65"\
+	"\x78\x70\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78"\
+	"\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41"\
+	"\x43\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C"\
+	"\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
+	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F"\
+	"\x4E\x27\x20\x26\x26\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D"\
+	"\x3D\x20\x27\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x66\x6C\x61\x67\x73\x2E\x6D"\
+	"\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
+	"\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F"\
+	"\x53\x45\x4D\x49\x43\x4F\x4C\x4F\x4E\x27\x20\x26\x26\x20\x69\x73\x5F\x65\x78\x70"\
+	"\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
+	"\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54"\
+	"\x52\x49\x4E\x47\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49"\
+	"\x4E\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
+	"\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D"\
+	"\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F"\
+	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x65\x61\x74\x20\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x62\x65\x74\x77\x65"\
+	"\x65\x6E\x20\x2E\x2E\x2E\x65\x6C\x73\x65\x20\x2A\x2A\x2A\x20\x73\x6F\x6D\x65\x5F"\
+	"\x6F\x70\x2E\x2E\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x6F\x6E\x27\x74\x20\x70\x72\x65\x73\x65"\
+	"\x72\x76\x65\x20\x65\x78\x74\x72\x61\x20\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x69"\
+	"\x6E\x20\x74\x68\x69\x73\x20\x70\x6C\x61\x63\x65\x20\x28\x69\x66\x20\x61\x6E\x79"\
+	"\x29\x2C\x20\x62\x75\x74\x20\x64\x6F\x6E\x27\x74\x20\x63\x61\x72\x65\x20\x74\x68"\
+	"\x61\x74\x20\x6D\x75\x63\x68\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28"\
+	"\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
 	"\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F"\
 	"\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67"\
-	"\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D"\
+	"\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F"\
+	"\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50"\
+	"\x52\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28"\
+	"\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61"\
+	"\x72\x74\x65\x72\x73\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20"\
+	"\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
+	"\x20\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78"\
+	"\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65"\
+	"\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65\x20"\
+	"\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B"\
+	"\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C"\
+	"\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65"\
+	"\x78\x74\x2E\x74\x6F\x4C\x6F\x77\x65\x72\x43\x61\x73\x65\x28\x29\x2C\x20\x5B\x27"\
+	"\x65\x6C\x73\x65\x27\x2C\x20\x27\x63\x61\x74\x63\x68\x27\x2C\x20\x27\x66\x69\x6E"\
+	"\x61\x6C\x6C\x79\x27\x5D\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
+	"\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20"\
+	"\x7C\x7C\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D"\
+	"\x22\x65\x78\x70\x61\x6E\x64\x22\x20\x7C\x7C\x20\x6F\x70\x74\x5F\x62\x72\x61\x63"\
+	"\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x6E\x64\x2D\x65\x78\x70\x61\x6E\x64"\
+	"\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x74"\
+	"\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73"\
+	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x70\x72\x65\x66\x69\x78\x20\x3D\x3D\x3D\x20"\
+	"\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x6C\x61\x73\x74\x5F\x74"\
+	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58"\
+	"\x50\x52\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D"\
+	"\x20\x27\x3D\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
+	"\x3D\x20\x27\x2C\x27\x29\x20\x26\x26\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74"\
+	"\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
-	"\x2F\x20\x69\x66\x20\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x20\x6F\x72\x20"\
-	"\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73"\
-	"\x5F\x61\x72\x72\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x70\x72\x65\x76\x69\x6F\x75"\
-	"\x73\x5F\x6D\x6F\x64\x65\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
-	"\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x6C\x61\x73\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
-	"\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7D\x2C\x20"\
-	"\x7B\x20\x69\x6E\x20\x61\x72\x72\x61\x79\x20\x63\x6F\x6E\x74\x65\x78\x74\x0A\x20"\
+	"\x2F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20\x74\x6F\x20\x66\x6F\x72\x63\x65\x20\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x20\x6F\x6E\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
+	"\x3A\x20\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x44\x4F\x4E\x4F\x54"\
+	"\x48\x49\x4E\x47\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65"\
+	"\x78\x74\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x20\x26\x26"\
+	"\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x20\x27\x6E\x65\x77\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63"\
+	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61"\
+	"\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x74\x68\x72\x6F\x77\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x62\x65\x74"\
+	"\x77\x65\x65\x6E\x20\x27\x72\x65\x74\x75\x72\x6E\x20\x6E\x6E\x6E\x27\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
+	"\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D"\
+	"\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B"\
+	"\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x20\x7C\x7C\x20\x74\x6F\x6B\x65"\
+	"\x6E\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x20\x26\x26"\
+	"\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x3A\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20\x74\x6F\x20"\
+	"\x66\x6F\x72\x63\x65\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x6F\x6E\x20\x27\x76\x61"\
+	"\x72\x27\x3A\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x78\x20\x3D\x20\x30\x2E\x2E"\
+	"\x2E\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x69\x66\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x77"\
+	"\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x20\x26\x26\x20\x6C\x61"\
+	"\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F"\
-	"\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C"\
-	"\x69\x6E\x65\x28\x29\x3B\x20\x2F\x2F\x20\x5B\x61\x2C\x20\x62\x2C\x20\x63\x2C\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x20\x66\x6F\x72\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70"\
+	"\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69"\
+	"\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64"\
+	"\x65\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72"\
+	"\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65"\
+	"\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74"\
+	"\x65\x78\x74\x20\x21\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E"\
+	"\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
+	"\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E"\
+	"\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65"\
-	"\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x5F\x61\x72\x72\x61\x79\x28"\
+	"\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F"\
+	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x20\x26\x26\x20\x6C\x61\x73\x74"\
+	"\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
+	"\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x20\x2F\x2F\x20\x7D\x2C"\
+	"\x20\x69\x6E\x20\x6C\x69\x73\x74\x73\x20\x67\x65\x74\x20\x61\x20\x6E\x65\x77\x6C"\
+	"\x69\x6E\x65\x20\x74\x72\x65\x61\x74\x6D\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x70\x72\x65"\
+	"\x66\x69\x78\x20\x3D\x3D\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74"\
+	"\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x77\x6F\x72\x64\x20"\
+	"\x3D\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72"\
+	"\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F"\
+	"\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D\x20\x66\x61"\
+	"\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E"\
+	"\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
+	"\x69\x66\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x74"\
+	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
+	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67"\
+	"\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F\x4E"\
+	"\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
+	"\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x3D\x20"\
+	"\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65"\
+	"\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65"\
+	"\x20\x3D\x3D\x20\x27\x4F\x42\x4A\x45\x43\x54\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x4F\x42\x4A\x45\x43"\
+	"\x54\x20\x6D\x6F\x64\x65\x20\x69\x73\x20\x77\x65\x69\x72\x64\x20\x61\x6E\x64\x20"\
+	"\x64\x6F\x65\x73\x6E\x27\x74\x20\x67\x65\x74\x20\x72\x65\x73\x65\x74\x20\x74\x6F"\
+	"\x6F\x20\x77\x65\x6C\x6C\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20\x27\x42\x4C"\
+	"\x4F\x43\x4B\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x45\x4E\x44"\
-	"\x5F\x42\x4C\x4F\x43\x4B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x73\x74\x6F\x72\x65\x5F\x6D\x6F\x64\x65\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x62\x72\x61"\
-	"\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
-	"\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20"\
-	"\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x53\x54\x52"\
+	"\x49\x4E\x47\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B"\
+	"\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73"\
+	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x42"\
+	"\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D"\
+	"\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F\x4E\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
+	"\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73"\
+	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27"\
 	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x74\x68\x69\x6E\x67\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A"\
-	"\x75\x73\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x72\x65\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29"\
+	"\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F"\
+	"\x45\x51\x55\x41\x4C\x53\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x6A\x75\x73\x74\x20\x67\x6F\x74\x20\x61\x6E\x20\x27\x3D\x27\x20\x69\x6E"\
+	"\x20\x61\x20\x76\x61\x72\x2D\x6C\x69\x6E\x65\x2C\x20\x64\x69\x66\x66\x65\x72\x65"\
+	"\x6E\x74\x20\x66\x6F\x72\x6D\x61\x74\x74\x69\x6E\x67\x2F\x6C\x69\x6E\x65\x2D\x62"\
+	"\x72\x65\x61\x6B\x69\x6E\x67\x2C\x20\x65\x74\x63\x20\x77\x69\x6C\x6C\x20\x6E\x6F"\
+	"\x77\x20\x62\x65\x20\x64\x6F\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65"\
+	"\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63"\
+	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
+	"\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61"\
+	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
+	"\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x70\x61\x63\x65\x5F\x62\x65\x66"\
+	"\x6F\x72\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x73\x70\x61\x63\x65\x5F\x61\x66\x74\x65\x72\x20"\
+	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20"\
+	"\x26\x26\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C"\
+	"\x27\x20\x26\x26\x20\x28\x69\x73\x5F\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
+	"\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F\x20\x6E\x6F"\
+	"\x74\x20\x62\x72\x65\x61\x6B\x20\x6F\x6E\x20\x63\x6F\x6D\x6D\x61\x2C\x20\x66\x6F"\
+	"\x72\x28\x76\x61\x72\x20\x61\x20\x3D\x20\x31\x2C\x20\x62\x20\x3D\x20\x32\x29\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67"\
+	"\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D"\
+	"\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66"\
+	"\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B"\
+	"\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61"\
+	"\x69\x6E\x74\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74"\
+	"\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61"\
+	"\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F"\
+	"\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7B\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
-	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x61\x72\x72\x61\x79\x28"\
-	"\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x20\x26\x26\x20\x6F\x70\x74\x5F\x6B"\
-	"\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F"\
-	"\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x65\x20\x52\x45\x41\x4C\x4C"\
-	"\x59\x20\x6E\x65\x65\x64\x20\x61\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x68\x65\x72"\
-	"\x65\x2C\x20\x62\x75\x74\x20\x6E\x65\x77\x6C\x69\x6E\x65\x72\x20\x77\x6F\x75\x6C"\
-	"\x64\x20\x73\x6B\x69\x70\x20\x74\x68\x61\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x5F"\
-	"\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74\x69"\
-	"\x6F\x6E\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74"\
-	"\x5F\x6B\x65\x65\x70\x5F\x61\x72\x72\x61\x79\x5F\x69\x6E\x64\x65\x6E\x74\x61\x74"\
-	"\x69\x6F\x6E\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28"\
 	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x2C\x20\x69\x74\x27\x73\x20\x6E\x6F\x74"\
-	"\x20\x79\x6F\x75\x2E\x20\x65\x76\x65\x6E\x20\x49\x20\x68\x61\x76\x65\x20\x70\x72"\
-	"\x6F\x62\x6C\x65\x6D\x73\x20\x75\x6E\x64\x65\x72\x73\x74\x61\x6E\x64\x69\x6E\x67"\
-	"\x20\x68\x6F\x77\x20\x74\x68\x69\x73\x20\x77\x6F\x72\x6B\x73\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x6E\x64\x20\x77\x68\x61\x74\x20"\
-	"\x64\x6F\x65\x73\x20\x77\x68\x61\x74\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F\x6A\x75\x73\x74"\
-	"\x5F\x63\x6C\x6F\x73\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F\x20\x7B\x7D\x20\x23\x23\x20\x77"\
-	"\x68\x69\x6C\x65\x20\x28\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61"\
-	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73"\
-	"\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x5F\x62\x6C\x6F\x63\x6B\x5F"\
-	"\x6A\x75\x73\x74\x5F\x63\x6C\x6F\x73\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
-	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69"\
-	"\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x6A\x75\x73\x74\x5F"\
-	"\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x7C\x7C\x20\x6C\x61\x73"\
-	"\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x20\x26\x26\x20\x6C"\
-	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x6D\x61\x6B\x65\x20\x73\x75\x72\x65\x20\x74\x68\x65\x72\x65\x20\x69"\
-	"\x73\x20\x61\x20\x6E\x69\x63\x65\x20\x63\x6C\x65\x61\x6E\x20\x73\x70\x61\x63\x65"\
-	"\x20\x6F\x66\x20\x61\x74\x20\x6C\x65\x61\x73\x74\x20\x6F\x6E\x65\x20\x62\x6C\x61"\
-	"\x6E\x6B\x20\x6C\x69\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x62\x65\x66\x6F\x72\x65\x20\x61\x20"\
-	"\x6E\x65\x77\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x66\x69\x6E\x69\x74"\
-	"\x69\x6F\x6E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3D\x20\x6A\x75\x73"\
-	"\x74\x5F\x61\x64\x64\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x20\x3F\x20\x6E\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x3A\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x20\x21"\
-	"\x20\x6F\x70\x74\x5F\x70\x72\x65\x73\x65\x72\x76\x65\x5F\x6E\x65\x77\x6C\x69\x6E"\
-	"\x65\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x73"\
-	"\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x69\x20"\
-	"\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x32\x20\x2D\x20\x6E\x5F\x6E\x65\x77\x6C\x69"\
-	"\x6E\x65\x73\x3B\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20"\
-	"\x3D\x3D\x3D\x20\x27\x63\x61\x73\x65\x27\x20\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x2F\x2F\x20\x73\x77\x69\x74\x63\x68\x20\x63\x61\x73\x65\x73\x20\x66"\
-	"\x6F\x6C\x6C\x6F\x77\x69\x6E\x67\x20\x6F\x6E\x65\x20\x61\x6E\x6F\x74\x68\x65\x72"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x6D\x6F\x76\x65\x5F\x69\x6E\x64\x65\x6E\x74\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
 	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x2F\x2F\x20\x63\x61\x73\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74"\
-	"\x20\x73\x74\x61\x72\x74\x73\x20\x69\x6E\x20\x74\x68\x65\x20\x73\x61\x6D\x65\x20"\
-	"\x6C\x69\x6E\x65\x20\x77\x68\x65\x72\x65\x20\x73\x77\x69\x74\x63\x68\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
-	"\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F\x6C\x65\x76\x65"\
-	"\x6C\x2D\x2D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x5F"\
-	"\x6C\x65\x76\x65\x6C\x2B\x2B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E"\
-	"\x69\x6E\x5F\x63\x61\x73\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x4F\x4E\x45"\
-	"\x27\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E"\
-	"\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x69\x6E\x5F\x61\x72\x72"\
-	"\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2E\x74\x6F\x4C\x6F\x77\x65"\
-	"\x72\x43\x61\x73\x65\x28\x29\x2C\x20\x5B\x27\x65\x6C\x73\x65\x27\x2C\x20\x27\x63"\
-	"\x61\x74\x63\x68\x27\x2C\x20\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x5D\x29\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
-	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x5F\x62\x72\x61\x63\x65"\
-	"\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x20\x7C\x7C\x20"\
-	"\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x6E"\
-	"\x64\x2D\x65\x78\x70\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65"\
-	"\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27"\
-	"\x53\x50\x41\x43\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69"\
-	"\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73"\
-	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43"\
-	"\x4F\x4C\x4F\x4E\x27\x20\x26\x26\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x66\x6C\x61\x67"\
-	"\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x44\x4F\x5F\x42\x4C\x4F\x43\x4B"\
-	"\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27"\
-	"\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F\x4E\x27\x20\x26\x26\x20\x69\x73\x5F"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64"\
-	"\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
-	"\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B"\
-	"\x5F\x53\x54\x52\x49\x4E\x47\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45"\
-	"\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61"\
-	"\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x65\x61\x74\x20\x6E\x65\x77\x6C\x69\x6E\x65\x73\x20\x62\x65"\
-	"\x74\x77\x65\x65\x6E\x20\x2E\x2E\x2E\x65\x6C\x73\x65\x20\x2A\x2A\x2A\x20\x73\x6F"\
-	"\x6D\x65\x5F\x6F\x70\x2E\x2E\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x77\x6F\x6E\x27\x74\x20\x70\x72"\
-	"\x65\x73\x65\x72\x76\x65\x20\x65\x78\x74\x72\x61\x20\x6E\x65\x77\x6C\x69\x6E\x65"\
-	"\x73\x20\x69\x6E\x20\x74\x68\x69\x73\x20\x70\x6C\x61\x63\x65\x20\x28\x69\x66\x20"\
-	"\x61\x6E\x79\x29\x2C\x20\x62\x75\x74\x20\x64\x6F\x6E\x27\x74\x20\x63\x61\x72\x65"\
-	"\x20\x74\x68\x61\x74\x20\x6D\x75\x63\x68\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70"\
-	"\x75\x74\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27"\
-	"\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x66\x69"\
-	"\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61"\
-	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F"\
-	"\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E"\
+	"\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x6D\x6D\x2C"\
+	"\x20\x77\x68\x65\x6E\x20\x64\x6F\x65\x73\x20\x74\x68\x69\x73\x20\x68\x61\x70\x70"\
+	"\x65\x6E\x3F\x20\x74\x65\x73\x74\x73\x20\x64\x6F\x6E\x27\x74\x20\x63\x61\x74\x63"\
+	"\x68\x20\x74\x68\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F"\
+	"\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x72\x65"\
+	"\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D"\
+	"\x3D\x3D\x20\x27\x74\x68\x72\x6F\x77\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x22\x72\x65\x74\x75\x72\x6E"\
+	"\x22\x20\x68\x61\x64\x20\x61\x20\x73\x70\x65\x63\x69\x61\x6C\x20\x68\x61\x6E\x64"\
+	"\x6C\x69\x6E\x67\x20\x69\x6E\x20\x54\x4B\x5F\x57\x4F\x52\x44\x2E\x20\x4E\x6F\x77"\
+	"\x20\x77\x65\x20\x6E\x65\x65\x64\x20\x74\x6F\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
+	"\x68\x65\x20\x66\x61\x76\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70"\
 	"\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72"\
-	"\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F"\
-	"\x73\x74\x61\x72\x74\x65\x72\x73\x29\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65"\
-	"\x78\x74\x20\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x65\x78\x74\x20\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65"\
-	"\x66\x69\x78\x20\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65"\
+	"\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x20\x26\x26\x20\x66\x6C\x61\x67\x73\x2E"\
+	"\x69\x6E\x5F\x63\x61\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29"\
+	"\x3B\x20\x2F\x2F\x20\x63\x6F\x6C\x6F\x6E\x20\x72\x65\x61\x6C\x6C\x79\x20\x61\x73"\
+	"\x6B\x73\x20\x66\x6F\x72\x20\x73\x65\x70\x61\x72\x61\x74\x65\x20\x74\x72\x65\x61"\
+	"\x74\x6D\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73"\
+	"\x2E\x69\x6E\x5F\x63\x61\x73\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65"\
+	"\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x3A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x73\x70\x61"\
+	"\x63\x65\x73\x20\x61\x72\x6F\x75\x6E\x64\x20\x65\x78\x6F\x74\x69\x63\x20\x6E\x61"\
+	"\x6D\x65\x73\x70\x61\x63\x69\x6E\x67\x20\x73\x79\x6E\x74\x61\x78\x20\x6F\x70\x65"\
+	"\x72\x61\x74\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78"\
+	"\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76"\
+	"\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73"\
+	"\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x65\x66\x69\x78\x20\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69"\
-	"\x6E\x65\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20"\
-	"\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69"\
-	"\x66\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E"\
-	"\x5F\x74\x65\x78\x74\x2E\x74\x6F\x4C\x6F\x77\x65\x72\x43\x61\x73\x65\x28\x29\x2C"\
-	"\x20\x5B\x27\x65\x6C\x73\x65\x27\x2C\x20\x27\x63\x61\x74\x63\x68\x27\x2C\x20\x27"\
-	"\x66\x69\x6E\x61\x6C\x6C\x79\x27\x5D\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x42\x4C\x4F\x43"\
-	"\x4B\x27\x20\x7C\x7C\x20\x6F\x70\x74\x5F\x62\x72\x61\x63\x65\x5F\x73\x74\x79\x6C"\
-	"\x65\x3D\x3D\x22\x65\x78\x70\x61\x6E\x64\x22\x20\x7C\x7C\x20\x6F\x70\x74\x5F\x62"\
-	"\x72\x61\x63\x65\x5F\x73\x74\x79\x6C\x65\x3D\x3D\x22\x65\x6E\x64\x2D\x65\x78\x70"\
-	"\x61\x6E\x64\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75"\
-	"\x74\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F"\
+	"\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
+	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65"\
+	"\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C"\
 	"\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x70\x72\x65\x66\x69\x78\x20\x3D"\
-	"\x3D\x3D\x20\x27\x4E\x45\x57\x4C\x49\x4E\x45\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x6C\x61\x73"\
-	"\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54"\
-	"\x5F\x45\x58\x50\x52\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20"\
-	"\x3D\x3D\x3D\x20\x27\x3D\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
-	"\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x26\x26\x20\x74\x6F\x6B\x65\x6E\x5F\x74"\
-	"\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20\x74\x6F\x20\x66\x6F\x72\x63"\
-	"\x65\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x6F\x6E\x20\x27\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x27\x3A\x20\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x44\x4F"\
-	"\x4E\x4F\x54\x48\x49\x4E\x47\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
-	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
-	"\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x20\x27\x6E\x65"\
-	"\x77\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73"\
-	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C"\
-	"\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x74\x68\x72\x6F"\
-	"\x77\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20"\
-	"\x62\x65\x74\x77\x65\x65\x6E\x20\x27\x72\x65\x74\x75\x72\x6E\x20\x6E\x6E\x6E\x27"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20"\
-	"\x21\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E\x44\x5F\x45\x58\x50\x52\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x21\x3D\x3D\x20"\
-	"\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x20\x7C\x7C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x76\x61\x72\x27\x29"\
-	"\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x3A"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20"\
-	"\x74\x6F\x20\x66\x6F\x72\x63\x65\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20\x6F\x6E\x20"\
-	"\x27\x76\x61\x72\x27\x3A\x20\x66\x6F\x72\x20\x28\x76\x61\x72\x20\x78\x20\x3D\x20"\
-	"\x30\x2E\x2E\x2E\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x69\x66\x27\x20\x26\x26\x20\x6C\x61\x73"\
-	"\x74\x5F\x77\x6F\x72\x64\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x20\x26\x26"\
-	"\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x3D\x20\x27\x7B\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20\x6E\x65\x77\x6C"\
-	"\x69\x6E\x65\x20\x66\x6F\x72\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65"\
-	"\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72"\
-	"\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65"\
-	"\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
+	"\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E"\
+	"\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x26\x26\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F"\
+	"\x64\x65\x20\x21\x3D\x3D\x20\x22\x28\x45\x58\x50\x52\x45\x53\x53\x49\x4F\x4E\x29"\
+	"\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E"\
-	"\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x6C"\
-	"\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x20\x26\x26\x20\x6C\x61\x73"\
-	"\x74\x5F\x74\x65\x78\x74\x20\x21\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61"\
-	"\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E"\
-	"\x64\x65\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27"\
+	"\x4F\x42\x4A\x45\x43\x54\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
+	"\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
 	"\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x5F\x61\x72\x72"\
-	"\x61\x79\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x20\x26\x26\x20\x6C\x61"\
-	"\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x20\x26\x26\x20\x6C"\
-	"\x61\x73\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x7D"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x20\x2F\x2F"\
-	"\x20\x7D\x2C\x20\x69\x6E\x20\x6C\x69\x73\x74\x73\x20\x67\x65\x74\x20\x61\x20\x6E"\
-	"\x65\x77\x6C\x69\x6E\x65\x20\x74\x72\x65\x61\x74\x6D\x65\x6E\x74\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x70\x72\x65\x66\x69\x78\x20\x3D\x3D\x3D\x20\x27\x53\x50\x41\x43\x45\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
-	"\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x77\x6F"\
-	"\x72\x64\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E"\
-	"\x76\x61\x72\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76"\
-	"\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D"\
-	"\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74"\
-	"\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
-	"\x3D\x20\x27\x69\x66\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65\x20"\
-	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F"\
-	"\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x69\x66\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F"\
-	"\x4C\x4F\x4E\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65"\
-	"\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69"\
-	"\x6E\x64\x65\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D"\
-	"\x6F\x64\x65\x20\x3D\x3D\x20\x27\x4F\x42\x4A\x45\x43\x54\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x4F\x42"\
-	"\x4A\x45\x43\x54\x20\x6D\x6F\x64\x65\x20\x69\x73\x20\x77\x65\x69\x72\x64\x20\x61"\
-	"\x6E\x64\x20\x64\x6F\x65\x73\x6E\x27\x74\x20\x67\x65\x74\x20\x72\x65\x73\x65\x74"\
-	"\x20\x74\x6F\x6F\x20\x77\x65\x6C\x6C\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x20"\
-	"\x27\x42\x4C\x4F\x43\x4B\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F"\
-	"\x53\x54\x52\x49\x4E\x47\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20"\
-	"\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20"\
-	"\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x45\x4E"\
-	"\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x79\x70"\
-	"\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x53\x45\x4D\x49\x43\x4F\x4C\x4F\x4E\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F"\
-	"\x52\x44\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B"\
-	"\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
-	"\x54\x4B\x5F\x45\x51\x55\x41\x4C\x53\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69"\
-	"\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x6A\x75\x73\x74\x20\x67\x6F\x74\x20\x61\x6E\x20\x27\x3D\x27"\
-	"\x20\x69\x6E\x20\x61\x20\x76\x61\x72\x2D\x6C\x69\x6E\x65\x2C\x20\x64\x69\x66\x66"\
-	"\x65\x72\x65\x6E\x74\x20\x66\x6F\x72\x6D\x61\x74\x74\x69\x6E\x67\x2F\x6C\x69\x6E"\
-	"\x65\x2D\x62\x72\x65\x61\x6B\x69\x6E\x67\x2C\x20\x65\x74\x63\x20\x77\x69\x6C\x6C"\
-	"\x20\x6E\x6F\x77\x20\x62\x65\x20\x64\x6F\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C"\
-	"\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73"\
 	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F"\
-	"\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
-	"\x65\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41\x54\x4F\x52\x27\x3A\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x70\x61\x63\x65\x5F"\
-	"\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x70\x61\x63\x65\x5F\x61\x66\x74"\
-	"\x65\x72\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69"\
-	"\x6E\x65\x20\x26\x26\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D"\
-	"\x20\x27\x2C\x27\x20\x26\x26\x20\x28\x69\x73\x5F\x65\x78\x70\x72\x65\x73\x73\x69"\
-	"\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29\x29\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x6F"\
-	"\x20\x6E\x6F\x74\x20\x62\x72\x65\x61\x6B\x20\x6F\x6E\x20\x63\x6F\x6D\x6D\x61\x2C"\
-	"\x20\x66\x6F\x72\x28\x76\x61\x72\x20\x61\x20\x3D\x20\x31\x2C\x20\x62\x20\x3D\x20"\
-	"\x32\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65"\
-	"\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65"\
-	"\x5F\x74\x61\x69\x6E\x74\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73"\
-	"\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x72\x65\x69\x6E\x64\x65\x6E\x74\x65\x64"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76"\
-	"\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61"\
-	"\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66"\
+	"\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x4F\x42\x4A\x45\x43"\
+	"\x54\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65"\
+	"\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69"\
 	"\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F"\
-	"\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x45\x58\x50\x52\x20\x6F\x72\x20\x44\x4F\x5F\x42\x4C\x4F\x43\x4B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68"\
-	"\x6D\x6D\x2C\x20\x77\x68\x65\x6E\x20\x64\x6F\x65\x73\x20\x74\x68\x69\x73\x20\x68"\
-	"\x61\x70\x70\x65\x6E\x3F\x20\x74\x65\x73\x74\x73\x20\x64\x6F\x6E\x27\x74\x20\x63"\
-	"\x61\x74\x63\x68\x20\x74\x68\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6C\x61\x67\x73\x2E\x76"\
-	"\x61\x72\x5F\x6C\x69\x6E\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61"\
+	"\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x5B\x27\x2D\x2D\x27\x2C"\
+	"\x20\x27\x2B\x2B\x27\x2C\x20\x27\x21\x27\x5D\x29\x20\x7C\x7C\x20\x28\x69\x6E\x5F"\
+	"\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x5B\x27"\
+	"\x2D\x27\x2C\x20\x27\x2B\x27\x5D\x29\x20\x26\x26\x20\x28\x69\x6E\x5F\x61\x72\x72"\
+	"\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x2C\x20\x5B\x27\x54\x4B\x5F\x53"\
+	"\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x2C\x20\x27\x54\x4B\x5F\x53\x54\x41"\
+	"\x52\x54\x5F\x45\x58\x50\x52\x27\x2C\x20\x27\x54\x4B\x5F\x45\x51\x55\x41\x4C\x53"\
+	"\x27\x5D\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74"\
+	"\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73"\
+	"\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74"\
+	"\x65\x78\x74\x2C\x20\x5B\x27\x3D\x3D\x27\x2C\x20\x27\x21\x3D\x27\x2C\x20\x27\x2B"\
+	"\x3D\x27\x2C\x20\x27\x2D\x3D\x27\x2C\x20\x27\x2A\x3D\x27\x2C\x20\x27\x2F\x3D\x27"\
+	"\x2C\x20\x27\x2B\x27\x2C\x20\x27\x2D\x27\x5D\x29\x29\x29\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
+	"\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74"\
+	"\x2C\x20\x5B\x27\x2D\x2D\x27\x2C\x20\x27\x2B\x2B\x27\x2C\x20\x27\x21\x27\x5D\x29"\
+	"\x20\x7C\x7C\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F"\
+	"\x74\x65\x78\x74\x2C\x20\x5B\x27\x2D\x27\x2C\x20\x27\x2B\x27\x5D\x29\x20\x26\x26"\
+	"\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65"\
+	"\x2C\x20\x5B\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x2C"\
+	"\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x2C\x20\x27\x54"\
+	"\x4B\x5F\x45\x51\x55\x41\x4C\x53\x27\x2C\x20\x27\x54\x4B\x5F\x4F\x50\x45\x52\x41"\
+	"\x54\x4F\x52\x27\x5D\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C"\
+	"\x61\x73\x74\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74"\
+	"\x65\x72\x73\x29\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x75\x6E\x61\x72\x79\x20\x6F\x70\x65\x72\x61"\
+	"\x74\x6F\x72\x73\x20\x28\x61\x6E\x64\x20\x62\x69\x6E\x61\x72\x79\x20\x2B\x2F\x2D"\
+	"\x20\x70\x72\x65\x74\x65\x6E\x64\x69\x6E\x67\x20\x74\x6F\x20\x62\x65\x20\x75\x6E"\
+	"\x61\x72\x79\x29\x20\x73\x70\x65\x63\x69\x61\x6C\x20\x63\x61\x73\x65\x73\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63"\
+	"\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63\x65\x5F"\
+	"\x61\x66\x74\x65\x72\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74"\
+	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x20\x26\x26\x20\x69\x73\x5F"\
+	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64"\
+	"\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6F\x72\x20\x28\x3B\x3B\x20\x2B\x2B\x69"\
+	"\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x5E\x5E\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63"\
+	"\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20"\
-	"\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78"\
-	"\x74\x20\x3D\x3D\x3D\x20\x27\x74\x68\x72\x6F\x77\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x22\x72\x65\x74"\
-	"\x75\x72\x6E\x22\x20\x68\x61\x64\x20\x61\x20\x73\x70\x65\x63\x69\x61\x6C\x20\x68"\
-	"\x61\x6E\x64\x6C\x69\x6E\x67\x20\x69\x6E\x20\x54\x4B\x5F\x57\x4F\x52\x44\x2E\x20"\
-	"\x4E\x6F\x77\x20\x77\x65\x20\x6E\x65\x65\x64\x20\x74\x6F\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x74\x68\x65\x20\x66\x61\x76\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65"\
-	"\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
-	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x20\x26\x26\x20\x66\x6C\x61"\
-	"\x67\x73\x2E\x69\x6E\x5F\x63\x61\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65"\
-	"\x6E\x28\x29\x3B\x20\x2F\x2F\x20\x63\x6F\x6C\x6F\x6E\x20\x72\x65\x61\x6C\x6C\x79"\
-	"\x20\x61\x73\x6B\x73\x20\x66\x6F\x72\x20\x73\x65\x70\x61\x72\x61\x74\x65\x20\x74"\
-	"\x72\x65\x61\x74\x6D\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
-	"\x61\x67\x73\x2E\x69\x6E\x5F\x63\x61\x73\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E"\
-	"\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x3A\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6E\x6F\x20"\
-	"\x73\x70\x61\x63\x65\x73\x20\x61\x72\x6F\x75\x6E\x64\x20\x65\x78\x6F\x74\x69\x63"\
-	"\x20\x6E\x61\x6D\x65\x73\x70\x61\x63\x69\x6E\x67\x20\x73\x79\x6E\x74\x61\x78\x20"\
-	"\x6F\x70\x65\x72\x61\x74\x6F\x72\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
-	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F"\
-	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67"\
-	"\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x6C"\
-	"\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x76\x61\x72\x5F\x6C\x69"\
-	"\x6E\x65\x5F\x74\x61\x69\x6E\x74\x65\x64\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F"\
+	"\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44\x27\x20\x26"\
+	"\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
+	"\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x29\x20\x7B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74"\
-	"\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69"\
-	"\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
-	"\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B"\
-	"\x5F\x45\x4E\x44\x5F\x42\x4C\x4F\x43\x4B\x27\x20\x26\x26\x20\x66\x6C\x61\x67\x73"\
-	"\x2E\x6D\x6F\x64\x65\x20\x21\x3D\x3D\x20\x22\x28\x45\x58\x50\x52\x45\x53\x53\x49"\
-	"\x4F\x4E\x29\x22\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D"\
-	"\x3D\x20\x27\x4F\x42\x4A\x45\x43\x54\x27\x20\x26\x26\x20\x6C\x61\x73\x74\x5F\x74"\
-	"\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
-	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C"\
-	"\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x4F\x42"\
-	"\x4A\x45\x43\x54\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74"\
-	"\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65"\
-	"\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x74\x72\x75\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x42\x4C\x4F\x43"\
+	"\x4B\x27\x20\x26\x26\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D"\
+	"\x20\x27\x7B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D"\
+	"\x3D\x20\x27\x3B\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7B\x20\x66\x6F\x6F\x3B\x20"\
+	"\x2D\x2D\x69\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6F\x6F\x28\x29\x3B\x20\x2D\x2D\x62\x61"\
+	"\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
+	"\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x64\x65\x63\x69\x6D\x61\x6C\x20\x64\x69\x67\x69\x74\x73\x20\x6F\x72\x20"\
+	"\x6F\x62\x6A\x65\x63\x74\x2E\x70\x72\x6F\x70\x65\x72\x74\x79\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63\x65\x5F\x62\x65"\
+	"\x66\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F"\
+	"\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x66\x6C\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F\x64\x65\x70\x74\x68\x20"\
+	"\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D"\
+	"\x20\x27\x4F\x42\x4A\x45\x43\x54\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63\x65\x5F\x62\x65\x66"\
+	"\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C"\
+	"\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F\x64\x65\x70\x74\x68\x20\x2D\x3D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20"\
+	"\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F\x64\x65\x70"\
+	"\x74\x68\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
+	"\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E"\
+	"\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x70\x61\x63\x65\x5F\x61\x66"\
+	"\x74\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63"\
+	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65"\
+	"\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6C\x61"\
+	"\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x42\x4C"\
+	"\x4F\x43\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6C\x69\x6E\x65\x73\x20\x3D\x20\x74"\
+	"\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2E\x73\x70\x6C\x69\x74\x28\x2F\x5C\x78\x30"\
+	"\x61\x7C\x5C\x78\x30\x64\x5C\x78\x30\x61\x2F\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6C\x6C\x5F\x6C\x69\x6E\x65\x73"\
+	"\x5F\x73\x74\x61\x72\x74\x5F\x77\x69\x74\x68\x28\x6C\x69\x6E\x65\x73\x2E\x73\x6C"\
+	"\x69\x63\x65\x28\x31\x29\x2C\x20\x27\x2A\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6A\x61\x76\x61\x64"\
+	"\x6F\x63\x3A\x20\x72\x65\x66\x6F\x72\x6D\x61\x74\x20\x61\x6E\x64\x20\x72\x65\x69"\
+	"\x6E\x64\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75"\
+	"\x74\x2E\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x73\x5B\x30\x5D\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69"\
+	"\x20\x3D\x20\x31\x3B\x20\x69\x20\x3C\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67"\
+	"\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77"\
+	"\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28"\
+	"\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x74\x72"\
+	"\x69\x6D\x28\x6C\x69\x6E\x65\x73\x5B\x69\x5D\x29\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x69\x6D\x70\x6C"\
+	"\x65\x20\x62\x6C\x6F\x63\x6B\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x3A\x20\x6C\x65\x61"\
+	"\x76\x65\x20\x69\x6E\x74\x61\x63\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67"\
+	"\x74\x68\x20\x3E\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6D\x75\x6C\x74\x69\x6C\x69"\
+	"\x6E\x65\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x62\x6C\x6F\x63\x6B\x20\x73\x74\x61"\
+	"\x72\x74\x73\x20\x77\x69\x74\x68\x20\x61\x20\x6E\x65\x77\x20\x6C\x69\x6E\x65\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x45\x58\x50\x52\x20\x6F\x72\x20\x44\x4F\x5F\x42\x4C\x4F\x43"\
-	"\x4B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70"\
-	"\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x6E\x5F\x61"\
-	"\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x5B\x27\x2D"\
-	"\x2D\x27\x2C\x20\x27\x2B\x2B\x27\x2C\x20\x27\x21\x27\x5D\x29\x20\x7C\x7C\x20\x28"\
-	"\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2C"\
-	"\x20\x5B\x27\x2D\x27\x2C\x20\x27\x2B\x27\x5D\x29\x20\x26\x26\x20\x28\x69\x6E\x5F"\
-	"\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74\x79\x70\x65\x2C\x20\x5B\x27\x54"\
-	"\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43\x4B\x27\x2C\x20\x27\x54\x4B\x5F"\
-	"\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x2C\x20\x27\x54\x4B\x5F\x45\x51\x55"\
-	"\x41\x4C\x53\x27\x5D\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C"\
-	"\x61\x73\x74\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74"\
-	"\x65\x72\x73\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73"\
-	"\x74\x5F\x74\x65\x78\x74\x2C\x20\x5B\x27\x3D\x3D\x27\x2C\x20\x27\x21\x3D\x27\x2C"\
-	"\x20\x27\x2B\x3D\x27\x2C\x20\x27\x2D\x3D\x27\x2C\x20\x27\x2A\x3D\x27\x2C\x20\x27"\
-	"\x2F\x3D\x27\x2C\x20\x27\x2B\x27\x2C\x20\x27\x2D\x27\x5D\x29\x29\x29\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x69\x66\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B\x65\x6E\x5F\x74"\
-	"\x65\x78\x74\x2C\x20\x5B\x27\x2D\x2D\x27\x2C\x20\x27\x2B\x2B\x27\x2C\x20\x27\x21"\
-	"\x27\x5D\x29\x20\x7C\x7C\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x74\x6F\x6B"\
-	"\x65\x6E\x5F\x74\x65\x78\x74\x2C\x20\x5B\x27\x2D\x27\x2C\x20\x27\x2B\x27\x5D\x29"\
-	"\x20\x26\x26\x20\x28\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x79\x70\x65\x2C\x20\x5B\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x42\x4C\x4F\x43"\
-	"\x4B\x27\x2C\x20\x27\x54\x4B\x5F\x53\x54\x41\x52\x54\x5F\x45\x58\x50\x52\x27\x2C"\
-	"\x20\x27\x54\x4B\x5F\x45\x51\x55\x41\x4C\x53\x27\x2C\x20\x27\x54\x4B\x5F\x4F\x50"\
-	"\x45\x52\x41\x54\x4F\x52\x27\x5D\x29\x20\x7C\x7C\x20\x69\x6E\x5F\x61\x72\x72\x61"\
-	"\x79\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74"\
-	"\x61\x72\x74\x65\x72\x73\x29\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x75\x6E\x61\x72\x79\x20\x6F\x70"\
-	"\x65\x72\x61\x74\x6F\x72\x73\x20\x28\x61\x6E\x64\x20\x62\x69\x6E\x61\x72\x79\x20"\
-	"\x2B\x2F\x2D\x20\x70\x72\x65\x74\x65\x6E\x64\x69\x6E\x67\x20\x74\x6F\x20\x62\x65"\
-	"\x20\x75\x6E\x61\x72\x79\x29\x20\x73\x70\x65\x63\x69\x61\x6C\x20\x63\x61\x73\x65"\
-	"\x73\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61"\
-	"\x63\x65\x5F\x61\x66\x74\x65\x72\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
-	"\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x20\x26\x26\x20"\
-	"\x69\x73\x5F\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E"\
-	"\x6D\x6F\x64\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6F\x72\x20\x28\x3B\x3B\x20"\
-	"\x2B\x2B\x69\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x20\x20\x5E\x5E\x5E\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61"\
-	"\x73\x74\x5F\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x54\x4B\x5F\x57\x4F\x52\x44"\
-	"\x27\x20\x26\x26\x20\x69\x6E\x5F\x61\x72\x72\x61\x79\x28\x6C\x61\x73\x74\x5F\x74"\
-	"\x65\x78\x74\x2C\x20\x6C\x69\x6E\x65\x5F\x73\x74\x61\x72\x74\x65\x72\x73\x29\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x74\x72"\
-	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x20\x3D\x3D\x3D\x20\x27\x42"\
-	"\x4C\x4F\x43\x4B\x27\x20\x26\x26\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20"\
-	"\x3D\x3D\x3D\x20\x27\x7B\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74"\
-	"\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x7B\x20\x66\x6F"\
-	"\x6F\x3B\x20\x2D\x2D\x69\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x66\x6F\x6F\x28\x29\x3B\x20\x2D"\
-	"\x2D\x62\x61\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x69"\
+	"\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x73\x69\x6E\x67\x6C\x65\x2D\x6C\x69\x6E\x65\x20\x2F\x2A\x20\x63\x6F\x6D\x6D\x65"\
+	"\x6E\x74\x20\x2A\x2F\x20\x73\x74\x61\x79\x73\x20\x77\x68\x65\x72\x65\x20\x69\x74"\
+	"\x20\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61"\
+	"\x63\x65\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x6C\x69"\
+	"\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F"\
+	"\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x73\x5B\x69\x5D\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x27\x5C\x6E\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x2F\x2F\x20\x64\x65\x63\x69\x6D\x61\x6C\x20\x64\x69\x67\x69\x74\x73\x20"\
-	"\x6F\x72\x20\x6F\x62\x6A\x65\x63\x74\x2E\x70\x72\x6F\x70\x65\x72\x74\x79\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63\x65"\
-	"\x5F\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
-	"\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x66\x6C\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F\x64\x65\x70"\
-	"\x74\x68\x20\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64"\
-	"\x65\x20\x3D\x20\x27\x4F\x42\x4A\x45\x43\x54\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x70\x61\x63\x65\x5F"\
-	"\x62\x65\x66\x6F\x72\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6C\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F\x64\x65\x70\x74\x68"\
-	"\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D"\
-	"\x3D\x3D\x20\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x6C\x61\x67\x73\x2E\x74\x65\x72\x6E\x61\x72\x79\x5F"\
-	"\x64\x65\x70\x74\x68\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x73\x70\x61\x63\x65\x5F\x62\x65\x66\x6F\x72\x65\x29\x20\x7B\x0A\x20\x20"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F"\
+	"\x49\x4E\x4C\x49\x4E\x45\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67"\
+	"\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x65\x78"\
+	"\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F\x64\x65\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6F\x72\x63\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x72\x69\x6E\x74\x5F\x6E"\
+	"\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C\x69\x6E\x65"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
 	"\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x70\x61\x63\x65"\
-	"\x5F\x61\x66\x74\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73"\
-	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
-	"\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
-	"\x66\x6C\x61\x67\x73\x2E\x65\x61\x74\x5F\x6E\x65\x78\x74\x5F\x73\x70\x61\x63\x65"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
-	"\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x54\x4B"\
-	"\x5F\x42\x4C\x4F\x43\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6C\x69\x6E\x65\x73\x20"\
-	"\x3D\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x2E\x73\x70\x6C\x69\x74\x28\x2F"\
-	"\x5C\x78\x30\x61\x7C\x5C\x78\x30\x64\x5C\x78\x30\x61\x2F\x29\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6C\x6C\x5F\x6C\x69"\
-	"\x6E\x65\x73\x5F\x73\x74\x61\x72\x74\x5F\x77\x69\x74\x68\x28\x6C\x69\x6E\x65\x73"\
-	"\x2E\x73\x6C\x69\x63\x65\x28\x31\x29\x2C\x20\x27\x2A\x27\x29\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6A\x61"\
-	"\x76\x61\x64\x6F\x63\x3A\x20\x72\x65\x66\x6F\x72\x6D\x61\x74\x20\x61\x6E\x64\x20"\
-	"\x72\x65\x69\x6E\x64\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75"\
-	"\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x73\x5B\x30\x5D\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
-	"\x20\x28\x69\x20\x3D\x20\x31\x3B\x20\x69\x20\x3C\x20\x6C\x69\x6E\x65\x73\x2E\x6C"\
-	"\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F"\
-	"\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75"\
-	"\x73\x68\x28\x27\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68"\
-	"\x28\x74\x72\x69\x6D\x28\x6C\x69\x6E\x65\x73\x5B\x69\x5D\x29\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x69"\
-	"\x6D\x70\x6C\x65\x20\x62\x6C\x6F\x63\x6B\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x3A\x20"\
-	"\x6C\x65\x61\x76\x65\x20\x69\x6E\x74\x61\x63\x74\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x69\x6E\x65\x73\x2E\x6C"\
-	"\x65\x6E\x67\x74\x68\x20\x3E\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x6D\x75\x6C\x74"\
-	"\x69\x6C\x69\x6E\x65\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x62\x6C\x6F\x63\x6B\x20"\
-	"\x73\x74\x61\x72\x74\x73\x20\x77\x69\x74\x68\x20\x61\x20\x6E\x65\x77\x20\x6C\x69"\
-	"\x6E\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x74\x72\x69\x6D\x5F\x6F\x75\x74\x70\x75\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x73\x69\x6E\x67\x6C\x65\x2D\x6C\x69\x6E\x65\x20\x2F\x2A\x20\x63\x6F"\
-	"\x6D\x6D\x65\x6E\x74\x20\x2A\x2F\x20\x73\x74\x61\x79\x73\x20\x77\x68\x65\x72\x65"\
-	"\x20\x69\x74\x20\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F"\
-	"\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C"\
-	"\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x73\x5B"\
-	"\x69\x5D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6F\x75\x74\x70\x75\x74\x2E\x70\x75\x73\x68\x28\x27\x5C\x6E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x63\x65\x5F\x6E\x65\x77\x6C\x69"\
 	"\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
 	"\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
-	"\x54\x4B\x5F\x49\x4E\x4C\x49\x4E\x45\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73"\
-	"\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73"\
-	"\x5F\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x66\x6C\x61\x67\x73\x2E\x6D\x6F"\
-	"\x64\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6F\x72\x63\x65\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x61\x73\x65\x20\x27\x54\x4B\x5F\x43\x4F\x4D\x4D\x45\x4E\x54\x27\x3A\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x70\x72\x69\x6E"\
-	"\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61\x6E\x74\x65\x64\x5F\x6E\x65\x77\x6C"\
-	"\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x6E\x65\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69"\
-	"\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x63\x65\x5F\x6E\x65"\
-	"\x77\x6C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
-	"\x65\x20\x27\x54\x4B\x5F\x55\x4E\x4B\x4E\x4F\x57\x4E\x27\x3A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78"\
-	"\x74\x20\x3D\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61"\
-	"\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x74\x68\x72\x6F\x77\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
-	"\x72\x69\x6E\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6C\x61\x73\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x6C\x61\x73"\
-	"\x74\x5F\x74\x65\x78\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74"\
-	"\x5F\x74\x79\x70\x65\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x79\x70\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20"\
-	"\x74\x6F\x6B\x65\x6E\x5F\x74\x65\x78\x74\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x73\x77\x65\x65\x74\x5F\x63\x6F\x64\x65\x20\x3D\x20"\
-	"\x70\x72\x65\x69\x6E\x64\x65\x6E\x74\x5F\x73\x74\x72\x69\x6E\x67\x20\x2B\x20\x6F"\
-	"\x75\x74\x70\x75\x74\x2E\x6A\x6F\x69\x6E\x28\x27\x27\x29\x2E\x72\x65\x70\x6C\x61"\
-	"\x63\x65\x28\x2F\x5B\x5C\x6E\x20\x5D\x2B\x24\x2F\x2C\x20\x27\x27\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x73\x77\x65\x65\x74\x5F\x63\x6F\x64\x65"\
-	"\x3B\x0A\x0A\x7D\x0A\x0A\x2F\x2F\x20\x41\x64\x64\x20\x73\x75\x70\x70\x6F\x72\x74"\
-	"\x20\x66\x6F\x72\x20\x43\x6F\x6D\x6D\x6F\x6E\x4A\x53\x2E\x20\x4A\x75\x73\x74\x20"\
-	"\x70\x75\x74\x20\x74\x68\x69\x73\x20\x66\x69\x6C\x65\x20\x73\x6F\x6D\x65\x77\x68"\
-	"\x65\x72\x65\x20\x6F\x6E\x20\x79\x6F\x75\x72\x20\x72\x65\x71\x75\x69\x72\x65\x2E"\
-	"\x70\x61\x74\x68\x73\x0A\x2F\x2F\x20\x61\x6E\x64\x20\x79\x6F\x75\x20\x77\x69\x6C"\
-	"\x6C\x20\x62\x65\x20\x61\x62\x6C\x65\x20\x74\x6F\x20\x60\x76\x61\x72\x20\x6A\x73"\
-	"\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x20\x3D\x20\x72\x65\x71\x75\x69\x72\x65\x28"\
-	"\x22\x62\x65\x61\x75\x74\x69\x66\x79\x22\x29\x2E\x6A\x73\x5F\x62\x65\x61\x75\x74"\
-	"\x69\x66\x79\x60\x2E\x0A\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x65\x78\x70"\
-	"\x6F\x72\x74\x73\x20\x21\x3D\x3D\x20\x22\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x22"\
-	"\x29\x0A\x20\x20\x20\x20\x65\x78\x70\x6F\x72\x74\x73\x2E\x6A\x73\x5F\x62\x65\x61"\
-	"\x75\x74\x69\x66\x79\x20\x3D\x20\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x3B"\
-	"\x0A\x0A\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20\x74"\
-	"\x72\x75\x65\x2C\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x20\x2A"\
-	"\x2F\x0A\x76\x61\x72\x20\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x2C\x20\x66"\
-	"\x6E\x61\x6D\x65\x2C\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x73\x2C\x20\x63\x6F\x64\x65\x2C\x20\x72\x65\x73\x75\x6C\x74\x3B\x0A\x0A"\
-	"\x73\x65\x74\x74\x69\x6E\x67\x73\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x27\x69\x6E"\
-	"\x64\x65\x6E\x74\x2D\x63\x68\x61\x72\x27\x3A\x20\x27\x63\x68\x61\x72\x61\x63\x74"\
-	"\x65\x72\x20\x74\x6F\x20\x69\x6E\x64\x65\x6E\x74\x20\x77\x69\x74\x68\x2C\x20\x63"\
-	"\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x61\x62\x20\x6F\x72\x20\x73\x70\x61\x63\x65"\
-	"\x20\x28\x64\x65\x66\x61\x75\x6C\x74\x20\x69\x73\x20\x73\x70\x61\x63\x65\x29\x27"\
-	"\x2C\x0A\x20\x20\x20\x20\x27\x69\x6E\x64\x65\x6E\x74\x2D\x73\x69\x7A\x65\x27\x3A"\
-	"\x20\x27\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x20\x73\x69\x7A\x65\x20\x28"\
-	"\x64\x65\x66\x61\x75\x6C\x74\x20\x69\x73\x20\x34\x29\x27\x0A\x7D\x3B\x0A\x0A\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x68\x65\x6C\x70\x28\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x6F\x70\x74\x2C\x20\x73\x74\x72\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x73\x61\x67\x65\x3A\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20"\
-	"\x20\x6A\x73\x62\x65\x61\x75\x74\x69\x66\x79\x20\x5B\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x5D\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"\
-	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x54\x68\x65\x20\x63\x6F\x6E\x74\x65\x6E"\
-	"\x74\x20\x6F\x66\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x20\x77\x69\x6C\x6C\x20\x62"\
-	"\x65\x20\x72\x65\x66\x6F\x72\x6D\x61\x74\x74\x65\x64\x20\x61\x6E\x64\x20\x72\x65"\
-	"\x69\x6E\x64\x65\x6E\x74\x65\x64\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x54\x68\x65\x20\x72\x65\x73\x75\x6C\x74"\
-	"\x20\x77\x69\x6C\x6C\x20\x62\x65\x20\x70\x72\x69\x6E\x74\x65\x64\x20\x74\x6F\x20"\
-	"\x73\x74\x61\x6E\x64\x61\x72\x64\x20\x6F\x75\x74\x70\x75\x74\x2E\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x47\x65\x6E\x65"\
-	"\x72\x61\x6C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x68"\
-	"\x65\x6C\x70\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x53\x68\x6F\x77\x20\x74\x68"\
-	"\x69\x73\x20\x68\x65\x6C\x70\x20\x73\x63\x72\x65\x65\x6E\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x46\x6F\x72\x6D\x61\x74"\
-	"\x74\x69\x6E\x67\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x66\x6F\x72\x20\x28\x6F\x70\x74\x20\x69\x6E\x20\x73\x65\x74\x74\x69\x6E\x67"\
-	"\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x74"\
-	"\x74\x69\x6E\x67\x73\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74\x79"\
-	"\x28\x6F\x70\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x74\x72\x20\x3D\x20\x27\x20\x20\x20\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70"\
-	"\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
-	"\x20\x28\x73\x74\x72\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x32\x30\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72"\
-	"\x20\x2B\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x2B"\
-	"\x3D\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x5B\x6F\x70\x74\x5D\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
-	"\x28\x73\x74\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x45"\
-	"\x78\x61\x6D\x70\x6C\x65\x20\x75\x73\x65\x20\x6F\x66\x20\x66\x6F\x72\x6D\x61\x74"\
-	"\x74\x69\x6E\x67\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x2D\x2D\x69"\
-	"\x6E\x64\x65\x6E\x74\x2D\x63\x68\x61\x72\x3D\x73\x70\x61\x63\x65\x20\x2D\x2D\x69"\
-	"\x6E\x64\x65\x6E\x74\x2D\x73\x69\x7A\x65\x2D\x32\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63"\
-	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x77\x68\x69\x63\x68\x20\x77\x6F"\
-	"\x75\x6C\x64\x20\x66\x6F\x72\x6D\x61\x74\x20\x74\x68\x65\x20\x63\x6F\x64\x65\x20"\
-	"\x61\x6E\x64\x20\x69\x6E\x64\x65\x6E\x74\x20\x77\x69\x74\x68\x20\x32\x20\x73\x70"\
-	"\x61\x63\x65\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
-	"\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x27\x46\x6F\x72\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x72\x6D"\
-	"\x61\x74\x69\x6F\x6E\x2C\x20\x67\x6F\x20\x74\x6F\x20\x68\x74\x74\x70\x3A\x2F\x2F"\
-	"\x6A\x73\x62\x65\x61\x75\x74\x69\x66\x69\x65\x72\x2E\x6F\x72\x67\x2E\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B"\
-	"\x0A\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73\x2E"\
-	"\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65"\
-	"\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x6F\x70\x74\x69\x6F\x6E\x73\x20\x3D\x20\x7B"\
-	"\x7D\x3B\x0A\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73\x2E\x66\x6F\x72\x45"\
-	"\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x61\x72\x67\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x20\x69\x2C\x20\x73\x74"\
-	"\x72\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x32"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E"\
-	"\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x20\x26\x26"\
-	"\x20\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31\x29\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67"\
-	"\x28\x32\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E"\
-	"\x20\x3D\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64"\
-	"\x65\x78\x4F\x66\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x3D\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x69\x20\x2B\x20"\
-	"\x31\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F"\
-	"\x6E\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67"\
-	"\x28\x30\x2C\x20\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x69\x6E\x64\x65\x6E\x74\x2D\x63\x68"\
-	"\x61\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x74\x61\x62\x27"\
-	"\x20\x7C\x7C\x20\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x74\x61\x62\x73\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61"\
-	"\x72\x20\x3D\x20\x27\x5C\x74\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x74\x72"\
-	"\x20\x3D\x3D\x3D\x20\x27\x73\x70\x61\x63\x65\x27\x20\x7C\x7C\x20\x73\x74\x72\x20"\
-	"\x3D\x3D\x3D\x20\x27\x73\x70\x61\x63\x65\x73\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20\x3D\x20\x27\x20"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x54\x4B\x5F\x55\x4E\x4B\x4E\x4F\x57\x4E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D"\
+	"\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x20\x7C\x7C\x20\x6C\x61\x73\x74\x5F"\
+	"\x74\x65\x78\x74\x20\x3D\x3D\x3D\x20\x27\x74\x68\x72\x6F\x77\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x69\x6E"\
+	"\x74\x5F\x73\x69\x6E\x67\x6C\x65\x5F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x70\x72\x69\x6E\x74\x5F\x74\x6F\x6B\x65\x6E\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73"\
+	"\x74\x5F\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x6C\x61\x73\x74\x5F\x74"\
+	"\x65\x78\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x74\x79"\
+	"\x70\x65\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x5F\x74\x79\x70\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6C\x61\x73\x74\x5F\x74\x65\x78\x74\x20\x3D\x20\x74\x6F\x6B"\
+	"\x65\x6E\x5F\x74\x65\x78\x74\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x2F\x2F\x20\x4F\x6E\x6C\x79\x20\x74\x68\x65\x20\x72\x65\x73\x74\x20\x6F\x66\x20"\
+	"\x74\x68\x65\x20\x6F\x75\x74\x70\x75\x74\x2C\x20\x69\x66\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x73\x2E\x63\x68\x65\x63\x6B\x20\x68\x61\x64\x20\x74\x68\x65\x20\x62\x65\x67"\
+	"\x69\x6E\x6E\x69\x6E\x67\x2E\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x73\x77\x65\x65"\
+	"\x74\x5F\x63\x6F\x64\x65\x20\x3D\x20\x6F\x75\x74\x70\x75\x74\x2E\x6A\x6F\x69\x6E"\
+	"\x28\x27\x27\x29\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5B\x5C\x6E\x20\x5D\x2B"\
+	"\x24\x2F\x2C\x20\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x21\x66\x6C"\
+	"\x75\x73\x68\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x65"\
+	"\x65\x74\x5F\x63\x6F\x64\x65\x20\x3D\x20\x70\x72\x65\x69\x6E\x64\x65\x6E\x74\x5F"\
+	"\x73\x74\x72\x69\x6E\x67\x20\x2B\x20\x73\x77\x65\x65\x74\x5F\x63\x6F\x64\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x6C"\
+	"\x75\x73\x68\x65\x64\x5F\x70\x61\x72\x74\x73\x2E\x6A\x6F\x69\x6E\x28\x27\x27\x29"\
+	"\x20\x2B\x20\x73\x77\x65\x65\x74\x5F\x63\x6F\x64\x65\x3B\x0A\x0A\x7D\x0A\x0A\x2F"\
+	"\x2F\x20\x41\x64\x64\x20\x73\x75\x70\x70\x6F\x72\x74\x20\x66\x6F\x72\x20\x43\x6F"\
+	"\x6D\x6D\x6F\x6E\x4A\x53\x2E\x20\x4A\x75\x73\x74\x20\x70\x75\x74\x20\x74\x68\x69"\
+	"\x73\x20\x66\x69\x6C\x65\x20\x73\x6F\x6D\x65\x77\x68\x65\x72\x65\x20\x6F\x6E\x20"\
+	"\x79\x6F\x75\x72\x20\x72\x65\x71\x75\x69\x72\x65\x2E\x70\x61\x74\x68\x73\x0A\x2F"\
+	"\x2F\x20\x61\x6E\x64\x20\x79\x6F\x75\x20\x77\x69\x6C\x6C\x20\x62\x65\x20\x61\x62"\
+	"\x6C\x65\x20\x74\x6F\x20\x60\x76\x61\x72\x20\x6A\x73\x5F\x62\x65\x61\x75\x74\x69"\
+	"\x66\x79\x20\x3D\x20\x72\x65\x71\x75\x69\x72\x65\x28\x22\x62\x65\x61\x75\x74\x69"\
+	"\x66\x79\x22\x29\x2E\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x60\x2E\x0A\x69"\
+	"\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x65\x78\x70\x6F\x72\x74\x73\x20\x21\x3D"\
+	"\x3D\x20\x22\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x22\x29\x0A\x20\x20\x20\x20\x65"\
+	"\x78\x70\x6F\x72\x74\x73\x2E\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x20\x3D"\
+	"\x20\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x3B\x0A\x0A\x2F\x2A\x67\x6C\x6F"\
+	"\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20\x74\x72\x75\x65\x2C\x20\x63\x6F"\
+	"\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x20\x2A\x2F\x0A\x76\x61\x72\x20\x6A"\
+	"\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x2C\x20\x66\x6E\x61\x6D\x65\x2C\x20\x73"\
+	"\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2C\x20\x63\x6F"\
+	"\x64\x65\x2C\x20\x72\x65\x73\x75\x6C\x74\x3B\x0A\x0A\x73\x65\x74\x74\x69\x6E\x67"\
+	"\x73\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x27\x69\x6E\x64\x65\x6E\x74\x2D\x63\x68"\
+	"\x61\x72\x27\x3A\x20\x27\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x74\x6F\x20\x69"\
+	"\x6E\x64\x65\x6E\x74\x20\x77\x69\x74\x68\x2C\x20\x63\x6F\x75\x6C\x64\x20\x62\x65"\
+	"\x20\x74\x61\x62\x20\x6F\x72\x20\x73\x70\x61\x63\x65\x20\x28\x64\x65\x66\x61\x75"\
+	"\x6C\x74\x20\x69\x73\x20\x73\x70\x61\x63\x65\x29\x27\x2C\x0A\x20\x20\x20\x20\x27"\
+	"\x69\x6E\x64\x65\x6E\x74\x2D\x73\x69\x7A\x65\x27\x3A\x20\x27\x69\x6E\x64\x65\x6E"\
+	"\x74\x61\x74\x69\x6F\x6E\x20\x73\x69\x7A\x65\x20\x28\x64\x65\x66\x61\x75\x6C\x74"\
+	"\x20\x69\x73\x20\x34\x29\x27\x0A\x7D\x3B\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x68\x65\x6C\x70\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73"\
+	"\x74\x72\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x2C"\
+	"\x20\x73\x74\x72\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x27\x55\x73\x61\x67\x65\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x6A\x73\x62\x65\x61\x75"\
+	"\x74\x69\x66\x79\x20\x5B\x6F\x70\x74\x69\x6F\x6E\x73\x5D\x20\x66\x69\x6C\x65\x6E"\
+	"\x61\x6D\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x27\x54\x68\x65\x20\x63\x6F\x6E\x74\x65\x6E\x74\x20\x6F\x66\x20\x66\x69"\
+	"\x6C\x65\x6E\x61\x6D\x65\x20\x77\x69\x6C\x6C\x20\x62\x65\x20\x72\x65\x66\x6F\x72"\
+	"\x6D\x61\x74\x74\x65\x64\x20\x61\x6E\x64\x20\x72\x65\x69\x6E\x64\x65\x6E\x74\x65"\
+	"\x64\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x27\x54\x68\x65\x20\x72\x65\x73\x75\x6C\x74\x20\x77\x69\x6C\x6C\x20\x62"\
+	"\x65\x20\x70\x72\x69\x6E\x74\x65\x64\x20\x74\x6F\x20\x73\x74\x61\x6E\x64\x61\x72"\
+	"\x64\x20\x6F\x75\x74\x70\x75\x74\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x47\x65\x6E\x65\x72\x61\x6C\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
+	"\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x68\x65\x6C\x70\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x53\x68\x6F\x77\x20\x74\x68\x69\x73\x20\x68\x65\x6C\x70"\
+	"\x20\x73\x63\x72\x65\x65\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
+	"\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x63\x68\x65\x63\x6B\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x6E\x6C\x79\x20\x63\x68\x65\x63\x6B\x20\x74"\
+	"\x68\x61\x74\x20\x74\x68\x65\x20\x66\x69\x6C\x65\x20\x69\x73\x20\x66\x6F\x72\x6D"\
+	"\x61\x74\x74\x65\x64\x20\x61\x6C\x72\x65\x61\x64\x79\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x46\x6F\x72\x6D\x61\x74\x74"\
+	"\x69\x6E\x67\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x66\x6F\x72\x20\x28\x6F\x70\x74\x20\x69\x6E\x20\x73\x65\x74\x74\x69\x6E\x67\x73"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x74\x74"\
+	"\x69\x6E\x67\x73\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74\x79\x28"\
+	"\x6F\x70\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x74\x72\x20\x3D\x20\x27\x20\x20\x20\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20"\
+	"\x28\x73\x74\x72\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x32\x30\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20"\
+	"\x2B\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x2B\x3D"\
+	"\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x5B\x6F\x70\x74\x5D\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
-	"\x27\x49\x6E\x76\x61\x6C\x69\x64\x20\x76\x61\x6C\x75\x65\x20\x66\x6F\x72\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x20\x2D\x2D\x69\x6E\x64\x65\x6E\x74\x2D\x63\x68\x61\x72\x2E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x74\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x45\x78"\
+	"\x61\x6D\x70\x6C\x65\x20\x75\x73\x65\x20\x6F\x66\x20\x66\x6F\x72\x6D\x61\x74\x74"\
+	"\x69\x6E\x67\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x2D\x2D\x69\x6E"\
+	"\x64\x65\x6E\x74\x2D\x63\x68\x61\x72\x3D\x73\x70\x61\x63\x65\x20\x2D\x2D\x69\x6E"\
+	"\x64\x65\x6E\x74\x2D\x73\x69\x7A\x65\x2D\x32\x27\x29\x3B\x0A\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"\
+	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x77\x68\x69\x63\x68\x20\x77\x6F\x75"\
+	"\x6C\x64\x20\x66\x6F\x72\x6D\x61\x74\x20\x74\x68\x65\x20\x63\x6F\x64\x65\x20\x61"\
+	"\x6E\x64\x20\x69\x6E\x64\x65\x6E\x74\x20\x77\x69\x74\x68\x20\x32\x20\x73\x70\x61"\
+	"\x63\x65\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
+	"\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x27\x46\x6F\x72\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x72\x6D\x61"\
+	"\x74\x69\x6F\x6E\x2C\x20\x67\x6F\x20\x74\x6F\x20\x68\x74\x74\x70\x3A\x2F\x2F\x6A"\
+	"\x73\x62\x65\x61\x75\x74\x69\x66\x69\x65\x72\x2E\x6F\x72\x67\x2E\x27\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20"\
-	"\x27\x69\x6E\x64\x65\x6E\x74\x2D\x73\x69\x7A\x65\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A\x65\x20\x3D\x20\x70\x61\x72\x73\x65"\
-	"\x49\x6E\x74\x28\x73\x74\x72\x2C\x20\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x6E"\
-	"\x6B\x6E\x6F\x77\x6E\x20\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x2D\x2D\x27\x20\x2B\x20"\
-	"\x6F\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x52\x75\x6E\x20\x6A\x73"\
-	"\x62\x65\x61\x75\x74\x69\x66\x79\x20\x2D\x2D\x68\x65\x6C\x70\x20\x74\x6F\x20\x6C"\
-	"\x69\x73\x74\x20\x61\x6C\x6C\x20\x70\x6F\x73\x73\x69\x62\x6C\x65\x20\x6F\x70\x74"\
-	"\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A"\
+	"\x7D\x0A\x0A\x2F\x2F\x20\x57\x69\x74\x68\x20\x2D\x2D\x63\x68\x65\x63\x6B\x2C\x20"\
+	"\x74\x68\x65\x20\x66\x69\x6C\x65\x20\x61\x73\x20\x69\x74\x20\x69\x73\x20\x61\x6E"\
+	"\x64\x20\x68\x6F\x77\x20\x6D\x75\x63\x68\x20\x6F\x66\x20\x69\x74\x20\x74\x68\x65"\
+	"\x20\x6F\x75\x74\x70\x75\x74\x20\x68\x61\x73\x0A\x2F\x2F\x20\x6D\x61\x74\x63\x68"\
+	"\x65\x64\x20\x73\x6F\x20\x66\x61\x72\x2E\x20\x54\x68\x69\x73\x20\x61\x6E\x64\x20"\
+	"\x74\x68\x65\x20\x74\x77\x6F\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x62\x65"\
+	"\x6C\x6F\x77\x20\x61\x72\x65\x20\x74\x68\x65\x20\x73\x61\x6D\x65\x20\x69\x6E\x0A"\
+	"\x2F\x2F\x20\x6A\x73\x62\x65\x61\x75\x74\x69\x66\x79\x2F\x43\x6F\x6D\x6D\x61\x6E"\
+	"\x64\x4C\x69\x6E\x65\x2E\x6A\x73\x20\x61\x6E\x64\x20\x63\x73\x73\x62\x65\x61\x75"\
+	"\x74\x69\x66\x79\x2F\x43\x6F\x6D\x6D\x61\x6E\x64\x4C\x69\x6E\x65\x2E\x6A\x73\x20"\
+	"\x6F\x6E\x20\x70\x75\x72\x70\x6F\x73\x65\x3A\x0A\x2F\x2F\x20\x65\x61\x63\x68\x20"\
+	"\x74\x6F\x6F\x6C\x20\x73\x63\x72\x69\x70\x74\x20\x69\x73\x20\x70\x61\x63\x6B\x65"\
+	"\x64\x20\x6F\x6E\x20\x69\x74\x73\x20\x6F\x77\x6E\x2C\x20\x73\x6F\x20\x74\x68\x65"\
+	"\x72\x65\x20\x69\x73\x20\x6E\x6F\x77\x68\x65\x72\x65\x20\x74\x6F\x20\x73\x68\x61"\
+	"\x72\x65\x0A\x2F\x2F\x20\x74\x68\x65\x6D\x2E\x20\x43\x68\x61\x6E\x67\x65\x20\x62"\
+	"\x6F\x74\x68\x20\x74\x6F\x67\x65\x74\x68\x65\x72\x2E\x0A\x76\x61\x72\x20\x65\x78"\
+	"\x70\x65\x63\x74\x65\x64\x2C\x20\x63\x68\x65\x63\x6B\x65\x64\x20\x3D\x20\x30\x3B"\
+	"\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x70\x6F\x72\x74\x5F\x64\x69"\
+	"\x66\x66\x65\x72\x65\x6E\x63\x65\x28\x74\x65\x78\x74\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76"\
+	"\x61\x72\x20\x69\x20\x3D\x20\x30\x2C\x20\x6C\x69\x6E\x65\x20\x3D\x20\x31\x2C\x20"\
+	"\x73\x74\x61\x72\x74\x20\x3D\x20\x30\x2C\x20\x6E\x65\x78\x74\x3B\x0A\x20\x20\x20"\
+	"\x20\x77\x68\x69\x6C\x65\x20\x28\x69\x20\x3C\x20\x74\x65\x78\x74\x2E\x6C\x65\x6E"\
+	"\x67\x74\x68\x20\x26\x26\x20\x74\x65\x78\x74\x2E\x63\x68\x61\x72\x41\x74\x28\x69"\
+	"\x29\x20\x3D\x3D\x3D\x20\x65\x78\x70\x65\x63\x74\x65\x64\x2E\x63\x68\x61\x72\x41"\
+	"\x74\x28\x63\x68\x65\x63\x6B\x65\x64\x20\x2B\x20\x69\x29\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x69\x20\x2B\x3D\x20\x63\x68\x65\x63\x6B\x65\x64\x3B\x0A\x20\x20"\
+	"\x20\x20\x6E\x65\x78\x74\x20\x3D\x20\x65\x78\x70\x65\x63\x74\x65\x64\x2E\x69\x6E"\
+	"\x64\x65\x78\x4F\x66\x28\x27\x5C\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x77\x68\x69"\
+	"\x6C\x65\x20\x28\x6E\x65\x78\x74\x20\x3E\x3D\x20\x30\x20\x26\x26\x20\x6E\x65\x78"\
+	"\x74\x20\x3C\x20\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E"\
+	"\x65\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72"\
+	"\x74\x20\x3D\x20\x6E\x65\x78\x74\x20\x2B\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x65\x78\x74\x20\x3D\x20\x65\x78\x70\x65\x63\x74\x65\x64\x2E\x69\x6E"\
+	"\x64\x65\x78\x4F\x66\x28\x27\x5C\x6E\x27\x2C\x20\x73\x74\x61\x72\x74\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x66\x6E\x61\x6D\x65\x20\x2B\x20\x27\x3A\x20\x6E\x6F\x74\x20\x66\x6F\x72"\
+	"\x6D\x61\x74\x74\x65\x64\x2C\x20\x66\x69\x72\x73\x74\x20\x64\x69\x66\x66\x65\x72"\
+	"\x65\x6E\x63\x65\x20\x61\x74\x20\x6C\x69\x6E\x65\x27\x2C\x20\x6C\x69\x6E\x65\x2C"\
+	"\x20\x27\x63\x6F\x6C\x75\x6D\x6E\x27\x2C\x20\x69\x20\x2D\x20\x73\x74\x61\x72\x74"\
+	"\x20\x2B\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78"\
+	"\x69\x74\x28\x31\x29\x3B\x0A\x7D\x0A\x0A\x2F\x2F\x20\x43\x6F\x6D\x70\x61\x72\x65"\
+	"\x73\x20\x74\x68\x65\x20\x6F\x75\x74\x70\x75\x74\x2C\x20\x70\x69\x65\x63\x65\x20"\
+	"\x62\x79\x20\x70\x69\x65\x63\x65\x20\x61\x73\x20\x74\x68\x65\x20\x62\x65\x61\x75"\
+	"\x74\x69\x66\x69\x65\x72\x20\x68\x61\x6E\x64\x73\x20\x69\x74\x20\x6F\x76\x65\x72"\
+	"\x2C\x0A\x2F\x2F\x20\x77\x69\x74\x68\x20\x74\x68\x65\x20\x66\x69\x6C\x65\x20\x61"\
+	"\x6E\x64\x20\x73\x74\x6F\x70\x73\x20\x61\x74\x20\x74\x68\x65\x20\x66\x69\x72\x73"\
+	"\x74\x20\x64\x69\x66\x66\x65\x72\x65\x6E\x63\x65\x2E\x0A\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x63\x68\x65\x63\x6B\x5F\x6F\x75\x74\x70\x75\x74\x28\x74\x65\x78\x74"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27"\
+	"\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x65\x78\x70\x65\x63\x74\x65\x64\x2E\x73"\
+	"\x75\x62\x73\x74\x72\x28\x63\x68\x65\x63\x6B\x65\x64\x2C\x20\x74\x65\x78\x74\x2E"\
+	"\x6C\x65\x6E\x67\x74\x68\x29\x20\x21\x3D\x3D\x20\x74\x65\x78\x74\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x70\x6F\x72\x74\x5F\x64\x69\x66\x66\x65"\
+	"\x72\x65\x6E\x63\x65\x28\x74\x65\x78\x74\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x63\x68\x65\x63\x6B\x65\x64\x20\x2B\x3D\x20\x74\x65\x78\x74\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x3B\x0A\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D"\
+	"\x2E\x61\x72\x67\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x6F\x70\x74\x69\x6F"\
+	"\x6E\x73\x20\x3D\x20\x7B\x7D\x3B\x0A\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67"\
+	"\x73\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x61\x72\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69"\
+	"\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E\x2C"\
+	"\x20\x69\x2C\x20\x73\x74\x72\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61\x6C"\
+	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E\x67"\
+	"\x74\x68\x20\x3E\x20\x32\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20"\
+	"\x27\x2D\x27\x20\x26\x26\x20\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31\x29"\
+	"\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75\x62"\
+	"\x73\x74\x72\x69\x6E\x67\x28\x32\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65\x6C"\
+	"\x70\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x63\x68\x65\x63\x6B\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x73\x2E\x63\x68\x65\x63\x6B\x20\x3D\x20\x63\x68\x65\x63\x6B\x5F\x6F\x75\x74\x70"\
+	"\x75\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x27\x3D\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3E\x3D"\
+	"\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x73\x74\x72\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74"\
+	"\x72\x69\x6E\x67\x28\x69\x20\x2B\x20\x31\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E"\
+	"\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x30\x2C\x20\x69\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27"\
+	"\x69\x6E\x64\x65\x6E\x74\x2D\x63\x68\x61\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x20"\
+	"\x3D\x3D\x3D\x20\x27\x74\x61\x62\x27\x20\x7C\x7C\x20\x73\x74\x72\x20\x3D\x3D\x3D"\
+	"\x20\x27\x74\x61\x62\x73\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x5F\x63\x68\x61\x72\x20\x3D\x20\x27\x5C\x74\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x69\x66\x20\x28\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x73\x70\x61\x63\x65"\
+	"\x27\x20\x7C\x7C\x20\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x73\x70\x61\x63\x65\x73"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F"\
+	"\x63\x68\x61\x72\x20\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x49\x6E\x76\x61\x6C\x69\x64\x20\x76\x61"\
+	"\x6C\x75\x65\x20\x66\x6F\x72\x20\x6F\x70\x74\x69\x6F\x6E\x20\x2D\x2D\x69\x6E\x64"\
+	"\x65\x6E\x74\x2D\x63\x68\x61\x72\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
+	"\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28"\
-	"\x2D\x31\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61"\
-	"\x6D\x65\x20\x21\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
-	"\x67\x28\x27\x50\x6C\x65\x61\x73\x65\x20\x6F\x6E\x6C\x79\x20\x73\x70\x65\x63\x69"\
-	"\x66\x79\x20\x6F\x6E\x65\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78"\
-	"\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E"\
-	"\x61\x6D\x65\x20\x3D\x20\x61\x72\x67\x3B\x0A\x7D\x29\x3B\x0A\x0A\x69\x66\x20\x28"\
-	"\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C\x70"\
-	"\x28\x29\x3B\x0A\x7D\x0A\x0A\x74\x72\x79\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x64"\
-	"\x65\x20\x3D\x20\x73\x79\x73\x74\x65\x6D\x2E\x72\x65\x61\x64\x46\x69\x6C\x65\x28"\
-	"\x66\x6E\x61\x6D\x65\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D"\
-	"\x20\x6A\x73\x5F\x62\x65\x61\x75\x74\x69\x66\x79\x28\x63\x6F\x64\x65\x2C\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x73\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
-	"\x2E\x6C\x6F\x67\x28\x72\x65\x73\x75\x6C\x74\x29\x3B\x0A\x7D\x20\x63\x61\x74\x63"\
-	"\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x65\x29\x3B\x0A\x7D\x0A";
\ No newline at end of file
+	"\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x69\x6E\x64\x65\x6E\x74\x2D\x73\x69\x7A"\
+	"\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x69\x6E\x64\x65\x6E\x74\x5F\x73\x69\x7A"\
+	"\x65\x20\x3D\x20\x70\x61\x72\x73\x65\x49\x6E\x74\x28\x73\x74\x72\x2C\x20\x31\x30"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C"\
+	"\x65\x2E\x6C\x6F\x67\x28\x27\x55\x6E\x6B\x6E\x6F\x77\x6E\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x3A\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x27\x52\x75\x6E\x20\x6A\x73\x62\x65\x61\x75\x74\x69\x66\x79\x20\x2D\x2D"\
+	"\x68\x65\x6C\x70\x20\x74\x6F\x20\x6C\x69\x73\x74\x20\x61\x6C\x6C\x20\x70\x6F\x73"\
+	"\x73\x69\x62\x6C\x65\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
+	"\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73"\
+	"\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
+	"\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x21\x3D\x3D\x20\x27\x75\x6E\x64"\
+	"\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x50\x6C\x65\x61\x73\x65\x20\x6F"\
+	"\x6E\x6C\x79\x20\x73\x70\x65\x63\x69\x66\x79\x20\x6F\x6E\x65\x20\x66\x69\x6C\x65"\
+	"\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E\x61\x6D\x65\x20\x3D\x20\x61\x72\x67\x3B\x0A"\
+	"\x7D\x29\x3B\x0A\x0A\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D"\
+	"\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x74\x72\x79\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x63\x6F\x64\x65\x20\x3D\x20\x73\x79\x73\x74\x65\x6D\x2E"\
+	"\x72\x65\x61\x64\x46\x69\x6C\x65\x28\x66\x6E\x61\x6D\x65\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x63\x68\x65\x63\x6B\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x73\x79\x73\x74\x65\x6D\x2E"\
+	"\x72\x65\x61\x64\x46\x69\x6C\x65\x28\x29\x20\x65\x6E\x64\x73\x20\x74\x68\x65\x20"\
+	"\x74\x65\x78\x74\x20\x77\x69\x74\x68\x20\x61\x20\x6E\x65\x77\x6C\x69\x6E\x65\x20"\
+	"\x6F\x66\x20\x69\x74\x73\x20\x6F\x77\x6E\x2C\x20\x74\x68\x65\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x2F\x2F\x20\x6F\x6E\x65\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x29\x20\x77\x6F\x75\x6C\x64\x20\x70\x72\x69\x6E\x74\x2E\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x65\x78\x70\x65\x63\x74\x65\x64\x20\x3D\x20\x63\x6F\x64"\
+	"\x65\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x30\x2C\x20\x63\x6F\x64\x65\x2E"\
+	"\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x6A\x73\x5F\x62\x65\x61\x75\x74"\
+	"\x69\x66\x79\x28\x63\x6F\x64\x65\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x63\x68\x65\x63"\
+	"\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x65\x63\x6B\x5F\x6F"\
+	"\x75\x74\x70\x75\x74\x28\x72\x65\x73\x75\x6C\x74\x20\x2B\x20\x27\x5C\x6E\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x68\x65\x63\x6B\x65"\
+	"\x64\x20\x21\x3D\x3D\x20\x65\x78\x70\x65\x63\x74\x65\x64\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x70"\
+	"\x6F\x72\x74\x5F\x64\x69\x66\x66\x65\x72\x65\x6E\x63\x65\x28\x27\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x72\x65\x73\x75\x6C\x74\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D\x20"\
+	"\x63\x61\x74\x63\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x65\x29\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x63\x68\x65\x63\x6B\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D\x0A";
\ No newline at end of file
@@ -20,6 +20,7 @@ var settings = {
     'latedef': ' true if the use before definition should not be tolerated',
     'laxbreak': ' true if line breaks should not be checked',
     'loopfunc': ' true if functions should be allowed to be defined within loops',
+    'maxerr': ' the maximum number of warnings reported (default is 50)',
     'mootools': ' true if MooTools globals should be predefined',
     'newcap': ' true if constructor names must be capitalized',
     'noarg': ' true if arguments.caller and arguments.callee should be disallowed',
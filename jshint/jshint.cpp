@@ -23,11 +23,11 @@
 
 #include "jshint_script.h"
 
-extern void eightpack_run(int argc, char** argv, const char* cmd);
+extern void eightpack_run(int argc, char** argv, const char* cmd, const char* tool);
 
 int main(int argc, char* argv[])
 {
-    eightpack_run(argc, argv, jshint_script);
+    eightpack_run(argc, argv, jshint_script, "jshint");
     return 0;
 }
 
@@ -183,7 +183,7 @@
  asi, b, bitwise, block, blur, boolOptions, boss, browser, c, call, callee,
  caller, cases, charAt, charCodeAt, character, clearInterval, clearTimeout,
  close, closed, closure, comment, condition, confirm, console, constructor,
- content, couch, create, css, curly, d, data, datalist, dd, debug, decodeURI,
+ content, couch, count, create, css, curly, d, data, datalist, dd, debug, decodeURI,
  decodeURIComponent, defaultStatus, defineClass, deserialize, devel, document,
  dojo, dijit, dojox, define, edition, else, emit, encodeURI, encodeURIComponent,
  entityify, eqeqeq, eqnull, errors, es5, escape, eval, event, evidence, evil,
@@ -197,20 +197,20 @@
  latedef, lbp, led, left, length, line, load, loadClass, localStorage, location,
  log, loopfunc, m, match, maxerr, maxlen, member,message, meta, module, moveBy,
  moveTo, mootools, name, navigator, new, newcap, noarg, node, noempty, nomen,
- nonew, nud, onbeforeunload, onblur, onerror, onevar, onfocus, onload, onresize,
+ nonew, now, nud, onbeforeunload, onblur, onerror, onevar, onfocus, onload, onresize,
  onunload, open, openDatabase, openURL, opener, opera, outer, param, parent,
  parseFloat, parseInt, passfail, plusplus, predef, print, process, prompt,
  prototype, prototypejs, push, quit, range, raw, reach, reason, regexp,
  readFile, readUrl, regexdash, removeEventListener, replace, report, require,
  reserved, resizeBy, resizeTo, resolvePath, resumeUpdates, respond, rhino, right,
- runCommand, scroll, screen, scripturl, scrollBy, scrollTo, scrollbar, search, seal, send,
+ rules, runCommand, scroll, screen, scripturl, scrollBy, scrollTo, scrollbar, search, seal, send,
  serialize, setInterval, setTimeout, shift, slice, sort,spawn, split, stack,
  status, start, strict, sub, substr, supernew, shadow, supplant, sum, sync,
- test, toLowerCase, toString, toUpperCase, toint32, token, top, trailing, type,
+ test, time, toLowerCase, toString, toUpperCase, toint32, token, top, trailing, type,
  typeOf, Uint16Array, Uint32Array, Uint8Array, undef, unused, urls, value, valueOf,
  var, version, WebSocket, white, window, Worker, wsh*/
 
-/*global exports: false */
+/*global exports: false, system: false */
 
 // We build the application inside a function so that we produce only a single
 // global variable. That function will be invoked immediately, and its return
@@ -659,6 +659,38 @@ var JSHINT = (function () {
         return Object.prototype.hasOwnProperty.call(object, name);
     }
 
+
+// Cost accounting for the --rule-stats option of the command line runner,
+// which provides system.rules and a clock. Time is exclusive: what a nested
+// measurement takes is not charged to the enclosing one as well.
+
+    var rules = typeof system !== 'undefined' && system.rules,
+        clock = rules && system.now,
+        cost_outer = [],
+        cost_inner = 0;
+
+    function cost_begin() {
+        cost_outer.push(cost_inner);
+        cost_inner = 0;
+        return clock();
+    }
+
+    function cost_end(name, start) {
+        var elapsed = clock() - start,
+            cost = rules[name] || (rules[name] = { count: 0, time: 0 });
+        cost.count += 1;
+        cost.time += elapsed - cost_inner;
+        cost_inner = cost_outer.pop() + elapsed;
+    }
+
+    function timed(name, f) {
+        return function () {
+            var start = cost_begin(), result = f.apply(this, arguments);
+            cost_end(name, start);
+            return result;
+        };
+    }
+
 // Provide critical ES5 functions to ES3.
 
     if (typeof Array.isArray !== 'function') {
@@ -804,7 +836,9 @@ var JSHINT = (function () {
     }
 
     function warning(m, t, a, b, c, d) {
-        var ch, l, w;
+        var ch, l, start, w;
+        if (rules)
+            start = cost_begin();
         t = t || nexttoken;
         if (t.id === '(end)') {  // `~
             t = token;
@@ -831,6 +865,8 @@ var JSHINT = (function () {
         if (warnings >= option.maxerr) {
             quit("Too many errors.", l, ch);
         }
+        if (rules)
+            cost_end('warning: ' + m, start);
         return w;
     }
 
@@ -864,6 +900,7 @@ var JSHINT = (function () {
 
         function nextLine() {
             var at,
+                start,
                 tw; // trailing whitespace check
 
             if (line >= lines.length)
@@ -872,28 +909,49 @@ var JSHINT = (function () {
             character = 1;
             s = lines[line];
             line += 1;
+
+            if (rules)
+                start = cost_begin();
             at = s.search(/ \t/);
 
             if (at >= 0)
                 warningAt("Mixed spaces and tabs.", line, at + 1);
+            if (rules)
+                cost_end('check: mixed spaces and tabs', start);
 
             s = s.replace(/\t/g, tab);
+
+            if (rules)
+                start = cost_begin();
             at = s.search(cx);
 
             if (at >= 0)
                 warningAt("Unsafe character.", line, at);
+            if (rules)
+                cost_end('check: unsafe characters', start);
 
+            if (rules)
+                start = cost_begin();
             if (option.maxlen && option.maxlen < s.length)
                 warningAt("Line too long.", line, s.length);
+            if (rules)
+                cost_end('option: maxlen', start);
 
             // Check for trailing whitespaces
+            if (rules)
+                start = cost_begin();
             tw = s.search(/\s+$/);
             if (option.trailing && ~tw && !~s.search(/^\s+$/))
                 warningAt("Trailing whitespace.", line, tw);
+            if (rules)
+                cost_end('option: trailing', start);
 
             return true;
         }
 
+        if (rules)
+            nextLine = timed('lexer: nextLine', nextLine);
+
 // Produce a token object.  The token inherits from a syntax symbol.
 
         function it(type, value) {
@@ -1465,6 +1523,9 @@ klass:                                  do {
         };
     }());
 
+    if (rules)
+        lex.token = timed('lexer: token', lex.token);
+
 
     function addlabel(t, type) {
 
@@ -1795,6 +1856,15 @@ loop:   for (;;) {
         }
     }
 
+    if (rules) {
+        adjacent = timed('option: white', adjacent);
+        nobreak = timed('option: white', nobreak);
+        nospace = timed('option: white', nospace);
+        nonadjacent = timed('option: white', nonadjacent);
+        nobreaknonadjacent = timed('option: white', nobreaknonadjacent);
+        indentation = timed('option: white', indentation);
+    }
+
     function nolinebreak(t) {
         t = t || token;
         if (t.line !== nexttoken.line) {
@@ -2310,7 +2380,8 @@ loop:   for (;;) {
         nud: function () {
             var v = this.value,
                 s = scope[v],
-                f;
+                f,
+                start;
             if (typeof s === 'function') {
 
 // Protection against accidental inheritance.
@@ -2354,10 +2425,14 @@ loop:   for (;;) {
 // inside of typeof or delete.
 
             } else if (funct['(global)']) {
+                if (rules)
+                    start = cost_begin();
                 if (anonname != 'typeof' && anonname != 'delete' &&
                     option.undef && typeof predefined[v] !== 'boolean') {
                     warning("'{a}' is not defined.", token, v);
                 }
+                if (rules)
+                    cost_end('option: undef', start);
                 note_implied(token);
 
 // If the name is already defined in the current
@@ -2392,11 +2467,15 @@ loop:   for (;;) {
 // Operators typeof and delete do not raise runtime errors even if the base object of
 // a reference is null so no need to display warning if we're inside of typeof or delete.
 
+                        if (rules)
+                            start = cost_begin();
                         if (anonname != 'typeof' && anonname != 'delete' && option.undef) {
                             warning("'{a}' is not defined.", token, v);
                         } else {
                             funct[v] = true;
                         }
+                        if (rules)
+                            cost_end('option: undef', start);
                         note_implied(token);
                     } else {
                         switch (s[v]) {
@@ -3575,6 +3654,10 @@ loop:   for (;;) {
     var itself = function (s, o, g) {
         var a, i, k;
         JSHINT.errors = [];
+        if (rules) {
+            cost_outer = [];
+            cost_inner = 0;
+        }
         predefined = Object.create(standard);
         combine(predefined, g || {});
         if (o) {
@@ -342,107 +342,109 @@ static const char jshint_script[] = \
 	"\x63\x6C\x6F\x73\x75\x72\x65\x2C\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x2C\x20\x63\x6F"\
 	"\x6E\x64\x69\x74\x69\x6F\x6E\x2C\x20\x63\x6F\x6E\x66\x69\x72\x6D\x2C\x20\x63\x6F"\
 	"\x6E\x73\x6F\x6C\x65\x2C\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2C\x0A"\
-	"\x20\x63\x6F\x6E\x74\x65\x6E\x74\x2C\x20\x63\x6F\x75\x63\x68\x2C\x20\x63\x72\x65"\
-	"\x61\x74\x65\x2C\x20\x63\x73\x73\x2C\x20\x63\x75\x72\x6C\x79\x2C\x20\x64\x2C\x20"\
-	"\x64\x61\x74\x61\x2C\x20\x64\x61\x74\x61\x6C\x69\x73\x74\x2C\x20\x64\x64\x2C\x20"\
-	"\x64\x65\x62\x75\x67\x2C\x20\x64\x65\x63\x6F\x64\x65\x55\x52\x49\x2C\x0A\x20\x64"\
-	"\x65\x63\x6F\x64\x65\x55\x52\x49\x43\x6F\x6D\x70\x6F\x6E\x65\x6E\x74\x2C\x20\x64"\
-	"\x65\x66\x61\x75\x6C\x74\x53\x74\x61\x74\x75\x73\x2C\x20\x64\x65\x66\x69\x6E\x65"\
-	"\x43\x6C\x61\x73\x73\x2C\x20\x64\x65\x73\x65\x72\x69\x61\x6C\x69\x7A\x65\x2C\x20"\
-	"\x64\x65\x76\x65\x6C\x2C\x20\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2C\x0A\x20\x64\x6F"\
-	"\x6A\x6F\x2C\x20\x64\x69\x6A\x69\x74\x2C\x20\x64\x6F\x6A\x6F\x78\x2C\x20\x64\x65"\
-	"\x66\x69\x6E\x65\x2C\x20\x65\x64\x69\x74\x69\x6F\x6E\x2C\x20\x65\x6C\x73\x65\x2C"\
-	"\x20\x65\x6D\x69\x74\x2C\x20\x65\x6E\x63\x6F\x64\x65\x55\x52\x49\x2C\x20\x65\x6E"\
-	"\x63\x6F\x64\x65\x55\x52\x49\x43\x6F\x6D\x70\x6F\x6E\x65\x6E\x74\x2C\x0A\x20\x65"\
-	"\x6E\x74\x69\x74\x79\x69\x66\x79\x2C\x20\x65\x71\x65\x71\x65\x71\x2C\x20\x65\x71"\
-	"\x6E\x75\x6C\x6C\x2C\x20\x65\x72\x72\x6F\x72\x73\x2C\x20\x65\x73\x35\x2C\x20\x65"\
-	"\x73\x63\x61\x70\x65\x2C\x20\x65\x76\x61\x6C\x2C\x20\x65\x76\x65\x6E\x74\x2C\x20"\
-	"\x65\x76\x69\x64\x65\x6E\x63\x65\x2C\x20\x65\x76\x69\x6C\x2C\x0A\x20\x65\x78\x2C"\
-	"\x20\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x2C\x20\x65\x78\x65\x63\x2C\x20\x65\x78"\
-	"\x70\x73\x2C\x20\x65\x78\x70\x72\x2C\x20\x65\x78\x70\x6F\x72\x74\x73\x2C\x20\x46"\
-	"\x69\x6C\x65\x52\x65\x61\x64\x65\x72\x2C\x20\x66\x69\x72\x73\x74\x2C\x20\x66\x6C"\
-	"\x6F\x6F\x72\x2C\x20\x66\x6F\x63\x75\x73\x2C\x0A\x20\x66\x6F\x72\x69\x6E\x2C\x20"\
-	"\x66\x72\x61\x67\x6D\x65\x6E\x74\x2C\x20\x66\x72\x61\x6D\x65\x73\x2C\x20\x66\x72"\
-	"\x6F\x6D\x2C\x20\x66\x72\x6F\x6D\x43\x68\x61\x72\x43\x6F\x64\x65\x2C\x20\x66\x75"\
-	"\x64\x2C\x20\x66\x75\x6E\x63\x74\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2C\x0A\x20\x67\x2C\x20\x67\x63\x2C\x20\x67"\
-	"\x65\x74\x43\x6F\x6D\x70\x75\x74\x65\x64\x53\x74\x79\x6C\x65\x2C\x20\x67\x65\x74"\
-	"\x52\x6F\x77\x2C\x20\x47\x4C\x4F\x42\x41\x4C\x2C\x20\x67\x6C\x6F\x62\x61\x6C\x2C"\
-	"\x20\x67\x6C\x6F\x62\x61\x6C\x73\x2C\x20\x67\x6C\x6F\x62\x61\x6C\x73\x74\x72\x69"\
-	"\x63\x74\x2C\x0A\x20\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74\x79\x2C"\
-	"\x20\x68\x65\x6C\x70\x2C\x20\x68\x69\x73\x74\x6F\x72\x79\x2C\x20\x69\x2C\x20\x69"\
-	"\x64\x2C\x0A\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x2C\x20\x69\x6D\x6D\x65"\
-	"\x64\x2C\x20\x69\x6D\x70\x6C\x69\x65\x64\x73\x2C\x20\x69\x6E\x63\x6C\x75\x64\x65"\
-	"\x2C\x20\x69\x6E\x64\x65\x6E\x74\x2C\x20\x69\x6E\x64\x65\x78\x4F\x66\x2C\x20\x69"\
-	"\x6E\x69\x74\x2C\x20\x69\x6E\x73\x2C\x20\x69\x6E\x73\x74\x61\x6E\x63\x65\x4F\x66"\
-	"\x2C\x0A\x20\x69\x73\x41\x6C\x70\x68\x61\x2C\x20\x69\x73\x41\x70\x70\x6C\x69\x63"\
-	"\x61\x74\x69\x6F\x6E\x52\x75\x6E\x6E\x69\x6E\x67\x2C\x20\x69\x73\x41\x72\x72\x61"\
-	"\x79\x2C\x20\x69\x73\x44\x69\x67\x69\x74\x2C\x20\x69\x73\x46\x69\x6E\x69\x74\x65"\
-	"\x2C\x20\x69\x73\x4E\x61\x4E\x2C\x20\x6A\x6F\x69\x6E\x2C\x20\x6A\x73\x68\x69\x6E"\
-	"\x74\x2C\x0A\x20\x4A\x53\x48\x49\x4E\x54\x2C\x20\x6A\x73\x6F\x6E\x2C\x20\x6A\x71"\
-	"\x75\x65\x72\x79\x2C\x20\x6A\x51\x75\x65\x72\x79\x2C\x20\x6B\x65\x79\x73\x2C\x20"\
-	"\x6C\x61\x62\x65\x6C\x2C\x20\x6C\x61\x62\x65\x6C\x6C\x65\x64\x2C\x20\x6C\x61\x73"\
-	"\x74\x2C\x20\x6C\x61\x73\x74\x73\x65\x6D\x69\x63\x2C\x20\x6C\x61\x78\x62\x72\x65"\
-	"\x61\x6B\x2C\x0A\x20\x6C\x61\x74\x65\x64\x65\x66\x2C\x20\x6C\x62\x70\x2C\x20\x6C"\
-	"\x65\x64\x2C\x20\x6C\x65\x66\x74\x2C\x20\x6C\x65\x6E\x67\x74\x68\x2C\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x6C\x6F\x61\x64\x2C\x20\x6C\x6F\x61\x64\x43\x6C\x61\x73\x73\x2C"\
-	"\x20\x6C\x6F\x63\x61\x6C\x53\x74\x6F\x72\x61\x67\x65\x2C\x20\x6C\x6F\x63\x61\x74"\
-	"\x69\x6F\x6E\x2C\x0A\x20\x6C\x6F\x67\x2C\x20\x6C\x6F\x6F\x70\x66\x75\x6E\x63\x2C"\
-	"\x20\x6D\x2C\x20\x6D\x61\x74\x63\x68\x2C\x20\x6D\x61\x78\x65\x72\x72\x2C\x20\x6D"\
-	"\x61\x78\x6C\x65\x6E\x2C\x20\x6D\x65\x6D\x62\x65\x72\x2C\x6D\x65\x73\x73\x61\x67"\
-	"\x65\x2C\x20\x6D\x65\x74\x61\x2C\x20\x6D\x6F\x64\x75\x6C\x65\x2C\x20\x6D\x6F\x76"\
-	"\x65\x42\x79\x2C\x0A\x20\x6D\x6F\x76\x65\x54\x6F\x2C\x20\x6D\x6F\x6F\x74\x6F\x6F"\
-	"\x6C\x73\x2C\x20\x6E\x61\x6D\x65\x2C\x20\x6E\x61\x76\x69\x67\x61\x74\x6F\x72\x2C"\
-	"\x20\x6E\x65\x77\x2C\x20\x6E\x65\x77\x63\x61\x70\x2C\x20\x6E\x6F\x61\x72\x67\x2C"\
-	"\x20\x6E\x6F\x64\x65\x2C\x20\x6E\x6F\x65\x6D\x70\x74\x79\x2C\x20\x6E\x6F\x6D\x65"\
-	"\x6E\x2C\x0A\x20\x6E\x6F\x6E\x65\x77\x2C\x20\x6E\x75\x64\x2C\x20\x6F\x6E\x62\x65"\
-	"\x66\x6F\x72\x65\x75\x6E\x6C\x6F\x61\x64\x2C\x20\x6F\x6E\x62\x6C\x75\x72\x2C\x20"\
-	"\x6F\x6E\x65\x72\x72\x6F\x72\x2C\x20\x6F\x6E\x65\x76\x61\x72\x2C\x20\x6F\x6E\x66"\
-	"\x6F\x63\x75\x73\x2C\x20\x6F\x6E\x6C\x6F\x61\x64\x2C\x20\x6F\x6E\x72\x65\x73\x69"\
-	"\x7A\x65\x2C\x0A\x20\x6F\x6E\x75\x6E\x6C\x6F\x61\x64\x2C\x20\x6F\x70\x65\x6E\x2C"\
-	"\x20\x6F\x70\x65\x6E\x44\x61\x74\x61\x62\x61\x73\x65\x2C\x20\x6F\x70\x65\x6E\x55"\
-	"\x52\x4C\x2C\x20\x6F\x70\x65\x6E\x65\x72\x2C\x20\x6F\x70\x65\x72\x61\x2C\x20\x6F"\
-	"\x75\x74\x65\x72\x2C\x20\x70\x61\x72\x61\x6D\x2C\x20\x70\x61\x72\x65\x6E\x74\x2C"\
-	"\x0A\x20\x70\x61\x72\x73\x65\x46\x6C\x6F\x61\x74\x2C\x20\x70\x61\x72\x73\x65\x49"\
-	"\x6E\x74\x2C\x20\x70\x61\x73\x73\x66\x61\x69\x6C\x2C\x20\x70\x6C\x75\x73\x70\x6C"\
-	"\x75\x73\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x70\x72\x69\x6E\x74\x2C\x20\x70"\
-	"\x72\x6F\x63\x65\x73\x73\x2C\x20\x70\x72\x6F\x6D\x70\x74\x2C\x0A\x20\x70\x72\x6F"\
-	"\x74\x6F\x74\x79\x70\x65\x2C\x20\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x6A\x73\x2C"\
-	"\x20\x70\x75\x73\x68\x2C\x20\x71\x75\x69\x74\x2C\x20\x72\x61\x6E\x67\x65\x2C\x20"\
-	"\x72\x61\x77\x2C\x20\x72\x65\x61\x63\x68\x2C\x20\x72\x65\x61\x73\x6F\x6E\x2C\x20"\
-	"\x72\x65\x67\x65\x78\x70\x2C\x0A\x20\x72\x65\x61\x64\x46\x69\x6C\x65\x2C\x20\x72"\
-	"\x65\x61\x64\x55\x72\x6C\x2C\x20\x72\x65\x67\x65\x78\x64\x61\x73\x68\x2C\x20\x72"\
-	"\x65\x6D\x6F\x76\x65\x45\x76\x65\x6E\x74\x4C\x69\x73\x74\x65\x6E\x65\x72\x2C\x20"\
-	"\x72\x65\x70\x6C\x61\x63\x65\x2C\x20\x72\x65\x70\x6F\x72\x74\x2C\x20\x72\x65\x71"\
-	"\x75\x69\x72\x65\x2C\x0A\x20\x72\x65\x73\x65\x72\x76\x65\x64\x2C\x20\x72\x65\x73"\
-	"\x69\x7A\x65\x42\x79\x2C\x20\x72\x65\x73\x69\x7A\x65\x54\x6F\x2C\x20\x72\x65\x73"\
-	"\x6F\x6C\x76\x65\x50\x61\x74\x68\x2C\x20\x72\x65\x73\x75\x6D\x65\x55\x70\x64\x61"\
-	"\x74\x65\x73\x2C\x20\x72\x65\x73\x70\x6F\x6E\x64\x2C\x20\x72\x68\x69\x6E\x6F\x2C"\
-	"\x20\x72\x69\x67\x68\x74\x2C\x0A\x20\x72\x75\x6E\x43\x6F\x6D\x6D\x61\x6E\x64\x2C"\
-	"\x20\x73\x63\x72\x6F\x6C\x6C\x2C\x20\x73\x63\x72\x65\x65\x6E\x2C\x20\x73\x63\x72"\
-	"\x69\x70\x74\x75\x72\x6C\x2C\x20\x73\x63\x72\x6F\x6C\x6C\x42\x79\x2C\x20\x73\x63"\
-	"\x72\x6F\x6C\x6C\x54\x6F\x2C\x20\x73\x63\x72\x6F\x6C\x6C\x62\x61\x72\x2C\x20\x73"\
-	"\x65\x61\x72\x63\x68\x2C\x20\x73\x65\x61\x6C\x2C\x20\x73\x65\x6E\x64\x2C\x0A\x20"\
-	"\x73\x65\x72\x69\x61\x6C\x69\x7A\x65\x2C\x20\x73\x65\x74\x49\x6E\x74\x65\x72\x76"\
-	"\x61\x6C\x2C\x20\x73\x65\x74\x54\x69\x6D\x65\x6F\x75\x74\x2C\x20\x73\x68\x69\x66"\
-	"\x74\x2C\x20\x73\x6C\x69\x63\x65\x2C\x20\x73\x6F\x72\x74\x2C\x73\x70\x61\x77\x6E"\
-	"\x2C\x20\x73\x70\x6C\x69\x74\x2C\x20\x73\x74\x61\x63\x6B\x2C\x0A\x20\x73\x74\x61"\
-	"\x74\x75\x73\x2C\x20\x73\x74\x61\x72\x74\x2C\x20\x73\x74\x72\x69\x63\x74\x2C\x20"\
-	"\x73\x75\x62\x2C\x20\x73\x75\x62\x73\x74\x72\x2C\x20\x73\x75\x70\x65\x72\x6E\x65"\
-	"\x77\x2C\x20\x73\x68\x61\x64\x6F\x77\x2C\x20\x73\x75\x70\x70\x6C\x61\x6E\x74\x2C"\
-	"\x20\x73\x75\x6D\x2C\x20\x73\x79\x6E\x63\x2C\x0A\x20\x74\x65\x73\x74\x2C\x20\x74"\
-	"\x6F\x4C\x6F\x77\x65\x72\x43\x61\x73\x65\x2C\x20\x74\x6F\x53\x74\x72\x69\x6E\x67"\
-	"\x2C\x20\x74\x6F\x55\x70\x70\x65\x72\x43\x61\x73\x65\x2C\x20\x74\x6F\x69\x6E\x74"\
-	"\x33\x32\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x70\x2C\x20\x74\x72\x61\x69"\
-	"\x6C\x69\x6E\x67\x2C\x20\x74\x79\x70\x65\x2C\x0A\x20\x74\x79\x70\x65\x4F\x66\x2C"\
-	"\x20\x55\x69\x6E\x74\x31\x36\x41\x72\x72\x61\x79\x2C\x20\x55\x69\x6E\x74\x33\x32"\
-	"\x41\x72\x72\x61\x79\x2C\x20\x55\x69\x6E\x74\x38\x41\x72\x72\x61\x79\x2C\x20\x75"\
-	"\x6E\x64\x65\x66\x2C\x20\x75\x6E\x75\x73\x65\x64\x2C\x20\x75\x72\x6C\x73\x2C\x20"\
-	"\x76\x61\x6C\x75\x65\x2C\x20\x76\x61\x6C\x75\x65\x4F\x66\x2C\x0A\x20\x76\x61\x72"\
-	"\x2C\x20\x76\x65\x72\x73\x69\x6F\x6E\x2C\x20\x57\x65\x62\x53\x6F\x63\x6B\x65\x74"\
-	"\x2C\x20\x77\x68\x69\x74\x65\x2C\x20\x77\x69\x6E\x64\x6F\x77\x2C\x20\x57\x6F\x72"\
-	"\x6B\x65\x72\x2C\x20\x77\x73\x68\x2A\x2F\x0A\x0A\x2F\x2A\x67\x6C\x6F\x62\x61\x6C"\
-	"\x20\x65\x78\x70\x6F\x72\x74\x73\x3A\x20\x66\x61\x6C\x73\x65\x20\x2A\x2F\x0A\x0A"\
+	"\x20\x63\x6F\x6E\x74\x65\x6E\x74\x2C\x20\x63\x6F\x75\x63\x68\x2C\x20\x63\x6F\x75"\
+	"\x6E\x74\x2C\x20\x63\x72\x65\x61\x74\x65\x2C\x20\x63\x73\x73\x2C\x20\x63\x75\x72"\
+	"\x6C\x79\x2C\x20\x64\x2C\x20\x64\x61\x74\x61\x2C\x20\x64\x61\x74\x61\x6C\x69\x73"\
+	"\x74\x2C\x20\x64\x64\x2C\x20\x64\x65\x62\x75\x67\x2C\x20\x64\x65\x63\x6F\x64\x65"\
+	"\x55\x52\x49\x2C\x0A\x20\x64\x65\x63\x6F\x64\x65\x55\x52\x49\x43\x6F\x6D\x70\x6F"\
+	"\x6E\x65\x6E\x74\x2C\x20\x64\x65\x66\x61\x75\x6C\x74\x53\x74\x61\x74\x75\x73\x2C"\
+	"\x20\x64\x65\x66\x69\x6E\x65\x43\x6C\x61\x73\x73\x2C\x20\x64\x65\x73\x65\x72\x69"\
+	"\x61\x6C\x69\x7A\x65\x2C\x20\x64\x65\x76\x65\x6C\x2C\x20\x64\x6F\x63\x75\x6D\x65"\
+	"\x6E\x74\x2C\x0A\x20\x64\x6F\x6A\x6F\x2C\x20\x64\x69\x6A\x69\x74\x2C\x20\x64\x6F"\
+	"\x6A\x6F\x78\x2C\x20\x64\x65\x66\x69\x6E\x65\x2C\x20\x65\x64\x69\x74\x69\x6F\x6E"\
+	"\x2C\x20\x65\x6C\x73\x65\x2C\x20\x65\x6D\x69\x74\x2C\x20\x65\x6E\x63\x6F\x64\x65"\
+	"\x55\x52\x49\x2C\x20\x65\x6E\x63\x6F\x64\x65\x55\x52\x49\x43\x6F\x6D\x70\x6F\x6E"\
+	"\x65\x6E\x74\x2C\x0A\x20\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x2C\x20\x65\x71\x65"\
+	"\x71\x65\x71\x2C\x20\x65\x71\x6E\x75\x6C\x6C\x2C\x20\x65\x72\x72\x6F\x72\x73\x2C"\
+	"\x20\x65\x73\x35\x2C\x20\x65\x73\x63\x61\x70\x65\x2C\x20\x65\x76\x61\x6C\x2C\x20"\
+	"\x65\x76\x65\x6E\x74\x2C\x20\x65\x76\x69\x64\x65\x6E\x63\x65\x2C\x20\x65\x76\x69"\
+	"\x6C\x2C\x0A\x20\x65\x78\x2C\x20\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x2C\x20\x65"\
+	"\x78\x65\x63\x2C\x20\x65\x78\x70\x73\x2C\x20\x65\x78\x70\x72\x2C\x20\x65\x78\x70"\
+	"\x6F\x72\x74\x73\x2C\x20\x46\x69\x6C\x65\x52\x65\x61\x64\x65\x72\x2C\x20\x66\x69"\
+	"\x72\x73\x74\x2C\x20\x66\x6C\x6F\x6F\x72\x2C\x20\x66\x6F\x63\x75\x73\x2C\x0A\x20"\
+	"\x66\x6F\x72\x69\x6E\x2C\x20\x66\x72\x61\x67\x6D\x65\x6E\x74\x2C\x20\x66\x72\x61"\
+	"\x6D\x65\x73\x2C\x20\x66\x72\x6F\x6D\x2C\x20\x66\x72\x6F\x6D\x43\x68\x61\x72\x43"\
+	"\x6F\x64\x65\x2C\x20\x66\x75\x64\x2C\x20\x66\x75\x6E\x63\x74\x2C\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2C\x0A\x20\x67"\
+	"\x2C\x20\x67\x63\x2C\x20\x67\x65\x74\x43\x6F\x6D\x70\x75\x74\x65\x64\x53\x74\x79"\
+	"\x6C\x65\x2C\x20\x67\x65\x74\x52\x6F\x77\x2C\x20\x47\x4C\x4F\x42\x41\x4C\x2C\x20"\
+	"\x67\x6C\x6F\x62\x61\x6C\x2C\x20\x67\x6C\x6F\x62\x61\x6C\x73\x2C\x20\x67\x6C\x6F"\
+	"\x62\x61\x6C\x73\x74\x72\x69\x63\x74\x2C\x0A\x20\x68\x61\x73\x4F\x77\x6E\x50\x72"\
+	"\x6F\x70\x65\x72\x74\x79\x2C\x20\x68\x65\x6C\x70\x2C\x20\x68\x69\x73\x74\x6F\x72"\
+	"\x79\x2C\x20\x69\x2C\x20\x69\x64\x2C\x0A\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
+	"\x72\x2C\x20\x69\x6D\x6D\x65\x64\x2C\x20\x69\x6D\x70\x6C\x69\x65\x64\x73\x2C\x20"\
+	"\x69\x6E\x63\x6C\x75\x64\x65\x2C\x20\x69\x6E\x64\x65\x6E\x74\x2C\x20\x69\x6E\x64"\
+	"\x65\x78\x4F\x66\x2C\x20\x69\x6E\x69\x74\x2C\x20\x69\x6E\x73\x2C\x20\x69\x6E\x73"\
+	"\x74\x61\x6E\x63\x65\x4F\x66\x2C\x0A\x20\x69\x73\x41\x6C\x70\x68\x61\x2C\x20\x69"\
+	"\x73\x41\x70\x70\x6C\x69\x63\x61\x74\x69\x6F\x6E\x52\x75\x6E\x6E\x69\x6E\x67\x2C"\
+	"\x20\x69\x73\x41\x72\x72\x61\x79\x2C\x20\x69\x73\x44\x69\x67\x69\x74\x2C\x20\x69"\
+	"\x73\x46\x69\x6E\x69\x74\x65\x2C\x20\x69\x73\x4E\x61\x4E\x2C\x20\x6A\x6F\x69\x6E"\
+	"\x2C\x20\x6A\x73\x68\x69\x6E\x74\x2C\x0A\x20\x4A\x53\x48\x49\x4E\x54\x2C\x20\x6A"\
+	"\x73\x6F\x6E\x2C\x20\x6A\x71\x75\x65\x72\x79\x2C\x20\x6A\x51\x75\x65\x72\x79\x2C"\
+	"\x20\x6B\x65\x79\x73\x2C\x20\x6C\x61\x62\x65\x6C\x2C\x20\x6C\x61\x62\x65\x6C\x6C"\
+	"\x65\x64\x2C\x20\x6C\x61\x73\x74\x2C\x20\x6C\x61\x73\x74\x73\x65\x6D\x69\x63\x2C"\
+	"\x20\x6C\x61\x78\x62\x72\x65\x61\x6B\x2C\x0A\x20\x6C\x61\x74\x65\x64\x65\x66\x2C"\
+	"\x20\x6C\x62\x70\x2C\x20\x6C\x65\x64\x2C\x20\x6C\x65\x66\x74\x2C\x20\x6C\x65\x6E"\
+	"\x67\x74\x68\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x6C\x6F\x61\x64\x2C\x20\x6C\x6F\x61"\
+	"\x64\x43\x6C\x61\x73\x73\x2C\x20\x6C\x6F\x63\x61\x6C\x53\x74\x6F\x72\x61\x67\x65"\
+	"\x2C\x20\x6C\x6F\x63\x61\x74\x69\x6F\x6E\x2C\x0A\x20\x6C\x6F\x67\x2C\x20\x6C\x6F"\
+	"\x6F\x70\x66\x75\x6E\x63\x2C\x20\x6D\x2C\x20\x6D\x61\x74\x63\x68\x2C\x20\x6D\x61"\
+	"\x78\x65\x72\x72\x2C\x20\x6D\x61\x78\x6C\x65\x6E\x2C\x20\x6D\x65\x6D\x62\x65\x72"\
+	"\x2C\x6D\x65\x73\x73\x61\x67\x65\x2C\x20\x6D\x65\x74\x61\x2C\x20\x6D\x6F\x64\x75"\
+	"\x6C\x65\x2C\x20\x6D\x6F\x76\x65\x42\x79\x2C\x0A\x20\x6D\x6F\x76\x65\x54\x6F\x2C"\
+	"\x20\x6D\x6F\x6F\x74\x6F\x6F\x6C\x73\x2C\x20\x6E\x61\x6D\x65\x2C\x20\x6E\x61\x76"\
+	"\x69\x67\x61\x74\x6F\x72\x2C\x20\x6E\x65\x77\x2C\x20\x6E\x65\x77\x63\x61\x70\x2C"\
+	"\x20\x6E\x6F\x61\x72\x67\x2C\x20\x6E\x6F\x64\x65\x2C\x20\x6E\x6F\x65\x6D\x70\x74"\
+	"\x79\x2C\x20\x6E\x6F\x6D\x65\x6E\x2C\x0A\x20\x6E\x6F\x6E\x65\x77\x2C\x20\x6E\x6F"\
+	"\x77\x2C\x20\x6E\x75\x64\x2C\x20\x6F\x6E\x62\x65\x66\x6F\x72\x65\x75\x6E\x6C\x6F"\
+	"\x61\x64\x2C\x20\x6F\x6E\x62\x6C\x75\x72\x2C\x20\x6F\x6E\x65\x72\x72\x6F\x72\x2C"\
+	"\x20\x6F\x6E\x65\x76\x61\x72\x2C\x20\x6F\x6E\x66\x6F\x63\x75\x73\x2C\x20\x6F\x6E"\
+	"\x6C\x6F\x61\x64\x2C\x20\x6F\x6E\x72\x65\x73\x69\x7A\x65\x2C\x0A\x20\x6F\x6E\x75"\
+	"\x6E\x6C\x6F\x61\x64\x2C\x20\x6F\x70\x65\x6E\x2C\x20\x6F\x70\x65\x6E\x44\x61\x74"\
+	"\x61\x62\x61\x73\x65\x2C\x20\x6F\x70\x65\x6E\x55\x52\x4C\x2C\x20\x6F\x70\x65\x6E"\
+	"\x65\x72\x2C\x20\x6F\x70\x65\x72\x61\x2C\x20\x6F\x75\x74\x65\x72\x2C\x20\x70\x61"\
+	"\x72\x61\x6D\x2C\x20\x70\x61\x72\x65\x6E\x74\x2C\x0A\x20\x70\x61\x72\x73\x65\x46"\
+	"\x6C\x6F\x61\x74\x2C\x20\x70\x61\x72\x73\x65\x49\x6E\x74\x2C\x20\x70\x61\x73\x73"\
+	"\x66\x61\x69\x6C\x2C\x20\x70\x6C\x75\x73\x70\x6C\x75\x73\x2C\x20\x70\x72\x65\x64"\
+	"\x65\x66\x2C\x20\x70\x72\x69\x6E\x74\x2C\x20\x70\x72\x6F\x63\x65\x73\x73\x2C\x20"\
+	"\x70\x72\x6F\x6D\x70\x74\x2C\x0A\x20\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2C\x20"\
+	"\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x6A\x73\x2C\x20\x70\x75\x73\x68\x2C\x20\x71"\
+	"\x75\x69\x74\x2C\x20\x72\x61\x6E\x67\x65\x2C\x20\x72\x61\x77\x2C\x20\x72\x65\x61"\
+	"\x63\x68\x2C\x20\x72\x65\x61\x73\x6F\x6E\x2C\x20\x72\x65\x67\x65\x78\x70\x2C\x0A"\
+	"\x20\x72\x65\x61\x64\x46\x69\x6C\x65\x2C\x20\x72\x65\x61\x64\x55\x72\x6C\x2C\x20"\
+	"\x72\x65\x67\x65\x78\x64\x61\x73\x68\x2C\x20\x72\x65\x6D\x6F\x76\x65\x45\x76\x65"\
+	"\x6E\x74\x4C\x69\x73\x74\x65\x6E\x65\x72\x2C\x20\x72\x65\x70\x6C\x61\x63\x65\x2C"\
+	"\x20\x72\x65\x70\x6F\x72\x74\x2C\x20\x72\x65\x71\x75\x69\x72\x65\x2C\x0A\x20\x72"\
+	"\x65\x73\x65\x72\x76\x65\x64\x2C\x20\x72\x65\x73\x69\x7A\x65\x42\x79\x2C\x20\x72"\
+	"\x65\x73\x69\x7A\x65\x54\x6F\x2C\x20\x72\x65\x73\x6F\x6C\x76\x65\x50\x61\x74\x68"\
+	"\x2C\x20\x72\x65\x73\x75\x6D\x65\x55\x70\x64\x61\x74\x65\x73\x2C\x20\x72\x65\x73"\
+	"\x70\x6F\x6E\x64\x2C\x20\x72\x68\x69\x6E\x6F\x2C\x20\x72\x69\x67\x68\x74\x2C\x0A"\
+	"\x20\x72\x75\x6C\x65\x73\x2C\x20\x72\x75\x6E\x43\x6F\x6D\x6D\x61\x6E\x64\x2C\x20"\
+	"\x73\x63\x72\x6F\x6C\x6C\x2C\x20\x73\x63\x72\x65\x65\x6E\x2C\x20\x73\x63\x72\x69"\
+	"\x70\x74\x75\x72\x6C\x2C\x20\x73\x63\x72\x6F\x6C\x6C\x42\x79\x2C\x20\x73\x63\x72"\
+	"\x6F\x6C\x6C\x54\x6F\x2C\x20\x73\x63\x72\x6F\x6C\x6C\x62\x61\x72\x2C\x20\x73\x65"\
+	"\x61\x72\x63\x68\x2C\x20\x73\x65\x61\x6C\x2C\x20\x73\x65\x6E\x64\x2C\x0A\x20\x73"\
+	"\x65\x72\x69\x61\x6C\x69\x7A\x65\x2C\x20\x73\x65\x74\x49\x6E\x74\x65\x72\x76\x61"\
+	"\x6C\x2C\x20\x73\x65\x74\x54\x69\x6D\x65\x6F\x75\x74\x2C\x20\x73\x68\x69\x66\x74"\
+	"\x2C\x20\x73\x6C\x69\x63\x65\x2C\x20\x73\x6F\x72\x74\x2C\x73\x70\x61\x77\x6E\x2C"\
+	"\x20\x73\x70\x6C\x69\x74\x2C\x20\x73\x74\x61\x63\x6B\x2C\x0A\x20\x73\x74\x61\x74"\
+	"\x75\x73\x2C\x20\x73\x74\x61\x72\x74\x2C\x20\x73\x74\x72\x69\x63\x74\x2C\x20\x73"\
+	"\x75\x62\x2C\x20\x73\x75\x62\x73\x74\x72\x2C\x20\x73\x75\x70\x65\x72\x6E\x65\x77"\
+	"\x2C\x20\x73\x68\x61\x64\x6F\x77\x2C\x20\x73\x75\x70\x70\x6C\x61\x6E\x74\x2C\x20"\
+	"\x73\x75\x6D\x2C\x20\x73\x79\x6E\x63\x2C\x0A\x20\x74\x65\x73\x74\x2C\x20\x74\x69"\
+	"\x6D\x65\x2C\x20\x74\x6F\x4C\x6F\x77\x65\x72\x43\x61\x73\x65\x2C\x20\x74\x6F\x53"\
+	"\x74\x72\x69\x6E\x67\x2C\x20\x74\x6F\x55\x70\x70\x65\x72\x43\x61\x73\x65\x2C\x20"\
+	"\x74\x6F\x69\x6E\x74\x33\x32\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x70\x2C"\
+	"\x20\x74\x72\x61\x69\x6C\x69\x6E\x67\x2C\x20\x74\x79\x70\x65\x2C\x0A\x20\x74\x79"\
+	"\x70\x65\x4F\x66\x2C\x20\x55\x69\x6E\x74\x31\x36\x41\x72\x72\x61\x79\x2C\x20\x55"\
+	"\x69\x6E\x74\x33\x32\x41\x72\x72\x61\x79\x2C\x20\x55\x69\x6E\x74\x38\x41\x72\x72"\
+	"\x61\x79\x2C\x20\x75\x6E\x64\x65\x66\x2C\x20\x75\x6E\x75\x73\x65\x64\x2C\x20\x75"\
+	"\x72\x6C\x73\x2C\x20\x76\x61\x6C\x75\x65\x2C\x20\x76\x61\x6C\x75\x65\x4F\x66\x2C"\
+	"\x0A\x20\x76\x61\x72\x2C\x20\x76\x65\x72\x73\x69\x6F\x6E\x2C\x20\x57\x65\x62\x53"\
+	"\x6F\x63\x6B\x65\x74\x2C\x20\x77\x68\x69\x74\x65\x2C\x20\x77\x69\x6E\x64\x6F\x77"\
+	"\x2C\x20\x57\x6F\x72\x6B\x65\x72\x2C\x20\x77\x73\x68\x2A\x2F\x0A\x0A\x2F\x2A\x67"\
+	"\x6C\x6F\x62\x61\x6C\x20\x65\x78\x70\x6F\x72\x74\x73\x3A\x20\x66\x61\x6C\x73\x65"\
+	"\x2C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20\x66\x61\x6C\x73\x65\x20\x2A\x2F\x0A\x0A"\
 	"\x2F\x2F\x20\x57\x65\x20\x62\x75\x69\x6C\x64\x20\x74\x68\x65\x20\x61\x70\x70\x6C"\
 	"\x69\x63\x61\x74\x69\x6F\x6E\x20\x69\x6E\x73\x69\x64\x65\x20\x61\x20\x66\x75\x6E"\
 	"\x63\x74\x69\x6F\x6E\x20\x73\x6F\x20\x74\x68\x61\x74\x20\x77\x65\x20\x70\x72\x6F"\
@@ -1284,236 +1286,291 @@ static const char jshint_script[] = \
 	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x4F\x62\x6A\x65\x63\x74"\
 	"\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F"\
 	"\x70\x65\x72\x74\x79\x2E\x63\x61\x6C\x6C\x28\x6F\x62\x6A\x65\x63\x74\x2C\x20\x6E"\
-	"\x61\x6D\x65\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x76"\
-	"\x69\x64\x65\x20\x63\x72\x69\x74\x69\x63\x61\x6C\x20\x45\x53\x35\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x73\x20\x74\x6F\x20\x45\x53\x33\x2E\x0A\x0A\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x41\x72\x72\x61\x79\x2E\x69\x73\x41"\
-	"\x72\x72\x61\x79\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x41\x72\x72\x61\x79\x2E\x69\x73\x41"\
-	"\x72\x72\x61\x79\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x4F\x62\x6A\x65\x63\x74\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x74\x6F"\
-	"\x53\x74\x72\x69\x6E\x67\x2E\x61\x70\x70\x6C\x79\x28\x6F\x29\x20\x3D\x3D\x3D\x20"\
-	"\x27\x5B\x6F\x62\x6A\x65\x63\x74\x20\x41\x72\x72\x61\x79\x5D\x27\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72"\
-	"\x65\x61\x74\x65\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72"\
-	"\x65\x61\x74\x65\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x46\x2E\x70\x72\x6F\x74"\
-	"\x6F\x74\x79\x70\x65\x20\x3D\x20\x6F\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6E\x65\x77\x20\x46\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B"\
-	"\x65\x79\x73\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79"\
-	"\x73\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x20\x3D\x20\x5B"\
-	"\x5D\x2C\x20\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F"\
-	"\x72\x20\x28\x6B\x20\x69\x6E\x20\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E\x28"\
-	"\x6F\x2C\x20\x6B\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x2E\x70\x75\x73\x68\x28\x6B\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x61\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x4E\x6F\x6E\x20\x73"\
-	"\x74\x61\x6E\x64\x61\x72\x64\x20\x6D\x65\x74\x68\x6F\x64\x73\x0A\x0A\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70"\
-	"\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x20\x21"\
+	"\x61\x6D\x65\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20\x43\x6F\x73"\
+	"\x74\x20\x61\x63\x63\x6F\x75\x6E\x74\x69\x6E\x67\x20\x66\x6F\x72\x20\x74\x68\x65"\
+	"\x20\x2D\x2D\x72\x75\x6C\x65\x2D\x73\x74\x61\x74\x73\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x20\x6F\x66\x20\x74\x68\x65\x20\x63\x6F\x6D\x6D\x61\x6E\x64\x20\x6C\x69\x6E\x65"\
+	"\x20\x72\x75\x6E\x6E\x65\x72\x2C\x0A\x2F\x2F\x20\x77\x68\x69\x63\x68\x20\x70\x72"\
+	"\x6F\x76\x69\x64\x65\x73\x20\x73\x79\x73\x74\x65\x6D\x2E\x72\x75\x6C\x65\x73\x20"\
+	"\x61\x6E\x64\x20\x61\x20\x63\x6C\x6F\x63\x6B\x2E\x20\x54\x69\x6D\x65\x20\x69\x73"\
+	"\x20\x65\x78\x63\x6C\x75\x73\x69\x76\x65\x3A\x20\x77\x68\x61\x74\x20\x61\x20\x6E"\
+	"\x65\x73\x74\x65\x64\x0A\x2F\x2F\x20\x6D\x65\x61\x73\x75\x72\x65\x6D\x65\x6E\x74"\
+	"\x20\x74\x61\x6B\x65\x73\x20\x69\x73\x20\x6E\x6F\x74\x20\x63\x68\x61\x72\x67\x65"\
+	"\x64\x20\x74\x6F\x20\x74\x68\x65\x20\x65\x6E\x63\x6C\x6F\x73\x69\x6E\x67\x20\x6F"\
+	"\x6E\x65\x20\x61\x73\x20\x77\x65\x6C\x6C\x2E\x0A\x0A\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x72\x75\x6C\x65\x73\x20\x3D\x20\x74\x79\x70\x65\x6F\x66\x20\x73\x79\x73\x74"\
+	"\x65\x6D\x20\x21\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x20\x26"\
+	"\x26\x20\x73\x79\x73\x74\x65\x6D\x2E\x72\x75\x6C\x65\x73\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x6C\x6F\x63\x6B\x20\x3D\x20\x72\x75\x6C\x65\x73\x20\x26\x26"\
+	"\x20\x73\x79\x73\x74\x65\x6D\x2E\x6E\x6F\x77\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x6F\x73\x74\x5F\x6F\x75\x74\x65\x72\x20\x3D\x20\x5B\x5D\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x69\x6E\x6E\x65\x72\x20\x3D\x20\x30"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x73\x74"\
+	"\x5F\x62\x65\x67\x69\x6E\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x6F\x73\x74\x5F\x6F\x75\x74\x65\x72\x2E\x70\x75\x73\x68\x28\x63\x6F\x73\x74\x5F"\
+	"\x69\x6E\x6E\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74"\
+	"\x5F\x69\x6E\x6E\x65\x72\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x63\x6C\x6F\x63\x6B\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x73\x74"\
+	"\x5F\x65\x6E\x64\x28\x6E\x61\x6D\x65\x2C\x20\x73\x74\x61\x72\x74\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x65\x6C\x61\x70\x73\x65\x64\x20"\
+	"\x3D\x20\x63\x6C\x6F\x63\x6B\x28\x29\x20\x2D\x20\x73\x74\x61\x72\x74\x2C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x20\x3D\x20\x72\x75"\
+	"\x6C\x65\x73\x5B\x6E\x61\x6D\x65\x5D\x20\x7C\x7C\x20\x28\x72\x75\x6C\x65\x73\x5B"\
+	"\x6E\x61\x6D\x65\x5D\x20\x3D\x20\x7B\x20\x63\x6F\x75\x6E\x74\x3A\x20\x30\x2C\x20"\
+	"\x74\x69\x6D\x65\x3A\x20\x30\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x6F\x73\x74\x2E\x63\x6F\x75\x6E\x74\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x2E\x74\x69\x6D\x65\x20\x2B\x3D\x20\x65\x6C"\
+	"\x61\x70\x73\x65\x64\x20\x2D\x20\x63\x6F\x73\x74\x5F\x69\x6E\x6E\x65\x72\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x69\x6E\x6E\x65\x72\x20\x3D"\
+	"\x20\x63\x6F\x73\x74\x5F\x6F\x75\x74\x65\x72\x2E\x70\x6F\x70\x28\x29\x20\x2B\x20"\
+	"\x65\x6C\x61\x70\x73\x65\x64\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x69\x6D\x65\x64\x28\x6E\x61\x6D\x65\x2C"\
+	"\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63"\
+	"\x6F\x73\x74\x5F\x62\x65\x67\x69\x6E\x28\x29\x2C\x20\x72\x65\x73\x75\x6C\x74\x20"\
+	"\x3D\x20\x66\x2E\x61\x70\x70\x6C\x79\x28\x74\x68\x69\x73\x2C\x20\x61\x72\x67\x75"\
+	"\x6D\x65\x6E\x74\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x6E\x61\x6D\x65\x2C\x20\x73\x74\x61\x72\x74"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x72\x65\x73\x75\x6C\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x76\x69\x64\x65\x20\x63"\
+	"\x72\x69\x74\x69\x63\x61\x6C\x20\x45\x53\x35\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x73\x20\x74\x6F\x20\x45\x53\x33\x2E\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
+	"\x79\x70\x65\x6F\x66\x20\x41\x72\x72\x61\x79\x2E\x69\x73\x41\x72\x72\x61\x79\x20"\
+	"\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x41\x72\x72\x61\x79\x2E\x69\x73\x41\x72\x72\x61\x79\x20"\
+	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x4F\x62\x6A\x65"\
+	"\x63\x74\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x74\x6F\x53\x74\x72\x69\x6E"\
+	"\x67\x2E\x61\x70\x70\x6C\x79\x28\x6F\x29\x20\x3D\x3D\x3D\x20\x27\x5B\x6F\x62\x6A"\
+	"\x65\x63\x74\x20\x41\x72\x72\x61\x79\x5D\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
+	"\x79\x70\x65\x6F\x66\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x20"\
+	"\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x20"\
+	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x46\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65"\
+	"\x20\x3D\x20\x6F\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x6E\x65\x77\x20\x46\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x79\x70\x65\x6F\x66\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x20\x21"\
 	"\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70"\
-	"\x65\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x20\x3D\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x26\x2F"\
-	"\x67\x2C\x20\x27\x26\x61\x6D\x70\x3B\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x3C\x2F"\
-	"\x67\x2C\x20\x27\x26\x6C\x74\x3B\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x3E\x2F\x67"\
-	"\x2C\x20\x27\x26\x67\x74\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70"\
-	"\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65"\
-	"\x2E\x69\x73\x41\x6C\x70\x68\x61\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x53\x74\x72\x69\x6E"\
-	"\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x69\x73\x41\x6C\x70\x68\x61\x20"\
-	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x28\x74\x68\x69\x73"\
-	"\x20\x3E\x3D\x20\x27\x61\x27\x20\x26\x26\x20\x74\x68\x69\x73\x20\x3C\x3D\x20\x27"\
-	"\x7A\x5C\x75\x66\x66\x66\x66\x27\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x74\x68\x69\x73\x20\x3E\x3D\x20\x27\x41"\
-	"\x27\x20\x26\x26\x20\x74\x68\x69\x73\x20\x3C\x3D\x20\x27\x5A\x5C\x75\x66\x66\x66"\
-	"\x66\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53\x74"\
-	"\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x69\x73\x44\x69\x67"\
-	"\x69\x74\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74"\
-	"\x6F\x74\x79\x70\x65\x2E\x69\x73\x44\x69\x67\x69\x74\x20\x3D\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x28\x74\x68\x69\x73\x20\x3E\x3D\x20\x27\x30"\
-	"\x27\x20\x26\x26\x20\x74\x68\x69\x73\x20\x3C\x3D\x20\x27\x39\x27\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70"\
-	"\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x73\x75\x70\x70\x6C\x61\x6E\x74\x20\x21\x3D"\
+	"\x20\x20\x20\x20\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x20\x3D\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x20\x3D\x20\x5B\x5D\x2C\x20\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6B\x20"\
+	"\x69\x6E\x20\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E\x28\x6F\x2C\x20\x6B\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x2E\x70\x75\x73\x68\x28\x6B\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x61\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x4E\x6F\x6E\x20\x73\x74\x61\x6E\x64\x61"\
+	"\x72\x64\x20\x6D\x65\x74\x68\x6F\x64\x73\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74"\
+	"\x79\x70\x65\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x20\x21\x3D\x3D\x20\x27\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x65\x6E\x74"\
+	"\x69\x74\x79\x69\x66\x79\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x74\x68\x69\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x26\x2F\x67\x2C\x20\x27\x26"\
+	"\x61\x6D\x70\x3B\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x3C\x2F\x67\x2C\x20\x27\x26"\
+	"\x6C\x74\x3B\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x3E\x2F\x67\x2C\x20\x27\x26\x67"\
+	"\x74\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53"\
+	"\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x69\x73\x41\x6C"\
+	"\x70\x68\x61\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F"\
+	"\x74\x6F\x74\x79\x70\x65\x2E\x69\x73\x41\x6C\x70\x68\x61\x20\x3D\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x28\x74\x68\x69\x73\x20\x3E\x3D\x20\x27"\
+	"\x61\x27\x20\x26\x26\x20\x74\x68\x69\x73\x20\x3C\x3D\x20\x27\x7A\x5C\x75\x66\x66"\
+	"\x66\x66\x27\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x28\x74\x68\x69\x73\x20\x3E\x3D\x20\x27\x41\x27\x20\x26\x26\x20"\
+	"\x74\x68\x69\x73\x20\x3C\x3D\x20\x27\x5A\x5C\x75\x66\x66\x66\x66\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E"\
+	"\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x69\x73\x44\x69\x67\x69\x74\x20\x21\x3D"\
 	"\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65"\
-	"\x2E\x73\x75\x70\x70\x6C\x61\x6E\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x28\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F"\
-	"\x5C\x7B\x28\x5B\x5E\x7B\x7D\x5D\x2A\x29\x5C\x7D\x2F\x67\x2C\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x28\x61\x2C\x20\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x20\x3D\x20\x6F\x5B"\
-	"\x62\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x74\x79\x70\x65\x6F\x66\x20\x72\x20\x3D\x3D\x3D\x20"\
-	"\x27\x73\x74\x72\x69\x6E\x67\x27\x20\x7C\x7C\x20\x74\x79\x70\x65\x6F\x66\x20\x72"\
-	"\x20\x3D\x3D\x3D\x20\x27\x6E\x75\x6D\x62\x65\x72\x27\x20\x3F\x20\x72\x20\x3A\x20"\
-	"\x61\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70"\
-	"\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x6E\x61\x6D\x65\x20\x21\x3D\x3D\x20\x27\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x6E\x61\x6D"\
-	"\x65\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x0A\x2F"\
-	"\x2F\x20\x49\x66\x20\x74\x68\x65\x20\x73\x74\x72\x69\x6E\x67\x20\x6C\x6F\x6F\x6B"\
-	"\x73\x20\x6C\x69\x6B\x65\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72"\
-	"\x2C\x20\x74\x68\x65\x6E\x20\x77\x65\x20\x63\x61\x6E\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x69\x74\x20\x61\x73\x20\x69\x73\x2E\x0A\x2F\x2F\x20\x49\x66\x20\x74\x68\x65"\
-	"\x20\x73\x74\x72\x69\x6E\x67\x20\x63\x6F\x6E\x74\x61\x69\x6E\x73\x20\x6E\x6F\x20"\
-	"\x63\x6F\x6E\x74\x72\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x2C\x20"\
-	"\x6E\x6F\x20\x71\x75\x6F\x74\x65\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x2C"\
-	"\x20\x61\x6E\x64\x20\x6E\x6F\x0A\x2F\x2F\x20\x62\x61\x63\x6B\x73\x6C\x61\x73\x68"\
-	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x2C\x20\x74\x68\x65\x6E\x20\x77\x65"\
-	"\x20\x63\x61\x6E\x20\x73\x69\x6D\x70\x6C\x79\x20\x73\x6C\x61\x70\x20\x73\x6F\x6D"\
-	"\x65\x20\x71\x75\x6F\x74\x65\x73\x20\x61\x72\x6F\x75\x6E\x64\x20\x69\x74\x2E\x0A"\
-	"\x2F\x2F\x20\x4F\x74\x68\x65\x72\x77\x69\x73\x65\x20\x77\x65\x20\x6D\x75\x73\x74"\
-	"\x20\x61\x6C\x73\x6F\x20\x72\x65\x70\x6C\x61\x63\x65\x20\x74\x68\x65\x20\x6F\x66"\
-	"\x66\x65\x6E\x64\x69\x6E\x67\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x20\x77"\
-	"\x69\x74\x68\x20\x73\x61\x66\x65\x0A\x2F\x2F\x20\x73\x65\x71\x75\x65\x6E\x63\x65"\
-	"\x73\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x69\x78\x2E\x74\x65\x73\x74\x28\x74\x68\x69\x73\x29\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x78\x2E\x74"\
-	"\x65\x73\x74\x28\x74\x68\x69\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x27\x22\x27\x20"\
-	"\x2B\x20\x74\x68\x69\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x6E\x78\x67\x2C\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x61\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63"\
-	"\x20\x3D\x20\x65\x73\x63\x61\x70\x65\x73\x5B\x61\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x63\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x27\x5C\x5C\x75\x27\x20\x2B\x20\x28\x27\x30\x30\x30"\
-	"\x30\x27\x20\x2B\x20\x61\x2E\x63\x68\x61\x72\x43\x6F\x64\x65\x41\x74\x28\x29\x2E"\
-	"\x74\x6F\x53\x74\x72\x69\x6E\x67\x28\x31\x36\x29\x29\x2E\x73\x6C\x69\x63\x65\x28"\
-	"\x2D\x34\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x29\x20\x2B\x20\x27\x22\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x27\x22\x27\x20\x2B\x20\x74\x68\x69\x73\x20\x2B\x20\x27\x22\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x6D\x62\x69\x6E"\
-	"\x65\x28\x74\x2C\x20\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
-	"\x72\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20"\
-	"\x69\x6E\x20\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E\x28\x6F\x2C\x20\x6E\x29\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x5B\x6E\x5D"\
-	"\x20\x3D\x20\x6F\x5B\x6E\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61\x73\x73\x75\x6D\x65\x28"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
-	"\x6F\x6E\x2E\x63\x6F\x75\x63\x68\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64"\
-	"\x2C\x20\x63\x6F\x75\x63\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x72\x68\x69\x6E\x6F\x29\x0A\x20\x20\x20"\
+	"\x2E\x69\x73\x44\x69\x67\x69\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x28\x74\x68\x69\x73\x20\x3E\x3D\x20\x27\x30\x27\x20\x26\x26\x20"\
+	"\x74\x68\x69\x73\x20\x3C\x3D\x20\x27\x39\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74"\
+	"\x79\x70\x65\x2E\x73\x75\x70\x70\x6C\x61\x6E\x74\x20\x21\x3D\x3D\x20\x27\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x53"\
+	"\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x73\x75\x70\x70"\
+	"\x6C\x61\x6E\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x74\x68\x69\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5C\x7B\x28\x5B\x5E"\
+	"\x7B\x7D\x5D\x2A\x29\x5C\x7D\x2F\x67\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x28\x61\x2C\x20\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x20\x3D\x20\x6F\x5B\x62\x5D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x74\x79\x70\x65\x6F\x66\x20\x72\x20\x3D\x3D\x3D\x20\x27\x73\x74\x72\x69"\
+	"\x6E\x67\x27\x20\x7C\x7C\x20\x74\x79\x70\x65\x6F\x66\x20\x72\x20\x3D\x3D\x3D\x20"\
+	"\x27\x6E\x75\x6D\x62\x65\x72\x27\x20\x3F\x20\x72\x20\x3A\x20\x61\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x79\x70\x65\x6F\x66\x20\x53\x74\x72\x69\x6E\x67\x2E\x70\x72\x6F\x74\x6F\x74"\
+	"\x79\x70\x65\x2E\x6E\x61\x6D\x65\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x53\x74\x72\x69\x6E"\
+	"\x67\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x6E\x61\x6D\x65\x20\x3D\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x0A\x2F\x2F\x20\x49\x66\x20"\
+	"\x74\x68\x65\x20\x73\x74\x72\x69\x6E\x67\x20\x6C\x6F\x6F\x6B\x73\x20\x6C\x69\x6B"\
+	"\x65\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x2C\x20\x74\x68\x65"\
+	"\x6E\x20\x77\x65\x20\x63\x61\x6E\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x20\x61"\
+	"\x73\x20\x69\x73\x2E\x0A\x2F\x2F\x20\x49\x66\x20\x74\x68\x65\x20\x73\x74\x72\x69"\
+	"\x6E\x67\x20\x63\x6F\x6E\x74\x61\x69\x6E\x73\x20\x6E\x6F\x20\x63\x6F\x6E\x74\x72"\
+	"\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x2C\x20\x6E\x6F\x20\x71\x75"\
+	"\x6F\x74\x65\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x2C\x20\x61\x6E\x64\x20"\
+	"\x6E\x6F\x0A\x2F\x2F\x20\x62\x61\x63\x6B\x73\x6C\x61\x73\x68\x20\x63\x68\x61\x72"\
+	"\x61\x63\x74\x65\x72\x73\x2C\x20\x74\x68\x65\x6E\x20\x77\x65\x20\x63\x61\x6E\x20"\
+	"\x73\x69\x6D\x70\x6C\x79\x20\x73\x6C\x61\x70\x20\x73\x6F\x6D\x65\x20\x71\x75\x6F"\
+	"\x74\x65\x73\x20\x61\x72\x6F\x75\x6E\x64\x20\x69\x74\x2E\x0A\x2F\x2F\x20\x4F\x74"\
+	"\x68\x65\x72\x77\x69\x73\x65\x20\x77\x65\x20\x6D\x75\x73\x74\x20\x61\x6C\x73\x6F"\
+	"\x20\x72\x65\x70\x6C\x61\x63\x65\x20\x74\x68\x65\x20\x6F\x66\x66\x65\x6E\x64\x69"\
+	"\x6E\x67\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x20\x77\x69\x74\x68\x20\x73"\
+	"\x61\x66\x65\x0A\x2F\x2F\x20\x73\x65\x71\x75\x65\x6E\x63\x65\x73\x2E\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x78\x2E\x74\x65"\
+	"\x73\x74\x28\x74\x68\x69\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x78\x2E\x74\x65\x73\x74\x28\x74"\
+	"\x68\x69\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x27\x22\x27\x20\x2B\x20\x74\x68\x69"\
+	"\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x6E\x78\x67\x2C\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x28\x61\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x20\x3D\x20\x65\x73"\
+	"\x63\x61\x70\x65\x73\x5B\x61\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x27\x5C\x5C\x75\x27\x20\x2B\x20\x28\x27\x30\x30\x30\x30\x27\x20\x2B\x20"\
+	"\x61\x2E\x63\x68\x61\x72\x43\x6F\x64\x65\x41\x74\x28\x29\x2E\x74\x6F\x53\x74\x72"\
+	"\x69\x6E\x67\x28\x31\x36\x29\x29\x2E\x73\x6C\x69\x63\x65\x28\x2D\x34\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x20\x2B"\
+	"\x20\x27\x22\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x27"\
+	"\x22\x27\x20\x2B\x20\x74\x68\x69\x73\x20\x2B\x20\x27\x22\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x74\x2C\x20"\
+	"\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6E\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20\x69\x6E\x20\x6F\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69"\
+	"\x73\x5F\x6F\x77\x6E\x28\x6F\x2C\x20\x6E\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x5B\x6E\x5D\x20\x3D\x20\x6F\x5B"\
+	"\x6E\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61\x73\x73\x75\x6D\x65\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x63\x6F"\
+	"\x75\x63\x68\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D"\
+	"\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x63\x6F\x75"\
+	"\x63\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x72\x68\x69\x6E\x6F\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E"\
+	"\x65\x64\x2C\x20\x72\x68\x69\x6E\x6F\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70\x72\x6F\x74\x6F\x74\x79\x70"\
+	"\x65\x6A\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D"\
+	"\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x70\x72\x6F"\
+	"\x74\x6F\x74\x79\x70\x65\x6A\x73\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x64\x65\x29\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x72\x68\x69\x6E\x6F\x29\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70\x72\x6F"\
-	"\x74\x6F\x74\x79\x70\x65\x6A\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64"\
-	"\x2C\x20\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x6A\x73\x29\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x64\x65"\
-	"\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E"\
-	"\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x6E\x6F\x64\x65\x29\x3B"\
+	"\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x6E\x6F\x64\x65\x29\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x64\x65\x76\x65"\
+	"\x6C\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69"\
+	"\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x64\x65\x76\x65\x6C"\
+	"\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x2E\x64\x6F\x6A\x6F\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C"\
+	"\x20\x64\x6F\x6A\x6F\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x72\x6F\x77\x73\x65\x72\x29\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65"\
+	"\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x62\x72\x6F\x77\x73\x65\x72\x29\x3B\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6A"\
+	"\x71\x75\x65\x72\x79\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x6A"\
+	"\x71\x75\x65\x72\x79\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x6F\x6F\x74\x6F\x6F\x6C\x73\x29\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72"\
+	"\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x6D\x6F\x6F\x74\x6F\x6F\x6C\x73\x29\x3B"\
 	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E"\
-	"\x2E\x64\x65\x76\x65\x6C\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20"\
-	"\x64\x65\x76\x65\x6C\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x64\x6F\x6A\x6F\x29\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66"\
-	"\x69\x6E\x65\x64\x2C\x20\x64\x6F\x6A\x6F\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x72\x6F\x77\x73\x65\x72"\
-	"\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E"\
-	"\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x62\x72\x6F\x77\x73\x65"\
-	"\x72\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x6A\x71\x75\x65\x72\x79\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E"\
-	"\x65\x64\x2C\x20\x6A\x71\x75\x65\x72\x79\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x6F\x6F\x74\x6F\x6F\x6C"\
-	"\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x62\x69"\
-	"\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x6D\x6F\x6F\x74\x6F"\
-	"\x6F\x6C\x73\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x77\x73\x68\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65"\
-	"\x64\x2C\x20\x77\x73\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x74\x72\x69\x63"\
-	"\x74\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x74\x72\x69\x63\x74\x20\x21"\
-	"\x3D\x3D\x20\x66\x61\x6C\x73\x65\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x74\x72\x69\x63\x74\x20\x3D\x20\x74\x72"\
-	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x64\x75"\
-	"\x63\x65\x20\x61\x6E\x20\x65\x72\x72\x6F\x72\x20\x77\x61\x72\x6E\x69\x6E\x67\x2E"\
-	"\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x71\x75\x69\x74\x28"\
-	"\x6D\x65\x73\x73\x61\x67\x65\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x72\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x70\x65\x72\x63\x65\x6E"\
-	"\x74\x61\x67\x65\x20\x3D\x20\x4D\x61\x74\x68\x2E\x66\x6C\x6F\x6F\x72\x28\x28\x6C"\
-	"\x69\x6E\x65\x20\x2F\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20"\
-	"\x2A\x20\x31\x30\x30\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x72"\
-	"\x6F\x77\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D"\
-	"\x65\x3A\x20\x27\x4A\x53\x48\x69\x6E\x74\x45\x72\x72\x6F\x72\x27\x2C\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x6C\x69\x6E\x65"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63"\
-	"\x74\x65\x72\x3A\x20\x63\x68\x72\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6D\x65\x73\x73\x61\x67\x65\x3A\x20\x6D\x65\x73\x73\x61\x67\x65\x20\x2B"\
-	"\x20\x22\x20\x28\x22\x20\x2B\x20\x70\x65\x72\x63\x65\x6E\x74\x61\x67\x65\x20\x2B"\
-	"\x20\x22\x25\x20\x73\x63\x61\x6E\x6E\x65\x64\x29\x2E\x22\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x6D\x2C\x20\x74\x2C\x20"\
-	"\x61\x2C\x20\x62\x2C\x20\x63\x2C\x20\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x76\x61\x72\x20\x63\x68\x2C\x20\x6C\x2C\x20\x77\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x74\x20\x3D\x20\x74\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x20\x20\x2F\x2F\x20"\
-	"\x60\x7E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x74"\
-	"\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6C\x20\x3D\x20\x74\x2E\x6C\x69\x6E\x65\x20\x7C\x7C\x20\x30\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x20\x3D\x20\x74\x2E\x66\x72\x6F\x6D"\
-	"\x20\x7C\x7C\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x20\x3D\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x3A\x20\x27\x28\x65"\
-	"\x72\x72\x6F\x72\x29\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x61\x77\x3A\x20\x6D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x65\x76\x69\x64\x65\x6E\x63\x65\x3A\x20\x6C\x69\x6E\x65\x73\x5B\x6C\x20\x2D\x20"\
-	"\x31\x5D\x20\x7C\x7C\x20\x27\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6C\x69\x6E\x65\x3A\x20\x6C\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3A\x20\x63\x68\x2C\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x3A\x20\x61\x2C\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x3A\x20\x62\x2C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x3A\x20\x63\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x64\x3A\x20\x64\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x2E\x72\x65\x61\x73\x6F\x6E\x20\x3D\x20\x6D"\
-	"\x2E\x73\x75\x70\x70\x6C\x61\x6E\x74\x28\x77\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x70\x75\x73\x68"\
-	"\x28\x77\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x70\x61\x73\x73\x66\x61\x69\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x71\x75\x69\x74\x28\x27\x53\x74\x6F\x70\x70\x69"\
-	"\x6E\x67\x2E\x20\x27\x2C\x20\x6C\x2C\x20\x63\x68\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x73\x20\x3E\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6D"\
-	"\x61\x78\x65\x72\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x71\x75\x69\x74\x28\x22\x54\x6F\x6F\x20\x6D\x61\x6E\x79\x20\x65\x72\x72\x6F"\
-	"\x72\x73\x2E\x22\x2C\x20\x6C\x2C\x20\x63\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x77"\
+	"\x2E\x77\x73\x68\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F"\
+	"\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x77\x73"\
+	"\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74"\
+	"\x69\x6F\x6E\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x74\x72\x69\x63\x74\x20\x26\x26\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x74\x72\x69\x63\x74\x20\x21\x3D\x3D\x20\x66\x61"\
+	"\x6C\x73\x65\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x2E\x73\x74\x72\x69\x63\x74\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x64\x75\x63\x65\x20\x61\x6E"\
+	"\x20\x65\x72\x72\x6F\x72\x20\x77\x61\x72\x6E\x69\x6E\x67\x2E\x0A\x0A\x20\x20\x20"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x71\x75\x69\x74\x28\x6D\x65\x73\x73\x61"\
+	"\x67\x65\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x72\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x70\x65\x72\x63\x65\x6E\x74\x61\x67\x65\x20"\
+	"\x3D\x20\x4D\x61\x74\x68\x2E\x66\x6C\x6F\x6F\x72\x28\x28\x6C\x69\x6E\x65\x20\x2F"\
+	"\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20\x2A\x20\x31\x30\x30"\
+	"\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x72\x6F\x77\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x3A\x20\x27\x4A"\
+	"\x53\x48\x69\x6E\x74\x45\x72\x72\x6F\x72\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3A\x20"\
+	"\x63\x68\x72\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x73"\
+	"\x73\x61\x67\x65\x3A\x20\x6D\x65\x73\x73\x61\x67\x65\x20\x2B\x20\x22\x20\x28\x22"\
+	"\x20\x2B\x20\x70\x65\x72\x63\x65\x6E\x74\x61\x67\x65\x20\x2B\x20\x22\x25\x20\x73"\
+	"\x63\x61\x6E\x6E\x65\x64\x29\x2E\x22\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x6D\x2C\x20\x74\x2C\x20\x61\x2C\x20\x62\x2C"\
+	"\x20\x63\x2C\x20\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x63\x68\x2C\x20\x6C\x2C\x20\x73\x74\x61\x72\x74\x2C\x20\x77\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F\x73"\
+	"\x74\x5F\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
+	"\x20\x3D\x20\x74\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
+	"\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x20\x20\x2F\x2F\x20\x60\x7E\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
+	"\x20\x3D\x20\x74\x2E\x6C\x69\x6E\x65\x20\x7C\x7C\x20\x30\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x68\x20\x3D\x20\x74\x2E\x66\x72\x6F\x6D\x20\x7C\x7C\x20\x30"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x3A\x20\x27\x28\x65\x72\x72\x6F\x72\x29"\
+	"\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x61\x77\x3A\x20"\
+	"\x6D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x76\x69\x64\x65"\
+	"\x6E\x63\x65\x3A\x20\x6C\x69\x6E\x65\x73\x5B\x6C\x20\x2D\x20\x31\x5D\x20\x7C\x7C"\
+	"\x20\x27\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E"\
+	"\x65\x3A\x20\x6C\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68"\
+	"\x61\x72\x61\x63\x74\x65\x72\x3A\x20\x63\x68\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x61\x3A\x20\x61\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x3A\x20\x62\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x3A\x20\x63\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64"\
+	"\x3A\x20\x64\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x2E\x72\x65\x61\x73\x6F\x6E\x20\x3D\x20\x6D\x2E\x73\x75\x70\x70"\
+	"\x6C\x61\x6E\x74\x28\x77\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48"\
+	"\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x70\x75\x73\x68\x28\x77\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70"\
+	"\x61\x73\x73\x66\x61\x69\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x71\x75\x69\x74\x28\x27\x53\x74\x6F\x70\x70\x69\x6E\x67\x2E\x20\x27"\
+	"\x2C\x20\x6C\x2C\x20\x63\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x73\x20\x2B\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x73\x20\x3E\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x65\x72\x72"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x75\x69\x74"\
+	"\x28\x22\x54\x6F\x6F\x20\x6D\x61\x6E\x79\x20\x65\x72\x72\x6F\x72\x73\x2E\x22\x2C"\
+	"\x20\x6C\x2C\x20\x63\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x27"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x3A\x20\x27\x20\x2B\x20\x6D\x2C\x20\x73\x74\x61\x72"\
+	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x77"\
 	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
 	"\x6E\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x6D\x2C\x20\x6C\x2C\x20\x63\x68"\
 	"\x2C\x20\x61\x2C\x20\x62\x2C\x20\x63\x2C\x20\x64\x29\x20\x7B\x0A\x20\x20\x20\x20"\
@@ -1547,1361 +1604,1398 @@ static const char jshint_script[] = \
 	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6E\x65\x78\x74"\
 	"\x4C\x69\x6E\x65\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x76\x61\x72\x20\x61\x74\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x77\x3B\x20\x2F\x2F\x20\x74\x72\x61\x69\x6C\x69\x6E\x67"\
-	"\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x63\x68\x65\x63\x6B\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x69\x6E\x65\x20"\
-	"\x3E\x3D\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x6C\x69\x6E\x65\x73\x5B\x6C\x69\x6E"\
-	"\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65"\
-	"\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
-	"\x74\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28\x2F\x20\x5C\x74\x2F\x29\x3B"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x74"\
-	"\x20\x3E\x3D\x20\x30\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x4D\x69\x78\x65\x64\x20"\
-	"\x73\x70\x61\x63\x65\x73\x20\x61\x6E\x64\x20\x74\x61\x62\x73\x2E\x22\x2C\x20\x6C"\
-	"\x69\x6E\x65\x2C\x20\x61\x74\x20\x2B\x20\x31\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x72\x65\x70\x6C\x61\x63\x65"\
-	"\x28\x2F\x5C\x74\x2F\x67\x2C\x20\x74\x61\x62\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x61\x74\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28"\
-	"\x63\x78\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x61\x74\x20\x3E\x3D\x20\x30\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E"\
-	"\x73\x61\x66\x65\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2E\x22\x2C\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x61\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x77\x3B\x20\x2F\x2F\x20\x74\x72\x61\x69\x6C"\
+	"\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x63\x68\x65\x63\x6B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x69"\
+	"\x6E\x65\x20\x3E\x3D\x20\x6C\x69\x6E\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
+	"\x72\x6E\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x6C\x69\x6E\x65\x73\x5B"\
+	"\x6C\x69\x6E\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
+	"\x69\x6E\x65\x20\x2B\x3D\x20\x31\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F"\
+	"\x73\x74\x5F\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x74\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28\x2F\x20"\
+	"\x5C\x74\x2F\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x61\x74\x20\x3E\x3D\x20\x30\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x4D"\
+	"\x69\x78\x65\x64\x20\x73\x70\x61\x63\x65\x73\x20\x61\x6E\x64\x20\x74\x61\x62\x73"\
+	"\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x61\x74\x20\x2B\x20\x31\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73"\
+	"\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F"\
+	"\x73\x74\x5F\x65\x6E\x64\x28\x27\x63\x68\x65\x63\x6B\x3A\x20\x6D\x69\x78\x65\x64"\
+	"\x20\x73\x70\x61\x63\x65\x73\x20\x61\x6E\x64\x20\x74\x61\x62\x73\x27\x2C\x20\x73"\
+	"\x74\x61\x72\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x20\x3D\x20\x73\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5C\x74\x2F\x67\x2C"\
+	"\x20\x74\x61\x62\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F\x73\x74\x5F"\
+	"\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x74\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28\x63\x78\x29\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x74\x20"\
+	"\x3E\x3D\x20\x30\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x73\x61\x66\x65\x20"\
+	"\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x61"\
+	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x27\x63\x68\x65\x63\x6B\x3A\x20"\
+	"\x75\x6E\x73\x61\x66\x65\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x73\x27\x2C\x20"\
+	"\x73\x74\x61\x72\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F\x73\x74"\
+	"\x5F\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x6C\x65\x6E\x20"\
 	"\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x6C\x65\x6E\x20\x3C\x20\x73"\
 	"\x2E\x6C\x65\x6E\x67\x74\x68\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x4C\x69\x6E\x65"\
 	"\x20\x74\x6F\x6F\x20\x6C\x6F\x6E\x67\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x73"\
-	"\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x2F\x2F\x20\x43\x68\x65\x63\x6B\x20\x66\x6F\x72\x20\x74\x72\x61\x69"\
-	"\x6C\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x73\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x77\x20\x3D\x20\x73\x2E\x73\x65\x61\x72"\
-	"\x63\x68\x28\x2F\x5C\x73\x2B\x24\x2F\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x74\x72\x61\x69\x6C"\
-	"\x69\x6E\x67\x20\x26\x26\x20\x7E\x74\x77\x20\x26\x26\x20\x21\x7E\x73\x2E\x73\x65"\
-	"\x61\x72\x63\x68\x28\x2F\x5E\x5C\x73\x2B\x24\x2F\x29\x29\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74"\
-	"\x28\x22\x54\x72\x61\x69\x6C\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63"\
-	"\x65\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x74\x77\x29\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x64"\
-	"\x75\x63\x65\x20\x61\x20\x74\x6F\x6B\x65\x6E\x20\x6F\x62\x6A\x65\x63\x74\x2E\x20"\
-	"\x20\x54\x68\x65\x20\x74\x6F\x6B\x65\x6E\x20\x69\x6E\x68\x65\x72\x69\x74\x73\x20"\
-	"\x66\x72\x6F\x6D\x20\x61\x20\x73\x79\x6E\x74\x61\x78\x20\x73\x79\x6D\x62\x6F\x6C"\
-	"\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
-	"\x69\x74\x28\x74\x79\x70\x65\x2C\x20\x76\x61\x6C\x75\x65\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x2C\x20\x74\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x28\x63\x6F\x6C\x6F\x72\x29\x27\x20\x7C\x7C\x20\x74\x79"\
-	"\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x72\x61\x6E\x67\x65\x29\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20"\
-	"\x7B\x74\x79\x70\x65\x3A\x20\x74\x79\x70\x65\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70"\
-	"\x65\x20\x3D\x3D\x3D\x20\x27\x28\x70\x75\x6E\x63\x74\x75\x61\x74\x6F\x72\x29\x27"\
-	"\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x28\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E"\
-	"\x74\x69\x66\x69\x65\x72\x29\x27\x20\x26\x26\x20\x69\x73\x5F\x6F\x77\x6E\x28\x73"\
-	"\x79\x6E\x74\x61\x78\x2C\x20\x76\x61\x6C\x75\x65\x29\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x73\x79"\
-	"\x6E\x74\x61\x78\x5B\x76\x61\x6C\x75\x65\x5D\x20\x7C\x7C\x20\x73\x79\x6E\x74\x61"\
-	"\x78\x5B\x27\x28\x65\x72\x72\x6F\x72\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x73\x79\x6E\x74\x61"\
-	"\x78\x5B\x74\x79\x70\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x4F"\
-	"\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x74\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D"\
-	"\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x20\x7C\x7C\x20\x74\x79\x70\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x28\x72\x61\x6E\x67\x65\x29\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x73\x63\x72\x69\x70\x74\x75\x72\x6C\x20\x26\x26\x20\x6A"\
-	"\x78\x2E\x74\x65\x73\x74\x28\x76\x61\x6C\x75\x65\x29\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x41\x74\x28\x22\x53\x63\x72\x69\x70\x74\x20\x55\x52\x4C\x2E\x22"\
-	"\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x27\x6F"\
+	"\x70\x74\x69\x6F\x6E\x3A\x20\x6D\x61\x78\x6C\x65\x6E\x27\x2C\x20\x73\x74\x61\x72"\
+	"\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x43\x68\x65\x63\x6B\x20\x66\x6F\x72\x20\x74\x72\x61\x69\x6C\x69\x6E\x67\x20\x77"\
+	"\x68\x69\x74\x65\x73\x70\x61\x63\x65\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F"\
+	"\x73\x74\x5F\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x77\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28\x2F\x5C"\
+	"\x73\x2B\x24\x2F\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x74\x72\x61\x69\x6C\x69\x6E\x67\x20\x26"\
+	"\x26\x20\x7E\x74\x77\x20\x26\x26\x20\x21\x7E\x73\x2E\x73\x65\x61\x72\x63\x68\x28"\
+	"\x2F\x5E\x5C\x73\x2B\x24\x2F\x29\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x54\x72\x61"\
+	"\x69\x6C\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x2E\x22\x2C\x20"\
+	"\x6C\x69\x6E\x65\x2C\x20\x74\x77\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x27"\
+	"\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x74\x72\x61\x69\x6C\x69\x6E\x67\x27\x2C\x20\x73"\
+	"\x74\x61\x72\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65"\
+	"\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x4C"\
+	"\x69\x6E\x65\x20\x3D\x20\x74\x69\x6D\x65\x64\x28\x27\x6C\x65\x78\x65\x72\x3A\x20"\
+	"\x6E\x65\x78\x74\x4C\x69\x6E\x65\x27\x2C\x20\x6E\x65\x78\x74\x4C\x69\x6E\x65\x29"\
+	"\x3B\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x64\x75\x63\x65\x20\x61\x20\x74\x6F\x6B\x65"\
+	"\x6E\x20\x6F\x62\x6A\x65\x63\x74\x2E\x20\x20\x54\x68\x65\x20\x74\x6F\x6B\x65\x6E"\
+	"\x20\x69\x6E\x68\x65\x72\x69\x74\x73\x20\x66\x72\x6F\x6D\x20\x61\x20\x73\x79\x6E"\
+	"\x74\x61\x78\x20\x73\x79\x6D\x62\x6F\x6C\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x74\x28\x74\x79\x70\x65\x2C\x20\x76"\
+	"\x61\x6C\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x76\x61\x72\x20\x69\x2C\x20\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x63\x6F\x6C"\
+	"\x6F\x72\x29\x27\x20\x7C\x7C\x20\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x72"\
+	"\x61\x6E\x67\x65\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x7B\x74\x79\x70\x65\x3A\x20\x74\x79\x70"\
+	"\x65\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x70\x75"\
+	"\x6E\x63\x74\x75\x61\x74\x6F\x72\x29\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x74\x79\x70\x65\x20"\
+	"\x3D\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x20\x26"\
+	"\x26\x20\x69\x73\x5F\x6F\x77\x6E\x28\x73\x79\x6E\x74\x61\x78\x2C\x20\x76\x61\x6C"\
+	"\x75\x65\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x20\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x76\x61\x6C\x75\x65"\
+	"\x5D\x20\x7C\x7C\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x28\x65\x72\x72\x6F\x72\x29"\
+	"\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x74\x20\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x74\x79\x70\x65\x5D\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69"\
-	"\x66\x69\x65\x72\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x3D"\
-	"\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x5F\x5F"\
-	"\x69\x74\x65\x72\x61\x74\x6F\x72\x5F\x5F\x27\x20\x7C\x7C\x20\x76\x61\x6C\x75\x65"\
-	"\x20\x3D\x3D\x3D\x20\x27\x5F\x5F\x70\x72\x6F\x74\x6F\x5F\x5F\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x52\x65\x73\x65\x72\x76\x65\x64\x20\x6E\x61"\
-	"\x6D\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65"\
-	"\x2C\x20\x66\x72\x6F\x6D\x2C\x20\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
-	"\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x6D\x65\x6E\x20\x26\x26\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61"\
+	"\x74\x65\x28\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67"\
+	"\x29\x27\x20\x7C\x7C\x20\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x72\x61\x6E"\
+	"\x67\x65\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x63\x72\x69"\
+	"\x70\x74\x75\x72\x6C\x20\x26\x26\x20\x6A\x78\x2E\x74\x65\x73\x74\x28\x76\x61\x6C"\
+	"\x75\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x53\x63"\
+	"\x72\x69\x70\x74\x20\x55\x52\x4C\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72"\
+	"\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x20\x3D\x3D"\
+	"\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x69\x64"\
+	"\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x76\x61\x6C"\
+	"\x75\x65\x20\x3D\x3D\x3D\x20\x27\x5F\x5F\x69\x74\x65\x72\x61\x74\x6F\x72\x5F\x5F"\
+	"\x27\x20\x7C\x7C\x20\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x5F\x5F\x70\x72"\
+	"\x6F\x74\x6F\x5F\x5F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x52"\
+	"\x65\x73\x65\x72\x76\x65\x64\x20\x6E\x61\x6D\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x2C\x20\x76\x61"\
+	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E"\
+	"\x6E\x6F\x6D\x65\x6E\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x76\x61\x6C\x75\x65\x2E"\
+	"\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20\x27\x5F\x27\x20\x7C\x7C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75\x65\x2E\x63\x68\x61\x72\x41\x74\x28\x76"\
+	"\x61\x6C\x75\x65\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x29\x20\x3D\x3D\x3D"\
+	"\x20\x27\x5F\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22"\
+	"\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x7B\x61\x7D\x20\x69\x6E\x20\x27\x7B"\
+	"\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x2C\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x28\x76\x61\x6C\x75\x65\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20"\
-	"\x3D\x3D\x3D\x20\x27\x5F\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75"\
-	"\x65\x2E\x63\x68\x61\x72\x41\x74\x28\x76\x61\x6C\x75\x65\x2E\x6C\x65\x6E\x67\x74"\
-	"\x68\x20\x2D\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27\x5F\x27\x29\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64"\
-	"\x20\x7B\x61\x7D\x20\x69\x6E\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E"\
-	"\x65\x2C\x20\x66\x72\x6F\x6D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x22\x64\x61\x6E\x67\x6C\x69"\
-	"\x6E\x67\x20\x27\x5F\x27\x22\x2C\x20\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x22\x64\x61\x6E\x67\x6C\x69\x6E\x67\x20\x27\x5F\x27\x22\x2C\x20\x76"\
+	"\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D"\
+	"\x20\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x74\x2E\x6C\x69\x6E\x65\x20\x3D\x20\x6C\x69\x6E\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3D"\
+	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x2E\x66\x72\x6F\x6D\x20\x3D\x20\x66\x72\x6F\x6D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x74\x2E\x69\x64\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x21"\
+	"\x3D\x3D\x20\x27\x28\x65\x6E\x64\x6C\x69\x6E\x65\x29\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x72\x65\x67"\
+	"\x20\x3D\x20\x69\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x28\x28\x27\x28\x2C\x3D\x3A\x5B\x21\x26\x7C\x3F"\
+	"\x7B\x7D\x3B\x27\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x69\x2E\x63\x68\x61\x72\x41"\
+	"\x74\x28\x69\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x29\x29\x20\x3E\x3D\x20"\
+	"\x30\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x3D\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x50\x75\x62\x6C\x69\x63\x20"\
+	"\x6C\x65\x78\x20\x6D\x65\x74\x68\x6F\x64\x73\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x6E\x69\x74\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x73\x6F"\
+	"\x75\x72\x63\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x73\x6F\x75\x72\x63"\
+	"\x65\x20\x3D\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
+	"\x6E\x65\x73\x20\x3D\x20\x73\x6F\x75\x72\x63\x65\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65"\
+	"\x70\x6C\x61\x63\x65\x28\x2F\x5C\x72\x5C\x6E\x2F\x67\x2C\x20\x27\x5C\x6E\x27\x29"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5C\x72\x2F\x67\x2C"\
+	"\x20\x27\x5C\x6E\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x73\x70\x6C\x69\x74\x28\x27\x5C"\
+	"\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x73\x20\x3D\x20\x73\x6F"\
+	"\x75\x72\x63\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x2F\x2F\x20\x49\x66\x20\x74\x68\x65\x20\x66\x69\x72\x73\x74\x20\x6C\x69\x6E"\
+	"\x65\x20\x69\x73\x20\x61\x20\x73\x68\x65\x62\x61\x6E\x67\x20\x28\x23\x21\x29\x2C"\
+	"\x20\x6D\x61\x6B\x65\x20\x69\x74\x20\x61\x20\x62\x6C\x61\x6E\x6B\x20\x61\x6E\x64"\
+	"\x20\x6D\x6F\x76\x65\x20\x6F\x6E\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x53\x68\x65\x62\x61\x6E\x67\x73\x20\x61\x72"\
+	"\x65\x20\x75\x73\x65\x64\x20\x62\x79\x20\x4E\x6F\x64\x65\x20\x73\x63\x72\x69\x70"\
+	"\x74\x73\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6C\x69\x6E\x65\x73\x5B\x30\x5D\x20\x26\x26\x20\x6C\x69\x6E\x65"\
+	"\x73\x5B\x30\x5D\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x32\x29\x20\x3D\x3D"\
+	"\x20\x27\x23\x21\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x73\x5B\x30\x5D\x20\x3D\x20\x27\x27"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
+	"\x69\x6E\x65\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x61\x6E\x67\x65\x3A\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x62\x65\x67\x69\x6E\x2C\x20\x65\x6E\x64\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x63\x2C\x20\x76\x61\x6C\x75\x65\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D\x20"\
+	"\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28"\
+	"\x30\x29\x20\x21\x3D\x3D\x20\x62\x65\x67\x69\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F"\
+	"\x72\x41\x74\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20"\
+	"\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D"\
+	"\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63"\
+	"\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x62\x65\x67\x69\x6E\x2C\x20\x73\x2E\x63"\
+	"\x68\x61\x72\x41\x74\x28\x30\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x20\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x6C\x69\x6E\x65\x20\x3D\x20\x6C"\
-	"\x69\x6E\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x63"\
-	"\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3D\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2E\x66\x72\x6F\x6D"\
-	"\x20\x3D\x20\x66\x72\x6F\x6D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x20\x3D\x20\x74\x2E\x69\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x69\x20\x21\x3D\x3D\x20\x27\x28\x65\x6E\x64\x6C\x69"\
-	"\x6E\x65\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x70\x72\x65\x72\x65\x67\x20\x3D\x20\x69\x20\x26\x26\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x28"\
-	"\x27\x28\x2C\x3D\x3A\x5B\x21\x26\x7C\x3F\x7B\x7D\x3B\x27\x2E\x69\x6E\x64\x65\x78"\
-	"\x4F\x66\x28\x69\x2E\x63\x68\x61\x72\x41\x74\x28\x69\x2E\x6C\x65\x6E\x67\x74\x68"\
-	"\x20\x2D\x20\x31\x29\x29\x20\x3E\x3D\x20\x30\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x3D"\
-	"\x3D\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x2F\x2F\x20\x50\x75\x62\x6C\x69\x63\x20\x6C\x65\x78\x20\x6D\x65\x74\x68\x6F\x64"\
-	"\x73\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x69\x74\x3A\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x73\x6F\x75\x72\x63\x65\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79"\
-	"\x70\x65\x6F\x66\x20\x73\x6F\x75\x72\x63\x65\x20\x3D\x3D\x3D\x20\x27\x73\x74\x72"\
-	"\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x73\x20\x3D\x20\x73\x6F\x75\x72"\
-	"\x63\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C\x61\x63\x65\x28\x2F\x5C\x72\x5C"\
-	"\x6E\x2F\x67\x2C\x20\x27\x5C\x6E\x27\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2E\x72\x65\x70\x6C"\
-	"\x61\x63\x65\x28\x2F\x5C\x72\x2F\x67\x2C\x20\x27\x5C\x6E\x27\x29\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x2E\x73\x70\x6C\x69\x74\x28\x27\x5C\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20"\
+	"\x73\x2E\x73\x6C\x69\x63\x65\x28\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65"\
+	"\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x63\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22"\
+	"\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E"\
+	"\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x63\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6C\x69\x6E\x65\x73\x20\x3D\x20\x73\x6F\x75\x72\x63\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x49\x66\x20\x74\x68\x65"\
-	"\x20\x66\x69\x72\x73\x74\x20\x6C\x69\x6E\x65\x20\x69\x73\x20\x61\x20\x73\x68\x65"\
-	"\x62\x61\x6E\x67\x20\x28\x23\x21\x29\x2C\x20\x6D\x61\x6B\x65\x20\x69\x74\x20\x61"\
-	"\x20\x62\x6C\x61\x6E\x6B\x20\x61\x6E\x64\x20\x6D\x6F\x76\x65\x20\x6F\x6E\x2E\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x53"\
-	"\x68\x65\x62\x61\x6E\x67\x73\x20\x61\x72\x65\x20\x75\x73\x65\x64\x20\x62\x79\x20"\
-	"\x4E\x6F\x64\x65\x20\x73\x63\x72\x69\x70\x74\x73\x2E\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x69\x6E\x65\x73\x5B"\
-	"\x30\x5D\x20\x26\x26\x20\x6C\x69\x6E\x65\x73\x5B\x30\x5D\x2E\x73\x75\x62\x73\x74"\
-	"\x72\x28\x30\x2C\x20\x32\x29\x20\x3D\x3D\x20\x27\x23\x21\x27\x29\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E"\
-	"\x65\x73\x5B\x30\x5D\x20\x3D\x20\x27\x27\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x20\x3D\x20\x30\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x4C"\
-	"\x69\x6E\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x2C\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x61\x6E\x67\x65\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x62\x65"\
-	"\x67\x69\x6E\x2C\x20\x65\x6E\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x2C\x20\x76\x61\x6C\x75\x65"\
-	"\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x21\x3D\x3D\x20\x62\x65\x67"\
-	"\x69\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x45\x78\x70\x65\x63"\
-	"\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61"\
-	"\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20"\
-	"\x62\x65\x67\x69\x6E\x2C\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
-	"\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x6C\x69\x63\x65\x28\x31\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20"\
-	"\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63"\
-	"\x68\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x27\x3A\x0A\x20\x20\x20"\
+	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x65\x6E\x64\x3A\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x7B"\
-	"\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74"\
-	"\x65\x72\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x65\x6E\x64\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73"\
-	"\x6C\x69\x63\x65\x28\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74"\
-	"\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x69\x74\x28\x27\x28\x72\x61\x6E\x67\x65\x29\x27\x2C\x20\x76\x61\x6C\x75\x65\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27"\
-	"\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63"\
-	"\x74\x65\x72\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75\x65\x20\x2B\x3D\x20"\
-	"\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x0A\x0A\x2F\x2F"\
-	"\x20\x74\x6F\x6B\x65\x6E\x20\x2D\x2D\x20\x74\x68\x69\x73\x20\x69\x73\x20\x63\x61"\
-	"\x6C\x6C\x65\x64\x20\x62\x79\x20\x61\x64\x76\x61\x6E\x63\x65\x20\x74\x6F\x20\x67"\
-	"\x65\x74\x20\x74\x68\x65\x20\x6E\x65\x78\x74\x20\x74\x6F\x6B\x65\x6E\x2E\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x3A\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x63\x2C\x20\x63"\
-	"\x61\x70\x74\x75\x72\x65\x73\x2C\x20\x64\x2C\x20\x64\x65\x70\x74\x68\x2C\x20\x68"\
-	"\x69\x67\x68\x2C\x20\x69\x2C\x20\x6C\x2C\x20\x6C\x6F\x77\x2C\x20\x71\x2C\x20\x74"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6D\x61\x74\x63\x68\x28\x78\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x72\x20\x3D\x20\x78\x2E\x65\x78\x65\x63\x28\x73\x29\x2C\x20\x72\x31"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x72"\
-	"\x5B\x30\x5D\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x31\x20\x3D"\
-	"\x20\x72\x5B\x31\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x72\x31\x2E\x63\x68"\
-	"\x61\x72\x41\x74\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73"\
-	"\x75\x62\x73\x74\x72\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D"\
-	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x20\x6C\x20\x2D\x20\x72\x31\x2E"\
-	"\x6C\x65\x6E\x67\x74\x68\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65"\
-	"\x72\x20\x2B\x3D\x20\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x72"\
-	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x74\x72\x69\x6E\x67\x28\x78\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x63\x2C\x20\x6A\x2C\x20\x72\x20\x3D\x20\x27\x27\x3B\x0A\x0A"\
+	"\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x6C\x69\x63\x65\x28\x31\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x20\x26\x26\x20\x78\x20\x21\x3D"\
-	"\x3D\x20\x27\x22\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x41\x74\x28\x22\x53\x74\x72\x69\x6E\x67\x73\x20\x6D\x75\x73\x74\x20\x75\x73\x65"\
-	"\x20\x64\x6F\x75\x62\x6C\x65\x71\x75\x6F\x74\x65\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63"\
-	"\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x65\x73"\
-	"\x63\x28\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20\x70"\
-	"\x61\x72\x73\x65\x49\x6E\x74\x28\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6A\x20\x2B"\
-	"\x20\x31\x2C\x20\x6E\x29\x2C\x20\x31\x36\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x2B"\
-	"\x3D\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x33\x32"\
-	"\x20\x26\x26\x20\x69\x20\x3C\x3D\x20\x31\x32\x36\x20\x26\x26\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x72\x61\x6E\x67\x65"\
+	"\x29\x27\x2C\x20\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x5C"\
+	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E"\
+	"\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69"\
+	"\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x63\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x76\x61\x6C\x75\x65\x20\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x2C\x0A\x0A\x2F\x2F\x20\x74\x6F\x6B\x65\x6E\x20\x2D\x2D\x20"\
+	"\x74\x68\x69\x73\x20\x69\x73\x20\x63\x61\x6C\x6C\x65\x64\x20\x62\x79\x20\x61\x64"\
+	"\x76\x61\x6E\x63\x65\x20\x74\x6F\x20\x67\x65\x74\x20\x74\x68\x65\x20\x6E\x65\x78"\
+	"\x74\x20\x74\x6F\x6B\x65\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x6F\x6B\x65\x6E\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
+	"\x61\x72\x20\x62\x2C\x20\x63\x2C\x20\x63\x61\x70\x74\x75\x72\x65\x73\x2C\x20\x64"\
+	"\x2C\x20\x64\x65\x70\x74\x68\x2C\x20\x68\x69\x67\x68\x2C\x20\x69\x2C\x20\x6C\x2C"\
+	"\x20\x6C\x6F\x77\x2C\x20\x71\x2C\x20\x74\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6D\x61"\
+	"\x74\x63\x68\x28\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x20\x3D\x20\x78\x2E\x65"\
+	"\x78\x65\x63\x28\x73\x29\x2C\x20\x72\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x72\x5B\x30\x5D\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x31\x20\x3D\x20\x72\x5B\x31\x5D\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x21\x3D\x3D\x20\x33\x34\x20\x26\x26\x20"\
-	"\x69\x20\x21\x3D\x3D\x20\x39\x32\x20\x26\x26\x20\x69\x20\x21\x3D\x3D\x20\x33\x39"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41"\
-	"\x74\x28\x22\x55\x6E\x6E\x65\x63\x65\x73\x73\x61\x72\x79\x20\x65\x73\x63\x61\x70"\
-	"\x65\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61"\
-	"\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61"\
-	"\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D"\
-	"\x20\x53\x74\x72\x69\x6E\x67\x2E\x66\x72\x6F\x6D\x43\x68\x61\x72\x43\x6F\x64\x65"\
-	"\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B"\
-	"\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6A\x20\x3E\x3D"\
-	"\x20\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x20\x3D\x20\x72\x31\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6A\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x21\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6C\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x63\x6C"\
-	"\x6F\x73\x65\x64\x20\x73\x74\x72\x69\x6E\x67\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C"\
-	"\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x3D\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
+	"\x20\x2B\x20\x6C\x20\x2D\x20\x72\x31\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74"\
-	"\x28\x6A\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x78"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65"\
-	"\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20"\
-	"\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6A\x20\x2B\x20\x31\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x6C\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x73\x74\x72"\
-	"\x69\x6E\x67\x29\x27\x2C\x20\x72\x2C\x20\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x72\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73"\
+	"\x74\x72\x69\x6E\x67\x28\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x2C\x20\x6A\x2C"\
+	"\x20\x72\x20\x3D\x20\x27\x27\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F"\
+	"\x64\x65\x20\x26\x26\x20\x78\x20\x21\x3D\x3D\x20\x27\x22\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x53\x74\x72\x69\x6E\x67"\
+	"\x73\x20\x6D\x75\x73\x74\x20\x75\x73\x65\x20\x64\x6F\x75\x62\x6C\x65\x71\x75\x6F"\
+	"\x74\x65\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
+	"\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x65\x73\x63\x28\x6E\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x20\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x76\x61\x72\x20\x69\x20\x3D\x20\x70\x61\x72\x73\x65\x49\x6E\x74\x28\x73\x2E"\
+	"\x73\x75\x62\x73\x74\x72\x28\x6A\x20\x2B\x20\x31\x2C\x20\x6E\x29\x2C\x20\x31\x36"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x2B\x3D\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x69\x20\x3E\x3D\x20\x33\x32\x20\x26\x26\x20\x69\x20\x3C\x3D\x20\x31"\
+	"\x32\x36\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20"\
+	"\x21\x3D\x3D\x20\x33\x34\x20\x26\x26\x20\x69\x20\x21\x3D\x3D\x20\x39\x32\x20\x26"\
+	"\x26\x20\x69\x20\x21\x3D\x3D\x20\x33\x39\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x6E"\
-	"\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x72\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x6E\x65\x63\x65\x73"\
+	"\x73\x61\x72\x79\x20\x65\x73\x63\x61\x70\x65\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C"\
+	"\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20"\
+	"\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x53\x74\x72\x69\x6E\x67\x2E\x66\x72"\
+	"\x6F\x6D\x43\x68\x61\x72\x43\x6F\x64\x65\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x3D"\
+	"\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x68\x69\x6C\x65\x20\x28\x6A\x20\x3E\x3D\x20\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x3D\x20\x30\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28"\
+	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72"\
+	"\x6F\x72\x41\x74\x28\x22\x55\x6E\x63\x6C\x6F\x73\x65\x64\x20\x73\x74\x72\x69\x6E"\
+	"\x67\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x41\x74\x28\x22\x43\x6F\x6E\x74\x72\x6F\x6C\x20\x63\x68\x61\x72\x61"\
-	"\x63\x74\x65\x72\x20\x69\x6E\x20\x73\x74\x72\x69\x6E\x67\x3A\x20\x7B\x61\x7D\x2E"\
-	"\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
-	"\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x20\x6A\x2C\x20"\
-	"\x73\x2E\x73\x6C\x69\x63\x65\x28\x30\x2C\x20\x6A\x29\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20"\
+	"\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6A\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x5C"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x2B\x3D\x20\x31\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63"\
-	"\x68\x61\x72\x41\x74\x28\x6A\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77"\
-	"\x69\x74\x63\x68\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6A"\
+	"\x20\x2B\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x69\x74\x28\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x2C\x20\x72\x2C\x20"\
+	"\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20"\
+	"\x3C\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x6E\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D"\
+	"\x20\x27\x5C\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x43\x6F\x6E"\
+	"\x74\x72\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x69\x6E\x20\x73\x74"\
+	"\x72\x69\x6E\x67\x3A\x20\x7B\x61\x7D\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61"\
+	"\x63\x74\x65\x72\x20\x2B\x20\x6A\x2C\x20\x73\x2E\x73\x6C\x69\x63\x65\x28\x30\x2C"\
+	"\x20\x6A\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20"\
+	"\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5C\x5C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6A\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x22\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C"\
-	"\x27\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x41"\
-	"\x76\x6F\x69\x64\x20\x5C\x5C\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68"\
-	"\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6A\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
-	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x62\x27\x3A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x63\x29\x20\x7B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x62"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x27\x3A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x66\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x6E\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x22\x27\x3A\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x6E\x27\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x72\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x72\x27\x3B\x0A"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x27\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x41\x76\x6F\x69\x64\x20\x5C\x5C\x27\x2E\x22"\
+	"\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x74\x27\x3A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x74\x27\x3B\x0A\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x62\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x62\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73\x63\x28\x34\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x63\x61\x73\x65\x20\x27\x66\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x20\x3D\x20\x27\x5C\x66\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x76\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x41\x74\x28\x22\x41\x76\x6F\x69\x64\x20\x5C\x5C\x76\x2E\x22\x2C"\
-	"\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20"\
+	"\x20\x63\x20\x3D\x20\x27\x5C\x6E\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x5C\x76\x27\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x63\x20\x3D\x20\x27\x5C\x72\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
+	"\x65\x20\x27\x74\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x20\x3D\x20\x27\x5C\x74\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x61\x73\x65\x20\x27\x78\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x75\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73"\
+	"\x63\x28\x34\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
+	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x76"\
+	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A"\
+	"\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x41\x76"\
+	"\x6F\x69\x64\x20\x5C\x5C\x76\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61"\
+	"\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x41\x74\x28\x22\x41\x76\x6F\x69\x64\x20\x5C\x5C\x78\x2D\x2E\x22\x2C"\
-	"\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27"\
+	"\x5C\x76\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x78\x27"\
+	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73"\
+	"\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x41\x76\x6F"\
+	"\x69\x64\x20\x5C\x5C\x78\x2D\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61"\
+	"\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x65\x73\x63\x28\x32\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x73\x63\x28\x32"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74"\
+	"\x28\x22\x42\x61\x64\x20\x65\x73\x63\x61\x70\x65\x6D\x65\x6E\x74\x2E\x22\x2C\x20"\
+	"\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x20"\
+	"\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20"\
+	"\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
+	"\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x42\x61\x64\x20\x65\x73\x63\x61"\
-	"\x70\x65\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72"\
-	"\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28\x29"\
+	"\x20\x3F\x20\x27\x28\x65\x6E\x64\x6C\x69\x6E\x65\x29\x27\x20\x3A\x20\x27\x28\x65"\
+	"\x6E\x64\x29\x27\x2C\x20\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6D\x61\x74"\
+	"\x63\x68\x28\x74\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x74\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x20\x2B\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x74\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x27"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x73\x20\x26\x26\x20\x73\x20"\
+	"\x3C\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D"\
+	"\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6A\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64"\
+	"\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72"\
+	"\x61\x63\x74\x65\x72\x2C\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x31"\
+	"\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x21\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28"\
-	"\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28\x29\x20\x3F\x20\x27\x28\x65\x6E\x64\x6C\x69"\
-	"\x6E\x65\x29\x27\x20\x3A\x20\x27\x28\x65\x6E\x64\x29\x27\x2C\x20\x27\x27\x29\x3B"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x0A"\
+	"\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x69\x64\x65\x6E\x74\x69\x66\x69"\
+	"\x65\x72\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x73\x41\x6C\x70\x68"\
+	"\x61\x28\x29\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x5F\x27\x20\x7C\x7C\x20"\
+	"\x63\x20\x3D\x3D\x3D\x20\x27\x24\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x69\x64\x65\x6E\x74\x69\x66"\
+	"\x69\x65\x72\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x6E\x75\x6D\x62\x65\x72\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x73\x44\x69\x67\x69\x74\x28\x29\x29\x20\x7B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x20\x3D\x20\x6D\x61\x74\x63\x68\x28\x74\x78\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x21\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x27\x27\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x69\x73\x46\x69\x6E\x69"\
+	"\x74\x65\x28\x4E\x75\x6D\x62\x65\x72\x28\x74\x29\x29\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C"\
-	"\x65\x20\x28\x73\x20\x26\x26\x20\x73\x20\x3C\x20\x27\x21\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22"\
+	"\x42\x61\x64\x20\x6E\x75\x6D\x62\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28"\
-	"\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22"\
-	"\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20"\
-	"\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x73\x2E\x73"\
-	"\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x31\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65"\
+	"\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20"\
-	"\x20\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x63\x2E\x69\x73\x41\x6C\x70\x68\x61\x28\x29\x20\x7C\x7C\x20\x63\x20\x3D"\
-	"\x3D\x3D\x20\x27\x5F\x27\x20\x7C\x7C\x20\x63\x20\x3D\x3D\x3D\x20\x27\x24\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74"\
-	"\x28\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x2C\x20\x74\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x75\x6D\x62\x65\x72\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x73"\
-	"\x44\x69\x67\x69\x74\x28\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x21\x69\x73\x46\x69\x6E\x69\x74\x65\x28\x4E\x75\x6D\x62\x65\x72\x28"\
-	"\x74\x29\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
+	"\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x31\x29\x2E\x69\x73\x41\x6C\x70\x68"\
+	"\x61\x28\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x42\x61\x64\x20\x6E\x75\x6D\x62\x65\x72"\
-	"\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x73\x70"\
+	"\x61\x63\x65\x20\x61\x66\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65"\
-	"\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
+	"\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C"\
-	"\x20\x31\x29\x2E\x69\x73\x41\x6C\x70\x68\x61\x28\x29\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x30\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22"\
-	"\x4D\x69\x73\x73\x69\x6E\x67\x20\x73\x70\x61\x63\x65\x20\x61\x66\x74\x65\x72\x20"\
-	"\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x64\x20\x3D\x20\x74\x2E\x73\x75\x62\x73\x74\x72\x28"\
+	"\x31\x2C\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x64\x2E\x69\x73\x44\x69\x67\x69\x74\x28\x29\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61"\
-	"\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x30"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x20\x3D"\
-	"\x20\x74\x2E\x73\x75\x62\x73\x74\x72\x28\x31\x2C\x20\x31\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x44\x6F\x6E\x27\x74\x20\x75\x73\x65\x20\x65"\
+	"\x78\x74\x72\x61\x20\x6C\x65\x61\x64\x69\x6E\x67\x20\x7A\x65\x72\x6F\x73\x20\x27"\
+	"\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x2E\x69\x73\x44\x69\x67"\
-	"\x69\x74\x28\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68"\
+	"\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D"\
-	"\x20\x27\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x44"\
-	"\x6F\x6E\x27\x74\x20\x75\x73\x65\x20\x65\x78\x74\x72\x61\x20\x6C\x65\x61\x64\x69"\
-	"\x6E\x67\x20\x7A\x65\x72\x6F\x73\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F"\
+	"\x64\x65\x20\x26\x26\x20\x28\x64\x20\x3D\x3D\x3D\x20\x27\x78\x27\x20\x7C\x7C\x20"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x58\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28"\
+	"\x22\x41\x76\x6F\x69\x64\x20\x30\x78\x2D\x2E\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x20\x26\x26\x20\x28\x64\x20\x3D"\
-	"\x3D\x3D\x20\x27\x78\x27\x20\x7C\x7C\x20\x64\x20\x3D\x3D\x3D\x20\x27\x58\x27\x29"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x41\x76\x6F\x69\x64\x20\x30\x78\x2D"\
-	"\x2E\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C"\
-	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
+	"\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x73\x75\x62\x73\x74\x72"\
-	"\x28\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x41\x20\x74\x72\x61\x69\x6C\x69\x6E\x67"\
-	"\x20\x64\x65\x63\x69\x6D\x61\x6C\x20\x70\x6F\x69\x6E\x74\x20\x63\x61\x6E\x20\x62"\
-	"\x65\x20\x63\x6F\x6E\x66\x75\x73\x65\x64\x20\x77\x69\x74\x68\x20\x61\x20\x64\x6F"\
-	"\x74\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61"\
-	"\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28"\
-	"\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x74\x29\x20\x7B\x0A\x0A"\
-	"\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x73\x74\x72\x69\x6E\x67\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x22\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x22\x27\x22\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
-	"\x72\x6E\x20\x73\x74\x72\x69\x6E\x67\x28\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F"\
-	"\x2F\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x74\x2E\x73\x75\x62\x73\x74\x72\x28\x74\x2E\x6C\x65\x6E\x67\x74\x68\x20"\
+	"\x2D\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22"\
+	"\x41\x20\x74\x72\x61\x69\x6C\x69\x6E\x67\x20\x64\x65\x63\x69\x6D\x61\x6C\x20\x70"\
+	"\x6F\x69\x6E\x74\x20\x63\x61\x6E\x20\x62\x65\x20\x63\x6F\x6E\x66\x75\x73\x65\x64"\
+	"\x20\x77\x69\x74\x68\x20\x61\x20\x64\x6F\x74\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C"\
+	"\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x20\x74\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x73\x72\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27"\
+	"\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74"\
+	"\x63\x68\x20\x28\x74\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20"\
+	"\x20\x20\x73\x74\x72\x69\x6E\x67\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x22\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x22\x27\x22\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x73\x74\x72\x69\x6E\x67\x28"\
+	"\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x2F\x2F\x20"\
+	"\x63\x6F\x6D\x6D\x65\x6E\x74\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F"\
+	"\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x72\x63\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D"\
+	"\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63"\
+	"\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x78"\
-	"\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x73\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x27\x27"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x2E\x63\x6F\x6D\x6D"\
-	"\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x2F\x2A\x20\x63\x6F\x6D\x6D\x65\x6E\x74"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x27\x3A\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x2A\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x2F\x2A\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
-	"\x72\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x63\x6F\x6D\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61"\
-	"\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x72\x63\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55"\
+	"\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x2E\x22\x2C"\
+	"\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x73\x2E\x73\x65\x61\x72"\
-	"\x63\x68\x28\x6C\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
+	"\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x69\x20\x3D\x20\x73\x2E\x73\x65\x61\x72\x63\x68\x28\x6C\x78\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x30"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x65"\
+	"\x78\x74\x4C\x69\x6E\x65\x28\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x65\x78\x74\x4C\x69\x6E\x65\x28\x29\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72"\
-	"\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x63\x6C\x6F\x73\x65\x64\x20\x63\x6F\x6D\x6D"\
-	"\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74"\
-	"\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x63"\
+	"\x6C\x6F\x73\x65\x64\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E"\
+	"\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61"\
-	"\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x69\x20\x2B\x20\x32\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x69\x2C"\
-	"\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x4E\x65\x73\x74"\
-	"\x65\x64\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20"\
-	"\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20"\
+	"\x69\x20\x2B\x20\x32\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
+	"\x2E\x73\x75\x62\x73\x74\x72\x28\x69\x2C\x20\x31\x29\x20\x3D\x3D\x3D\x20\x27\x2F"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72"\
+	"\x6F\x72\x41\x74\x28\x22\x4E\x65\x73\x74\x65\x64\x20\x63\x6F\x6D\x6D\x65\x6E\x74"\
+	"\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73"\
-	"\x74\x72\x28\x69\x20\x2B\x20\x32\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x3D\x20\x74\x72\x75\x65\x3B"\
+	"\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x69\x20\x2B\x20\x32\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x73\x20\x2F"\
-	"\x2A\x6A\x73\x68\x69\x6E\x74\x20\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x2E\x63\x6F\x6D\x6D\x65"\
+	"\x6E\x74\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2A\x6D\x65\x6D\x62\x65\x72\x73\x20\x2F\x2A\x6A\x73\x68\x69\x6E\x74\x20\x2F\x2A"\
+	"\x67\x6C\x6F\x62\x61\x6C\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A"\
+	"\x6D\x65\x6D\x62\x65\x72\x73\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
+	"\x27\x2F\x2A\x6A\x73\x68\x69\x6E\x74\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x2F\x2A\x6A\x73\x6C\x69\x6E\x74\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
+	"\x65\x20\x27\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x2A\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x6C\x75\x65\x3A\x20\x74\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x73\x27\x3A\x0A"\
+	"\x74\x79\x70\x65\x3A\x20\x27\x73\x70\x65\x63\x69\x61\x6C\x27\x2C\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x27\x3A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x6C\x69\x6E\x65\x2C"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x6A\x73\x68\x69\x6E\x74\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x6A\x73\x6C\x69\x6E\x74"\
-	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x2A\x67\x6C\x6F\x62\x61"\
-	"\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2A\x2F\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74"\
+	"\x65\x72\x3A\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x3A\x20\x66\x72\x6F\x6D\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75\x65\x3A\x20\x74\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2F\x3D\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x79\x70\x65\x3A\x20\x27\x73\x70\x65"\
-	"\x63\x69\x61\x6C\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
-	"\x69\x6E\x65\x3A\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x0A"\
+	"\x22\x41\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
+	"\x6E\x20\x6C\x69\x74\x65\x72\x61\x6C\x20\x63\x61\x6E\x20\x62\x65\x20\x63\x6F\x6E"\
+	"\x66\x75\x73\x65\x64\x20\x77\x69\x74\x68\x20\x27\x2F\x3D\x27\x2E\x22\x2C\x20\x6C"\
+	"\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3A\x20\x63\x68\x61\x72\x61\x63"\
-	"\x74\x65\x72\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F"\
-	"\x6D\x3A\x20\x66\x72\x6F\x6D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x0A"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x72\x65\x67"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x70\x74"\
+	"\x68\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x70\x74\x75\x72\x65\x73\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20"\
-	"\x2F\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
-	"\x20\x27\x2F\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x74\x72\x75\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D"\
+	"\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x0A\x22\x41\x20\x72\x65\x67\x75\x6C\x61\x72"\
-	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x6C\x69\x74\x65\x72\x61\x6C\x20"\
-	"\x63\x61\x6E\x20\x62\x65\x20\x63\x6F\x6E\x66\x75\x73\x65\x64\x20\x77\x69\x74\x68"\
-	"\x20\x27\x2F\x3D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x70\x72\x65\x72\x65\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68"\
+	"\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x64\x65\x70\x74\x68\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x70\x74\x75\x72\x65\x73\x20\x3D\x20"\
-	"\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x30"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B"\
-	"\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28"\
+	"\x22\x55\x6E\x63\x6C\x6F\x73\x65\x64\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78"\
+	"\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28"\
-	"\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
+	"\x65\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x65\x70\x74\x68\x20\x3E\x20\x30"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55"\
+	"\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x63\x6C\x6F\x73\x65\x64\x20"\
-	"\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x64\x65\x70\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27"\
-	"\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x2B\x20\x6C\x2C\x20\x27\x2F\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x2F\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E"\
+	"\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x6C\x20\x2D\x20\x31\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20"\
-	"\x6C\x20\x2D\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20"\
+	"\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x67\x3A\x20\x74\x72\x75\x65\x2C\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x67\x3A"\
-	"\x20\x74\x72\x75\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x3A\x20\x74\x72\x75\x65\x2C\x0A"\
+	"\x20\x69\x3A\x20\x74\x72\x75\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x3A\x20\x74\x72\x75"\
+	"\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6D\x3A\x20\x74\x72\x75\x65\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x71\x5B\x73\x2E\x63\x68\x61\x72"\
+	"\x41\x74\x28\x6C\x29\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
-	"\x20\x28\x71\x5B\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x5D\x20\x3D\x3D\x3D"\
-	"\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x5B\x73\x2E\x63\x68\x61"\
-	"\x72\x41\x74\x28\x6C\x29\x5D\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x71\x5B\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x5D\x20\x3D\x20"\
+	"\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x6C\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
-	"\x20\x2B\x3D\x20\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D"\
+	"\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28"\
-	"\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x73\x2E"\
+	"\x63\x68\x61\x72\x41\x74\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x71\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x3B"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x71\x20\x3D\x3D\x3D"\
+	"\x20\x27\x2F\x27\x20\x7C\x7C\x20\x71\x20\x3D\x3D\x3D\x20\x27\x2A\x27\x29\x20\x7B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x71\x20\x3D\x3D\x3D\x20\x27\x2F\x27\x20\x7C\x7C\x20\x71\x20"\
-	"\x3D\x3D\x3D\x20\x27\x2A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72"\
-	"\x41\x74\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x72\x65\x67\x75\x6C\x61"\
-	"\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x43\x6F\x6E\x66\x75\x73"\
+	"\x69\x6E\x67\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
+	"\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
+	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x69\x74\x28\x27\x28\x72\x65\x67\x65\x78\x70\x29\x27\x2C\x20\x63\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x72\x65\x67\x65\x78"\
-	"\x70\x29\x27\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
+	"\x27\x5C\x5C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20"\
-	"\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C"\
-	"\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41"\
-	"\x74\x28\x0A\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6E\x74\x72"\
-	"\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x69\x6E\x20\x72\x65\x67\x75"\
-	"\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x55\x6E\x65\x78\x70\x65"\
+	"\x63\x74\x65\x64\x20\x63\x6F\x6E\x74\x72\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74"\
+	"\x65\x72\x20\x69\x6E\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73"\
+	"\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B"\
+	"\x20\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
-	"\x65\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x3C\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x63\x20\x3D\x3D"\
+	"\x3D\x20\x27\x3C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x41\x74\x28\x0A\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x65\x73\x63\x61"\
+	"\x70\x65\x64\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x20"\
+	"\x69\x6E\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
+	"\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C"\
+	"\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x55\x6E\x65\x78\x70"\
-	"\x65\x63\x74\x65\x64\x20\x65\x73\x63\x61\x70\x65\x64\x20\x63\x68\x61\x72\x61\x63"\
-	"\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x20\x69\x6E\x20\x72\x65\x67\x75\x6C\x61\x72"\
-	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C"\
-	"\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x28\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x70\x74\x68\x20\x2B\x3D\x20\x31\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x28\x27\x3A\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65"\
-	"\x70\x74\x68\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61"\
+	"\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D"\
-	"\x20\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A"\
+	"\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68"\
+	"\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74"\
-	"\x28\x6C\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3A\x27\x3A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x3A\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3D\x27\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
+	"\x27\x3D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x21\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x21\x27\x3A\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C"\
+	"\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65"\
-	"\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20"\
-	"\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66"\
-	"\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x3A\x27\x2C\x20\x73\x2E\x63\x68\x61\x72"\
-	"\x41\x74\x28\x6C\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74"\
+	"\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E"\
+	"\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E"\
+	"\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27"\
+	"\x3A\x27\x2C\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x70\x74\x75\x72\x65\x73\x20\x2B\x3D\x20\x31"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x70"\
+	"\x74\x75\x72\x65\x73\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7C\x27\x3A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
+	"\x65\x20\x27\x7C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D"\
-	"\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
+	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x29\x27\x3A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x29\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x64\x65\x70\x74\x68\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x65\x70\x74\x68"\
+	"\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27"\
+	"\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63"\
-	"\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65"\
+	"\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x29\x27\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C"\
-	"\x2C\x20\x27\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x70\x74\x68\x20\x2D\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x64\x65\x70\x74\x68\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x20\x27\x3A\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20"\
+	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x20\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74"\
+	"\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
+	"\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65"\
-	"\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x20"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x71\x20\x3E\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x71\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x53\x70\x61\x63\x65\x73\x20\x61\x72\x65"\
+	"\x20\x68\x61\x72\x64\x20\x74\x6F\x20\x63\x6F\x75\x6E\x74\x2E\x20\x55\x73\x65\x20"\
+	"\x7B\x7B\x61\x7D\x7D\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20"\
+	"\x2B\x20\x6C\x2C\x20\x71\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x71\x20\x3E\x20\x31"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22"\
-	"\x53\x70\x61\x63\x65\x73\x20\x61\x72\x65\x20\x68\x61\x72\x64\x20\x74\x6F\x20\x63"\
-	"\x6F\x75\x6E\x74\x2E\x20\x55\x73\x65\x20\x7B\x7B\x61\x7D\x7D\x2E\x22\x2C\x20\x6C"\
-	"\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x71\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5E\x27\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E"\
-	"\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D"\
-	"\x20\x27\x5E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x72\x65\x67\x65\x78\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x49\x6E\x73\x65\x63\x75"\
+	"\x72\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x72\x65\x67\x65\x78"\
-	"\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x41\x74\x28\x22\x49\x6E\x73\x65\x63\x75\x72\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B"\
+	"\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
+	"\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27"\
+	"\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41"\
+	"\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41"\
-	"\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20"\
+	"\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x5E\x27\x29\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70"\
-	"\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20"\
-	"\x27\x5E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x71\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63"\
+	"\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x41\x74\x28\x22\x45\x6D\x70\x74\x79\x20\x63\x6C\x61\x73\x73\x2E\x22"\
+	"\x2C\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x66\x61"\
-	"\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x20\x2D\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x45\x6D\x70"\
-	"\x74\x79\x20\x63\x6C\x61\x73\x73\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71"\
+	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x6B\x6C\x61\x73\x73\x3A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x20\x2D"\
-	"\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x6B\x6C\x61\x73\x73\x3A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x64\x6F\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72"\
-	"\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20"\
+	"\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
-	"\x5E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70"\
+	"\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41"\
-	"\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
-	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B"\
+	"\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2D\x27\x3A\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
-	"\x27\x2D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x71\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x71\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x66\x61"\
-	"\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x71\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27"\
-	"\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20"\
-	"\x27\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63"\
+	"\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20"\
-	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20"\
+	"\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
-	"\x65\x20\x27\x5D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
-	"\x71\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x72\x65\x67\x65\x78\x64\x61"\
-	"\x73\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27"\
-	"\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
+	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5D\x27\x3A\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B"\
-	"\x20\x6C\x20\x2D\x20\x31\x2C\x20\x27\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x71\x20\x26\x26\x20\x21\x6F\x70\x74\x69"\
+	"\x6F\x6E\x2E\x72\x65\x67\x65\x78\x64\x61\x73\x68\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x20\x6B\x6C"\
-	"\x61\x73\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55"\
+	"\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69"\
+	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x20\x2D\x20\x31\x2C\x20\x27\x2D"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74"\
-	"\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C"\
-	"\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x62\x72\x65\x61\x6B\x20\x6B\x6C\x61\x73\x73\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x55\x6E\x65\x78\x70\x65\x63\x74"\
-	"\x65\x64\x20\x63\x6F\x6E\x74\x72\x6F\x6C\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
-	"\x20\x69\x6E\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
-	"\x6F\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x5C\x5C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
-	"\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x3C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20"\
+	"\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x55"\
-	"\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x65\x73\x63\x61\x70\x65\x64\x20\x63\x68"\
-	"\x61\x72\x61\x63\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x20\x69\x6E\x20\x72\x65\x67"\
-	"\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C"\
-	"\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x20\x27\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28"\
+	"\x0A\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6E\x74\x72\x6F\x6C"\
+	"\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x69\x6E\x20\x72\x65\x67\x75\x6C\x61"\
+	"\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65"\
+	"\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x3C"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20"\
+	"\x65\x73\x63\x61\x70\x65\x64\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x27\x7B"\
+	"\x61\x7D\x27\x20\x69\x6E\x20\x72\x65\x67\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65"\
+	"\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20"\
+	"\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64"\
-	"\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C"\
-	"\x20\x2D\x20\x31\x2C\x20\x27\x2F\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2F\x27"\
+	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3C\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28"\
+	"\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65"\
+	"\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x20\x2D\x20\x31\x2C\x20\x27\x2F\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61"\
-	"\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x3C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x71\x20\x3D"\
+	"\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x77\x68\x69\x6C\x65\x20\x28\x63\x29"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2E\x27\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x72\x65\x67\x65\x78\x70\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x71\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x49\x6E\x73\x65\x63\x75\x72\x65\x20"\
-	"\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x77\x68\x69\x6C\x65\x20\x28\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
+	"\x27\x2E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x72\x65\x67\x65"\
+	"\x78\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5D\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28"\
+	"\x22\x49\x6E\x73\x65\x63\x75\x72\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C"\
+	"\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3F\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F"\
+	"\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2B\x27\x3A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x2A\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65"\
-	"\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x27\x5D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20"\
-	"\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x61\x73\x65\x20\x27\x3F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x73\x2E\x63\x68\x61"\
-	"\x72\x41\x74\x28\x6C\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x7D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3F\x27\x3A\x0A"\
+	"\x63\x61\x73\x65\x20\x27\x2B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2A\x27\x3A\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x2B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x41\x74\x28\x22\x55\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x27\x7B\x61"\
+	"\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2A\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x3F\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69"\
+	"\x74\x63\x68\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x29\x20\x7B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x61\x73\x65\x20\x27\x3F\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2B\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x7B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x63\x61\x73\x65\x20\x27\x2A\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C"\
+	"\x29\x20\x3D\x3D\x3D\x20\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x30\x27\x20\x7C\x7C\x20\x63\x20"\
-	"\x3E\x20\x27\x39\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20"\
-	"\x6E\x75\x6D\x62\x65\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73"\
-	"\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72"\
-	"\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x6F\x77\x20\x3D\x20"\
-	"\x2B\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68"\
+	"\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C"\
+	"\x20\x27\x30\x27\x20\x7C\x7C\x20\x63\x20\x3E\x20\x27\x39\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28"\
-	"\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20"\
-	"\x27\x30\x27\x20\x7C\x7C\x20\x63\x20\x3E\x20\x27\x39\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x45"\
+	"\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x6E\x75\x6D\x62\x65\x72\x20\x61\x6E\x64"\
+	"\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
+	"\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x63\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6C\x6F\x77\x20\x3D\x20\x2B\x63\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20"\
-	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F"\
+	"\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x6F\x77\x20\x3D\x20\x2B\x63\x20"\
-	"\x2B\x20\x28\x6C\x6F\x77\x20\x2A\x20\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D"\
+	"\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x30\x27\x20\x7C\x7C\x20\x63\x20\x3E"\
+	"\x20\x27\x39\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x68\x69\x67\x68\x20\x3D\x20\x6C\x6F\x77\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x68\x69\x67\x68\x20\x3D\x20\x49\x6E\x66\x69\x6E\x69\x74\x79\x3B\x0A\x20\x20"\
+	"\x20\x6C\x6F\x77\x20\x3D\x20\x2B\x63\x20\x2B\x20\x28\x6C\x6F\x77\x20\x2A\x20\x31"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x69\x67\x68\x20\x3D"\
+	"\x20\x6C\x6F\x77\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3E\x3D\x20"\
-	"\x27\x30\x27\x20\x26\x26\x20\x63\x20\x3C\x3D\x20\x27\x39\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3D\x3D\x3D\x20"\
+	"\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20"\
+	"\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x69\x67\x68\x20\x3D\x20\x49\x6E"\
+	"\x66\x69\x6E\x69\x74\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20"\
+	"\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x69\x67\x68\x20\x3D\x20\x2B\x63"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B"\
-	"\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x63\x20\x3E\x3D\x20\x27\x30\x27\x20\x26\x26\x20\x63\x20\x3C"\
+	"\x3D\x20\x27\x39\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20"\
+	"\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20"\
-	"\x3C\x20\x27\x30\x27\x20\x7C\x7C\x20\x63\x20\x3E\x20\x27\x39\x27\x29\x20\x7B\x0A"\
+	"\x20\x68\x69\x67\x68\x20\x3D\x20\x2B\x63\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x63\x68\x61"\
+	"\x72\x41\x74\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x63\x20\x3C\x20\x27\x30\x27\x20\x7C\x7C\x20\x63"\
+	"\x20\x3E\x20\x27\x39\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x68\x69\x67\x68\x20\x3D\x20\x2B\x63\x20\x2B\x20\x28\x68\x69"\
-	"\x67\x68\x20\x2A\x20\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x69\x67\x68\x20"\
+	"\x3D\x20\x2B\x63\x20\x2B\x20\x28\x68\x69\x67\x68\x20\x2A\x20\x31\x30\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20"\
-	"\x21\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61"\
-	"\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F"\
-	"\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x7D\x27\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E"\
+	"\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x21\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A"\
+	"\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20"\
+	"\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C"\
+	"\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x27\x7D\x27"\
+	"\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
-	"\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29\x20\x3D\x3D\x3D\x20\x27\x3F\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x6F\x77\x20\x3E\x20\x68\x69"\
-	"\x67\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x2E\x63\x68\x61\x72\x41\x74\x28\x6C\x29"\
+	"\x20\x3D\x3D\x3D\x20\x27\x3F\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x41\x74\x28\x0A\x22\x27\x7B\x61\x7D\x27\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E"\
-	"\x6F\x74\x20\x62\x65\x20\x67\x72\x65\x61\x74\x65\x72\x20\x74\x68\x61\x6E\x20\x27"\
-	"\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B"\
-	"\x20\x6C\x2C\x20\x6C\x6F\x77\x2C\x20\x68\x69\x67\x68\x29\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6C\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6C\x6F\x77\x20\x3E\x20\x68\x69\x67\x68\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72"\
-	"\x28\x30\x2C\x20\x6C\x20\x2D\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x0A\x22\x27\x7B\x61\x7D"\
+	"\x27\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x67\x72\x65\x61"\
+	"\x74\x65\x72\x20\x74\x68\x61\x6E\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x6C\x69"\
+	"\x6E\x65\x2C\x20\x66\x72\x6F\x6D\x20\x2B\x20\x6C\x2C\x20\x6C\x6F\x77\x2C\x20\x68"\
+	"\x69\x67\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x2B\x3D\x20\x6C\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75"\
-	"\x62\x73\x74\x72\x28\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x72\x65\x67\x65\x78\x70\x29"\
-	"\x27\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x70\x75\x6E"\
-	"\x63\x74\x75\x61\x74\x6F\x72\x29\x27\x2C\x20\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x2F\x2F\x20\x20\x20\x20\x20\x20\x70\x75\x6E\x63\x74\x75\x61\x74\x6F\x72\x0A\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20"\
+	"\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x6C\x20\x2D\x20\x31\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63"\
+	"\x74\x65\x72\x20\x2B\x3D\x20\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x23\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x73\x20\x3D\x20\x73\x2E\x73\x75\x62\x73\x74\x72\x28\x6C\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x70\x75\x6E\x63\x74\x75"\
-	"\x61\x74\x6F\x72\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61"\
-	"\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x69\x74\x28\x27\x28\x70\x75\x6E\x63\x74\x75\x61\x74\x6F\x72\x29\x27\x2C\x20\x74"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x28"\
-	"\x29\x29\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74"\
+	"\x28\x27\x28\x72\x65\x67\x65\x78\x70\x29\x27\x2C\x20\x63\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x69\x74\x28\x27\x28\x70\x75\x6E\x63\x74\x75\x61\x74\x6F\x72\x29\x27\x2C"\
+	"\x20\x74\x29\x3B\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x20\x20\x20\x20\x20\x70\x75"\
+	"\x6E\x63\x74\x75\x61\x74\x6F\x72\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x23\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69"\
+	"\x74\x28\x27\x28\x70\x75\x6E\x63\x74\x75\x61\x74\x6F\x72\x29\x27\x2C\x20\x74\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x28\x27\x28\x70\x75\x6E\x63\x74"\
+	"\x75\x61\x74\x6F\x72\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x28\x29\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65"\
+	"\x78\x2E\x74\x6F\x6B\x65\x6E\x20\x3D\x20\x74\x69\x6D\x65\x64\x28\x27\x6C\x65\x78"\
+	"\x65\x72\x3A\x20\x74\x6F\x6B\x65\x6E\x27\x2C\x20\x6C\x65\x78\x2E\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61"\
 	"\x64\x64\x6C\x61\x62\x65\x6C\x28\x74\x2C\x20\x74\x79\x70\x65\x29\x20\x7B\x0A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x20\x3D\x3D\x3D\x20\x27\x68"\
 	"\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74\x79\x27\x29\x20\x7B\x0A\x20\x20"\
@@ -3444,3655 +3538,3700 @@ static const char jshint_script[] = \
 	"\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x2C\x20\x69\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
 	"\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D"\
-	"\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6E\x6F\x6C\x69\x6E"\
-	"\x65\x62\x72\x65\x61\x6B\x28\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x74\x20\x3D\x20\x74\x20\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4C\x69"\
-	"\x6E\x65\x20\x62\x72\x65\x61\x6B\x69\x6E\x67\x20\x65\x72\x72\x6F\x72\x20\x27\x7B"\
-	"\x61\x7D\x27\x2E\x22\x2C\x20\x74\x2C\x20\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x6D\x6D\x61\x28\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x6C"\
-	"\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69"\
-	"\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x61\x78\x62\x72\x65\x61\x6B\x29\x20"\
+	"\x0A\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x20\x3D\x20\x74\x69"\
+	"\x6D\x65\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x77\x68\x69\x74\x65\x27\x2C"\
+	"\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6E\x6F\x62\x72\x65\x61\x6B\x20\x3D\x20\x74\x69\x6D\x65\x64\x28\x27\x6F\x70\x74"\
+	"\x69\x6F\x6E\x3A\x20\x77\x68\x69\x74\x65\x27\x2C\x20\x6E\x6F\x62\x72\x65\x61\x6B"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x20\x3D"\
+	"\x20\x74\x69\x6D\x65\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x77\x68\x69\x74"\
+	"\x65\x27\x2C\x20\x6E\x6F\x73\x70\x61\x63\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x20\x3D\x20\x74\x69\x6D\x65"\
+	"\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x77\x68\x69\x74\x65\x27\x2C\x20\x6E"\
+	"\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6E\x6F\x62\x72\x65\x61\x6B\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x20"\
+	"\x3D\x20\x74\x69\x6D\x65\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x77\x68\x69"\
+	"\x74\x65\x27\x2C\x20\x6E\x6F\x62\x72\x65\x61\x6B\x6E\x6F\x6E\x61\x64\x6A\x61\x63"\
+	"\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74"\
+	"\x61\x74\x69\x6F\x6E\x20\x3D\x20\x74\x69\x6D\x65\x64\x28\x27\x6F\x70\x74\x69\x6F"\
+	"\x6E\x3A\x20\x77\x68\x69\x74\x65\x27\x2C\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69"\
+	"\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x74\x20\x7C\x7C\x20\x74"\
+	"\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E"\
+	"\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C"\
+	"\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x4C\x69\x6E\x65\x20\x62\x72\x65\x61\x6B\x69\x6E"\
+	"\x67\x20\x65\x72\x72\x6F\x72\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x2C\x20"\
+	"\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x63\x6F\x6D\x6D\x61\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E"\
+	"\x6C\x61\x78\x62\x72\x65\x61\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64"\
+	"\x20\x6C\x69\x6E\x65\x20\x62\x72\x65\x61\x6B\x69\x6E\x67\x20\x62\x65\x66\x6F\x72"\
+	"\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x63\x68\x61\x72\x61\x63\x74\x65"\
+	"\x72\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D"\
+	"\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x77\x68\x69\x74\x65\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
+	"\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x73\x70\x61\x63\x65\x20\x61\x66"\
+	"\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
+	"\x6E\x63\x65\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
+	"\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20"\
+	"\x46\x75\x6E\x63\x74\x69\x6F\x6E\x61\x6C\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74"\
+	"\x6F\x72\x73\x20\x66\x6F\x72\x20\x6D\x61\x6B\x69\x6E\x67\x20\x74\x68\x65\x20\x73"\
+	"\x79\x6D\x62\x6F\x6C\x73\x20\x74\x68\x61\x74\x20\x77\x69\x6C\x6C\x20\x62\x65\x20"\
+	"\x69\x6E\x68\x65\x72\x69\x74\x65\x64\x20\x62\x79\x0A\x2F\x2F\x20\x74\x6F\x6B\x65"\
+	"\x6E\x73\x2E\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x79"\
+	"\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x73\x5D\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x78\x20\x7C\x7C\x20\x74\x79"\
+	"\x70\x65\x6F\x66\x20\x78\x20\x21\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x6E\x74\x61"\
+	"\x78\x5B\x73\x5D\x20\x3D\x20\x78\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x3A\x20\x73\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x62\x70\x3A\x20\x70\x2C\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75"\
+	"\x65\x3A\x20\x73\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x6C\x69\x6D\x28\x73\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x73\x79\x6D\x62\x6F"\
+	"\x6C\x28\x73\x2C\x20\x30\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x74\x6D\x74\x28\x73\x2C\x20\x66\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x64"\
+	"\x65\x6C\x69\x6D\x28\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x69"\
+	"\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x3D\x20\x78\x2E\x72\x65\x73\x65\x72\x76"\
+	"\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78"\
+	"\x2E\x66\x75\x64\x20\x3D\x20\x66\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x73"\
+	"\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78"\
+	"\x20\x3D\x20\x73\x74\x6D\x74\x28\x73\x2C\x20\x66\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x78\x2E\x62\x6C\x6F\x63\x6B\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20"\
+	"\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65"\
+	"\x73\x65\x72\x76\x65\x4E\x61\x6D\x65\x28\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x76\x61\x72\x20\x63\x20\x3D\x20\x78\x2E\x69\x64\x2E\x63\x68\x61\x72"\
+	"\x41\x74\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28"\
+	"\x63\x20\x3E\x3D\x20\x27\x61\x27\x20\x26\x26\x20\x63\x20\x3C\x3D\x20\x27\x7A\x27"\
+	"\x29\x20\x7C\x7C\x20\x28\x63\x20\x3E\x3D\x20\x27\x41\x27\x20\x26\x26\x20\x63\x20"\
+	"\x3C\x3D\x20\x27\x5A\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x78\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x3D\x20\x78\x2E"\
+	"\x72\x65\x73\x65\x72\x76\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x70\x72\x65\x66\x69\x78\x28\x73\x2C\x20\x66\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D"\
+	"\x62\x6F\x6C\x28\x73\x2C\x20\x31\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x78\x2E\x6E\x75\x64\x20\x3D\x20\x28\x74\x79\x70\x65\x6F\x66"\
+	"\x20\x66\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x3F"\
+	"\x20\x66\x20\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68"\
+	"\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72"\
+	"\x69\x74\x79\x20\x3D\x20\x27\x75\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x68\x69\x73\x2E\x69\x64\x20\x3D"\
+	"\x3D\x3D\x20\x27\x2B\x2B\x27\x20\x7C\x7C\x20\x74\x68\x69\x73\x2E\x69\x64\x20\x3D"\
+	"\x3D\x3D\x20\x27\x2D\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70\x6C"\
+	"\x75\x73\x70\x6C\x75\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55"\
+	"\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61"\
+	"\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x2C\x20\x74\x68\x69\x73\x2E\x69\x64\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x28\x21\x74\x68\x69\x73\x2E\x72\x69\x67\x68"\
+	"\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x7C\x7C\x20\x74\x68\x69\x73"\
+	"\x2E\x72\x69\x67\x68\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20\x26\x26\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E\x69\x64\x20\x21\x3D"\
+	"\x3D\x20\x27\x2E\x27\x20\x26\x26\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E"\
+	"\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x28\x22\x42\x61\x64\x20\x6F\x70\x65\x72\x61\x6E\x64\x2E\x22\x2C\x20\x74\x68"\
+	"\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20"\
+	"\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x79\x70\x65\x28\x73\x2C\x20"\
+	"\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D"\
+	"\x20\x64\x65\x6C\x69\x6D\x28\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78"\
+	"\x2E\x74\x79\x70\x65\x20\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78"\
+	"\x2E\x6E\x75\x64\x20\x3D\x20\x66\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x73\x65\x72\x76\x65\x28\x73\x2C\x20"\
+	"\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D"\
+	"\x20\x74\x79\x70\x65\x28\x73\x2C\x20\x66\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x78\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x3D\x20\x78\x2E\x72\x65"\
+	"\x73\x65\x72\x76\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x73\x65\x72\x76"\
+	"\x65\x76\x61\x72\x28\x73\x2C\x20\x76\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x72\x65\x73\x65\x72\x76\x65\x28\x73\x2C\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x76\x20\x3D\x3D"\
+	"\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x28\x74\x68\x69\x73\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A"\
+	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x66\x69\x78\x28\x73"\
+	"\x2C\x20\x66\x2C\x20\x70\x2C\x20\x77\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61"\
+	"\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64"\
+	"\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x77\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
+	"\x6F\x62\x72\x65\x61\x6B\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72"\
+	"\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61"\
+	"\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66"\
+	"\x20\x66\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x66\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73"\
+	"\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74"\
+	"\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x70\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20"\
+	"\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28"\
+	"\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
+	"\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x31\x30\x30\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64\x20\x3D\x20\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B\x6E\x6F\x6E\x61\x64\x6A\x61"\
+	"\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61"\
+	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
+	"\x61\x72\x20\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
+	"\x6E\x28\x31\x30\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x28\x6C\x65\x66\x74\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64"\
+	"\x20\x3D\x3D\x3D\x20\x27\x4E\x61\x4E\x27\x29\x20\x7C\x7C\x20\x28\x72\x69\x67\x68"\
+	"\x74\x20\x26\x26\x20\x72\x69\x67\x68\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x4E"\
+	"\x61\x4E\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x74\x68\x65"\
+	"\x20\x69\x73\x4E\x61\x4E\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x74\x6F\x20\x63"\
+	"\x6F\x6D\x70\x61\x72\x65\x20\x77\x69\x74\x68\x20\x4E\x61\x4E\x2E\x22\x2C\x20\x74"\
+	"\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x2E\x61\x70\x70\x6C\x79\x28\x74\x68"\
+	"\x69\x73\x2C\x20\x5B\x6C\x65\x66\x74\x2C\x20\x72\x69\x67\x68\x74\x5D\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D"\
+	"\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73"\
+	"\x69\x6E\x67\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20"\
+	"\x6C\x65\x66\x74\x2C\x20\x27\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x72\x69\x67\x68\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20"\
 	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x6C\x69\x6E\x65\x20\x62\x72\x65\x61"\
-	"\x6B\x69\x6E\x67\x20\x62\x65\x66\x6F\x72\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C"\
-	"\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x6F\x6B\x65"\
-	"\x6E\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E"\
-	"\x2E\x77\x68\x69\x74\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65"\
-	"\x64\x20\x73\x70\x61\x63\x65\x20\x61\x66\x74\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E"\
-	"\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x2C\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28"\
-	"\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20\x46\x75\x6E\x63\x74\x69\x6F\x6E\x61\x6C"\
-	"\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x73\x20\x66\x6F\x72\x20\x6D\x61"\
-	"\x6B\x69\x6E\x67\x20\x74\x68\x65\x20\x73\x79\x6D\x62\x6F\x6C\x73\x20\x74\x68\x61"\
-	"\x74\x20\x77\x69\x6C\x6C\x20\x62\x65\x20\x69\x6E\x68\x65\x72\x69\x74\x65\x64\x20"\
-	"\x62\x79\x0A\x2F\x2F\x20\x74\x6F\x6B\x65\x6E\x73\x2E\x0A\x0A\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73"\
-	"\x79\x6E\x74\x61\x78\x5B\x73\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x21\x78\x20\x7C\x7C\x20\x74\x79\x70\x65\x6F\x66\x20\x78\x20\x21\x3D\x3D"\
-	"\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x73\x5D\x20\x3D\x20\x78\x20\x3D"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x64\x3A\x20\x73\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6C\x62\x70\x3A\x20\x70\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75\x65\x3A\x20\x73\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64"\
-	"\x65\x6C\x69\x6D\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
-	"\x73\x74\x6D\x74\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x64\x65\x6C\x69\x6D\x28\x73\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20"\
-	"\x3D\x20\x78\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x66\x75\x64\x20\x3D\x20\x66\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62"\
-	"\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x74\x6D\x74\x28\x73\x2C"\
-	"\x20\x66\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x62\x6C\x6F\x63\x6B"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61\x6D\x65\x28"\
-	"\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x20\x3D"\
-	"\x20\x78\x2E\x69\x64\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x63\x20\x3E\x3D\x20\x27\x61\x27\x20\x26"\
-	"\x26\x20\x63\x20\x3C\x3D\x20\x27\x7A\x27\x29\x20\x7C\x7C\x20\x28\x63\x20\x3E\x3D"\
-	"\x20\x27\x41\x27\x20\x26\x26\x20\x63\x20\x3C\x3D\x20\x27\x5A\x27\x29\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x69\x64\x65\x6E\x74"\
-	"\x69\x66\x69\x65\x72\x20\x3D\x20\x78\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x20\x3D"\
-	"\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x75\x73\x65"\
+	"\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x27"\
+	"\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74"\
+	"\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x72\x69\x67\x68\x74\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D"\
-	"\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x72\x65\x66"\
-	"\x69\x78\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x31\x35\x30"\
+	"\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x73\x50\x6F"\
+	"\x6F\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x6E\x6F\x64\x65\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6E\x6F\x64\x65\x20\x26"\
+	"\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x28\x6E\x6F"\
+	"\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x6E\x75\x6D\x62\x65\x72"\
+	"\x29\x27\x20\x26\x26\x20\x2B\x6E\x6F\x64\x65\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D"\
+	"\x3D\x20\x30\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x28\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28"\
+	"\x73\x74\x72\x69\x6E\x67\x29\x27\x20\x26\x26\x20\x6E\x6F\x64\x65\x2E\x76\x61\x6C"\
+	"\x75\x65\x20\x3D\x3D\x3D\x20\x27\x27\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20"\
+	"\x3D\x3D\x3D\x20\x27\x6E\x75\x6C\x6C\x27\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x65\x71\x6E\x75\x6C\x6C\x29\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D"\
+	"\x3D\x3D\x20\x27\x74\x72\x75\x65\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D"\
+	"\x3D\x3D\x20\x27\x66\x61\x6C\x73\x65\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20"\
+	"\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61"\
+	"\x73\x73\x69\x67\x6E\x6F\x70\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x32\x30\x29\x2E\x65\x78"\
+	"\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x69\x6E\x66\x69\x78\x28\x73\x2C\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6C\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20"\
+	"\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x5B\x6C\x65\x66\x74\x2E"\
+	"\x76\x61\x6C\x75\x65\x5D\x20\x3D\x3D\x3D\x20\x66\x61\x6C\x73\x65\x20\x26\x26\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x73\x63\x6F\x70\x65\x5B\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x5D\x5B\x27\x28"\
+	"\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x52\x65\x61\x64\x20\x6F\x6E\x6C\x79\x2E\x22\x2C\x20"\
+	"\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x5B\x27\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27"\
+	"\x20\x69\x73\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x65"\
+	"\x66\x74\x2C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E"\
+	"\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x69"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6C\x65"\
+	"\x66\x74\x2E\x6C\x65\x66\x74\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x6C\x65\x66\x74"\
+	"\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x61\x72\x67\x75\x6D\x65\x6E\x74"\
+	"\x73\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x27\x42"\
+	"\x61\x64\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E\x27\x2C\x20\x74\x68\x61"\
+	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65"\
+	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x39\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E"\
+	"\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x26\x26\x20\x21\x6C\x65\x66\x74\x2E"\
+	"\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63"\
+	"\x74\x5B\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x5D\x20\x3D\x3D\x3D\x20\x27\x65"\
+	"\x78\x63\x65\x70\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x28\x22\x44\x6F\x20\x6E\x6F\x74\x20\x61\x73\x73\x69\x67\x6E\x20"\
+	"\x74\x6F\x20\x74\x68\x65\x20\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x20\x70\x61\x72"\
+	"\x61\x6D\x65\x74\x65\x72\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
+	"\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
+	"\x6F\x6E\x28\x31\x39\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C"\
+	"\x65\x66\x74\x20\x3D\x3D\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22"\
+	"\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69"\
+	"\x65\x72\x20\x69\x6E\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x20"\
+	"\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x2E\x22\x2C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x42\x61\x64\x20\x61\x73\x73\x69"\
+	"\x67\x6E\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62\x69\x74\x77\x69\x73"\
+	"\x65\x28\x73\x2C\x20\x66\x2C\x20\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70"\
 	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61"\
-	"\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6E\x75\x64"\
+	"\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64"\
 	"\x20\x3D\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x20\x3D\x3D\x3D\x20\x27\x66\x75"\
 	"\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x3F\x20\x66\x20\x3A\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73"\
-	"\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79\x20\x3D\x20\x27\x75\x6E\x61"\
-	"\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x74\x68\x69\x73\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2B\x2B\x27\x20\x7C\x7C"\
-	"\x20\x74\x68\x69\x73\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2D\x2D\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70\x6C\x75\x73\x70\x6C\x75\x73\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69\x73"\
-	"\x2C\x20\x74\x68\x69\x73\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x28"\
-	"\x21\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69"\
-	"\x65\x72\x20\x7C\x7C\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E\x72\x65\x73"\
-	"\x65\x72\x76\x65\x64\x29\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72"\
-	"\x69\x67\x68\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20\x26\x26\x20\x74"\
-	"\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x6F\x70\x65"\
-	"\x72\x61\x6E\x64\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x74\x79\x70\x65\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x64\x65\x6C\x69\x6D\x28\x73\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x74\x79\x70\x65\x20\x3D\x20\x73\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6E\x75\x64\x20\x3D\x20\x66\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"\
-	"\x65\x73\x65\x72\x76\x65\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x74\x79\x70\x65\x28\x73\x2C\x20\x66"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x69\x64\x65\x6E\x74\x69\x66"\
-	"\x69\x65\x72\x20\x3D\x20\x78\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x73\x2C\x20\x76\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x72\x65"\
-	"\x73\x65\x72\x76\x65\x28\x73\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
-	"\x79\x70\x65\x6F\x66\x20\x76\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x76\x28\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x20\x69\x6E\x66\x69\x78\x28\x73\x2C\x20\x66\x2C\x20\x70\x2C\x20\x77\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73"\
-	"\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x77\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B\x6E\x6F\x6E\x61"\
-	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E"\
-	"\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x20\x3D\x3D\x3D\x20\x27\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x28\x6C\x65\x66\x74"\
-	"\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65"\
-	"\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73"\
-	"\x69\x6F\x6E\x28\x70\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C"\
-	"\x28\x73\x2C\x20\x31\x30\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E"\
-	"\x6C\x65\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x62\x72"\
-	"\x65\x61\x6B\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74"\
-	"\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x69\x67\x68\x74\x20\x3D"\
-	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x30\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x28\x6C\x65\x66\x74\x20"\
-	"\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x4E\x61\x4E\x27"\
-	"\x29\x20\x7C\x7C\x20\x28\x72\x69\x67\x68\x74\x20\x26\x26\x20\x72\x69\x67\x68\x74"\
-	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x4E\x61\x4E\x27\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x55\x73\x65\x20\x74\x68\x65\x20\x69\x73\x4E\x61\x4E\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72\x65\x20\x77\x69\x74"\
-	"\x68\x20\x4E\x61\x4E\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x66"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x2E\x61\x70\x70\x6C\x79\x28\x74\x68\x69\x73\x2C\x20\x5B\x6C\x65\x66\x74\x2C"\
-	"\x20\x72\x69\x67\x68\x74\x5D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
-	"\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x75\x73\x65\x20\x6F\x66"\
-	"\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x27\x21\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x69\x67\x68\x74\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x21\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E"\
-	"\x66\x75\x73\x69\x6E\x67\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E"\
-	"\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x27\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x69\x74\x77"\
+	"\x69\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74"\
+	"\x65\x64\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74"\
+	"\x68\x69\x73\x2C\x20\x74\x68\x69\x73\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68"\
-	"\x74\x20\x3D\x20\x72\x69\x67\x68\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x69\x73\x50\x6F\x6F\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E"\
-	"\x28\x6E\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x6E\x6F\x64\x65\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x28\x28\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D"\
-	"\x3D\x20\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x20\x26\x26\x20\x2B\x6E\x6F\x64"\
-	"\x65\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7C\x7C\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x6E\x6F\x64\x65\x2E\x74"\
-	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x20\x26"\
-	"\x26\x20\x6E\x6F\x64\x65\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x27\x29"\
-	"\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28"\
-	"\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x6E\x75\x6C\x6C\x27"\
-	"\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x71\x6E\x75\x6C\x6C\x29\x20"\
-	"\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
-	"\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x74\x72\x75\x65\x27\x20"\
-	"\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
-	"\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x66\x61\x6C\x73\x65\x27"\
-	"\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x64\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66"\
-	"\x69\x6E\x65\x64\x27\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x73\x2C"\
-	"\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x6D\x62\x6F\x6C"\
-	"\x28\x73\x2C\x20\x32\x30\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x6E\x66\x69"\
-	"\x78\x28\x73\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C"\
-	"\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x64\x65\x66"\
-	"\x69\x6E\x65\x64\x5B\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x5D\x20\x3D\x3D\x3D"\
-	"\x20\x66\x61\x6C\x73\x65\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x5B\x6C\x65\x66\x74"\
-	"\x2E\x76\x61\x6C\x75\x65\x5D\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20"\
-	"\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x52\x65\x61"\
-	"\x64\x20\x6F\x6E\x6C\x79\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x6C\x65\x66\x74\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x61\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x6C\x65\x66\x74\x2E\x76"\
-	"\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66"\
-	"\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2E\x27"\
-	"\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x29"\
+	"\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x70\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68"\
+	"\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62\x69\x74\x77\x69\x73"\
+	"\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x32\x30\x29\x2E\x65\x78\x70"\
+	"\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x69\x6E\x66\x69\x78\x28\x73\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E"\
+	"\x2E\x62\x69\x74\x77\x69\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65"\
+	"\x78\x70\x65\x63\x74\x65\x64\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27"\
+	"\x2E\x22\x2C\x20\x74\x68\x61\x74\x2C\x20\x74\x68\x61\x74\x2E\x69\x64\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72"\
+	"\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74"\
+	"\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x20"\
+	"\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x20\x7C"\
+	"\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x28\x6C\x65\x66\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69"\
+	"\x65\x72\x20\x26\x26\x20\x21\x6C\x65\x66\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64"\
+	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x39\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x20\x3D\x3D\x3D"\
+	"\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x29"\
 	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x6C\x65\x66\x74\x2E\x6C\x65\x66\x74\x20\x7C\x7C"\
-	"\x20\x6C\x65\x66\x74\x2E\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D"\
-	"\x20\x27\x61\x72\x67\x75\x6D\x65\x6E\x74\x73\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65"\
+	"\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x69\x6E\x20\x61"\
+	"\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2C\x20\x61\x6E\x64\x20\x69\x6E"\
+	"\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x27\x42\x61\x64\x20\x61\x73\x73\x69\x67\x6E\x6D"\
-	"\x65\x6E\x74\x2E\x27\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74"\
-	"\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
-	"\x31\x39\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72"\
-	"\x20\x26\x26\x20\x21\x6C\x65\x66\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x6C\x65\x66\x74\x2E\x76\x61\x6C"\
-	"\x75\x65\x5D\x20\x3D\x3D\x3D\x20\x27\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x20\x6E"\
-	"\x6F\x74\x20\x61\x73\x73\x69\x67\x6E\x20\x74\x6F\x20\x74\x68\x65\x20\x65\x78\x63"\
-	"\x65\x70\x74\x69\x6F\x6E\x20\x70\x61\x72\x61\x6D\x65\x74\x65\x72\x2E\x22\x2C\x20"\
-	"\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20"\
-	"\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x39\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x20\x3D\x3D\x3D\x20\x73\x79"\
-	"\x6E\x74\x61\x78\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x42\x61\x64\x20\x61"\
+	"\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E\x22\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x75\x66"\
+	"\x66\x69\x78\x28\x73\x2C\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x31\x35"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64\x20\x3D\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E"\
+	"\x2E\x70\x6C\x75\x73\x70\x6C\x75\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E"\
+	"\x65\x78\x70\x65\x63\x74\x65\x64\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D"\
+	"\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x2C\x20\x74\x68\x69\x73\x2E\x69\x64\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x69\x66\x20\x28\x28\x21\x6C\x65\x66\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
+	"\x72\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20"\
+	"\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20\x26"\
+	"\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x6F\x70\x65\x72\x61\x6E\x64\x2E\x22\x2C"\
+	"\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C"\
+	"\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
+	"\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x2F\x2F"\
+	"\x20\x66\x6E\x70\x61\x72\x61\x6D\x20\x6D\x65\x61\x6E\x73\x20\x74\x68\x61\x74\x20"\
+	"\x74\x68\x69\x73\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x69\x73\x20\x62"\
+	"\x65\x69\x6E\x67\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x61\x73\x20\x61\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x2F\x2F\x20\x61\x72\x67\x75\x6D\x65"\
+	"\x6E\x74\x20\x28\x73\x65\x65\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29"\
+	"\x29\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x61\x6C\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x66\x6E\x70\x61\x72\x61"\
+	"\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x20\x26\x26\x20\x21\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x60\x75\x6E\x64\x65\x66\x69\x6E"\
+	"\x65\x64\x60\x20\x61\x73\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x61"\
+	"\x72\x61\x6D\x20\x69\x73\x20\x61\x20\x63\x6F\x6D\x6D\x6F\x6E\x20\x70\x61\x74\x74"\
+	"\x65\x72\x6E\x20\x74\x6F\x20\x70\x72\x6F\x74\x65\x63\x74\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x67\x61\x69\x6E\x73"\
+	"\x74\x20\x74\x68\x65\x20\x63\x61\x73\x65\x20\x77\x68\x65\x6E\x20\x73\x6F\x6D\x65"\
+	"\x62\x6F\x64\x79\x20\x64\x6F\x65\x73\x20\x60\x75\x6E\x64\x65\x66\x69\x6E\x65\x64"\
+	"\x20\x3D\x20\x74\x72\x75\x65\x60\x20\x61\x6E\x64\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x68\x65\x6C\x70\x20\x77\x69\x74"\
+	"\x68\x20\x6D\x69\x6E\x69\x66\x69\x63\x61\x74\x69\x6F\x6E\x2E\x20\x4D\x6F\x72\x65"\
+	"\x20\x69\x6E\x66\x6F\x3A\x20\x68\x74\x74\x70\x73\x3A\x2F\x2F\x67\x69\x73\x74\x2E"\
+	"\x67\x69\x74\x68\x75\x62\x2E\x63\x6F\x6D\x2F\x33\x31\x35\x39\x31\x36\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x66"\
+	"\x6E\x70\x61\x72\x61\x6D\x20\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75"\
+	"\x65\x20\x21\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61"\
-	"\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x69\x6E\x20\x61\x6E\x20\x61"\
-	"\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61"\
-	"\x64\x20\x73\x61\x77\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x76"\
-	"\x6F\x63\x61\x74\x69\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E"\
+	"\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74"\
+	"\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x20\x28\x61\x20\x72\x65\x73"\
+	"\x65\x72\x76\x65\x64\x20\x77\x6F\x72\x64\x29\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72"\
-	"\x28\x22\x42\x61\x64\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E\x22\x2C\x20"\
-	"\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x20\x32\x30"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x62\x69\x74\x77\x69\x73\x65\x28\x73\x2C\x20\x66\x2C\x20\x70\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73"\
-	"\x79\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x70\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x73\x65\x72\x76\x65\x4E\x61\x6D\x65\x28\x78\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x78\x2E\x6C\x65\x64\x20\x3D\x20\x28\x74\x79\x70\x65\x6F\x66"\
-	"\x20\x66\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x3F"\
-	"\x20\x66\x20\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x62\x69\x74\x77\x69\x73\x65\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x75\x73\x65\x20\x6F\x66\x20"\
-	"\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x2C\x20\x74\x68\x69\x73\x2E"\
-	"\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74"\
-	"\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73"\
-	"\x73\x69\x6F\x6E\x28\x70\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x78\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28"\
-	"\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x6D\x62\x6F\x6C\x28"\
-	"\x73\x2C\x20\x32\x30\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x6E\x66\x69\x78"\
-	"\x28\x73\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20"\
-	"\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x69\x74\x77\x69\x73\x65\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x75\x73"\
-	"\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x61\x74\x2C\x20"\
-	"\x74\x68\x61\x74\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61"\
-	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
-	"\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x69"\
-	"\x64\x20\x3D\x3D\x3D\x20\x27\x2E\x27\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x5B\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x6C\x65\x66"\
-	"\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x26\x26\x20\x21\x6C\x65\x66"\
-	"\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65"\
-	"\x73\x73\x69\x6F\x6E\x28\x31\x39\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68"\
-	"\x61\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6C\x65\x66\x74\x20\x3D\x3D\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x28\x0A\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74"\
-	"\x69\x66\x69\x65\x72\x20\x69\x6E\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65"\
-	"\x6E\x74\x2C\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20"\
-	"\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F"\
-	"\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72"\
-	"\x72\x6F\x72\x28\x22\x42\x61\x64\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E"\
-	"\x22\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C"\
-	"\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x20\x73\x75\x66\x66\x69\x78\x28\x73\x2C\x20\x66\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D\x20\x73\x79"\
-	"\x6D\x62\x6F\x6C\x28\x73\x2C\x20\x31\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x78\x2E\x6C\x65\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
-	"\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x70\x6C\x75\x73\x70\x6C\x75\x73\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x75"\
-	"\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x2C"\
-	"\x20\x74\x68\x69\x73\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x28\x21\x6C\x65\x66\x74"\
-	"\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E"\
-	"\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x69\x64"\
-	"\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20"\
-	"\x21\x3D\x3D\x20\x27\x5B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20"\
-	"\x6F\x70\x65\x72\x61\x6E\x64\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
+	"\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D"\
+	"\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x66\x6E\x70\x61\x72\x61\x6D\x20\x6D\x65\x61"\
+	"\x6E\x73\x20\x74\x68\x61\x74\x20\x74\x68\x69\x73\x20\x69\x64\x65\x6E\x74\x69\x66"\
+	"\x69\x65\x72\x20\x69\x73\x20\x62\x65\x69\x6E\x67\x20\x64\x65\x66\x69\x6E\x65\x64"\
+	"\x20\x61\x73\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x66\x6E\x70\x61\x72"\
+	"\x61\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20"\
+	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72"\
+	"\x28\x66\x6E\x70\x61\x72\x61\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x69\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
+	"\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x20\x26\x26\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x6E\x61\x6D\x65\x20\x69\x6E\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x63\x6C\x61\x72\x61\x74\x69\x6F\x6E"\
+	"\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28"\
+	"\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66"\
+	"\x69\x65\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20"\
+	"\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x73"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20"\
+	"\x30\x2C\x20\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x20\x7C"\
+	"\x7C\x20\x6E\x6F\x72\x65\x61\x63\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x70\x65"\
+	"\x65\x6B\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x74\x2E\x72\x65\x61\x63\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x78\x3B\x0A\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x66\x6E\x70\x61\x72\x61\x6D\x20\x6D"\
-	"\x65\x61\x6E\x73\x20\x74\x68\x61\x74\x20\x74\x68\x69\x73\x20\x69\x64\x65\x6E\x74"\
-	"\x69\x66\x69\x65\x72\x20\x69\x73\x20\x62\x65\x69\x6E\x67\x20\x64\x65\x66\x69\x6E"\
-	"\x65\x64\x20\x61\x73\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x0A\x20\x20\x20"\
-	"\x20\x2F\x2F\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x20\x28\x73\x65\x65\x20\x69\x64"\
-	"\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x29\x0A\x20\x20\x20\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C\x69\x64\x65\x6E\x74\x69\x66"\
-	"\x69\x65\x72\x28\x66\x6E\x70\x61\x72\x61\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x65"\
-	"\x6E\x74\x69\x66\x69\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x72\x65\x73\x65"\
-	"\x72\x76\x65\x64\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
-	"\x2F\x20\x60\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x60\x20\x61\x73\x20\x61\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x61\x72\x61\x6D\x20\x69\x73\x20\x61\x20\x63"\
-	"\x6F\x6D\x6D\x6F\x6E\x20\x70\x61\x74\x74\x65\x72\x6E\x20\x74\x6F\x20\x70\x72\x6F"\
-	"\x74\x65\x63\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x2F\x2F\x20\x61\x67\x61\x69\x6E\x73\x74\x20\x74\x68\x65\x20\x63\x61\x73\x65"\
-	"\x20\x77\x68\x65\x6E\x20\x73\x6F\x6D\x65\x62\x6F\x64\x79\x20\x64\x6F\x65\x73\x20"\
-	"\x60\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x60\x20\x61"\
-	"\x6E\x64\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
-	"\x2F\x20\x68\x65\x6C\x70\x20\x77\x69\x74\x68\x20\x6D\x69\x6E\x69\x66\x69\x63\x61"\
-	"\x74\x69\x6F\x6E\x2E\x20\x4D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x3A\x20\x68\x74\x74"\
-	"\x70\x73\x3A\x2F\x2F\x67\x69\x73\x74\x2E\x67\x69\x74\x68\x75\x62\x2E\x63\x6F\x6D"\
-	"\x2F\x33\x31\x35\x39\x31\x36\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x21\x66\x6E\x70\x61\x72\x61\x6D\x20\x7C\x7C\x20"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20\x21\x3D\x20\x27\x75\x6E\x64\x65"\
-	"\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45"\
-	"\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
-	"\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B"\
-	"\x61\x7D\x27\x20\x28\x61\x20\x72\x65\x73\x65\x72\x76\x65\x64\x20\x77\x6F\x72\x64"\
-	"\x29\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x2F\x2F\x20\x66"\
-	"\x6E\x70\x61\x72\x61\x6D\x20\x6D\x65\x61\x6E\x73\x20\x74\x68\x61\x74\x20\x74\x68"\
-	"\x69\x73\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x69\x73\x20\x62\x65\x69"\
-	"\x6E\x67\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x61\x73\x20\x61\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x0A\x20\x20\x20\x20\x2F\x2F\x20\x61\x72\x67\x75\x6D\x65\x6E\x74"\
-	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x64\x65\x6E\x74\x69"\
-	"\x66\x69\x65\x72\x28\x66\x6E\x70\x61\x72\x61\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C"\
-	"\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x66\x6E\x70\x61\x72\x61\x6D\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x27\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x20\x3D\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4D\x69\x73\x73\x69\x6E"\
-	"\x67\x20\x6E\x61\x6D\x65\x20\x69\x6E\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64"\
-	"\x65\x63\x6C\x61\x72\x61\x74\x69\x6F\x6E\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x61\x6E\x64\x20\x69\x6E"\
-	"\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"\
-	"\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20\x30\x2C\x20\x74\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x20\x21\x3D\x3D\x20\x27\x3B\x27\x20\x7C\x7C\x20\x6E\x6F\x72\x65\x61\x63\x68\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x74\x20\x3D\x20\x70\x65\x65\x6B\x28\x69\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x72\x65\x61\x63\x68"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E"\
-	"\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x65\x6E\x64\x6C\x69\x6E\x65\x29\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x49\x6E\x6E\x65\x72"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65"\
-	"\x20\x6C\x69\x73\x74\x65\x64\x20\x61\x74\x20\x74\x68\x65\x20\x74\x6F\x70\x20\x6F"\
-	"\x66\x20\x74\x68\x65\x20\x6F\x75\x74\x65\x72\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x65"\
+	"\x6E\x64\x6C\x69\x6E\x65\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x0A\x22\x49\x6E\x6E\x65\x72\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73"\
+	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x6C\x69\x73\x74\x65\x64\x20\x61\x74"\
+	"\x20\x74\x68\x65\x20\x74\x6F\x70\x20\x6F\x66\x20\x74\x68\x65\x20\x6F\x75\x74\x65"\
+	"\x72\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
+	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x20"\
+	"\x27\x7B\x61\x7D\x27\x20\x61\x66\x74\x65\x72\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C"\
+	"\x20\x74\x2C\x20\x74\x2E\x76\x61\x6C\x75\x65\x2C\x20\x73\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x28\x6E\x6F\x69\x6E\x64"\
+	"\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69"\
+	"\x20\x3D\x20\x69\x6E\x64\x65\x6E\x74\x2C\x20\x72\x2C\x20\x73\x20\x3D\x20\x73\x63"\
+	"\x6F\x70\x65\x2C\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A"\
+	"\x0A\x2F\x2F\x20\x57\x65\x20\x64\x6F\x6E\x27\x74\x20\x6C\x69\x6B\x65\x20\x74\x68"\
+	"\x65\x20\x65\x6D\x70\x74\x79\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x6E\x65\x63\x65\x73\x73\x61\x72\x79"\
+	"\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
+	"\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x49\x73"\
+	"\x20\x74\x68\x69\x73\x20\x61\x20\x6C\x61\x62\x65\x6C\x6C\x65\x64\x20\x73\x74\x61"\
+	"\x74\x65\x6D\x65\x6E\x74\x3F\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x26\x26\x20\x21\x74\x2E"\
+	"\x72\x65\x73\x65\x72\x76\x65\x64\x20\x26\x26\x20\x70\x65\x65\x6B\x28\x29\x2E\x69"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3A\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20"\
+	"\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C"\
+	"\x28\x74\x2E\x76\x61\x6C\x75\x65\x2C\x20\x27\x6C\x61\x62\x65\x6C\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x4C\x61\x62\x65\x6C\x20\x27\x7B\x61\x7D\x27\x20\x6F\x6E\x20\x7B"\
+	"\x62\x7D\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x2E\x76\x61\x6C\x75\x65\x2C\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x78\x2E\x74\x65\x73\x74\x28\x74\x2E\x76\x61"\
+	"\x6C\x75\x65\x20\x2B\x20\x27\x3A\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4C"\
+	"\x61\x62\x65\x6C\x20\x27\x7B\x61\x7D\x27\x20\x6C\x6F\x6F\x6B\x73\x20\x6C\x69\x6B"\
+	"\x65\x20\x61\x20\x6A\x61\x76\x61\x73\x63\x72\x69\x70\x74\x20\x75\x72\x6C\x2E\x22"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x74\x2C\x20\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E"\
-	"\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x20\x27\x7B\x61\x7D\x27\x20\x61\x66\x74\x65"\
-	"\x72\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x20\x74\x2C\x20\x74\x2E\x76\x61\x6C\x75"\
-	"\x65\x2C\x20\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x2B\x3D"\
-	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x74\x61\x74\x65"\
-	"\x6D\x65\x6E\x74\x28\x6E\x6F\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20\x69\x6E\x64\x65\x6E\x74\x2C"\
-	"\x20\x72\x2C\x20\x73\x20\x3D\x20\x73\x63\x6F\x70\x65\x2C\x20\x74\x20\x3D\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x0A\x2F\x2F\x20\x57\x65\x20\x64\x6F\x6E"\
-	"\x27\x74\x20\x6C\x69\x6B\x65\x20\x74\x68\x65\x20\x65\x6D\x70\x74\x79\x20\x73\x74"\
-	"\x61\x74\x65\x6D\x65\x6E\x74\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55"\
-	"\x6E\x6E\x65\x63\x65\x73\x73\x61\x72\x79\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E"\
-	"\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x49\x73\x20\x74\x68\x69\x73\x20\x61\x20\x6C\x61"\
-	"\x62\x65\x6C\x6C\x65\x64\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x3F\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x2E\x69\x64\x65\x6E\x74\x69\x66"\
-	"\x69\x65\x72\x20\x26\x26\x20\x21\x74\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x20\x26"\
-	"\x26\x20\x70\x65\x65\x6B\x28\x29\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3A\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
-	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63"\
-	"\x72\x65\x61\x74\x65\x28\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x74\x2E\x76\x61\x6C\x75\x65\x2C\x20"\
-	"\x27\x6C\x61\x62\x65\x6C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x61\x62"\
-	"\x65\x6C\x6C\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4C\x61\x62\x65\x6C\x20"\
-	"\x27\x7B\x61\x7D\x27\x20\x6F\x6E\x20\x7B\x62\x7D\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C"\
-	"\x20\x74\x2E\x76\x61\x6C\x75\x65\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x78"\
-	"\x2E\x74\x65\x73\x74\x28\x74\x2E\x76\x61\x6C\x75\x65\x20\x2B\x20\x27\x3A\x27\x29"\
+	"\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x61\x62\x65\x6C"\
+	"\x20\x3D\x20\x74\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x50\x61\x72\x73\x65\x20\x74"\
+	"\x68\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x6F\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74"\
+	"\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
+	"\x30\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x0A\x2F\x2F\x20\x4C\x6F\x6F\x6B\x20\x66"\
+	"\x6F\x72\x20\x74\x68\x65\x20\x66\x69\x6E\x61\x6C\x20\x73\x65\x6D\x69\x63\x6F\x6C"\
+	"\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x74\x2E"\
+	"\x62\x6C\x6F\x63\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x78\x70\x72\x20\x26\x26"\
+	"\x20\x28\x21\x72\x20\x7C\x7C\x20\x21\x72\x2E\x65\x78\x70\x73\x29\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E\x20\x61\x73\x73"\
+	"\x69\x67\x6E\x6D\x65\x6E\x74\x20\x6F\x72\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x63\x61\x6C\x6C\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77"\
+	"\x20\x61\x6E\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x6F"\
+	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x6E\x65"\
+	"\x77\x20\x26\x26\x20\x72\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x27\x20\x26\x26"\
+	"\x20\x72\x2E\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x6E\x65\x77\x27"\
 	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4C\x61\x62\x65\x6C\x20\x27\x7B\x61\x7D\x27"\
-	"\x20\x6C\x6F\x6F\x6B\x73\x20\x6C\x69\x6B\x65\x20\x61\x20\x6A\x61\x76\x61\x73\x63"\
-	"\x72\x69\x70\x74\x20\x75\x72\x6C\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x2C\x20\x74"\
-	"\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x6C\x61\x62\x65\x6C\x20\x3D\x20\x74\x2E\x76\x61\x6C\x75\x65"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x2F\x2F\x20\x50\x61\x72\x73\x65\x20\x74\x68\x65\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6E\x6F"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x20\x6E\x6F\x74\x20\x75\x73\x65\x20"\
+	"\x27\x6E\x65\x77\x27\x20\x66\x6F\x72\x20\x73\x69\x64\x65\x20\x65\x66\x66\x65\x63"\
+	"\x74\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x61\x73\x69\x20\x26\x26\x20\x21\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x6C\x61\x73\x74\x73\x65\x6D\x69\x63\x20\x26\x26\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x3D\x3D\x20\x74"\
+	"\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x41\x74\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x73\x65\x6D\x69\x63\x6F\x6C"\
+	"\x6F\x6E\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x20\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x2B\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C"\
+	"\x75\x65\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
+	"\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20"\
+	"\x52\x65\x73\x74\x6F\x72\x65\x20\x74\x68\x65\x20\x69\x6E\x64\x65\x6E\x74\x61\x74"\
+	"\x69\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74"\
+	"\x20\x3D\x20\x69\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20"\
+	"\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x72\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x75\x73\x65\x5F\x73\x74\x72\x69\x63\x74\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69"\
+	"\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x28\x22\x55\x6E\x6E\x65\x63\x65\x73\x73\x61\x72\x79\x20\x5C\x22\x75\x73\x65"\
+	"\x20\x73\x74\x72\x69\x63\x74\x5C\x22\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65"\
+	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x65\x77\x63\x61\x70\x20\x3D\x20\x74\x72\x75"\
+	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x75\x6E\x64\x65\x66\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x61\x6C"\
+	"\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x74\x61\x74\x65"\
+	"\x6D\x65\x6E\x74\x73\x28\x62\x65\x67\x69\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x76\x61\x72\x20\x61\x20\x3D\x20\x5B\x5D\x2C\x20\x66\x2C\x20\x70\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x21\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x72\x65\x61\x63\x68\x20\x26\x26\x20\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x65\x6E\x64\x29"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3B"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x6E\x65\x63\x65\x73\x73\x61\x72"\
+	"\x79\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
+	"\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x2E\x70\x75\x73\x68\x28\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x28"\
+	"\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
+	"\x72\x6E\x20\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x2F\x2A"\
+	"\x0A\x20\x20\x20\x20\x20\x2A\x20\x50\x61\x72\x73\x65\x73\x20\x61\x20\x73\x69\x6E"\
+	"\x67\x6C\x65\x20\x62\x6C\x6F\x63\x6B\x2E\x20\x41\x20\x62\x6C\x6F\x63\x6B\x20\x69"\
+	"\x73\x20\x61\x20\x73\x65\x71\x75\x65\x6E\x63\x65\x20\x6F\x66\x20\x73\x74\x61\x74"\
+	"\x65\x6D\x65\x6E\x74\x73\x20\x77\x72\x61\x70\x70\x65\x64\x20\x69\x6E\x0A\x20\x20"\
+	"\x20\x20\x20\x2A\x20\x62\x72\x61\x63\x65\x73\x2E\x0A\x20\x20\x20\x20\x20\x2A\x0A"\
+	"\x20\x20\x20\x20\x20\x2A\x20\x6F\x72\x64\x69\x6E\x61\x72\x79\x20\x2D\x20\x74\x72"\
+	"\x75\x65\x20\x66\x6F\x72\x20\x65\x76\x65\x72\x79\x74\x68\x69\x6E\x67\x20\x62\x75"\
+	"\x74\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62\x6F\x64\x69\x65\x73\x20\x61\x6E"\
+	"\x64\x20\x74\x72\x79\x20\x62\x6C\x6F\x63\x6B\x73\x2E\x0A\x20\x20\x20\x20\x20\x2A"\
+	"\x20\x73\x74\x6D\x74\x20\x20\x20\x20\x20\x2D\x20\x74\x72\x75\x65\x20\x69\x66\x20"\
+	"\x62\x6C\x6F\x63\x6B\x20\x63\x61\x6E\x20\x62\x65\x20\x61\x20\x73\x69\x6E\x67\x6C"\
+	"\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x28\x65\x2E\x67\x2E\x20\x69\x6E"\
+	"\x20\x69\x66\x2F\x66\x6F\x72\x2F\x77\x68\x69\x6C\x65\x29\x2E\x0A\x20\x20\x20\x20"\
+	"\x20\x2A\x2F\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x62\x6C\x6F"\
+	"\x63\x6B\x28\x6F\x72\x64\x69\x6E\x61\x72\x79\x2C\x20\x73\x74\x6D\x74\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x2C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x69\x6E\x62\x6C\x6F\x63\x6B\x2C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x6C\x64\x5F\x69\x6E\x64"\
+	"\x65\x6E\x74\x20\x3D\x20\x69\x6E\x64\x65\x6E\x74\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6D\x20\x3D\x20\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64"\
+	"\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73"\
+	"\x63\x6F\x70\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x62\x6C\x6F\x63\x6B\x20\x3D\x20"\
+	"\x6F\x72\x64\x69\x6E\x61\x72\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63"\
+	"\x6F\x70\x65\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28"\
+	"\x73\x63\x6F\x70\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61"\
+	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
+	"\x27\x7B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x27\x7B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
+	"\x64\x20\x21\x3D\x3D\x20\x27\x7D\x27\x20\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x2E\x6C"\
+	"\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69"\
+	"\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x21\x6F\x72\x64\x69\x6E\x61\x72\x79\x20"\
+	"\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x3E\x20"\
 	"\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x20\x3D\x20\x65"\
-	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A"\
-	"\x0A\x2F\x2F\x20\x4C\x6F\x6F\x6B\x20\x66\x6F\x72\x20\x74\x68\x65\x20\x66\x69\x6E"\
-	"\x61\x6C\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x74\x2E\x62\x6C\x6F\x63\x6B\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69"\
-	"\x6F\x6E\x2E\x65\x78\x70\x72\x20\x26\x26\x20\x28\x21\x72\x20\x7C\x7C\x20\x21\x72"\
-	"\x2E\x65\x78\x70\x73\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63"\
-	"\x74\x65\x64\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x20\x6F\x72"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x61\x6C\x6C\x20\x61\x6E\x64\x20\x69"\
-	"\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x65\x78\x70\x72\x65\x73"\
-	"\x73\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x6E\x65\x77\x20\x26\x26\x20\x72\x2E\x69\x64\x20"\
-	"\x3D\x3D\x3D\x20\x27\x28\x27\x20\x26\x26\x20\x72\x2E\x6C\x65\x66\x74\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x6E\x65\x77\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44"\
-	"\x6F\x20\x6E\x6F\x74\x20\x75\x73\x65\x20\x27\x6E\x65\x77\x27\x20\x66\x6F\x72\x20"\
-	"\x73\x69\x64\x65\x20\x65\x66\x66\x65\x63\x74\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x61"\
-	"\x73\x69\x20\x26\x26\x20\x21\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x61\x73\x74\x73"\
-	"\x65\x6D\x69\x63\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x20\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x6C\x69\x6E\x65\x20\x3D\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x72\x64\x69\x6E\x61"\
+	"\x72\x79\x20\x26\x26\x20\x21\x75\x73\x65\x5F\x73\x74\x72\x69\x63\x74\x28\x29\x20"\
+	"\x26\x26\x20\x21\x6D\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x74\x72\x69"\
+	"\x63\x74\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x63\x6F"\
+	"\x6E\x74\x65\x78\x74\x29\x27\x5D\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D"\
 	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x41\x74\x28\x22\x4D\x69\x73\x73\x69"\
-	"\x6E\x67\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x2E\x22\x2C\x20\x74\x6F\x6B\x65"\
-	"\x6E\x2E\x6C\x69\x6E\x65\x2C\x20\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x2B"\
-	"\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x2E\x6C\x65\x6E\x67\x74\x68\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A"\
-	"\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65"\
-	"\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x52\x65\x73\x74\x6F\x72\x65\x20\x74\x68"\
-	"\x65\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x69\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x72\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x75\x73\x65\x5F\x73\x74"\
-	"\x72\x69\x63\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D"\
-	"\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x69\x63\x74\x5F"\
-	"\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x6E\x65\x63\x65\x73"\
-	"\x73\x61\x72\x79\x20\x5C\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x5C\x22\x2E"\
-	"\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x4D\x69\x73\x73\x69\x6E\x67"\
+	"\x20\x5C\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x5C\x22\x20\x73\x74\x61\x74"\
+	"\x65\x6D\x65\x6E\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x20\x3D\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74"\
+	"\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20\x3D\x20\x6D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2D\x3D"\
+	"\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74"\
+	"\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
-	"\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x65"\
-	"\x77\x63\x61\x70\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x75\x6E\x64\x65\x66\x20\x3D\x20"\
-	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x28\x62\x65\x67\x69"\
-	"\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x20\x3D"\
-	"\x20\x5B\x5D\x2C\x20\x66\x2C\x20\x70\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x68\x69\x6C\x65\x20\x28\x21\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x72\x65"\
-	"\x61\x63\x68\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x21\x3D\x3D\x20\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x55\x6E\x6E\x65\x63\x65\x73\x73\x61\x72\x79\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F"\
-	"\x6E\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x2E\x70\x75\x73\x68\x28"\
-	"\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x28\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x61\x3B\x0A\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x2F\x2A\x0A\x20\x20\x20\x20\x20\x2A\x20\x50\x61"\
-	"\x72\x73\x65\x73\x20\x61\x20\x73\x69\x6E\x67\x6C\x65\x20\x62\x6C\x6F\x63\x6B\x2E"\
-	"\x20\x41\x20\x62\x6C\x6F\x63\x6B\x20\x69\x73\x20\x61\x20\x73\x65\x71\x75\x65\x6E"\
-	"\x63\x65\x20\x6F\x66\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x20\x77\x72\x61"\
-	"\x70\x70\x65\x64\x20\x69\x6E\x0A\x20\x20\x20\x20\x20\x2A\x20\x62\x72\x61\x63\x65"\
-	"\x73\x2E\x0A\x20\x20\x20\x20\x20\x2A\x0A\x20\x20\x20\x20\x20\x2A\x20\x6F\x72\x64"\
-	"\x69\x6E\x61\x72\x79\x20\x2D\x20\x74\x72\x75\x65\x20\x66\x6F\x72\x20\x65\x76\x65"\
-	"\x72\x79\x74\x68\x69\x6E\x67\x20\x62\x75\x74\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x62\x6F\x64\x69\x65\x73\x20\x61\x6E\x64\x20\x74\x72\x79\x20\x62\x6C\x6F\x63"\
-	"\x6B\x73\x2E\x0A\x20\x20\x20\x20\x20\x2A\x20\x73\x74\x6D\x74\x20\x20\x20\x20\x20"\
-	"\x2D\x20\x74\x72\x75\x65\x20\x69\x66\x20\x62\x6C\x6F\x63\x6B\x20\x63\x61\x6E\x20"\
-	"\x62\x65\x20\x61\x20\x73\x69\x6E\x67\x6C\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E"\
-	"\x74\x20\x28\x65\x2E\x67\x2E\x20\x69\x6E\x20\x69\x66\x2F\x66\x6F\x72\x2F\x77\x68"\
-	"\x69\x6C\x65\x29\x2E\x0A\x20\x20\x20\x20\x20\x2A\x2F\x0A\x20\x20\x20\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x20\x62\x6C\x6F\x63\x6B\x28\x6F\x72\x64\x69\x6E\x61\x72"\
-	"\x79\x2C\x20\x73\x74\x6D\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x61\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20"\
-	"\x3D\x20\x69\x6E\x62\x6C\x6F\x63\x6B\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6F\x6C\x64\x5F\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x69\x6E\x64\x65"\
-	"\x6E\x74\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x20\x3D\x20"\
-	"\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x63\x6F\x70\x65\x2C\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x6E\x62\x6C\x6F\x63\x6B\x20\x3D\x20\x6F\x72\x64\x69\x6E\x61\x72\x79\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x4F\x62\x6A\x65"\
-	"\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x63\x6F\x70\x65\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x7B\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7B\x27"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x7D\x27\x20"\
-	"\x7C\x7C\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28"\
-	"\x21\x6F\x72\x64\x69\x6E\x61\x72\x79\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x3E\x20\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64"\
-	"\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x21\x6F\x72\x64\x69\x6E\x61\x72\x79\x20\x26\x26\x20\x21\x75\x73\x65"\
-	"\x5F\x73\x74\x72\x69\x63\x74\x28\x29\x20\x26\x26\x20\x21\x6D\x20\x26\x26\x20\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x73\x74\x72\x69\x63\x74\x20\x26\x26\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x63\x6F\x6E\x74\x65\x78\x74\x29\x27\x5D\x5B\x27"\
-	"\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x5C\x22\x75\x73\x65\x20\x73\x74\x72"\
-	"\x69\x63\x74\x5C\x22\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x22\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x73\x74"\
-	"\x61\x74\x65\x6D\x65\x6E\x74\x73\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20"\
-	"\x3D\x20\x6D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x6E\x64\x65\x6E\x74\x20\x2D\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E"\
-	"\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7D\x27\x2C\x20\x74\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x3D"\
-	"\x20\x6F\x6C\x64\x5F\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x6F\x72\x64\x69\x6E\x61\x72"\
-	"\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72"\
-	"\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61"\
-	"\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27"\
-	"\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x7B\x27\x2C\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x74\x6D\x74\x20\x7C\x7C\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x2E\x63\x75\x72\x6C\x79\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70"\
-	"\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74"\
-	"\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x7B\x27\x2C\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72"\
-	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20"\
-	"\x5B\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x28\x29\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x72\x65\x61\x63\x68\x20\x3D\x20\x66\x61\x6C"\
-	"\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x20\x3D\x20"\
-	"\x6E\x75\x6C\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20"\
-	"\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x62\x6C\x6F\x63\x6B"\
-	"\x20\x3D\x20\x62\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x72"\
-	"\x64\x69\x6E\x61\x72\x79\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x65"\
-	"\x6D\x70\x74\x79\x20\x26\x26\x20\x28\x21\x61\x20\x7C\x7C\x20\x61\x2E\x6C\x65\x6E"\
-	"\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x6D\x70\x74\x79"\
-	"\x20\x62\x6C\x6F\x63\x6B\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x61\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
-	"\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28\x6D\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6D\x65\x6D\x62\x65\x72\x73\x4F\x6E\x6C\x79"\
-	"\x20\x26\x26\x20\x74\x79\x70\x65\x6F\x66\x20\x6D\x65\x6D\x62\x65\x72\x73\x4F\x6E"\
-	"\x6C\x79\x5B\x6D\x5D\x20\x21\x3D\x3D\x20\x27\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
-	"\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x2F\x2A\x6D\x65\x6D"\
-	"\x62\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x6D\x65\x6D\x62\x65\x72\x5B"\
-	"\x6D\x5D\x20\x3D\x3D\x3D\x20\x27\x6E\x75\x6D\x62\x65\x72\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x5B\x6D\x5D"\
-	"\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
-	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62"\
-	"\x65\x72\x5B\x6D\x5D\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70\x6C\x69\x65\x64\x28\x74\x6F\x6B\x65\x6E"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6E\x61\x6D\x65"\
-	"\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x2C\x20\x6C\x69\x6E\x65"\
-	"\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x20\x61\x20\x3D\x20\x69"\
-	"\x6D\x70\x6C\x69\x65\x64\x5B\x6E\x61\x6D\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x61\x20\x3D\x3D\x3D\x20\x27"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x61"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20"\
-	"\x5B\x6C\x69\x6E\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x6D\x70\x6C\x69\x65\x64\x5B\x6E\x61\x6D\x65\x5D\x20\x3D\x20\x61\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x61\x5B"\
-	"\x61\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x5D\x20\x21\x3D\x3D\x20\x6C\x69"\
-	"\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x2E"\
-	"\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x42\x75\x69\x6C\x64\x20\x74\x68"\
-	"\x65\x20\x73\x79\x6E\x74\x61\x78\x20\x74\x61\x62\x6C\x65\x20\x62\x79\x20\x64\x65"\
-	"\x63\x6C\x61\x72\x69\x6E\x67\x20\x74\x68\x65\x20\x73\x79\x6E\x74\x61\x63\x74\x69"\
-	"\x63\x20\x65\x6C\x65\x6D\x65\x6E\x74\x73\x20\x6F\x66\x20\x74\x68\x65\x20\x6C\x61"\
-	"\x6E\x67\x75\x61\x67\x65\x2E\x0A\x0A\x20\x20\x20\x20\x74\x79\x70\x65\x28\x27\x28"\
-	"\x6E\x75\x6D\x62\x65\x72\x29\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
-	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x74\x79\x70"\
-	"\x65\x28\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
-	"\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20"\
-	"\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
-	"\x72\x29\x27\x5D\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x79\x70"\
-	"\x65\x3A\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x2C\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6C\x62\x70\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x3A\x20\x74\x72\x75\x65\x2C"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x75\x64\x3A\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x76\x20\x3D\x20\x74\x68\x69\x73\x2E\x76\x61\x6C\x75\x65\x2C\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20"\
-	"\x73\x63\x6F\x70\x65\x5B\x76\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x73\x20\x3D\x3D\x3D\x20\x27\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x74"\
-	"\x65\x63\x74\x69\x6F\x6E\x20\x61\x67\x61\x69\x6E\x73\x74\x20\x61\x63\x63\x69\x64"\
-	"\x65\x6E\x74\x61\x6C\x20\x69\x6E\x68\x65\x72\x69\x74\x61\x6E\x63\x65\x2E\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20"\
-	"\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66"\
-	"\x20\x73\x20\x3D\x3D\x3D\x20\x27\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20"\
-	"\x66\x75\x6E\x63\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73"\
-	"\x5B\x30\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x76\x2C\x20\x27\x76\x61\x72\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D"\
-	"\x20\x66\x75\x6E\x63\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x54\x68\x65\x20\x6E\x61\x6D"\
-	"\x65\x20\x69\x73\x20\x69\x6E\x20\x73\x63\x6F\x70\x65\x20\x61\x6E\x64\x20\x64\x65"\
-	"\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x74\x68\x65\x20\x63\x75\x72\x72\x65\x6E\x74"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x20\x3D\x3D\x3D\x20\x73\x29"\
-	"\x20\x7B\x0A\x0A\x2F\x2F\x20\x20\x20\x20\x20\x20\x43\x68\x61\x6E\x67\x65\x20\x27"\
-	"\x75\x6E\x75\x73\x65\x64\x27\x20\x74\x6F\x20\x27\x76\x61\x72\x27\x2C\x20\x61\x6E"\
-	"\x64\x20\x72\x65\x6A\x65\x63\x74\x20\x6C\x61\x62\x65\x6C\x73\x2E\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68"\
-	"\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75\x73"\
-	"\x65\x64\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x27\x76\x61\x72"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x28\x27\x7D\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x6F\x6C\x64\x5F\x69\x6E\x64\x65\x6E"\
+	"\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
+	"\x20\x28\x21\x6F\x72\x64\x69\x6E\x61\x72\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74"\
+	"\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64"\
+	"\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x27\x7B\x27\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
+	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
+	"\x73\x74\x6D\x74\x20\x7C\x7C\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x63\x75\x72\x6C\x79"\
+	"\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D"\
+	"\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B"\
+	"\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2C\x20\x27\x7B\x27\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C"\
+	"\x75\x65\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
+	"\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x5B\x73\x74\x61\x74\x65\x6D\x65\x6E\x74"\
+	"\x28\x29\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x72"\
+	"\x65\x61\x63\x68\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28"\
+	"\x76\x65\x72\x62\x29\x27\x5D\x20\x3D\x20\x6E\x75\x6C\x6C\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x6E\x62\x6C\x6F\x63\x6B\x20\x3D\x20\x62\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x72\x64\x69\x6E\x61\x72\x79\x20\x26\x26\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F\x65\x6D\x70\x74\x79\x20\x26\x26\x20\x28\x21"\
+	"\x61\x20\x7C\x7C\x20\x61\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x45\x6D\x70\x74\x79\x20\x62\x6C\x6F\x63\x6B\x2E\x22\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x61\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65"\
+	"\x72\x28\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6D"\
+	"\x65\x6D\x62\x65\x72\x73\x4F\x6E\x6C\x79\x20\x26\x26\x20\x74\x79\x70\x65\x6F\x66"\
+	"\x20\x6D\x65\x6D\x62\x65\x72\x73\x4F\x6E\x6C\x79\x5B\x6D\x5D\x20\x21\x3D\x3D\x20"\
+	"\x27\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65"\
+	"\x63\x74\x65\x64\x20\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x20\x27\x7B\x61\x7D\x27\x2E"\
+	"\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65"\
+	"\x6F\x66\x20\x6D\x65\x6D\x62\x65\x72\x5B\x6D\x5D\x20\x3D\x3D\x3D\x20\x27\x6E\x75"\
+	"\x6D\x62\x65\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6D\x65\x6D\x62\x65\x72\x5B\x6D\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x5B\x6D\x5D\x20\x3D\x20\x31\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20"\
+	"\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70"\
+	"\x6C\x69\x65\x64\x28\x74\x6F\x6B\x65\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x76\x61\x72\x20\x6E\x61\x6D\x65\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x76"\
+	"\x61\x6C\x75\x65\x2C\x20\x6C\x69\x6E\x65\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C"\
+	"\x69\x6E\x65\x2C\x20\x61\x20\x3D\x20\x69\x6D\x70\x6C\x69\x65\x64\x5B\x6E\x61\x6D"\
+	"\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65"\
+	"\x6F\x66\x20\x61\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x66"\
+	"\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x21\x61\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x5B\x6C\x69\x6E\x65\x5D\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6D\x70\x6C\x69\x65\x64\x5B\x6E\x61"\
+	"\x6D\x65\x5D\x20\x3D\x20\x61\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
+	"\x6C\x73\x65\x20\x69\x66\x20\x28\x61\x5B\x61\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D"\
+	"\x20\x31\x5D\x20\x21\x3D\x3D\x20\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x2E\x70\x75\x73\x68\x28\x6C\x69\x6E\x65\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x2F"\
+	"\x2F\x20\x42\x75\x69\x6C\x64\x20\x74\x68\x65\x20\x73\x79\x6E\x74\x61\x78\x20\x74"\
+	"\x61\x62\x6C\x65\x20\x62\x79\x20\x64\x65\x63\x6C\x61\x72\x69\x6E\x67\x20\x74\x68"\
+	"\x65\x20\x73\x79\x6E\x74\x61\x63\x74\x69\x63\x20\x65\x6C\x65\x6D\x65\x6E\x74\x73"\
+	"\x20\x6F\x66\x20\x74\x68\x65\x20\x6C\x61\x6E\x67\x75\x61\x67\x65\x2E\x0A\x0A\x20"\
+	"\x20\x20\x20\x74\x79\x70\x65\x28\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x2C\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x74\x79\x70\x65\x28\x27\x28\x73\x74\x72\x69\x6E\x67"\
+	"\x29\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x27"\
+	"\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x5D\x20\x3D\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x74\x79\x70\x65\x3A\x20\x27\x28\x69\x64\x65\x6E\x74"\
+	"\x69\x66\x69\x65\x72\x29\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x62\x70"\
+	"\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x65\x6E\x74\x69\x66"\
+	"\x69\x65\x72\x3A\x20\x74\x72\x75\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
+	"\x75\x64\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x76\x20\x3D\x20\x74\x68"\
+	"\x69\x73\x2E\x76\x61\x6C\x75\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x63\x6F\x70\x65\x5B\x76\x5D\x2C\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x2C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79"\
+	"\x70\x65\x6F\x66\x20\x73\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x27\x29\x20\x7B\x0A\x0A\x2F\x2F\x20\x50\x72\x6F\x74\x65\x63\x74\x69\x6F\x6E\x20"\
+	"\x61\x67\x61\x69\x6E\x73\x74\x20\x61\x63\x63\x69\x64\x65\x6E\x74\x61\x6C\x20\x69"\
+	"\x6E\x68\x65\x72\x69\x74\x61\x6E\x63\x65\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E"\
+	"\x65\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x73\x20\x3D\x3D\x3D\x20"\
+	"\x27\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20\x66\x75\x6E\x63\x74\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63"\
+	"\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x5B\x30\x5D\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62"\
+	"\x65\x6C\x28\x76\x2C\x20\x27\x76\x61\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x66\x75\x6E\x63\x74\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E"\
+	"\x63\x74\x20\x3D\x20\x66\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x2F\x2F\x20\x54\x68\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x69\x6E"\
+	"\x20\x73\x63\x6F\x70\x65\x20\x61\x6E\x64\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x69"\
+	"\x6E\x20\x74\x68\x65\x20\x63\x75\x72\x72\x65\x6E\x74\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x66\x75\x6E\x63\x74\x20\x3D\x3D\x3D\x20\x73\x29\x20\x7B\x0A\x0A\x2F\x2F\x20"\
+	"\x20\x20\x20\x20\x20\x43\x68\x61\x6E\x67\x65\x20\x27\x75\x6E\x75\x73\x65\x64\x27"\
+	"\x20\x74\x6F\x20\x27\x76\x61\x72\x27\x2C\x20\x61\x6E\x64\x20\x72\x65\x6A\x65\x63"\
+	"\x74\x20\x6C\x61\x62\x65\x6C\x73\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74"\
+	"\x5B\x76\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75\x73\x65\x64\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
+	"\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x27\x76\x61\x72\x27\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
+	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x5B\x76\x5D\x20\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
+	"\x69\x73\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x20\x3D\x20\x74\x72\x75"\
+	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x27\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x68\x69\x73\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27"\
-	"\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x5B\x27\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x6C\x61\x62\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E"\
-	"\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x2F\x2F\x20\x54\x68\x65\x20\x6E\x61\x6D\x65\x20"\
-	"\x69\x73\x20\x6E\x6F\x74\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x74\x68"\
-	"\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x20\x20\x49\x66\x20\x77\x65\x20\x61"\
-	"\x72\x65\x20\x69\x6E\x20\x74\x68\x65\x20\x67\x6C\x6F\x62\x61\x6C\x20\x73\x63\x6F"\
-	"\x70\x65\x2C\x0A\x2F\x2F\x20\x74\x68\x65\x6E\x20\x77\x65\x20\x68\x61\x76\x65\x20"\
-	"\x61\x6E\x20\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x20\x76\x61\x72\x69\x61\x62\x6C"\
-	"\x65\x2E\x0A\x2F\x2F\x0A\x2F\x2F\x20\x4F\x70\x65\x72\x61\x74\x6F\x72\x73\x20\x74"\
-	"\x79\x70\x65\x6F\x66\x20\x61\x6E\x64\x20\x64\x65\x6C\x65\x74\x65\x20\x64\x6F\x20"\
-	"\x6E\x6F\x74\x20\x72\x61\x69\x73\x65\x20\x72\x75\x6E\x74\x69\x6D\x65\x20\x65\x72"\
-	"\x72\x6F\x72\x73\x20\x65\x76\x65\x6E\x20\x69\x66\x20\x74\x68\x65\x20\x62\x61\x73"\
-	"\x65\x0A\x2F\x2F\x20\x6F\x62\x6A\x65\x63\x74\x20\x6F\x66\x20\x61\x20\x72\x65\x66"\
-	"\x65\x72\x65\x6E\x63\x65\x20\x69\x73\x20\x6E\x75\x6C\x6C\x20\x73\x6F\x20\x6E\x6F"\
-	"\x20\x6E\x65\x65\x64\x20\x74\x6F\x20\x64\x69\x73\x70\x6C\x61\x79\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x20\x69\x66\x20\x77\x65\x27\x72\x65\x0A\x2F\x2F\x20\x69\x6E\x73"\
-	"\x69\x64\x65\x20\x6F\x66\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x72\x20\x64\x65\x6C"\
-	"\x65\x74\x65\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
-	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C\x6F"\
-	"\x62\x61\x6C\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6E\x6F\x6E\x6E\x61\x6D\x65\x20\x21"\
-	"\x3D\x20\x27\x74\x79\x70\x65\x6F\x66\x27\x20\x26\x26\x20\x61\x6E\x6F\x6E\x6E\x61"\
-	"\x6D\x65\x20\x21\x3D\x20\x27\x64\x65\x6C\x65\x74\x65\x27\x20\x26\x26\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x2E\x75\x6E\x64\x65\x66\x20\x26\x26\x20\x74\x79\x70\x65\x6F\x66"\
-	"\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x5B\x76\x5D\x20\x21\x3D\x3D\x20\x27"\
-	"\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x64\x65\x66\x69\x6E\x65"\
-	"\x64\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70\x6C\x69"\
-	"\x65\x64\x28\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x0A\x2F\x2F\x20\x49\x66\x20\x74\x68"\
-	"\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x61\x6C\x72\x65\x61\x64\x79\x20\x64\x65"\
-	"\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x74\x68\x65\x20\x63\x75\x72\x72\x65\x6E\x74"\
-	"\x0A\x2F\x2F\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20\x62\x75\x74\x20\x6E\x6F"\
-	"\x74\x20\x61\x73\x20\x6F\x75\x74\x65\x72\x2C\x20\x74\x68\x65\x6E\x20\x74\x68\x65"\
-	"\x72\x65\x20\x69\x73\x20\x61\x20\x73\x63\x6F\x70\x65\x20\x65\x72\x72\x6F\x72\x2E"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
-	"\x27\x63\x6C\x6F\x73\x75\x72\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x76\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75\x73\x65\x64"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
 	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x75\x73"\
-	"\x65\x64\x20\x6F\x75\x74\x20\x6F\x66\x20\x73\x63\x6F\x70\x65\x2E\x22\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x6C"\
-	"\x61\x62\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D"\
-	"\x27\x20\x69\x73\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61\x62"\
-	"\x65\x6C\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x6F\x75\x74\x65\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x67\x6C\x6F\x62"\
-	"\x61\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x0A\x2F\x2F"\
-	"\x20\x49\x66\x20\x74\x68\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x64\x65\x66\x69"\
-	"\x6E\x65\x64\x20\x69\x6E\x20\x61\x6E\x20\x6F\x75\x74\x65\x72\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x2C\x20\x6D\x61\x6B\x65\x20\x61\x6E\x20\x6F\x75\x74\x65\x72\x20"\
-	"\x65\x6E\x74\x72\x79\x2C\x20\x61\x6E\x64\x20\x69\x66\x0A\x2F\x2F\x20\x69\x74\x20"\
-	"\x77\x61\x73\x20\x75\x6E\x75\x73\x65\x64\x2C\x20\x6D\x61\x6B\x65\x20\x69\x74\x20"\
-	"\x76\x61\x72\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x20\x3D\x3D"\
-	"\x3D\x20\x6E\x75\x6C\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x74\x68\x69\x73\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x20"\
+	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x6C\x61\x62"\
+	"\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20"\
+	"\x69\x73\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61\x62\x65\x6C"\
+	"\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x2F\x2F\x20\x54\x68\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x6E\x6F\x74\x20"\
+	"\x64\x65\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x74\x68\x65\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x2E\x20\x20\x49\x66\x20\x77\x65\x20\x61\x72\x65\x20\x69\x6E\x20\x74"\
+	"\x68\x65\x20\x67\x6C\x6F\x62\x61\x6C\x20\x73\x63\x6F\x70\x65\x2C\x0A\x2F\x2F\x20"\
+	"\x74\x68\x65\x6E\x20\x77\x65\x20\x68\x61\x76\x65\x20\x61\x6E\x20\x75\x6E\x64\x65"\
+	"\x66\x69\x6E\x65\x64\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x2E\x0A\x2F\x2F\x0A\x2F"\
+	"\x2F\x20\x4F\x70\x65\x72\x61\x74\x6F\x72\x73\x20\x74\x79\x70\x65\x6F\x66\x20\x61"\
+	"\x6E\x64\x20\x64\x65\x6C\x65\x74\x65\x20\x64\x6F\x20\x6E\x6F\x74\x20\x72\x61\x69"\
+	"\x73\x65\x20\x72\x75\x6E\x74\x69\x6D\x65\x20\x65\x72\x72\x6F\x72\x73\x20\x65\x76"\
+	"\x65\x6E\x20\x69\x66\x20\x74\x68\x65\x20\x62\x61\x73\x65\x0A\x2F\x2F\x20\x6F\x62"\
+	"\x6A\x65\x63\x74\x20\x6F\x66\x20\x61\x20\x72\x65\x66\x65\x72\x65\x6E\x63\x65\x20"\
+	"\x69\x73\x20\x6E\x75\x6C\x6C\x20\x73\x6F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20\x74"\
+	"\x6F\x20\x64\x69\x73\x70\x6C\x61\x79\x20\x77\x61\x72\x6E\x69\x6E\x67\x20\x69\x66"\
+	"\x20\x77\x65\x27\x72\x65\x0A\x2F\x2F\x20\x69\x6E\x73\x69\x64\x65\x20\x6F\x66\x20"\
+	"\x74\x79\x70\x65\x6F\x66\x20\x6F\x72\x20\x64\x65\x6C\x65\x74\x65\x2E\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66"\
+	"\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F"\
+	"\x73\x74\x5F\x62\x65\x67\x69\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6E\x6F\x6E\x6E\x61\x6D\x65"\
+	"\x20\x21\x3D\x20\x27\x74\x79\x70\x65\x6F\x66\x27\x20\x26\x26\x20\x61\x6E\x6F\x6E"\
+	"\x6E\x61\x6D\x65\x20\x21\x3D\x20\x27\x64\x65\x6C\x65\x74\x65\x27\x20\x26\x26\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x75\x6E\x64\x65\x66\x20\x26\x26\x20\x74\x79\x70\x65"\
+	"\x6F\x66\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x5B\x76\x5D\x20\x21\x3D\x3D"\
+	"\x20\x27\x62\x6F\x6F\x6C\x65\x61\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x61\x6C\x6C\x6F"\
-	"\x77\x65\x64\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20"\
+	"\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x64\x65\x66\x69"\
+	"\x6E\x65\x64\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65"\
+	"\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x6F\x73\x74\x5F\x65\x6E\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A"\
+	"\x20\x75\x6E\x64\x65\x66\x27\x2C\x20\x73\x74\x61\x72\x74\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x74\x65\x5F\x69\x6D"\
+	"\x70\x6C\x69\x65\x64\x28\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x0A\x2F\x2F\x20\x49\x66"\
+	"\x20\x74\x68\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x61\x6C\x72\x65\x61\x64\x79"\
+	"\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x74\x68\x65\x20\x63\x75\x72\x72"\
+	"\x65\x6E\x74\x0A\x2F\x2F\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20\x62\x75\x74"\
+	"\x20\x6E\x6F\x74\x20\x61\x73\x20\x6F\x75\x74\x65\x72\x2C\x20\x74\x68\x65\x6E\x20"\
+	"\x74\x68\x65\x72\x65\x20\x69\x73\x20\x61\x20\x73\x63\x6F\x70\x65\x20\x65\x72\x72"\
+	"\x6F\x72\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
+	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x63\x6C\x6F\x73\x75\x72\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x76\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75"\
+	"\x73\x65\x64\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27"\
+	"\x20\x75\x73\x65\x64\x20\x6F\x75\x74\x20\x6F\x66\x20\x73\x63\x6F\x70\x65\x2E\x22"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
+	"\x20\x27\x6C\x61\x62\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27"\
+	"\x7B\x61\x7D\x27\x20\x69\x73\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20"\
+	"\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70\x6C\x69\x65\x64\x28\x74\x6F\x6B\x65\x6E"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66"\
-	"\x20\x73\x20\x21\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29\x20\x7B\x0A\x0A"\
-	"\x2F\x2F\x20\x4F\x70\x65\x72\x61\x74\x6F\x72\x73\x20\x74\x79\x70\x65\x6F\x66\x20"\
-	"\x61\x6E\x64\x20\x64\x65\x6C\x65\x74\x65\x20\x64\x6F\x20\x6E\x6F\x74\x20\x72\x61"\
-	"\x69\x73\x65\x20\x72\x75\x6E\x74\x69\x6D\x65\x20\x65\x72\x72\x6F\x72\x73\x20\x65"\
-	"\x76\x65\x6E\x20\x69\x66\x20\x74\x68\x65\x20\x62\x61\x73\x65\x20\x6F\x62\x6A\x65"\
-	"\x63\x74\x20\x6F\x66\x0A\x2F\x2F\x20\x61\x20\x72\x65\x66\x65\x72\x65\x6E\x63\x65"\
-	"\x20\x69\x73\x20\x6E\x75\x6C\x6C\x20\x73\x6F\x20\x6E\x6F\x20\x6E\x65\x65\x64\x20"\
-	"\x74\x6F\x20\x64\x69\x73\x70\x6C\x61\x79\x20\x77\x61\x72\x6E\x69\x6E\x67\x20\x69"\
-	"\x66\x20\x77\x65\x27\x72\x65\x20\x69\x6E\x73\x69\x64\x65\x20\x6F\x66\x20\x74\x79"\
-	"\x70\x65\x6F\x66\x20\x6F\x72\x20\x64\x65\x6C\x65\x74\x65\x2E\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x61\x6E\x6F\x6E\x6E\x61\x6D\x65\x20\x21\x3D\x20\x27\x74\x79"\
-	"\x70\x65\x6F\x66\x27\x20\x26\x26\x20\x61\x6E\x6F\x6E\x6E\x61\x6D\x65\x20\x21\x3D"\
-	"\x20\x27\x64\x65\x6C\x65\x74\x65\x27\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x75\x6E\x64\x65\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x6F\x75\x74\x65\x72\x27\x3A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x67"\
+	"\x6C\x6F\x62\x61\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A"\
+	"\x0A\x2F\x2F\x20\x49\x66\x20\x74\x68\x65\x20\x6E\x61\x6D\x65\x20\x69\x73\x20\x64"\
+	"\x65\x66\x69\x6E\x65\x64\x20\x69\x6E\x20\x61\x6E\x20\x6F\x75\x74\x65\x72\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20\x6D\x61\x6B\x65\x20\x61\x6E\x20\x6F\x75\x74"\
+	"\x65\x72\x20\x65\x6E\x74\x72\x79\x2C\x20\x61\x6E\x64\x20\x69\x66\x0A\x2F\x2F\x20"\
+	"\x69\x74\x20\x77\x61\x73\x20\x75\x6E\x75\x73\x65\x64\x2C\x20\x6D\x61\x6B\x65\x20"\
+	"\x69\x74\x20\x76\x61\x72\x2E\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x20\x3D\x3D\x3D\x20\x74"\
+	"\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20"\
+	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73"\
+	"\x20\x3D\x3D\x3D\x20\x6E\x75\x6C\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x64"\
-	"\x65\x66\x69\x6E\x65\x64\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B"\
+	"\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x61"\
+	"\x6C\x6C\x6F\x77\x65\x64\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70\x6C\x69\x65"\
-	"\x64\x28\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x73\x5B\x76\x5D\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x5B\x27\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x5B\x76\x5D\x20\x3D\x20\x27\x63\x6C\x6F\x73\x75\x72\x65\x27\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x73\x5B"\
-	"\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x3F\x20\x27\x67\x6C\x6F\x62\x61"\
-	"\x6C\x27\x20\x3A\x20\x27\x6F\x75\x74\x65\x72\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x74\x65\x5F\x69\x6D\x70\x6C\x69\x65\x64\x28\x74\x6F"\
+	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70"\
+	"\x65\x6F\x66\x20\x73\x20\x21\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29\x20"\
+	"\x7B\x0A\x0A\x2F\x2F\x20\x4F\x70\x65\x72\x61\x74\x6F\x72\x73\x20\x74\x79\x70\x65"\
+	"\x6F\x66\x20\x61\x6E\x64\x20\x64\x65\x6C\x65\x74\x65\x20\x64\x6F\x20\x6E\x6F\x74"\
+	"\x20\x72\x61\x69\x73\x65\x20\x72\x75\x6E\x74\x69\x6D\x65\x20\x65\x72\x72\x6F\x72"\
+	"\x73\x20\x65\x76\x65\x6E\x20\x69\x66\x20\x74\x68\x65\x20\x62\x61\x73\x65\x20\x6F"\
+	"\x62\x6A\x65\x63\x74\x20\x6F\x66\x0A\x2F\x2F\x20\x61\x20\x72\x65\x66\x65\x72\x65"\
+	"\x6E\x63\x65\x20\x69\x73\x20\x6E\x75\x6C\x6C\x20\x73\x6F\x20\x6E\x6F\x20\x6E\x65"\
+	"\x65\x64\x20\x74\x6F\x20\x64\x69\x73\x70\x6C\x61\x79\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x20\x69\x66\x20\x77\x65\x27\x72\x65\x20\x69\x6E\x73\x69\x64\x65\x20\x6F\x66"\
+	"\x20\x74\x79\x70\x65\x6F\x66\x20\x6F\x72\x20\x64\x65\x6C\x65\x74\x65\x2E\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x74\x61\x72\x74\x20\x3D\x20\x63\x6F\x73\x74\x5F\x62\x65\x67\x69"\
+	"\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x6E\x6F\x6E\x6E\x61\x6D"\
+	"\x65\x20\x21\x3D\x20\x27\x74\x79\x70\x65\x6F\x66\x27\x20\x26\x26\x20\x61\x6E\x6F"\
+	"\x6E\x6E\x61\x6D\x65\x20\x21\x3D\x20\x27\x64\x65\x6C\x65\x74\x65\x27\x20\x26\x26"\
+	"\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x75\x6E\x64\x65\x66\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20"\
+	"\x69\x73\x20\x6E\x6F\x74\x20\x64\x65\x66\x69\x6E\x65\x64\x2E\x22\x2C\x20\x74\x6F"\
+	"\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D"\
+	"\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x72\x75\x6C\x65\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74"\
+	"\x5F\x65\x6E\x64\x28\x27\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x75\x6E\x64\x65\x66\x27"\
+	"\x2C\x20\x73\x74\x61\x72\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x74\x65\x5F\x69"\
+	"\x6D\x70\x6C\x69\x65\x64\x28\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x73\x5B\x76\x5D"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x5B\x27\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x5B\x76\x5D\x20\x3D\x20\x27\x63\x6C\x6F\x73\x75\x72"\
+	"\x65\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D"\
+	"\x20\x3D\x20\x73\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x3F\x20\x27"\
+	"\x67\x6C\x6F\x62\x61\x6C\x27\x20\x3A\x20\x27\x6F\x75\x74\x65\x72\x27\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x76"\
-	"\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75\x73\x65"\
-	"\x64\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x76\x5D\x20\x3D\x20\x27"\
-	"\x63\x6C\x6F\x73\x75\x72\x65\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
-	"\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x73\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29"\
-	"\x27\x5D\x20\x3F\x20\x27\x67\x6C\x6F\x62\x61\x6C\x27\x20\x3A\x20\x27\x6F\x75\x74"\
-	"\x65\x72\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x76\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x75\x6E\x75\x73\x65\x64\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x76"\
+	"\x5D\x20\x3D\x20\x27\x63\x6C\x6F\x73\x75\x72\x65\x27\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6C\x6F\x73\x75\x72\x65\x27\x3A\x0A"\
+	"\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D\x20\x73\x5B\x27\x28\x67\x6C"\
+	"\x6F\x62\x61\x6C\x29\x27\x5D\x20\x3F\x20\x27\x67\x6C\x6F\x62\x61\x6C\x27\x20\x3A"\
+	"\x20\x27\x6F\x75\x74\x65\x72\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
+	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6C\x6F\x73\x75"\
+	"\x72\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x70\x61\x72\x61\x6D"\
+	"\x65\x74\x65\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x5B\x76\x5D\x20\x3D\x20\x73\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20"\
+	"\x3F\x20\x27\x67\x6C\x6F\x62\x61\x6C\x27\x20\x3A\x20\x27\x6F\x75\x74\x65\x72\x27"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x70\x61\x72\x61\x6D\x65\x74\x65\x72\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x3D"\
-	"\x20\x73\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x3F\x20\x27\x67\x6C"\
-	"\x6F\x62\x61\x6C\x27\x20\x3A\x20\x27\x6F\x75\x74\x65\x72\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x6C\x61\x62\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x6C\x61\x62\x65\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x61\x20\x73\x74"\
-	"\x61\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x64\x3A\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61"\
-	"\x6E\x20\x6F\x70\x65\x72\x61\x74\x6F\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65"\
-	"\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
-	"\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x0A\x20"\
-	"\x20\x20\x20\x74\x79\x70\x65\x28\x27\x28\x72\x65\x67\x65\x78\x70\x29\x27\x2C\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D"\
-	"\x29\x3B\x0A\x0A\x0A\x2F\x2F\x20\x45\x43\x4D\x41\x53\x63\x72\x69\x70\x74\x20\x70"\
-	"\x61\x72\x73\x65\x72\x0A\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x28\x65"\
-	"\x6E\x64\x6C\x69\x6E\x65\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D"\
-	"\x28\x27\x28\x62\x65\x67\x69\x6E\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C"\
-	"\x69\x6D\x28\x27\x28\x65\x6E\x64\x29\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20"\
-	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3C\x2F\x27"\
-	"\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x64\x65\x6C\x69\x6D\x28\x27\x3C\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C"\
-	"\x69\x6D\x28\x27\x3C\x21\x2D\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69"\
-	"\x6D\x28\x27\x2D\x2D\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28"\
-	"\x27\x28\x65\x72\x72\x6F\x72\x29\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x7D\x27\x29\x2E"\
-	"\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65"\
-	"\x6C\x69\x6D\x28\x27\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28"\
-	"\x27\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x22\x27\x29"\
-	"\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64"\
-	"\x65\x6C\x69\x6D\x28\x22\x27\x22\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72"\
-	"\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3B\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3A\x27\x29\x2E\x72\x65\x61\x63\x68"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73"\
+	"\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x64"\
+	"\x3A\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63"\
+	"\x74\x65\x64\x20\x61\x6E\x20\x6F\x70\x65\x72\x61\x74\x6F\x72\x20\x61\x6E\x64\x20"\
+	"\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
+	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x7D\x3B\x0A\x0A\x20\x20\x20\x20\x74\x79\x70\x65\x28\x27\x28\x72\x65\x67\x65\x78"\
+	"\x70\x29\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
+	"\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x0A\x2F\x2F\x20\x45\x43\x4D\x41\x53\x63\x72"\
+	"\x69\x70\x74\x20\x70\x61\x72\x73\x65\x72\x0A\x0A\x20\x20\x20\x20\x64\x65\x6C\x69"\
+	"\x6D\x28\x27\x28\x65\x6E\x64\x6C\x69\x6E\x65\x29\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x64\x65\x6C\x69\x6D\x28\x27\x28\x62\x65\x67\x69\x6E\x29\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x28\x65\x6E\x64\x29\x27\x29\x2E\x72\x65\x61"\
+	"\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D"\
+	"\x28\x27\x3C\x2F\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3C\x21\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3C\x21\x2D\x2D\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x64\x65\x6C\x69\x6D\x28\x27\x2D\x2D\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x64"\
+	"\x65\x6C\x69\x6D\x28\x27\x28\x65\x72\x72\x6F\x72\x29\x27\x29\x2E\x72\x65\x61\x63"\
+	"\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28"\
+	"\x27\x7D\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x64"\
+	"\x65\x6C\x69\x6D\x28\x27\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D"\
+	"\x28\x27\x22\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x22\x27\x22\x29\x2E\x72\x65\x61\x63\x68"\
 	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27"\
-	"\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x23\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x40\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x65\x6C\x73\x65\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x61\x73\x65\x27\x29\x2E\x72\x65"\
-	"\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65"\
-	"\x72\x76\x65\x28\x27\x63\x61\x74\x63\x68\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65"\
-	"\x73\x65\x72\x76\x65\x28\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x29\x2E\x72\x65\x61"\
-	"\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72"\
-	"\x76\x65\x28\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x29\x3B\x0A\x20\x20\x20\x20\x72"\
-	"\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x61\x72\x67\x75\x6D\x65\x6E\x74\x73"\
-	"\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x78\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64"\
-	"\x65\x20\x26\x26\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29"\
-	"\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
-	"\x72\x6E\x69\x6E\x67\x28\x22\x53\x74\x72\x69\x63\x74\x20\x76\x69\x6F\x6C\x61\x74"\
-	"\x69\x6F\x6E\x2E\x22\x2C\x20\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65"\
-	"\x76\x61\x72\x28\x27\x65\x76\x61\x6C\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73"\
-	"\x65\x72\x76\x65\x76\x61\x72\x28\x27\x66\x61\x6C\x73\x65\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x49\x6E\x66\x69\x6E\x69"\
-	"\x74\x79\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72"\
-	"\x28\x27\x4E\x61\x4E\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65"\
-	"\x76\x61\x72\x28\x27\x6E\x75\x6C\x6C\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73"\
-	"\x65\x72\x76\x65\x76\x61\x72\x28\x27\x74\x68\x69\x73\x27\x2C\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x28\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20\x26\x26\x20\x28\x28"\
-	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x29\x27\x5D"\
-	"\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x6E\x61\x6D\x65\x29\x27\x5D\x2E\x63\x68\x61\x72"\
-	"\x41\x74\x28\x30\x29\x20\x3E\x20\x27\x5A\x27\x29\x20\x7C\x7C\x20\x66\x75\x6E\x63"\
-	"\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x53"\
-	"\x74\x72\x69\x63\x74\x20\x76\x69\x6F\x6C\x61\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x78"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x74\x72\x75"\
-	"\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28"\
-	"\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x3B\x0A\x20\x20\x20\x20\x61\x73"\
-	"\x73\x69\x67\x6E\x6F\x70\x28\x27\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x27"\
-	"\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28"\
-	"\x27\x2B\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x61\x64\x64\x27\x2C\x20\x32"\
-	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x2D\x3D"\
-	"\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x75\x62\x27\x2C\x20\x32\x30\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x2A\x3D\x27\x2C\x20"\
-	"\x27\x61\x73\x73\x69\x67\x6E\x6D\x75\x6C\x74\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x2F\x3D\x27\x2C\x20\x27\x61"\
-	"\x73\x73\x69\x67\x6E\x64\x69\x76\x27\x2C\x20\x32\x30\x29\x2E\x6E\x75\x64\x20\x3D"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x41\x20\x72\x65\x67\x75\x6C\x61\x72\x20"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x6C\x69\x74\x65\x72\x61\x6C\x20\x63"\
-	"\x61\x6E\x20\x62\x65\x20\x63\x6F\x6E\x66\x75\x73\x65\x64\x20\x77\x69\x74\x68\x20"\
-	"\x27\x2F\x3D\x27\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20"\
-	"\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x25\x3D\x27\x2C\x20\x27\x61\x73\x73\x69"\
-	"\x67\x6E\x6D\x6F\x64\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74"\
-	"\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x26\x3D\x27\x2C\x20\x27"\
-	"\x61\x73\x73\x69\x67\x6E\x62\x69\x74\x61\x6E\x64\x27\x2C\x20\x32\x30\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28"\
-	"\x27\x7C\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x62\x69\x74\x6F\x72\x27\x2C"\
-	"\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73"\
-	"\x69\x67\x6E\x6F\x70\x28\x27\x5E\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x62"\
-	"\x69\x74\x78\x6F\x72\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74"\
-	"\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x3C\x3C\x3D\x27\x2C\x20"\
-	"\x27\x61\x73\x73\x69\x67\x6E\x73\x68\x69\x66\x74\x6C\x65\x66\x74\x27\x2C\x20\x32"\
-	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67"\
-	"\x6E\x6F\x70\x28\x27\x3E\x3E\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x68"\
-	"\x69\x66\x74\x72\x69\x67\x68\x74\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x3E\x3E\x3E"\
-	"\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x68\x69\x66\x74\x72\x69\x67\x68"\
-	"\x74\x75\x6E\x73\x69\x67\x6E\x65\x64\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x69\x6E\x66\x69\x78\x28\x27\x3F\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74"\
-	"\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3A\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x5B\x27\x65\x6C\x73\x65\x27"\
-	"\x5D\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x2C\x20\x33\x30\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69\x6E"\
-	"\x66\x69\x78\x28\x27\x7C\x7C\x27\x2C\x20\x27\x6F\x72\x27\x2C\x20\x34\x30\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x26\x26\x27\x2C\x20\x27\x61\x6E"\
-	"\x64\x27\x2C\x20\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65"\
-	"\x28\x27\x7C\x27\x2C\x20\x27\x62\x69\x74\x6F\x72\x27\x2C\x20\x37\x30\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x5E\x27\x2C\x20\x27\x62\x69"\
-	"\x74\x78\x6F\x72\x27\x2C\x20\x38\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77"\
-	"\x69\x73\x65\x28\x27\x26\x27\x2C\x20\x27\x62\x69\x74\x61\x6E\x64\x27\x2C\x20\x39"\
-	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3D\x3D"\
-	"\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x72"\
-	"\x69\x67\x68\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
-	"\x65\x71\x6E\x75\x6C\x6C\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x71\x6E\x75"\
-	"\x6C\x6C\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x20\x27\x6E\x75"\
-	"\x6C\x6C\x27\x20\x7C\x7C\x20\x72\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D"\
-	"\x3D\x20\x27\x6E\x75\x6C\x6C\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x21\x65\x71\x6E\x75\x6C\x6C\x20\x26\x26\x20\x6F\x70\x74\x69\x6F"\
-	"\x6E\x2E\x65\x71\x65\x71\x65\x71\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65"\
-	"\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20"\
-	"\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x3A\x27\x29\x2E"\
+	"\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x64\x65"\
+	"\x6C\x69\x6D\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28"\
+	"\x27\x23\x27\x29\x3B\x0A\x20\x20\x20\x20\x64\x65\x6C\x69\x6D\x28\x27\x40\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x65\x6C\x73\x65\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x61\x73\x65"\
+	"\x27\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x61\x74\x63\x68\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x64\x65\x66\x61\x75\x6C\x74\x27"\
+	"\x29\x2E\x72\x65\x61\x63\x68\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x72\x65\x73\x65\x72\x76\x65\x28\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x61\x72\x67\x75"\
+	"\x6D\x65\x6E\x74\x73\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x78\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x69\x63"\
+	"\x74\x5F\x6D\x6F\x64\x65\x20\x26\x26\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C"\
+	"\x6F\x62\x61\x6C\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x53\x74\x72\x69\x63\x74\x20\x76"\
+	"\x69\x6F\x6C\x61\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x78\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x72\x65"\
+	"\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x65\x76\x61\x6C\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x66\x61\x6C\x73\x65\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x49"\
+	"\x6E\x66\x69\x6E\x69\x74\x79\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72"\
+	"\x76\x65\x76\x61\x72\x28\x27\x4E\x61\x4E\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65"\
+	"\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x6E\x75\x6C\x6C\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72\x28\x27\x74\x68\x69\x73\x27\x2C"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x78\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20"\
+	"\x26\x26\x20\x28\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x73\x74\x61\x74\x65\x6D\x65"\
+	"\x6E\x74\x29\x27\x5D\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6E\x61\x6D\x65\x29\x27\x5D"\
+	"\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3E\x20\x27\x5A\x27\x29\x20\x7C\x7C"\
+	"\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x53\x74\x72\x69\x63\x74\x20\x76\x69\x6F\x6C\x61\x74\x69\x6F\x6E"\
+	"\x2E\x22\x2C\x20\x78\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x76\x61\x72"\
+	"\x28\x27\x74\x72\x75\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76"\
+	"\x65\x76\x61\x72\x28\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x3D\x27\x2C\x20\x27\x61\x73"\
+	"\x73\x69\x67\x6E\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69"\
+	"\x67\x6E\x6F\x70\x28\x27\x2B\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x61\x64"\
+	"\x64\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F"\
+	"\x70\x28\x27\x2D\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x75\x62\x27\x2C"\
+	"\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27"\
+	"\x2A\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x6D\x75\x6C\x74\x27\x2C\x20\x32"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x2F\x3D"\
+	"\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x64\x69\x76\x27\x2C\x20\x32\x30\x29\x2E"\
+	"\x6E\x75\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x41\x20\x72\x65\x67"\
+	"\x75\x6C\x61\x72\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x6C\x69\x74\x65"\
+	"\x72\x61\x6C\x20\x63\x61\x6E\x20\x62\x65\x20\x63\x6F\x6E\x66\x75\x73\x65\x64\x20"\
+	"\x77\x69\x74\x68\x20\x27\x2F\x3D\x27\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x7D\x3B"\
+	"\x0A\x20\x20\x20\x20\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x25\x3D\x27\x2C\x20"\
+	"\x27\x61\x73\x73\x69\x67\x6E\x6D\x6F\x64\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x26"\
+	"\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x62\x69\x74\x61\x6E\x64\x27\x2C\x20"\
+	"\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69"\
+	"\x67\x6E\x6F\x70\x28\x27\x7C\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x62\x69"\
+	"\x74\x6F\x72\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69"\
+	"\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x5E\x3D\x27\x2C\x20\x27\x61\x73"\
+	"\x73\x69\x67\x6E\x62\x69\x74\x78\x6F\x72\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x3C"\
+	"\x3C\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x68\x69\x66\x74\x6C\x65\x66"\
+	"\x74\x27\x2C\x20\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65"\
+	"\x61\x73\x73\x69\x67\x6E\x6F\x70\x28\x27\x3E\x3E\x3D\x27\x2C\x20\x27\x61\x73\x73"\
+	"\x69\x67\x6E\x73\x68\x69\x66\x74\x72\x69\x67\x68\x74\x27\x2C\x20\x32\x30\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x61\x73\x73\x69\x67\x6E\x6F\x70"\
+	"\x28\x27\x3E\x3E\x3E\x3D\x27\x2C\x20\x27\x61\x73\x73\x69\x67\x6E\x73\x68\x69\x66"\
+	"\x74\x72\x69\x67\x68\x74\x75\x6E\x73\x69\x67\x6E\x65\x64\x27\x2C\x20\x32\x30\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x3F\x27\x2C\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D"\
+	"\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E"\
+	"\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
+	"\x27\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x5B\x27"\
+	"\x65\x6C\x73\x65\x27\x5D\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
+	"\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x33\x30\x29\x3B\x0A\x0A\x20"\
+	"\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x7C\x7C\x27\x2C\x20\x27\x6F\x72\x27\x2C"\
+	"\x20\x34\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x26\x26\x27"\
+	"\x2C\x20\x27\x61\x6E\x64\x27\x2C\x20\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69"\
+	"\x74\x77\x69\x73\x65\x28\x27\x7C\x27\x2C\x20\x27\x62\x69\x74\x6F\x72\x27\x2C\x20"\
+	"\x37\x30\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x5E\x27"\
+	"\x2C\x20\x27\x62\x69\x74\x78\x6F\x72\x27\x2C\x20\x38\x30\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x26\x27\x2C\x20\x27\x62\x69\x74\x61\x6E"\
+	"\x64\x27\x2C\x20\x39\x30\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F"\
+	"\x6E\x28\x27\x3D\x3D\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65"\
+	"\x66\x74\x2C\x20\x72\x69\x67\x68\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x76\x61\x72\x20\x65\x71\x6E\x75\x6C\x6C\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x2E\x65\x71\x6E\x75\x6C\x6C\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D"\
+	"\x3D\x20\x27\x6E\x75\x6C\x6C\x27\x20\x7C\x7C\x20\x72\x69\x67\x68\x74\x2E\x76\x61"\
+	"\x6C\x75\x65\x20\x3D\x3D\x20\x27\x6E\x75\x6C\x6C\x27\x29\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x65\x71\x6E\x75\x6C\x6C\x20\x26\x26\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x71\x65\x71\x65\x71\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78"\
+	"\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73"\
+	"\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
+	"\x69\x73\x2C\x20\x27\x3D\x3D\x3D\x27\x2C\x20\x27\x3D\x3D\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50"\
+	"\x6F\x6F\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x6C\x65\x66\x74\x29\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x28\x22\x55\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61"\
+	"\x72\x65\x20\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C\x20\x27"\
-	"\x3D\x3D\x3D\x27\x2C\x20\x27\x3D\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50\x6F\x6F\x72\x52\x65"\
-	"\x6C\x61\x74\x69\x6F\x6E\x28\x6C\x65\x66\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65"\
-	"\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72\x65\x20\x77\x69"\
-	"\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C\x20\x27\x3D\x3D\x3D\x27\x2C"\
-	"\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50\x6F\x6F\x72\x52"\
-	"\x65\x6C\x61\x74\x69\x6F\x6E\x28\x72\x69\x67\x68\x74\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55"\
-	"\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72\x65\x20"\
-	"\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C\x20\x27\x3D\x3D\x3D"\
-	"\x27\x2C\x20\x72\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3D\x3D\x3D\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x21\x3D\x27\x2C\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x72\x69\x67\x68\x74\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x65\x71\x65\x71\x65\x71\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61"\
-	"\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C\x20\x27\x21\x3D"\
-	"\x3D\x27\x2C\x20\x27\x21\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50\x6F\x6F\x72\x52\x65\x6C\x61"\
-	"\x74\x69\x6F\x6E\x28\x6C\x65\x66\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x27"\
-	"\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72\x65\x20\x77\x69\x74\x68"\
-	"\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C\x20\x27\x21\x3D\x3D"\
-	"\x27\x2C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50\x6F\x6F"\
-	"\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x72\x69\x67\x68\x74\x29\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x22\x55\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72"\
-	"\x65\x20\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
+	"\x3D\x3D\x3D\x27\x2C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73"\
+	"\x50\x6F\x6F\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x72\x69\x67\x68\x74\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x55\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D"\
+	"\x70\x61\x72\x65\x20\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C"\
+	"\x20\x27\x3D\x3D\x3D\x27\x2C\x20\x72\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3D\x3D\x3D\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x21\x3D\x27\x2C"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x72\x69\x67"\
+	"\x68\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x65\x71\x65\x71\x65\x71\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65"\
+	"\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65"\
+	"\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73"\
-	"\x2C\x20\x27\x21\x3D\x3D\x27\x2C\x20\x72\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x21\x3D\x3D\x27"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3C\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3E\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3C\x3D\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27\x3E\x3D\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3C\x3C\x27\x2C\x20\x27"\
-	"\x73\x68\x69\x66\x74\x6C\x65\x66\x74\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3E\x3E\x27\x2C\x20\x27\x73\x68\x69"\
-	"\x66\x74\x72\x69\x67\x68\x74\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3E\x3E\x3E\x27\x2C\x20\x27\x73\x68\x69\x66"\
-	"\x74\x72\x69\x67\x68\x74\x75\x6E\x73\x69\x67\x6E\x65\x64\x27\x2C\x20\x31\x32\x30"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x69\x6E\x27\x2C\x20\x27"\
-	"\x69\x6E\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78"\
-	"\x28\x27\x69\x6E\x73\x74\x61\x6E\x63\x65\x6F\x66\x27\x2C\x20\x27\x69\x6E\x73\x74"\
-	"\x61\x6E\x63\x65\x6F\x66\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x69"\
-	"\x6E\x66\x69\x78\x28\x27\x2B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
-	"\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x76\x61\x72\x20\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73"\
-	"\x73\x69\x6F\x6E\x28\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x6C\x65\x66\x74\x20\x26\x26\x20\x72\x69\x67\x68\x74\x20\x26\x26\x20"\
-	"\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67"\
-	"\x29\x27\x20\x26\x26\x20\x72\x69\x67\x68\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
-	"\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x2B\x3D\x20\x72"\
-	"\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3D"\
-	"\x20\x72\x69\x67\x68\x74\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F"\
-	"\x6E\x2E\x73\x63\x72\x69\x70\x74\x75\x72\x6C\x20\x26\x26\x20\x6A\x78\x2E\x74\x65"\
-	"\x73\x74\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x4A\x61\x76\x61\x53\x63\x72\x69\x70\x74\x20\x55\x52\x4C\x2E\x22\x2C"\
-	"\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66"\
-	"\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68"\
-	"\x74\x20\x3D\x20\x72\x69\x67\x68\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31"\
-	"\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2B\x27\x2C"\
-	"\x20\x27\x6E\x75\x6D\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28"\
-	"\x27\x2B\x2B\x2B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F"\
-	"\x6E\x66\x75\x73\x69\x6E\x67\x20\x70\x6C\x75\x73\x65\x73\x2E\x22\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79\x20\x3D\x20\x27\x75"\
-	"\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x69\x6E\x66\x69\x78\x28\x27\x2B\x2B\x2B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x70\x6C"\
-	"\x75\x73\x65\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69"\
-	"\x73\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72"\
-	"\x65\x73\x73\x69\x6F\x6E\x28\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x2C"\
-	"\x20\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2D\x27"\
-	"\x2C\x20\x27\x73\x75\x62\x27\x2C\x20\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x70"\
-	"\x72\x65\x66\x69\x78\x28\x27\x2D\x27\x2C\x20\x27\x6E\x65\x67\x27\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2D\x2D\x2D\x27\x2C\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x6D\x69"\
-	"\x6E\x75\x73\x65\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
-	"\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
-	"\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73"\
-	"\x2E\x61\x72\x69\x74\x79\x20\x3D\x20\x27\x75\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20"\
+	"\x2C\x20\x27\x21\x3D\x3D\x27\x2C\x20\x27\x21\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x69\x73\x50\x6F\x6F"\
+	"\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x6C\x65\x66\x74\x29\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
+	"\x55\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63\x6F\x6D\x70\x61\x72\x65"\
+	"\x20\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2C"\
+	"\x20\x27\x21\x3D\x3D\x27\x2C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
+	"\x69\x73\x50\x6F\x6F\x72\x52\x65\x6C\x61\x74\x69\x6F\x6E\x28\x72\x69\x67\x68\x74"\
+	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x63"\
+	"\x6F\x6D\x70\x61\x72\x65\x20\x77\x69\x74\x68\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x74\x68\x69\x73\x2C\x20\x27\x21\x3D\x3D\x27\x2C\x20\x72\x69\x67\x68\x74\x2E"\
+	"\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2D\x2D"\
-	"\x2D\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43"\
-	"\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x6D\x69\x6E\x75\x73\x65\x73\x2E\x22\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74\x20\x3D"\
-	"\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E"\
-	"\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31"\
-	"\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
-	"\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x33\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2A\x27\x2C\x20\x27\x6D\x75\x6C\x74\x27"\
-	"\x2C\x20\x31\x34\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2F"\
-	"\x27\x2C\x20\x27\x64\x69\x76\x27\x2C\x20\x31\x34\x30\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x69\x6E\x66\x69\x78\x28\x27\x25\x27\x2C\x20\x27\x6D\x6F\x64\x27\x2C\x20\x31\x34"\
-	"\x30\x29\x3B\x0A\x0A\x20\x20\x20\x20\x73\x75\x66\x66\x69\x78\x28\x27\x2B\x2B\x27"\
-	"\x2C\x20\x27\x70\x6F\x73\x74\x69\x6E\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72"\
-	"\x65\x66\x69\x78\x28\x27\x2B\x2B\x27\x2C\x20\x27\x70\x72\x65\x69\x6E\x63\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x2B\x2B\x27\x5D\x2E\x65"\
-	"\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x73\x75\x66"\
-	"\x66\x69\x78\x28\x27\x2D\x2D\x27\x2C\x20\x27\x70\x6F\x73\x74\x64\x65\x63\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2D\x2D\x27\x2C\x20\x27"\
-	"\x70\x72\x65\x64\x65\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78"\
-	"\x5B\x27\x2D\x2D\x27\x5D\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x64\x65\x6C\x65\x74\x65\x27\x2C"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x70\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
-	"\x6E\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x70"\
-	"\x20\x7C\x7C\x20\x28\x70\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20\x26\x26"\
-	"\x20\x70\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x56"\
-	"\x61\x72\x69\x61\x62\x6C\x65\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20"\
-	"\x62\x65\x20\x64\x65\x6C\x65\x74\x65\x64\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69"\
-	"\x72\x73\x74\x20\x3D\x20\x70\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70"\
-	"\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69"\
-	"\x78\x28\x27\x7E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x62\x69\x74\x77\x69\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74"\
-	"\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x2C\x20\x27\x7E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
-	"\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28"\
-	"\x27\x21\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79\x20\x3D\x20\x27\x75"\
-	"\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62"\
-	"\x61\x6E\x67\x5B\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E\x69\x64\x5D\x20\x3D"\
-	"\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E"\
-	"\x67\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68"\
-	"\x69\x73\x2C\x20\x27\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28"\
-	"\x27\x74\x79\x70\x65\x6F\x66\x27\x2C\x20\x27\x74\x79\x70\x65\x6F\x66\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x6E\x65\x77\x27\x2C\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x63\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
-	"\x31\x35\x35\x29\x2C\x20\x69\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x63\x20\x26\x26\x20\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x63\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x5B\x27"\
-	"\x6E\x65\x77\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x63\x2E"\
-	"\x76\x61\x6C\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x4F\x62\x6A\x65\x63\x74\x27\x3A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x74\x68\x65\x20\x6F\x62\x6A"\
-	"\x65\x63\x74\x20\x6C\x69\x74\x65\x72\x61\x6C\x20\x6E\x6F\x74\x61\x74\x69\x6F\x6E"\
-	"\x20\x7B\x7D\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x4E\x75\x6D\x62\x65\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x53\x74\x72\x69\x6E"\
-	"\x67\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x42\x6F\x6F\x6C\x65\x61\x6E\x27\x3A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x4D\x61"\
-	"\x74\x68\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x61\x73\x65\x20\x27\x4A\x53\x4F\x4E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x44\x6F\x20\x6E\x6F\x74\x20\x75\x73\x65\x20\x7B\x61\x7D\x20\x61\x73"\
-	"\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E\x22\x2C\x20\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x63\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x46\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
-	"\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28"\
+	"\x27\x21\x3D\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E"\
+	"\x28\x27\x3C\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28"\
+	"\x27\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27"\
+	"\x3C\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x6C\x61\x74\x69\x6F\x6E\x28\x27"\
+	"\x3E\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3C"\
+	"\x3C\x27\x2C\x20\x27\x73\x68\x69\x66\x74\x6C\x65\x66\x74\x27\x2C\x20\x31\x32\x30"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3E\x3E\x27\x2C"\
+	"\x20\x27\x73\x68\x69\x66\x74\x72\x69\x67\x68\x74\x27\x2C\x20\x31\x32\x30\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x62\x69\x74\x77\x69\x73\x65\x28\x27\x3E\x3E\x3E\x27\x2C\x20"\
+	"\x27\x73\x68\x69\x66\x74\x72\x69\x67\x68\x74\x75\x6E\x73\x69\x67\x6E\x65\x64\x27"\
+	"\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x69"\
+	"\x6E\x27\x2C\x20\x27\x69\x6E\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x69\x6E\x66\x69\x78\x28\x27\x69\x6E\x73\x74\x61\x6E\x63\x65\x6F\x66\x27\x2C\x20"\
+	"\x27\x69\x6E\x73\x74\x61\x6E\x63\x65\x6F\x66\x27\x2C\x20\x31\x32\x30\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2B\x27\x2C\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x72\x69\x67\x68\x74\x20\x3D\x20\x65"\
+	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x20\x26\x26\x20\x72\x69\x67\x68"\
+	"\x74\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73"\
+	"\x74\x72\x69\x6E\x67\x29\x27\x20\x26\x26\x20\x72\x69\x67\x68\x74\x2E\x69\x64\x20"\
+	"\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65"\
+	"\x20\x2B\x3D\x20\x72\x69\x67\x68\x74\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x63\x68\x61\x72\x61\x63"\
+	"\x74\x65\x72\x20\x3D\x20\x72\x69\x67\x68\x74\x2E\x63\x68\x61\x72\x61\x63\x74\x65"\
+	"\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x63\x72\x69\x70\x74\x75\x72\x6C\x20\x26\x26\x20"\
+	"\x6A\x78\x2E\x74\x65\x73\x74\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x4A\x61\x76\x61\x53\x63\x72\x69\x70\x74\x20\x55"\
+	"\x52\x4C\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20"\
+	"\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74"\
+	"\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x72\x69\x67\x68\x74\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20"\
+	"\x20\x7D\x2C\x20\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78"\
+	"\x28\x27\x2B\x27\x2C\x20\x27\x6E\x75\x6D\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72"\
+	"\x65\x66\x69\x78\x28\x27\x2B\x2B\x2B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x70\x6C\x75\x73\x65\x73\x2E"\
+	"\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67"\
+	"\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79"\
+	"\x20\x3D\x20\x27\x75\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2B\x2B\x2B\x27\x2C\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69"\
+	"\x6E\x67\x20\x70\x6C\x75\x73\x65\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x68\x69\x73\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D"\
+	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x33\x30\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x2C\x20\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69"\
+	"\x78\x28\x27\x2D\x27\x2C\x20\x27\x73\x75\x62\x27\x2C\x20\x31\x33\x30\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2D\x27\x2C\x20\x27\x6E\x65\x67"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2D\x2D\x2D\x27"\
+	"\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69"\
+	"\x6E\x67\x20\x6D\x69\x6E\x75\x73\x65\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72"\
+	"\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79\x20\x3D\x20\x27\x75\x6E\x61\x72\x79"\
+	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68"\
+	"\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69"\
+	"\x78\x28\x27\x2D\x2D\x2D\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C"\
+	"\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x43\x6F\x6E\x66\x75\x73\x69\x6E\x67\x20\x6D\x69\x6E\x75\x73\x65"\
+	"\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x6C"\
+	"\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73"\
+	"\x69\x6F\x6E\x28\x31\x33\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x33"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x2A\x27\x2C\x20\x27"\
+	"\x6D\x75\x6C\x74\x27\x2C\x20\x31\x34\x30\x29\x3B\x0A\x20\x20\x20\x20\x69\x6E\x66"\
+	"\x69\x78\x28\x27\x2F\x27\x2C\x20\x27\x64\x69\x76\x27\x2C\x20\x31\x34\x30\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x25\x27\x2C\x20\x27\x6D\x6F\x64"\
+	"\x27\x2C\x20\x31\x34\x30\x29\x3B\x0A\x0A\x20\x20\x20\x20\x73\x75\x66\x66\x69\x78"\
+	"\x28\x27\x2B\x2B\x27\x2C\x20\x27\x70\x6F\x73\x74\x69\x6E\x63\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2B\x2B\x27\x2C\x20\x27\x70\x72\x65"\
+	"\x69\x6E\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x2B"\
+	"\x2B\x27\x5D\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x73\x75\x66\x66\x69\x78\x28\x27\x2D\x2D\x27\x2C\x20\x27\x70\x6F\x73\x74"\
+	"\x64\x65\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x2D"\
+	"\x2D\x27\x2C\x20\x27\x70\x72\x65\x64\x65\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x73"\
+	"\x79\x6E\x74\x61\x78\x5B\x27\x2D\x2D\x27\x5D\x2E\x65\x78\x70\x73\x20\x3D\x20\x74"\
+	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x64\x65\x6C"\
+	"\x65\x74\x65\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x70\x20\x3D\x20\x65\x78\x70\x72"\
+	"\x65\x73\x73\x69\x6F\x6E\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x21\x70\x20\x7C\x7C\x20\x28\x70\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
+	"\x2E\x27\x20\x26\x26\x20\x70\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x56\x61\x72\x69\x61\x62\x6C\x65\x73\x20\x73\x68\x6F\x75\x6C\x64"\
+	"\x20\x6E\x6F\x74\x20\x62\x65\x20\x64\x65\x6C\x65\x74\x65\x64\x2E\x22\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
+	"\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x70\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D"\
+	"\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20"\
+	"\x70\x72\x65\x66\x69\x78\x28\x27\x7E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x62\x69\x74\x77\x69\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65"\
+	"\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x68\x69"\
+	"\x73\x2C\x20\x27\x7E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
+	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72"\
+	"\x65\x66\x69\x78\x28\x27\x21\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x72\x69\x67"\
+	"\x68\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x35\x30\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x61\x72\x69\x74\x79"\
+	"\x20\x3D\x20\x27\x75\x6E\x61\x72\x79\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x62\x61\x6E\x67\x5B\x74\x68\x69\x73\x2E\x72\x69\x67\x68\x74\x2E"\
+	"\x69\x64\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x43\x6F\x6E"\
+	"\x66\x75\x73\x69\x6E\x67\x20\x75\x73\x65\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E"\
+	"\x22\x2C\x20\x74\x68\x69\x73\x2C\x20\x27\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x70\x72"\
+	"\x65\x66\x69\x78\x28\x27\x74\x79\x70\x65\x6F\x66\x27\x2C\x20\x27\x74\x79\x70\x65"\
+	"\x6F\x66\x27\x29\x3B\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x6E\x65"\
+	"\x77\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x63\x20\x3D\x20\x65\x78\x70\x72\x65\x73"\
+	"\x73\x69\x6F\x6E\x28\x31\x35\x35\x29\x2C\x20\x69\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x63\x20\x26\x26\x20\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20"\
+	"\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x64\x65\x6E\x74\x69\x66\x69"\
+	"\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x5B\x27\x6E\x65\x77\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63"\
+	"\x68\x20\x28\x63\x2E\x76\x61\x6C\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x4F\x62\x6A\x65"\
+	"\x63\x74\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x74\x68"\
+	"\x65\x20\x6F\x62\x6A\x65\x63\x74\x20\x6C\x69\x74\x65\x72\x61\x6C\x20\x6E\x6F\x74"\
+	"\x61\x74\x69\x6F\x6E\x20\x7B\x7D\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x4E\x75\x6D\x62\x65\x72\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x53\x74\x72\x69\x6E\x67\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x42\x6F\x6F\x6C\x65\x61\x6E\x27\x3A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
+	"\x65\x20\x27\x4D\x61\x74\x68\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x4A\x53\x4F\x4E\x27\x3A\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x54\x68\x65\x20\x46\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x20\x69\x73\x20\x65\x76\x61\x6C"\
-	"\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x44\x61\x74\x65"\
-	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x52\x65\x67\x45\x78\x70\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66"\
-	"\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D"\
-	"\x20\x63\x2E\x76\x61\x6C\x75\x65\x2E\x73\x75\x62\x73\x74\x72\x28\x30\x2C\x20\x31"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x65"\
-	"\x77\x63\x61\x70\x20\x26\x26\x20\x28\x69\x20\x3C\x20\x27\x41\x27\x20\x7C\x7C\x20"\
-	"\x69\x20\x3E\x20\x27\x5A\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x20\x6E\x6F\x74\x20\x75\x73\x65\x20\x7B"\
+	"\x61\x7D\x20\x61\x73\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E"\
+	"\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x63\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x41\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74"\
-	"\x6F\x72\x20\x6E\x61\x6D\x65\x20\x73\x68\x6F\x75\x6C\x64\x20\x73\x74\x61\x72\x74"\
-	"\x20\x77\x69\x74\x68\x20\x61\x6E\x20\x75\x70\x70\x65\x72\x63\x61\x73\x65\x20\x6C"\
-	"\x65\x74\x74\x65\x72\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
+	"\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x46\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
-	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20\x26\x26\x20"\
-	"\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x20\x26\x26\x20\x63\x2E\x69\x64"\
-	"\x20\x21\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x54\x68\x65\x20\x46\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x20\x69\x73"\
+	"\x20\x65\x76\x61\x6C\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
+	"\x27\x44\x61\x74\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x52\x65\x67\x45\x78\x70\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x64\x20"\
+	"\x21\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x20\x3D\x20\x63\x2E\x76\x61\x6C\x75\x65\x2E\x73\x75\x62\x73\x74\x72"\
+	"\x28\x30\x2C\x20\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x2E\x6E\x65\x77\x63\x61\x70\x20\x26\x26\x20\x28\x69\x20\x3C\x20\x27\x41"\
+	"\x27\x20\x7C\x7C\x20\x69\x20\x3E\x20\x27\x5A\x27\x29\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x41\x20\x63\x6F\x6E\x73"\
+	"\x74\x72\x75\x63\x74\x6F\x72\x20\x6E\x61\x6D\x65\x20\x73\x68\x6F\x75\x6C\x64\x20"\
+	"\x73\x74\x61\x72\x74\x20\x77\x69\x74\x68\x20\x61\x6E\x20\x75\x70\x70\x65\x72\x63"\
+	"\x61\x73\x65\x20\x6C\x65\x74\x74\x65\x72\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E"\
+	"\x27\x20\x26\x26\x20\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x20\x26\x26"\
+	"\x20\x63\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F"\
+	"\x72\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x73\x75\x70\x65\x72\x6E\x65\x77\x29\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x22\x42\x61\x64\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E\x22\x2C\x20"\
-	"\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E"\
-	"\x2E\x73\x75\x70\x65\x72\x6E\x65\x77\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x57\x65\x69\x72"\
-	"\x64\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x69\x6F\x6E\x2E\x20\x44\x65\x6C\x65"\
-	"\x74\x65\x20\x27\x6E\x65\x77\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A"\
-	"\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x27\x20\x26\x26"\
-	"\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x70\x65\x72\x6E\x65\x77\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x28\x29\x27\x20\x69\x6E\x76\x6F\x6B"\
-	"\x69\x6E\x67\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E\x22\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x63\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20"\
-	"\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x6E\x65\x77"\
-	"\x27\x5D\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x70\x72\x65\x66\x69\x78\x28\x27\x76\x6F\x69\x64\x27\x29\x2E\x65\x78\x70\x73"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x69\x6E\x66\x69\x78\x28"\
-	"\x27\x2E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C"\
-	"\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A"\
-	"\x61\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6D\x20\x3D\x20"\
-	"\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x6D\x20\x3D\x3D\x3D\x20\x27"\
-	"\x73\x74\x72\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28\x6D\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61"\
-	"\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x6D\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x6F"\
-	"\x61\x72\x67\x20\x26\x26\x20\x6C\x65\x66\x74\x20\x26\x26\x20\x6C\x65\x66\x74\x2E"\
-	"\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x61\x72\x67\x75\x6D\x65\x6E\x74\x73"\
-	"\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x63\x61\x6C\x6C\x65\x65\x27\x20\x7C\x7C\x20"\
-	"\x6D\x20\x3D\x3D\x3D\x20\x27\x63\x61\x6C\x6C\x65\x72\x27\x29\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x41\x76\x6F\x69\x64\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x73\x2E\x7B\x61\x7D\x2E"\
-	"\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x65\x76\x69\x6C\x20\x26\x26\x20\x6C\x65\x66\x74\x20\x26\x26\x20\x6C\x65\x66\x74"\
-	"\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x64\x6F\x63\x75\x6D\x65\x6E\x74"\
+	"\x22\x57\x65\x69\x72\x64\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x69\x6F\x6E\x2E"\
+	"\x20\x44\x65\x6C\x65\x74\x65\x20\x27\x6E\x65\x77\x27\x2E\x22\x2C\x20\x74\x68\x69"\
+	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
+	"\x28\x27\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x70\x65\x72\x6E"\
+	"\x65\x77\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x28\x29\x27\x20"\
+	"\x69\x6E\x76\x6F\x6B\x69\x6E\x67\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74"\
+	"\x6F\x72\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x63\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73"\
+	"\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x6E\x74\x61\x78"\
+	"\x5B\x27\x6E\x65\x77\x27\x5D\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B"\
+	"\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x76\x6F\x69\x64\x27\x29"\
+	"\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x69"\
+	"\x6E\x66\x69\x78\x28\x27\x2E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
+	"\x62\x72\x65\x61\x6B\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x6D\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x6D\x20"\
+	"\x3D\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28"\
+	"\x6D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20\x3D"\
+	"\x20\x6D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x2E\x6E\x6F\x61\x72\x67\x20\x26\x26\x20\x6C\x65\x66\x74\x20\x26\x26\x20"\
+	"\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x61\x72\x67\x75"\
+	"\x6D\x65\x6E\x74\x73\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x63\x61\x6C\x6C\x65\x65"\
+	"\x27\x20\x7C\x7C\x20\x6D\x20\x3D\x3D\x3D\x20\x27\x63\x61\x6C\x6C\x65\x72\x27\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x41\x76\x6F\x69\x64\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x73"\
+	"\x2E\x7B\x61\x7D\x2E\x22\x2C\x20\x6C\x65\x66\x74\x2C\x20\x6D\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x20\x26\x26\x20\x6C\x65\x66\x74\x20\x26\x26"\
+	"\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x64\x6F\x63"\
+	"\x75\x6D\x65\x6E\x74\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x77\x72\x69\x74\x65\x27"\
+	"\x20\x7C\x7C\x20\x6D\x20\x3D\x3D\x3D\x20\x27\x77\x72\x69\x74\x65\x6C\x6E\x27\x29"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E\x77\x72\x69\x74\x65\x20"\
+	"\x63\x61\x6E\x20\x62\x65\x20\x61\x20\x66\x6F\x72\x6D\x20\x6F\x66\x20\x65\x76\x61"\
+	"\x6C\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x65\x76\x69\x6C\x20\x26\x26\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x65\x76"\
+	"\x61\x6C\x27\x20\x7C\x7C\x20\x6D\x20\x3D\x3D\x3D\x20\x27\x65\x78\x65\x63\x53\x63"\
+	"\x72\x69\x70\x74\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x27\x65\x76\x61\x6C\x20\x69\x73\x20\x65"\
+	"\x76\x69\x6C\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x2C\x20\x31\x36\x30\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x0A\x20"\
+	"\x20\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x28\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2E"\
+	"\x69\x64\x20\x21\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x70\x72\x65\x76\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B\x28\x70\x72"\
+	"\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61"\
+	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x69\x6D\x6D\x65\x64\x20\x26\x26\x20\x21\x6C\x65\x66\x74\x2E"\
+	"\x69\x6D\x6D\x65\x64\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x57\x72\x61\x70"\
+	"\x20\x61\x6E\x20\x69\x6D\x6D\x65\x64\x69\x61\x74\x65\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x20\x69\x6E\x20\x70\x61\x72"\
+	"\x65\x6E\x74\x68\x65\x73\x65\x73\x20\x22\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x22\x74\x6F\x20\x61\x73\x73\x69\x73\x74\x20"\
+	"\x74\x68\x65\x20\x72\x65\x61\x64\x65\x72\x20\x69\x6E\x20\x75\x6E\x64\x65\x72\x73"\
+	"\x74\x61\x6E\x64\x69\x6E\x67\x20\x74\x68\x61\x74\x20\x74\x68\x65\x20\x65\x78\x70"\
+	"\x72\x65\x73\x73\x69\x6F\x6E\x20\x22\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x22\x69\x73\x20\x74\x68\x65\x20\x72\x65\x73\x75"\
+	"\x6C\x74\x20\x6F\x66\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20\x61\x6E"\
+	"\x64\x20\x6E\x6F\x74\x20\x74\x68\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69"\
+	"\x74\x73\x65\x6C\x66\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6E\x20\x3D\x20\x30\x2C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x20\x3D\x20\x5B\x5D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E"\
+	"\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
+	"\x72\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x2E\x6D\x61"\
+	"\x74\x63\x68\x28\x2F\x5E\x5B\x41\x2D\x5A\x5D\x28\x5B\x41\x2D\x5A\x30\x2D\x39\x5F"\
+	"\x24\x5D\x2A\x5B\x61\x2D\x7A\x5D\x5B\x41\x2D\x5A\x61\x2D\x7A\x30\x2D\x39\x5F\x24"\
+	"\x5D\x2A\x29\x3F\x24\x2F\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E"\
+	"\x76\x61\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x4E\x75\x6D\x62\x65\x72\x27\x20\x26"\
+	"\x26\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x53\x74"\
+	"\x72\x69\x6E\x67\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66"\
+	"\x74\x2E\x76\x61\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x42\x6F\x6F\x6C\x65\x61\x6E"\
 	"\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x77\x72\x69\x74\x65\x27\x20\x7C\x7C\x20\x6D"\
-	"\x20\x3D\x3D\x3D\x20\x27\x77\x72\x69\x74\x65\x6C\x6E\x27\x29\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E\x77\x72\x69\x74\x65\x20\x63\x61\x6E\x20\x62"\
-	"\x65\x20\x61\x20\x66\x6F\x72\x6D\x20\x6F\x66\x20\x65\x76\x61\x6C\x2E\x22\x2C\x20"\
-	"\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61"\
+	"\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x44\x61\x74\x65\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D"\
+	"\x20\x27\x4D\x61\x74\x68\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x22\x4D\x61\x74\x68\x20\x69\x73\x20\x6E\x6F\x74\x20"\
+	"\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6F\x70\x74\x69"\
+	"\x6F\x6E\x2E\x6E\x65\x77\x63\x61\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27"\
+	"\x6E\x65\x77\x27\x20\x70\x72\x65\x66\x69\x78\x20\x77\x68\x65\x6E\x20\x69\x6E\x76"\
+	"\x6F\x6B\x69\x6E\x67\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E"\
+	"\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x5B\x70\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x5D\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
+	"\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6E\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
+	"\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
+	"\x63\x65\x28\x27\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73"\
+	"\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65"\
+	"\x6F\x66\x20\x6C\x65\x66\x74\x20\x3D\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x70\x61\x72\x73"\
+	"\x65\x49\x6E\x74\x27\x20\x26\x26\x20\x6E\x20\x3D\x3D\x3D\x20\x31\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x72\x61\x64\x69\x78\x20\x70"\
+	"\x61\x72\x61\x6D\x65\x74\x65\x72\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69"\
-	"\x6C\x20\x26\x26\x20\x28\x6D\x20\x3D\x3D\x3D\x20\x27\x65\x76\x61\x6C\x27\x20\x7C"\
-	"\x7C\x20\x6D\x20\x3D\x3D\x3D\x20\x27\x65\x78\x65\x63\x53\x63\x72\x69\x70\x74\x27"\
-	"\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x28\x27\x65\x76\x61\x6C\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x27"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x7D\x2C"\
-	"\x20\x31\x36\x30\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69\x6E"\
-	"\x66\x69\x78\x28\x27\x28\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C"\
-	"\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D"\
-	"\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x20\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B\x28\x70\x72\x65\x76\x74\x6F\x6B"\
-	"\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x69\x6D\x6D\x65\x64\x20\x26\x26\x20\x21\x6C\x65\x66\x74\x2E\x69\x6D\x6D\x65\x64"\
-	"\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x57\x72\x61\x70\x20\x61\x6E\x20\x69"\
-	"\x6D\x6D\x65\x64\x69\x61\x74\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E"\
-	"\x76\x6F\x63\x61\x74\x69\x6F\x6E\x20\x69\x6E\x20\x70\x61\x72\x65\x6E\x74\x68\x65"\
-	"\x73\x65\x73\x20\x22\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x22\x74\x6F\x20\x61\x73\x73\x69\x73\x74\x20\x74\x68\x65\x20\x72"\
-	"\x65\x61\x64\x65\x72\x20\x69\x6E\x20\x75\x6E\x64\x65\x72\x73\x74\x61\x6E\x64\x69"\
-	"\x6E\x67\x20\x74\x68\x61\x74\x20\x74\x68\x65\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
-	"\x6F\x6E\x20\x22\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x22\x69\x73\x20\x74\x68\x65\x20\x72\x65\x73\x75\x6C\x74\x20\x6F\x66"\
-	"\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2C\x20\x61\x6E\x64\x20\x6E\x6F\x74"\
-	"\x20\x74\x68\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x74\x73\x65\x6C\x66"\
-	"\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x6E\x20\x3D\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x70\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x74\x79\x70\x65\x20"\
-	"\x3D\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x2E\x6D\x61\x74\x63\x68\x28\x2F"\
-	"\x5E\x5B\x41\x2D\x5A\x5D\x28\x5B\x41\x2D\x5A\x30\x2D\x39\x5F\x24\x5D\x2A\x5B\x61"\
-	"\x2D\x7A\x5D\x5B\x41\x2D\x5A\x61\x2D\x7A\x30\x2D\x39\x5F\x24\x5D\x2A\x29\x3F\x24"\
-	"\x2F\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65"\
-	"\x20\x21\x3D\x3D\x20\x27\x4E\x75\x6D\x62\x65\x72\x27\x20\x26\x26\x20\x6C\x65\x66"\
-	"\x74\x2E\x76\x61\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x53\x74\x72\x69\x6E\x67\x27"\
-	"\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C"\
-	"\x75\x65\x20\x21\x3D\x3D\x20\x27\x42\x6F\x6F\x6C\x65\x61\x6E\x27\x20\x26\x26\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x21"\
-	"\x3D\x3D\x20\x27\x44\x61\x74\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x4D\x61\x74"\
-	"\x68\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20"\
+	"\x27\x65\x76\x61\x6C\x27\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65"\
+	"\x20\x3D\x3D\x3D\x20\x27\x46\x75\x6E\x63\x74\x69\x6F\x6E\x27\x20\x7C\x7C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65"\
+	"\x78\x65\x63\x53\x63\x72\x69\x70\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x22\x4D\x61\x74\x68\x20\x69\x73\x20\x6E\x6F\x74\x20\x61\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x67\x28\x22\x65\x76\x61\x6C\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x22\x2C\x20\x6C"\
+	"\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x70\x5B\x30\x5D\x20\x26\x26"\
+	"\x20\x70\x5B\x30\x5D\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E"\
+	"\x67\x29\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75"\
+	"\x65\x20\x3D\x3D\x3D\x20\x27\x73\x65\x74\x54\x69\x6D\x65\x6F\x75\x74\x27\x20\x7C"\
+	"\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D"\
+	"\x20\x27\x73\x65\x74\x49\x6E\x74\x65\x72\x76\x61\x6C\x27\x29\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
+	"\x61\x72\x6E\x69\x6E\x67\x28\x0A\x20\x20\x20\x20\x22\x49\x6D\x70\x6C\x69\x65\x64"\
+	"\x20\x65\x76\x61\x6C\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x20\x50\x61\x73\x73\x20"\
+	"\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x6F"\
+	"\x66\x20\x61\x20\x73\x74\x72\x69\x6E\x67\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6C\x65\x66\x74\x2E\x69\x64\x65\x6E\x74"\
+	"\x69\x66\x69\x65\x72\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D"\
+	"\x20\x27\x2E\x27\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20"\
+	"\x27\x5B\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
+	"\x28\x27\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x26"\
+	"\x26\x27\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x7C"\
+	"\x7C\x27\x20\x26\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3F"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x69\x6E\x76\x6F\x63\x61"\
+	"\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C"\
+	"\x65\x66\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x35\x35\x2C\x20\x74\x72"\
+	"\x75\x65\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x28\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70"\
+	"\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x6D\x6D\x65\x64\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x76\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
+	"\x6F\x6E\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
+	"\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6D\x6D\x65\x64\x20\x26\x26\x20\x76\x2E"\
+	"\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
+	"\x6E\x69\x6E\x67\x28\x0A\x22\x4D\x6F\x76\x65\x20\x74\x68\x65\x20\x69\x6E\x76\x6F"\
+	"\x63\x61\x74\x69\x6F\x6E\x20\x69\x6E\x74\x6F\x20\x74\x68\x65\x20\x70\x61\x72\x65"\
+	"\x6E\x73\x20\x74\x68\x61\x74\x20\x63\x6F\x6E\x74\x61\x69\x6E\x20\x74\x68\x65\x20"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
+	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x44\x6F\x20\x6E\x6F\x74\x20\x77\x72"\
+	"\x61\x70\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6C\x69\x74\x65\x72\x61\x6C\x73"\
+	"\x20\x69\x6E\x20\x70\x61\x72\x65\x6E\x73\x20\x75\x6E\x6C\x65\x73\x73\x20\x74\x68"\
+	"\x65\x79\x20\x61\x72\x65\x20\x74\x6F\x20\x62\x65\x20\x69\x6D\x6D\x65\x64\x69\x61"\
+	"\x74\x65\x6C\x79\x20\x69\x6E\x76\x6F\x6B\x65\x64\x2E\x22\x2C\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x6E\x65"\
-	"\x77\x63\x61\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x28\x0A\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x6E\x65\x77\x27\x20"\
-	"\x70\x72\x65\x66\x69\x78\x20\x77\x68\x65\x6E\x20\x69\x6E\x76\x6F\x6B\x69\x6E\x67"\
-	"\x20\x61\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x2E\x22\x2C\x20\x6C\x65"\
-	"\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x21\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x5B\x70\x2E\x6C\x65\x6E\x67\x74\x68"\
-	"\x5D\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x20\x2B\x3D"\
-	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D"\
-	"\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x76\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x69\x6E\x66\x69\x78\x28\x27\x5B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F"\
+	"\x6E\x20\x28\x6C\x65\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x62\x72\x65\x61\x6B\x28\x70\x72\x65\x76\x74\x6F\x6B"\
+	"\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6E\x6F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
+	"\x61\x72\x20\x65\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x29"\
+	"\x2C\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x65\x20\x26"\
+	"\x26\x20\x65\x2E\x74\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E"\
+	"\x67\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x20\x26\x26\x20\x28"\
+	"\x65\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x76\x61\x6C\x27\x20\x7C"\
+	"\x7C\x20\x65\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x78\x65\x63\x53"\
+	"\x63\x72\x69\x70\x74\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x65\x76\x61\x6C"\
+	"\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x22\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28"\
-	"\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x6C\x65"\
-	"\x66\x74\x20\x3D\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x65\x66\x74\x2E"\
-	"\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x70\x61\x72\x73\x65\x49\x6E\x74\x27"\
-	"\x20\x26\x26\x20\x6E\x20\x3D\x3D\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x4D\x69\x73\x73\x69\x6E\x67\x20\x72\x61\x64\x69\x78\x20\x70\x61\x72\x61\x6D\x65"\
-	"\x74\x65\x72\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x76\x61\x6C"\
-	"\x27\x20\x7C\x7C\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20"\
-	"\x27\x46\x75\x6E\x63\x74\x69\x6F\x6E\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65"\
-	"\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x78\x65\x63\x53\x63"\
-	"\x72\x69\x70\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x65\x76"\
-	"\x61\x6C\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x69\x66\x20\x28\x70\x5B\x30\x5D\x20\x26\x26\x20\x70\x5B\x30\x5D"\
-	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x20\x26"\
-	"\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x28\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D"\
-	"\x20\x27\x73\x65\x74\x54\x69\x6D\x65\x6F\x75\x74\x27\x20\x7C\x7C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6C\x65\x66\x74\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x73\x65\x74"\
-	"\x49\x6E\x74\x65\x72\x76\x61\x6C\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
-	"\x67\x28\x0A\x20\x20\x20\x20\x22\x49\x6D\x70\x6C\x69\x65\x64\x20\x65\x76\x61\x6C"\
-	"\x20\x69\x73\x20\x65\x76\x69\x6C\x2E\x20\x50\x61\x73\x73\x20\x61\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x6F\x66\x20\x61\x20\x73"\
-	"\x74\x72\x69\x6E\x67\x2E\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x21\x6C\x65\x66\x74\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72"\
-	"\x20\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2E\x27\x20"\
-	"\x26\x26\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5B\x27\x20\x26"\
-	"\x26\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x27\x20\x26\x26"\
-	"\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x26\x26\x27\x20\x26\x26"\
-	"\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x7C\x7C\x27\x20\x26\x26"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6C\x65\x66\x74\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3F\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x2E"\
-	"\x22\x2C\x20\x6C\x65\x66\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x35\x35\x2C\x20\x74\x72\x75\x65\x29\x2E\x65"\
-	"\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72\x65"\
-	"\x66\x69\x78\x28\x27\x28\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x6D\x6D\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x76\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29"\
-	"\x27\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
-	"\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x69\x6D\x6D\x65\x64\x20\x26\x26\x20\x76\x2E\x69\x64\x20\x3D\x3D"\
-	"\x3D\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
-	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x0A\x22\x4D\x6F\x76\x65\x20\x74\x68\x65\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F"\
-	"\x6E\x20\x69\x6E\x74\x6F\x20\x74\x68\x65\x20\x70\x61\x72\x65\x6E\x73\x20\x74\x68"\
-	"\x61\x74\x20\x63\x6F\x6E\x74\x61\x69\x6E\x20\x74\x68\x65\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28\x65\x2E\x76"\
+	"\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x20\x26\x26\x20\x69\x78"\
+	"\x2E\x74\x65\x73\x74\x28\x65\x2E\x76\x61\x6C\x75\x65\x29\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x79"\
+	"\x6E\x74\x61\x78\x5B\x65\x2E\x76\x61\x6C\x75\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x20\x7C\x7C"\
+	"\x20\x21\x73\x2E\x72\x65\x73\x65\x72\x76\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x28\x0A\x22\x44\x6F\x20\x6E\x6F\x74\x20\x77\x72\x61\x70\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x20\x6C\x69\x74\x65\x72\x61\x6C\x73\x20\x69\x6E\x20\x70"\
-	"\x61\x72\x65\x6E\x73\x20\x75\x6E\x6C\x65\x73\x73\x20\x74\x68\x65\x79\x20\x61\x72"\
-	"\x65\x20\x74\x6F\x20\x62\x65\x20\x69\x6D\x6D\x65\x64\x69\x61\x74\x65\x6C\x79\x20"\
-	"\x69\x6E\x76\x6F\x6B\x65\x64\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x76\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x69\x6E\x66"\
-	"\x69\x78\x28\x27\x5B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6C\x65"\
-	"\x66\x74\x2C\x20\x74\x68\x61\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x62\x72\x65\x61\x6B\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61"\
-	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x65\x20"\
-	"\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x29\x2C\x20\x73\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x65\x20\x26\x26\x20\x65\x2E\x74"\
-	"\x79\x70\x65\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x65\x76\x69\x6C\x20\x26\x26\x20\x28\x65\x2E\x76\x61\x6C"\
-	"\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x76\x61\x6C\x27\x20\x7C\x7C\x20\x65\x2E\x76"\
-	"\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x65\x78\x65\x63\x53\x63\x72\x69\x70\x74"\
-	"\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x65\x76\x61\x6C\x20\x69\x73\x20\x65"\
-	"\x76\x69\x6C\x2E\x22\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28\x65\x2E\x76\x61\x6C\x75\x65\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F"\
-	"\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x20\x26\x26\x20\x69\x78\x2E\x74\x65\x73\x74"\
-	"\x28\x65\x2E\x76\x61\x6C\x75\x65\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B"\
-	"\x65\x2E\x76\x61\x6C\x75\x65\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x20\x7C\x7C\x20\x21\x73\x2E\x72"\
-	"\x65\x73\x65\x72\x76\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x6E\x67\x28\x22\x5B\x27\x7B\x61\x7D\x27\x5D\x20\x69\x73\x20\x62\x65\x74\x74"\
+	"\x65\x72\x20\x77\x72\x69\x74\x74\x65\x6E\x20\x69\x6E\x20\x64\x6F\x74\x20\x6E\x6F"\
+	"\x74\x61\x74\x69\x6F\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x2C"\
+	"\x20\x65\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x5D\x27\x2C\x20\x74\x68\x61\x74\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65"\
+	"\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74"\
+	"\x20\x3D\x20\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x74\x68\x61\x74\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x36\x30\x2C\x20\x74"\
+	"\x72\x75\x65\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x5B"\
+	"\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x62\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C"\
+	"\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69"\
+	"\x6E\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72"\
+	"\x73\x74\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E"\
+	"\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E"\
+	"\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x3D\x3D\x3D\x20\x69\x6E"\
+	"\x64\x65\x6E\x74\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64"\
+	"\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69"\
+	"\x6C\x65\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D"\
+	"\x20\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x5B\x27\x7B\x61\x7D\x27\x5D\x20\x69\x73\x20\x62\x65\x74\x74\x65\x72\x20\x77\x72"\
-	"\x69\x74\x74\x65\x6E\x20\x69\x6E\x20\x64\x6F\x74\x20\x6E\x6F\x74\x61\x74\x69\x6F"\
-	"\x6E\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x2C\x20\x65\x2E\x76\x61"\
-	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x27\x5D\x27\x2C\x20\x74\x68\x61\x74\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65"\
-	"\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
-	"\x68\x61\x74\x2E\x6C\x65\x66\x74\x20\x3D\x20\x6C\x65\x66\x74\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x74\x68\x61\x74\x2E\x72\x69\x67\x68\x74\x20\x3D\x20\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x61\x74"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x36\x30\x2C\x20\x74\x72\x75\x65\x29\x3B"\
-	"\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78\x28\x27\x5B\x27\x2C\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x62\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x21"\
-	"\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20"\
-	"\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20"\
-	"\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20"\
+	"\x45\x78\x74\x72\x61\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
+	"\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
+	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x20\x26\x26\x20\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x2E\x70"\
+	"\x75\x73\x68\x28\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D"\
+	"\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D"\
+	"\x3D\x3D\x20\x27\x5D\x27\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73"\
+	"\x35\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x74\x72\x61\x20"\
+	"\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x6E\x64\x65\x6E\x74\x20\x2D\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65"\
+	"\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65"\
+	"\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x5D\x27"\
+	"\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x36\x30"\
+	"\x29\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x72"\
+	"\x6F\x70\x65\x72\x74\x79\x5F\x6E\x61\x6D\x65\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x69\x64\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61"\
+	"\x6C\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x74\x72\x75\x65\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x69\x64\x29\x20\x7B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x3D\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x20"\
-	"\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E"\
-	"\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x64\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75"\
+	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x64\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65"\
+	"\x2E\x74\x6F\x53\x74\x72\x69\x6E\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x65\x6E"\
-	"\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77"\
-	"\x68\x69\x6C\x65\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D"\
-	"\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x74\x72\x61"\
-	"\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x2C\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x62\x20\x26\x26\x20\x74\x6F\x6B\x65\x6E\x2E\x6C"\
-	"\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69"\
-	"\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x2E\x70\x75\x73\x68\x28\x65"\
-	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69"\
+	"\x64\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x70\x61\x72\x61\x6D\x73\x28\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x2C\x20\x74\x20"\
+	"\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x70\x20\x3D\x20\x5B\x5D\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70"\
+	"\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x74"\
+	"\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x2E"\
+	"\x70\x75\x73\x68\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x70\x61\x72\x61\x6D\x65"\
+	"\x74\x65\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
+	"\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27"\
+	"\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x70\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x69\x2C\x20\x73\x74\x61\x74\x65\x6D"\
+	"\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x66"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x6C\x64\x4F\x70\x74"\
+	"\x69\x6F\x6E\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x6C\x64\x53\x63\x6F\x70\x65\x20\x20\x3D\x20\x73\x63"\
+	"\x6F\x70\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x6F\x70\x74"\
+	"\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20"\
+	"\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x63\x6F\x70"\
+	"\x65\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6E\x61\x6D"\
+	"\x65\x29\x27\x20\x20\x20\x20\x20\x3A\x20\x69\x20\x7C\x7C\x20\x27\x22\x27\x20\x2B"\
+	"\x20\x61\x6E\x6F\x6E\x6E\x61\x6D\x65\x20\x2B\x20\x27\x22\x27\x2C\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6C\x69\x6E\x65\x29\x27\x20\x20\x20"\
+	"\x20\x20\x3A\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x63\x6F\x6E\x74\x65\x78"\
+	"\x74\x29\x27\x20\x20\x3A\x20\x66\x75\x6E\x63\x74\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x20\x3A"\
+	"\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6C\x6F"\
+	"\x6F\x70\x61\x67\x65\x29\x27\x20\x20\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x27\x28\x73\x63\x6F\x70\x65\x29\x27\x20\x20\x20\x20\x3A"\
+	"\x20\x73\x63\x6F\x70\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x27\x28\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x29\x27\x3A\x20\x73\x74\x61\x74\x65"\
+	"\x6D\x65\x6E\x74\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x20\x3D\x20\x66\x75\x6E\x63\x74\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x74\x6F\x6B\x65\x6E\x2E\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x75\x6E"\
+	"\x63\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x73\x2E\x70\x75\x73\x68\x28\x66\x75\x6E\x63\x74\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x70\x61\x72\x61\x6D"\
+	"\x73\x29\x27\x5D\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x70\x61\x72\x61\x6D"\
+	"\x73\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28"\
+	"\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70"\
+	"\x65\x20\x3D\x20\x6F\x6C\x64\x53\x63\x6F\x70\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x6C\x64\x4F\x70\x74\x69\x6F\x6E"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x61"\
+	"\x73\x74\x29\x27\x5D\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x75\x6E\x63"\
+	"\x74\x5B\x27\x28\x63\x6F\x6E\x74\x65\x78\x74\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x66\x3B\x0A\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x0A\x20\x20\x20\x20\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x78\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6E\x75\x64\x20\x3D\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x66\x2C\x20\x69\x2C\x20\x6A\x2C\x20"\
+	"\x70\x2C\x20\x73\x65\x65\x6E\x20\x3D\x20\x7B\x7D\x2C\x20\x74\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E"\
+	"\x6C\x69\x6E\x65\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C"\
+	"\x69\x6E\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F"\
+	"\x6D\x20\x3D\x3D\x3D\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B"\
+	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
-	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B"\
+	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61"\
+	"\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5D"\
-	"\x27\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x74\x72\x61\x20\x63\x6F\x6D\x6D\x61"\
-	"\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74"\
-	"\x20\x2D\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69"\
-	"\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x5D\x27\x2C\x20\x74\x68\x69"\
-	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
-	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x2C\x20\x31\x36\x30\x29\x3B\x0A\x0A\x0A"\
-	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x70\x72\x6F\x70\x65\x72\x74"\
-	"\x79\x5F\x6E\x61\x6D\x65\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x69\x64\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C\x69\x64\x65\x6E"\
-	"\x74\x69\x66\x69\x65\x72\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x20\x3D\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x20\x3D"\
-	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x64\x20\x3D\x20"\
-	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x2E\x74\x6F\x53\x74"\
-	"\x72\x69\x6E\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x64\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x70\x61\x72\x61\x6D\x73\x28\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x2C\x20\x74\x20\x3D\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x70\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x20\x3D\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70"\
-	"\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20"\
-	"\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x74\x72\x75\x65\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x2E\x70\x75\x73\x68\x28"\
-	"\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C"\
-	"\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x70\x61\x72\x61\x6D\x65\x74\x65\x72\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F"\
-	"\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73"\
-	"\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65"\
-	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x20\x70\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x6F\x46\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x28\x69\x2C\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x66\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x6C\x64\x4F\x70\x74\x69\x6F\x6E\x20\x3D"\
-	"\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6F\x6C\x64\x53\x63\x6F\x70\x65\x20\x20\x3D\x20\x73\x63\x6F\x70\x65\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x4F\x62"\
-	"\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x6F\x70\x74\x69\x6F\x6E\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x4F\x62\x6A"\
-	"\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x63\x6F\x70\x65\x29\x3B\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6E\x61\x6D\x65\x29\x27\x20\x20"\
-	"\x20\x20\x20\x3A\x20\x69\x20\x7C\x7C\x20\x27\x22\x27\x20\x2B\x20\x61\x6E\x6F\x6E"\
-	"\x6E\x61\x6D\x65\x20\x2B\x20\x27\x22\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x27\x28\x6C\x69\x6E\x65\x29\x27\x20\x20\x20\x20\x20\x3A\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x27\x28\x63\x6F\x6E\x74\x65\x78\x74\x29\x27\x20\x20"\
-	"\x3A\x20\x66\x75\x6E\x63\x74\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x20\x3A\x20\x30\x2C\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65"\
-	"\x29\x27\x20\x20\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x27\x28\x73\x63\x6F\x70\x65\x29\x27\x20\x20\x20\x20\x3A\x20\x73\x63\x6F\x70"\
-	"\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x73\x74\x61"\
-	"\x74\x65\x6D\x65\x6E\x74\x29\x27\x3A\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x20\x3D\x20\x66\x75\x6E\x63\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2E\x70\x75\x73"\
-	"\x68\x28\x66\x75\x6E\x63\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
-	"\x64\x64\x6C\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x20"\
-	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x70\x61\x72\x61\x6D\x73\x28\x29\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x66\x61\x6C\x73\x65"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x6F"\
-	"\x6C\x64\x53\x63\x6F\x70\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74"\
-	"\x69\x6F\x6E\x20\x3D\x20\x6F\x6C\x64\x4F\x70\x74\x69\x6F\x6E\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x61\x73\x74\x29\x27\x5D"\
-	"\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x63"\
-	"\x6F\x6E\x74\x65\x78\x74\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x66\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20"\
-	"\x20\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x78\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x78\x2E\x6E\x75\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76"\
-	"\x61\x72\x20\x62\x2C\x20\x66\x2C\x20\x69\x2C\x20\x6A\x2C\x20\x70\x2C\x20\x73\x65"\
-	"\x65\x6E\x20\x3D\x20\x7B\x7D\x2C\x20\x74\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20"\
-	"\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64"\
-	"\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x20\x3D\x3D\x3D"\
-	"\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64"\
-	"\x65\x6E\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20"\
-	"\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x67\x65\x74\x27\x20"\
-	"\x26\x26\x20\x70\x65\x65\x6B\x28\x29\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3A\x27"\
+	"\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27"\
+	"\x67\x65\x74\x27\x20\x26\x26\x20\x70\x65\x65\x6B\x28\x29\x2E\x69\x64\x20\x21\x3D"\
+	"\x3D\x20\x27\x3A\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x67\x65"\
+	"\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35"\
 	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x67\x65\x74\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x67\x65\x74\x2F\x73"\
+	"\x65\x74\x20\x61\x72\x65\x20\x45\x53\x35\x20\x66\x65\x61\x74\x75\x72\x65\x73\x2E"\
+	"\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x70\x72\x6F\x70\x65\x72\x74\x79\x5F\x6E"\
+	"\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x69\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35\x29\x20\x7B\x0A\x20"\
+	"\x20\x65\x72\x72\x6F\x72\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x70\x72\x6F\x70"\
+	"\x65\x72\x74\x79\x20\x6E\x61\x6D\x65\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28"\
+	"\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x20\x3D\x20\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x6F\x6F\x70\x66\x75\x6E\x63\x20\x26\x26"\
+	"\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x6E\x27"\
+	"\x74\x20\x6D\x61\x6B\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x77\x69\x74"\
+	"\x68\x69\x6E\x20\x61\x20\x6C\x6F\x6F\x70\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x67\x65\x74\x2F\x73\x65\x74\x20\x61\x72"\
-	"\x65\x20\x45\x53\x35\x20\x66\x65\x61\x74\x75\x72\x65\x73\x2E\x22\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x20\x3D\x20\x70\x72\x6F\x70\x65\x72\x74\x79\x5F\x6E\x61\x6D\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F"\
-	"\x72\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x70\x72\x6F\x70\x65\x72\x74\x79\x20"\
-	"\x6E\x61\x6D\x65\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x70\x20\x3D\x20\x66\x5B\x27\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x70\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
+	"\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x70\x61\x72\x61\x6D\x65\x74\x65"\
+	"\x72\x20\x27\x7B\x61\x7D\x27\x20\x69\x6E\x20\x67\x65\x74\x20\x7B\x62\x7D\x20\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x2C\x20\x70\x5B\x30\x5D\x2C\x20"\
+	"\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E"\
 	"\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20\x64\x6F"\
-	"\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x6C\x6F\x6F\x70\x66\x75\x6E\x63\x20\x26\x26\x20\x66\x75\x6E\x63"\
-	"\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x6E\x27\x74\x20\x6D\x61\x6B"\
-	"\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x77\x69\x74\x68\x69\x6E\x20\x61"\
-	"\x20\x6C\x6F\x6F\x70\x2E\x22\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x20\x3D\x20\x66"\
-	"\x5B\x27\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78"\
-	"\x70\x65\x63\x74\x65\x64\x20\x70\x61\x72\x61\x6D\x65\x74\x65\x72\x20\x27\x7B\x61"\
-	"\x7D\x27\x20\x69\x6E\x20\x67\x65\x74\x20\x7B\x62\x7D\x20\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x2E\x22\x2C\x20\x74\x2C\x20\x70\x5B\x30\x5D\x2C\x20\x69\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x2C\x27"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
+	"\x65\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28"\
 	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x73\x65\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x20\x3D\x20\x70\x72"\
-	"\x6F\x70\x65\x72\x74\x79\x5F\x6E\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69"\
-	"\x20\x21\x3D\x3D\x20\x6A\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28"\
-	"\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x7B\x61\x7D\x20\x61\x6E\x64\x20\x69\x6E"\
-	"\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x7B\x62\x7D\x2E\x22\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x2C\x20\x69\x2C\x20\x6A\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B"\
-	"\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20"\
-	"\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x20\x3D\x20\x66\x5B"\
-	"\x27\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x70\x20"\
-	"\x7C\x7C\x20\x70\x2E\x6C\x65\x6E\x67\x74\x68\x20\x21\x3D\x3D\x20\x31\x20\x7C\x7C"\
-	"\x20\x70\x5B\x30\x5D\x20\x21\x3D\x3D\x20\x27\x76\x61\x6C\x75\x65\x27\x29\x20\x7B"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x73\x65\x74\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A"\
+	"\x20\x3D\x20\x70\x72\x6F\x70\x65\x72\x74\x79\x5F\x6E\x61\x6D\x65\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x69\x20\x21\x3D\x3D\x20\x6A\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65"\
+	"\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x7B\x61\x7D\x20\x61"\
+	"\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x7B\x62\x7D\x2E\x22"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x69\x2C\x20\x6A\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20"\
+	"\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E"\
+	"\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74"\
-	"\x65\x64\x20\x28\x76\x61\x6C\x75\x65\x29\x20\x69\x6E\x20\x73\x65\x74\x20\x7B\x61"\
-	"\x7D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x2C\x20\x69\x29\x3B"\
+	"\x20\x66\x20\x3D\x20\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70"\
+	"\x20\x3D\x20\x66\x5B\x27\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x21\x70\x20\x7C\x7C\x20\x70\x2E\x6C\x65\x6E\x67\x74\x68\x20\x21\x3D\x3D"\
+	"\x20\x31\x20\x7C\x7C\x20\x70\x5B\x30\x5D\x20\x21\x3D\x3D\x20\x27\x76\x61\x6C\x75"\
+	"\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45"\
+	"\x78\x70\x65\x63\x74\x65\x64\x20\x28\x76\x61\x6C\x75\x65\x29\x20\x69\x6E\x20\x73"\
+	"\x65\x74\x20\x7B\x61\x7D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x74"\
+	"\x2C\x20\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x70\x72\x6F"\
+	"\x70\x65\x72\x74\x79\x5F\x6E\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79"\
+	"\x70\x65\x6F\x66\x20\x69\x20\x21\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
+	"\x6E\x63\x65\x28\x27\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E"\
+	"\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x70\x72\x6F\x70\x65\x72\x74\x79"\
-	"\x5F\x6E\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20"\
-	"\x69\x20\x21\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x65\x6E\x5B"\
+	"\x69\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
+	"\x6E\x67\x28\x22\x44\x75\x70\x6C\x69\x63\x61\x74\x65\x20\x6D\x65\x6D\x62\x65\x72"\
+	"\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
+	"\x65\x65\x6E\x5B\x69\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62"\
+	"\x65\x72\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
+	"\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
-	"\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B"\
-	"\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72"\
-	"\x65\x73\x73\x69\x6F\x6E\x28\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x65\x6E\x5B\x69\x5D\x20\x3D\x3D"\
-	"\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44"\
-	"\x75\x70\x6C\x69\x63\x61\x74\x65\x20\x6D\x65\x6D\x62\x65\x72\x20\x27\x7B\x61\x7D"\
-	"\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x69\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x65\x65\x6E\x5B\x69"\
-	"\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x6F\x75\x6E\x74\x4D\x65\x6D\x62\x65\x72\x28\x69\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
+	"\x22\x45\x78\x74\x72\x61\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x21"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x65\x73\x35\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x74\x72\x61\x20\x63\x6F\x6D\x6D\x61\x2E\x22"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20"\
+	"\x2D\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74"\
+	"\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
+	"\x63\x65\x28\x27\x7D\x27\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78"\
+	"\x2E\x66\x75\x64\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22"\
+	"\x45\x78\x70\x65\x63\x74\x65\x64\x20\x74\x6F\x20\x73\x65\x65\x20\x61\x20\x73\x74"\
+	"\x61\x74\x65\x6D\x65\x6E\x74\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20"\
+	"\x73\x61\x77\x20\x61\x20\x62\x6C\x6F\x63\x6B\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x28"\
+	"\x64\x65\x6C\x69\x6D\x28\x27\x7B\x27\x29\x29\x29\x3B\x0A\x0A\x20\x20\x20\x20\x76"\
+	"\x61\x72\x20\x76\x61\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x3D\x20\x73\x74"\
+	"\x6D\x74\x28\x27\x76\x61\x72\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x70\x72\x65\x66\x69\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F"\
+	"\x20\x4A\x61\x76\x61\x53\x63\x72\x69\x70\x74\x20\x64\x6F\x65\x73\x20\x6E\x6F\x74"\
+	"\x20\x68\x61\x76\x65\x20\x62\x6C\x6F\x63\x6B\x20\x73\x63\x6F\x70\x65\x2E\x20\x49"\
+	"\x74\x20\x6F\x6E\x6C\x79\x20\x68\x61\x73\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
+	"\x73\x63\x6F\x70\x65\x2E\x20\x53\x6F\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F"\
+	"\x2F\x20\x64\x65\x63\x6C\x61\x72\x69\x6E\x67\x20\x61\x20\x76\x61\x72\x69\x61\x62"\
+	"\x6C\x65\x20\x69\x6E\x20\x61\x20\x62\x6C\x6F\x63\x6B\x20\x63\x61\x6E\x20\x68\x61"\
+	"\x76\x65\x20\x75\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6E\x73\x65\x71"\
+	"\x75\x65\x6E\x63\x65\x73\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
+	"\x69\x64\x2C\x20\x6E\x61\x6D\x65\x2C\x20\x76\x61\x6C\x75\x65\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x6F\x6E"\
+	"\x65\x76\x61\x72\x29\x27\x5D\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6F\x6E"\
+	"\x65\x76\x61\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x54\x6F\x6F\x20\x6D\x61\x6E\x79\x20\x76\x61"\
+	"\x72\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x66\x75\x6E"\
+	"\x63\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6F\x6E"\
+	"\x65\x76\x61\x72\x29\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66"\
+	"\x69\x72\x73\x74\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x64\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x26\x26"\
+	"\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x5B\x69\x64\x5D\x20\x3D\x3D\x3D\x20"\
+	"\x66\x61\x6C\x73\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x52\x65\x64\x65\x66\x69"\
+	"\x6E\x69\x74\x69\x6F\x6E\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74"\
+	"\x6F\x6B\x65\x6E\x2C\x20\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64"\
+	"\x6C\x61\x62\x65\x6C\x28\x69\x64\x2C\x20\x27\x75\x6E\x75\x73\x65\x64\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65"\
+	"\x66\x69\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65"\
+	"\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x2E\x70\x75\x73\x68\x28\x74\x6F"\
+	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
 	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
-	"\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x74\x72"\
-	"\x61\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x69\x64\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x20\x26\x26\x20\x21\x6F\x70\x74\x69\x6F"\
-	"\x6E\x2E\x65\x73\x35\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x28\x22\x45\x78\x74\x72\x61\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2D\x3D\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7D"\
-	"\x27\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x66\x75\x64\x20"\
-	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63"\
-	"\x74\x65\x64\x20\x74\x6F\x20\x73\x65\x65\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61"\
-	"\x20\x62\x6C\x6F\x63\x6B\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x7D\x28\x64\x65\x6C\x69\x6D"\
-	"\x28\x27\x7B\x27\x29\x29\x29\x3B\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x76\x61"\
-	"\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x3D\x20\x73\x74\x6D\x74\x28\x27\x76"\
-	"\x61\x72\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x70\x72\x65\x66\x69"\
-	"\x78\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x4A\x61\x76\x61"\
-	"\x53\x63\x72\x69\x70\x74\x20\x64\x6F\x65\x73\x20\x6E\x6F\x74\x20\x68\x61\x76\x65"\
-	"\x20\x62\x6C\x6F\x63\x6B\x20\x73\x63\x6F\x70\x65\x2E\x20\x49\x74\x20\x6F\x6E\x6C"\
-	"\x79\x20\x68\x61\x73\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x63\x6F\x70\x65"\
-	"\x2E\x20\x53\x6F\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x64\x65\x63"\
-	"\x6C\x61\x72\x69\x6E\x67\x20\x61\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x20\x69\x6E"\
-	"\x20\x61\x20\x62\x6C\x6F\x63\x6B\x20\x63\x61\x6E\x20\x68\x61\x76\x65\x20\x75\x6E"\
-	"\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6E\x73\x65\x71\x75\x65\x6E\x63\x65"\
-	"\x73\x2E\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x64\x2C\x20\x6E"\
-	"\x61\x6D\x65\x2C\x20\x76\x61\x6C\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x6F\x6E\x65\x76\x61\x72\x29"\
-	"\x27\x5D\x20\x26\x26\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6F\x6E\x65\x76\x61\x72\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
-	"\x6E\x67\x28\x22\x54\x6F\x6F\x20\x6D\x61\x6E\x79\x20\x76\x61\x72\x20\x73\x74\x61"\
-	"\x74\x65\x6D\x65\x6E\x74\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x66\x75\x6E\x63\x74\x5B\x27\x28"\
-	"\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6F\x6E\x65\x76\x61\x72\x29"\
-	"\x27\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20"\
-	"\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B"\
-	"\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E"\
-	"\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x64\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74"\
-	"\x5B\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x5D\x20\x26\x26\x20\x70\x72\x65\x64"\
-	"\x65\x66\x69\x6E\x65\x64\x5B\x69\x64\x5D\x20\x3D\x3D\x3D\x20\x66\x61\x6C\x73\x65"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x52\x65\x64\x65\x66\x69\x6E\x69\x74\x69\x6F"\
-	"\x6E\x20\x6F\x66\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C"\
-	"\x20\x69\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C"\
-	"\x28\x69\x64\x2C\x20\x27\x75\x6E\x75\x73\x65\x64\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x72\x65\x66\x69\x78\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x20\x3D\x20\x74\x6F"\
-	"\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69"\
-	"\x73\x2E\x66\x69\x72\x73\x74\x2E\x70\x75\x73\x68\x28\x74\x6F\x6B\x65\x6E\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E"\
-	"\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A"\
-	"\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D"\
-	"\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x28\x22\x49\x74\x20\x69\x73\x20\x6E\x6F\x74\x20\x6E\x65\x63\x65"\
-	"\x73\x73\x61\x72\x79\x20\x74\x6F\x20\x69\x6E\x69\x74\x69\x61\x6C\x69\x7A\x65\x20"\
-	"\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27"\
-	"\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x69\x64\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x65\x65\x6B\x28\x30"\
-	"\x29\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x20\x26\x26\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x65\x72\x72\x6F\x72\x28\x22\x56\x61\x72\x69\x61\x62\x6C\x65\x20\x7B\x61\x7D\x20"\
-	"\x77\x61\x73\x20\x6E\x6F\x74\x20\x64\x65\x63\x6C\x61\x72\x65\x64\x20\x63\x6F\x72"\
-	"\x72\x65\x63\x74\x6C\x79\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76"\
-	"\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x6C\x75\x65\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
-	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x61\x6D\x65\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x76\x61\x6C\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
+	"\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69"\
-	"\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x73\x74"\
-	"\x61\x74\x65\x6D\x65\x6E\x74\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B"\
-	"\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6E\x62\x6C\x6F\x63"\
-	"\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x28\x0A\x22\x46\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x63\x6C"\
-	"\x61\x72\x61\x74\x69\x6F\x6E\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20"\
-	"\x62\x65\x20\x70\x6C\x61\x63\x65\x64\x20\x69\x6E\x20\x62\x6C\x6F\x63\x6B\x73\x2E"\
-	"\x20\x55\x73\x65\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x65\x78\x70\x72"\
-	"\x65\x73\x73\x69\x6F\x6E\x20\x6F\x72\x20\x6D\x6F\x76\x65\x20\x74\x68\x65\x20\x73"\
-	"\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x74\x6F\x20\x74\x68\x65\x20\x74\x6F\x70\x20"\
-	"\x6F\x66\x20\x74\x68\x65\x20\x6F\x75\x74\x65\x72\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69\x20\x3D\x20"\
-	"\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x64\x6C\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x28\x69\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
-	"\x27\x28\x27\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E"\
-	"\x65\x20\x3D\x3D\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x0A\x22"\
-	"\x46\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x63\x6C\x61\x72\x61\x74\x69\x6F\x6E"\
-	"\x73\x20\x61\x72\x65\x20\x6E\x6F\x74\x20\x69\x6E\x76\x6F\x63\x61\x62\x6C\x65\x2E"\
-	"\x20\x57\x72\x61\x70\x20\x74\x68\x65\x20\x77\x68\x6F\x6C\x65\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x20\x69\x6E\x20\x70"\
-	"\x61\x72\x65\x6E\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B"\
-	"\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70\x72\x65\x66\x69\x78"\
+	"\x69\x64\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x49\x74\x20\x69\x73\x20\x6E\x6F\x74"\
+	"\x20\x6E\x65\x63\x65\x73\x73\x61\x72\x79\x20\x74\x6F\x20\x69\x6E\x69\x74\x69\x61"\
+	"\x6C\x69\x7A\x65\x20\x27\x7B\x61\x7D\x27\x20\x74\x6F\x20\x27\x75\x6E\x64\x65\x66"\
+	"\x69\x6E\x65\x64\x27\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x2C\x20\x69\x64\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70"\
+	"\x65\x65\x6B\x28\x30\x29\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x20\x26\x26"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
+	"\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x56\x61\x72\x69\x61\x62\x6C\x65"\
+	"\x20\x7B\x61\x7D\x20\x77\x61\x73\x20\x6E\x6F\x74\x20\x64\x65\x63\x6C\x61\x72\x65"\
+	"\x64\x20\x63\x6F\x72\x72\x65\x63\x74\x6C\x79\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x61\x6C\x75\x65\x20\x3D\x20\x65\x78\x70\x72\x65\x73"\
+	"\x73\x69\x6F\x6E\x28\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x76\x61"\
+	"\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x76\x61\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x65\x78\x70\x73\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74"\
 	"\x28\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x69"\
-	"\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C\x69\x64\x65\x6E\x74\x69\x66\x69\x65"\
-	"\x72\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65"\
-	"\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
+	"\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69"\
+	"\x6E\x62\x6C\x6F\x63\x6B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x22\x46\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x64\x65\x63\x6C\x61\x72\x61\x74\x69\x6F\x6E\x73\x20\x73\x68\x6F\x75\x6C\x64"\
+	"\x20\x6E\x6F\x74\x20\x62\x65\x20\x70\x6C\x61\x63\x65\x64\x20\x69\x6E\x20\x62\x6C"\
+	"\x6F\x63\x6B\x73\x2E\x20\x55\x73\x65\x20\x61\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x6F\x72\x20\x6D\x6F\x76\x65\x20"\
+	"\x74\x68\x65\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x74\x6F\x20\x74\x68\x65"\
+	"\x20\x74\x6F\x70\x20\x6F\x66\x20\x74\x68\x65\x20\x6F\x75\x74\x65\x72\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
+	"\x20\x69\x20\x3D\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x69\x2C\x20\x27\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x64\x6F\x46\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x28\x69\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
+	"\x20\x3D\x3D\x3D\x20\x27\x28\x27\x20\x26\x26\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x6C\x69\x6E\x65\x20\x3D\x3D\x3D\x20\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E"\
+	"\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72"\
+	"\x6F\x72\x28\x0A\x22\x46\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x63\x6C\x61\x72"\
+	"\x61\x74\x69\x6F\x6E\x73\x20\x61\x72\x65\x20\x6E\x6F\x74\x20\x69\x6E\x76\x6F\x63"\
+	"\x61\x62\x6C\x65\x2E\x20\x57\x72\x61\x70\x20\x74\x68\x65\x20\x77\x68\x6F\x6C\x65"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E"\
+	"\x20\x69\x6E\x20\x70\x61\x72\x65\x6E\x73\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20"\
+	"\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x70"\
+	"\x72\x65\x66\x69\x78\x28\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x2C\x20\x66\x75"\
+	"\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x76\x61\x72\x20\x69\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x61\x6C\x69\x64\x65\x6E"\
+	"\x74\x69\x66\x69\x65\x72\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x69\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61"\
+	"\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x69\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E"\
+	"\x6C\x6F\x6F\x70\x66\x75\x6E\x63\x20\x26\x26\x20\x66\x75\x6E\x63\x74\x5B\x27\x28"\
+	"\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x6E\x27\x74"\
+	"\x20\x6D\x61\x6B\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x77\x69\x74\x68"\
+	"\x69\x6E\x20\x61\x20\x6C\x6F\x6F\x70\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
+	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C"\
+	"\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x69\x66\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
+	"\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x68\x69"\
+	"\x73\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61"\
+	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73"\
+	"\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
+	"\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
+	"\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F"\
+	"\x6E\x61\x6C\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69"\
+	"\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E"\
+	"\x6D\x65\x6E\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F"\
+	"\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65"\
 	"\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x64\x6F\x46\x75\x6E\x63\x74\x69\x6F\x6E\x28\x69\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x6F\x6F\x70\x66"\
-	"\x75\x6E\x63\x20\x26\x26\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61"\
-	"\x67\x65\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x6F\x6E\x27\x74\x20\x6D\x61\x6B\x65"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x77\x69\x74\x68\x69\x6E\x20\x61\x20"\
-	"\x6C\x6F\x6F\x70\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
-	"\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74"\
-	"\x6D\x74\x28\x27\x69\x66\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x68\x69\x73\x2C\x20\x74\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
-	"\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70"\
-	"\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65"\
-	"\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x61\x6C\x20\x65"\
-	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61"\
-	"\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E"\
-	"\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63"\
-	"\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
+	"\x65\x28\x27\x65\x6C\x73\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x3D\x3D\x3D\x20\x27\x65\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x65\x6C"\
-	"\x73\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
-	"\x69\x66\x27\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x3D\x3D\x3D\x20\x27\x73\x77\x69\x74\x63\x68\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x74\x65\x6D\x65\x6E"\
-	"\x74\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72"\
-	"\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A\x0A\x20"\
-	"\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x74\x72\x79\x27\x2C\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x65\x2C\x20\x73\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E"\
-	"\x69\x64\x20\x3D\x3D\x3D\x20\x27\x63\x61\x74\x63\x68\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x63"\
-	"\x61\x74\x63\x68\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x63\x6F\x70\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20"\
-	"\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x74\x79\x70"\
-	"\x65\x20\x21\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x29\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x6E"\
-	"\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x61\x6E\x64\x20\x69\x6E\x73\x74"\
-	"\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62\x65\x6C\x28\x65\x2C"\
-	"\x20\x27\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x29\x3B\x0A\x20\x20"\
+	"\x3D\x3D\x3D\x20\x27\x69\x66\x27\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x73\x77\x69\x74\x63\x68\x27\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61"\
+	"\x74\x65\x6D\x65\x6E\x74\x28\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75"\
+	"\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D"\
+	"\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x74"\
+	"\x72\x79\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x65\x2C\x20\x73\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x66\x61\x6C\x73\x65"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x63\x61\x74\x63\x68\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
+	"\x63\x65\x28\x27\x63\x61\x74\x63\x68\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B"\
+	"\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x73\x63"\
+	"\x6F\x70\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F"\
+	"\x70\x65\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x20\x3D\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x74\x79\x70\x65\x20\x21\x3D\x3D\x20\x27\x28\x69\x64\x65\x6E\x74\x69\x66"\
+	"\x69\x65\x72\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74"\
+	"\x65\x64\x20\x61\x6E\x20\x69\x64\x65\x6E\x74\x69\x66\x69\x65\x72\x20\x61\x6E\x64"\
+	"\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x65\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x64\x6C\x61\x62"\
+	"\x65\x6C\x28\x65\x2C\x20\x27\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B"\
+	"\x28\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x69\x6E\x61\x6C\x6C"\
+	"\x79\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
+	"\x76\x61\x6E\x63\x65\x28\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x29\x3B\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x66\x61\x6C\x73"\
-	"\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20"\
-	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63"\
-	"\x6F\x70\x65\x20\x3D\x20\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
-	"\x28\x27\x66\x69\x6E\x61\x6C\x6C\x79\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x66\x61\x6C\x73\x65\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x62"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F"\
-	"\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E"\
-	"\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E"\
-	"\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x63\x61\x74\x63\x68"\
-	"\x27\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
-	"\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x77\x68\x69\x6C"\
-	"\x65\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27"\
+	"\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75"\
+	"\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
+	"\x66\x20\x28\x21\x62\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61"\
+	"\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27"\
+	"\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27"\
+	"\x63\x61\x74\x63\x68\x27\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
+	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20"\
+	"\x20\x7D\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28"\
+	"\x27\x77\x68\x69\x6C\x65\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
+	"\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28"\
+	"\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74"\
+	"\x68\x69\x73\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73"\
+	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72"\
+	"\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74"\
+	"\x69\x6F\x6E\x61\x6C\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64"\
+	"\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69"\
+	"\x67\x6E\x6D\x65\x6E\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
+	"\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76"\
+	"\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72"\
+	"\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29"\
+	"\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x6C\x61\x62"\
+	"\x65\x6C\x6C\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x72"\
+	"\x65\x73\x65\x72\x76\x65\x28\x27\x77\x69\x74\x68\x27\x29\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x73\x77\x69\x74\x63\x68\x27\x2C"\
+	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x67\x20\x3D\x20\x66\x61"\
+	"\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27"\
 	"\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61"\
-	"\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x68\x69\x73\x2C\x20"\
-	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F"\
-	"\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
-	"\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78"\
-	"\x70\x65\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x61\x6C"\
-	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E\x73\x74"\
-	"\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E"\
-	"\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E"\
-	"\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C"\
-	"\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67"\
-	"\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D"\
-	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
-	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76"\
-	"\x65\x28\x27\x77\x69\x74\x68\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63"\
-	"\x6B\x73\x74\x6D\x74\x28\x27\x73\x77\x69\x74\x63\x68\x27\x2C\x20\x66\x75\x6E\x63"\
-	"\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
-	"\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x67\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61"\
-	"\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x68\x69\x73"\
-	"\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x63\x6F"\
-	"\x6E\x64\x69\x74\x69\x6F\x6E\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E"\
-	"\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
-	"\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
-	"\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F"\
-	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A"\
-	"\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20\x3D\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x27\x7B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
-	"\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64"\
-	"\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x63\x61\x73\x65\x73"\
-	"\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
-	"\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77"\
-	"\x69\x74\x63\x68\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
-	"\x63\x61\x73\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x76"\
-	"\x65\x72\x62\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x62\x72\x65\x61\x6B\x27\x3A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x63\x61\x73\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6F\x6E\x74\x69\x6E\x75\x65\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x73\x77\x69\x74\x63"\
-	"\x68\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x74\x68\x72\x6F\x77\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66"\
-	"\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x59\x6F\x75\x20\x63\x61\x6E\x20\x74\x65\x6C"\
-	"\x6C\x20\x4A\x53\x48\x69\x6E\x74\x20\x74\x68\x61\x74\x20\x79\x6F\x75\x20\x64\x6F"\
-	"\x6E\x27\x74\x20\x75\x73\x65\x20\x62\x72\x65\x61\x6B\x20\x69\x6E\x74\x65\x6E\x74"\
-	"\x69\x6F\x6E\x61\x6C\x6C\x79\x20\x62\x79\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61\x64\x64\x69\x6E\x67"\
-	"\x20\x61\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2F\x2A\x20\x66\x61\x6C\x6C\x73\x20"\
-	"\x74\x68\x72\x6F\x75\x67\x68\x20\x2A\x2F\x20\x6F\x6E\x20\x61\x20\x6C\x69\x6E\x65"\
-	"\x20\x6A\x75\x73\x74\x20\x62\x65\x66\x6F\x72\x65\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x74\x68\x65\x20"\
-	"\x6E\x65\x78\x74\x20\x60\x63\x61\x73\x65\x60\x2E\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x66\x74"\
-	"\x2E\x74\x65\x73\x74\x28\x6C\x69\x6E\x65\x73\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
-	"\x6E\x2E\x6C\x69\x6E\x65\x20\x2D\x20\x32\x5D\x29\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x22\x45\x78"\
-	"\x70\x65\x63\x74\x65\x64\x20\x61\x20\x27\x62\x72\x65\x61\x6B\x27\x20\x73\x74\x61"\
-	"\x74\x65\x6D\x65\x6E\x74\x20\x62\x65\x66\x6F\x72\x65\x20\x27\x63\x61\x73\x65\x27"\
-	"\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74"\
+	"\x28\x74\x68\x69\x73\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
+	"\x6F\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
+	"\x69\x73\x2E\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x20\x3D\x20\x65\x78\x70\x72\x65"\
+	"\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E"\
+	"\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x20"\
+	"\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E"\
+	"\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2B\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69"\
+	"\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E"\
+	"\x63\x61\x73\x65\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2E\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x63\x61\x73\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63"\
+	"\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x62\x72\x65"\
+	"\x61\x6B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x63\x61\x73\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6F\x6E\x74"\
+	"\x69\x6E\x75\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x73\x77\x69\x74\x63\x68\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x74\x68\x72\x6F\x77\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x59\x6F\x75\x20\x63\x61"\
+	"\x6E\x20\x74\x65\x6C\x6C\x20\x4A\x53\x48\x69\x6E\x74\x20\x74\x68\x61\x74\x20\x79"\
+	"\x6F\x75\x20\x64\x6F\x6E\x27\x74\x20\x75\x73\x65\x20\x62\x72\x65\x61\x6B\x20\x69"\
+	"\x6E\x74\x65\x6E\x74\x69\x6F\x6E\x61\x6C\x6C\x79\x20\x62\x79\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F\x20\x61"\
+	"\x64\x64\x69\x6E\x67\x20\x61\x20\x63\x6F\x6D\x6D\x65\x6E\x74\x20\x2F\x2A\x20\x66"\
+	"\x61\x6C\x6C\x73\x20\x74\x68\x72\x6F\x75\x67\x68\x20\x2A\x2F\x20\x6F\x6E\x20\x61"\
+	"\x20\x6C\x69\x6E\x65\x20\x6A\x75\x73\x74\x20\x62\x65\x66\x6F\x72\x65\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x2F\x2F"\
+	"\x20\x74\x68\x65\x20\x6E\x65\x78\x74\x20\x60\x63\x61\x73\x65\x60\x2E\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x21\x66\x74\x2E\x74\x65\x73\x74\x28\x6C\x69\x6E\x65\x73\x5B\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x2D\x20\x32\x5D\x29\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65"\
-	"\x6E\x74\x61\x74\x69\x6F\x6E\x28\x2D\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65"\
-	"\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x63\x61\x73\x65\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x63"\
-	"\x61\x73\x65\x73\x2E\x70\x75\x73\x68\x28\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E"\
-	"\x28\x32\x30\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x67\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3A\x27"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x20\x3D\x20\x27\x63\x61"\
-	"\x73\x65\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x3A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28"\
-	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20"\
-	"\x27\x62\x72\x65\x61\x6B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6F\x6E\x74\x69\x6E\x75\x65\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x74\x68\x72\x6F\x77"\
-	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
-	"\x66\x74\x2E\x74\x65\x73\x74\x28\x6C\x69\x6E\x65\x73\x5B\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x2D\x20\x32\x5D\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x22"\
-	"\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x27\x62\x72\x65\x61\x6B\x27\x20\x73"\
-	"\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x62\x65\x66\x6F\x72\x65\x20\x27\x64\x65\x66"\
-	"\x61\x75\x6C\x74\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x27\x62\x72\x65\x61\x6B"\
+	"\x27\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x62\x65\x66\x6F\x72\x65\x20\x27"\
+	"\x63\x61\x73\x65\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x6F\x6B"\
 	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x2D\x6F\x70\x74\x69\x6F\x6E"\
 	"\x2E\x69\x6E\x64\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x64\x65\x66\x61\x75"\
-	"\x6C\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x67\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3A\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
-	"\x65\x20\x27\x7D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2D\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
-	"\x63\x65\x28\x27\x7D\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x68\x69\x73\x2E\x63\x61\x73"\
-	"\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x31\x20\x7C\x7C\x20\x74"\
-	"\x68\x69\x73\x2E\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
-	"\x20\x27\x74\x72\x75\x65\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E"\
-	"\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x66\x61"\
-	"\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x54\x68\x69"\
-	"\x73\x20\x27\x73\x77\x69\x74\x63\x68\x27\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65"\
-	"\x20\x61\x6E\x20\x27\x69\x66\x27\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27"\
-	"\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74"\
-	"\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x20\x3D\x20\x75\x6E\x64\x65\x66\x69\x6E"\
-	"\x65\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x28\x65\x6E\x64\x29\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x4D\x69\x73"\
-	"\x73\x69\x6E\x67\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x27\x7D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x67\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x77\x69\x74\x63\x68\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x61\x73\x65\x20\x27\x2C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72"\
-	"\x28\x22\x45\x61\x63\x68\x20\x76\x61\x6C\x75\x65\x20\x73\x68\x6F\x75\x6C\x64\x20"\
-	"\x68\x61\x76\x65\x20\x69\x74\x73\x20\x6F\x77\x6E\x20\x63\x61\x73\x65\x20\x6C\x61"\
-	"\x62\x65\x6C\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x63\x61\x73\x65\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
+	"\x68\x69\x73\x2E\x63\x61\x73\x65\x73\x2E\x70\x75\x73\x68\x28\x65\x78\x70\x72\x65"\
+	"\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x67\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
+	"\x65\x28\x27\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x20"\
+	"\x3D\x20\x27\x63\x61\x73\x65\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x3A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69"\
+	"\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x61\x73\x65\x20\x27\x62\x72\x65\x61\x6B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x63\x6F\x6E\x74"\
+	"\x69\x6E\x75\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x72\x65\x74\x75\x72\x6E\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
+	"\x74\x68\x72\x6F\x77\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x61\x73\x65\x20\x27\x3A\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x74\x65\x6D"\
-	"\x65\x6E\x74\x73\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64"\
-	"\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x4D"\
-	"\x69\x73\x73\x69\x6E\x67\x20\x27\x3A\x27\x20\x6F\x6E\x20\x61\x20\x63\x61\x73\x65"\
-	"\x20\x63\x6C\x61\x75\x73\x65\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65"\
-	"\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20"\
-	"\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x63\x61\x73\x65\x27\x2C\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x21\x66\x74\x2E\x74\x65\x73\x74\x28\x6C\x69\x6E\x65\x73\x5B\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x2D\x20\x32\x5D\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x27\x62\x72\x65"\
+	"\x61\x6B\x27\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x62\x65\x66\x6F\x72\x65"\
+	"\x20\x27\x64\x65\x66\x61\x75\x6C\x74\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x7D\x29\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x64\x65\x62\x75\x67\x67\x65\x72\x27"\
-	"\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x64\x65\x62\x75"\
-	"\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x28\x22\x41\x6C\x6C\x20\x27\x64\x65\x62\x75\x67\x67\x65\x72\x27"\
-	"\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62"\
-	"\x65\x20\x72\x65\x6D\x6F\x76\x65\x64\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
-	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
-	"\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x78\x20\x3D"\
-	"\x20\x73\x74\x6D\x74\x28\x27\x64\x6F\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
-	"\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D"\
-	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63"\
-	"\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69"\
-	"\x72\x73\x74\x20\x3D\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
-	"\x77\x68\x69\x6C\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63"\
-	"\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72"\
-	"\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E"\
-	"\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63"\
-	"\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x61\x6C\x20\x65\x78"\
-	"\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64"\
-	"\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E\x22"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
-	"\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28"\
-	"\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E\x28\x2D\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
-	"\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E"\
-	"\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
-	"\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64\x20\x3D\x20"\
-	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x65\x78\x70\x73"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x7D\x28\x29\x29\x3B\x0A\x0A"\
-	"\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27\x66\x6F\x72\x27\x2C"\
-	"\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x73\x2C\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27"\
-	"\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61"\
-	"\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x68\x69\x73\x2C\x20"\
-	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x70\x65\x65\x6B\x28"\
-	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x76\x61"\
-	"\x72\x27\x20\x3F\x20\x31\x20\x3A\x20\x30\x29\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
-	"\x69\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
-	"\x27\x76\x61\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x76\x61\x72\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72"\
-	"\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x66\x75\x64\x2E\x63\x61\x6C\x6C\x28\x76"\
-	"\x61\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69"\
-	"\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x76\x61\x6C\x75\x65\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E\x75\x73\x65\x64\x27"\
-	"\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
-	"\x6C\x75\x65\x5D\x20\x3D\x20\x27\x76\x61\x72\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73"\
-	"\x65\x20\x27\x76\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
+	"\x64\x65\x66\x61\x75\x6C\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x67\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
+	"\x28\x27\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x61\x73\x65\x20\x27\x7D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x2D\x3D\x20\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x61\x74\x69\x6F\x6E"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7D\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x68\x69"\
+	"\x73\x2E\x63\x61\x73\x65\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x31"\
+	"\x20\x7C\x7C\x20\x74\x68\x69\x73\x2E\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x2E\x69"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x74\x72\x75\x65\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x74\x68\x69\x73\x2E\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x2E\x69\x64\x20\x3D\x3D"\
+	"\x3D\x20\x27\x66\x61\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x28\x22\x54\x68\x69\x73\x20\x27\x73\x77\x69\x74\x63\x68\x27\x20\x73\x68\x6F\x75"\
+	"\x6C\x64\x20\x62\x65\x20\x61\x6E\x20\x27\x69\x66\x27\x2E\x22\x2C\x20\x74\x68\x69"\
+	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
+	"\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x66\x75\x6E\x63\x74\x5B\x27\x28\x76\x65\x72\x62\x29\x27\x5D\x20\x3D\x20\x75\x6E"\
+	"\x64\x65\x66\x69\x6E\x65\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x28\x65\x6E\x64\x29\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72"\
+	"\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x7D\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x66\x6F\x72\x20\x69\x6E"\
-	"\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x74\x6F\x6B\x65\x6E\x2E"\
+	"\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x2C\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x65\x72\x72\x6F\x72\x28\x22\x45\x61\x63\x68\x20\x76\x61\x6C\x75\x65\x20\x73\x68"\
+	"\x6F\x75\x6C\x64\x20\x68\x61\x76\x65\x20\x69\x74\x73\x20\x6F\x77\x6E\x20\x63\x61"\
+	"\x73\x65\x20\x6C\x61\x62\x65\x6C\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x3A\x27\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
+	"\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
+	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72"\
+	"\x6F\x72\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x3A\x27\x20\x6F\x6E\x20\x61"\
+	"\x20\x63\x61\x73\x65\x20\x63\x6C\x61\x75\x73\x65\x2E\x22\x2C\x20\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78"\
+	"\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73"\
+	"\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x69\x6E\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73"\
-	"\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x62\x6C\x6F\x63\x6B"\
-	"\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x2E\x66\x6F\x72"\
-	"\x69\x6E\x20\x26\x26\x20\x28\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x31\x20"\
-	"\x7C\x7C\x20\x74\x79\x70\x65\x6F\x66\x20\x73\x5B\x30\x5D\x20\x21\x3D\x3D\x20\x27"\
-	"\x6F\x62\x6A\x65\x63\x74\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x30\x5D\x2E\x76\x61\x6C\x75"\
-	"\x65\x20\x21\x3D\x3D\x20\x27\x69\x66\x27\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x54\x68\x65\x20\x62\x6F\x64\x79\x20\x6F\x66\x20\x61\x20\x66\x6F\x72\x20\x69\x6E"\
-	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x77\x72\x61\x70\x70\x65\x64\x20\x69"\
-	"\x6E\x20\x61\x6E\x20\x69\x66\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x74\x6F"\
-	"\x20\x66\x69\x6C\x74\x65\x72\x20\x75\x6E\x77\x61\x6E\x74\x65\x64\x20\x70\x72\x6F"\
-	"\x70\x65\x72\x74\x69\x65\x73\x20\x66\x72\x6F\x6D\x20\x74\x68\x65\x20\x70\x72\x6F"\
-	"\x74\x6F\x74\x79\x70\x65\x2E\x22\x2C\x20\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x27\x63\x61\x73\x65\x27\x2C"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x7D\x29\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64\x20\x3D\x20\x74"\
+	"\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x64\x65\x62\x75"\
+	"\x67\x67\x65\x72\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E"\
+	"\x2E\x64\x65\x62\x75\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x41\x6C\x6C\x20\x27\x64\x65\x62\x75"\
+	"\x67\x67\x65\x72\x27\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x20\x73\x68\x6F"\
+	"\x75\x6C\x64\x20\x62\x65\x20\x72\x65\x6D\x6F\x76\x65\x64\x2E\x22\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70"\
+	"\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x20\x20\x20\x20\x28\x66\x75\x6E\x63"\
+	"\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x78\x20\x3D\x20\x73\x74\x6D\x74\x28\x27\x64\x6F\x27\x2C\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29"\
-	"\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20"\
-	"\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
-	"\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D"\
-	"\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
+	"\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75"\
+	"\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
+	"\x6E\x63\x65\x28\x27\x77\x68\x69\x6C\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E"\
+	"\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
+	"\x27\x28\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F"\
+	"\x73\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70"\
+	"\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
+	"\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E"\
+	"\x61\x6C\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E"\
+	"\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D"\
+	"\x65\x6E\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73"\
+	"\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
+	"\x6E\x63\x65\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B"\
+	"\x65\x6E\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65"\
+	"\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D"\
+	"\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78\x2E\x6C\x61\x62\x65\x6C\x6C"\
+	"\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x78"\
+	"\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x7D\x28"\
+	"\x29\x29\x3B\x0A\x0A\x20\x20\x20\x20\x62\x6C\x6F\x63\x6B\x73\x74\x6D\x74\x28\x27"\
+	"\x66\x6F\x72\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x73\x2C\x20\x74\x20\x3D\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
+	"\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D"\
+	"\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28"\
+	"\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2B\x3D\x20\x31\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x28\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74"\
+	"\x68\x69\x73\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73"\
+	"\x70\x61\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x70\x65\x65\x6B\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D"\
+	"\x3D\x20\x27\x76\x61\x72\x27\x20\x3F\x20\x31\x20\x3A\x20\x30\x29\x2E\x69\x64\x20"\
+	"\x3D\x3D\x3D\x20\x27\x69\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
 	"\x20\x3D\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
-	"\x65\x28\x27\x76\x61\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x2E\x66\x75\x64\x2E\x63\x61\x6C\x6C\x28\x76\x61\x72\x73\x74\x61\x74\x65"\
-	"\x6D\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x2C"\
-	"\x20\x27\x66\x6F\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x76"\
+	"\x61\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x76\x61\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2E\x66\x75\x64\x2E\x63"\
+	"\x61\x6C\x6C\x28\x76\x61\x72\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x2C\x20\x74\x72"\
+	"\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
+	"\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x66\x75\x6E\x63\x74\x5B\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x75\x6E"\
+	"\x75\x73\x65\x64\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x76\x61\x6C\x75\x65\x5D\x20\x3D\x20\x27\x76\x61\x72\x27\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
+	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x61\x73\x65\x20\x27\x76\x61\x72\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66"\
+	"\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x42\x61\x64\x20\x66"\
+	"\x6F\x72\x20\x69\x6E\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x20\x27\x7B\x61\x7D\x27"\
+	"\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
+	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
+	"\x27\x69\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65"\
+	"\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C\x20"\
+	"\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20"\
+	"\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x66\x6F\x72\x69\x6E\x20\x26\x26\x20\x28\x73\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x20\x3E\x20\x31\x20\x7C\x7C\x20\x74\x79\x70\x65\x6F\x66\x20\x73\x5B\x30\x5D\x20"\
+	"\x21\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x20\x7C\x7C\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x30\x5D"\
+	"\x2E\x76\x61\x6C\x75\x65\x20\x21\x3D\x3D\x20\x27\x69\x66\x27\x29\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x54\x68\x65\x20\x62\x6F\x64\x79\x20\x6F\x66\x20\x61\x20\x66"\
+	"\x6F\x72\x20\x69\x6E\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x77\x72\x61\x70"\
+	"\x70\x65\x64\x20\x69\x6E\x20\x61\x6E\x20\x69\x66\x20\x73\x74\x61\x74\x65\x6D\x65"\
+	"\x6E\x74\x20\x74\x6F\x20\x66\x69\x6C\x74\x65\x72\x20\x75\x6E\x77\x61\x6E\x74\x65"\
+	"\x64\x20\x70\x72\x6F\x70\x65\x72\x74\x69\x65\x73\x20\x66\x72\x6F\x6D\x20\x74\x68"\
+	"\x65\x20\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x2E\x22\x2C\x20\x74\x68\x69\x73\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61"\
+	"\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67"\
+	"\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
+	"\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x76\x61\x72\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x27\x76\x61\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x73\x74"\
+	"\x61\x74\x65\x6D\x65\x6E\x74\x2E\x66\x75\x64\x2E\x63\x61\x6C\x6C\x28\x76\x61\x72"\
+	"\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
+	"\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
+	"\x6F\x6E\x28\x30\x2C\x20\x27\x66\x6F\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
+	"\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x6F"\
+	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
+	"\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
+	"\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
+	"\x20\x27\x3D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E"\
+	"\x62\x6F\x73\x73\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45"\
+	"\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x61"\
+	"\x6C\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E\x73"\
+	"\x74\x65\x61\x64\x20\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65"\
+	"\x6E\x74\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x6F\x6B\x65\x6E\x29\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
 	"\x28\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20"\
+	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20"\
 	"\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3D\x27\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x62\x6F\x73\x73\x29"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70\x65\x63\x74"\
-	"\x65\x64\x20\x61\x20\x63\x6F\x6E\x64\x69\x74\x69\x6F\x6E\x61\x6C\x20\x65\x78\x70"\
-	"\x72\x65\x73\x73\x69\x6F\x6E\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20"\
-	"\x73\x61\x77\x20\x61\x6E\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x2E\x22\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72"\
-	"\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27"\
+	"\x7B\x61\x7D\x27\x20\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77"\
+	"\x20\x27\x7B\x62\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2C\x20\x27\x29\x27\x2C\x20\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69"\
-	"\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3B\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x3B\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72"\
-	"\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x20"\
-	"\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x27\x7B\x62\x7D"\
-	"\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x27\x29\x27\x2C\x20\x27\x3B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x29"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70\x72\x65\x73\x73\x69"\
-	"\x6F\x6E\x28\x30\x2C\x20\x27\x66\x6F\x72\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D\x6D\x61"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x29\x27\x2C"\
-	"\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x73"\
-	"\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x6F\x6B\x65"\
-	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x6C\x6F\x63"\
-	"\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B"\
-	"\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65"\
-	"\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x29\x2E\x6C\x61\x62\x65\x6C\x6C\x65\x64"\
-	"\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28"\
-	"\x27\x62\x72\x65\x61\x6B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x76\x20\x3D\x20\x6E"\
-	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61"\
-	"\x6B\x61\x67\x65\x29\x27\x5D\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E"\
-	"\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65"\
-	"\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x68\x69\x73\x2E\x76\x61\x6C\x75\x65\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68\x69\x73\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E"\
-	"\x65\x20\x3D\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x21\x3D\x3D\x20\x27\x6C\x61"\
-	"\x62\x65\x6C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61"\
-	"\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E"\
-	"\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x63\x6F\x70\x65\x5B\x76"\
-	"\x5D\x20\x21\x3D\x3D\x20\x66\x75\x6E\x63\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69"\
-	"\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6F\x75\x74\x20\x6F\x66\x20"\
-	"\x73\x63\x6F\x70\x65\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68"\
-	"\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27\x62\x72\x65\x61\x6B\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73"\
-	"\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65"\
-	"\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x63\x6F\x6E\x74\x69\x6E"\
-	"\x75\x65\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x76\x20\x3D\x20\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65"\
-	"\x29\x27\x5D\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65"\
-	"\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x2C\x20\x74\x68\x69\x73\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69"\
+	"\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21"\
+	"\x3D\x3D\x20\x27\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x78\x70"\
+	"\x72\x65\x73\x73\x69\x6F\x6E\x28\x30\x2C\x20\x27\x66\x6F\x72\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20"\
+	"\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x63\x6F\x6D\x6D\x61\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
+	"\x28\x27\x29\x27\x2C\x20\x74\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6E\x6F\x73\x70\x61\x63\x65\x28\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x62\x6C\x6F\x63\x6B\x28\x74\x72\x75\x65\x2C\x20\x74\x72\x75\x65\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28"\
+	"\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F"\
+	"\x6F\x70\x61\x67\x65\x29\x27\x5D\x20\x2D\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x29\x2E\x6C\x61\x62"\
+	"\x65\x6C\x6C\x65\x64\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20"\
+	"\x73\x74\x6D\x74\x28\x27\x62\x72\x65\x61\x6B\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20"\
+	"\x76\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27"\
+	"\x28\x62\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x3D\x3D\x3D\x20\x30\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E"\
+	"\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E"\
+	"\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x68\x69\x73\x2E\x76"\
+	"\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68\x69"\
+	"\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x6C\x69\x6E\x65\x20\x3D\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x21\x3D"\
+	"\x3D\x20\x27\x6C\x61\x62\x65\x6C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x61\x20\x73\x74\x61"\
+	"\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x63"\
+	"\x6F\x70\x65\x5B\x76\x5D\x20\x21\x3D\x3D\x20\x66\x75\x6E\x63\x74\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6F\x75"\
+	"\x74\x20\x6F\x66\x20\x73\x63\x6F\x70\x65\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27\x62\x72\x65"\
+	"\x61\x6B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D"\
+	"\x20\x74\x72\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x63"\
+	"\x6F\x6E\x74\x69\x6E\x75\x65\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x76\x20\x3D\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x27\x28\x62\x72\x65"\
+	"\x61\x6B\x61\x67\x65\x29\x27\x5D\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55"\
+	"\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x68\x69\x73\x2E\x76\x61\x6C\x75\x65"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68\x69\x73\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x6C\x69"\
+	"\x6E\x65\x20\x3D\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E"\
+	"\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x21\x3D\x3D\x20\x27\x6C"\
+	"\x61\x62\x65\x6C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B"\
+	"\x61\x7D\x27\x20\x69\x73\x20\x6E\x6F\x74\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65"\
+	"\x6E\x74\x20\x6C\x61\x62\x65\x6C\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2C\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x63\x6F\x70\x65\x5B"\
+	"\x76\x5D\x20\x21\x3D\x3D\x20\x66\x75\x6E\x63\x74\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
+	"\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6F\x75\x74\x20\x6F\x66"\
+	"\x20\x73\x63\x6F\x70\x65\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C"\
+	"\x20\x76\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74"\
+	"\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69"\
+	"\x66\x20\x28\x21\x66\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29"\
+	"\x27\x5D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61"\
+	"\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B"\
+	"\x61\x7D\x27\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x68"\
+	"\x69\x73\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27"\
+	"\x63\x6F\x6E\x74\x69\x6E\x75\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E"\
+	"\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73"\
+	"\x74\x6D\x74\x28\x27\x72\x65\x74\x75\x72\x6E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69"\
 	"\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x21\x3D\x3D\x20\x27\x3B\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x20\x3D\x3D"\
-	"\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x66\x75\x6E\x63\x74\x5B\x76\x5D\x20\x21\x3D\x3D\x20\x27\x6C\x61\x62\x65\x6C\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x27\x7B\x61\x7D\x27\x20\x69"\
-	"\x73\x20\x6E\x6F\x74\x20\x61\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x6C\x61"\
-	"\x62\x65\x6C\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
-	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x73\x63\x6F\x70\x65\x5B\x76\x5D\x20\x21\x3D"\
-	"\x3D\x20\x66\x75\x6E\x63\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22"\
-	"\x27\x7B\x61\x7D\x27\x20\x69\x73\x20\x6F\x75\x74\x20\x6F\x66\x20\x73\x63\x6F\x70"\
-	"\x65\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x76\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66"\
-	"\x69\x72\x73\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
-	"\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x21\x66"\
-	"\x75\x6E\x63\x74\x5B\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x5D\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
-	"\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x27\x7B\x61\x7D\x27\x2E\x22"\
-	"\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x68\x69\x73\x2E\x76\x61"\
-	"\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27\x63\x6F\x6E\x74\x69"\
-	"\x6E\x75\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
-	"\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20"\
-	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27"\
-	"\x72\x65\x74\x75\x72\x6E\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65"\
-	"\x61\x6B\x28\x74\x68\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27"\
-	"\x28\x72\x65\x67\x65\x78\x70\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x57\x72\x61\x70\x20\x74"\
-	"\x68\x65\x20\x2F\x72\x65\x67\x65\x78\x70\x2F\x20\x6C\x69\x74\x65\x72\x61\x6C\x20"\
-	"\x69\x6E\x20\x70\x61\x72\x65\x6E\x73\x20\x74\x6F\x20\x64\x69\x73\x61\x6D\x62\x69"\
-	"\x67\x75\x61\x74\x65\x20\x74\x68\x65\x20\x73\x6C\x61\x73\x68\x20\x6F\x70\x65\x72"\
-	"\x61\x74\x6F\x72\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
-	"\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x20\x26\x26\x20\x21\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x72\x65\x61\x63\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28\x74"\
-	"\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74"\
-	"\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x61"\
-	"\x63\x68\x61\x62\x6C\x65\x28\x27\x72\x65\x74\x75\x72\x6E\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20"\
-	"\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A"\
-	"\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x74\x68\x72\x6F\x77\x27\x2C\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68\x69\x73\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63\x65\x6E\x74\x28"\
-	"\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72\x73\x74\x20\x3D\x20"\
-	"\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27\x74\x68\x72\x6F\x77"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74"\
-	"\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74"\
-	"\x72\x75\x65\x3B\x0A\x0A\x2F\x2F\x20\x20\x53\x75\x70\x65\x72\x66\x6C\x75\x6F\x75"\
-	"\x73\x20\x72\x65\x73\x65\x72\x76\x65\x64\x20\x77\x6F\x72\x64\x73\x0A\x0A\x20\x20"\
-	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x6C\x61\x73\x73\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x6F\x6E\x73\x74\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x65\x6E\x75\x6D\x27"\
-	"\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x65\x78\x70\x6F"\
-	"\x72\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x65"\
-	"\x78\x74\x65\x6E\x64\x73\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76"\
-	"\x65\x28\x27\x69\x6D\x70\x6F\x72\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73"\
-	"\x65\x72\x76\x65\x28\x27\x73\x75\x70\x65\x72\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x72\x65\x73\x65\x72\x76\x65\x28\x27\x6C\x65\x74\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x72\x65\x73\x65\x72\x76\x65\x28\x27\x79\x69\x65\x6C\x64\x27\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x69\x6D\x70\x6C\x65\x6D\x65\x6E\x74"\
-	"\x73\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x69\x6E"\
-	"\x74\x65\x72\x66\x61\x63\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72"\
-	"\x76\x65\x28\x27\x70\x61\x63\x6B\x61\x67\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x72"\
-	"\x65\x73\x65\x72\x76\x65\x28\x27\x70\x72\x69\x76\x61\x74\x65\x27\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x70\x72\x6F\x74\x65\x63\x74\x65"\
-	"\x64\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x70\x75"\
-	"\x62\x6C\x69\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28"\
-	"\x27\x73\x74\x61\x74\x69\x63\x27\x29\x3B\x0A\x0A\x0A\x2F\x2F\x20\x50\x61\x72\x73"\
-	"\x65\x20\x4A\x53\x4F\x4E\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6A\x73\x6F\x6E\x4F\x62\x6A"\
-	"\x65\x63\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x6F\x20\x3D\x20\x7B\x7D\x2C\x20\x74\x20\x3D\x20\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
-	"\x64\x76\x61\x6E\x63\x65\x28\x27\x7B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x3D\x3D\x3D\x20\x27\x28\x72\x65\x67\x65\x78\x70\x29\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x57"\
+	"\x72\x61\x70\x20\x74\x68\x65\x20\x2F\x72\x65\x67\x65\x78\x70\x2F\x20\x6C\x69\x74"\
+	"\x65\x72\x61\x6C\x20\x69\x6E\x20\x70\x61\x72\x65\x6E\x73\x20\x74\x6F\x20\x64\x69"\
+	"\x73\x61\x6D\x62\x69\x67\x75\x61\x74\x65\x20\x74\x68\x65\x20\x73\x6C\x61\x73\x68"\
+	"\x20\x6F\x70\x65\x72\x61\x74\x6F\x72\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74"\
+	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x3B\x27\x20\x26\x26\x20"\
+	"\x21\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x72\x65\x61\x63\x68\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61\x63"\
+	"\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E"\
+	"\x66\x69\x72\x73\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32"\
+	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27\x72\x65\x74\x75\x72\x6E\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x74\x68"\
+	"\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70\x73\x20\x3D\x20\x74\x72"\
+	"\x75\x65\x3B\x0A\x0A\x0A\x20\x20\x20\x20\x73\x74\x6D\x74\x28\x27\x74\x68\x72\x6F"\
+	"\x77\x27\x2C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x6F\x6C\x69\x6E\x65\x62\x72\x65\x61\x6B\x28\x74\x68"\
+	"\x69\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x6F\x6E\x61\x64\x6A\x61"\
+	"\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x68\x69\x73\x2E\x66\x69\x72"\
+	"\x73\x74\x20\x3D\x20\x65\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x28\x32\x30\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x61\x63\x68\x61\x62\x6C\x65\x28\x27"\
+	"\x74\x68\x72\x6F\x77\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
+	"\x75\x72\x6E\x20\x74\x68\x69\x73\x3B\x0A\x20\x20\x20\x20\x7D\x29\x2E\x65\x78\x70"\
+	"\x73\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x0A\x2F\x2F\x20\x20\x53\x75\x70\x65\x72"\
+	"\x66\x6C\x75\x6F\x75\x73\x20\x72\x65\x73\x65\x72\x76\x65\x64\x20\x77\x6F\x72\x64"\
+	"\x73\x0A\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x6C\x61\x73"\
+	"\x73\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x63\x6F"\
+	"\x6E\x73\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27"\
+	"\x65\x6E\x75\x6D\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28"\
+	"\x27\x65\x78\x70\x6F\x72\x74\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72"\
+	"\x76\x65\x28\x27\x65\x78\x74\x65\x6E\x64\x73\x27\x29\x3B\x0A\x20\x20\x20\x20\x72"\
+	"\x65\x73\x65\x72\x76\x65\x28\x27\x69\x6D\x70\x6F\x72\x74\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x73\x75\x70\x65\x72\x27\x29\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x6C\x65\x74\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x79\x69\x65\x6C\x64\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x69\x6D\x70\x6C"\
+	"\x65\x6D\x65\x6E\x74\x73\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76"\
+	"\x65\x28\x27\x69\x6E\x74\x65\x72\x66\x61\x63\x65\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x72\x65\x73\x65\x72\x76\x65\x28\x27\x70\x61\x63\x6B\x61\x67\x65\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x70\x72\x69\x76\x61\x74\x65"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76\x65\x28\x27\x70\x72\x6F"\
+	"\x74\x65\x63\x74\x65\x64\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x65\x72\x76"\
+	"\x65\x28\x27\x70\x75\x62\x6C\x69\x63\x27\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73"\
+	"\x65\x72\x76\x65\x28\x27\x73\x74\x61\x74\x69\x63\x27\x29\x3B\x0A\x0A\x0A\x2F\x2F"\
+	"\x20\x50\x61\x72\x73\x65\x20\x4A\x53\x4F\x4E\x0A\x0A\x20\x20\x20\x20\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x20\x7B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6A\x73"\
+	"\x6F\x6E\x4F\x62\x6A\x65\x63\x74\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x20\x3D\x20\x7B\x7D\x2C\x20\x74\x20\x3D"\
+	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x7B\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B"\
+	"\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x20\x21\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A"\
+	"\x64\x20\x3D\x3D\x3D\x20\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D"\
-	"\x20\x27\x28\x65\x6E\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F"\
-	"\x72\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x7D\x27\x20\x74\x6F\x20\x6D\x61"\
-	"\x74\x63\x68\x20\x27\x7B\x27\x20\x66\x72\x6F\x6D\x20\x6C\x69\x6E\x65\x20\x7B\x61"\
-	"\x7D\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x2E\x6C\x69\x6E\x65\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65"\
-	"\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64"\
-	"\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E"\
-	"\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D"\
-	"\x61\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65"\
-	"\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x65\x72\x72\x6F\x72\x28\x22\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x7D\x27\x20"\
+	"\x74\x6F\x20\x6D\x61\x74\x63\x68\x20\x27\x7B\x27\x20\x66\x72\x6F\x6D\x20\x6C\x69"\
+	"\x6E\x65\x20\x7B\x61\x7D\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64"\
-	"\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29"\
+	"\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x74\x2E\x6C\x69\x6E\x65\x29"\
 	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x73\x74\x72\x69\x6E\x67\x29\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x45\x78\x70"\
-	"\x65\x63\x74\x65\x64\x20\x61\x20\x73\x74\x72\x69\x6E\x67\x20\x61\x6E\x64\x20\x69"\
-	"\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x7B\x61\x7D\x2E\x22\x2C\x0A\x20\x20"\
+	"\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x7D\x27\x29\x20\x7B\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C"\
-	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64"\
+	"\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x55\x6E\x65\x78\x70"\
+	"\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x28\x73\x74\x72"\
+	"\x69\x6E\x67\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20\x73\x74\x72\x69\x6E\x67\x20"\
+	"\x61\x6E\x64\x20\x69\x6E\x73\x74\x65\x61\x64\x20\x73\x61\x77\x20\x7B\x61\x7D\x2E"\
+	"\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74"\
+	"\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75"\
+	"\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x76\x61\x6C\x75\x65\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x6F\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C"\
-	"\x75\x65\x5D\x20\x3D\x3D\x3D\x20\x74\x72\x75\x65\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x75\x70\x6C\x69\x63"\
+	"\x61\x74\x65\x20\x6B\x65\x79\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x44\x75\x70\x6C\x69\x63\x61\x74\x65\x20\x6B"\
-	"\x65\x79\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76"\
+	"\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27\x5F\x5F\x70\x72\x6F\x74\x6F\x5F\x5F\x27"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x53\x74\x75"\
+	"\x70\x69\x64\x20\x6B\x65\x79\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
-	"\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20"\
-	"\x3D\x3D\x3D\x20\x27\x5F\x5F\x70\x72\x6F\x74\x6F\x5F\x5F\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
+	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20"\
+	"\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x5B\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x76\x61\x6C\x75\x65\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x53\x74\x75\x70\x69\x64\x20\x6B"\
-	"\x65\x79\x20\x27\x7B\x61\x7D\x27\x2E\x22\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
+	"\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27"\
+	"\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x64\x76\x61\x6E\x63\x65\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76"\
+	"\x61\x6E\x63\x65\x28\x27\x7D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6A"\
+	"\x73\x6F\x6E\x41\x72\x72\x61\x79\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
+	"\x6E\x63\x65\x28\x27\x5B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21"\
+	"\x3D\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28"\
+	"\x65\x6E\x64\x29\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22"\
+	"\x4D\x69\x73\x73\x69\x6E\x67\x20\x27\x5D\x27\x20\x74\x6F\x20\x6D\x61\x74\x63\x68"\
+	"\x20\x27\x5B\x27\x20\x66\x72\x6F\x6D\x20\x6C\x69\x6E\x65\x20\x7B\x61\x7D\x2E\x22"\
+	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2C\x20\x74\x2E\x6C\x69\x6E\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D"\
+	"\x3D\x20\x27\x5D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67"\
+	"\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x61\x2E\x22"\
+	"\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65"\
+	"\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74"\
-	"\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20"\
+	"\x65\x72\x72\x6F\x72\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F"\
+	"\x6D\x6D\x61\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65"\
+	"\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20"\
 	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6F\x5B\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61"\
-	"\x6C\x75\x65\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E"\
-	"\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x3A\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78"\
-	"\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63"\
-	"\x65\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28"\
-	"\x27\x7D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x6A\x73\x6F\x6E\x41\x72"\
-	"\x72\x61\x79\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x74\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
-	"\x5B\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x5D"\
-	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x6F\x72\x20\x28\x3B\x3B\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74"\
-	"\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x28\x65\x6E\x64\x29\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x4D\x69\x73\x73\x69"\
-	"\x6E\x67\x20\x27\x5D\x27\x20\x74\x6F\x20\x6D\x61\x74\x63\x68\x20\x27\x5B\x27\x20"\
-	"\x66\x72\x6F\x6D\x20\x6C\x69\x6E\x65\x20\x7B\x61\x7D\x2E\x22\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2C\x20"\
-	"\x74\x2E\x6C\x69\x6E\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28"\
-	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20\x3D\x3D\x3D\x20\x27\x5D\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65"\
-	"\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x61\x2E\x22\x2C\x20\x74\x6F\x6B"\
-	"\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
-	"\x73\x65\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x20"\
-	"\x3D\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72"\
-	"\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20\x63\x6F\x6D\x6D\x61\x2E\x22"\
-	"\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E"\
-	"\x56\x61\x6C\x75\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x2E\x69\x64\x20\x21\x3D\x3D\x20\x27\x2C\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x2C"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x5D\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x77\x69\x74\x63\x68\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69"\
-	"\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7B"\
-	"\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E\x4F"\
-	"\x62\x6A\x65\x63\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65"\
-	"\x20\x27\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73"\
-	"\x6F\x6E\x41\x72\x72\x61\x79\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
-	"\x73\x65\x20\x27\x74\x72\x75\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
-	"\x61\x73\x65\x20\x27\x66\x61\x6C\x73\x65\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x63\x61\x73\x65\x20\x27\x6E\x75\x6C\x6C\x27\x3A\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x61\x73\x65\x20\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x3A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x28\x73\x74\x72\x69\x6E\x67"\
-	"\x29\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62"\
-	"\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27"\
-	"\x2D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61"\
-	"\x6E\x63\x65\x28\x27\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x63\x68\x61\x72\x61\x63\x74\x65"\
-	"\x72\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65\x63\x74\x65\x64\x20"\
-	"\x73\x70\x61\x63\x65\x20\x61\x66\x74\x65\x72\x20\x27\x2D\x27\x2E\x22\x2C\x20\x74"\
-	"\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x6A\x61\x63\x65\x6E"\
-	"\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B"\
+	"\x63\x65\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65"\
-	"\x28\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x28\x27\x5D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61"\
+	"\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6A\x73\x6F\x6E\x4F\x62\x6A\x65\x63\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74\x65\x64\x20\x61\x20"\
-	"\x4A\x53\x4F\x4E\x20\x76\x61\x6C\x75\x65\x2E\x22\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
-	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x0A\x2F\x2F\x20\x54\x68\x65\x20\x61\x63\x74\x75\x61\x6C\x20\x4A\x53"\
-	"\x48\x49\x4E\x54\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69\x74\x73\x65\x6C\x66"\
-	"\x2E\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x69\x74\x73\x65\x6C\x66\x20\x3D\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x73\x2C\x20\x6F\x2C\x20\x67\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x2C\x20\x69\x2C\x20\x6B"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x72\x72"\
-	"\x6F\x72\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
-	"\x65\x64\x65\x66\x69\x6E\x65\x64\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72"\
-	"\x65\x61\x74\x65\x28\x73\x74\x61\x6E\x64\x61\x72\x64\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x6F\x6D\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E"\
-	"\x65\x64\x2C\x20\x67\x20\x7C\x7C\x20\x7B\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6F\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x61\x20\x3D\x20\x6F\x2E\x70\x72\x65\x64\x65\x66\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x41\x72"\
-	"\x72\x61\x79\x2E\x69\x73\x41\x72\x72\x61\x79\x28\x61\x29\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F"\
-	"\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x61\x2E\x6C\x65\x6E\x67"\
-	"\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72"\
-	"\x65\x64\x65\x66\x69\x6E\x65\x64\x5B\x61\x5B\x69\x5D\x5D\x20\x3D\x20\x74\x72\x75"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x61"\
-	"\x20\x3D\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6B\x20\x3D"\
-	"\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x28\x61\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
-	"\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x6B\x2E\x6C\x65\x6E\x67\x74"\
-	"\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x5B\x6B\x5B\x69\x5D\x5D\x20\x3D\x20\x21\x21\x61\x5B"\
-	"\x6B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x6F"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20"\
-	"\x7B\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x20\x7C\x7C\x20\x34\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x65\x72\x72\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x65\x72\x72\x20\x7C\x7C\x20\x35"\
-	"\x30\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x61\x62\x20\x3D\x20\x27\x27"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30"\
-	"\x3B\x20\x69\x20\x3C\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B"\
-	"\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x74\x61\x62\x20\x2B\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20"\
-	"\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x67\x6C\x6F\x62\x61\x6C\x20"\
-	"\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x70\x72\x65\x64"\
-	"\x65\x66\x69\x6E\x65\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F"\
-	"\x70\x65\x20\x3D\x20\x67\x6C\x6F\x62\x61\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x75\x6E\x63\x74\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x3A\x20\x74\x72\x75\x65\x2C"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x6E\x61\x6D\x65\x29"\
-	"\x27\x3A\x20\x27\x28\x67\x6C\x6F\x62\x61\x6C\x29\x27\x2C\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x27\x28\x73\x63\x6F\x70\x65\x29\x27\x3A\x20\x73\x63"\
-	"\x6F\x70\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x62"\
-	"\x72\x65\x61\x6B\x61\x67\x65\x29\x27\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x27\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x3A\x20\x30"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x3D\x20\x5B\x66\x75\x6E\x63\x74\x5D\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x75\x72\x6C\x73\x20\x3D\x20\x5B\x5D\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x72\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x63\x6B\x20\x3D\x20\x6E\x75\x6C"\
-	"\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x20\x3D\x20"\
-	"\x7B\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x73\x4F"\
-	"\x6E\x6C\x79\x20\x3D\x20\x6E\x75\x6C\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x6D\x70\x6C\x69\x65\x64\x20\x3D\x20\x7B\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x6E\x62\x6C\x6F\x63\x6B\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6C\x6F\x6F\x6B\x61\x68\x65\x61\x64\x20\x3D\x20\x5B"\
-	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x20"\
-	"\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72"\
-	"\x6E\x69\x6E\x67\x73\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
-	"\x65\x78\x2E\x69\x6E\x69\x74\x28\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x70\x72\x65\x72\x65\x67\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x74\x72\x69\x63\x74\x5F\x6D\x6F\x64\x65\x20\x3D\x20\x66\x61\x6C"\
-	"\x73\x65\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x76\x74\x6F\x6B"\
-	"\x65\x6E\x20\x3D\x20\x74\x6F\x6B\x65\x6E\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B"\
-	"\x65\x6E\x20\x3D\x20\x73\x79\x6E\x74\x61\x78\x5B\x27\x28\x62\x65\x67\x69\x6E\x29"\
-	"\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x61\x73\x73\x75\x6D\x65\x28\x29"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x74\x72\x79\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28"\
-	"\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x2E\x6C\x61\x78\x62\x72\x65\x61\x6B\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E"\
-	"\x6D\x6F\x64\x65\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72"\
-	"\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66"\
-	"\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75"\
-	"\x65\x20\x3D\x3D\x3D\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x2E\x67\x6C\x6F\x62\x61\x6C"\
-	"\x73\x74\x72\x69\x63\x74\x29\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28"\
-	"\x22\x55\x73\x65\x20\x74\x68\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x66\x6F"\
-	"\x72\x6D\x20\x6F\x66\x20\x5C\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x5C\x22"\
-	"\x2E\x22\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x75\x73\x65\x5F\x73\x74\x72\x69\x63\x74\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x73\x28\x27\x6C\x69\x62\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6A\x73\x6F\x6E\x41\x72\x72\x61\x79\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x74\x72\x75\x65\x27\x3A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x66\x61\x6C\x73\x65\x27\x3A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x6E\x75\x6C\x6C\x27\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x28\x6E\x75\x6D\x62\x65\x72"\
+	"\x29\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x61\x73\x65\x20\x27\x28\x73"\
+	"\x74\x72\x69\x6E\x67\x29\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x61\x73\x65\x20\x27\x2D\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27\x2D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x6F\x6B\x65\x6E\x2E\x63\x68\x61"\
+	"\x72\x61\x63\x74\x65\x72\x20\x21\x3D\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E"\
+	"\x2E\x66\x72\x6F\x6D\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x6E\x65\x78\x70\x65"\
+	"\x63\x74\x65\x64\x20\x73\x70\x61\x63\x65\x20\x61\x66\x74\x65\x72\x20\x27\x2D\x27"\
+	"\x2E\x22\x2C\x20\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x28\x27\x28\x65\x6E\x64\x29\x27\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x20\x63\x61\x74\x63\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x65\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48\x49\x4E"\
-	"\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x70\x75\x73\x68\x28\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x61\x73"\
-	"\x6F\x6E\x20\x20\x20\x20\x3A\x20\x65\x2E\x6D\x65\x73\x73\x61\x67\x65\x2C\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C"\
-	"\x69\x6E\x65\x20\x20\x20\x20\x20\x20\x3A\x20\x65\x2E\x6C\x69\x6E\x65\x20\x7C\x7C"\
-	"\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61"\
-	"\x72\x61\x63\x74\x65\x72\x20\x3A\x20\x65\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72"\
-	"\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x20\x6E\x75"\
-	"\x6C\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74"\
-	"\x75\x72\x6E\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x6C\x65"\
-	"\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x0A"\
-	"\x0A\x2F\x2F\x20\x44\x61\x74\x61\x20\x73\x75\x6D\x6D\x61\x72\x79\x2E\x0A\x0A\x20"\
-	"\x20\x20\x20\x69\x74\x73\x65\x6C\x66\x2E\x64\x61\x74\x61\x20\x3D\x20\x66\x75\x6E"\
-	"\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x76\x61\x72\x20\x64\x61\x74\x61\x20\x3D\x20\x7B\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
-	"\x73\x3A\x20\x5B\x5D\x7D\x2C\x20\x66\x75\x2C\x20\x67\x6C\x6F\x62\x61\x6C\x73\x2C"\
-	"\x20\x69\x6D\x70\x6C\x69\x65\x64\x73\x20\x3D\x20\x5B\x5D\x2C\x20\x66\x2C\x20\x69"\
-	"\x2C\x20\x6A\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D"\
-	"\x62\x65\x72\x73\x20\x3D\x20\x5B\x5D\x2C\x20\x6E\x2C\x20\x75\x6E\x75\x73\x65\x64"\
-	"\x20\x3D\x20\x5B\x5D\x2C\x20\x76\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x69\x74\x73\x65\x6C\x66\x2E\x65\x72\x72\x6F\x72\x73\x2E\x6C\x65\x6E\x67"\
-	"\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61"\
-	"\x74\x61\x2E\x65\x72\x72\x6F\x72\x73\x20\x3D\x20\x69\x74\x73\x65\x6C\x66\x2E\x65"\
-	"\x72\x72\x6F\x72\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x6A"\
-	"\x73\x6F\x6E\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20\x69\x6E"\
-	"\x20\x69\x6D\x70\x6C\x69\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E\x28\x69\x6D\x70\x6C\x69"\
-	"\x65\x64\x2C\x20\x6E\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x6D\x70\x6C\x69\x65\x64\x73\x2E\x70\x75\x73\x68\x28"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x61\x6D\x65\x3A\x20\x6E\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x69\x6D\x70"\
-	"\x6C\x69\x65\x64\x5B\x6E\x5D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x69\x6D\x70\x6C\x69\x65\x64\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20"\
-	"\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64"\
-	"\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x20\x3D\x20\x69\x6D\x70\x6C\x69"\
-	"\x65\x64\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x75\x72\x6C\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20"\
-	"\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64"\
-	"\x61\x74\x61\x2E\x75\x72\x6C\x73\x20\x3D\x20\x75\x72\x6C\x73\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x67\x6C\x6F\x62"\
-	"\x61\x6C\x73\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x28\x73\x63"\
-	"\x6F\x70\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x67\x6C"\
-	"\x6F\x62\x61\x6C\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x67\x6C\x6F"\
-	"\x62\x61\x6C\x73\x20\x3D\x20\x67\x6C\x6F\x62\x61\x6C\x73\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
-	"\x69\x20\x3D\x20\x31\x3B\x20\x69\x20\x3C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73"\
-	"\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x73\x5B\x69\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x66\x75\x20\x3D\x20\x7B\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6F\x72\x20\x28\x6A\x20\x3D\x20\x30\x3B\x20\x6A\x20\x3C\x20\x66\x75"\
-	"\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20"\
-	"\x6A\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x75\x5B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69"\
-	"\x74\x79\x5B\x6A\x5D\x5D\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x6F\x72\x20\x28\x6E\x20\x69\x6E\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E"\
-	"\x28\x66\x2C\x20\x6E\x29\x20\x26\x26\x20\x6E\x2E\x63\x68\x61\x72\x41\x74\x28\x30"\
-	"\x29\x20\x21\x3D\x3D\x20\x27\x28\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x20\x3D\x20\x66\x5B\x6E"\
-	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x76\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x20\x3D\x20\x27\x75\x6E\x75\x73\x65"\
-	"\x64\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x41\x72\x72\x61\x79\x2E\x69\x73\x41\x72"\
-	"\x72\x61\x79\x28\x66\x75\x5B\x76\x5D\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75"\
-	"\x5B\x76\x5D\x2E\x70\x75\x73\x68\x28\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x76\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x75\x73\x65\x64\x27\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x75\x6E\x75\x73\x65\x64\x2E\x70\x75\x73\x68\x28\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x3A\x20\x6E"\
-	"\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20"\
-	"\x66\x5B\x27\x28\x6C\x69\x6E\x65\x29\x27\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x20\x66\x5B\x27"\
-	"\x28\x6E\x61\x6D\x65\x29\x27\x5D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B"\
+	"\x6A\x61\x63\x65\x6E\x74\x28\x74\x6F\x6B\x65\x6E\x2C\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64"\
+	"\x76\x61\x6E\x63\x65\x28\x27\x28\x6E\x75\x6D\x62\x65\x72\x29\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x6F\x72\x28\x22\x45\x78\x70\x65\x63\x74"\
+	"\x65\x64\x20\x61\x20\x4A\x53\x4F\x4E\x20\x76\x61\x6C\x75\x65\x2E\x22\x2C\x20\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x2F\x2F\x20\x54\x68\x65\x20\x61\x63\x74\x75"\
+	"\x61\x6C\x20\x4A\x53\x48\x49\x4E\x54\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x69"\
+	"\x74\x73\x65\x6C\x66\x2E\x0A\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x69\x74\x73\x65"\
+	"\x6C\x66\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x73\x2C\x20\x6F\x2C"\
+	"\x20\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x2C"\
+	"\x20\x69\x2C\x20\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48\x49\x4E"\
+	"\x54\x2E\x65\x72\x72\x6F\x72\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x72\x75\x6C\x65\x73\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73\x74\x5F\x6F\x75\x74\x65\x72\x20\x3D"\
+	"\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x73"\
+	"\x74\x5F\x69\x6E\x6E\x65\x72\x20\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65"\
+	"\x64\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x73\x74"\
+	"\x61\x6E\x64\x61\x72\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6D"\
+	"\x62\x69\x6E\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x2C\x20\x67\x20\x7C"\
+	"\x7C\x20\x7B\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20"\
+	"\x6F\x2E\x70\x72\x65\x64\x65\x66\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x61\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x41\x72\x72\x61\x79\x2E\x69\x73\x41"\
+	"\x72\x72\x61\x79\x28\x61\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20"\
+	"\x30\x3B\x20\x69\x20\x3C\x20\x61\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B"\
+	"\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65"\
+	"\x64\x5B\x61\x5B\x69\x5D\x5D\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65"\
+	"\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x61\x20\x3D\x3D\x3D\x20\x27\x6F"\
+	"\x62\x6A\x65\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6B\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74"\
+	"\x2E\x6B\x65\x79\x73\x28\x61\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30"\
+	"\x3B\x20\x69\x20\x3C\x20\x6B\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D"\
+	"\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64"\
+	"\x5B\x6B\x5B\x69\x5D\x5D\x20\x3D\x20\x21\x21\x61\x5B\x6B\x5D\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x7B\x7D\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E"\
+	"\x64\x65\x6E\x74\x20\x7C\x7C\x20\x34\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x6D\x61\x78\x65\x72\x72\x20\x3D\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x6D\x61\x78\x65\x72\x72\x20\x7C\x7C\x20\x35\x30\x3B\x0A\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x74\x61\x62\x20\x3D\x20\x27\x27\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x6F"\
+	"\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x6E\x74\x3B\x20\x69\x20\x2B\x3D\x20\x31"\
+	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x74\x61\x62\x20"\
+	"\x2B\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x69\x6E\x64\x65\x6E\x74\x20\x3D\x20\x31\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x67\x6C\x6F\x62\x61\x6C\x20\x3D\x20\x4F\x62\x6A\x65\x63"\
+	"\x74\x2E\x63\x72\x65\x61\x74\x65\x28\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x63\x6F\x70\x65\x20\x3D\x20\x67\x6C"\
+	"\x6F\x62\x61\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x20"\
+	"\x3D\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x67\x6C"\
+	"\x6F\x62\x61\x6C\x29\x27\x3A\x20\x74\x72\x75\x65\x2C\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x27\x28\x6E\x61\x6D\x65\x29\x27\x3A\x20\x27\x28\x67\x6C"\
+	"\x6F\x62\x61\x6C\x29\x27\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x27\x28\x73\x63\x6F\x70\x65\x29\x27\x3A\x20\x73\x63\x6F\x70\x65\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x28\x62\x72\x65\x61\x6B\x61\x67\x65"\
+	"\x29\x27\x3A\x20\x30\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27"\
+	"\x28\x6C\x6F\x6F\x70\x61\x67\x65\x29\x27\x3A\x20\x30\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F"\
+	"\x6E\x73\x20\x3D\x20\x5B\x66\x75\x6E\x63\x74\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x75\x72\x6C\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x73\x72\x63\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x73\x74\x61\x63\x6B\x20\x3D\x20\x6E\x75\x6C\x6C\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x20\x3D\x20\x7B\x7D\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x73\x4F\x6E\x6C\x79\x20\x3D\x20\x6E"\
+	"\x75\x6C\x6C\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6D\x70\x6C\x69\x65\x64"\
+	"\x20\x3D\x20\x7B\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x6E\x62\x6C\x6F"\
+	"\x63\x6B\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6C\x6F\x6F\x6B\x61\x68\x65\x61\x64\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x20\x3D\x20\x66\x61\x6C\x73\x65"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x73\x20\x3D"\
+	"\x20\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x65\x78\x2E\x69\x6E\x69\x74"\
+	"\x28\x73\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x70\x72\x65\x72\x65\x67\x20"\
+	"\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x69"\
+	"\x63\x74\x5F\x6D\x6F\x64\x65\x20\x3D\x20\x66\x61\x6C\x73\x65\x3B\x0A\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x70\x72\x65\x76\x74\x6F\x6B\x65\x6E\x20\x3D\x20\x74\x6F"\
+	"\x6B\x65\x6E\x20\x3D\x20\x6E\x65\x78\x74\x74\x6F\x6B\x65\x6E\x20\x3D\x20\x73\x79"\
+	"\x6E\x74\x61\x78\x5B\x27\x28\x62\x65\x67\x69\x6E\x29\x27\x5D\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x61\x73\x73\x75\x6D\x65\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x74\x72\x79\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x73\x77\x69\x74\x63\x68\x20\x28\x6E\x65\x78\x74\x74\x6F\x6B"\
+	"\x65\x6E\x2E\x69\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x61\x73\x65\x20\x27\x7B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x63\x61\x73\x65\x20\x27\x5B\x27\x3A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x61\x78\x62"\
+	"\x72\x65\x61\x6B\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x20\x3D\x20"\
+	"\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6A\x73\x6F\x6E\x56\x61\x6C\x75\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x66\x61\x75\x6C\x74\x3A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6E"\
+	"\x65\x78\x74\x74\x6F\x6B\x65\x6E\x2E\x76\x61\x6C\x75\x65\x20\x3D\x3D\x3D\x20\x27"\
+	"\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21"\
+	"\x6F\x70\x74\x69\x6F\x6E\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x74\x72\x69\x63\x74\x29"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6A\x20"\
-	"\x3D\x20\x30\x3B\x20\x6A\x20\x3C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69"\
-	"\x74\x79\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x6A\x20\x2B\x3D\x20\x31\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
-	"\x28\x66\x75\x5B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x5B\x6A\x5D"\
-	"\x5D\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65"\
-	"\x6C\x65\x74\x65\x20\x66\x75\x5B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74"\
-	"\x79\x5B\x6A\x5D\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x2E\x6E\x61\x6D\x65\x20\x3D"\
-	"\x20\x66\x5B\x27\x28\x6E\x61\x6D\x65\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x66\x75\x2E\x70\x61\x72\x61\x6D\x20\x3D\x20\x66\x5B\x27"\
-	"\x28\x70\x61\x72\x61\x6D\x73\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x66\x75\x2E\x6C\x69\x6E\x65\x20\x3D\x20\x66\x5B\x27\x28\x6C\x69"\
-	"\x6E\x65\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
-	"\x75\x2E\x6C\x61\x73\x74\x20\x3D\x20\x66\x5B\x27\x28\x6C\x61\x73\x74\x29\x27\x5D"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2E\x70\x75\x73\x68\x28\x66\x75\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x75\x6E\x75\x73\x65\x64\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E"\
-	"\x75\x6E\x75\x73\x65\x64\x20\x3D\x20\x75\x6E\x75\x73\x65\x64\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62"\
-	"\x65\x72\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F"\
-	"\x72\x20\x28\x6E\x20\x69\x6E\x20\x6D\x65\x6D\x62\x65\x72\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66"\
-	"\x20\x6D\x65\x6D\x62\x65\x72\x5B\x6E\x5D\x20\x3D\x3D\x3D\x20\x27\x6E\x75\x6D\x62"\
-	"\x65\x72\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x64\x61\x74\x61\x2E\x6D\x65\x6D\x62\x65\x72\x20\x3D\x20\x6D\x65\x6D"\
-	"\x62\x65\x72\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x62\x72\x65\x61\x6B\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x64\x61\x74\x61\x3B\x0A\x20\x20\x20\x20\x7D\x3B"\
-	"\x0A\x0A\x20\x20\x20\x20\x69\x74\x73\x65\x6C\x66\x2E\x72\x65\x70\x6F\x72\x74\x20"\
-	"\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x6F\x70\x74\x69\x6F\x6E\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x64\x61\x74\x61\x20\x3D"\
-	"\x20\x69\x74\x73\x65\x6C\x66\x2E\x64\x61\x74\x61\x28\x29\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x76\x61\x72\x20\x61\x20\x3D\x20\x5B\x5D\x2C\x20\x63\x2C\x20"\
-	"\x65\x2C\x20\x65\x72\x72\x2C\x20\x66\x2C\x20\x69\x2C\x20\x6B\x2C\x20\x6C\x2C\x20"\
-	"\x6D\x20\x3D\x20\x27\x27\x2C\x20\x6E\x2C\x20\x6F\x20\x3D\x20\x5B\x5D\x2C\x20\x73"\
-	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20"\
-	"\x64\x65\x74\x61\x69\x6C\x28\x68\x2C\x20\x61\x72\x72\x61\x79\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x69\x2C"\
-	"\x20\x73\x69\x6E\x67\x75\x6C\x61\x72\x69\x74\x79\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x72\x61\x79\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73"\
-	"\x68\x28\x27\x3C\x64\x69\x76\x3E\x3C\x69\x3E\x27\x20\x2B\x20\x68\x20\x2B\x20\x27"\
-	"\x3C\x2F\x69\x3E\x20\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x61\x72\x72\x61\x79\x20\x3D\x20\x61\x72\x72\x61\x79\x2E\x73"\
-	"\x6F\x72\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x61"\
-	"\x72\x72\x61\x79\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x69\x66\x20\x28\x61\x72\x72\x61\x79\x5B\x69\x5D\x20\x21\x3D\x3D\x20"\
-	"\x73\x69\x6E\x67\x75\x6C\x61\x72\x69\x74\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
-	"\x69\x6E\x67\x75\x6C\x61\x72\x69\x74\x79\x20\x3D\x20\x61\x72\x72\x61\x79\x5B\x69"\
-	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x28\x62\x20\x3F\x20\x27"\
-	"\x2C\x20\x27\x20\x3A\x20\x27\x27\x29\x20\x2B\x20\x73\x69\x6E\x67\x75\x6C\x61\x72"\
-	"\x69\x74\x79\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x77\x61\x72\x6E\x69\x6E\x67\x28\x22\x55\x73\x65\x20\x74\x68"\
+	"\x65\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x66\x6F\x72\x6D\x20\x6F\x66\x20\x5C"\
+	"\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x5C\x22\x2E\x22\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x75\x73"\
+	"\x65\x5F\x73\x74\x72\x69\x63\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x28\x27\x6C\x69"\
+	"\x62\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x64\x76\x61\x6E\x63\x65\x28\x27"\
+	"\x28\x65\x6E\x64\x29\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x63"\
+	"\x61\x74\x63\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72"\
+	"\x73\x2E\x70\x75\x73\x68\x28\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x61\x73\x6F\x6E\x20\x20\x20\x20\x3A"\
+	"\x20\x65\x2E\x6D\x65\x73\x73\x61\x67\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x20\x20\x20\x20"\
+	"\x20\x20\x3A\x20\x65\x2E\x6C\x69\x6E\x65\x20\x7C\x7C\x20\x6E\x65\x78\x74\x74\x6F"\
+	"\x6B\x65\x6E\x2E\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20"\
+	"\x3A\x20\x65\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x7C\x7C\x20\x6E\x65\x78"\
+	"\x74\x74\x6F\x6B\x65\x6E\x2E\x66\x72\x6F\x6D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x2C\x20\x6E\x75\x6C\x6C\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x4A\x53\x48"\
+	"\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3D\x3D"\
+	"\x3D\x20\x30\x3B\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x0A\x0A\x2F\x2F\x20\x44\x61\x74"\
+	"\x61\x20\x73\x75\x6D\x6D\x61\x72\x79\x2E\x0A\x0A\x20\x20\x20\x20\x69\x74\x73\x65"\
+	"\x6C\x66\x2E\x64\x61\x74\x61\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28"\
+	"\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61\x72\x20\x64\x61\x74"\
+	"\x61\x20\x3D\x20\x7B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x3A\x20\x5B\x5D\x7D\x2C"\
+	"\x20\x66\x75\x2C\x20\x67\x6C\x6F\x62\x61\x6C\x73\x2C\x20\x69\x6D\x70\x6C\x69\x65"\
+	"\x64\x73\x20\x3D\x20\x5B\x5D\x2C\x20\x66\x2C\x20\x69\x2C\x20\x6A\x2C\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x73\x20\x3D\x20"\
+	"\x5B\x5D\x2C\x20\x6E\x2C\x20\x75\x6E\x75\x73\x65\x64\x20\x3D\x20\x5B\x5D\x2C\x20"\
+	"\x76\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x74\x73\x65\x6C"\
+	"\x66\x2E\x65\x72\x72\x6F\x72\x73\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x65\x72\x72\x6F"\
+	"\x72\x73\x20\x3D\x20\x69\x74\x73\x65\x6C\x66\x2E\x65\x72\x72\x6F\x72\x73\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x6A\x73\x6F\x6E\x6D\x6F\x64\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x6A\x73\x6F\x6E\x20\x3D\x20\x74"\
+	"\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20\x69\x6E\x20\x69\x6D\x70\x6C\x69\x65"\
+	"\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x69\x73\x5F\x6F\x77\x6E\x28\x69\x6D\x70\x6C\x69\x65\x64\x2C\x20\x6E\x29\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x6D\x70\x6C\x69\x65\x64\x73\x2E\x70\x75\x73\x68\x28\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x3A"\
+	"\x20\x6E\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x69\x6D\x70\x6C\x69\x65\x64\x5B\x6E\x5D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x6D\x70"\
+	"\x6C\x69\x65\x64\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x69\x6D\x70"\
+	"\x6C\x69\x65\x64\x73\x20\x3D\x20\x69\x6D\x70\x6C\x69\x65\x64\x73\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x75\x72\x6C\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x75\x72\x6C"\
+	"\x73\x20\x3D\x20\x75\x72\x6C\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x3D\x20\x4F"\
+	"\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x28\x73\x63\x6F\x70\x65\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x67\x6C\x6F\x62\x61\x6C\x73\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x20\x3D\x20"\
+	"\x67\x6C\x6F\x62\x61\x6C\x73\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x31\x3B\x20"\
+	"\x69\x20\x3C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x20\x3D\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x5B\x69\x5D"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x20\x3D\x20\x7B"\
+	"\x7D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
+	"\x6A\x20\x3D\x20\x30\x3B\x20\x6A\x20\x3C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69"\
+	"\x63\x69\x74\x79\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x6A\x20\x2B\x3D\x20\x31\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x75\x5B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x5B\x6A\x5D\x5D\x20"\
+	"\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20\x69"\
+	"\x6E\x20\x66\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x69\x73\x5F\x6F\x77\x6E\x28\x66\x2C\x20\x6E\x29\x20"\
+	"\x26\x26\x20\x6E\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x21\x3D\x3D\x20\x27"\
+	"\x28\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x76\x20\x3D\x20\x66\x5B\x6E\x5D\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x76\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x63\x74\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75"\
-	"\x73\x68\x28\x27\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x65\x72\x72"\
-	"\x6F\x72\x73\x20\x7C\x7C\x20\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73"\
-	"\x20\x7C\x7C\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x72\x72\x20\x3D\x20\x74\x72\x75"\
-	"\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73"\
-	"\x68\x28\x27\x3C\x64\x69\x76\x20\x69\x64\x3D\x65\x72\x72\x6F\x72\x73\x3E\x3C\x69"\
-	"\x3E\x45\x72\x72\x6F\x72\x3A\x3C\x2F\x69\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x65\x72\x72\x6F"\
-	"\x72\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x64\x61"\
-	"\x74\x61\x2E\x65\x72\x72\x6F\x72\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20"\
-	"\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x20\x3D\x20\x64\x61\x74\x61\x2E\x65\x72\x72"\
-	"\x6F\x72\x73\x5B\x69\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x65\x20\x3D\x20\x63\x2E\x65\x76\x69\x64\x65\x6E\x63\x65\x20\x7C\x7C\x20\x27"\
-	"\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x50\x72"\
-	"\x6F\x62\x6C\x65\x6D\x27\x20\x2B\x20\x28\x69\x73\x46\x69\x6E\x69\x74\x65\x28\x63"\
-	"\x2E\x6C\x69\x6E\x65\x29\x20\x3F\x20\x27\x20\x61\x74\x20\x6C\x69\x6E\x65\x20\x27"\
-	"\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x2E\x6C\x69\x6E"\
-	"\x65\x20\x2B\x20\x27\x20\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x27\x20\x2B\x20"\
-	"\x63\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x20\x3A\x20\x27\x27\x29\x20\x2B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x3A\x20\x27\x20\x2B\x20\x63"\
-	"\x2E\x72\x65\x61\x73\x6F\x6E\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x28\x29\x20"\
-	"\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x3C\x2F\x70\x3E\x3C"\
-	"\x70\x20\x63\x6C\x61\x73\x73\x3D\x65\x76\x69\x64\x65\x6E\x63\x65\x3E\x27\x20\x2B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x65\x20\x26\x26\x20\x28"\
-	"\x65\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x38\x30\x20\x3F\x20\x65\x2E\x73\x6C"\
-	"\x69\x63\x65\x28\x30\x2C\x20\x37\x37\x29\x20\x2B\x20\x27\x2E\x2E\x2E\x27\x20\x3A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x29\x2E\x65\x6E\x74\x69"\
-	"\x74\x79\x69\x66\x79\x28\x29\x29\x20\x2B\x20\x27\x3C\x2F\x70\x3E\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x76\x20\x3D\x20\x27\x75\x6E\x75\x73\x65\x64\x27\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x41\x72\x72\x61\x79\x2E\x69\x73\x41\x72\x72\x61\x79\x28\x66\x75\x5B"\
+	"\x76\x5D\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x5B\x76\x5D\x2E\x70\x75\x73"\
+	"\x68\x28\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x76\x20\x3D\x3D\x3D\x20"\
+	"\x27\x75\x6E\x75\x73\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x75\x6E\x75\x73\x65\x64\x2E\x70\x75\x73\x68\x28\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6E\x61\x6D\x65\x3A\x20\x6E\x2C\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6C\x69\x6E\x65\x3A\x20\x66\x5B\x27\x28\x6C\x69\x6E"\
+	"\x65\x29\x27\x5D\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x66"\
+	"\x75\x6E\x63\x74\x69\x6F\x6E\x27\x3A\x20\x66\x5B\x27\x28\x6E\x61\x6D\x65\x29\x27"\
+	"\x5D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C"\
-	"\x69\x65\x64\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20"\
-	"\x69\x20\x3C\x20\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x2E\x6C\x65"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6A\x20\x3D\x20\x30\x3B\x20\x6A\x20"\
+	"\x3C\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x2E\x6C\x65\x6E\x67"\
+	"\x74\x68\x3B\x20\x6A\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x66\x75\x5B\x66\x75\x6E"\
+	"\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x5B\x6A\x5D\x5D\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x20\x3D\x3D\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x6C\x65\x74\x65\x20\x66\x75"\
+	"\x5B\x66\x75\x6E\x63\x74\x69\x6F\x6E\x69\x63\x69\x74\x79\x5B\x6A\x5D\x5D\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x75\x2E\x6E\x61\x6D\x65\x20\x3D\x20\x66\x5B\x27\x28\x6E\x61"\
+	"\x6D\x65\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66"\
+	"\x75\x2E\x70\x61\x72\x61\x6D\x20\x3D\x20\x66\x5B\x27\x28\x70\x61\x72\x61\x6D\x73"\
+	"\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x2E"\
+	"\x6C\x69\x6E\x65\x20\x3D\x20\x66\x5B\x27\x28\x6C\x69\x6E\x65\x29\x27\x5D\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x75\x2E\x6C\x61\x73\x74\x20"\
+	"\x3D\x20\x66\x5B\x27\x28\x6C\x61\x73\x74\x29\x27\x5D\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x73\x2E\x70\x75\x73\x68\x28\x66\x75\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x75\x6E\x75\x73\x65"\
+	"\x64\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x20"\
+	"\x3D\x20\x75\x6E\x75\x73\x65\x64\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x65\x6D\x62\x65\x72\x73\x20\x3D\x20\x5B"\
+	"\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x6E\x20\x69\x6E"\
+	"\x20\x6D\x65\x6D\x62\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x6D\x65\x6D\x62\x65\x72"\
+	"\x5B\x6E\x5D\x20\x3D\x3D\x3D\x20\x27\x6E\x75\x6D\x62\x65\x72\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61"\
+	"\x2E\x6D\x65\x6D\x62\x65\x72\x20\x3D\x20\x6D\x65\x6D\x62\x65\x72\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x62\x72\x65\x61\x6B\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x64\x61\x74\x61\x3B\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x0A\x20\x20\x20\x20\x69"\
+	"\x74\x73\x65\x6C\x66\x2E\x72\x65\x70\x6F\x72\x74\x20\x3D\x20\x66\x75\x6E\x63\x74"\
+	"\x69\x6F\x6E\x20\x28\x6F\x70\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x76\x61\x72\x20\x64\x61\x74\x61\x20\x3D\x20\x69\x74\x73\x65\x6C\x66"\
+	"\x2E\x64\x61\x74\x61\x28\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x76\x61"\
+	"\x72\x20\x61\x20\x3D\x20\x5B\x5D\x2C\x20\x63\x2C\x20\x65\x2C\x20\x65\x72\x72\x2C"\
+	"\x20\x66\x2C\x20\x69\x2C\x20\x6B\x2C\x20\x6C\x2C\x20\x6D\x20\x3D\x20\x27\x27\x2C"\
+	"\x20\x6E\x2C\x20\x6F\x20\x3D\x20\x5B\x5D\x2C\x20\x73\x3B\x0A\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64\x65\x74\x61\x69\x6C\x28"\
+	"\x68\x2C\x20\x61\x72\x72\x61\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x76\x61\x72\x20\x62\x2C\x20\x69\x2C\x20\x73\x69\x6E\x67\x75\x6C"\
+	"\x61\x72\x69\x74\x79\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x61\x72\x72\x61\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x64\x69\x76"\
+	"\x3E\x3C\x69\x3E\x27\x20\x2B\x20\x68\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x20\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61\x72"\
+	"\x72\x61\x79\x20\x3D\x20\x61\x72\x72\x61\x79\x2E\x73\x6F\x72\x74\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20"\
+	"\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x61\x72\x72\x61\x79\x2E\x6C\x65"\
 	"\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x69\x5D"\
-	"\x20\x3D\x20\x27\x3C\x63\x6F\x64\x65\x3E\x27\x20\x2B\x20\x64\x61\x74\x61\x2E\x69"\
-	"\x6D\x70\x6C\x69\x65\x64\x73\x5B\x69\x5D\x2E\x6E\x61\x6D\x65\x20\x2B\x20\x27\x3C"\
-	"\x2F\x63\x6F\x64\x65\x3E\x26\x6E\x62\x73\x70\x3B\x3C\x69\x3E\x27\x20\x2B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28"\
+	"\x61\x72\x72\x61\x79\x5B\x69\x5D\x20\x21\x3D\x3D\x20\x73\x69\x6E\x67\x75\x6C\x61"\
+	"\x72\x69\x74\x79\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x69\x6E\x67\x75\x6C\x61\x72"\
+	"\x69\x74\x79\x20\x3D\x20\x61\x72\x72\x61\x79\x5B\x69\x5D\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x5B\x69\x5D\x2E"\
-	"\x6C\x69\x6E\x65\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x27\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E"\
-	"\x3C\x69\x3E\x49\x6D\x70\x6C\x69\x65\x64\x20\x67\x6C\x6F\x62\x61\x6C\x3A\x3C\x2F"\
-	"\x69\x3E\x20\x27\x20\x2B\x20\x73\x2E\x6A\x6F\x69\x6E\x28\x27\x2C\x20\x27\x29\x20"\
-	"\x2B\x20\x27\x3C\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x5B\x5D\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72"\
-	"\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x64\x61\x74\x61\x2E\x75\x6E"\
-	"\x75\x73\x65\x64\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x73\x5B\x69\x5D\x20\x3D\x20\x27\x3C\x63\x6F\x64\x65\x3E\x3C\x75\x3E"\
-	"\x27\x20\x2B\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x5B\x69\x5D\x2E\x6E"\
-	"\x61\x6D\x65\x20\x2B\x20\x27\x3C\x2F\x75\x3E\x3C\x2F\x63\x6F\x64\x65\x3E\x26\x6E"\
-	"\x62\x73\x70\x3B\x3C\x69\x3E\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E"\
-	"\x75\x6E\x75\x73\x65\x64\x5B\x69\x5D\x2E\x6C\x69\x6E\x65\x20\x2B\x20\x27\x3C\x2F"\
-	"\x69\x3E\x20\x3C\x63\x6F\x64\x65\x3E\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74"\
-	"\x61\x2E\x75\x6E\x75\x73\x65\x64\x5B\x69\x5D\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x27\x5D\x20\x2B\x20\x27\x3C\x2F\x63\x6F\x64\x65\x3E\x27\x3B\x0A\x20\x20\x20"\
+	"\x6F\x2E\x70\x75\x73\x68\x28\x28\x62\x20\x3F\x20\x27\x2C\x20\x27\x20\x3A\x20\x27"\
+	"\x27\x29\x20\x2B\x20\x73\x69\x6E\x67\x75\x6C\x61\x72\x69\x74\x79\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x62\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C"\
-	"\x70\x3E\x3C\x69\x3E\x55\x6E\x75\x73\x65\x64\x20\x76\x61\x72\x69\x61\x62\x6C\x65"\
-	"\x3A\x3C\x2F\x69\x3E\x20\x27\x20\x2B\x20\x73\x2E\x6A\x6F\x69\x6E\x28\x27\x2C\x20"\
-	"\x27\x29\x20\x2B\x20\x27\x3C\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x6A\x73\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28"\
-	"\x27\x3C\x70\x3E\x4A\x53\x4F\x4E\x3A\x20\x62\x61\x64\x2E\x3C\x2F\x70\x3E\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x2F\x64\x69"\
-	"\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x29\x20\x7B\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28"\
-	"\x27\x3C\x62\x72\x3E\x3C\x64\x69\x76\x20\x69\x64\x3D\x66\x75\x6E\x63\x74\x69\x6F"\
-	"\x6E\x73\x3E\x27\x29\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x75\x72\x6C\x73\x29\x20\x7B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28"\
-	"\x22\x55\x52\x4C\x73\x3C\x62\x72\x3E\x22\x2C\x20\x64\x61\x74\x61\x2E\x75\x72\x6C"\
-	"\x73\x2C\x20\x27\x3C\x62\x72\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
-	"\x66\x20\x28\x64\x61\x74\x61\x2E\x6A\x73\x6F\x6E\x20\x26\x26\x20\x21\x65\x72\x72"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x4A\x53\x4F\x4E\x3A\x20\x67\x6F\x6F"\
-	"\x64\x2E\x3C\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x67\x6C"\
-	"\x6F\x62\x61\x6C\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x64\x69\x76\x3E\x3C\x69"\
-	"\x3E\x47\x6C\x6F\x62\x61\x6C\x3C\x2F\x69\x3E\x20\x27\x20\x2B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x64\x61\x74\x61\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x2E\x73\x6F\x72\x74\x28\x29\x2E"\
-	"\x6A\x6F\x69\x6E\x28\x27\x2C\x20\x27\x29\x20\x2B\x20\x27\x3C\x2F\x64\x69\x76\x3E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C"\
-	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x64\x69\x76\x3E\x3C\x69\x3E\x4E\x6F\x20"\
-	"\x6E\x65\x77\x20\x67\x6C\x6F\x62\x61\x6C\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x73"\
-	"\x20\x69\x6E\x74\x72\x6F\x64\x75\x63\x65\x64\x2E\x3C\x2F\x69\x3E\x3C\x2F\x64\x69"\
-	"\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20"\
-	"\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x64\x61\x74\x61\x2E\x66\x75\x6E\x63\x74\x69"\
-	"\x6F\x6E\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20"\
-	"\x3D\x20\x64\x61\x74\x61\x2E\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x5B\x69\x5D\x3B"\
-	"\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E"\
-	"\x70\x75\x73\x68\x28\x27\x3C\x62\x72\x3E\x3C\x64\x69\x76\x20\x63\x6C\x61\x73\x73"\
-	"\x3D\x66\x75\x6E\x63\x74\x69\x6F\x6E\x3E\x3C\x69\x3E\x27\x20\x2B\x20\x66\x2E\x6C"\
-	"\x69\x6E\x65\x20\x2B\x20\x27\x2D\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x2E\x6C\x61"\
-	"\x73\x74\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x20\x27\x20\x2B\x20\x28\x66\x2E\x6E\x61"\
-	"\x6D\x65\x20\x7C\x7C\x20\x27\x27\x29\x20\x2B\x20\x27\x28\x27\x20\x2B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x28\x66\x2E\x70\x61\x72\x61\x6D\x20\x3F\x20\x66\x2E\x70\x61\x72\x61\x6D"\
-	"\x2E\x6A\x6F\x69\x6E\x28\x27\x2C\x20\x27\x29\x20\x3A\x20\x27\x27\x29\x20\x2B\x20"\
-	"\x27\x29\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x3C\x62\x69\x67"\
-	"\x3E\x3C\x62\x3E\x55\x6E\x75\x73\x65\x64\x3C\x2F\x62\x3E\x3C\x2F\x62\x69\x67\x3E"\
-	"\x27\x2C\x20\x66\x2E\x75\x6E\x75\x73\x65\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x43\x6C"\
-	"\x6F\x73\x75\x72\x65\x27\x2C\x20\x66\x2E\x63\x6C\x6F\x73\x75\x72\x65\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61"\
-	"\x69\x6C\x28\x27\x56\x61\x72\x69\x61\x62\x6C\x65\x27\x2C\x20\x66\x5B\x27\x76\x61"\
-	"\x72\x27\x5D\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x45\x78\x63\x65\x70\x74\x69\x6F\x6E\x27"\
-	"\x2C\x20\x66\x2E\x65\x78\x63\x65\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27"\
-	"\x4F\x75\x74\x65\x72\x27\x2C\x20\x66\x2E\x6F\x75\x74\x65\x72\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C"\
-	"\x28\x27\x47\x6C\x6F\x62\x61\x6C\x27\x2C\x20\x66\x2E\x67\x6C\x6F\x62\x61\x6C\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65"\
-	"\x74\x61\x69\x6C\x28\x27\x4C\x61\x62\x65\x6C\x27\x2C\x20\x66\x2E\x6C\x61\x62\x65"\
-	"\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E"\
-	"\x6D\x65\x6D\x62\x65\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79"\
-	"\x73\x28\x64\x61\x74\x61\x2E\x6D\x65\x6D\x62\x65\x72\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x2E\x6C\x65"\
-	"\x6E\x67\x74\x68\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x61\x20\x3D\x20\x61\x2E\x73\x6F\x72\x74\x28\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6D\x20\x3D\x20\x27\x3C\x62\x72\x3E\x3C\x70\x72\x65\x20\x69\x64\x3D\x6D"\
-	"\x65\x6D\x62\x65\x72\x73\x3E\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x73\x20\x27\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x2F\x64"\
+	"\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x65\x72\x72\x6F\x72\x73\x20\x7C\x7C\x20"\
+	"\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x20\x7C\x7C\x20\x64\x61\x74"\
+	"\x61\x2E\x75\x6E\x75\x73\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x65\x72\x72\x20\x3D\x20\x74\x72\x75\x65\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x64\x69\x76"\
+	"\x20\x69\x64\x3D\x65\x72\x72\x6F\x72\x73\x3E\x3C\x69\x3E\x45\x72\x72\x6F\x72\x3A"\
+	"\x3C\x2F\x69\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x65\x72\x72\x6F\x72\x73\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28"\
+	"\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x64\x61\x74\x61\x2E\x65\x72\x72\x6F"\
+	"\x72\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x63\x20\x3D\x20\x64\x61\x74\x61\x2E\x65\x72\x72\x6F\x72\x73\x5B\x69\x5D\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x69\x66\x20\x28\x63\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x65\x20\x3D\x20\x63\x2E"\
+	"\x65\x76\x69\x64\x65\x6E\x63\x65\x20\x7C\x7C\x20\x27\x27\x3B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x6C\x20\x3D\x20\x31\x30\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20"\
-	"\x69\x20\x3C\x20\x61\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x6B\x20\x3D\x20\x61\x5B\x69\x5D\x3B\x0A\x20\x20"\
+	"\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x50\x72\x6F\x62\x6C\x65\x6D\x27\x20"\
+	"\x2B\x20\x28\x69\x73\x46\x69\x6E\x69\x74\x65\x28\x63\x2E\x6C\x69\x6E\x65\x29\x20"\
+	"\x3F\x20\x27\x20\x61\x74\x20\x6C\x69\x6E\x65\x20\x27\x20\x2B\x0A\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x6E\x20\x3D\x20\x6B\x2E\x6E\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x63\x2E\x6C\x69\x6E\x65\x20\x2B\x20\x27\x20\x63"\
+	"\x68\x61\x72\x61\x63\x74\x65\x72\x20\x27\x20\x2B\x20\x63\x2E\x63\x68\x61\x72\x61"\
+	"\x63\x74\x65\x72\x20\x3A\x20\x27\x27\x29\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x6C\x20\x2B\x20\x6E\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x37"\
-	"\x32\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28"\
-	"\x6D\x20\x2B\x20\x27\x3C\x62\x72\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x27\x3A\x20\x27\x20\x2B\x20\x63\x2E\x72\x65\x61\x73\x6F\x6E"\
+	"\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x28\x29\x20\x2B\x0A\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6D\x20\x3D\x20\x27\x20\x20\x20\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x27\x3C\x2F\x70\x3E\x3C\x70\x20\x63\x6C\x61\x73\x73"\
+	"\x3D\x65\x76\x69\x64\x65\x6E\x63\x65\x3E\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x6C\x20\x3D\x20\x31\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20"\
-	"\x2B\x3D\x20\x6E\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2B\x20\x32\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x28\x65\x20\x26\x26\x20\x28\x65\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x20\x3E\x20\x38\x30\x20\x3F\x20\x65\x2E\x73\x6C\x69\x63\x65\x28\x30\x2C\x20"\
+	"\x37\x37\x29\x20\x2B\x20\x27\x2E\x2E\x2E\x27\x20\x3A\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x6D\x65\x6D\x62\x65\x72\x5B\x6B\x5D\x20"\
-	"\x3D\x3D\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x20\x3D"\
-	"\x20\x27\x3C\x69\x3E\x27\x20\x2B\x20\x6E\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x27\x3B"\
+	"\x20\x20\x20\x20\x20\x20\x65\x29\x2E\x65\x6E\x74\x69\x74\x79\x69\x66\x79\x28\x29"\
+	"\x29\x20\x2B\x20\x27\x3C\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x20\x3D"\
+	"\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x64\x61\x74"\
+	"\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69"\
+	"\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x69\x5D\x20\x3D\x20\x27\x3C\x63\x6F"\
+	"\x64\x65\x3E\x27\x20\x2B\x20\x64\x61\x74\x61\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73"\
+	"\x5B\x69\x5D\x2E\x6E\x61\x6D\x65\x20\x2B\x20\x27\x3C\x2F\x63\x6F\x64\x65\x3E\x26"\
+	"\x6E\x62\x73\x70\x3B\x3C\x69\x3E\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61"\
+	"\x2E\x69\x6D\x70\x6C\x69\x65\x64\x73\x5B\x69\x5D\x2E\x6C\x69\x6E\x65\x20\x2B\x20"\
+	"\x27\x3C\x2F\x69\x3E\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x3C\x69\x3E\x49\x6D\x70\x6C"\
+	"\x69\x65\x64\x20\x67\x6C\x6F\x62\x61\x6C\x3A\x3C\x2F\x69\x3E\x20\x27\x20\x2B\x20"\
+	"\x73\x2E\x6A\x6F\x69\x6E\x28\x27\x2C\x20\x27\x29\x20\x2B\x20\x27\x3C\x2F\x70\x3E"\
+	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E"\
+	"\x75\x6E\x75\x73\x65\x64\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x73\x20\x3D\x20\x5B\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30"\
+	"\x3B\x20\x69\x20\x3C\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x2E\x6C\x65"\
+	"\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x5B\x69\x5D"\
+	"\x20\x3D\x20\x27\x3C\x63\x6F\x64\x65\x3E\x3C\x75\x3E\x27\x20\x2B\x20\x64\x61\x74"\
+	"\x61\x2E\x75\x6E\x75\x73\x65\x64\x5B\x69\x5D\x2E\x6E\x61\x6D\x65\x20\x2B\x20\x27"\
+	"\x3C\x2F\x75\x3E\x3C\x2F\x63\x6F\x64\x65\x3E\x26\x6E\x62\x73\x70\x3B\x3C\x69\x3E"\
+	"\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65\x64\x5B"\
+	"\x69\x5D\x2E\x6C\x69\x6E\x65\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x20\x3C\x63\x6F\x64"\
+	"\x65\x3E\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x75\x6E\x75\x73\x65"\
+	"\x64\x5B\x69\x5D\x5B\x27\x66\x75\x6E\x63\x74\x69\x6F\x6E\x27\x5D\x20\x2B\x20\x27"\
+	"\x3C\x2F\x63\x6F\x64\x65\x3E\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x3C\x69\x3E\x55\x6E"\
+	"\x75\x73\x65\x64\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x3A\x3C\x2F\x69\x3E\x20\x27"\
+	"\x20\x2B\x20\x73\x2E\x6A\x6F\x69\x6E\x28\x27\x2C\x20\x27\x29\x20\x2B\x20\x27\x3C"\
+	"\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74"\
+	"\x61\x2E\x6A\x73\x6F\x6E\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x70\x3E\x4A\x53\x4F"\
+	"\x4E\x3A\x20\x62\x61\x64\x2E\x3C\x2F\x70\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66"\
+	"\x20\x28\x21\x6F\x70\x74\x69\x6F\x6E\x29\x20\x7B\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x62\x72\x3E\x3C\x64"\
+	"\x69\x76\x20\x69\x64\x3D\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x3E\x27\x29\x3B\x0A"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74"\
+	"\x61\x2E\x75\x72\x6C\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x22\x55\x52\x4C\x73\x3C\x62"\
+	"\x72\x3E\x22\x2C\x20\x64\x61\x74\x61\x2E\x75\x72\x6C\x73\x2C\x20\x27\x3C\x62\x72"\
+	"\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61"\
+	"\x2E\x6A\x73\x6F\x6E\x20\x26\x26\x20\x21\x65\x72\x72\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28"\
+	"\x27\x3C\x70\x3E\x4A\x53\x4F\x4E\x3A\x20\x67\x6F\x6F\x64\x2E\x3C\x2F\x70\x3E\x27"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
+	"\x65\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x67\x6C\x6F\x62\x61\x6C\x73\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E"\
+	"\x70\x75\x73\x68\x28\x27\x3C\x64\x69\x76\x3E\x3C\x69\x3E\x47\x6C\x6F\x62\x61\x6C"\
+	"\x3C\x2F\x69\x3E\x20\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x74\x61\x2E\x67\x6C"\
+	"\x6F\x62\x61\x6C\x73\x2E\x73\x6F\x72\x74\x28\x29\x2E\x6A\x6F\x69\x6E\x28\x27\x2C"\
+	"\x20\x27\x29\x20\x2B\x20\x27\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68"\
+	"\x28\x27\x3C\x64\x69\x76\x3E\x3C\x69\x3E\x4E\x6F\x20\x6E\x65\x77\x20\x67\x6C\x6F"\
+	"\x62\x61\x6C\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x73\x20\x69\x6E\x74\x72\x6F\x64"\
+	"\x75\x63\x65\x64\x2E\x3C\x2F\x69\x3E\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20"\
+	"\x3C\x20\x64\x61\x74\x61\x2E\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x2E\x6C\x65\x6E"\
+	"\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x20\x3D\x20\x64\x61\x74\x61\x2E"\
+	"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x5B\x69\x5D\x3B\x0A\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C"\
+	"\x62\x72\x3E\x3C\x64\x69\x76\x20\x63\x6C\x61\x73\x73\x3D\x66\x75\x6E\x63\x74\x69"\
+	"\x6F\x6E\x3E\x3C\x69\x3E\x27\x20\x2B\x20\x66\x2E\x6C\x69\x6E\x65\x20\x2B\x20\x27"\
+	"\x2D\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x66\x2E\x6C\x61\x73\x74\x20\x2B\x20\x27\x3C"\
+	"\x2F\x69\x3E\x20\x27\x20\x2B\x20\x28\x66\x2E\x6E\x61\x6D\x65\x20\x7C\x7C\x20\x27"\
+	"\x27\x29\x20\x2B\x20\x27\x28\x27\x20\x2B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x28\x66\x2E\x70\x61"\
+	"\x72\x61\x6D\x20\x3F\x20\x66\x2E\x70\x61\x72\x61\x6D\x2E\x6A\x6F\x69\x6E\x28\x27"\
+	"\x2C\x20\x27\x29\x20\x3A\x20\x27\x27\x29\x20\x2B\x20\x27\x29\x3C\x2F\x64\x69\x76"\
+	"\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x3C\x62\x69\x67\x3E\x3C\x62\x3E\x55\x6E\x75"\
+	"\x73\x65\x64\x3C\x2F\x62\x3E\x3C\x2F\x62\x69\x67\x3E\x27\x2C\x20\x66\x2E\x75\x6E"\
+	"\x75\x73\x65\x64\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x43\x6C\x6F\x73\x75\x72\x65\x27\x2C"\
+	"\x20\x66\x2E\x63\x6C\x6F\x73\x75\x72\x65\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x56\x61\x72"\
+	"\x69\x61\x62\x6C\x65\x27\x2C\x20\x66\x5B\x27\x76\x61\x72\x27\x5D\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69"\
+	"\x6C\x28\x27\x45\x78\x63\x65\x70\x74\x69\x6F\x6E\x27\x2C\x20\x66\x2E\x65\x78\x63"\
+	"\x65\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x4F\x75\x74\x65\x72\x27\x2C"\
+	"\x20\x66\x2E\x6F\x75\x74\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x47\x6C\x6F\x62\x61"\
+	"\x6C\x27\x2C\x20\x66\x2E\x67\x6C\x6F\x62\x61\x6C\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x64\x65\x74\x61\x69\x6C\x28\x27\x4C"\
+	"\x61\x62\x65\x6C\x27\x2C\x20\x66\x2E\x6C\x61\x62\x65\x6C\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61\x74\x61\x2E\x6D\x65\x6D\x62\x65\x72\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x61"\
+	"\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x28\x64\x61\x74\x61\x2E"\
+	"\x6D\x65\x6D\x62\x65\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x2E\x6C\x65\x6E\x67\x74\x68\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x61\x20\x3D\x20\x61\x2E\x73\x6F\x72\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x20\x3D\x20\x27"\
+	"\x3C\x62\x72\x3E\x3C\x70\x72\x65\x20\x69\x64\x3D\x6D\x65\x6D\x62\x65\x72\x73\x3E"\
+	"\x2F\x2A\x6D\x65\x6D\x62\x65\x72\x73\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x31\x30\x3B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x66\x6F\x72\x20\x28\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x61\x2E\x6C"\
+	"\x65\x6E\x67\x74\x68\x3B\x20\x69\x20\x2B\x3D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x6B\x20\x3D\x20\x61\x5B\x69\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x20\x3D\x20\x6B"\
+	"\x2E\x6E\x61\x6D\x65\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6C\x20\x2B"\
+	"\x20\x6E\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x37\x32\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x6D\x20\x2B\x20\x27\x3C\x62"\
+	"\x72\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x20\x3D\x20\x27\x20"\
+	"\x20\x20\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x3D\x20\x31\x3B"\
 	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3C\x20\x61"\
-	"\x2E\x6C\x65\x6E\x67\x74\x68\x20\x2D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x6E\x20\x2B\x3D\x20\x27\x2C\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6C\x20\x2B\x3D\x20\x6E\x2E\x6C\x65"\
+	"\x6E\x67\x74\x68\x20\x2B\x20\x32\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x64\x61"\
+	"\x74\x61\x2E\x6D\x65\x6D\x62\x65\x72\x5B\x6B\x5D\x20\x3D\x3D\x3D\x20\x31\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x20\x3D\x20\x27\x3C\x69\x3E\x27\x20"\
+	"\x2B\x20\x6E\x20\x2B\x20\x27\x3C\x2F\x69\x3E\x27\x3B\x0A\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x6D\x20\x2B\x3D\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68"\
-	"\x28\x6D\x20\x2B\x20\x27\x3C\x62\x72\x3E\x2A\x2F\x3C\x2F\x70\x72\x65\x3E\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75"\
-	"\x73\x68\x28\x27\x3C\x2F\x64\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x20\x6F\x2E\x6A\x6F\x69\x6E\x28"\
-	"\x27\x27\x29\x3B\x0A\x20\x20\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x69\x74\x73\x65"\
-	"\x6C\x66\x2E\x6A\x73\x68\x69\x6E\x74\x20\x3D\x20\x69\x74\x73\x65\x6C\x66\x3B\x0A"\
-	"\x0A\x20\x20\x20\x20\x69\x74\x73\x65\x6C\x66\x2E\x65\x64\x69\x74\x69\x6F\x6E\x20"\
-	"\x3D\x20\x27\x32\x30\x31\x31\x2D\x30\x34\x2D\x31\x36\x27\x3B\x0A\x0A\x20\x20\x20"\
-	"\x20\x72\x65\x74\x75\x72\x6E\x20\x69\x74\x73\x65\x6C\x66\x3B\x0A\x0A\x7D\x28\x29"\
-	"\x29\x3B\x0A\x0A\x2F\x2F\x20\x4D\x61\x6B\x65\x20\x4A\x53\x48\x49\x4E\x54\x20\x61"\
-	"\x20\x4E\x6F\x64\x65\x20\x6D\x6F\x64\x75\x6C\x65\x2C\x20\x69\x66\x20\x70\x6F\x73"\
-	"\x73\x69\x62\x6C\x65\x2E\x0A\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x65\x78"\
-	"\x70\x6F\x72\x74\x73\x20\x3D\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x20\x26\x26"\
-	"\x20\x65\x78\x70\x6F\x72\x74\x73\x29\x0A\x20\x20\x20\x20\x65\x78\x70\x6F\x72\x74"\
-	"\x73\x2E\x4A\x53\x48\x49\x4E\x54\x20\x3D\x20\x4A\x53\x48\x49\x4E\x54\x3B\x0A\x76"\
-	"\x61\x72\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x27\x61\x73\x69\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x75\x74"\
-	"\x6F\x6D\x61\x74\x69\x63\x20\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x20\x69\x6E\x73"\
-	"\x65\x72\x74\x69\x6F\x6E\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C"\
-	"\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x62\x69\x74\x77\x69\x73"\
-	"\x65\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x62\x69\x74\x77\x69\x73"\
-	"\x65\x20\x6F\x70\x65\x72\x61\x74\x6F\x72\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E"\
-	"\x6F\x74\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20"\
-	"\x27\x62\x6F\x73\x73\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x64"\
-	"\x76\x61\x6E\x63\x65\x64\x20\x75\x73\x61\x67\x65\x20\x6F\x66\x20\x61\x73\x73\x69"\
-	"\x67\x6E\x6D\x65\x6E\x74\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C"\
-	"\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x62\x72\x6F\x77\x73\x65\x72"\
-	"\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x73\x74\x61"\
-	"\x6E\x64\x61\x72\x64\x20\x62\x72\x6F\x77\x73\x65\x72\x20\x67\x6C\x6F\x62\x61\x6C"\
-	"\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E"\
-	"\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x63\x6F\x75\x63\x68\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x43\x6F\x75\x63\x68\x44\x42\x20\x67\x6C\x6F\x62"\
-	"\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66"\
-	"\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x63\x75\x72\x6C\x79\x27\x3A\x20"\
-	"\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x63\x75\x72\x6C\x79\x20\x62\x72\x61\x63"\
-	"\x65\x73\x20\x61\x72\x6F\x75\x6E\x64\x20\x62\x6C\x6F\x63\x6B\x73\x20\x73\x68\x6F"\
-	"\x75\x6C\x64\x20\x62\x65\x20\x72\x65\x71\x75\x69\x72\x65\x64\x20\x28\x65\x76\x65"\
-	"\x6E\x20\x69\x6E\x20\x69\x66\x2F\x66\x6F\x72\x2F\x77\x68\x69\x6C\x65\x29\x27\x2C"\
-	"\x0A\x20\x20\x20\x20\x27\x64\x65\x62\x75\x67\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
-	"\x20\x69\x66\x20\x64\x65\x62\x75\x67\x67\x65\x72\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65"\
-	"\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x64\x65\x76\x65\x6C\x27\x3A\x20\x27\x20\x74"\
-	"\x72\x75\x65\x20\x69\x66\x20\x6C\x6F\x67\x67\x69\x6E\x67\x20\x67\x6C\x6F\x62\x61"\
-	"\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69"\
-	"\x6E\x65\x64\x20\x28\x63\x6F\x6E\x73\x6F\x6C\x65\x2C\x20\x61\x6C\x65\x72\x74\x2C"\
-	"\x20\x65\x74\x63\x2E\x29\x27\x2C\x0A\x20\x20\x20\x20\x27\x64\x6F\x6A\x6F\x27\x3A"\
-	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x44\x6F\x6A\x6F\x20\x54\x6F\x6F\x6C"\
-	"\x6B\x69\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62"\
-	"\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27"\
-	"\x65\x71\x65\x71\x65\x71\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x3D"\
-	"\x3D\x3D\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x72\x65\x71\x75\x69\x72\x65"\
-	"\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x65\x71\x6E\x75\x6C\x6C\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x3D\x3D\x20\x6E\x75\x6C\x6C\x20\x63\x6F\x6D\x70"\
-	"\x61\x72\x69\x73\x6F\x6E\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F"\
-	"\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x65\x73\x35\x27\x3A"\
-	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x45\x53\x35\x20\x73\x79\x6E\x74\x61"\
-	"\x78\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27"\
-	"\x2C\x0A\x20\x20\x20\x20\x27\x65\x76\x69\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
-	"\x20\x69\x66\x20\x65\x76\x61\x6C\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61"\
-	"\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x65\x78\x70\x72\x27\x3A"\
-	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x45\x78\x70\x72\x65\x73\x73\x69\x6F"\
-	"\x6E\x53\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65"\
-	"\x20\x61\x6C\x6C\x6F\x77\x65\x64\x20\x61\x73\x20\x50\x72\x6F\x67\x72\x61\x6D\x73"\
-	"\x27\x2C\x0A\x20\x20\x20\x20\x27\x66\x6F\x72\x69\x6E\x27\x3A\x20\x27\x20\x74\x72"\
-	"\x75\x65\x20\x69\x66\x20\x66\x6F\x72\x20\x69\x6E\x20\x73\x74\x61\x74\x65\x6D\x65"\
-	"\x6E\x74\x73\x20\x6D\x75\x73\x74\x20\x66\x69\x6C\x74\x65\x72\x27\x2C\x0A\x20\x20"\
-	"\x20\x20\x27\x67\x6C\x6F\x62\x61\x6C\x73\x74\x72\x69\x63\x74\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x67\x6C\x6F\x62\x61\x6C\x20\x22\x75\x73\x65\x20"\
-	"\x73\x74\x72\x69\x63\x74\x22\x3B\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61"\
-	"\x6C\x6C\x6F\x77\x65\x64\x20\x28\x61\x6C\x73\x6F\x20\x65\x6E\x61\x62\x6C\x65\x73"\
-	"\x20\x5C\x27\x73\x74\x72\x69\x63\x74\x5C\x27\x29\x27\x2C\x0A\x20\x20\x20\x20\x27"\
-	"\x69\x6D\x6D\x65\x64\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x69\x6D"\
-	"\x6D\x65\x64\x69\x61\x74\x65\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x73\x20"\
-	"\x6D\x75\x73\x74\x20\x62\x65\x20\x77\x72\x61\x70\x70\x65\x64\x20\x69\x6E\x20\x70"\
-	"\x61\x72\x65\x6E\x73\x27\x2C\x0A\x20\x20\x20\x20\x27\x6A\x71\x75\x65\x72\x79\x27"\
-	"\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x6A\x51\x75\x65\x72\x79\x20\x67"\
-	"\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6C\x61\x74\x65\x64"\
-	"\x65\x66\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x75"\
-	"\x73\x65\x20\x62\x65\x66\x6F\x72\x65\x20\x64\x65\x66\x69\x6E\x69\x74\x69\x6F\x6E"\
-	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x74\x6F\x6C\x65\x72"\
-	"\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6C\x61\x78\x62\x72\x65\x61\x6B"\
-	"\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x6C\x69\x6E\x65\x20\x62\x72"\
-	"\x65\x61\x6B\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x63"\
-	"\x68\x65\x63\x6B\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6C\x6F\x6F\x70\x66\x75"\
-	"\x6E\x63\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77"\
-	"\x65\x64\x20\x74\x6F\x20\x62\x65\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x77\x69\x74"\
-	"\x68\x69\x6E\x20\x6C\x6F\x6F\x70\x73\x27\x2C\x0A\x20\x20\x20\x20\x27\x6D\x6F\x6F"\
-	"\x74\x6F\x6F\x6C\x73\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x4D\x6F"\
-	"\x6F\x54\x6F\x6F\x6C\x73\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C"\
+	"\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3C\x20\x61\x2E\x6C\x65\x6E\x67\x74\x68"\
+	"\x20\x2D\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6E\x20\x2B\x3D"\
+	"\x20\x27\x2C\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6D\x20\x2B"\
+	"\x3D\x20\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x6D\x20\x2B\x20\x27\x3C"\
+	"\x62\x72\x3E\x2A\x2F\x3C\x2F\x70\x72\x65\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x2E\x70\x75\x73\x68\x28\x27\x3C\x2F\x64"\
+	"\x69\x76\x3E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x72"\
+	"\x65\x74\x75\x72\x6E\x20\x6F\x2E\x6A\x6F\x69\x6E\x28\x27\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x7D\x3B\x0A\x20\x20\x20\x20\x69\x74\x73\x65\x6C\x66\x2E\x6A\x73\x68\x69"\
+	"\x6E\x74\x20\x3D\x20\x69\x74\x73\x65\x6C\x66\x3B\x0A\x0A\x20\x20\x20\x20\x69\x74"\
+	"\x73\x65\x6C\x66\x2E\x65\x64\x69\x74\x69\x6F\x6E\x20\x3D\x20\x27\x32\x30\x31\x31"\
+	"\x2D\x30\x34\x2D\x31\x36\x27\x3B\x0A\x0A\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E"\
+	"\x20\x69\x74\x73\x65\x6C\x66\x3B\x0A\x0A\x7D\x28\x29\x29\x3B\x0A\x0A\x2F\x2F\x20"\
+	"\x4D\x61\x6B\x65\x20\x4A\x53\x48\x49\x4E\x54\x20\x61\x20\x4E\x6F\x64\x65\x20\x6D"\
+	"\x6F\x64\x75\x6C\x65\x2C\x20\x69\x66\x20\x70\x6F\x73\x73\x69\x62\x6C\x65\x2E\x0A"\
+	"\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x65\x78\x70\x6F\x72\x74\x73\x20\x3D"\
+	"\x3D\x20\x27\x6F\x62\x6A\x65\x63\x74\x27\x20\x26\x26\x20\x65\x78\x70\x6F\x72\x74"\
+	"\x73\x29\x0A\x20\x20\x20\x20\x65\x78\x70\x6F\x72\x74\x73\x2E\x4A\x53\x48\x49\x4E"\
+	"\x54\x20\x3D\x20\x4A\x53\x48\x49\x4E\x54\x3B\x0A\x76\x61\x72\x20\x73\x65\x74\x74"\
+	"\x69\x6E\x67\x73\x20\x3D\x20\x7B\x0A\x20\x20\x20\x20\x27\x61\x73\x69\x27\x3A\x20"\
+	"\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x75\x74\x6F\x6D\x61\x74\x69\x63\x20"\
+	"\x73\x65\x6D\x69\x63\x6F\x6C\x6F\x6E\x20\x69\x6E\x73\x65\x72\x74\x69\x6F\x6E\x20"\
+	"\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27"\
+	"\x2C\x0A\x20\x20\x20\x20\x27\x62\x69\x74\x77\x69\x73\x65\x27\x3A\x20\x27\x20\x74"\
+	"\x72\x75\x65\x20\x69\x66\x20\x62\x69\x74\x77\x69\x73\x65\x20\x6F\x70\x65\x72\x61"\
+	"\x74\x6F\x72\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x61"\
+	"\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x62\x6F\x73\x73\x27\x3A"\
+	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x64\x76\x61\x6E\x63\x65\x64\x20"\
+	"\x75\x73\x61\x67\x65\x20\x6F\x66\x20\x61\x73\x73\x69\x67\x6E\x6D\x65\x6E\x74\x73"\
+	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C"\
+	"\x0A\x20\x20\x20\x20\x27\x62\x72\x6F\x77\x73\x65\x72\x27\x3A\x20\x27\x20\x74\x72"\
+	"\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x73\x74\x61\x6E\x64\x61\x72\x64\x20\x62"\
+	"\x72\x6F\x77\x73\x65\x72\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C"\
 	"\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20"\
-	"\x20\x20\x27\x6E\x65\x77\x63\x61\x70\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69"\
-	"\x66\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72\x20\x6E\x61\x6D\x65\x73\x20"\
-	"\x6D\x75\x73\x74\x20\x62\x65\x20\x63\x61\x70\x69\x74\x61\x6C\x69\x7A\x65\x64\x27"\
-	"\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x61\x72\x67\x27\x3A\x20\x27\x20\x74\x72\x75"\
-	"\x65\x20\x69\x66\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x73\x2E\x63\x61\x6C\x6C\x65"\
-	"\x72\x20\x61\x6E\x64\x20\x61\x72\x67\x75\x6D\x65\x6E\x74\x73\x2E\x63\x61\x6C\x6C"\
-	"\x65\x65\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x69\x73\x61\x6C\x6C\x6F"\
-	"\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x64\x65\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x4E\x6F\x64\x65\x2E\x6A\x73\x20"\
-	"\x65\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20"\
+	"\x20\x20\x27\x63\x6F\x75\x63\x68\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66"\
+	"\x20\x43\x6F\x75\x63\x68\x44\x42\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F"\
+	"\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A"\
+	"\x20\x20\x20\x20\x27\x63\x75\x72\x6C\x79\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20"\
+	"\x69\x66\x20\x63\x75\x72\x6C\x79\x20\x62\x72\x61\x63\x65\x73\x20\x61\x72\x6F\x75"\
+	"\x6E\x64\x20\x62\x6C\x6F\x63\x6B\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20"\
+	"\x72\x65\x71\x75\x69\x72\x65\x64\x20\x28\x65\x76\x65\x6E\x20\x69\x6E\x20\x69\x66"\
+	"\x2F\x66\x6F\x72\x2F\x77\x68\x69\x6C\x65\x29\x27\x2C\x0A\x20\x20\x20\x20\x27\x64"\
+	"\x65\x62\x75\x67\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x64\x65\x62"\
+	"\x75\x67\x67\x65\x72\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x20\x73\x68\x6F"\
+	"\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20"\
+	"\x20\x27\x64\x65\x76\x65\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20"\
+	"\x6C\x6F\x67\x67\x69\x6E\x67\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75"\
+	"\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x20\x28\x63\x6F"\
+	"\x6E\x73\x6F\x6C\x65\x2C\x20\x61\x6C\x65\x72\x74\x2C\x20\x65\x74\x63\x2E\x29\x27"\
+	"\x2C\x0A\x20\x20\x20\x20\x27\x64\x6F\x6A\x6F\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
+	"\x20\x69\x66\x20\x44\x6F\x6A\x6F\x20\x54\x6F\x6F\x6C\x6B\x69\x74\x20\x67\x6C\x6F"\
+	"\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65"\
+	"\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x65\x71\x65\x71\x65\x71\x27"\
+	"\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x3D\x3D\x3D\x20\x73\x68\x6F\x75"\
+	"\x6C\x64\x20\x62\x65\x20\x72\x65\x71\x75\x69\x72\x65\x64\x27\x2C\x0A\x20\x20\x20"\
+	"\x20\x27\x65\x71\x6E\x75\x6C\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66"\
+	"\x20\x3D\x3D\x20\x6E\x75\x6C\x6C\x20\x63\x6F\x6D\x70\x61\x72\x69\x73\x6F\x6E\x73"\
+	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64"\
+	"\x27\x2C\x0A\x20\x20\x20\x20\x27\x65\x73\x35\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
+	"\x20\x69\x66\x20\x45\x53\x35\x20\x73\x79\x6E\x74\x61\x78\x20\x73\x68\x6F\x75\x6C"\
+	"\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27"\
+	"\x65\x76\x69\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x65\x76\x61"\
+	"\x6C\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27"\
+	"\x2C\x0A\x20\x20\x20\x20\x27\x65\x78\x70\x72\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
+	"\x20\x69\x66\x20\x45\x78\x70\x72\x65\x73\x73\x69\x6F\x6E\x53\x74\x61\x74\x65\x6D"\
+	"\x65\x6E\x74\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65"\
+	"\x64\x20\x61\x73\x20\x50\x72\x6F\x67\x72\x61\x6D\x73\x27\x2C\x0A\x20\x20\x20\x20"\
+	"\x27\x66\x6F\x72\x69\x6E\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x66"\
+	"\x6F\x72\x20\x69\x6E\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x73\x20\x6D\x75\x73"\
+	"\x74\x20\x66\x69\x6C\x74\x65\x72\x27\x2C\x0A\x20\x20\x20\x20\x27\x67\x6C\x6F\x62"\
+	"\x61\x6C\x73\x74\x72\x69\x63\x74\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66"\
+	"\x20\x67\x6C\x6F\x62\x61\x6C\x20\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x22"\
+	"\x3B\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x20"\
+	"\x28\x61\x6C\x73\x6F\x20\x65\x6E\x61\x62\x6C\x65\x73\x20\x5C\x27\x73\x74\x72\x69"\
+	"\x63\x74\x5C\x27\x29\x27\x2C\x0A\x20\x20\x20\x20\x27\x69\x6D\x6D\x65\x64\x27\x3A"\
+	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x69\x6D\x6D\x65\x64\x69\x61\x74\x65"\
+	"\x20\x69\x6E\x76\x6F\x63\x61\x74\x69\x6F\x6E\x73\x20\x6D\x75\x73\x74\x20\x62\x65"\
+	"\x20\x77\x72\x61\x70\x70\x65\x64\x20\x69\x6E\x20\x70\x61\x72\x65\x6E\x73\x27\x2C"\
+	"\x0A\x20\x20\x20\x20\x27\x6A\x71\x75\x65\x72\x79\x27\x3A\x20\x27\x20\x74\x72\x75"\
+	"\x65\x20\x69\x66\x20\x6A\x51\x75\x65\x72\x79\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20"\
 	"\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64"\
-	"\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x65\x6D\x70\x74\x79\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x65\x6D\x70\x74\x79\x20\x62\x6C\x6F\x63\x6B\x73"\
-	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x69\x73\x61\x6C\x6C\x6F\x77\x65"\
-	"\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x6E\x65\x77\x27\x3A\x20\x27\x20\x74"\
-	"\x72\x75\x65\x20\x69\x66\x20\x75\x73\x69\x6E\x67\x20\x60\x6E\x65\x77\x60\x20\x66"\
-	"\x6F\x72\x20\x73\x69\x64\x65\x2D\x65\x66\x66\x65\x63\x74\x73\x20\x73\x68\x6F\x75"\
-	"\x6C\x64\x20\x62\x65\x20\x64\x69\x73\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20"\
-	"\x20\x20\x20\x27\x6E\x6F\x6D\x65\x6E\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69"\
-	"\x66\x20\x6E\x61\x6D\x65\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x63\x68"\
-	"\x65\x63\x6B\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6F\x6E\x65\x76\x61\x72\x27"\
-	"\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x6F\x6E\x6C\x79\x20\x6F\x6E\x65"\
-	"\x20\x76\x61\x72\x20\x73\x74\x61\x74\x65\x6D\x65\x6E\x74\x20\x70\x65\x72\x20\x66"\
-	"\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C"\
-	"\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x70\x61\x73\x73\x66\x61\x69"\
-	"\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x73\x63"\
-	"\x61\x6E\x20\x73\x68\x6F\x75\x6C\x64\x20\x73\x74\x6F\x70\x20\x6F\x6E\x20\x66\x69"\
-	"\x72\x73\x74\x20\x65\x72\x72\x6F\x72\x27\x2C\x0A\x20\x20\x20\x20\x27\x70\x6C\x75"\
-	"\x73\x70\x6C\x75\x73\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x69\x6E"\
-	"\x63\x72\x65\x6D\x65\x6E\x74\x2F\x64\x65\x63\x72\x65\x6D\x65\x6E\x74\x20\x73\x68"\
-	"\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27"\
-	"\x2C\x0A\x20\x20\x20\x20\x27\x70\x72\x6F\x74\x6F\x74\x79\x70\x65\x6A\x73\x27\x3A"\
-	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x50\x72\x6F\x74\x6F\x74\x79\x70\x65"\
-	"\x20\x61\x6E\x64\x20\x53\x63\x72\x69\x70\x74\x61\x63\x75\x6C\x6F\x75\x73\x20\x67"\
+	"\x27\x2C\x0A\x20\x20\x20\x20\x27\x6C\x61\x74\x65\x64\x65\x66\x27\x3A\x20\x27\x20"\
+	"\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x75\x73\x65\x20\x62\x65\x66\x6F"\
+	"\x72\x65\x20\x64\x65\x66\x69\x6E\x69\x74\x69\x6F\x6E\x20\x73\x68\x6F\x75\x6C\x64"\
+	"\x20\x6E\x6F\x74\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A"\
+	"\x20\x20\x20\x20\x27\x6C\x61\x78\x62\x72\x65\x61\x6B\x27\x3A\x20\x27\x20\x74\x72"\
+	"\x75\x65\x20\x69\x66\x20\x6C\x69\x6E\x65\x20\x62\x72\x65\x61\x6B\x73\x20\x73\x68"\
+	"\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x63\x68\x65\x63\x6B\x65\x64\x27"\
+	"\x2C\x0A\x20\x20\x20\x20\x27\x6C\x6F\x6F\x70\x66\x75\x6E\x63\x27\x3A\x20\x27\x20"\
+	"\x74\x72\x75\x65\x20\x69\x66\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x73\x20\x73\x68"\
+	"\x6F\x75\x6C\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x20\x74\x6F\x20\x62"\
+	"\x65\x20\x64\x65\x66\x69\x6E\x65\x64\x20\x77\x69\x74\x68\x69\x6E\x20\x6C\x6F\x6F"\
+	"\x70\x73\x27\x2C\x0A\x20\x20\x20\x20\x27\x6D\x61\x78\x65\x72\x72\x27\x3A\x20\x27"\
+	"\x20\x74\x68\x65\x20\x6D\x61\x78\x69\x6D\x75\x6D\x20\x6E\x75\x6D\x62\x65\x72\x20"\
+	"\x6F\x66\x20\x77\x61\x72\x6E\x69\x6E\x67\x73\x20\x72\x65\x70\x6F\x72\x74\x65\x64"\
+	"\x20\x28\x64\x65\x66\x61\x75\x6C\x74\x20\x69\x73\x20\x35\x30\x29\x27\x2C\x0A\x20"\
+	"\x20\x20\x20\x27\x6D\x6F\x6F\x74\x6F\x6F\x6C\x73\x27\x3A\x20\x27\x20\x74\x72\x75"\
+	"\x65\x20\x69\x66\x20\x4D\x6F\x6F\x54\x6F\x6F\x6C\x73\x20\x67\x6C\x6F\x62\x61\x6C"\
+	"\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E"\
+	"\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x65\x77\x63\x61\x70\x27\x3A\x20\x27"\
+	"\x20\x74\x72\x75\x65\x20\x69\x66\x20\x63\x6F\x6E\x73\x74\x72\x75\x63\x74\x6F\x72"\
+	"\x20\x6E\x61\x6D\x65\x73\x20\x6D\x75\x73\x74\x20\x62\x65\x20\x63\x61\x70\x69\x74"\
+	"\x61\x6C\x69\x7A\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x61\x72\x67\x27"\
+	"\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x72\x67\x75\x6D\x65\x6E\x74"\
+	"\x73\x2E\x63\x61\x6C\x6C\x65\x72\x20\x61\x6E\x64\x20\x61\x72\x67\x75\x6D\x65\x6E"\
+	"\x74\x73\x2E\x63\x61\x6C\x6C\x65\x65\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20"\
+	"\x64\x69\x73\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F"\
+	"\x64\x65\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x4E"\
+	"\x6F\x64\x65\x2E\x6A\x73\x20\x65\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67"\
 	"\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x72\x65\x67\x65\x78"\
-	"\x64\x61\x73\x68\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x75\x6E\x65"\
-	"\x73\x63\x61\x70\x65\x64\x20\x6C\x61\x73\x74\x20\x64\x61\x73\x68\x20\x28\x2D\x29"\
-	"\x20\x69\x6E\x73\x69\x64\x65\x20\x62\x72\x61\x63\x6B\x65\x74\x73\x20\x73\x68\x6F"\
-	"\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20"\
-	"\x20\x20\x20\x27\x72\x65\x67\x65\x78\x70\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20"\
-	"\x69\x66\x20\x74\x68\x65\x20\x2E\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20"\
-	"\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x20\x69\x6E\x20\x72\x65\x67\x65\x78\x70"\
-	"\x20\x6C\x69\x74\x65\x72\x61\x6C\x73\x27\x2C\x0A\x20\x20\x20\x20\x27\x72\x68\x69"\
-	"\x6E\x6F\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x52"\
-	"\x68\x69\x6E\x6F\x20\x65\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67\x6C\x6F"\
-	"\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65"\
-	"\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x75\x6E\x64\x65\x66\x27\x3A"\
-	"\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x73"\
-	"\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x65\x63\x6C\x61\x72\x65\x64\x20"\
-	"\x62\x65\x66\x6F\x72\x65\x20\x75\x73\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x73"\
-	"\x63\x72\x69\x70\x74\x75\x72\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66"\
-	"\x20\x73\x63\x72\x69\x70\x74\x2D\x74\x61\x72\x67\x65\x74\x65\x64\x20\x55\x52\x4C"\
-	"\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65"\
-	"\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x73\x68\x61\x64\x6F\x77\x27\x3A\x20\x27\x20"\
-	"\x74\x72\x75\x65\x20\x69\x66\x20\x76\x61\x72\x69\x61\x62\x6C\x65\x20\x73\x68\x61"\
-	"\x64\x6F\x77\x69\x6E\x67\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C"\
-	"\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x73\x74\x72\x69\x63\x74"\
-	"\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x72\x65\x71\x75\x69\x72\x65\x20\x74\x68"\
-	"\x65\x20\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x22\x3B\x20\x70\x72\x61\x67"\
-	"\x6D\x61\x27\x2C\x0A\x20\x20\x20\x20\x27\x73\x75\x62\x27\x3A\x20\x27\x20\x74\x72"\
-	"\x75\x65\x20\x69\x66\x20\x61\x6C\x6C\x20\x66\x6F\x72\x6D\x73\x20\x6F\x66\x20\x73"\
-	"\x75\x62\x73\x63\x72\x69\x70\x74\x20\x6E\x6F\x74\x61\x74\x69\x6F\x6E\x20\x61\x72"\
-	"\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x73"\
-	"\x75\x70\x65\x72\x6E\x65\x77\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20"\
-	"\x60\x6E\x65\x77\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x29\x20\x7B\x20\x2E"\
-	"\x2E\x2E\x20\x7D\x3B\x60\x20\x61\x6E\x64\x20\x60\x6E\x65\x77\x20\x4F\x62\x6A\x65"\
-	"\x63\x74\x3B\x60\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72"\
-	"\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x74\x72\x61\x69\x6C\x69\x6E\x67"\
-	"\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x72\x61\x69\x6C\x69\x6E"\
-	"\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x72\x75\x6C\x65\x73\x20\x61"\
-	"\x70\x70\x6C\x79\x27\x2C\x0A\x20\x20\x20\x20\x27\x77\x68\x69\x74\x65\x27\x3A\x20"\
-	"\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x73\x74\x72\x69\x63\x74\x20\x77\x68\x69"\
-	"\x74\x65\x73\x70\x61\x63\x65\x20\x72\x75\x6C\x65\x73\x20\x61\x70\x70\x6C\x79\x27"\
-	"\x2C\x0A\x20\x20\x20\x20\x27\x77\x73\x68\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20"\
-	"\x69\x66\x20\x74\x68\x65\x20\x57\x69\x6E\x64\x6F\x77\x73\x20\x53\x63\x72\x69\x70"\
-	"\x74\x69\x6E\x67\x20\x48\x6F\x73\x74\x20\x65\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E"\
-	"\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20"\
-	"\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x0A\x7D\x3B\x0A\x0A\x2F\x2A\x67\x6C"\
-	"\x6F\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20\x74\x72\x75\x65\x2C\x20\x63"\
-	"\x6F\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x2C\x20\x4A\x53\x48\x49\x4E\x54"\
-	"\x3A\x20\x74\x72\x75\x65\x20\x2A\x2F\x0A\x76\x61\x72\x20\x66\x6E\x61\x6D\x65\x2C"\
-	"\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2C\x20"\
-	"\x63\x6F\x64\x65\x2C\x20\x72\x65\x73\x75\x6C\x74\x3B\x0A\x0A\x73\x65\x74\x74\x69"\
-	"\x6E\x67\x73\x20\x3D\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x20\x7C\x7C\x20\x7B\x7D"\
-	"\x3B\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x68\x65\x6C\x70\x28\x29\x20\x7B"\
-	"\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A\x20"\
-	"\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x2C\x20\x73\x74\x72\x3B\x0A\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x73\x61\x67\x65\x3A"\
+	"\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x65\x6D\x70"\
+	"\x74\x79\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x65\x6D\x70\x74\x79"\
+	"\x20\x62\x6C\x6F\x63\x6B\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x69"\
+	"\x73\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x6E\x65"\
+	"\x77\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x75\x73\x69\x6E\x67\x20"\
+	"\x60\x6E\x65\x77\x60\x20\x66\x6F\x72\x20\x73\x69\x64\x65\x2D\x65\x66\x66\x65\x63"\
+	"\x74\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x69\x73\x61\x6C\x6C\x6F"\
+	"\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x6E\x6F\x6D\x65\x6E\x27\x3A\x20\x27"\
+	"\x20\x74\x72\x75\x65\x20\x69\x66\x20\x6E\x61\x6D\x65\x73\x20\x73\x68\x6F\x75\x6C"\
+	"\x64\x20\x62\x65\x20\x63\x68\x65\x63\x6B\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27"\
+	"\x6F\x6E\x65\x76\x61\x72\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x6F"\
+	"\x6E\x6C\x79\x20\x6F\x6E\x65\x20\x76\x61\x72\x20\x73\x74\x61\x74\x65\x6D\x65\x6E"\
+	"\x74\x20\x70\x65\x72\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x68\x6F\x75\x6C"\
+	"\x64\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27"\
+	"\x70\x61\x73\x73\x66\x61\x69\x6C\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66"\
+	"\x20\x74\x68\x65\x20\x73\x63\x61\x6E\x20\x73\x68\x6F\x75\x6C\x64\x20\x73\x74\x6F"\
+	"\x70\x20\x6F\x6E\x20\x66\x69\x72\x73\x74\x20\x65\x72\x72\x6F\x72\x27\x2C\x0A\x20"\
+	"\x20\x20\x20\x27\x70\x6C\x75\x73\x70\x6C\x75\x73\x27\x3A\x20\x27\x20\x74\x72\x75"\
+	"\x65\x20\x69\x66\x20\x69\x6E\x63\x72\x65\x6D\x65\x6E\x74\x2F\x64\x65\x63\x72\x65"\
+	"\x6D\x65\x6E\x74\x20\x73\x68\x6F\x75\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x61"\
+	"\x6C\x6C\x6F\x77\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x70\x72\x6F\x74\x6F\x74"\
+	"\x79\x70\x65\x6A\x73\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x50\x72"\
+	"\x6F\x74\x6F\x74\x79\x70\x65\x20\x61\x6E\x64\x20\x53\x63\x72\x69\x70\x74\x61\x63"\
+	"\x75\x6C\x6F\x75\x73\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64"\
+	"\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20"\
+	"\x20\x27\x72\x65\x67\x65\x78\x64\x61\x73\x68\x27\x3A\x20\x27\x20\x74\x72\x75\x65"\
+	"\x20\x69\x66\x20\x75\x6E\x65\x73\x63\x61\x70\x65\x64\x20\x6C\x61\x73\x74\x20\x64"\
+	"\x61\x73\x68\x20\x28\x2D\x29\x20\x69\x6E\x73\x69\x64\x65\x20\x62\x72\x61\x63\x6B"\
+	"\x65\x74\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61"\
+	"\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x72\x65\x67\x65\x78\x70\x27\x3A\x20"\
+	"\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x2E\x20\x73\x68\x6F\x75"\
+	"\x6C\x64\x20\x6E\x6F\x74\x20\x62\x65\x20\x61\x6C\x6C\x6F\x77\x65\x64\x20\x69\x6E"\
+	"\x20\x72\x65\x67\x65\x78\x70\x20\x6C\x69\x74\x65\x72\x61\x6C\x73\x27\x2C\x0A\x20"\
+	"\x20\x20\x20\x27\x72\x68\x69\x6E\x6F\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69"\
+	"\x66\x20\x74\x68\x65\x20\x52\x68\x69\x6E\x6F\x20\x65\x6E\x76\x69\x72\x6F\x6E\x6D"\
+	"\x65\x6E\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62"\
+	"\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27"\
+	"\x75\x6E\x64\x65\x66\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x76\x61"\
+	"\x72\x69\x61\x62\x6C\x65\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x64\x65"\
+	"\x63\x6C\x61\x72\x65\x64\x20\x62\x65\x66\x6F\x72\x65\x20\x75\x73\x65\x64\x27\x2C"\
+	"\x0A\x20\x20\x20\x20\x27\x73\x63\x72\x69\x70\x74\x75\x72\x6C\x27\x3A\x20\x27\x20"\
+	"\x74\x72\x75\x65\x20\x69\x66\x20\x73\x63\x72\x69\x70\x74\x2D\x74\x61\x72\x67\x65"\
+	"\x74\x65\x64\x20\x55\x52\x4C\x73\x20\x73\x68\x6F\x75\x6C\x64\x20\x62\x65\x20\x74"\
+	"\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x73\x68\x61\x64"\
+	"\x6F\x77\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x76\x61\x72\x69\x61"\
+	"\x62\x6C\x65\x20\x73\x68\x61\x64\x6F\x77\x69\x6E\x67\x20\x73\x68\x6F\x75\x6C\x64"\
+	"\x20\x62\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20"\
+	"\x27\x73\x74\x72\x69\x63\x74\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x72\x65\x71"\
+	"\x75\x69\x72\x65\x20\x74\x68\x65\x20\x22\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74"\
+	"\x22\x3B\x20\x70\x72\x61\x67\x6D\x61\x27\x2C\x0A\x20\x20\x20\x20\x27\x73\x75\x62"\
+	"\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x61\x6C\x6C\x20\x66\x6F\x72"\
+	"\x6D\x73\x20\x6F\x66\x20\x73\x75\x62\x73\x63\x72\x69\x70\x74\x20\x6E\x6F\x74\x61"\
+	"\x74\x69\x6F\x6E\x20\x61\x72\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C"\
+	"\x0A\x20\x20\x20\x20\x27\x73\x75\x70\x65\x72\x6E\x65\x77\x27\x3A\x20\x27\x20\x74"\
+	"\x72\x75\x65\x20\x69\x66\x20\x60\x6E\x65\x77\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"\
+	"\x20\x28\x29\x20\x7B\x20\x2E\x2E\x2E\x20\x7D\x3B\x60\x20\x61\x6E\x64\x20\x60\x6E"\
+	"\x65\x77\x20\x4F\x62\x6A\x65\x63\x74\x3B\x60\x20\x73\x68\x6F\x75\x6C\x64\x20\x62"\
+	"\x65\x20\x74\x6F\x6C\x65\x72\x61\x74\x65\x64\x27\x2C\x0A\x20\x20\x20\x20\x27\x74"\
+	"\x72\x61\x69\x6C\x69\x6E\x67\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20"\
+	"\x74\x72\x61\x69\x6C\x69\x6E\x67\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20"\
+	"\x72\x75\x6C\x65\x73\x20\x61\x70\x70\x6C\x79\x27\x2C\x0A\x20\x20\x20\x20\x27\x77"\
+	"\x68\x69\x74\x65\x27\x3A\x20\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x73\x74\x72"\
+	"\x69\x63\x74\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x72\x75\x6C\x65\x73"\
+	"\x20\x61\x70\x70\x6C\x79\x27\x2C\x0A\x20\x20\x20\x20\x27\x77\x73\x68\x27\x3A\x20"\
+	"\x27\x20\x74\x72\x75\x65\x20\x69\x66\x20\x74\x68\x65\x20\x57\x69\x6E\x64\x6F\x77"\
+	"\x73\x20\x53\x63\x72\x69\x70\x74\x69\x6E\x67\x20\x48\x6F\x73\x74\x20\x65\x6E\x76"\
+	"\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x73\x68\x6F"\
+	"\x75\x6C\x64\x20\x62\x65\x20\x70\x72\x65\x64\x65\x66\x69\x6E\x65\x64\x27\x0A\x7D"\
+	"\x3B\x0A\x0A\x2F\x2A\x67\x6C\x6F\x62\x61\x6C\x20\x73\x79\x73\x74\x65\x6D\x3A\x20"\
+	"\x74\x72\x75\x65\x2C\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x3A\x20\x74\x72\x75\x65\x2C"\
+	"\x20\x4A\x53\x48\x49\x4E\x54\x3A\x20\x74\x72\x75\x65\x20\x2A\x2F\x0A\x76\x61\x72"\
+	"\x20\x66\x6E\x61\x6D\x65\x2C\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x2C\x20\x6F\x70"\
+	"\x74\x69\x6F\x6E\x73\x2C\x20\x63\x6F\x64\x65\x2C\x20\x72\x65\x73\x75\x6C\x74\x3B"\
+	"\x0A\x0A\x73\x65\x74\x74\x69\x6E\x67\x73\x20\x3D\x20\x73\x65\x74\x74\x69\x6E\x67"\
+	"\x73\x20\x7C\x7C\x20\x7B\x7D\x3B\x0A\x0A\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x68"\
+	"\x65\x6C\x70\x28\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72"\
+	"\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x2C\x20\x73"\
+	"\x74\x72\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
+	"\x27\x55\x73\x61\x67\x65\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
+	"\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x6A\x73\x68\x69\x6E\x74\x20\x5B"\
+	"\x6F\x70\x74\x69\x6F\x6E\x73\x5D\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x27\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x47\x65\x6E"\
+	"\x65\x72\x61\x6C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D"\
+	"\x68\x65\x6C\x70\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x53\x68\x6F\x77\x20"\
+	"\x74\x68\x69\x73\x20\x68\x65\x6C\x70\x20\x73\x63\x72\x65\x65\x6E\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20"\
+	"\x20\x2D\x2D\x76\x65\x72\x73\x69\x6F\x6E\x20\x20\x20\x20\x20\x20\x20\x20\x44\x69"\
+	"\x73\x70\x6C\x61\x79\x20\x4A\x53\x48\x69\x6E\x74\x20\x65\x64\x69\x74\x69\x6F\x6E"\
 	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
-	"\x27\x20\x20\x20\x20\x6A\x73\x68\x69\x6E\x74\x20\x5B\x6F\x70\x74\x69\x6F\x6E\x73"\
-	"\x5D\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F"\
-	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x47\x65\x6E\x65\x72\x61\x6C\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C"\
-	"\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x68\x65\x6C\x70\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x53\x68\x6F\x77\x20\x74\x68\x69\x73\x20\x68\x65"\
-	"\x6C\x70\x20\x73\x63\x72\x65\x65\x6E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E"\
-	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x20\x2D\x2D\x76\x65\x72\x73"\
-	"\x69\x6F\x6E\x20\x20\x20\x20\x20\x20\x20\x20\x44\x69\x73\x70\x6C\x61\x79\x20\x4A"\
-	"\x53\x48\x69\x6E\x74\x20\x65\x64\x69\x74\x69\x6F\x6E\x27\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x4A\x53\x48\x69\x6E\x74\x20"\
-	"\x6F\x70\x74\x69\x6F\x6E\x73\x20\x28\x73\x65\x65\x20\x68\x74\x74\x70\x3A\x2F\x2F"\
-	"\x6A\x73\x68\x69\x6E\x74\x2E\x63\x6F\x6D\x2F\x69\x6E\x64\x65\x78\x2E\x68\x74\x6D"\
-	"\x6C\x23\x64\x6F\x63\x73\x29\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x66\x6F\x72\x20"\
-	"\x28\x6F\x70\x74\x20\x69\x6E\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x29\x20\x7B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x65\x74\x74\x69\x6E\x67\x73"\
-	"\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74\x79\x28\x6F\x70\x74\x29"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20"\
-	"\x3D\x20\x27\x20\x20\x20\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x3B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69\x6C\x65\x20\x28\x73\x74\x72"\
-	"\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x32\x30\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x2B\x3D\x20\x27"\
-	"\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x2B\x3D\x20\x73\x65\x74"\
-	"\x74\x69\x6E\x67\x73\x5B\x6F\x70\x74\x5D\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x73\x74\x72\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20"\
+	"\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27"\
+	"\x4A\x53\x48\x69\x6E\x74\x20\x6F\x70\x74\x69\x6F\x6E\x73\x20\x28\x73\x65\x65\x20"\
+	"\x68\x74\x74\x70\x3A\x2F\x2F\x6A\x73\x68\x69\x6E\x74\x2E\x63\x6F\x6D\x2F\x69\x6E"\
+	"\x64\x65\x78\x2E\x68\x74\x6D\x6C\x23\x64\x6F\x63\x73\x29\x3A\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x66\x6F\x72\x20\x28\x6F\x70\x74\x20\x69\x6E\x20\x73\x65\x74\x74\x69"\
+	"\x6E\x67\x73\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73"\
+	"\x65\x74\x74\x69\x6E\x67\x73\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72"\
+	"\x74\x79\x28\x6F\x70\x74\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x73\x74\x72\x20\x3D\x20\x27\x20\x20\x20\x20\x2D\x2D\x27\x20\x2B\x20"\
+	"\x6F\x70\x74\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x77\x68\x69"\
+	"\x6C\x65\x20\x28\x73\x74\x72\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x32\x30\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73"\
+	"\x74\x72\x20\x2B\x3D\x20\x27\x20\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72"\
+	"\x20\x2B\x3D\x20\x73\x65\x74\x74\x69\x6E\x67\x73\x5B\x6F\x70\x74\x5D\x3B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x73\x74\x72\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28"\
+	"\x27\x45\x78\x61\x6D\x70\x6C\x65\x20\x75\x73\x65\x20\x6F\x66\x20\x4A\x53\x48\x69"\
+	"\x6E\x74\x20\x6F\x70\x74\x69\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x20\x20\x20\x2D\x2D\x77\x68\x69"\
+	"\x74\x65\x3D\x74\x72\x75\x65\x20\x2D\x2D\x72\x68\x69\x6E\x6F\x3D\x74\x72\x75\x65"\
+	"\x20\x2D\x2D\x6D\x61\x78\x65\x72\x72\x3D\x34\x32\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x77\x68\x69\x63\x68\x20\x77\x6F"\
+	"\x75\x6C\x64\x20\x65\x6E\x66\x6F\x72\x63\x65\x20\x77\x68\x69\x74\x65\x73\x70\x61"\
+	"\x63\x65\x20\x72\x75\x6C\x65\x73\x20\x61\x6E\x64\x20\x64\x65\x66\x69\x6E\x65\x20"\
+	"\x52\x68\x69\x6E\x6F\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
+	"\x2E\x6C\x6F\x67\x28\x27\x65\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67\x6C"\
+	"\x6F\x62\x61\x6C\x73\x20\x61\x6E\x64\x20\x73\x74\x6F\x70\x20\x61\x66\x74\x65\x72"\
+	"\x20\x65\x6E\x63\x6F\x75\x6E\x74\x65\x72\x69\x6E\x67\x20\x34\x32\x20\x65\x72\x72"\
+	"\x6F\x72\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
+	"\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x27\x46\x6F\x72\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x72\x6D\x61"\
+	"\x74\x69\x6F\x6E\x20\x61\x62\x6F\x75\x74\x20\x4A\x53\x48\x69\x6E\x74\x2C\x20\x67"\
+	"\x6F\x20\x74\x6F\x20\x68\x74\x74\x70\x3A\x2F\x2F\x6A\x73\x68\x69\x6E\x74\x2E\x63"\
+	"\x6F\x6D\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69"\
+	"\x74\x28\x2D\x31\x29\x3B\x0A\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D"\
+	"\x2E\x61\x72\x67\x73\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x6F\x70\x74\x69\x6F"\
+	"\x6E\x73\x20\x3D\x20\x7B\x7D\x3B\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73"\
+	"\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x61"\
+	"\x72\x67\x29\x20\x7B\x0A\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63"\
+	"\x74\x27\x3B\x0A\x20\x20\x20\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x20"\
+	"\x69\x2C\x20\x73\x74\x72\x2C\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61\x6C\x75"\
+	"\x65\x3B\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x20\x3E\x20\x32\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20"\
+	"\x28\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20\x27"\
+	"\x2D\x27\x20\x26\x26\x20\x61\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31\x29\x20"\
+	"\x3D\x3D\x3D\x20\x27\x2D\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75\x62\x73"\
+	"\x74\x72\x69\x6E\x67\x28\x32\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x29"\
+	"\x3B\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
+	"\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x76\x65\x72\x73\x69\x6F\x6E\x27\x29"\
+	"\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63"\
+	"\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x4A\x53\x48\x69\x6E\x74\x20\x65"\
+	"\x64\x69\x74\x69\x6F\x6E\x27\x2C\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x64\x69\x74"\
+	"\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x45\x78\x61\x6D\x70\x6C"\
-	"\x65\x20\x75\x73\x65\x20\x6F\x66\x20\x4A\x53\x48\x69\x6E\x74\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x73\x3A\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x27\x20\x20\x20\x2D\x2D\x77\x68\x69\x74\x65\x3D\x74\x72\x75\x65"\
-	"\x20\x2D\x2D\x72\x68\x69\x6E\x6F\x3D\x74\x72\x75\x65\x20\x2D\x2D\x6D\x61\x78\x65"\
-	"\x72\x72\x3D\x34\x32\x27\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65"\
-	"\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x27\x77\x68\x69\x63\x68\x20\x77\x6F\x75\x6C\x64\x20\x65\x6E\x66"\
-	"\x6F\x72\x63\x65\x20\x77\x68\x69\x74\x65\x73\x70\x61\x63\x65\x20\x72\x75\x6C\x65"\
-	"\x73\x20\x61\x6E\x64\x20\x64\x65\x66\x69\x6E\x65\x20\x52\x68\x69\x6E\x6F\x27\x29"\
-	"\x3B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x65"\
-	"\x6E\x76\x69\x72\x6F\x6E\x6D\x65\x6E\x74\x20\x67\x6C\x6F\x62\x61\x6C\x73\x20\x61"\
-	"\x6E\x64\x20\x73\x74\x6F\x70\x20\x61\x66\x74\x65\x72\x20\x65\x6E\x63\x6F\x75\x6E"\
-	"\x74\x65\x72\x69\x6E\x67\x20\x34\x32\x20\x65\x72\x72\x6F\x72\x73\x2E\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x46\x6F\x72"\
-	"\x20\x6D\x6F\x72\x65\x20\x69\x6E\x66\x6F\x72\x6D\x61\x74\x69\x6F\x6E\x20\x61\x62"\
-	"\x6F\x75\x74\x20\x4A\x53\x48\x69\x6E\x74\x2C\x20\x67\x6F\x20\x74\x6F\x20\x68\x74"\
-	"\x74\x70\x3A\x2F\x2F\x6A\x73\x68\x69\x6E\x74\x2E\x63\x6F\x6D\x2E\x27\x29\x3B\x0A"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A"\
-	"\x7D\x0A\x0A\x69\x66\x20\x28\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73\x2E\x6C"\
-	"\x65\x6E\x67\x74\x68\x20\x3C\x20\x31\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C"\
-	"\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x6F\x70\x74\x69\x6F\x6E\x73\x20\x3D\x20\x7B\x7D"\
-	"\x3B\x0A\x73\x79\x73\x74\x65\x6D\x2E\x61\x72\x67\x73\x2E\x66\x6F\x72\x45\x61\x63"\
-	"\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x61\x72\x67\x29\x20\x7B\x0A\x20"\
-	"\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A\x20\x20\x20"\
-	"\x20\x76\x61\x72\x20\x6F\x70\x74\x69\x6F\x6E\x2C\x20\x69\x2C\x20\x73\x74\x72\x2C"\
-	"\x20\x70\x72\x65\x64\x65\x66\x2C\x20\x76\x61\x6C\x75\x65\x3B\x0A\x20\x20\x20\x20"\
-	"\x69\x66\x20\x28\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x20\x3E\x20\x32\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x61\x72\x67\x2E\x63\x68"\
-	"\x61\x72\x41\x74\x28\x30\x29\x20\x3D\x3D\x3D\x20\x27\x2D\x27\x20\x26\x26\x20\x61"\
-	"\x72\x67\x2E\x63\x68\x61\x72\x41\x74\x28\x31\x29\x20\x3D\x3D\x3D\x20\x27\x2D\x27"\
-	"\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69"\
-	"\x6F\x6E\x20\x3D\x20\x61\x72\x67\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x32"\
-	"\x2C\x20\x61\x72\x67\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D"\
-	"\x3D\x3D\x20\x27\x76\x65\x72\x73\x69\x6F\x6E\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E"\
-	"\x6C\x6F\x67\x28\x27\x4A\x53\x48\x69\x6E\x74\x20\x65\x64\x69\x74\x69\x6F\x6E\x27"\
-	"\x2C\x20\x4A\x53\x48\x49\x4E\x54\x2E\x65\x64\x69\x74\x69\x6F\x6E\x29\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
-	"\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D"\
-	"\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x69\x6E\x64\x65\x78"\
-	"\x4F\x66\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x3D\x20\x6F\x70\x74"\
-	"\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x69\x20\x2B\x20\x31\x2C"\
-	"\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x65\x6E\x67\x74\x68\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x20"\
-	"\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67\x28\x30"\
-	"\x2C\x20\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x65"\
-	"\x74\x74\x69\x6E\x67\x73\x2E\x68\x61\x73\x4F\x77\x6E\x50\x72\x6F\x70\x65\x72\x74"\
-	"\x79\x28\x6F\x70\x74\x69\x6F\x6E\x29\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
-	"\x28\x27\x55\x6E\x6B\x6E\x6F\x77\x6E\x20\x6F\x70\x74\x69\x6F\x6E\x3A\x20\x2D\x2D"\
-	"\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
-	"\x28\x27\x52\x75\x6E\x20\x6A\x73\x68\x69\x6E\x74\x20\x2D\x2D\x68\x65\x6C\x70\x20"\
-	"\x74\x6F\x20\x6C\x69\x73\x74\x20\x61\x6C\x6C\x20\x70\x6F\x73\x73\x69\x62\x6C\x65"\
-	"\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E"\
+	"\x65\x78\x69\x74\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F"\
+	"\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27\x68\x65\x6C\x70\x27\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x68\x65\x6C\x70"\
+	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x20\x3D\x20\x6F\x70\x74\x69\x6F"\
+	"\x6E\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x27\x3D\x27\x29\x3B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x69\x20\x3E\x3D\x20\x30\x29\x20"\
+	"\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74"\
+	"\x72\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73\x74\x72\x69\x6E\x67"\
+	"\x28\x69\x20\x2B\x20\x31\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x6C\x65\x6E\x67\x74"\
+	"\x68\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x20\x6F\x70\x74\x69\x6F\x6E\x2E\x73\x75\x62\x73"\
+	"\x74\x72\x69\x6E\x67\x28\x30\x2C\x20\x69\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x69\x66\x20\x28\x21\x73\x65\x74\x74\x69\x6E\x67\x73\x2E\x68\x61\x73\x4F\x77\x6E"\
+	"\x50\x72\x6F\x70\x65\x72\x74\x79\x28\x6F\x70\x74\x69\x6F\x6E\x29\x29\x20\x7B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x55\x6E\x6B\x6E\x6F\x77\x6E\x20\x6F\x70\x74"\
+	"\x69\x6F\x6E\x3A\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x52\x75\x6E\x20\x6A\x73\x68\x69\x6E\x74\x20"\
+	"\x2D\x2D\x68\x65\x6C\x70\x20\x74\x6F\x20\x6C\x69\x73\x74\x20\x61\x6C\x6C\x20\x70"\
+	"\x6F\x73\x73\x69\x62\x6C\x65\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x27\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73"\
+	"\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D"\
+	"\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F"\
+	"\x6E\x20\x3D\x3D\x3D\x20\x27\x70\x72\x65\x64\x65\x66\x27\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79"\
+	"\x70\x65\x6F\x66\x20\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67"\
+	"\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x2E\x70\x72\x65\x64\x65\x66\x20"\
+	"\x3D\x20\x73\x74\x72\x2E\x73\x70\x6C\x69\x74\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65"\
+	"\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C"\
+	"\x6F\x67\x28\x27\x49\x6E\x76\x61\x6C\x69\x64\x20\x76\x61\x6C\x75\x65\x20\x66\x6F"\
+	"\x72\x20\x6F\x70\x74\x69\x6F\x6E\x20\x2D\x2D\x70\x72\x65\x64\x65\x66\x2E\x27\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73"\
+	"\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x5B\x27\x69\x6E\x64\x65\x6E\x74\x27\x2C\x20\x27\x6D\x61\x78\x6C\x65"\
+	"\x6E\x27\x2C\x20\x27\x6D\x61\x78\x65\x72\x72\x27\x5D\x2E\x69\x6E\x64\x65\x78\x4F"\
+	"\x66\x28\x6F\x70\x74\x69\x6F\x6E\x29\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E"\
+	"\x73\x5B\x6F\x70\x74\x69\x6F\x6E\x5D\x20\x3D\x20\x70\x61\x72\x73\x65\x49\x6E\x74"\
+	"\x28\x73\x74\x72\x2C\x20\x31\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x73\x74\x72\x20\x3D\x3D\x3D"\
+	"\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x72\x20\x3D\x20\x27\x74"\
+	"\x72\x75\x65\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x20"\
+	"\x21\x3D\x3D\x20\x27\x74\x72\x75\x65\x27\x20\x26\x26\x20\x73\x74\x72\x20\x21\x3D"\
+	"\x3D\x20\x27\x66\x61\x6C\x73\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
-	"\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x69\x66\x20\x28\x6F\x70\x74\x69\x6F\x6E\x20\x3D\x3D\x3D\x20\x27"\
-	"\x70\x72\x65\x64\x65\x66\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x73\x74"\
-	"\x72\x20\x3D\x3D\x3D\x20\x27\x73\x74\x72\x69\x6E\x67\x27\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70"\
-	"\x74\x69\x6F\x6E\x73\x2E\x70\x72\x65\x64\x65\x66\x20\x3D\x20\x73\x74\x72\x2E\x73"\
-	"\x70\x6C\x69\x74\x28\x27\x2C\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73"\
-	"\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x49\x6E\x76"\
-	"\x61\x6C\x69\x64\x20\x76\x61\x6C\x75\x65\x20\x66\x6F\x72\x20\x6F\x70\x74\x69\x6F"\
-	"\x6E\x20\x2D\x2D\x70\x72\x65\x64\x65\x66\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F"\
-	"\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69"\
-	"\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x5B\x27\x69\x6E"\
-	"\x64\x65\x6E\x74\x27\x2C\x20\x27\x6D\x61\x78\x6C\x65\x6E\x27\x2C\x20\x27\x6D\x61"\
-	"\x78\x65\x72\x72\x27\x5D\x2E\x69\x6E\x64\x65\x78\x4F\x66\x28\x6F\x70\x74\x69\x6F"\
-	"\x6E\x29\x20\x3E\x3D\x20\x30\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x5B\x6F\x70\x74\x69\x6F"\
-	"\x6E\x5D\x20\x3D\x20\x70\x61\x72\x73\x65\x49\x6E\x74\x28\x73\x74\x72\x2C\x20\x31"\
-	"\x30\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x74"\
-	"\x79\x70\x65\x6F\x66\x20\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66"\
-	"\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x73\x74\x72\x20\x3D\x20\x27\x74\x72\x75\x65\x27\x3B\x0A\x20"\
+	"\x28\x27\x49\x6E\x76\x61\x6C\x69\x64\x20\x76\x61\x6C\x75\x65\x20\x66\x6F\x72\x20"\
+	"\x6F\x70\x74\x69\x6F\x6E\x20\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x20"\
+	"\x2B\x20\x27\x3A\x20\x6D\x75\x73\x74\x20\x62\x65\x20\x74\x72\x75\x65\x20\x6F\x72"\
+	"\x20\x66\x61\x6C\x73\x65\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29"\
+	"\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79"\
+	"\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x5B"\
+	"\x6F\x70\x74\x69\x6F\x6E\x5D\x20\x3D\x20\x28\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27"\
+	"\x74\x72\x75\x65\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x7D\x0A\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72"\
+	"\x6E\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x20"\
+	"\x20\x20\x20\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20"\
+	"\x21\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27"\
+	"\x50\x6C\x65\x61\x73\x65\x20\x6F\x6E\x6C\x79\x20\x73\x70\x65\x63\x69\x66\x79\x20"\
+	"\x6F\x6E\x65\x20\x66\x69\x6C\x65\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28"\
+	"\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E\x61\x6D\x65"\
+	"\x20\x3D\x20\x61\x72\x67\x3B\x0A\x7D\x29\x3B\x0A\x0A\x69\x66\x20\x28\x74\x79\x70"\
+	"\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66"\
+	"\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B"\
+	"\x0A\x7D\x0A\x0A\x74\x72\x79\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x64\x65\x20\x3D"\
+	"\x20\x73\x79\x73\x74\x65\x6D\x2E\x72\x65\x61\x64\x46\x69\x6C\x65\x28\x66\x6E\x61"\
+	"\x6D\x65\x29\x3B\x0A\x20\x20\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x4A\x53"\
+	"\x48\x49\x4E\x54\x28\x63\x6F\x64\x65\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x29\x3B"\
+	"\x0A\x20\x20\x20\x20\x69\x66\x20\x28\x72\x65\x73\x75\x6C\x74\x29\x20\x7B\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27"\
+	"\x4A\x53\x48\x69\x6E\x74\x20\x64\x6F\x65\x73\x20\x6E\x6F\x74\x20\x72\x65\x70\x6F"\
+	"\x72\x74\x20\x61\x6E\x79\x20\x70\x72\x6F\x62\x6C\x65\x6D\x2E\x27\x29\x3B\x0A\x20"\
+	"\x20\x20\x20\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x4A\x53\x48\x49\x4E\x54\x2E\x65\x72\x72\x6F\x72\x73\x2E\x66\x6F\x72\x45\x61\x63"\
+	"\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x28\x65\x72\x72\x6F\x72\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74"\
+	"\x72\x69\x63\x74\x27\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69"\
+	"\x66\x20\x28\x65\x72\x72\x6F\x72\x20\x21\x3D\x3D\x20\x6E\x75\x6C\x6C\x29\x20\x7B"\
+	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E"\
+	"\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x41\x74\x20\x6C\x69\x6E\x65\x27\x2C\x20"\
+	"\x65\x72\x72\x6F\x72\x2E\x6C\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x63\x6F\x6C\x75\x6D\x6E\x27"\
+	"\x2C\x20\x65\x72\x72\x6F\x72\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x0A\x20"\
+	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27"\
+	"\x3A\x27\x2C\x20\x65\x72\x72\x6F\x72\x2E\x72\x65\x61\x73\x6F\x6E\x29\x3B\x0A\x20"\
 	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x72\x20\x21\x3D\x3D\x20\x27\x74\x72"\
-	"\x75\x65\x27\x20\x26\x26\x20\x73\x74\x72\x20\x21\x3D\x3D\x20\x27\x66\x61\x6C\x73"\
-	"\x65\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x49\x6E\x76\x61\x6C"\
-	"\x69\x64\x20\x76\x61\x6C\x75\x65\x20\x66\x6F\x72\x20\x6F\x70\x74\x69\x6F\x6E\x20"\
-	"\x2D\x2D\x27\x20\x2B\x20\x6F\x70\x74\x69\x6F\x6E\x20\x2B\x20\x27\x3A\x20\x6D\x75"\
-	"\x73\x74\x20\x62\x65\x20\x74\x72\x75\x65\x20\x6F\x72\x20\x66\x61\x6C\x73\x65\x2E"\
-	"\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78"\
-	"\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x7D\x20\x65\x6C\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x6F\x70\x74\x69\x6F\x6E\x73\x5B\x6F\x70\x74\x69\x6F\x6E\x5D"\
-	"\x20\x3D\x20\x28\x73\x74\x72\x20\x3D\x3D\x3D\x20\x27\x74\x72\x75\x65\x27\x29\x3B"\
-	"\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x0A\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x72\x65\x74\x75\x72\x6E\x3B\x0A\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x69\x66\x20\x28"\
-	"\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61\x6D\x65\x20\x21\x3D\x3D\x20\x27\x75\x6E"\
-	"\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x50\x6C\x65\x61\x73\x65\x20"\
-	"\x6F\x6E\x6C\x79\x20\x73\x70\x65\x63\x69\x66\x79\x20\x6F\x6E\x65\x20\x66\x69\x6C"\
-	"\x65\x6E\x61\x6D\x65\x21\x27\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F"\
-	"\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x73\x79\x73\x74\x65\x6D\x2E\x65\x78\x69\x74\x28\x2D\x31\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x20\x20\x20\x20\x66\x6E\x61\x6D\x65\x20\x3D\x20\x61\x72\x67\x3B"\
-	"\x0A\x7D\x29\x3B\x0A\x0A\x69\x66\x20\x28\x74\x79\x70\x65\x6F\x66\x20\x66\x6E\x61"\
-	"\x6D\x65\x20\x3D\x3D\x3D\x20\x27\x75\x6E\x64\x65\x66\x69\x6E\x65\x64\x27\x29\x20"\
-	"\x7B\x0A\x20\x20\x20\x20\x68\x65\x6C\x70\x28\x29\x3B\x0A\x7D\x0A\x0A\x74\x72\x79"\
-	"\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x64\x65\x20\x3D\x20\x73\x79\x73\x74\x65\x6D"\
-	"\x2E\x72\x65\x61\x64\x46\x69\x6C\x65\x28\x66\x6E\x61\x6D\x65\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x72\x65\x73\x75\x6C\x74\x20\x3D\x20\x4A\x53\x48\x49\x4E\x54\x28\x63\x6F"\
-	"\x64\x65\x2C\x20\x6F\x70\x74\x69\x6F\x6E\x73\x29\x3B\x0A\x20\x20\x20\x20\x69\x66"\
-	"\x20\x28\x72\x65\x73\x75\x6C\x74\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x27\x4A\x53\x48\x69\x6E\x74\x20"\
-	"\x64\x6F\x65\x73\x20\x6E\x6F\x74\x20\x72\x65\x70\x6F\x72\x74\x20\x61\x6E\x79\x20"\
-	"\x70\x72\x6F\x62\x6C\x65\x6D\x2E\x27\x29\x3B\x0A\x20\x20\x20\x20\x7D\x20\x65\x6C"\
-	"\x73\x65\x20\x7B\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x4A\x53\x48\x49\x4E\x54\x2E"\
-	"\x65\x72\x72\x6F\x72\x73\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74"\
-	"\x69\x6F\x6E\x20\x28\x65\x72\x72\x6F\x72\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x27\x75\x73\x65\x20\x73\x74\x72\x69\x63\x74\x27\x3B\x0A"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x69\x66\x20\x28\x65\x72\x72\x6F"\
-	"\x72\x20\x21\x3D\x3D\x20\x6E\x75\x6C\x6C\x29\x20\x7B\x0A\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F"\
-	"\x67\x28\x27\x41\x74\x20\x6C\x69\x6E\x65\x27\x2C\x20\x65\x72\x72\x6F\x72\x2E\x6C"\
-	"\x69\x6E\x65\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x27\x63\x6F\x6C\x75\x6D\x6E\x27\x2C\x20\x65\x72\x72\x6F\x72"\
-	"\x2E\x63\x68\x61\x72\x61\x63\x74\x65\x72\x2C\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x27\x3A\x27\x2C\x20\x65\x72\x72"\
-	"\x6F\x72\x2E\x72\x65\x61\x73\x6F\x6E\x29\x3B\x0A\x20\x20\x20\x20\x20\x20\x20\x20"\
-	"\x20\x20\x20\x20\x7D\x0A\x20\x20\x20\x20\x20\x20\x20\x20\x7D\x29\x3B\x0A\x20\x20"\
-	"\x20\x20\x7D\x0A\x7D\x20\x63\x61\x74\x63\x68\x20\x28\x65\x29\x20\x7B\x0A\x20\x20"\
-	"\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67\x28\x65\x29\x3B\x0A\x7D\x0A";
\ No newline at end of file
+	"\x20\x7D\x29\x3B\x0A\x20\x20\x20\x20\x7D\x0A\x7D\x20\x63\x61\x74\x63\x68\x20\x28"\
+	"\x65\x29\x20\x7B\x0A\x20\x20\x20\x20\x63\x6F\x6E\x73\x6F\x6C\x65\x2E\x6C\x6F\x67"\
+	"\x28\x65\x29\x3B\x0A\x7D\x0A";
\ No newline at end of file
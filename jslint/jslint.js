@@ -257,7 +257,8 @@
     conditional_assignment: string, confusing_a: string,
     confusing_regexp: string, confusion: boolean, constructor: string,
     constructor_name_a: string, content: array, continue, control_a: string,
-    'counter-increment': array, 'counter-reset': array, create: *, css: string,
+    count: number, 'counter-increment': array, 'counter-reset': array,
+    create: *, css: string,
     cursor: array, d, dangerous_comment: string, dangling_a: string,
     data: function object, datalist: object, dd: object, debug,
     defineProperties: string, defineProperty: string, del: object,
@@ -348,7 +349,8 @@
     read_only: string, reason, redefinition_a: string, reduce: string,
     reduceRight: string, regexp, replace: function, report: function,
     reserved: boolean, reserved_a: string, reverse: string, rhino: boolean,
-    right: array, rp: object, rt: object, ruby: object, safe: boolean,
+    right: array, rp: object, rt: object, ruby: object, rules: object,
+    safe: boolean,
     samp: object, scanned_a_b: string, screen: boolean, script: object,
     seal: string, search: function, second: *, section: object, select: object,
     setDate: string, setDay: string, setFullYear: string, setHours: string,
@@ -929,6 +931,10 @@ var JSLINT = (function () {
             'print', 'quit', 'readFile', 'readUrl', 'runCommand', 'seal',
             'serialize', 'spawn', 'sync', 'toint32', 'version'
         ], false),
+        rules = typeof system !== 'undefined' && system.rules, // --rule-stats
+        clock = rules && system.now,
+        cost_inner = 0,
+        cost_outer = [],
 
         scope,      // An object containing an object for each variable in scope
         semicolon_coda = array_to_object([';', '"', '\'', ')'], true),
@@ -1299,6 +1305,33 @@ var JSLINT = (function () {
     }
 
 
+// Cost accounting for the --rule-stats option of the command line runner,
+// which provides system.rules and a clock. Time is exclusive: what a nested
+// measurement takes is not charged to the enclosing one as well.
+
+    function cost_begin() {
+        cost_outer.push(cost_inner);
+        cost_inner = 0;
+        return clock();
+    }
+
+    function cost_end(name, start) {
+        var elapsed = clock() - start,
+            cost = rules[name] || (rules[name] = {count: 0, time: 0});
+        cost.count += 1;
+        cost.time += elapsed - cost_inner;
+        cost_inner = cost_outer.pop() + elapsed;
+    }
+
+    function timed(name, f) {
+        return function () {
+            var start = cost_begin(), result = f.apply(this, arguments);
+            cost_end(name, start);
+            return result;
+        };
+    }
+
+
 // Produce an error warning.
 
     function artifact(tok) {
@@ -1321,7 +1354,10 @@ var JSLINT = (function () {
     }
 
     function warn(message, offender, a, b, c, d) {
-        var character, line, warning;
+        var character, line, start, warning;
+        if (rules) {
+            start = cost_begin();
+        }
         offender = offender || next_token;  // `~
         line = offender.line || 0;
         character = offender.from || 0;
@@ -1346,6 +1382,9 @@ var JSLINT = (function () {
         if (warnings >= option.maxerr) {
             quit(bundle.too_many, line, character);
         }
+        if (rules) {
+            cost_end('warning: ' + message, start);
+        }
         return warning;
     }
 
@@ -1393,28 +1432,48 @@ var JSLINT = (function () {
 // Private lex methods
 
         function next_line() {
-            var at;
+            var at, start;
             if (line >= lines.length) {
                 return false;
             }
             character = 1;
             source_row = lines[line];
             line += 1;
+            if (rules) {
+                start = cost_begin();
+            }
             at = source_row.search(/ \t/);
             if (at >= 0) {
                 warn_at('mixed', line, at + 1);
             }
+            if (rules) {
+                cost_end('check: mixed spaces and tabs', start);
+            }
             source_row = source_row.replace(/\t/g, tab);
+            if (rules) {
+                start = cost_begin();
+            }
             at = source_row.search(cx);
             if (at >= 0) {
                 warn_at('unsafe', line, at);
             }
+            if (rules) {
+                cost_end('check: unsafe characters', start);
+                start = cost_begin();
+            }
             if (option.maxlen && option.maxlen < source_row.length) {
                 warn_at('too_long', line, source_row.length);
             }
+            if (rules) {
+                cost_end('option: maxlen', start);
+            }
             return true;
         }
 
+        if (rules) {
+            next_line = timed('lexer: next_line', next_line);
+        }
+
 // Produce a token object.  The token inherits from a syntax symbol.
 
         function it(type, value, quote) {
@@ -2155,6 +2214,10 @@ klass:              do {
         };
     }());
 
+    if (rules) {
+        lex.token = timed('lexer: token', lex.token);
+    }
+
 
     function add_label(token, kind, name) {
 
@@ -2630,6 +2693,15 @@ klass:              do {
         }
     }
 
+    if (rules) {
+        expected_at = timed('option: white', expected_at);
+        one_space = timed('option: white', one_space);
+        one_space_only = timed('option: white', one_space_only);
+        no_space = timed('option: white', no_space);
+        no_space_only = timed('option: white', no_space_only);
+        spaces = timed('option: white', spaces);
+    }
+
     function comma() {
         if (next_token.id !== ',') {
             warn_at('expected_a_b', token.line, token.thru, ',', artifact());
@@ -3294,6 +3366,7 @@ klass:              do {
             var name = this.string,
                 variable = scope[name],
                 site,
+                start,
                 writeable;
 
 // If the variable is not in scope, then we may have an undeclared variable.
@@ -3314,9 +3387,15 @@ klass:              do {
 // in the global scope, then we have an undefined variable error.
 
                 } else {
+                    if (rules) {
+                        start = cost_begin();
+                    }
                     if (!option.undef) {
                         warn('used_before_a', token);
                     }
+                    if (rules) {
+                        cost_end('option: undef', start);
+                    }
                     scope[name] = variable = {
                         string: name,
                         writeable: true,
@@ -6501,6 +6580,10 @@ klass:              do {
         var i, predef, tree;
         JSLINT.errors = [];
         JSLINT.tree = '';
+        if (rules) {
+            cost_outer = [];
+            cost_inner = 0;
+        }
         begin = prev_token = token = next_token =
             Object.create(syntax['(begin)']);
         predefined = {};
@@ -0,0 +1,319 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "bundle.h"
+
+#include "toolhandle.h"
+#include "traceevents.h"
+#include "watchdog.h"
+
+#include <v8.h>
+
+#include <iostream>
+
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+using namespace v8;
+
+struct BundledTool
+{
+    const char* name;
+    // As in the library API.
+    const char* call;
+    // Ends a file that doesn't end with it already, so that the next one
+    // can't continue its last statement.
+    char guard;
+};
+
+static const BundledTool bundled_tools[] = {
+    { "jsmin", "return jsmin('', input, level);", ';' },
+    { "cssmin", "return YAHOO.compressor.cssmin(input);", 0 }
+};
+
+static int threads = 0;
+static std::string output_name;
+
+// Shared with the threads: they take the next input under the lock and
+// each fills in the result or the error for the inputs it took.
+static eightpack::ToolScript tool_script;
+static eightpack::Options tool_options;
+static std::vector<std::string> inputs;
+static std::vector<std::string> results;
+static std::vector<std::string> errors;
+static std::vector<char> timeouts;
+static size_t next_input = 0;
+
+void bundle_set_threads(int count)
+{
+    threads = count;
+}
+
+int bundle_threads()
+{
+    return threads;
+}
+
+void bundle_set_output(const std::string& name)
+{
+    output_name = name;
+}
+
+bool bundle_has_output()
+{
+    return !output_name.empty();
+}
+
+// Each input gets its own --timeout budget and its own spans in the
+// thread's lane of --trace-events.
+static void minify(eightpack::ToolHandle& handle, size_t index)
+{
+    const char* name = inputs[index].c_str();
+    std::string text;
+    trace_event_begin("read", name);
+    // Each part of the bundle is then what the tool prints for the file.
+    bool read = eightpack::read_file(inputs[index], text);
+    trace_event_end();
+    if (!read) {
+        errors[index] = "Exception: Can't open the file";
+        return;
+    }
+
+    HandleScope handle_scope;
+    trace_event_begin("execute", name);
+    watchdog_arm();
+    Handle<Value> result = handle.run(tool_script, String::New(text.data(), text.length()), tool_options);
+    bool timed_out = watchdog_disarm();
+    trace_event_end();
+    if (timed_out) {
+        timeouts[index] = true;
+        return;
+    }
+    if (result.IsEmpty()) {
+        errors[index] = handle.error();
+        return;
+    }
+    String::Utf8Value utf8(result);
+    if (*utf8)
+        results[index].assign(*utf8, utf8.length());
+}
+
+#ifdef _WIN32
+
+static CRITICAL_SECTION lock;
+
+static int processors()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+}
+
+static size_t take_input()
+{
+    EnterCriticalSection(&lock);
+    size_t index = next_input++;
+    LeaveCriticalSection(&lock);
+    return index;
+}
+
+#else
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int processors()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+static size_t take_input()
+{
+    pthread_mutex_lock(&lock);
+    size_t index = next_input++;
+    pthread_mutex_unlock(&lock);
+    return index;
+}
+
+#endif
+
+static void minify_inputs()
+{
+    trace_event_begin("context");
+    eightpack::ToolHandle handle;
+    trace_event_end();
+    Isolate::Scope isolate_scope(handle.isolate());
+    HandleScope handle_scope;
+    Context::Scope context_scope(handle.context());
+    for (size_t index = take_input(); index < inputs.size(); index = take_input())
+        minify(handle, index);
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI worker(LPVOID)
+{
+    minify_inputs();
+    return 0;
+}
+
+// The calling thread is one of them.
+static void run_threads(int count)
+{
+    InitializeCriticalSection(&lock);
+    std::vector<HANDLE> started;
+    for (int i = 1; i < count; ++i)
+        started.push_back(CreateThread(0, 0, worker, 0, 0, 0));
+    minify_inputs();
+    for (size_t i = 0; i < started.size(); ++i) {
+        WaitForSingleObject(started[i], INFINITE);
+        CloseHandle(started[i]);
+    }
+    DeleteCriticalSection(&lock);
+}
+
+#else
+
+static void* worker(void*)
+{
+    minify_inputs();
+    return 0;
+}
+
+// The calling thread is one of them.
+static void run_threads(int count)
+{
+    std::vector<pthread_t> started;
+    for (int i = 1; i < count; ++i) {
+        pthread_t thread;
+        if (pthread_create(&thread, 0, worker, 0) == 0)
+            started.push_back(thread);
+    }
+    minify_inputs();
+    for (size_t i = 0; i < started.size(); ++i)
+        pthread_join(started[i], 0);
+}
+
+#endif
+
+static bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+int bundle_run(const std::string& tool, const char* script, const std::vector<const char*>& args)
+{
+    const BundledTool* bundled = 0;
+    for (size_t i = 0; i < sizeof(bundled_tools) / sizeof(bundled_tools[0]); ++i) {
+        if (tool == bundled_tools[i].name)
+            bundled = &bundled_tools[i];
+    }
+    if (!bundled) {
+        std::cerr << "Error: --bundle works only with jsmin and cssmin" << std::endl;
+        return 1;
+    }
+    tool_script.name = bundled->name;
+    tool_script.script = script;
+    tool_script.call = bundled->call;
+
+    for (size_t i = 0; i < args.size(); ++i) {
+        std::string arg = args[i];
+        // The tool scripts tell their options from file names the same way.
+        if (arg.length() > 2 && arg.compare(0, 2, "--") == 0)
+            tool_options.push_back(arg);
+        else
+            inputs.push_back(arg);
+    }
+    if (inputs.empty()) {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            if (!line.empty())
+                inputs.push_back(line);
+        }
+    }
+
+    results.resize(inputs.size());
+    errors.resize(inputs.size());
+    timeouts.resize(inputs.size());
+    int count = threads > 0 ? threads : processors();
+    if (static_cast<size_t>(count) > inputs.size())
+        count = static_cast<int>(inputs.size());
+    if (count > 0)
+        run_threads(count);
+
+    // Only the first failure: one in the options fails every input.
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        if (timeouts[i]) {
+            std::cerr << "Error: " << inputs[i] << " timed out after " << watchdog_timeout() << " ms" << std::endl;
+            return kTimedOutStatus;
+        }
+        if (!errors[i].empty()) {
+            std::string error = errors[i];
+            error.erase(error.find_last_not_of('\n') + 1);
+            std::cerr << inputs[i] << ": " << error << std::endl;
+            return 1;
+        }
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+        length += results[i].length() + 2;
+    std::string bundle;
+    bundle.reserve(length);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const std::string& result = results[i];
+        size_t start = 0;
+        size_t end = result.length();
+        while (end > 0 && is_blank(result[end - 1]))
+            --end;
+        while (start < end && is_blank(result[start]))
+            ++start;
+        if (start == end)
+            continue;
+        bundle.append(result, start, end - start);
+        if (bundled->guard && result[end - 1] != bundled->guard)
+            bundle.append(1, bundled->guard);
+        bundle.append(1, '\n');
+    }
+
+    FILE* file = output_name.empty() ? stdout : fopen(output_name.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Error: can't write " << output_name << std::endl;
+        return 1;
+    }
+    bool written = fwrite(bundle.data(), 1, bundle.length(), file) == bundle.length();
+    if (file == stdout)
+        written = fflush(stdout) == 0 && written;
+    else
+        written = fclose(file) == 0 && written;
+    if (!written) {
+        std::cerr << "Error: can't write " << (output_name.empty() ? "the bundle" : output_name) << std::endl;
+        return 1;
+    }
+    return 0;
+}
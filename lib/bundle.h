@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_BUNDLE_H
+#define EIGHTPACK_BUNDLE_H
+
+#include <string>
+#include <vector>
+
+// --bundle for jsmin and cssmin: every input is minified on its own, on
+// threads which each have an isolate with the tool loaded, and the
+// results are joined, in the order the inputs were given, into a single
+// output written in one go.
+
+// The number of threads, or a negative number for one per processor;
+// zero, the default, runs the tool the usual way.
+void bundle_set_threads(int threads);
+int bundle_threads();
+
+// The file the bundle goes to, the standard output if there is none.
+void bundle_set_output(const std::string& name);
+bool bundle_has_output();
+
+// Minifies the input files among the arguments, or those listed one per
+// line on the standard input if there are none, with the options among
+// them. Returns zero, or 1 if an input failed and kTimedOutStatus if
+// one ran out of its --timeout budget, in which case nothing is written.
+int bundle_run(const std::string& tool, const char* script, const std::vector<const char*>& args);
+
+#endif
@@ -0,0 +1,166 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "cpuprofile.h"
+
+#include "json.h"
+
+#include <v8.h>
+#include <v8-profiler.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <stdio.h>
+
+using namespace v8;
+
+static std::string output_file;
+static std::string folded_output_file;
+static bool running = false;
+
+static std::string to_string(Handle<String> str)
+{
+    String::Utf8Value value(str);
+    return *value ? std::string(*value, value.length()) : std::string();
+}
+
+static std::string function_name(const CpuProfileNode* node)
+{
+    std::string name = to_string(node->GetFunctionName());
+    return name.empty() ? "(anonymous function)" : name;
+}
+
+static void write_node(std::ostream& out, const CpuProfileNode* node, int& id)
+{
+    char times[128];
+    sprintf(times, "\"selfTime\":%.3f,\"totalTime\":%.3f",
+            node->GetSelfTime(), node->GetTotalTime());
+
+    out << "{\"functionName\":" << json_quote(function_name(node))
+        << ",\"url\":" << json_quote(to_string(node->GetScriptResourceName()))
+        << ",\"lineNumber\":" << node->GetLineNumber()
+        << ",\"callUID\":" << node->GetCallUid()
+        << ",\"id\":" << ++id
+        << ",\"hitCount\":" << static_cast<int>(node->GetSelfSamplesCount())
+        << "," << times
+        << ",\"children\":[";
+    for (int i = 0; i < node->GetChildrenCount(); ++i) {
+        if (i)
+            out << ",";
+        write_node(out, node->GetChild(i), id);
+    }
+    out << "]}";
+}
+
+// Frames are separated by ';' in the folded format, so it must not
+// appear in a frame name.
+static std::string frame_name(const CpuProfileNode* node)
+{
+    std::ostringstream frame;
+    frame << function_name(node);
+    std::string url = to_string(node->GetScriptResourceName());
+    if (!url.empty() || node->GetLineNumber() != CpuProfileNode::kNoLineNumberInfo)
+        frame << " (" << url << ":" << node->GetLineNumber() << ")";
+    std::string name = frame.str();
+    for (size_t i = 0; i < name.length(); ++i) {
+        if (name[i] == ';')
+            name[i] = ':';
+    }
+    return name;
+}
+
+static void write_folded(std::ostream& out, const CpuProfileNode* node, std::vector<std::string>& stack)
+{
+    stack.push_back(frame_name(node));
+    int samples = static_cast<int>(node->GetSelfSamplesCount());
+    if (samples > 0) {
+        for (size_t i = 0; i < stack.size(); ++i)
+            out << (i ? ";" : "") << stack[i];
+        out << " " << samples << "\n";
+    }
+    for (int i = 0; i < node->GetChildrenCount(); ++i)
+        write_folded(out, node->GetChild(i), stack);
+    stack.pop_back();
+}
+
+void cpu_profile_set_output(const std::string& fileName)
+{
+    output_file = fileName;
+}
+
+void cpu_profile_set_folded_output(const std::string& fileName)
+{
+    folded_output_file = fileName;
+}
+
+void cpu_profile_start()
+{
+    if (output_file.empty() && folded_output_file.empty())
+        return;
+    HandleScope handle_scope;
+    CpuProfiler::StartProfiling(String::New("eightpack"));
+    running = true;
+}
+
+void cpu_profile_finish()
+{
+    if (!running)
+        return;
+    running = false;
+
+    HandleScope handle_scope;
+    const CpuProfile* profile = CpuProfiler::StopProfiling(String::New("eightpack"));
+    if (!profile) {
+        std::cerr << "Error: no CPU profile was recorded." << std::endl;
+        return;
+    }
+    const CpuProfileNode* root = profile->GetTopDownRoot();
+
+    if (!output_file.empty()) {
+        std::ofstream out(output_file.c_str());
+        if (!out) {
+            std::cerr << "Error: can't write the CPU profile to " << output_file << std::endl;
+        } else {
+            int id = 0;
+            out << "{\"head\":";
+            write_node(out, root, id);
+            out << ",\"startTime\":0,\"endTime\":" << root->GetTotalTime() / 1000 << ",\"samples\":[]}\n";
+        }
+    }
+
+    if (!folded_output_file.empty()) {
+        std::ofstream out(folded_output_file.c_str());
+        if (!out) {
+            std::cerr << "Error: can't write the CPU profile to " << folded_output_file << std::endl;
+        } else {
+            // The root node is synthetic; leave it out of the stacks.
+            std::vector<std::string> stack;
+            for (int i = 0; i < root->GetChildrenCount(); ++i)
+                write_folded(out, root->GetChild(i), stack);
+        }
+    }
+
+    const_cast<CpuProfile*>(profile)->Delete();
+}
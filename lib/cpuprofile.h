@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_CPUPROFILE_H
+#define EIGHTPACK_CPUPROFILE_H
+
+#include <string>
+
+// CPU profiling of the tool script for --cpu-profile and
+// --cpu-profile-folded. The profile is written either as a top-down
+// call tree in the .cpuprofile JSON format understood by the Chrome
+// developer tools, or as folded stacks for flamegraph.pl and friends.
+
+void cpu_profile_set_output(const std::string& fileName);
+void cpu_profile_set_folded_output(const std::string& fileName);
+
+// Starts the profiler if any output was requested.
+void cpu_profile_start();
+
+// Stops the profiler and writes the requested outputs. Needs a live
+// V8 context; safe to call more than once.
+void cpu_profile_finish();
+
+#endif
@@ -20,15 +20,59 @@
     THE SOFTWARE.
 */
 
+#include "bundle.h"
+#include "cpuprofile.h"
+#include "heapsnapshot.h"
+#include "lsp.h"
+#include "prefork.h"
+#include "rulestats.h"
+#include "stats.h"
+#include "traceevents.h"
+#include "watchdog.h"
+
 #include <v8.h>
 
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
+#include <ctype.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 using namespace v8;
 
+// V8 prints some of its reports, such as the one for --opt-report, only
+// when it is torn down, which the runner otherwise leaves to the exit.
+static bool tear_down = false;
+
+// The file the script read last, to name the input that timed out.
+static std::string last_input;
+
+// While a --prefork worker runs an input, console.log() collects the
+// output here, and system.exit() only ends the script.
+static std::string* output = 0;
+static bool exit_requested = false;
+static int exit_status = 0;
+
+// What a worker needs to run the tool again on another input.
+static Persistent<Function> tool;
+static Persistent<Object> system_object;
+static std::vector<std::string> tool_options;
+
+// Writes out whatever the runner options asked to be collected. Runs
+// before system.exit() leaves the process, or when the script is done.
+static void finish_run()
+{
+    stats_sample_heap();
+    cpu_profile_finish();
+    heap_snapshot_finish();
+    rule_stats_finish();
+    trace_events_finish();
+}
+
 static Handle<Value> system_exit(const Arguments& args)
 {
     HandleScope handle_scope;
@@ -37,6 +81,15 @@ static Handle<Value> system_exit(const Arguments& args)
         return ThrowException(String::New("Exception: function system.exit() accepts 1 argument"));
 
     int status = (args.Length() == 1) ? args[0]->Int32Value() : 0;
+    if (output) {
+        exit_status = status;
+        exit_requested = true;
+        V8::TerminateExecution();
+        return Undefined();
+    }
+    finish_run();
+    if (tear_down)
+        V8::Dispose();
     ::exit(status);
 
     return Undefined();
@@ -48,6 +101,8 @@ static Handle<Value> system_readFile(const Arguments& args)
         return ThrowException(String::New("Exception: function system.readFile() accepts 1 argument"));
 
     String::Utf8Value name(args[0]);
+    StatsScope read(StatsRead, *name);
+    last_input = *name;
 
     std::fstream *fs = new std::fstream;
     fs->open(*name, std::fstream::in);
@@ -72,6 +127,18 @@ static Handle<Value> system_readFile(const Arguments& args)
 static Handle<Value> console_log(const Arguments& args)
 {
     HandleScope handle_scope;
+    StatsScope print(StatsPrint);
+
+    if (output) {
+        for (int i = 0; i < args.Length(); i++) {
+            String::Utf8Value value(args[i]);
+            output->append(*value);
+            if (i < args.Length() - 1)
+                output->append(1, ' ');
+        }
+        output->append(1, '\n');
+        return Undefined();
+    }
 
     for (int i = 0; i < args.Length(); i++) {
         String::Utf8Value value(args[i]);
@@ -84,39 +151,438 @@ static Handle<Value> console_log(const Arguments& args)
     return Undefined();
 }
 
-void eightpack_run(int argc, char* argv[], const char* cmd)
+// Exposes a tool script, which lives in the read-only data of the
+// executable for the whole run, as an external string so that V8
+// compiles it in place instead of copying it into the heap.
+class StaticAsciiString : public String::ExternalAsciiStringResource
 {
-    V8::Initialize();
+public:
+    StaticAsciiString(const char* data, size_t length)
+        : m_data(data)
+        , m_length(length)
+    {
+    }
+
+    virtual const char* data() const { return m_data; }
+    virtual size_t length() const { return m_length; }
+
+private:
+    const char* m_data;
+    size_t m_length;
+};
+
+static Handle<String> script_source(const char* cmd)
+{
+    size_t length = 0;
+    bool ascii = true;
+    for (const char* p = cmd; *p; ++p, ++length) {
+        if (static_cast<unsigned char>(*p) > 0x7f)
+            ascii = false;
+    }
+
+    // Scripts with UTF-8 sequences have to be decoded, hence copied.
+    if (!ascii)
+        return String::New(cmd, length);
+
+    return String::NewExternal(new StaticAsciiString(cmd, length));
+}
+
+// The last option given that looks only at the default isolate, which
+// --bundle leaves idle.
+static const char* default_isolate_option = 0;
+
+// --stats reports at exit, so it is enabled only once the options are
+// known to be good.
+static bool stats_requested = false;
+static StatsFormat stats_format = StatsTable;
+
+// Options handled by the runner itself rather than by the tool script.
+// Returns false if the argument is not one of them.
+static bool runner_option(const std::string& arg)
+{
+    if (arg == "--stats" || arg == "--stats=table") {
+        stats_requested = true;
+        stats_format = StatsTable;
+        default_isolate_option = "--stats";
+        return true;
+    }
+    if (arg == "--stats=json") {
+        stats_requested = true;
+        stats_format = StatsJson;
+        default_isolate_option = "--stats";
+        return true;
+    }
+    if (arg.compare(0, 8, "--stats=") == 0) {
+        std::cout << "Invalid value for option --stats: must be table or json." << std::endl;
+        std::cout << std::endl;
+        ::exit(-1);
+    }
+    if (arg.compare(0, 14, "--cpu-profile=") == 0) {
+        cpu_profile_set_output(arg.substr(14));
+        default_isolate_option = "--cpu-profile";
+        return true;
+    }
+    if (arg.compare(0, 21, "--cpu-profile-folded=") == 0) {
+        cpu_profile_set_folded_output(arg.substr(21));
+        default_isolate_option = "--cpu-profile-folded";
+        return true;
+    }
+    if (arg == "--perf-map") {
+        static const char flag[] = "--perf-map";
+        V8::SetFlagsFromString(flag, sizeof(flag) - 1);
+        return true;
+    }
+    if (arg.compare(0, 15, "--trace-events=") == 0) {
+        trace_events_set_output(arg.substr(15));
+        return true;
+    }
+    if (arg == "--rule-stats") {
+        rule_stats_enable();
+        default_isolate_option = "--rule-stats";
+        return true;
+    }
+    if (arg == "--opt-report") {
+        static const char flag[] = "--opt-report";
+        V8::SetFlagsFromString(flag, sizeof(flag) - 1);
+        tear_down = true;
+        return true;
+    }
+    if (arg.compare(0, 16, "--heap-snapshot=") == 0) {
+        heap_snapshot_set_output(arg.substr(16));
+        default_isolate_option = "--heap-snapshot";
+        return true;
+    }
+    if (arg == "--heap-snapshot-at=exit") {
+        heap_snapshot_set_moment(HeapSnapshotAtExit);
+        return true;
+    }
+    if (arg == "--heap-snapshot-at=peak") {
+        heap_snapshot_set_moment(HeapSnapshotAtPeak);
+        return true;
+    }
+    if (arg.compare(0, 19, "--heap-snapshot-at=") == 0) {
+        std::cout << "Invalid value for option --heap-snapshot-at: must be exit or peak." << std::endl;
+        std::cout << std::endl;
+        ::exit(-1);
+    }
+    if (arg.compare(0, 10, "--timeout=") == 0) {
+        int milliseconds = atoi(arg.c_str() + 10);
+        if (milliseconds <= 0) {
+            std::cout << "Invalid value for option --timeout: must be a number of milliseconds." << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        watchdog_set_timeout(milliseconds);
+        return true;
+    }
+    if (arg == "--lsp") {
+        lsp_enable();
+        return true;
+    }
+    if (arg == "--bundle") {
+        bundle_set_threads(-1);
+        return true;
+    }
+    if (arg.compare(0, 9, "--bundle=") == 0) {
+        int threads = atoi(arg.c_str() + 9);
+        if (threads <= 0) {
+            std::cout << "Invalid value for option --bundle: must be a number of threads." << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        bundle_set_threads(threads);
+        return true;
+    }
+    if (arg.compare(0, 10, "--prefork=") == 0) {
+        int workers = atoi(arg.c_str() + 10);
+        if (workers <= 0) {
+            std::cout << "Invalid value for option --prefork: must be a number of workers." << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        prefork_set_workers(workers);
+        return true;
+    }
+    if (arg.compare(0, 16, "--recycle-after=") == 0) {
+        int inputs = atoi(arg.c_str() + 16);
+        if (inputs <= 0) {
+            std::cout << "Invalid value for option --recycle-after: must be a number of inputs." << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        prefork_set_recycle_inputs(inputs);
+        return true;
+    }
+    if (arg.compare(0, 15, "--recycle-heap=") == 0) {
+        int megabytes = atoi(arg.c_str() + 15);
+        if (megabytes <= 0 || megabytes > 2047) {
+            std::cout << "Invalid value for option --recycle-heap: must be a number of megabytes." << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        prefork_set_recycle_heap(megabytes * 1024 * 1024);
+        return true;
+    }
+    return false;
+}
+
+// Name the tool script after the tool, e.g. "jshint.js", so that
+// profiles and stack traces can tell its functions from others.
+static std::string script_name(const char* tool)
+{
+    return std::string(tool) + ".js";
+}
+
+// Runs the tool on one input in a --prefork worker.
+static int run_input(const std::string& input, std::string& result)
+{
+    HandleScope handle_scope;
+
+    Handle<Array> args = Array::New();
+    for (size_t i = 0; i < tool_options.size(); ++i)
+        args->Set(i, String::New(tool_options[i].c_str()));
+    args->Set(tool_options.size(), String::New(input.c_str()));
+    system_object->Set(String::New("args"), args);
+
+    output = &result;
+    exit_requested = false;
+    exit_status = 0;
+
+    StatsScope execute(StatsExecute, input.c_str());
+    watchdog_arm();
+    tool->Call(Context::GetCurrent()->Global(), 0, 0);
+    bool timed_out = watchdog_disarm();
+    if (exit_requested)
+        V8::CancelTerminateExecution();
+    output = 0;
+
+    if (timed_out) {
+        std::cerr << "Error: " << input << " timed out after " << watchdog_timeout() << " ms" << std::endl;
+        return kTimedOutStatus;
+    }
+    return exit_status;
+}
+
+// The reports of the runner options, one after another, each preceded
+// by its length on a line of its own.
+static void reset_reports()
+{
+    stats_reset();
+    rule_stats_reset();
+    trace_events_reset();
+}
+
+static std::string take_reports()
+{
+    std::string parts[] = { stats_take(), rule_stats_take(), trace_events_take() };
+    std::string report;
+    char length[32];
+    for (size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); ++i) {
+        sprintf(length, "%lu\n", static_cast<unsigned long>(parts[i].length()));
+        report += length + parts[i];
+    }
+    return report;
+}
+
+static void merge_reports(const std::string& report)
+{
+    void (*merges[])(const std::string&) = { stats_merge, rule_stats_merge, trace_events_merge };
+    size_t position = 0;
+    for (size_t i = 0; i < sizeof(merges) / sizeof(merges[0]); ++i) {
+        size_t newline = report.find('\n', position);
+        if (newline == std::string::npos)
+            return;
+        size_t length = strtoul(report.c_str() + position, 0, 10);
+        position = newline + 1;
+        if (position + length > report.length())
+            return;
+        merges[i](report.substr(position, length));
+        position += length;
+    }
+}
+
+// Runs the tool once for each input file given, or listed one per line
+// on the standard input if there are none, in --prefork workers.
+static int run_prefork(Handle<Script> script, Handle<Object> system, const std::vector<const char*>& scriptArgs)
+{
+    std::vector<std::string> inputs;
+    for (size_t i = 0; i < scriptArgs.size(); ++i) {
+        std::string arg = scriptArgs[i];
+        // The tool scripts tell their options from file names the same way.
+        if (arg.length() > 2 && arg.compare(0, 2, "--") == 0)
+            tool_options.push_back(arg);
+        else
+            inputs.push_back(arg);
+    }
+    if (inputs.empty()) {
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            if (!line.empty())
+                inputs.push_back(line);
+        }
+    }
+
+    tool = Persistent<Function>::New(Handle<Function>::Cast(script->Run()));
+    system_object = Persistent<Object>::New(system);
+
+    // A run on an empty input compiles the functions the tool uses, so
+    // that the workers don't each have to.
+    std::string discarded;
+    run_input("/dev/null", discarded);
+
+    PreforkReports reports = { reset_reports, take_reports, merge_reports };
+    int status = prefork_run(inputs, run_input, reports);
+
+    tool.Dispose();
+    system_object.Dispose();
+    return status;
+}
+
+// Runs the script once on an empty input, which leaves the linter and
+// the options given on the command line in the global object, and then
+// serves --lsp clients with them.
+static int run_lsp(Handle<Script> script, Handle<Array> args, const std::string& tool)
+{
+    args->Set(args->Length(), String::New("/dev/null"));
+
+    // Whatever the script prints would garble the protocol.
+    std::string printed;
+    output = &printed;
+    exit_requested = false;
+    script->Run();
+    if (exit_requested)
+        V8::CancelTerminateExecution();
+    output = 0;
+    if (exit_requested && exit_status) {
+        std::cerr << printed;
+        return exit_status;
+    }
+
+    // The linter is a global named after the tool, e.g. JSHINT.
+    std::string name = tool;
+    for (size_t i = 0; i < name.length(); ++i)
+        name[i] = toupper(name[i]);
+    Handle<Object> global = Context::GetCurrent()->Global();
+    Handle<Value> lint = global->Get(String::New(name.c_str()));
+    if (!lint->IsFunction()) {
+        std::cerr << "Error: --lsp works only with jshint and jslint" << std::endl;
+        return 1;
+    }
+    return lsp_run(tool, Handle<Function>::Cast(lint), global->Get(String::New("options")));
+}
+
+// Returns the exit status: kTimedOutStatus if the script ran out of its
+// --timeout budget, otherwise zero unless --prefork workers failed.
+static int run_script(const char* tool, const std::vector<const char*>& scriptArgs, const char* cmd)
+{
+    StatsScope setup(StatsSetup);
 
     HandleScope handle_scope;
     Handle<ObjectTemplate> global = ObjectTemplate::New();
+    stats_begin(StatsContext);
     Handle<Context> context = Context::New(NULL, global);
+    stats_end();
 
     Context::Scope context_scope(context);
 
     Handle<Array> args = Array::New();
-    for (int i = 1, index = 0; i < argc; ++i) {
-        const char* arg = argv[i];
-        args->Set(index, String::New(arg));
-        ++index;
-    }
+    for (size_t i = 0; i < scriptArgs.size(); ++i)
+        args->Set(i, String::New(scriptArgs[i]));
+
+    Handle<String> code = script_source(cmd);
 
-    Handle<String> code = String::New(cmd);
+    // The workers run the script once per input, so it becomes the body
+    // of a function, which gets fresh variables every time.
+    if (prefork_workers() && !lsp_enabled())
+        code = String::Concat(String::Concat(String::New("(function () {"), code), String::New("\n})"));
 
     Handle<FunctionTemplate> systemObject = FunctionTemplate::New();
     systemObject->Set(String::New("args"), args);
     systemObject->Set(String::New("exit"), FunctionTemplate::New(system_exit)->GetFunction());
     systemObject->Set(String::New("readFile"), FunctionTemplate::New(system_readFile)->GetFunction());
-    context->Global()->Set(String::New("system"), systemObject->GetFunction());
+    Handle<Function> system = systemObject->GetFunction();
+    rule_stats_install(system);
+    context->Global()->Set(String::New("system"), system);
 
     Handle<FunctionTemplate> consoleObject = FunctionTemplate::New();
     consoleObject->Set(String::New("log"), FunctionTemplate::New(console_log)->GetFunction());
     context->Global()->Set(String::New("console"), consoleObject->GetFunction());
 
-    Handle<Script> script = Script::Compile(code);
+    cpu_profile_start();
+    heap_snapshot_start();
+
+    stats_begin(StatsCompile);
+    Handle<Script> script = Script::Compile(code, String::New(script_name(tool).c_str()));
+    stats_end();
+    int status = 0;
     if (script.IsEmpty()) {
         std::cerr << "Error: unable to bootstrap!" << std::endl;
+    } else if (lsp_enabled()) {
+        status = run_lsp(script, args, tool);
+    } else if (prefork_workers()) {
+        status = run_prefork(script, system, scriptArgs);
     } else {
+        std::string command;
+        for (size_t i = 0; i < scriptArgs.size(); ++i)
+            command += (i ? " " : "") + std::string(scriptArgs[i]);
+        StatsScope execute(StatsExecute, command.c_str());
+        watchdog_arm();
         script->Run();
+        if (watchdog_disarm()) {
+            std::cerr << "Error: " << (last_input.empty() ? script_name(tool) : last_input)
+                      << " timed out after " << watchdog_timeout() << " ms" << std::endl;
+            status = kTimedOutStatus;
+        }
     }
+
+    finish_run();
+    return status;
+}
+
+// The tool is the name of the script, e.g. "jshint", given by the
+// executable rather than taken from argv[0], which may be a renamed copy
+// or a link.
+void eightpack_run(int argc, char* argv[], const char* cmd, const char* tool)
+{
+    std::vector<const char*> scriptArgs;
+    for (int i = 1; i < argc; ++i) {
+        // The file --bundle writes to, the one option with its value apart.
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            bundle_set_output(argv[++i]);
+            continue;
+        }
+        if (!runner_option(argv[i]))
+            scriptArgs.push_back(argv[i]);
+    }
+    if (bundle_has_output() && !bundle_threads()) {
+        std::cout << "Option -o works only with --bundle." << std::endl;
+        std::cout << std::endl;
+        ::exit(-1);
+    }
+    if (bundle_threads() && default_isolate_option) {
+        std::cout << "Option " << default_isolate_option << " doesn't work with --bundle." << std::endl;
+        std::cout << std::endl;
+        ::exit(-1);
+    }
+    if (stats_requested)
+        stats_enable(stats_format);
+
+    stats_begin(StatsInitialize);
+    V8::Initialize();
+    stats_end();
+
+    trace_events_start(tool);
+    stats_watch_heap();
+
+    int status;
+    if (bundle_threads()) {
+        status = bundle_run(tool, cmd, scriptArgs);
+        finish_run();
+    } else
+        status = run_script(tool, scriptArgs, cmd);
+
+    if (tear_down)
+        V8::Dispose();
+    if (status)
+        ::exit(status);
 }
@@ -0,0 +1,158 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_H
+#define EIGHTPACK_H
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+// Runs the tools in-process on buffers in memory. Each handle owns a
+// V8 isolate with its tools loaded in a context that stays warm from
+// one call to the next. Handles are thread-compatible: any thread may use
+// one, one at a time, and threads with handles of their own run in
+// parallel. Link with the eightpack and v8 libraries.
+
+namespace eightpack {
+
+enum Tool {
+    JSHint,
+    JSLint,
+    JSBeautify,
+    JSMin,
+    CSSBeautify,
+    CSSMin
+};
+
+// Options as the tool takes them on its command line, such as
+// "--indent-size=2" for jsbeautify or "--white=true" for jshint.
+typedef std::vector<std::string> Options;
+
+// The output of a tool, in UTF-8.
+typedef std::string Buffer;
+
+// A problem a linter found. Lines and columns count from one.
+struct Diagnostic
+{
+    int line;
+    int column;
+    std::string reason;
+    std::string evidence;
+};
+
+class ToolHandle;
+
+// After a call that failed, such as one with an option the tool doesn't
+// know or one where the script threw, error() says why; otherwise it is
+// empty.
+
+class Minifier
+{
+public:
+    // Either JSMin or CSSMin.
+    explicit Minifier(Tool tool);
+    ~Minifier();
+
+    Buffer minify(const char* data, size_t length, const Options& options = Options());
+    const std::string& error() const;
+
+private:
+    Minifier(const Minifier&);
+    Minifier& operator=(const Minifier&);
+
+    ToolHandle* m_handle;
+    Tool m_tool;
+};
+
+class Beautifier
+{
+public:
+    // Either JSBeautify or CSSBeautify.
+    explicit Beautifier(Tool tool);
+    ~Beautifier();
+
+    Buffer beautify(const char* data, size_t length, const Options& options = Options());
+    const std::string& error() const;
+
+private:
+    Beautifier(const Beautifier&);
+    Beautifier& operator=(const Beautifier&);
+
+    ToolHandle* m_handle;
+    Tool m_tool;
+};
+
+class Linter
+{
+public:
+    // Either JSHint or JSLint.
+    explicit Linter(Tool tool);
+    ~Linter();
+
+    std::vector<Diagnostic> lint(const char* data, size_t length, const Options& options = Options());
+    const std::string& error() const;
+
+private:
+    Linter(const Linter&);
+    Linter& operator=(const Linter&);
+
+    ToolHandle* m_handle;
+    Tool m_tool;
+};
+
+// Runs several tools on each input, in the order they were added, in
+// one context. The input becomes a string once; a linter checks what
+// it is handed and, if it finds problems, stops the input there, while
+// the other tools hand what they make to the next one.
+class Pipeline
+{
+public:
+    Pipeline();
+    ~Pipeline();
+
+    void add(Tool tool, const Options& options = Options());
+
+    // False if a linter found problems, which are in diagnostics, or if
+    // a tool failed, which error() explains. The output is what the last
+    // tool other than a linter made, and empty if there is none.
+    bool run(const char* data, size_t length, Buffer& output, std::vector<Diagnostic>& diagnostics);
+    const std::string& error() const;
+
+private:
+    Pipeline(const Pipeline&);
+    Pipeline& operator=(const Pipeline&);
+
+    ToolHandle* m_handle;
+    std::vector<Tool> m_tools;
+    std::vector<Options> m_options;
+};
+
+// Reads a file as the executables' system.readFile() does, with a line
+// break added at the end, so that what a handle makes of it matches
+// what they print. False if the file can't be opened.
+bool read_file(const std::string& name, Buffer& contents);
+
+} // namespace eightpack
+
+#endif
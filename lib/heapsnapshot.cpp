@@ -0,0 +1,238 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "heapsnapshot.h"
+
+#include <v8.h>
+#include <v8-debug.h>
+#include <v8-profiler.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <stdio.h>
+
+using namespace v8;
+
+// Only a heap that grew by this much over the previous peak is worth
+// another snapshot.
+static const double kPeakGrowthFactor = 1.1;
+
+static const int kSummaryEntries = 20;
+
+static std::string output_file;
+static HeapSnapshotMoment snapshot_moment = HeapSnapshotAtExit;
+static bool running = false;
+static const HeapSnapshot* snapshot = 0;
+static size_t peak_heap_size = 0;
+static size_t snapshot_heap_size = 0;
+
+class FileOutputStream : public OutputStream
+{
+public:
+    FileOutputStream(std::ostream& out) : m_out(out) { }
+
+    virtual void EndOfStream() { m_out.flush(); }
+
+    virtual WriteResult WriteAsciiChunk(char* data, int size)
+    {
+        m_out.write(data, size);
+        return m_out.good() ? kContinue : kAbort;
+    }
+
+private:
+    std::ostream& m_out;
+};
+
+struct RetainerGroup
+{
+    std::string name;
+    int count;
+    long long selfSize;
+    long long retainedSize;
+
+    bool operator<(const RetainerGroup& other) const
+    {
+        return retainedSize > other.retainedSize;
+    }
+};
+
+static size_t used_heap_size()
+{
+    HeapStatistics statistics;
+    V8::GetHeapStatistics(&statistics);
+    return statistics.used_heap_size();
+}
+
+static void take_snapshot()
+{
+    HandleScope handle_scope;
+    if (snapshot)
+        const_cast<HeapSnapshot*>(snapshot)->Delete();
+    snapshot = HeapProfiler::TakeSnapshot(String::New("eightpack"));
+    snapshot_heap_size = used_heap_size();
+}
+
+// A new peak is only noted during the GC; the snapshot itself needs a
+// heap that is not being collected, so it is taken at the debug break
+// that follows.
+static void after_full_gc(GCType type, GCCallbackFlags flags)
+{
+    size_t size = used_heap_size();
+    if (size > peak_heap_size * kPeakGrowthFactor) {
+        peak_heap_size = size;
+        Debug::DebugBreak();
+    }
+}
+
+static void on_debug_event(DebugEvent event, Handle<Object> execState,
+                           Handle<Object> eventData, Handle<Value> data)
+{
+    if (event == Break)
+        take_snapshot();
+}
+
+static std::string group_name(const HeapGraphNode* node)
+{
+    switch (node->GetType()) {
+    case HeapGraphNode::kArray: return "(array)";
+    case HeapGraphNode::kString: return "(string)";
+    case HeapGraphNode::kCode: return "(code)";
+    case HeapGraphNode::kClosure: return "(closure)";
+    case HeapGraphNode::kRegExp: return "(regexp)";
+    case HeapGraphNode::kHeapNumber: return "(number)";
+    case HeapGraphNode::kHidden: return "(system)";
+    default:
+        break;
+    }
+    String::Utf8Value name(node->GetName());
+    return (*name && name.length()) ? *name : "(object)";
+}
+
+// Groups every node reachable from the root by constructor. A node's
+// retained size only counts when its dominator is in another group, so
+// that e.g. a linked list of tokens is not counted once per token.
+static void print_summary(const HeapSnapshot* snapshot)
+{
+    std::map<const HeapGraphNode*, std::string> names;
+    std::vector<const HeapGraphNode*> pending;
+    const HeapGraphNode* root = snapshot->GetRoot();
+    pending.push_back(root);
+    names[root] = "";
+    while (!pending.empty()) {
+        HandleScope handle_scope;
+        const HeapGraphNode* node = pending.back();
+        pending.pop_back();
+        for (int i = 0; i < node->GetChildrenCount(); ++i) {
+            const HeapGraphNode* child = node->GetChild(i)->GetToNode();
+            if (names.find(child) != names.end())
+                continue;
+            names[child] = group_name(child);
+            pending.push_back(child);
+        }
+    }
+
+    std::map<std::string, RetainerGroup> groups;
+    std::map<const HeapGraphNode*, std::string>::const_iterator it;
+    for (it = names.begin(); it != names.end(); ++it) {
+        const HeapGraphNode* node = it->first;
+        // The root and the synthetic "(GC roots)" entry retain everything.
+        if (node == root || it->second == "(GC roots)")
+            continue;
+        RetainerGroup& group = groups[it->second];
+        group.name = it->second;
+        group.count++;
+        group.selfSize += node->GetSelfSize();
+        const HeapGraphNode* dominator = node->GetDominatorNode();
+        std::map<const HeapGraphNode*, std::string>::const_iterator d = names.find(dominator);
+        if (d == names.end() || d->second != it->second)
+            group.retainedSize += node->GetRetainedSize(false);
+    }
+
+    std::vector<RetainerGroup> sorted;
+    std::map<std::string, RetainerGroup>::const_iterator g;
+    for (g = groups.begin(); g != groups.end(); ++g)
+        sorted.push_back(g->second);
+    std::sort(sorted.begin(), sorted.end());
+
+    fprintf(stderr, "Heap snapshot: %.1f KB used\n", snapshot_heap_size / 1024.0);
+    fprintf(stderr, "%-40s %10s %12s %12s\n", "Constructor", "Count", "Self (KB)", "Retained (KB)");
+    for (size_t i = 0; i < sorted.size() && i < static_cast<size_t>(kSummaryEntries); ++i) {
+        const RetainerGroup& group = sorted[i];
+        fprintf(stderr, "%-40s %10d %12.1f %12.1f\n", group.name.substr(0, 40).c_str(),
+                group.count, group.selfSize / 1024.0, group.retainedSize / 1024.0);
+    }
+}
+
+void heap_snapshot_set_output(const std::string& fileName)
+{
+    output_file = fileName;
+}
+
+void heap_snapshot_set_moment(HeapSnapshotMoment moment)
+{
+    snapshot_moment = moment;
+}
+
+void heap_snapshot_start()
+{
+    if (output_file.empty())
+        return;
+    running = true;
+    if (snapshot_moment == HeapSnapshotAtPeak) {
+        Debug::SetDebugEventListener(on_debug_event);
+        V8::AddGCEpilogueCallback(after_full_gc, kGCTypeMarkSweepCompact);
+    }
+}
+
+void heap_snapshot_finish()
+{
+    if (!running)
+        return;
+    running = false;
+
+    HandleScope handle_scope;
+    if (snapshot_moment == HeapSnapshotAtPeak) {
+        V8::RemoveGCEpilogueCallback(after_full_gc);
+        Debug::CancelDebugBreak();
+        Debug::SetDebugEventListener(0);
+    }
+    // A run too short to ever collect garbage has its peak at the end.
+    if (!snapshot)
+        take_snapshot();
+
+    std::ofstream out(output_file.c_str());
+    if (!out) {
+        std::cerr << "Error: can't write the heap snapshot to " << output_file << std::endl;
+    } else {
+        FileOutputStream stream(out);
+        snapshot->Serialize(&stream, HeapSnapshot::kJSON);
+    }
+    print_summary(snapshot);
+
+    const_cast<HeapSnapshot*>(snapshot)->Delete();
+    snapshot = 0;
+}
@@ -0,0 +1,47 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_HEAPSNAPSHOT_H
+#define EIGHTPACK_HEAPSNAPSHOT_H
+
+#include <string>
+
+// Heap snapshots for --heap-snapshot. The snapshot is written in the
+// JSON format of the Chrome developer tools, and a summary of the
+// biggest retainers grouped by constructor goes to stderr.
+
+enum HeapSnapshotMoment {
+    HeapSnapshotAtExit,
+    HeapSnapshotAtPeak
+};
+
+void heap_snapshot_set_output(const std::string& fileName);
+void heap_snapshot_set_moment(HeapSnapshotMoment moment);
+
+// Starts watching the heap size when the snapshot is wanted at peak.
+void heap_snapshot_start();
+
+// Takes the snapshot at exit, or settles on the peak one, and writes
+// it out. Needs a live V8 context; safe to call more than once.
+void heap_snapshot_finish();
+
+#endif
@@ -0,0 +1,209 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "eightpack.h"
+#include "toolhandle.h"
+
+#include <v8.h>
+
+#include "cssbeautify/cssbeautify_script.h"
+#include "cssmin/cssmin_script.h"
+#include "jsbeautify/jsbeautify_script.h"
+#include "jshint/jshint_script.h"
+#include "jslint/jslint_script.h"
+#include "jsmin/jsmin_script.h"
+
+using namespace v8;
+
+namespace eightpack {
+
+// In the order of the Tool enum.
+static const ToolScript tool_scripts[] = {
+    { "jshint", jshint_script, "JSHINT(input, options); return JSHINT.errors;" },
+    { "jslint", jslint_script, "JSLINT(input, options); return JSLINT.errors;" },
+    { "jsbeautify", jsbeautify_script, "return js_beautify(input, options);" },
+    { "jsmin", jsmin_script, "return jsmin('', input, level);" },
+    { "cssbeautify", cssbeautify_script, "return cssbeautify(input, options);" },
+    { "cssmin", cssmin_script, "return YAHOO.compressor.cssmin(input);" }
+};
+
+static Buffer to_buffer(Handle<Value> value)
+{
+    if (value.IsEmpty())
+        return Buffer();
+    String::Utf8Value utf8(value);
+    return *utf8 ? Buffer(*utf8, utf8.length()) : Buffer();
+}
+
+static std::vector<Diagnostic> to_diagnostics(Handle<Value> errors)
+{
+    std::vector<Diagnostic> diagnostics;
+    if (errors.IsEmpty() || !errors->IsArray())
+        return diagnostics;
+
+    Handle<Array> list = Handle<Array>::Cast(errors);
+    Handle<String> line = String::New("line");
+    Handle<String> character = String::New("character");
+    Handle<String> reason = String::New("reason");
+    Handle<String> evidence = String::New("evidence");
+    for (unsigned i = 0; i < list->Length(); ++i) {
+        // A null marks where the linter gave up.
+        Handle<Value> value = list->Get(i);
+        if (!value->IsObject())
+            continue;
+        Handle<Object> error = value->ToObject();
+        Diagnostic diagnostic;
+        diagnostic.line = error->Get(line)->Int32Value();
+        diagnostic.column = error->Get(character)->Int32Value();
+        diagnostic.reason = to_buffer(error->Get(reason));
+        Handle<Value> text = error->Get(evidence);
+        if (text->IsString())
+            diagnostic.evidence = to_buffer(text);
+        diagnostics.push_back(diagnostic);
+    }
+    return diagnostics;
+}
+
+Minifier::Minifier(Tool tool)
+    : m_handle(new ToolHandle)
+    , m_tool(tool)
+{
+}
+
+Minifier::~Minifier()
+{
+    delete m_handle;
+}
+
+Buffer Minifier::minify(const char* data, size_t length, const Options& options)
+{
+    Isolate::Scope isolate_scope(m_handle->isolate());
+    HandleScope handle_scope;
+    Context::Scope context_scope(m_handle->context());
+    return to_buffer(m_handle->run(tool_scripts[m_tool], String::New(data, length), options));
+}
+
+const std::string& Minifier::error() const
+{
+    return m_handle->error();
+}
+
+Beautifier::Beautifier(Tool tool)
+    : m_handle(new ToolHandle)
+    , m_tool(tool)
+{
+}
+
+Beautifier::~Beautifier()
+{
+    delete m_handle;
+}
+
+Buffer Beautifier::beautify(const char* data, size_t length, const Options& options)
+{
+    Isolate::Scope isolate_scope(m_handle->isolate());
+    HandleScope handle_scope;
+    Context::Scope context_scope(m_handle->context());
+    return to_buffer(m_handle->run(tool_scripts[m_tool], String::New(data, length), options));
+}
+
+const std::string& Beautifier::error() const
+{
+    return m_handle->error();
+}
+
+Linter::Linter(Tool tool)
+    : m_handle(new ToolHandle)
+    , m_tool(tool)
+{
+}
+
+Linter::~Linter()
+{
+    delete m_handle;
+}
+
+std::vector<Diagnostic> Linter::lint(const char* data, size_t length, const Options& options)
+{
+    Isolate::Scope isolate_scope(m_handle->isolate());
+    HandleScope handle_scope;
+    Context::Scope context_scope(m_handle->context());
+    return to_diagnostics(m_handle->run(tool_scripts[m_tool], String::New(data, length), options));
+}
+
+const std::string& Linter::error() const
+{
+    return m_handle->error();
+}
+
+Pipeline::Pipeline()
+    : m_handle(new ToolHandle)
+{
+}
+
+Pipeline::~Pipeline()
+{
+    delete m_handle;
+}
+
+void Pipeline::add(Tool tool, const Options& options)
+{
+    m_tools.push_back(tool);
+    m_options.push_back(options);
+}
+
+bool Pipeline::run(const char* data, size_t length, Buffer& output, std::vector<Diagnostic>& diagnostics)
+{
+    Isolate::Scope isolate_scope(m_handle->isolate());
+    HandleScope handle_scope;
+    Context::Scope context_scope(m_handle->context());
+
+    output.clear();
+    diagnostics.clear();
+    m_handle->clear_error();
+
+    Handle<Value> value = String::New(data, length);
+    bool transformed = false;
+    for (size_t i = 0; i < m_tools.size(); ++i) {
+        Handle<Value> result = m_handle->run(tool_scripts[m_tools[i]], value, m_options[i]);
+        if (result.IsEmpty())
+            return false;
+        if (m_tools[i] == JSHint || m_tools[i] == JSLint) {
+            diagnostics = to_diagnostics(result);
+            if (!diagnostics.empty())
+                return false;
+        } else {
+            value = result;
+            transformed = true;
+        }
+    }
+    if (transformed)
+        output = to_buffer(value);
+    return true;
+}
+
+const std::string& Pipeline::error() const
+{
+    return m_handle->error();
+}
+
+} // namespace eightpack
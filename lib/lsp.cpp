@@ -0,0 +1,672 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "lsp.h"
+
+#include "json.h"
+#include "watchdog.h"
+
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+using namespace v8;
+
+// How long the edits to a document have to settle before it is linted.
+static const int kDebounceMilliseconds = 50;
+
+// The JSON-RPC error for requests the server doesn't handle.
+static const int kMethodNotFound = -32601;
+
+// Diagnostic severity for what the linters report.
+static const int kWarning = 2;
+
+// An open document, kept as its lines: edits replace only the lines they
+// touch, and the linters take an array of lines as readily as a string.
+struct Document
+{
+    std::vector<std::string> lines;
+    int version;
+    bool dirty;
+    double changed_at;
+};
+
+static bool enabled = false;
+static std::string tool_name;
+static Persistent<Function> linter;
+static Persistent<Value> lint_options;
+static std::map<std::string, Document> documents;
+
+// Shared with the thread that reads the messages, under the lock: the
+// messages not handled yet and the document being linted, quoted as in
+// the messages, so that the thread can cancel the lint when it changes.
+static std::deque<std::string> inbox;
+static bool input_closed = false;
+static std::string linting;
+static bool cancelled = false;
+static Isolate* isolate = 0;
+
+static void read_messages();
+
+#ifdef _WIN32
+
+static CRITICAL_SECTION lock;
+static HANDLE arrived = 0;
+
+static double now()
+{
+    return GetTickCount();
+}
+
+static void lock_inbox()
+{
+    EnterCriticalSection(&lock);
+}
+
+static void unlock_inbox()
+{
+    LeaveCriticalSection(&lock);
+}
+
+static void notify()
+{
+    SetEvent(arrived);
+}
+
+// Called and returns with the lock held. A negative time waits for as
+// long as it takes.
+static void wait_for_input(int milliseconds)
+{
+    LeaveCriticalSection(&lock);
+    WaitForSingleObject(arrived, milliseconds < 0 ? INFINITE : milliseconds);
+    EnterCriticalSection(&lock);
+}
+
+static DWORD WINAPI reader(LPVOID)
+{
+    read_messages();
+    return 0;
+}
+
+static void start_reader()
+{
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+    InitializeCriticalSection(&lock);
+    arrived = CreateEvent(0, FALSE, FALSE, 0);
+    CloseHandle(CreateThread(0, 0, reader, 0, 0, 0));
+}
+
+#else
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t arrived = PTHREAD_COND_INITIALIZER;
+
+static double now()
+{
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+static void lock_inbox()
+{
+    pthread_mutex_lock(&lock);
+}
+
+static void unlock_inbox()
+{
+    pthread_mutex_unlock(&lock);
+}
+
+static void notify()
+{
+    pthread_cond_signal(&arrived);
+}
+
+// Called and returns with the lock held. A negative time waits for as
+// long as it takes.
+static void wait_for_input(int milliseconds)
+{
+    if (milliseconds < 0) {
+        pthread_cond_wait(&arrived, &lock);
+        return;
+    }
+    timeval tv;
+    gettimeofday(&tv, 0);
+    long nsec = tv.tv_usec * 1000L + (milliseconds % 1000) * 1000000L;
+    timespec deadline;
+    deadline.tv_sec = tv.tv_sec + milliseconds / 1000 + nsec / 1000000000L;
+    deadline.tv_nsec = nsec % 1000000000L;
+    pthread_cond_timedwait(&arrived, &lock, &deadline);
+}
+
+static void* reader(void*)
+{
+    read_messages();
+    return 0;
+}
+
+static void start_reader()
+{
+    pthread_t thread;
+    pthread_create(&thread, 0, reader, 0);
+    pthread_detach(thread);
+}
+
+#endif
+
+void lsp_enable()
+{
+    enabled = true;
+}
+
+bool lsp_enabled()
+{
+    return enabled;
+}
+
+// Reads the next message: headers, of which only Content-Length matters,
+// then the body.
+static bool read_message(std::string& body)
+{
+    long length = -1;
+    std::string header;
+    for (;;) {
+        int c = getchar();
+        if (c == EOF)
+            return false;
+        if (c != '\n') {
+            header += static_cast<char>(c);
+            continue;
+        }
+        if (header.empty() || header == "\r")
+            break;
+        if (header.compare(0, 15, "Content-Length:") == 0)
+            length = atol(header.c_str() + 15);
+        header.clear();
+    }
+    if (length < 0)
+        return false;
+    body.resize(length);
+    return length == 0 || fread(&body[0], 1, length, stdin) == static_cast<size_t>(length);
+}
+
+// Whether the message edits or closes the document, which makes linting
+// its current text pointless.
+static bool supersedes(const std::string& message, const std::string& uri)
+{
+    if (message.find(uri) == std::string::npos)
+        return false;
+    return message.find("\"textDocument/didChange\"") != std::string::npos
+        || message.find("\"textDocument/didClose\"") != std::string::npos;
+}
+
+static void read_messages()
+{
+    std::string body;
+    while (read_message(body)) {
+        lock_inbox();
+        if (!linting.empty() && !cancelled && supersedes(body, linting)) {
+            cancelled = true;
+            V8::TerminateExecution(isolate);
+        }
+        inbox.push_back(body);
+        notify();
+        unlock_inbox();
+    }
+    lock_inbox();
+    input_closed = true;
+    notify();
+    unlock_inbox();
+}
+
+static Handle<Value> get(Handle<Value> object, const char* name)
+{
+    if (!object->IsObject())
+        return Undefined();
+    return object->ToObject()->Get(String::New(name));
+}
+
+static std::string to_string(Handle<Value> value)
+{
+    String::Utf8Value utf8(value);
+    return *utf8 ? std::string(*utf8, utf8.length()) : std::string();
+}
+
+static Handle<Object> json()
+{
+    return Context::GetCurrent()->Global()->Get(String::New("JSON"))->ToObject();
+}
+
+// Returns an empty handle if the text is not valid JSON.
+static Handle<Value> parse(const std::string& text)
+{
+    TryCatch try_catch;
+    Handle<Object> object = json();
+    Handle<Function> parse = Handle<Function>::Cast(object->Get(String::New("parse")));
+    Handle<Value> argv[] = { String::New(text.data(), text.length()) };
+    return parse->Call(object, 1, argv);
+}
+
+static void send(Handle<Object> message)
+{
+    message->Set(String::New("jsonrpc"), String::New("2.0"));
+    Handle<Object> object = json();
+    Handle<Function> stringify = Handle<Function>::Cast(object->Get(String::New("stringify")));
+    Handle<Value> argv[] = { message };
+    String::Utf8Value body(stringify->Call(object, 1, argv));
+    std::cout << "Content-Length: " << body.length() << "\r\n\r\n";
+    std::cout.write(*body, body.length());
+    std::cout.flush();
+}
+
+static void respond(Handle<Value> id, Handle<Value> result)
+{
+    Handle<Object> message = Object::New();
+    message->Set(String::New("id"), id);
+    message->Set(String::New("result"), result);
+    send(message);
+}
+
+static void respond_error(Handle<Value> id, int code, const std::string& text)
+{
+    Handle<Object> error = Object::New();
+    error->Set(String::New("code"), Integer::New(code));
+    error->Set(String::New("message"), String::New(text.c_str()));
+    Handle<Object> message = Object::New();
+    message->Set(String::New("id"), id);
+    message->Set(String::New("error"), error);
+    send(message);
+}
+
+static Handle<Object> position(int line, int character)
+{
+    Handle<Object> position = Object::New();
+    position->Set(String::New("line"), Integer::New(line));
+    position->Set(String::New("character"), Integer::New(character));
+    return position;
+}
+
+static Handle<Object> diagnostic(int line, int character, Handle<Value> text)
+{
+    Handle<Object> range = Object::New();
+    range->Set(String::New("start"), position(line, character));
+    range->Set(String::New("end"), position(line, character + 1));
+    Handle<Object> diagnostic = Object::New();
+    diagnostic->Set(String::New("range"), range);
+    diagnostic->Set(String::New("severity"), Integer::New(kWarning));
+    diagnostic->Set(String::New("source"), String::New(tool_name.c_str()));
+    diagnostic->Set(String::New("message"), text);
+    return diagnostic;
+}
+
+static void publish(const std::string& uri, const Document* document, Handle<Array> diagnostics)
+{
+    Handle<Object> params = Object::New();
+    params->Set(String::New("uri"), String::New(uri.c_str()));
+    if (document)
+        params->Set(String::New("version"), Integer::New(document->version));
+    params->Set(String::New("diagnostics"), diagnostics);
+    Handle<Object> message = Object::New();
+    message->Set(String::New("method"), String::New("textDocument/publishDiagnostics"));
+    message->Set(String::New("params"), params);
+    send(message);
+}
+
+// The linters count lines and columns from one; LSP counts from zero.
+static Handle<Array> diagnostics_of(Handle<Value> errors)
+{
+    Handle<Array> diagnostics = Array::New();
+    if (!errors->IsArray())
+        return diagnostics;
+    Handle<Array> list = Handle<Array>::Cast(errors);
+    for (unsigned i = 0; i < list->Length(); ++i) {
+        // A null marks where the linter gave up.
+        Handle<Value> error = list->Get(i);
+        if (!error->IsObject())
+            continue;
+        int line = std::max(get(error, "line")->Int32Value() - 1, 0);
+        int character = std::max(get(error, "character")->Int32Value() - 1, 0);
+        diagnostics->Set(diagnostics->Length(), diagnostic(line, character, get(error, "reason")));
+    }
+    return diagnostics;
+}
+
+// Lints the document and publishes what the linter found. Returns false
+// if the lint was cancelled because the document changed meanwhile.
+static bool lint_document(const std::string& uri, Document& document)
+{
+    HandleScope handle_scope;
+
+    // The linters split lines at carriage returns as well.
+    Handle<Array> lines = Array::New(document.lines.size());
+    for (size_t i = 0; i < document.lines.size(); ++i) {
+        const std::string& line = document.lines[i];
+        size_t length = line.length();
+        if (length && line[length - 1] == '\r')
+            --length;
+        lines->Set(i, String::New(line.data(), length));
+    }
+
+    lock_inbox();
+    linting = json_quote(uri);
+    cancelled = false;
+    unlock_inbox();
+
+    TryCatch try_catch;
+    Handle<Value> argv[] = { lines, lint_options };
+    watchdog_arm();
+    linter->Call(Context::GetCurrent()->Global(), 2, argv);
+    bool timed_out = watchdog_disarm();
+
+    lock_inbox();
+    bool superseded = cancelled;
+    linting.clear();
+    cancelled = false;
+    unlock_inbox();
+
+    if (superseded) {
+        V8::CancelTerminateExecution(isolate);
+        return false;
+    }
+
+    document.dirty = false;
+    Handle<Array> diagnostics;
+    if (timed_out) {
+        diagnostics = Array::New();
+        char text[64];
+        sprintf(text, "Linting timed out after %d ms", watchdog_timeout());
+        diagnostics->Set(0, diagnostic(0, 0, String::New(text)));
+    } else if (try_catch.HasCaught()) {
+        diagnostics = Array::New();
+        diagnostics->Set(0, diagnostic(0, 0, try_catch.Exception()->ToString()));
+    } else {
+        diagnostics = diagnostics_of(linter->Get(String::New("errors")));
+    }
+    publish(uri, &document, diagnostics);
+    return true;
+}
+
+static void split_lines(const std::string& text, std::vector<std::string>& lines)
+{
+    size_t start = 0;
+    for (;;) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) {
+            lines.push_back(text.substr(start));
+            return;
+        }
+        lines.push_back(text.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+// Finds the line and byte of an LSP position, which counts characters in
+// UTF-16 code units. Positions past the end of a line or of the document
+// stand for its end.
+static void locate(const std::vector<std::string>& lines, Handle<Value> position, size_t& row, size_t& offset)
+{
+    int line = get(position, "line")->Int32Value();
+    int units = get(position, "character")->Int32Value();
+    if (line < 0)
+        line = 0;
+    row = line;
+    if (row >= lines.size()) {
+        row = lines.size() - 1;
+        offset = lines[row].length();
+        return;
+    }
+    const std::string& text = lines[row];
+    offset = 0;
+    while (offset < text.length() && units > 0) {
+        unsigned char c = text[offset];
+        int length = c < 0x80 ? 1 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+        units -= (length == 4) ? 2 : 1;
+        offset += length;
+    }
+    offset = std::min(offset, text.length());
+}
+
+// Replaces the range with the text. Only the lines in the range are
+// rewritten; the others move only if the number of lines changes.
+static void apply_edit(Document& document, Handle<Value> range, const std::string& text)
+{
+    std::vector<std::string>& lines = document.lines;
+    size_t first_row, first_offset, last_row, last_offset;
+    locate(lines, get(range, "start"), first_row, first_offset);
+    locate(lines, get(range, "end"), last_row, last_offset);
+    if (last_row < first_row || (last_row == first_row && last_offset < first_offset)) {
+        std::swap(first_row, last_row);
+        std::swap(first_offset, last_offset);
+    }
+
+    std::vector<std::string> replacement;
+    split_lines(text, replacement);
+    replacement.front().insert(0, lines[first_row], 0, first_offset);
+    replacement.back().append(lines[last_row], last_offset, std::string::npos);
+
+    size_t replaced = last_row - first_row + 1;
+    size_t shared = std::min(replaced, replacement.size());
+    for (size_t i = 0; i < shared; ++i)
+        lines[first_row + i].swap(replacement[i]);
+    if (replacement.size() > replaced)
+        lines.insert(lines.begin() + first_row + replaced, replacement.begin() + replaced, replacement.end());
+    else
+        lines.erase(lines.begin() + first_row + shared, lines.begin() + last_row + 1);
+}
+
+static void open_document(Handle<Value> params)
+{
+    Handle<Value> item = get(params, "textDocument");
+    Document& document = documents[to_string(get(item, "uri"))];
+    document.lines.clear();
+    split_lines(to_string(get(item, "text")), document.lines);
+    document.version = get(item, "version")->Int32Value();
+    document.dirty = true;
+    document.changed_at = now() - kDebounceMilliseconds;
+}
+
+static void change_document(Handle<Value> params)
+{
+    Handle<Value> item = get(params, "textDocument");
+    std::map<std::string, Document>::iterator found = documents.find(to_string(get(item, "uri")));
+    if (found == documents.end())
+        return;
+    Document& document = found->second;
+
+    Handle<Value> changes = get(params, "contentChanges");
+    if (changes->IsArray()) {
+        Handle<Array> list = Handle<Array>::Cast(changes);
+        for (unsigned i = 0; i < list->Length(); ++i) {
+            Handle<Value> change = list->Get(i);
+            Handle<Value> range = get(change, "range");
+            std::string text = to_string(get(change, "text"));
+            if (range->IsObject()) {
+                apply_edit(document, range, text);
+            } else {
+                document.lines.clear();
+                split_lines(text, document.lines);
+            }
+        }
+    }
+    document.version = get(item, "version")->Int32Value();
+    document.dirty = true;
+    document.changed_at = now();
+}
+
+// Saving lints what is pending right away.
+static void save_document(Handle<Value> params)
+{
+    std::string uri = to_string(get(get(params, "textDocument"), "uri"));
+    std::map<std::string, Document>::iterator found = documents.find(uri);
+    if (found != documents.end() && found->second.dirty)
+        found->second.changed_at = now() - kDebounceMilliseconds;
+}
+
+static void close_document(Handle<Value> params)
+{
+    std::string uri = to_string(get(get(params, "textDocument"), "uri"));
+    documents.erase(uri);
+    publish(uri, 0, Array::New());
+}
+
+static Handle<Value> capabilities()
+{
+    Handle<Object> save = Object::New();
+    save->Set(String::New("includeText"), False());
+    Handle<Object> sync = Object::New();
+    sync->Set(String::New("openClose"), True());
+    sync->Set(String::New("change"), Integer::New(2));
+    sync->Set(String::New("save"), save);
+    Handle<Object> capabilities = Object::New();
+    capabilities->Set(String::New("textDocumentSync"), sync);
+    Handle<Object> info = Object::New();
+    info->Set(String::New("name"), String::New(tool_name.c_str()));
+    Handle<Object> result = Object::New();
+    result->Set(String::New("capabilities"), capabilities);
+    result->Set(String::New("serverInfo"), info);
+    return result;
+}
+
+// Handles a message from the client. Returns true, and the exit status,
+// once the client says exit.
+static bool handle(const std::string& text, bool& shut_down, int& status)
+{
+    HandleScope handle_scope;
+    Handle<Value> message = parse(text);
+    if (message.IsEmpty() || !message->IsObject())
+        return false;
+
+    // Responses to requests of ours have no method; there are none.
+    std::string method = to_string(get(message, "method"));
+    if (method.empty())
+        return false;
+    Handle<Value> id = get(message, "id");
+    Handle<Value> params = get(message, "params");
+
+    if (method == "initialize") {
+        respond(id, capabilities());
+    } else if (method == "shutdown") {
+        shut_down = true;
+        respond(id, Null());
+    } else if (method == "exit") {
+        status = shut_down ? 0 : 1;
+        return true;
+    } else if (method == "textDocument/didOpen") {
+        open_document(params);
+    } else if (method == "textDocument/didChange") {
+        change_document(params);
+    } else if (method == "textDocument/didSave") {
+        save_document(params);
+    } else if (method == "textDocument/didClose") {
+        close_document(params);
+    } else if (!id->IsUndefined()) {
+        respond_error(id, kMethodNotFound, "Unhandled method " + method);
+    }
+    return false;
+}
+
+// The time until the next document is due to be linted, or -1 if none
+// has changed.
+static int next_lint()
+{
+    int wait = -1;
+    double time = now();
+    std::map<std::string, Document>::const_iterator i;
+    for (i = documents.begin(); i != documents.end(); ++i) {
+        if (!i->second.dirty)
+            continue;
+        int due = static_cast<int>(i->second.changed_at + kDebounceMilliseconds - time);
+        due = std::max(due, 0);
+        if (wait < 0 || due < wait)
+            wait = due;
+    }
+    return wait;
+}
+
+// Lints a document that is due, if any.
+static void lint_due()
+{
+    double time = now();
+    std::map<std::string, Document>::iterator i;
+    for (i = documents.begin(); i != documents.end(); ++i) {
+        if (i->second.dirty && i->second.changed_at + kDebounceMilliseconds <= time) {
+            lint_document(i->first, i->second);
+            return;
+        }
+    }
+}
+
+int lsp_run(const std::string& tool, Handle<Function> lint, Handle<Value> options)
+{
+    tool_name = tool;
+    linter = Persistent<Function>::New(lint);
+    lint_options = Persistent<Value>::New(options);
+    isolate = Isolate::GetCurrent();
+    start_reader();
+
+    bool shut_down = false;
+    for (;;) {
+        // Messages come first: they may change what is due.
+        lock_inbox();
+        while (inbox.empty() && !input_closed) {
+            int wait = next_lint();
+            if (wait == 0)
+                break;
+            wait_for_input(wait);
+        }
+        std::string message;
+        bool received = !inbox.empty();
+        if (received) {
+            message.swap(inbox.front());
+            inbox.pop_front();
+        }
+        bool closed = input_closed;
+        unlock_inbox();
+
+        if (received) {
+            int status = 0;
+            if (handle(message, shut_down, status))
+                return status;
+            continue;
+        }
+        if (closed)
+            return 1;
+        lint_due();
+    }
+}
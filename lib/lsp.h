@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_LSP_H
+#define EIGHTPACK_LSP_H
+
+#include <v8.h>
+
+#include <string>
+
+// Language server for --lsp: speaks the Language Server Protocol on the
+// standard input and output, keeps the open documents in memory and
+// publishes the problems the linter finds in them. A document is linted
+// once its edits have settled for a moment; a lint that is still running
+// when the document changes again is terminated and started over.
+
+void lsp_enable();
+bool lsp_enabled();
+
+// Serves until the client says exit and returns the exit status. The
+// documents are linted, with the current --timeout budget each, by
+// calling lint(lines, options) and reading lint.errors, as JSHINT and
+// JSLINT have it. Needs a live V8 context.
+int lsp_run(const std::string& tool, v8::Handle<v8::Function> lint, v8::Handle<v8::Value> options);
+
+#endif
@@ -0,0 +1,344 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "prefork.h"
+
+#include <v8.h>
+
+#include <algorithm>
+#include <iostream>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace v8;
+
+static int workers = 0;
+static int recycle_inputs = 1000;
+static int recycle_heap = 256 * 1024 * 1024;
+
+void prefork_set_workers(int count)
+{
+    workers = count;
+}
+
+int prefork_workers()
+{
+    return workers;
+}
+
+void prefork_set_recycle_inputs(int inputs)
+{
+    recycle_inputs = inputs;
+}
+
+void prefork_set_recycle_heap(int bytes)
+{
+    recycle_heap = bytes;
+}
+
+#ifdef _WIN32
+
+// Without fork, the inputs are run in turn in this process, which still
+// sets up V8 and the tool script only once.
+int prefork_run(const std::vector<std::string>& inputs, PreforkHandler handler, const PreforkReports&)
+{
+    int status = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        std::string output;
+        int result = handler(inputs[i], output);
+        std::cout << output << std::flush;
+        if (!status)
+            status = result;
+    }
+    return status;
+}
+
+#else
+
+// What a worker sends back for each input, followed by the output and
+// the report.
+struct Result
+{
+    int input;
+    int status;
+    int length;
+    int report;
+    int recycle;
+};
+
+struct Worker
+{
+    pid_t pid;
+    int requests;
+    int results;
+    int input;
+};
+
+static bool read_all(int fd, void* data, size_t length)
+{
+    char* p = static_cast<char*>(data);
+    while (length > 0) {
+        ssize_t count = read(fd, p, length);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        p += count;
+        length -= count;
+    }
+    return true;
+}
+
+static bool write_all(int fd, const void* data, size_t length)
+{
+    const char* p = static_cast<const char*>(data);
+    while (length > 0) {
+        ssize_t count = write(fd, p, length);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        p += count;
+        length -= count;
+    }
+    return true;
+}
+
+static size_t heap_size()
+{
+    HeapStatistics statistics;
+    V8::GetHeapStatistics(&statistics);
+    return statistics.total_heap_size();
+}
+
+// The worker side: runs the inputs whose indices come in on requests
+// until there are no more or it is time to make way for a fresh fork.
+static void serve(int requests, int results, const std::vector<std::string>& inputs,
+                  PreforkHandler handler, const PreforkReports& reports)
+{
+    reports.reset();
+    size_t baseline = heap_size();
+    int handled = 0;
+    int index;
+    while (read_all(requests, &index, sizeof(index))) {
+        std::string output;
+        Result result;
+        result.input = index;
+        result.status = handler(inputs[index], output);
+        result.length = output.length();
+        std::string report = reports.take();
+        result.report = report.length();
+        ++handled;
+        result.recycle = handled >= recycle_inputs || heap_size() > baseline + recycle_heap;
+        if (!write_all(results, &result, sizeof(result)) || !write_all(results, output.data(), output.length())
+            || !write_all(results, report.data(), report.length()))
+            break;
+        if (result.recycle)
+            break;
+    }
+    // Leave without the exit handlers, which belong to the parent.
+    _exit(0);
+}
+
+static bool start(Worker& worker, std::vector<Worker>& pool, const std::vector<std::string>& inputs,
+                  PreforkHandler handler, const PreforkReports& reports)
+{
+    int requests[2];
+    int results[2];
+    if (pipe(requests) < 0)
+        return false;
+    if (pipe(results) < 0) {
+        close(requests[0]);
+        close(requests[1]);
+        return false;
+    }
+
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(requests[0]);
+        close(requests[1]);
+        close(results[0]);
+        close(results[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        // The other workers must see the end of their pipes when the
+        // parent closes them, so their ends don't stay open in here.
+        for (size_t i = 0; i < pool.size(); ++i) {
+            if (pool[i].pid > 0) {
+                if (pool[i].requests >= 0)
+                    close(pool[i].requests);
+                close(pool[i].results);
+            }
+        }
+        close(requests[1]);
+        close(results[0]);
+        serve(requests[0], results[1], inputs, handler, reports);
+    }
+
+    close(requests[0]);
+    close(results[1]);
+    worker.pid = pid;
+    worker.requests = requests[1];
+    worker.results = results[0];
+    worker.input = -1;
+    return true;
+}
+
+static void stop(Worker& worker)
+{
+    if (worker.requests >= 0)
+        close(worker.requests);
+    close(worker.results);
+    while (waitpid(worker.pid, 0, 0) < 0 && errno == EINTR) {
+    }
+    worker.pid = 0;
+}
+
+// Gives the worker the next input, or lets it go when there is none.
+static void dispatch(Worker& worker, size_t& next, size_t count)
+{
+    if (next < count) {
+        int index = next++;
+        if (write_all(worker.requests, &index, sizeof(index))) {
+            worker.input = index;
+            return;
+        }
+        --next;
+    }
+    close(worker.requests);
+    worker.requests = -1;
+}
+
+int prefork_run(const std::vector<std::string>& inputs, PreforkHandler handler, const PreforkReports& reports)
+{
+    // A worker that dies would otherwise take the parent along when it
+    // is handed its next input.
+    signal(SIGPIPE, SIG_IGN);
+
+    size_t count = inputs.size();
+    std::vector<std::string> outputs(count);
+    std::vector<int> statuses(count);
+    std::vector<bool> done(count, false);
+    size_t next = 0;
+    size_t printed = 0;
+    int status = 0;
+
+    std::vector<Worker> pool(std::min(static_cast<size_t>(workers), count));
+    for (size_t i = 0; i < pool.size(); ++i)
+        pool[i].pid = 0;
+    for (size_t i = 0; i < pool.size(); ++i) {
+        if (!start(pool[i], pool, inputs, handler, reports)) {
+            std::cerr << "Error: unable to start the workers" << std::endl;
+            return 1;
+        }
+        dispatch(pool[i], next, count);
+    }
+
+    while (printed < count) {
+        std::vector<pollfd> fds;
+        std::vector<size_t> owners;
+        for (size_t i = 0; i < pool.size(); ++i) {
+            if (pool[i].pid > 0) {
+                pollfd fd = { pool[i].results, POLLIN, 0 };
+                fds.push_back(fd);
+                owners.push_back(i);
+            }
+        }
+        if (fds.empty())
+            break;
+        if (poll(&fds[0], fds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (size_t f = 0; f < fds.size(); ++f) {
+            if (!fds[f].revents)
+                continue;
+            Worker& worker = pool[owners[f]];
+            Result result;
+            bool recycle = true;
+            if (read_all(worker.results, &result, sizeof(result))) {
+                std::string& output = outputs[result.input];
+                output.resize(result.length);
+                if (result.length)
+                    read_all(worker.results, &output[0], result.length);
+                if (result.report) {
+                    std::string report(result.report, '\0');
+                    if (read_all(worker.results, &report[0], result.report))
+                        reports.merge(report);
+                }
+                statuses[result.input] = result.status;
+                done[result.input] = true;
+                worker.input = -1;
+                recycle = result.recycle;
+            } else if (worker.input >= 0) {
+                std::cerr << "Error: " << inputs[worker.input] << ": the worker died" << std::endl;
+                statuses[worker.input] = 1;
+                done[worker.input] = true;
+            }
+
+            if (!recycle) {
+                dispatch(worker, next, count);
+                continue;
+            }
+            stop(worker);
+            if (next < count) {
+                if (start(worker, pool, inputs, handler, reports))
+                    dispatch(worker, next, count);
+                else
+                    std::cerr << "Error: unable to start a worker" << std::endl;
+            }
+        }
+
+        while (printed < count && done[printed]) {
+            std::cout << outputs[printed] << std::flush;
+            std::string().swap(outputs[printed]);
+            if (!status)
+                status = statuses[printed];
+            ++printed;
+        }
+    }
+
+    for (size_t i = 0; i < pool.size(); ++i) {
+        if (pool[i].pid > 0)
+            stop(pool[i]);
+    }
+    if (printed < count) {
+        std::cerr << "Error: " << count - printed << " input(s) were not run" << std::endl;
+        if (!status)
+            status = 1;
+    }
+    return status;
+}
+
+#endif
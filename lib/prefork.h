@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_PREFORK_H
+#define EIGHTPACK_PREFORK_H
+
+#include <string>
+#include <vector>
+
+// Worker processes for --prefork: the runner sets up V8 and the tool
+// script once, then forks workers which inherit that warm heap and run
+// one input after another. The parent hands out the inputs and prints
+// the output of each, in the order the inputs were given.
+
+// Runs the tool on one input, collecting its output rather than printing
+// it, and returns the exit status of the run.
+typedef int (*PreforkHandler)(const std::string& input, std::string& output);
+
+// What the runner options collect, e.g. for --stats. A fresh worker
+// resets what it inherited from the parent, then takes a report after
+// each input, which goes back with the output for the parent to merge
+// into its own.
+struct PreforkReports
+{
+    void (*reset)();
+    std::string (*take)();
+    void (*merge)(const std::string& report);
+};
+
+// The number of workers; zero, the default, runs the tool the usual way.
+void prefork_set_workers(int workers);
+int prefork_workers();
+
+// A worker is replaced by a fresh fork after this many inputs, or once
+// its heap has grown by this many bytes, whichever comes first.
+void prefork_set_recycle_inputs(int inputs);
+void prefork_set_recycle_heap(int bytes);
+
+// Runs every input through the handler in the workers and prints the
+// outputs. Returns the first non-zero exit status, in input order.
+int prefork_run(const std::vector<std::string>& inputs, PreforkHandler handler, const PreforkReports& reports);
+
+#endif
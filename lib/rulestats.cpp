@@ -0,0 +1,203 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "rulestats.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace v8;
+
+struct RuleCost
+{
+    std::string name;
+    double count;
+    double time;
+};
+
+static bool enabled = false;
+static Persistent<Object> rules;
+
+static double now()
+{
+#ifdef _MSC_VER
+    static LARGE_INTEGER frequency;
+    if (!frequency.QuadPart)
+        QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return 1000.0 * counter.QuadPart / frequency.QuadPart;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static Handle<Value> system_now(const Arguments& args)
+{
+    return Number::New(now());
+}
+
+static bool more_expensive(const RuleCost& a, const RuleCost& b)
+{
+    if (a.time != b.time)
+        return a.time > b.time;
+    return a.name < b.name;
+}
+
+void rule_stats_enable()
+{
+    enabled = true;
+}
+
+void rule_stats_install(Handle<Object> system)
+{
+    system->Set(String::New("now"), FunctionTemplate::New(system_now)->GetFunction());
+    if (!enabled)
+        return;
+    rules = Persistent<Object>::New(Object::New());
+    system->Set(String::New("rules"), rules);
+}
+
+void rule_stats_finish()
+{
+    if (rules.IsEmpty())
+        return;
+
+    HandleScope handle_scope;
+    Handle<String> countName = String::New("count");
+    Handle<String> timeName = String::New("time");
+
+    // Entries look like { count: 12, time: 0.345 }, keyed by rule name.
+    std::vector<RuleCost> costs;
+    Handle<Array> names = rules->GetPropertyNames();
+    for (uint32_t i = 0; i < names->Length(); ++i) {
+        Handle<Value> name = names->Get(i);
+        Handle<Value> entry = rules->Get(name);
+        if (!entry->IsObject())
+            continue;
+        RuleCost cost;
+        cost.name = *String::Utf8Value(name);
+        cost.count = entry->ToObject()->Get(countName)->NumberValue();
+        cost.time = entry->ToObject()->Get(timeName)->NumberValue();
+        costs.push_back(cost);
+    }
+    rules.Dispose();
+    rules.Clear();
+
+    std::sort(costs.begin(), costs.end(), more_expensive);
+
+    double total = 0;
+    for (size_t i = 0; i < costs.size(); ++i)
+        total += costs[i].time;
+
+    fprintf(stderr, "%-48s %10s %12s %10s %7s\n", "Rule", "Calls", "Time (ms)", "Avg (us)", "Share");
+    for (size_t i = 0; i < costs.size(); ++i) {
+        const RuleCost& cost = costs[i];
+        double average = cost.count ? 1000 * cost.time / cost.count : 0;
+        double share = total ? 100 * cost.time / total : 0;
+        fprintf(stderr, "%-48s %10.0f %12.3f %10.3f %6.1f%%\n",
+                cost.name.c_str(), cost.count, cost.time, average, share);
+    }
+    fprintf(stderr, "%-48s %10s %12.3f\n", "total", "", total);
+}
+
+// The script keeps looking the entries up by name, so they are zeroed
+// in place.
+void rule_stats_reset()
+{
+    rule_stats_take();
+}
+
+// One entry per line, its name last.
+std::string rule_stats_take()
+{
+    if (rules.IsEmpty())
+        return std::string();
+
+    HandleScope handle_scope;
+    Handle<String> countName = String::New("count");
+    Handle<String> timeName = String::New("time");
+
+    std::ostringstream out;
+    char buffer[64];
+    Handle<Array> names = rules->GetPropertyNames();
+    for (uint32_t i = 0; i < names->Length(); ++i) {
+        Handle<Value> name = names->Get(i);
+        Handle<Value> entry = rules->Get(name);
+        if (!entry->IsObject())
+            continue;
+        Handle<Object> cost = entry->ToObject();
+        double count = cost->Get(countName)->NumberValue();
+        double time = cost->Get(timeName)->NumberValue();
+        if (count == 0 && time == 0)
+            continue;
+        sprintf(buffer, "%.17g %.17g ", count, time);
+        out << buffer << *String::Utf8Value(name) << '\n';
+        cost->Set(countName, Number::New(0));
+        cost->Set(timeName, Number::New(0));
+    }
+    return out.str();
+}
+
+void rule_stats_merge(const std::string& report)
+{
+    if (rules.IsEmpty())
+        return;
+
+    HandleScope handle_scope;
+    Handle<String> countName = String::New("count");
+    Handle<String> timeName = String::New("time");
+
+    std::istringstream lines(report);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream in(line);
+        double count;
+        double time;
+        std::string name;
+        if (!(in >> count >> time >> std::ws) || !std::getline(in, name))
+            continue;
+        Handle<String> key = String::New(name.c_str());
+        Handle<Value> entry = rules->Get(key);
+        if (!entry->IsObject()) {
+            entry = Object::New();
+            entry->ToObject()->Set(countName, Number::New(0));
+            entry->ToObject()->Set(timeName, Number::New(0));
+            rules->Set(key, entry);
+        }
+        Handle<Object> cost = entry->ToObject();
+        cost->Set(countName, Number::New(cost->Get(countName)->NumberValue() + count));
+        cost->Set(timeName, Number::New(cost->Get(timeName)->NumberValue() + time));
+    }
+}
@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_RULESTATS_H
+#define EIGHTPACK_RULESTATS_H
+
+#include <v8.h>
+
+#include <string>
+
+// Per-rule cost accounting for --rule-stats. The tool script charges
+// time and invocation counts to its lint rules, warnings and lexer
+// phases in system.rules, timed with system.now(); the breakdown goes
+// to stderr, most expensive first, when the run finishes.
+
+void rule_stats_enable();
+
+// Adds system.now(), a high resolution clock in milliseconds, and, when
+// enabled, the system.rules object the script fills in.
+void rule_stats_install(v8::Handle<v8::Object> system);
+
+// Prints the breakdown. Needs a live V8 context; prints only once.
+void rule_stats_finish();
+
+// For --prefork: a worker starts over from zero, then takes what its
+// rules cost after each input for the parent to add to its own.
+void rule_stats_reset();
+std::string rule_stats_take();
+void rule_stats_merge(const std::string& report);
+
+#endif
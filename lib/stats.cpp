@@ -0,0 +1,419 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "stats.h"
+
+#include "json.h"
+#include "traceevents.h"
+
+#include <v8.h>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+using namespace v8;
+
+struct PhaseTime
+{
+    double wall;
+    double cpu;
+};
+
+struct HeapPeaks
+{
+    size_t total;
+    size_t used;
+    size_t external;
+    int scavenges;
+    int mark_sweeps;
+};
+
+struct Histogram
+{
+    int count;
+    long long sum;
+    int min;
+    int max;
+};
+
+static const char* phase_names[StatsPhaseCount] = {
+    "initialize",
+    "setup",
+    "context",
+    "compile",
+    "execute",
+    "read",
+    "print"
+};
+
+static bool enabled = false;
+static StatsFormat report_format = StatsTable;
+static PhaseTime phase_times[StatsPhaseCount];
+static std::vector<StatsPhase> phase_stack;
+static PhaseTime last_mark;
+
+// Wall clock times, comparable across processes, at which collecting
+// started and the first output was printed. Zero if it never was.
+static double started_at = 0;
+static double first_output_at = 0;
+
+static HeapPeaks heap_peaks;
+
+// Both maps hand out pointers to their values, which std::map keeps
+// stable as entries are added.
+static std::map<std::string, int> counters;
+static std::map<std::string, Histogram> histograms;
+
+static double wall_time()
+{
+#ifdef _MSC_VER
+    return GetTickCount();
+#else
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+#endif
+}
+
+static double cpu_time()
+{
+    return 1000.0 * clock() / CLOCKS_PER_SEC;
+}
+
+// Charges the time since the previous mark to the innermost phase.
+static void mark()
+{
+    PhaseTime now;
+    now.wall = wall_time();
+    now.cpu = cpu_time();
+    if (!phase_stack.empty()) {
+        PhaseTime& time = phase_times[phase_stack.back()];
+        time.wall += now.wall - last_mark.wall;
+        time.cpu += now.cpu - last_mark.cpu;
+    }
+    last_mark = now;
+}
+
+static int* lookup_counter(const char* name)
+{
+    return &counters[name];
+}
+
+static void* create_histogram(const char* name, int min, int max, size_t buckets)
+{
+    Histogram& histogram = histograms[name];
+    histogram.count = 0;
+    histogram.sum = 0;
+    histogram.min = 0;
+    histogram.max = 0;
+    return &histogram;
+}
+
+static void add_histogram_sample(void* data, int sample)
+{
+    Histogram* histogram = static_cast<Histogram*>(data);
+    if (histogram->count == 0 || sample < histogram->min)
+        histogram->min = sample;
+    if (histogram->count == 0 || sample > histogram->max)
+        histogram->max = sample;
+    histogram->count++;
+    histogram->sum += sample;
+}
+
+static void print_table()
+{
+    PhaseTime total = { 0, 0 };
+    fprintf(stderr, "%-40s %12s %12s\n", "Phase", "Wall (ms)", "CPU (ms)");
+    for (int i = 0; i < StatsPhaseCount; ++i) {
+        fprintf(stderr, "%-40s %12.3f %12.3f\n", phase_names[i], phase_times[i].wall, phase_times[i].cpu);
+        total.wall += phase_times[i].wall;
+        total.cpu += phase_times[i].cpu;
+    }
+    fprintf(stderr, "%-40s %12.3f %12.3f\n", "total", total.wall, total.cpu);
+
+    fprintf(stderr, "\n%-40s %12s\n", "Heap", "Value");
+    fprintf(stderr, "%-40s %12d\n", "peak total (KB)", static_cast<int>(heap_peaks.total / 1024));
+    fprintf(stderr, "%-40s %12d\n", "peak used (KB)", static_cast<int>(heap_peaks.used / 1024));
+    fprintf(stderr, "%-40s %12d\n", "peak external (KB)", static_cast<int>(heap_peaks.external / 1024));
+    fprintf(stderr, "%-40s %12d\n", "scavenges", heap_peaks.scavenges);
+    fprintf(stderr, "%-40s %12d\n", "mark-sweeps", heap_peaks.mark_sweeps);
+
+    fprintf(stderr, "\n%-40s %12s\n", "Counter", "Value");
+    std::map<std::string, int>::const_iterator c;
+    for (c = counters.begin(); c != counters.end(); ++c) {
+        if (c->second != 0)
+            fprintf(stderr, "%-40s %12d\n", c->first.c_str(), c->second);
+    }
+
+    fprintf(stderr, "\n%-40s %12s %12s %8s %8s\n", "Histogram", "Count", "Total", "Min", "Max");
+    std::map<std::string, Histogram>::const_iterator h;
+    for (h = histograms.begin(); h != histograms.end(); ++h) {
+        const Histogram& histogram = h->second;
+        if (histogram.count != 0)
+            fprintf(stderr, "%-40s %12d %12lld %8d %8d\n", h->first.c_str(),
+                    histogram.count, histogram.sum, histogram.min, histogram.max);
+    }
+}
+
+static void print_json()
+{
+    fprintf(stderr, "{\n  \"phases\": {");
+    for (int i = 0; i < StatsPhaseCount; ++i) {
+        fprintf(stderr, "%s\n    \"%s\": { \"wall\": %.3f, \"cpu\": %.3f }", i ? "," : "",
+                phase_names[i], phase_times[i].wall, phase_times[i].cpu);
+    }
+
+    fprintf(stderr, "\n  },\n  \"heap\": {");
+    fprintf(stderr, "\n    \"peak_total\": %lu,", static_cast<unsigned long>(heap_peaks.total));
+    fprintf(stderr, "\n    \"peak_used\": %lu,", static_cast<unsigned long>(heap_peaks.used));
+    fprintf(stderr, "\n    \"peak_external\": %lu,", static_cast<unsigned long>(heap_peaks.external));
+    fprintf(stderr, "\n    \"scavenges\": %d,", heap_peaks.scavenges);
+    fprintf(stderr, "\n    \"mark_sweeps\": %d", heap_peaks.mark_sweeps);
+
+    fprintf(stderr, "\n  },\n  \"counters\": {");
+    bool first = true;
+    std::map<std::string, int>::const_iterator c;
+    for (c = counters.begin(); c != counters.end(); ++c) {
+        if (c->second == 0)
+            continue;
+        fprintf(stderr, "%s\n    %s: %d", first ? "" : ",", json_quote(c->first).c_str(), c->second);
+        first = false;
+    }
+
+    fprintf(stderr, "\n  },\n  \"histograms\": {");
+    first = true;
+    std::map<std::string, Histogram>::const_iterator h;
+    for (h = histograms.begin(); h != histograms.end(); ++h) {
+        const Histogram& histogram = h->second;
+        if (histogram.count == 0)
+            continue;
+        fprintf(stderr, "%s\n    %s: { \"count\": %d, \"total\": %lld, \"min\": %d, \"max\": %d }",
+                first ? "" : ",", json_quote(h->first).c_str(),
+                histogram.count, histogram.sum, histogram.min, histogram.max);
+        first = false;
+    }
+
+    fprintf(stderr, "\n  },\n  \"milestones\": {");
+    fprintf(stderr, "\n    \"start\": %.3f,", started_at);
+    if (first_output_at)
+        fprintf(stderr, "\n    \"first_output\": %.3f,", first_output_at);
+    fprintf(stderr, "\n    \"exit\": %.3f", last_mark.wall);
+    fprintf(stderr, "\n  }\n}\n");
+}
+
+// Runs at exit, which is also how system.exit() leaves, so phases that
+// are still open get their time up to this point.
+static void report()
+{
+    mark();
+    if (report_format == StatsJson)
+        print_json();
+    else
+        print_table();
+}
+
+void stats_enable(StatsFormat format)
+{
+    if (enabled)
+        return;
+    enabled = true;
+    report_format = format;
+
+    V8::SetCounterFunction(lookup_counter);
+    V8::SetCreateHistogramFunction(create_histogram);
+    V8::SetAddHistogramSampleFunction(add_histogram_sample);
+
+    last_mark.wall = wall_time();
+    last_mark.cpu = cpu_time();
+    started_at = last_mark.wall;
+    atexit(report);
+}
+
+void stats_begin(StatsPhase phase, const char* detail)
+{
+    trace_event_begin(phase_names[phase], detail);
+    if (!enabled)
+        return;
+    mark();
+    if (phase == StatsPrint && !first_output_at)
+        first_output_at = last_mark.wall;
+    phase_stack.push_back(phase);
+}
+
+void stats_end()
+{
+    trace_event_end();
+    if (!enabled)
+        return;
+    mark();
+    phase_stack.pop_back();
+}
+
+static void before_gc(GCType type, GCCallbackFlags flags)
+{
+    if (type == kGCTypeScavenge)
+        heap_peaks.scavenges++;
+    else
+        heap_peaks.mark_sweeps++;
+    stats_sample_heap();
+}
+
+void stats_watch_heap()
+{
+    if (!enabled)
+        return;
+    V8::AddGCPrologueCallback(before_gc);
+    stats_sample_heap();
+}
+
+void stats_sample_heap()
+{
+    if (!enabled)
+        return;
+    HeapStatistics statistics;
+    V8::GetHeapStatistics(&statistics);
+    heap_peaks.total = std::max(heap_peaks.total, statistics.total_heap_size());
+    heap_peaks.used = std::max(heap_peaks.used, statistics.used_heap_size());
+    heap_peaks.external = std::max(heap_peaks.external, statistics.external_memory_size());
+}
+
+void stats_reset()
+{
+    if (!enabled)
+        return;
+    for (int i = 0; i < StatsPhaseCount; ++i) {
+        phase_times[i].wall = 0;
+        phase_times[i].cpu = 0;
+    }
+    phase_stack.clear();
+    last_mark.wall = wall_time();
+    last_mark.cpu = cpu_time();
+    heap_peaks = HeapPeaks();
+
+    // V8 holds on to the counters and histograms, so they are zeroed in
+    // place rather than dropped.
+    std::map<std::string, int>::iterator c;
+    for (c = counters.begin(); c != counters.end(); ++c)
+        c->second = 0;
+    std::map<std::string, Histogram>::iterator h;
+    for (h = histograms.begin(); h != histograms.end(); ++h) {
+        h->second.count = 0;
+        h->second.sum = 0;
+    }
+}
+
+// One item per line, its name last, since names may have spaces.
+std::string stats_take()
+{
+    if (!enabled)
+        return std::string();
+    mark();
+    stats_sample_heap();
+
+    std::ostringstream out;
+    char buffer[128];
+    for (int i = 0; i < StatsPhaseCount; ++i) {
+        sprintf(buffer, "phase %d %.17g %.17g\n", i, phase_times[i].wall, phase_times[i].cpu);
+        out << buffer;
+    }
+    sprintf(buffer, "heap %lu %lu %lu %d %d\n", static_cast<unsigned long>(heap_peaks.total),
+            static_cast<unsigned long>(heap_peaks.used), static_cast<unsigned long>(heap_peaks.external),
+            heap_peaks.scavenges, heap_peaks.mark_sweeps);
+    out << buffer;
+    std::map<std::string, int>::const_iterator c;
+    for (c = counters.begin(); c != counters.end(); ++c) {
+        if (c->second != 0)
+            out << "counter " << c->second << ' ' << c->first << '\n';
+    }
+    std::map<std::string, Histogram>::const_iterator h;
+    for (h = histograms.begin(); h != histograms.end(); ++h) {
+        const Histogram& histogram = h->second;
+        if (histogram.count != 0) {
+            out << "histogram " << histogram.count << ' ' << histogram.sum << ' ' << histogram.min
+                << ' ' << histogram.max << ' ' << h->first << '\n';
+        }
+    }
+
+    std::string report = out.str();
+    stats_reset();
+    return report;
+}
+
+void stats_merge(const std::string& report)
+{
+    if (!enabled)
+        return;
+    std::istringstream lines(report);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream in(line);
+        std::string kind;
+        std::string name;
+        in >> kind;
+        if (kind == "phase") {
+            int phase;
+            PhaseTime time;
+            if (in >> phase >> time.wall >> time.cpu && phase >= 0 && phase < StatsPhaseCount) {
+                phase_times[phase].wall += time.wall;
+                phase_times[phase].cpu += time.cpu;
+            }
+        } else if (kind == "heap") {
+            unsigned long total, used, external;
+            int scavenges, mark_sweeps;
+            if (in >> total >> used >> external >> scavenges >> mark_sweeps) {
+                heap_peaks.total = std::max(heap_peaks.total, static_cast<size_t>(total));
+                heap_peaks.used = std::max(heap_peaks.used, static_cast<size_t>(used));
+                heap_peaks.external = std::max(heap_peaks.external, static_cast<size_t>(external));
+                heap_peaks.scavenges += scavenges;
+                heap_peaks.mark_sweeps += mark_sweeps;
+            }
+        } else if (kind == "counter") {
+            int value;
+            if (in >> value >> std::ws && std::getline(in, name))
+                counters[name] += value;
+        } else if (kind == "histogram") {
+            Histogram sample;
+            if (in >> sample.count >> sample.sum >> sample.min >> sample.max >> std::ws && std::getline(in, name)) {
+                Histogram& histogram = histograms[name];
+                if (histogram.count == 0 || sample.min < histogram.min)
+                    histogram.min = sample.min;
+                if (histogram.count == 0 || sample.max > histogram.max)
+                    histogram.max = sample.max;
+                histogram.count += sample.count;
+                histogram.sum += sample.sum;
+            }
+        }
+    }
+}
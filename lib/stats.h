@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_STATS_H
+#define EIGHTPACK_STATS_H
+
+#include <string>
+
+// Run statistics for --stats: wall and CPU time spent in each phase of
+// a run, plus the counters and histograms V8 maintains internally.
+
+enum StatsPhase {
+    StatsInitialize,
+    StatsSetup,
+    StatsContext,
+    StatsCompile,
+    StatsExecute,
+    StatsRead,
+    StatsPrint,
+    StatsPhaseCount
+};
+
+enum StatsFormat {
+    StatsTable,
+    StatsJson
+};
+
+// Starts collecting; must be called before V8::Initialize so that the
+// counter and histogram callbacks are in place. The report is printed
+// to stderr when the process exits.
+void stats_enable(StatsFormat format);
+
+// Time is charged to the innermost phase only, so that nested phases
+// (reading a file while executing the script) are not counted twice.
+// Phases also make up the spans of --trace-events, where the detail,
+// such as the name of the file read, is shown with the span.
+void stats_begin(StatsPhase phase, const char* detail = 0);
+void stats_end();
+
+// Keeps the peak size of the heap for the report. Once V8 is initialized,
+// stats_watch_heap samples it before every collection, which it also
+// counts; stats_sample_heap samples it right away, e.g. at the end of a
+// run, before V8 is disposed.
+void stats_watch_heap();
+void stats_sample_heap();
+
+// For --prefork: a worker starts over from zero, then takes what it
+// collected after each input for the parent to add to its own report.
+// Times add up, heap peaks keep the largest.
+void stats_reset();
+std::string stats_take();
+void stats_merge(const std::string& report);
+
+class StatsScope
+{
+public:
+    StatsScope(StatsPhase phase, const char* detail = 0) { stats_begin(phase, detail); }
+    ~StatsScope() { stats_end(); }
+};
+
+#endif
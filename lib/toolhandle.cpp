@@ -0,0 +1,212 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "toolhandle.h"
+
+#include "traceevents.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace v8;
+
+namespace eightpack {
+
+static ToolHandle* handle_of(const Arguments& args)
+{
+    return static_cast<ToolHandle*>(External::Unwrap(args.Data()));
+}
+
+Handle<Value> ToolHandle::log(const Arguments& args)
+{
+    HandleScope handle_scope;
+    ToolHandle* handle = handle_of(args);
+    for (int i = 0; i < args.Length(); i++) {
+        String::Utf8Value value(args[i]);
+        handle->m_printed.append(*value);
+        if (i < args.Length() - 1)
+            handle->m_printed.append(1, ' ');
+    }
+    handle->m_printed.append(1, '\n');
+    return Undefined();
+}
+
+// Ends the script, which can't catch that, rather than the process.
+Handle<Value> ToolHandle::exit(const Arguments& args)
+{
+    handle_of(args)->m_exited = true;
+    V8::TerminateExecution(Isolate::GetCurrent());
+    return Undefined();
+}
+
+// The file is the empty one the setup passes.
+Handle<Value> ToolHandle::read_file(const Arguments& args)
+{
+    return String::Empty();
+}
+
+ToolHandle::ToolHandle()
+    : m_exited(false)
+{
+    m_isolate = Isolate::New();
+    Isolate::Scope isolate_scope(m_isolate);
+    trace_events_watch_isolate();
+    HandleScope handle_scope;
+    m_context = Context::New();
+    Context::Scope context_scope(m_context);
+
+    Handle<External> self = External::New(this);
+    Handle<Object> system = Object::New();
+    system->Set(String::New("exit"), FunctionTemplate::New(exit, self)->GetFunction());
+    system->Set(String::New("readFile"), FunctionTemplate::New(read_file, self)->GetFunction());
+    m_context->Global()->Set(String::New("system"), system);
+    m_system = Persistent<Object>::New(system);
+
+    Handle<Object> console = Object::New();
+    console->Set(String::New("log"), FunctionTemplate::New(log, self)->GetFunction());
+    m_context->Global()->Set(String::New("console"), console);
+}
+
+ToolHandle::~ToolHandle()
+{
+    {
+        Isolate::Scope isolate_scope(m_isolate);
+        std::map<const ToolScript*, std::map<std::string, Persistent<Function> > >::iterator tool;
+        for (tool = m_runners.begin(); tool != m_runners.end(); ++tool) {
+            std::map<std::string, Persistent<Function> >::iterator i;
+            for (i = tool->second.begin(); i != tool->second.end(); ++i)
+                i->second.Dispose();
+        }
+        std::map<const ToolScript*, Persistent<Function> >::iterator setup;
+        for (setup = m_setups.begin(); setup != m_setups.end(); ++setup)
+            setup->second.Dispose();
+        m_system.Dispose();
+        m_context.Dispose();
+    }
+    m_isolate->Dispose();
+}
+
+Handle<Function> ToolHandle::setup(const ToolScript& script)
+{
+    std::map<const ToolScript*, Persistent<Function> >::iterator found = m_setups.find(&script);
+    if (found != m_setups.end())
+        return found->second;
+
+    std::string source = "(function () {";
+    source += script.script;
+    source += "\nreturn function (input) { ";
+    source += script.call;
+    source += " };\n})";
+    std::string name = std::string(script.name) + ".js";
+    Handle<Script> compiled = Script::Compile(String::New(source.data(), source.length()), String::New(name.c_str()));
+    if (compiled.IsEmpty())
+        return Handle<Function>();
+    Persistent<Function> function = Persistent<Function>::New(Handle<Function>::Cast(compiled->Run()));
+    m_setups[&script] = function;
+    return function;
+}
+
+// Each set of options is parsed once, by running the script with them.
+Handle<Function> ToolHandle::runner(const ToolScript& tool, const Options& options)
+{
+    std::string key;
+    for (size_t i = 0; i < options.size(); ++i)
+        key += options[i] + '\n';
+    std::map<std::string, Persistent<Function> >& runners = m_runners[&tool];
+    std::map<std::string, Persistent<Function> >::iterator found = runners.find(key);
+    if (found != runners.end())
+        return found->second;
+
+    Handle<Function> function = setup(tool);
+    if (function.IsEmpty()) {
+        m_error = "Error: unable to bootstrap!";
+        return Handle<Function>();
+    }
+
+    Handle<Array> args = Array::New();
+    for (size_t i = 0; i < options.size(); ++i)
+        args->Set(i, String::New(options[i].c_str()));
+    args->Set(options.size(), String::Empty());
+    m_system->Set(String::New("args"), args);
+
+    m_printed.clear();
+    m_exited = false;
+    TryCatch try_catch;
+    Handle<Value> result = function->Call(m_context->Global(), 0, 0);
+    if (m_exited) {
+        V8::CancelTerminateExecution(m_isolate);
+        m_exited = false;
+        m_error = m_printed;
+        return Handle<Function>();
+    }
+    if (result.IsEmpty() || !result->IsFunction()) {
+        m_error = "Error: unable to bootstrap!";
+        return Handle<Function>();
+    }
+
+    Persistent<Function> persistent = Persistent<Function>::New(Handle<Function>::Cast(result));
+    runners[key] = persistent;
+    return persistent;
+}
+
+Handle<Value> ToolHandle::run(const ToolScript& tool, Handle<Value> input, const Options& options)
+{
+    m_error.clear();
+    Handle<Function> function = runner(tool, options);
+    if (function.IsEmpty())
+        return Handle<Value>();
+
+    m_printed.clear();
+    m_exited = false;
+    TryCatch try_catch;
+    Handle<Value> argv[] = { input };
+    Handle<Value> result = function->Call(m_context->Global(), 1, argv);
+    if (m_exited) {
+        // The isolate would otherwise stay terminating, and fail the
+        // calls that follow.
+        V8::CancelTerminateExecution(m_isolate);
+        m_exited = false;
+        m_error = m_printed.empty() ? "Error: the tool exited" : m_printed;
+        return Handle<Value>();
+    }
+    if (result.IsEmpty()) {
+        String::Utf8Value exception(try_catch.Exception());
+        m_error = *exception ? *exception : "Error: the tool failed";
+    }
+    return result;
+}
+
+// Here rather than in library.cpp, which holds every tool script: bundle.cpp
+// uses it too, and the executables shouldn't link those in.
+bool read_file(const std::string& name, Buffer& contents)
+{
+    std::ifstream file(name.c_str());
+    if (!file)
+        return false;
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    contents = stream.str();
+    contents.append(1, '\n');
+    return true;
+}
+
+} // namespace eightpack
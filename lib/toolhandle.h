@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_TOOLHANDLE_H
+#define EIGHTPACK_TOOLHANDLE_H
+
+#include "eightpack.h"
+
+#include <v8.h>
+
+#include <map>
+#include <string>
+
+// What runs the tool scripts behind the library API, and for --bundle.
+
+namespace eightpack {
+
+struct ToolScript
+{
+    const char* name;
+    const char* script;
+    // The body of the function the handle calls on an input, which sees
+    // the variables the script set up from the options.
+    const char* call;
+};
+
+// Each tool script, command line handling included, becomes the body
+// of a function, so that several tools share a context without their
+// variables meeting. Run with the options in system.args and an empty
+// file, it parses them like the executable does and returns a function
+// that runs the tool on an input with them. The handle owns an isolate;
+// callers enter it and the context before they call run().
+class ToolHandle
+{
+public:
+    ToolHandle();
+    ~ToolHandle();
+
+    v8::Isolate* isolate() const { return m_isolate; }
+    v8::Handle<v8::Context> context() const { return m_context; }
+
+    // Returns an empty handle, with the reason in error(), on failure.
+    // A script that calls system.exit() fails the call, not the handle.
+    v8::Handle<v8::Value> run(const ToolScript& tool, v8::Handle<v8::Value> input, const Options& options);
+    const std::string& error() const { return m_error; }
+    void clear_error() { m_error.clear(); }
+
+private:
+    ToolHandle(const ToolHandle&);
+    ToolHandle& operator=(const ToolHandle&);
+
+    v8::Handle<v8::Function> setup(const ToolScript& tool);
+    v8::Handle<v8::Function> runner(const ToolScript& tool, const Options& options);
+
+    static v8::Handle<v8::Value> log(const v8::Arguments& args);
+    static v8::Handle<v8::Value> exit(const v8::Arguments& args);
+    static v8::Handle<v8::Value> read_file(const v8::Arguments& args);
+
+    v8::Isolate* m_isolate;
+    v8::Persistent<v8::Context> m_context;
+    v8::Persistent<v8::Object> m_system;
+    std::string m_error;
+
+    // Tools are loaded the first time they run.
+    std::map<const ToolScript*, v8::Persistent<v8::Function> > m_setups;
+    std::map<const ToolScript*, std::map<std::string, v8::Persistent<v8::Function> > > m_runners;
+
+    // What the script printed, and whether it called system.exit(),
+    // during the current call.
+    std::string m_printed;
+    bool m_exited;
+};
+
+} // namespace eightpack
+
+#endif
@@ -0,0 +1,336 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "traceevents.h"
+
+#include "json.h"
+
+#include <v8.h>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include <stdio.h>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+using namespace v8;
+
+struct TraceEvent
+{
+    char phase;
+    const char* category;
+    const char* name;
+    double timestamp;
+    long thread;
+    std::string detail;
+};
+
+static std::string output_file;
+static std::string process_name;
+static long main_thread = 0;
+static bool recording = false;
+
+// Isolates on other threads, --bundle's, record too; the events and the
+// count of spans each thread has open are shared under the lock.
+static std::vector<TraceEvent> events;
+static std::map<long, int> open_spans;
+
+// The lanes named so far, and what --prefork workers recorded, already
+// in the format.
+static bool process_named = false;
+static std::set<long> threads_named;
+static std::vector<std::string> merged;
+
+#ifdef _MSC_VER
+
+static CRITICAL_SECTION lock;
+
+static void init_lock()
+{
+    InitializeCriticalSection(&lock);
+}
+
+static void lock_events()
+{
+    EnterCriticalSection(&lock);
+}
+
+static void unlock_events()
+{
+    LeaveCriticalSection(&lock);
+}
+
+#else
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void init_lock()
+{
+}
+
+static void lock_events()
+{
+    pthread_mutex_lock(&lock);
+}
+
+static void unlock_events()
+{
+    pthread_mutex_unlock(&lock);
+}
+
+#endif
+
+// Microseconds, the unit of the format.
+static double timestamp()
+{
+#ifdef _MSC_VER
+    static LARGE_INTEGER frequency;
+    if (!frequency.QuadPart)
+        QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return 1000000.0 * counter.QuadPart / frequency.QuadPart;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000.0 + ts.tv_nsec / 1000.0;
+#endif
+}
+
+static long process_id()
+{
+#ifdef _MSC_VER
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+static long thread_id()
+{
+#ifdef _MSC_VER
+    return GetCurrentThreadId();
+#elif defined(SYS_gettid)
+    return syscall(SYS_gettid);
+#else
+    return process_id();
+#endif
+}
+
+// Call with the lock held.
+static void add_event(char phase, const char* category, const char* name, const char* detail, long thread)
+{
+    TraceEvent event;
+    event.phase = phase;
+    event.category = category;
+    event.name = name;
+    event.timestamp = timestamp();
+    event.thread = thread;
+    if (detail)
+        event.detail = detail;
+    events.push_back(event);
+}
+
+static void record_gc(char phase, GCType type)
+{
+    lock_events();
+    if (recording)
+        add_event(phase, "v8", type == kGCTypeScavenge ? "scavenge" : "mark-sweep-compact", 0, thread_id());
+    unlock_events();
+}
+
+static void gc_prologue(GCType type, GCCallbackFlags flags)
+{
+    record_gc('B', type);
+}
+
+static void gc_epilogue(GCType type, GCCallbackFlags flags)
+{
+    record_gc('E', type);
+}
+
+// Writes the events recorded so far, after the names of the process and
+// of the lanes that haven't been named yet. Call with the lock held.
+static void write_events(std::ostream& out, const std::string& name)
+{
+    long pid = process_id();
+    char buffer[64];
+    const char* separator = "";
+    if (!process_named) {
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << main_thread
+            << ",\"args\":{\"name\":" << json_quote(name) << "}}";
+        separator = ",\n";
+        process_named = true;
+    }
+
+    // Name the lanes: one per thread that recorded anything.
+    std::set<long> threads;
+    for (size_t i = 0; i < events.size(); ++i)
+        threads.insert(events[i].thread);
+    for (std::set<long>::const_iterator t = threads.begin(); t != threads.end(); ++t) {
+        if (!threads_named.insert(*t).second)
+            continue;
+        sprintf(buffer, "thread %ld", *t);
+        out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << *t
+            << ",\"args\":{\"name\":" << json_quote(*t == main_thread ? "main" : buffer) << "}}";
+        separator = ",\n";
+    }
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        sprintf(buffer, "%.3f", event.timestamp);
+        out << separator << "{\"name\":" << json_quote(event.name) << ",\"cat\":\"" << event.category
+            << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << buffer
+            << ",\"pid\":" << pid << ",\"tid\":" << event.thread;
+        if (!event.detail.empty())
+            out << ",\"args\":{\"detail\":" << json_quote(event.detail) << "}";
+        out << "}";
+        separator = ",\n";
+    }
+}
+
+void trace_events_set_output(const std::string& fileName)
+{
+    if (output_file.empty())
+        init_lock();
+    output_file = fileName;
+}
+
+void trace_events_start(const std::string& processName)
+{
+    if (output_file.empty())
+        return;
+    process_name = processName;
+    main_thread = thread_id();
+    recording = true;
+    trace_events_watch_isolate();
+}
+
+void trace_events_watch_isolate()
+{
+    if (output_file.empty())
+        return;
+    V8::AddGCPrologueCallback(gc_prologue);
+    V8::AddGCEpilogueCallback(gc_epilogue);
+}
+
+void trace_event_begin(const char* name, const char* detail)
+{
+    if (output_file.empty())
+        return;
+    long thread = thread_id();
+    lock_events();
+    if (recording) {
+        add_event('B', "eightpack", name, detail, thread);
+        ++open_spans[thread];
+    }
+    unlock_events();
+}
+
+void trace_event_end()
+{
+    if (output_file.empty())
+        return;
+    long thread = thread_id();
+    lock_events();
+    int& open = open_spans[thread];
+    if (recording && open > 0) {
+        add_event('E', "eightpack", "", 0, thread);
+        --open;
+    }
+    unlock_events();
+}
+
+void trace_events_finish()
+{
+    if (output_file.empty())
+        return;
+    lock_events();
+    recording = false;
+    for (std::map<long, int>::iterator i = open_spans.begin(); i != open_spans.end(); ++i) {
+        for (; i->second > 0; --i->second)
+            add_event('E', "eightpack", "", 0, i->first);
+    }
+    unlock_events();
+
+    std::ofstream out(output_file.c_str());
+    if (!out) {
+        std::cerr << "Error: can't write the trace to " << output_file << std::endl;
+        output_file.clear();
+        return;
+    }
+
+    out << "{\"traceEvents\":[\n";
+    write_events(out, process_name);
+    for (size_t i = 0; i < merged.size(); ++i)
+        out << ",\n" << merged[i];
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    events.clear();
+    open_spans.clear();
+    merged.clear();
+    output_file.clear();
+}
+
+void trace_events_reset()
+{
+    if (output_file.empty())
+        return;
+    lock_events();
+    events.clear();
+    open_spans.clear();
+    merged.clear();
+    process_named = false;
+    threads_named.clear();
+    main_thread = thread_id();
+    unlock_events();
+}
+
+std::string trace_events_take()
+{
+    if (output_file.empty())
+        return std::string();
+    std::ostringstream out;
+    lock_events();
+    write_events(out, process_name + " worker");
+    events.clear();
+    unlock_events();
+    return out.str();
+}
+
+void trace_events_merge(const std::string& report)
+{
+    if (!output_file.empty() && !report.empty())
+        merged.push_back(report);
+}
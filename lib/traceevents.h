@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_TRACEEVENTS_H
+#define EIGHTPACK_TRACEEVENTS_H
+
+#include <string>
+
+// Timeline for --trace-events, written in the Chrome trace event format
+// so that chrome://tracing and similar viewers can load it. Spans come
+// from the run phases and from V8 garbage collections, one lane per
+// process and thread.
+
+void trace_events_set_output(const std::string& fileName);
+
+// Hooks into the garbage collector; call after V8::Initialize. The
+// process lane is labelled with the given name.
+void trace_events_start(const std::string& processName);
+
+// Hooks into the garbage collector of the current isolate. The default
+// one is hooked by trace_events_start; every other isolate that runs a
+// tool needs this too.
+void trace_events_watch_isolate();
+
+// Spans nest, per thread. The detail, if any, shows up as the "detail" argument of
+// the span, e.g. the name of the file being read.
+void trace_event_begin(const char* name, const char* detail = 0);
+void trace_event_end();
+
+// Closes the spans still open, on every thread, and writes the file;
+// safe to call more than once. Call once the other threads are done.
+void trace_events_finish();
+
+// For --prefork: a worker drops the events it inherited, then takes
+// what it recorded after each input, already in the format, for the
+// parent to merge into its file. Workers get lanes of their own.
+void trace_events_reset();
+std::string trace_events_take();
+void trace_events_merge(const std::string& report);
+
+#endif
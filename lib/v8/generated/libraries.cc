@@ -16,7 +16,7 @@ namespace internal {
 
   static const char array[] = { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 118, 105, 115, 105, 116, 101, 100, 95, 97, 114, 114, 97, 121, 115, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 41, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 100, 61, 91, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 118, 97, 114, 32, 102, 61, 98, 91, 101, 93, 59, 10, 105, 102, 40, 102, 60, 48, 41, 123, 10, 118, 97, 114, 32, 103, 61, 45, 49, 45, 102, 59, 10, 118, 97, 114, 32, 104, 61, 103, 43, 98, 91, 43, 43, 101, 93, 59, 10, 102, 111, 114, 40, 59, 103, 60, 104, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 105, 61, 97, 91, 103, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 105, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 103, 32, 105, 110, 32, 97, 41, 123, 10, 100, 46, 112, 117, 115, 104, 40, 103, 41, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 118, 97, 114, 32, 105, 61, 97, 91, 102, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 105, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 102, 32, 105, 110, 32, 97, 41, 123, 10, 100, 46, 112, 117, 115, 104, 40, 102, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 100, 46, 115, 111, 114, 116, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 106, 44, 107, 41, 123, 114, 101, 116, 117, 114, 110, 32, 106, 45, 107, 59, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 98, 41, 41, 59, 10, 118, 97, 114, 32, 101, 61, 45, 49, 59, 10, 118, 97, 114, 32, 102, 61, 100, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 102, 41, 59, 10, 118, 97, 114, 32, 104, 61, 48, 59, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 102, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 106, 61, 100, 91, 105, 93, 59, 10, 105, 102, 40, 106, 33, 61, 101, 41, 123, 10, 118, 97, 114, 32, 107, 61, 97, 91, 106, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 107, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 107, 61, 99, 40, 107, 41, 59, 10, 103, 91, 104, 43, 43, 93, 61, 107, 59, 10, 101, 61, 106, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 103, 44, 104, 44, 39, 39, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40, 97, 44, 98, 44, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 38, 38, 10, 98, 62, 49, 48, 48, 48, 38, 38, 10, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 124, 124, 10, 37, 69, 115, 116, 105, 109, 97, 116, 101, 78, 117, 109, 98, 101, 114, 79, 102, 69, 108, 101, 109, 101, 110, 116, 115, 40, 97, 41, 60, 40, 98, 62, 62, 50, 41, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 74, 111, 105, 110, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 105, 102, 40, 98, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 10, 118, 97, 114, 32, 101, 61, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 97, 41, 41, 59, 10, 10, 105, 102, 40, 101, 41, 123, 10, 10, 10, 105, 102, 40, 33, 37, 80, 117, 115, 104, 73, 102, 65, 98, 115, 101, 110, 116, 40, 118, 105, 115, 105, 116, 101, 100, 95, 97, 114, 114, 97, 121, 115, 44, 97, 41, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 125, 10, 10, 10, 116, 114, 121, 123, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40, 97, 44, 98, 44, 101, 41, 38, 38, 40, 99, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 83, 112, 97, 114, 115, 101, 74, 111, 105, 110, 40, 97, 44, 98, 44, 100, 41, 59, 10, 125, 10, 10, 10, 105, 102, 40, 98, 61, 61, 49, 41, 123, 10, 118, 97, 114, 32, 102, 61, 97, 91, 48, 93, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 102, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 40, 102, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 98, 41, 59, 10, 10, 10, 105, 102, 40, 99, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 123, 10, 118, 97, 114, 32, 104, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 98, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 102, 61, 97, 91, 105, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 102, 61, 100, 40, 102, 41, 59, 10, 103, 91, 104, 43, 43, 93, 61, 102, 59, 10, 125, 10, 125, 10, 103, 46, 108, 101, 110, 103, 116, 104, 61, 104, 59, 10, 118, 97, 114, 32, 106, 61, 37, 95, 70, 97, 115, 116, 65, 115, 99, 105, 105, 65, 114, 114, 97, 121, 74, 111, 105, 110, 40, 103, 44, 39, 39, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 106, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 106, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 103, 44, 104, 44, 39, 39, 41, 59, 10, 125, 10, 10, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 91, 48, 93, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 98, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 102, 61, 97, 91, 105, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 102, 61, 100, 40, 102, 41, 59, 10, 103, 91, 105, 93, 61, 102, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 98, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 102, 61, 97, 91, 105, 93, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 103, 91, 105, 93, 61, 37, 95, 78, 117, 109, 98, 101, 114, 84, 111, 83, 116, 114, 105, 110, 103, 40, 102, 41, 59, 10, 101, 108, 115, 101, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 102, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 102, 61, 100, 40, 102, 41, 59, 10, 103, 91, 105, 93, 61, 102, 59, 10, 125, 10, 125, 10, 125, 10, 118, 97, 114, 32, 106, 61, 37, 95, 70, 97, 115, 116, 65, 115, 99, 105, 105, 65, 114, 114, 97, 121, 74, 111, 105, 110, 40, 103, 44, 99, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 106, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 106, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 74, 111, 105, 110, 40, 103, 44, 98, 44, 99, 41, 59, 10, 125, 102, 105, 110, 97, 108, 108, 121, 123, 10, 10, 10, 105, 102, 40, 101, 41, 118, 105, 115, 105, 116, 101, 100, 95, 97, 114, 114, 97, 121, 115, 46, 108, 101, 110, 103, 116, 104, 61, 118, 105, 115, 105, 116, 101, 100, 95, 97, 114, 114, 97, 121, 115, 46, 108, 101, 110, 103, 116, 104, 45, 49, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 123, 10, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 37, 95, 78, 117, 109, 98, 101, 114, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 98, 111, 111, 108, 101, 97, 110, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 63, 39, 116, 114, 117, 101, 39, 58, 39, 102, 97, 108, 115, 101, 39, 59, 10, 114, 101, 116, 117, 114, 110, 40, 40, 97, 61, 61, 110, 117, 108, 108, 41, 41, 63, 39, 39, 58, 37, 84, 111, 83, 116, 114, 105, 110, 103, 40, 37, 68, 101, 102, 97, 117, 108, 116, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 110, 118, 101, 114, 116, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 40, 97, 41, 123, 10, 105, 102, 40, 97, 61, 61, 110, 117, 108, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 97, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 46, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 41, 41, 41, 10, 114, 101, 116, 117, 114, 110, 32, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 46, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 40, 41, 41, 59, 10, 101, 108, 115, 101, 10, 114, 101, 116, 117, 114, 110, 32, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 125, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 109, 97, 114, 116, 83, 108, 105, 99, 101, 40, 97, 44, 98, 44, 99, 44, 100, 44, 102, 41, 123, 10, 10, 10, 118, 97, 114, 32, 103, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 98, 43, 99, 41, 59, 10, 118, 97, 114, 32, 104, 61, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 104, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 106, 61, 103, 91, 105, 93, 59, 10, 105, 102, 40, 106, 60, 48, 41, 123, 10, 118, 97, 114, 32, 107, 61, 45, 49, 45, 106, 59, 10, 118, 97, 114, 32, 108, 61, 107, 43, 103, 91, 43, 43, 105, 93, 59, 10, 105, 102, 40, 107, 60, 98, 41, 123, 10, 107, 61, 98, 59, 10, 125, 10, 102, 111, 114, 40, 59, 107, 60, 108, 59, 107, 43, 43, 41, 123, 10, 10, 10, 10, 10, 118, 97, 114, 32, 109, 61, 97, 91, 107, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 109, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 107, 32, 105, 110, 32, 97, 41, 123, 10, 102, 91, 107, 45, 98, 93, 61, 109, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 106, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 106, 62, 61, 98, 41, 123, 10, 10, 10, 10, 10, 118, 97, 114, 32, 109, 61, 97, 91, 106, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 109, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 106, 32, 105, 110, 32, 97, 41, 123, 10, 102, 91, 106, 45, 98, 93, 61, 109, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 109, 97, 114, 116, 77, 111, 118, 101, 40, 97, 44, 98, 44, 99, 44, 100, 44, 102, 41, 123, 10, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 100, 45, 99, 43, 102, 41, 59, 10, 118, 97, 114, 32, 104, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 100, 41, 59, 10, 118, 97, 114, 32, 105, 61, 104, 46, 108, 101, 110, 103, 116, 104, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 106, 61, 48, 59, 106, 60, 105, 59, 106, 43, 43, 41, 123, 10, 118, 97, 114, 32, 107, 61, 104, 91, 106, 93, 59, 10, 105, 102, 40, 107, 60, 48, 41, 123, 10, 118, 97, 114, 32, 108, 61, 45, 49, 45, 107, 59, 10, 118, 97, 114, 32, 109, 61, 108, 43, 104, 91, 43, 43, 106, 93, 59, 10, 119, 104, 105, 108, 101, 40, 108, 60, 98, 38, 38, 108, 60, 109, 41, 123, 10, 10, 10, 10, 118, 97, 114, 32, 110, 61, 97, 91, 108, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 110, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 108, 32, 105, 110, 32, 97, 41, 123, 10, 103, 91, 108, 93, 61, 110, 59, 10, 125, 10, 108, 43, 43, 59, 10, 125, 10, 108, 61, 98, 43, 99, 59, 10, 119, 104, 105, 108, 101, 40, 108, 60, 109, 41, 123, 10, 10, 10, 10, 10, 118, 97, 114, 32, 110, 61, 97, 91, 108, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 110, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 108, 32, 105, 110, 32, 97, 41, 123, 10, 103, 91, 108, 45, 99, 43, 102, 93, 61, 110, 59, 10, 125, 10, 108, 43, 43, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 107, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 107, 60, 98, 41, 123, 10, 10, 10, 10, 118, 97, 114, 32, 110, 61, 97, 91, 107, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 110, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 107, 32, 105, 110, 32, 97, 41, 123, 10, 103, 91, 107, 93, 61, 110, 59, 10, 125, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 107, 62, 61, 98, 43, 99, 41, 123, 10, 10, 10, 10, 10, 118, 97, 114, 32, 110, 61, 97, 91, 107, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 110, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 107, 32, 105, 110, 32, 97, 41, 123, 10, 103, 91, 107, 45, 99, 43, 102, 93, 61, 110, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 10, 37, 77, 111, 118, 101, 65, 114, 114, 97, 121, 67, 111, 110, 116, 101, 110, 116, 115, 40, 103, 44, 97, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 105, 109, 112, 108, 101, 83, 108, 105, 99, 101, 40, 97, 44, 98, 44, 99, 44, 100, 44, 102, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 99, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 98, 43, 103, 59, 10, 10, 10, 10, 118, 97, 114, 32, 105, 61, 97, 91, 104, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 105, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 104, 32, 105, 110, 32, 97, 41, 10, 102, 91, 103, 93, 61, 105, 59, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40, 97, 44, 98, 44, 99, 44, 100, 44, 102, 41, 123, 10, 105, 102, 40, 102, 33, 61, 61, 99, 41, 123, 10, 10, 10, 105, 102, 40, 102, 62, 99, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 100, 45, 99, 59, 103, 62, 98, 59, 103, 45, 45, 41, 123, 10, 118, 97, 114, 32, 104, 61, 103, 43, 99, 45, 49, 59, 10, 118, 97, 114, 32, 105, 61, 103, 43, 102, 45, 49, 59, 10, 10, 10, 10, 118, 97, 114, 32, 106, 61, 97, 91, 104, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 106, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 104, 32, 105, 110, 32, 97, 41, 123, 10, 97, 91, 105, 93, 61, 106, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 101, 108, 101, 116, 101, 32, 97, 91, 105, 93, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 98, 59, 103, 60, 100, 45, 99, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 103, 43, 99, 59, 10, 118, 97, 114, 32, 105, 61, 103, 43, 102, 59, 10, 10, 10, 10, 118, 97, 114, 32, 106, 61, 97, 91, 104, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 106, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 104, 32, 105, 110, 32, 97, 41, 123, 10, 97, 91, 105, 93, 61, 106, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 101, 108, 101, 116, 101, 32, 97, 91, 105, 93, 59, 10, 125, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 100, 59, 103, 62, 100, 45, 99, 43, 102, 59, 103, 45, 45, 41, 123, 10, 100, 101, 108, 101, 116, 101, 32, 97, 91, 103, 45, 49, 93, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 84, 111, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 74, 111, 105, 110, 40, 116, 104, 105, 115, 44, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 44, 39, 44, 39, 44, 67, 111, 110, 118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 74, 111, 105, 110, 40, 116, 104, 105, 115, 44, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 44, 39, 44, 39, 44, 67, 111, 110, 118, 101, 114, 116, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 74, 111, 105, 110, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 97, 61, 39, 44, 39, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 97, 61, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 37, 95, 70, 97, 115, 116, 65, 115, 99, 105, 105, 65, 114, 114, 97, 121, 74, 111, 105, 110, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 74, 111, 105, 110, 40, 116, 104, 105, 115, 44, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 44, 97, 44, 67, 111, 110, 118, 101, 114, 116, 84, 111, 83, 116, 114, 105, 110, 103, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 80, 111, 112, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 97, 61, 61, 48, 41, 123, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 97, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 97, 45, 45, 59, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 91, 97, 93, 59, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 97, 59, 10, 100, 101, 108, 101, 116, 101, 32, 116, 104, 105, 115, 91, 97, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 80, 117, 115, 104, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 98, 59, 99, 43, 43, 41, 123, 10, 116, 104, 105, 115, 91, 99, 43, 97, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 97, 43, 98, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 67, 111, 110, 99, 97, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 99, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 49, 43, 98, 41, 59, 10, 99, 91, 48, 93, 61, 116, 104, 105, 115, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 98, 59, 100, 43, 43, 41, 123, 10, 99, 91, 100, 43, 49, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 114, 114, 97, 121, 67, 111, 110, 99, 97, 116, 40, 99, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 112, 97, 114, 115, 101, 82, 101, 118, 101, 114, 115, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 97, 44, 98, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 45, 49, 59, 10, 118, 97, 114, 32, 102, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 102, 60, 61, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 99, 91, 102, 93, 59, 10, 118, 97, 114, 32, 104, 61, 99, 91, 100, 93, 59, 10, 10, 118, 97, 114, 32, 105, 61, 98, 45, 104, 45, 49, 59, 10, 118, 97, 114, 32, 106, 44, 107, 59, 10, 10, 105, 102, 40, 105, 60, 61, 103, 41, 123, 10, 107, 61, 104, 59, 10, 119, 104, 105, 108, 101, 40, 99, 91, 45, 45, 100, 93, 61, 61, 104, 41, 59, 10, 106, 61, 105, 59, 10, 125, 10, 105, 102, 40, 105, 62, 61, 103, 41, 123, 10, 106, 61, 103, 59, 10, 119, 104, 105, 108, 101, 40, 99, 91, 43, 43, 102, 93, 61, 61, 103, 41, 59, 10, 107, 61, 98, 45, 103, 45, 49, 59, 10, 125, 10, 10, 118, 97, 114, 32, 108, 61, 97, 91, 106, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 108, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 106, 32, 105, 110, 32, 97, 41, 123, 10, 118, 97, 114, 32, 109, 61, 97, 91, 107, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 109, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 107, 32, 105, 110, 32, 97, 41, 123, 10, 97, 91, 106, 93, 61, 109, 59, 10, 97, 91, 107, 93, 61, 108, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 91, 107, 93, 61, 108, 59, 10, 100, 101, 108, 101, 116, 101, 32, 97, 91, 106, 93, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 109, 61, 97, 91, 107, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 109, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 107, 32, 105, 110, 32, 97, 41, 123, 10, 97, 91, 106, 93, 61, 109, 59, 10, 100, 101, 108, 101, 116, 101, 32, 97, 91, 107, 93, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 82, 101, 118, 101, 114, 115, 101, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 45, 49, 59, 10, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40, 116, 104, 105, 115, 44, 97, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 41, 123, 10, 83, 112, 97, 114, 115, 101, 82, 101, 118, 101, 114, 115, 101, 40, 116, 104, 105, 115, 44, 97, 43, 49, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 98, 61, 48, 59, 98, 60, 97, 59, 98, 43, 43, 44, 97, 45, 45, 41, 123, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 91, 98, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 98, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 91, 97, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 97, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 116, 104, 105, 115, 91, 98, 93, 61, 100, 59, 10, 116, 104, 105, 115, 91, 97, 93, 61, 99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 105, 115, 91, 97, 93, 61, 99, 59, 10, 100, 101, 108, 101, 116, 101, 32, 116, 104, 105, 115, 91, 98, 93, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 91, 97, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 97, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 116, 104, 105, 115, 91, 98, 93, 61, 100, 59, 10, 100, 101, 108, 101, 116, 101, 32, 116, 104, 105, 115, 91, 97, 93, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 104, 105, 102, 116, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41, 123, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 48, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 91, 48, 93, 59, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 10, 83, 109, 97, 114, 116, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 48, 44, 49, 44, 97, 44, 48, 41, 59, 10, 101, 108, 115, 101, 10, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 48, 44, 49, 44, 97, 44, 48, 41, 59, 10, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 97, 45, 49, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 85, 110, 115, 104, 105, 102, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 10, 83, 109, 97, 114, 116, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 48, 44, 48, 44, 98, 44, 99, 41, 59, 10, 101, 108, 115, 101, 10, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 48, 44, 48, 44, 98, 44, 99, 41, 59, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 116, 104, 105, 115, 91, 100, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 125, 10, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 98, 43, 99, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 98, 43, 99, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 108, 105, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 100, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 118, 97, 114, 32, 102, 61, 99, 59, 10, 10, 105, 102, 40, 98, 33, 61, 61, 118, 111, 105, 100, 32, 48, 41, 102, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 10, 105, 102, 40, 100, 60, 48, 41, 123, 10, 100, 43, 61, 99, 59, 10, 105, 102, 40, 100, 60, 48, 41, 100, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 62, 99, 41, 100, 61, 99, 59, 10, 125, 10, 10, 105, 102, 40, 102, 60, 48, 41, 123, 10, 102, 43, 61, 99, 59, 10, 105, 102, 40, 102, 60, 48, 41, 102, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 102, 62, 99, 41, 102, 61, 99, 59, 10, 125, 10, 10, 118, 97, 114, 32, 103, 61, 91, 93, 59, 10, 10, 105, 102, 40, 102, 60, 100, 41, 114, 101, 116, 117, 114, 110, 32, 103, 59, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 83, 109, 97, 114, 116, 83, 108, 105, 99, 101, 40, 116, 104, 105, 115, 44, 100, 44, 102, 45, 100, 44, 99, 44, 103, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 83, 105, 109, 112, 108, 101, 83, 108, 105, 99, 101, 40, 116, 104, 105, 115, 44, 100, 44, 102, 45, 100, 44, 99, 44, 103, 41, 59, 10, 125, 10, 10, 103, 46, 108, 101, 110, 103, 116, 104, 61, 102, 45, 100, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 103, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 112, 108, 105, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 10, 118, 97, 114, 32, 100, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 102, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 10, 105, 102, 40, 102, 60, 48, 41, 123, 10, 102, 43, 61, 100, 59, 10, 105, 102, 40, 102, 60, 48, 41, 102, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 102, 62, 100, 41, 102, 61, 100, 59, 10, 125, 10, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 103, 61, 48, 59, 10, 105, 102, 40, 99, 61, 61, 49, 41, 123, 10, 103, 61, 100, 45, 102, 59, 10, 125, 101, 108, 115, 101, 123, 10, 103, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 103, 60, 48, 41, 103, 61, 48, 59, 10, 105, 102, 40, 103, 62, 100, 45, 102, 41, 103, 61, 100, 45, 102, 59, 10, 125, 10, 10, 118, 97, 114, 32, 104, 61, 91, 93, 59, 10, 104, 46, 108, 101, 110, 103, 116, 104, 61, 103, 59, 10, 10, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 105, 102, 40, 99, 62, 50, 41, 123, 10, 105, 61, 99, 45, 50, 59, 10, 125, 10, 10, 118, 97, 114, 32, 106, 61, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 38, 38, 105, 33, 61, 61, 103, 41, 123, 10, 10, 10, 10, 118, 97, 114, 32, 107, 61, 37, 69, 115, 116, 105, 109, 97, 116, 101, 78, 117, 109, 98, 101, 114, 79, 102, 69, 108, 101, 109, 101, 110, 116, 115, 40, 116, 104, 105, 115, 41, 59, 10, 105, 102, 40, 100, 62, 50, 48, 38, 38, 40, 107, 62, 62, 50, 41, 60, 40, 100, 45, 102, 41, 41, 123, 10, 106, 61, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 10, 105, 102, 40, 106, 41, 123, 10, 83, 105, 109, 112, 108, 101, 83, 108, 105, 99, 101, 40, 116, 104, 105, 115, 44, 102, 44, 103, 44, 100, 44, 104, 41, 59, 10, 83, 105, 109, 112, 108, 101, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 102, 44, 103, 44, 100, 44, 105, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 83, 109, 97, 114, 116, 83, 108, 105, 99, 101, 40, 116, 104, 105, 115, 44, 102, 44, 103, 44, 100, 44, 104, 41, 59, 10, 83, 109, 97, 114, 116, 77, 111, 118, 101, 40, 116, 104, 105, 115, 44, 102, 44, 103, 44, 100, 44, 105, 41, 59, 10, 125, 10, 10, 10, 10, 118, 97, 114, 32, 108, 61, 102, 59, 10, 118, 97, 114, 32, 109, 61, 50, 59, 10, 118, 97, 114, 32, 110, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 119, 104, 105, 108, 101, 40, 109, 60, 110, 41, 123, 10, 116, 104, 105, 115, 91, 108, 43, 43, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 109, 43, 43, 41, 59, 10, 125, 10, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 61, 100, 45, 103, 43, 105, 59, 10, 10, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 111, 114, 116, 40, 97, 41, 123, 10, 10, 10, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 97, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 44, 99, 41, 123, 10, 105, 102, 40, 98, 61, 61, 61, 99, 41, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 38, 38, 37, 95, 73, 115, 83, 109, 105, 40, 99, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 109, 105, 76, 101, 120, 105, 99, 111, 103, 114, 97, 112, 104, 105, 99, 67, 111, 109, 112, 97, 114, 101, 40, 98, 44, 99, 41, 59, 10, 125, 10, 98, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 41, 59, 10, 99, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 99, 41, 59, 10, 105, 102, 40, 98, 61, 61, 99, 41, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 101, 108, 115, 101, 32, 114, 101, 116, 117, 114, 110, 32, 98, 60, 99, 63, 45, 49, 58, 49, 59, 10, 125, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 115, 101, 114, 116, 105, 111, 110, 83, 111, 114, 116, 40, 102, 44, 103, 44, 104, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 103, 43, 49, 59, 105, 60, 104, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 106, 61, 102, 91, 105, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 107, 61, 105, 45, 49, 59, 107, 62, 61, 103, 59, 107, 45, 45, 41, 123, 10, 118, 97, 114, 32, 108, 61, 102, 91, 107, 93, 59, 10, 118, 97, 114, 32, 109, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 108, 44, 106, 44, 97, 41, 59, 10, 105, 102, 40, 109, 62, 48, 41, 123, 10, 102, 91, 107, 43, 49, 93, 61, 108, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 125, 10, 102, 91, 107, 43, 49, 93, 61, 106, 59, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 102, 44, 103, 44, 104, 41, 123, 10, 10, 105, 102, 40, 104, 45, 103, 60, 61, 49, 48, 41, 123, 10, 73, 110, 115, 101, 114, 116, 105, 111, 110, 83, 111, 114, 116, 40, 102, 44, 103, 44, 104, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 118, 97, 114, 32, 110, 61, 102, 91, 103, 93, 59, 10, 118, 97, 114, 32, 111, 61, 102, 91, 104, 45, 49, 93, 59, 10, 118, 97, 114, 32, 113, 61, 103, 43, 40, 40, 104, 45, 103, 41, 62, 62, 49, 41, 59, 10, 118, 97, 114, 32, 114, 61, 102, 91, 113, 93, 59, 10, 118, 97, 114, 32, 115, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 110, 44, 111, 44, 97, 41, 59, 10, 105, 102, 40, 115, 62, 48, 41, 123, 10, 10, 118, 97, 114, 32, 108, 61, 110, 59, 10, 110, 61, 111, 59, 10, 111, 61, 108, 59, 10, 125, 10, 118, 97, 114, 32, 116, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 110, 44, 114, 44, 97, 41, 59, 10, 105, 102, 40, 116, 62, 61, 48, 41, 123, 10, 10, 118, 97, 114, 32, 108, 61, 110, 59, 10, 110, 61, 114, 59, 10, 114, 61, 111, 59, 10, 111, 61, 108, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 118, 97, 114, 32, 117, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 111, 44, 114, 44, 97, 41, 59, 10, 105, 102, 40, 117, 62, 48, 41, 123, 10, 10, 118, 97, 114, 32, 108, 61, 111, 59, 10, 111, 61, 114, 59, 10, 114, 61, 108, 59, 10, 125, 10, 125, 10, 10, 102, 91, 103, 93, 61, 110, 59, 10, 102, 91, 104, 45, 49, 93, 61, 114, 59, 10, 118, 97, 114, 32, 118, 61, 111, 59, 10, 118, 97, 114, 32, 119, 61, 103, 43, 49, 59, 10, 118, 97, 114, 32, 122, 61, 104, 45, 49, 59, 10, 102, 91, 113, 93, 61, 102, 91, 119, 93, 59, 10, 102, 91, 119, 93, 61, 118, 59, 10, 10, 10, 10, 112, 97, 114, 116, 105, 116, 105, 111, 110, 58, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 119, 43, 49, 59, 105, 60, 122, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 106, 61, 102, 91, 105, 93, 59, 10, 118, 97, 114, 32, 109, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 106, 44, 118, 44, 97, 41, 59, 10, 105, 102, 40, 109, 60, 48, 41, 123, 10, 37, 95, 83, 119, 97, 112, 69, 108, 101, 109, 101, 110, 116, 115, 40, 102, 44, 105, 44, 119, 41, 59, 10, 119, 43, 43, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 62, 48, 41, 123, 10, 100, 111, 123, 10, 122, 45, 45, 59, 10, 105, 102, 40, 122, 61, 61, 105, 41, 98, 114, 101, 97, 107, 32, 112, 97, 114, 116, 105, 116, 105, 111, 110, 59, 10, 118, 97, 114, 32, 65, 61, 102, 91, 122, 93, 59, 10, 109, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 65, 44, 118, 44, 97, 41, 59, 10, 125, 119, 104, 105, 108, 101, 40, 109, 62, 48, 41, 59, 10, 37, 95, 83, 119, 97, 112, 69, 108, 101, 109, 101, 110, 116, 115, 40, 102, 44, 105, 44, 122, 41, 59, 10, 105, 102, 40, 109, 60, 48, 41, 123, 10, 37, 95, 83, 119, 97, 112, 69, 108, 101, 109, 101, 110, 116, 115, 40, 102, 44, 105, 44, 119, 41, 59, 10, 119, 43, 43, 59, 10, 125, 10, 125, 10, 125, 10, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 102, 44, 103, 44, 119, 41, 59, 10, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 102, 44, 122, 44, 104, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 111, 112, 121, 70, 114, 111, 109, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 66, 44, 67, 41, 123, 10, 118, 97, 114, 32, 68, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 69, 61, 66, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 59, 69, 59, 69, 61, 69, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 41, 123, 10, 118, 97, 114, 32, 71, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 69, 44, 67, 41, 59, 10, 105, 102, 40, 71, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 105, 102, 40, 71, 91, 48, 93, 61, 61, 45, 49, 41, 123, 10, 10, 118, 97, 114, 32, 72, 61, 71, 91, 49, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 72, 59, 105, 43, 43, 41, 123, 10, 105, 102, 40, 33, 66, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 105, 41, 38, 38, 69, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 105, 41, 41, 123, 10, 66, 91, 105, 93, 61, 69, 91, 105, 93, 59, 10, 105, 102, 40, 105, 62, 61, 68, 41, 123, 68, 61, 105, 43, 49, 59, 125, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 71, 46, 108, 101, 110, 103, 116, 104, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 73, 61, 71, 91, 105, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 73, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 10, 33, 66, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 73, 41, 38, 38, 69, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 73, 41, 41, 123, 10, 66, 91, 73, 93, 61, 69, 91, 73, 93, 59, 10, 105, 102, 40, 73, 62, 61, 68, 41, 123, 68, 61, 73, 43, 49, 59, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 68, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 104, 97, 100, 111, 119, 80, 114, 111, 116, 111, 116, 121, 112, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 66, 44, 103, 44, 104, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 69, 61, 66, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 59, 69, 59, 69, 61, 69, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 41, 123, 10, 118, 97, 114, 32, 71, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 69, 44, 104, 41, 59, 10, 105, 102, 40, 71, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 105, 102, 40, 71, 91, 48, 93, 61, 61, 45, 49, 41, 123, 10, 10, 118, 97, 114, 32, 72, 61, 71, 91, 49, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 103, 59, 105, 60, 72, 59, 105, 43, 43, 41, 123, 10, 105, 102, 40, 69, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 105, 41, 41, 123, 10, 66, 91, 105, 93, 61, 118, 111, 105, 100, 32, 48, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 105, 61, 48, 59, 105, 60, 71, 46, 108, 101, 110, 103, 116, 104, 59, 105, 43, 43, 41, 123, 10, 118, 97, 114, 32, 73, 61, 71, 91, 105, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 73, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 103, 60, 61, 73, 38, 38, 10, 69, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 73, 41, 41, 123, 10, 66, 91, 73, 93, 61, 118, 111, 105, 100, 32, 48, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 97, 102, 101, 82, 101, 109, 111, 118, 101, 65, 114, 114, 97, 121, 72, 111, 108, 101, 115, 40, 66, 41, 123, 10, 10, 10, 10, 118, 97, 114, 32, 74, 61, 48, 59, 10, 118, 97, 114, 32, 75, 61, 67, 45, 49, 59, 10, 118, 97, 114, 32, 76, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 74, 60, 75, 41, 123, 10, 10, 119, 104, 105, 108, 101, 40, 74, 60, 75, 38, 38, 10, 33, 40, 116, 121, 112, 101, 111, 102, 40, 66, 91, 74, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 74, 43, 43, 59, 10, 125, 10, 10, 10, 105, 102, 40, 33, 66, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 74, 41, 41, 123, 10, 76, 43, 43, 59, 10, 125, 10, 10, 10, 119, 104, 105, 108, 101, 40, 74, 60, 75, 38, 38, 10, 40, 116, 121, 112, 101, 111, 102, 40, 66, 91, 75, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 105, 102, 40, 33, 66, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 75, 41, 41, 123, 10, 76, 43, 43, 59, 10, 125, 10, 75, 45, 45, 59, 10, 125, 10, 105, 102, 40, 74, 60, 75, 41, 123, 10, 10, 66, 91, 74, 93, 61, 66, 91, 75, 93, 59, 10, 66, 91, 75, 93, 61, 118, 111, 105, 100, 32, 48, 59, 10, 125, 10, 125, 10, 10, 10, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 66, 91, 74, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 74, 43, 43, 59, 10, 10, 10, 118, 97, 114, 32, 105, 59, 10, 102, 111, 114, 40, 105, 61, 74, 59, 105, 60, 67, 45, 76, 59, 105, 43, 43, 41, 123, 10, 66, 91, 105, 93, 61, 118, 111, 105, 100, 32, 48, 59, 10, 125, 10, 102, 111, 114, 40, 105, 61, 67, 45, 76, 59, 105, 60, 67, 59, 105, 43, 43, 41, 123, 10, 10, 105, 102, 40, 105, 32, 105, 110, 32, 66, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 41, 123, 10, 66, 91, 105, 93, 61, 118, 111, 105, 100, 32, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 101, 108, 101, 116, 101, 32, 66, 91, 105, 93, 59, 10, 125, 10, 125, 10, 10, 10, 114, 101, 116, 117, 114, 110, 32, 74, 59, 10, 125, 10, 10, 118, 97, 114, 32, 67, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 67, 60, 50, 41, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 118, 97, 114, 32, 77, 61, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 78, 59, 10, 105, 102, 40, 33, 77, 41, 123, 10, 10, 10, 10, 10, 10, 10, 10, 10, 78, 61, 67, 111, 112, 121, 70, 114, 111, 109, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 116, 104, 105, 115, 44, 67, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 79, 61, 37, 82, 101, 109, 111, 118, 101, 65, 114, 114, 97, 121, 72, 111, 108, 101, 115, 40, 116, 104, 105, 115, 44, 67, 41, 59, 10, 105, 102, 40, 79, 61, 61, 45, 49, 41, 123, 10, 10, 10, 10, 79, 61, 83, 97, 102, 101, 82, 101, 109, 111, 118, 101, 65, 114, 114, 97, 121, 72, 111, 108, 101, 115, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 81, 117, 105, 99, 107, 83, 111, 114, 116, 40, 116, 104, 105, 115, 44, 48, 44, 79, 41, 59, 10, 10, 105, 102, 40, 33, 77, 38, 38, 40, 79, 43, 49, 60, 78, 41, 41, 123, 10, 10, 10, 83, 104, 97, 100, 111, 119, 80, 114, 111, 116, 111, 116, 121, 112, 101, 69, 108, 101, 109, 101, 110, 116, 115, 40, 116, 104, 105, 115, 44, 79, 44, 78, 41, 59, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 105, 108, 116, 101, 114, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 100, 61, 91, 93, 59, 10, 118, 97, 114, 32, 103, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 104, 61, 48, 59, 104, 60, 99, 59, 104, 43, 43, 41, 123, 10, 118, 97, 114, 32, 105, 61, 116, 104, 105, 115, 91, 104, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 105, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 104, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 105, 102, 40, 97, 46, 99, 97, 108, 108, 40, 98, 44, 105, 44, 104, 44, 116, 104, 105, 115, 41, 41, 123, 10, 100, 91, 103, 43, 43, 93, 61, 105, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 116, 104, 105, 115, 91, 100, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 103, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 100, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 97, 46, 99, 97, 108, 108, 40, 98, 44, 103, 44, 100, 44, 116, 104, 105, 115, 41, 59, 10, 125, 10, 125, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 83, 111, 109, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 116, 104, 105, 115, 91, 100, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 103, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 100, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 105, 102, 40, 97, 46, 99, 97, 108, 108, 40, 98, 44, 103, 44, 100, 44, 116, 104, 105, 115, 41, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 69, 118, 101, 114, 121, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 116, 104, 105, 115, 91, 100, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 103, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 100, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 105, 102, 40, 33, 97, 46, 99, 97, 108, 108, 40, 98, 44, 103, 44, 100, 44, 116, 104, 105, 115, 41, 41, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 77, 97, 112, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 41, 59, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 104, 61, 48, 59, 104, 60, 99, 59, 104, 43, 43, 41, 123, 10, 118, 97, 114, 32, 105, 61, 116, 104, 105, 115, 91, 104, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 105, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 104, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 103, 91, 104, 93, 61, 97, 46, 99, 97, 108, 108, 40, 98, 44, 105, 44, 104, 44, 116, 104, 105, 115, 41, 59, 10, 125, 10, 125, 10, 37, 77, 111, 118, 101, 65, 114, 114, 97, 121, 67, 111, 110, 116, 101, 110, 116, 115, 40, 103, 44, 100, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 99, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 98, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 10, 105, 102, 40, 98, 60, 48, 41, 123, 10, 98, 61, 99, 43, 98, 59, 10, 10, 105, 102, 40, 98, 60, 48, 41, 98, 61, 48, 59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 100, 61, 98, 59, 10, 118, 97, 114, 32, 103, 61, 99, 59, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40, 116, 104, 105, 115, 44, 99, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 41, 123, 10, 118, 97, 114, 32, 104, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 116, 104, 105, 115, 44, 99, 41, 59, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 50, 38, 38, 104, 91, 48, 93, 60, 48, 41, 123, 10, 10, 118, 97, 114, 32, 105, 61, 45, 40, 104, 91, 48, 93, 43, 49, 41, 59, 10, 118, 97, 114, 32, 106, 61, 105, 43, 104, 91, 49, 93, 59, 10, 105, 102, 40, 100, 60, 105, 41, 100, 61, 105, 59, 10, 103, 61, 106, 59, 10, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 10, 118, 97, 114, 32, 107, 61, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 116, 104, 105, 115, 44, 104, 41, 59, 10, 118, 97, 114, 32, 108, 61, 107, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 109, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 109, 60, 108, 38, 38, 107, 91, 109, 93, 60, 98, 41, 109, 43, 43, 59, 10, 119, 104, 105, 108, 101, 40, 109, 60, 108, 41, 123, 10, 118, 97, 114, 32, 110, 61, 107, 91, 109, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 110, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 116, 104, 105, 115, 91, 110, 93, 61, 61, 61, 97, 41, 114, 101, 116, 117, 114, 110, 32, 110, 59, 10, 109, 43, 43, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 125, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 109, 61, 100, 59, 109, 60, 103, 59, 109, 43, 43, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 91, 109, 93, 61, 61, 61, 97, 41, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 109, 61, 100, 59, 109, 60, 103, 59, 109, 43, 43, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 91, 109, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 109, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 99, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 98, 61, 99, 45, 49, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 10, 105, 102, 40, 98, 60, 48, 41, 98, 43, 61, 99, 59, 10, 10, 105, 102, 40, 98, 60, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 101, 108, 115, 101, 32, 105, 102, 40, 98, 62, 61, 99, 41, 98, 61, 99, 45, 49, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 118, 97, 114, 32, 103, 61, 98, 59, 10, 105, 102, 40, 85, 115, 101, 83, 112, 97, 114, 115, 101, 86, 97, 114, 105, 97, 110, 116, 40, 116, 104, 105, 115, 44, 99, 44, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 41, 41, 123, 10, 118, 97, 114, 32, 104, 61, 37, 71, 101, 116, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 116, 104, 105, 115, 44, 98, 43, 49, 41, 59, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 50, 38, 38, 104, 91, 48, 93, 60, 48, 41, 123, 10, 10, 118, 97, 114, 32, 105, 61, 45, 40, 104, 91, 48, 93, 43, 49, 41, 59, 10, 118, 97, 114, 32, 106, 61, 105, 43, 104, 91, 49, 93, 59, 10, 105, 102, 40, 100, 60, 105, 41, 100, 61, 105, 59, 10, 103, 61, 106, 59, 10, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 10, 118, 97, 114, 32, 107, 61, 71, 101, 116, 83, 111, 114, 116, 101, 100, 65, 114, 114, 97, 121, 75, 101, 121, 115, 40, 116, 104, 105, 115, 44, 104, 41, 59, 10, 118, 97, 114, 32, 108, 61, 107, 46, 108, 101, 110, 103, 116, 104, 45, 49, 59, 10, 119, 104, 105, 108, 101, 40, 108, 62, 61, 48, 41, 123, 10, 118, 97, 114, 32, 109, 61, 107, 91, 108, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 109, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 116, 104, 105, 115, 91, 109, 93, 61, 61, 61, 97, 41, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 108, 45, 45, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 125, 10, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 108, 61, 103, 59, 108, 62, 61, 100, 59, 108, 45, 45, 41, 123, 10, 105, 102, 40, 116, 104, 105, 115, 91, 108, 93, 61, 61, 61, 97, 41, 114, 101, 116, 117, 114, 110, 32, 108, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 108, 61, 103, 59, 108, 62, 61, 100, 59, 108, 45, 45, 41, 123, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 91, 108, 93, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 38, 38, 108, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 108, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 82, 101, 100, 117, 99, 101, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 10, 102, 105, 110, 100, 95, 105, 110, 105, 116, 105, 97, 108, 58, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 102, 111, 114, 40, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 98, 61, 116, 104, 105, 115, 91, 100, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 100, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 100, 43, 43, 59, 10, 98, 114, 101, 97, 107, 32, 102, 105, 110, 100, 95, 105, 110, 105, 116, 105, 97, 108, 59, 10, 125, 10, 125, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 114, 101, 100, 117, 99, 101, 95, 110, 111, 95, 105, 110, 105, 116, 105, 97, 108, 39, 44, 91, 93, 41, 59, 10, 125, 10, 10, 102, 111, 114, 40, 59, 100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 116, 104, 105, 115, 91, 100, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 103, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 100, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 98, 61, 97, 46, 99, 97, 108, 108, 40, 110, 117, 108, 108, 44, 98, 44, 103, 44, 100, 44, 116, 104, 105, 115, 41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 82, 101, 100, 117, 99, 101, 82, 105, 103, 104, 116, 40, 97, 44, 98, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 45, 49, 59, 10, 10, 102, 105, 110, 100, 95, 105, 110, 105, 116, 105, 97, 108, 58, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 60, 50, 41, 123, 10, 102, 111, 114, 40, 59, 99, 62, 61, 48, 59, 99, 45, 45, 41, 123, 10, 98, 61, 116, 104, 105, 115, 91, 99, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 99, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 99, 45, 45, 59, 10, 98, 114, 101, 97, 107, 32, 102, 105, 110, 100, 95, 105, 110, 105, 116, 105, 97, 108, 59, 10, 125, 10, 125, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 114, 101, 100, 117, 99, 101, 95, 110, 111, 95, 105, 110, 105, 116, 105, 97, 108, 39, 44, 91, 93, 41, 59, 10, 125, 10, 10, 102, 111, 114, 40, 59, 99, 62, 61, 48, 59, 99, 45, 45, 41, 123, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 91, 99, 93, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 124, 124, 99, 32, 105, 110, 32, 116, 104, 105, 115, 41, 123, 10, 98, 61, 97, 46, 99, 97, 108, 108, 40, 110, 117, 108, 108, 44, 98, 44, 100, 44, 99, 44, 116, 104, 105, 115, 41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 73, 115, 65, 114, 114, 97, 121, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 37, 95, 73, 115, 65, 114, 114, 97, 121, 40, 97, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 65, 114, 114, 97, 121, 40, 41, 123, 10, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 65, 114, 114, 97, 121, 44, 50, 41, 59, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 105, 115, 65, 114, 114, 97, 121, 34, 44, 65, 114, 114, 97, 121, 73, 115, 65, 114, 114, 97, 121, 10, 41, 41, 59, 10, 10, 118, 97, 114, 32, 97, 61, 37, 83, 112, 101, 99, 105, 97, 108, 65, 114, 114, 97, 121, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 123, 125, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 99, 59, 10, 105, 102, 40, 97, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 41, 41, 123, 10, 103, 61, 97, 91, 98, 93, 59, 10, 125, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 76, 101, 110, 103, 116, 104, 40, 103, 44, 100, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 103, 59, 10, 125, 10, 10, 10, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 79, 110, 72, 105, 100, 100, 101, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 65, 114, 114, 97, 121, 84, 111, 83, 116, 114, 105, 110, 103, 41, 44, 10, 34, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 34, 44, 65, 114, 114, 97, 121, 84, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 41, 44, 10, 34, 106, 111, 105, 110, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 106, 111, 105, 110, 34, 44, 65, 114, 114, 97, 121, 74, 111, 105, 110, 41, 44, 10, 34, 112, 111, 112, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 112, 111, 112, 34, 44, 65, 114, 114, 97, 121, 80, 111, 112, 41, 44, 10, 34, 112, 117, 115, 104, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 112, 117, 115, 104, 34, 44, 65, 114, 114, 97, 121, 80, 117, 115, 104, 44, 49, 41, 44, 10, 34, 99, 111, 110, 99, 97, 116, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 99, 111, 110, 99, 97, 116, 34, 44, 65, 114, 114, 97, 121, 67, 111, 110, 99, 97, 116, 44, 49, 41, 44, 10, 34, 114, 101, 118, 101, 114, 115, 101, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 114, 101, 118, 101, 114, 115, 101, 34, 44, 65, 114, 114, 97, 121, 82, 101, 118, 101, 114, 115, 101, 41, 44, 10, 34, 115, 104, 105, 102, 116, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 115, 104, 105, 102, 116, 34, 44, 65, 114, 114, 97, 121, 83, 104, 105, 102, 116, 41, 44, 10, 34, 117, 110, 115, 104, 105, 102, 116, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 117, 110, 115, 104, 105, 102, 116, 34, 44, 65, 114, 114, 97, 121, 85, 110, 115, 104, 105, 102, 116, 44, 49, 41, 44, 10, 34, 115, 108, 105, 99, 101, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 115, 108, 105, 99, 101, 34, 44, 65, 114, 114, 97, 121, 83, 108, 105, 99, 101, 44, 50, 41, 44, 10, 34, 115, 112, 108, 105, 99, 101, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 115, 112, 108, 105, 99, 101, 34, 44, 65, 114, 114, 97, 121, 83, 112, 108, 105, 99, 101, 44, 50, 41, 44, 10, 34, 115, 111, 114, 116, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 115, 111, 114, 116, 34, 44, 65, 114, 114, 97, 121, 83, 111, 114, 116, 41, 44, 10, 34, 102, 105, 108, 116, 101, 114, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 102, 105, 108, 116, 101, 114, 34, 44, 65, 114, 114, 97, 121, 70, 105, 108, 116, 101, 114, 44, 49, 41, 44, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 44, 49, 41, 44, 10, 34, 115, 111, 109, 101, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 115, 111, 109, 101, 34, 44, 65, 114, 114, 97, 121, 83, 111, 109, 101, 44, 49, 41, 44, 10, 34, 101, 118, 101, 114, 121, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 101, 118, 101, 114, 121, 34, 44, 65, 114, 114, 97, 121, 69, 118, 101, 114, 121, 44, 49, 41, 44, 10, 34, 109, 97, 112, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 109, 97, 112, 34, 44, 65, 114, 114, 97, 121, 77, 97, 112, 44, 49, 41, 44, 10, 34, 105, 110, 100, 101, 120, 79, 102, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 105, 110, 100, 101, 120, 79, 102, 34, 44, 65, 114, 114, 97, 121, 73, 110, 100, 101, 120, 79, 102, 44, 49, 41, 44, 10, 34, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 34, 44, 65, 114, 114, 97, 121, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 44, 49, 41, 44, 10, 34, 114, 101, 100, 117, 99, 101, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 114, 101, 100, 117, 99, 101, 34, 44, 65, 114, 114, 97, 121, 82, 101, 100, 117, 99, 101, 44, 49, 41, 44, 10, 34, 114, 101, 100, 117, 99, 101, 82, 105, 103, 104, 116, 34, 44, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 114, 101, 100, 117, 99, 101, 82, 105, 103, 104, 116, 34, 44, 65, 114, 114, 97, 121, 82, 101, 100, 117, 99, 101, 82, 105, 103, 104, 116, 44, 49, 41, 10, 41, 41, 59, 10, 10, 37, 70, 105, 110, 105, 115, 104, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 83, 101, 116, 117, 112, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 10, 10, 10, 10, 10, 10, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 95, 112, 114, 111, 116, 111, 95, 95, 61, 110, 117, 108, 108, 59, 10, 10, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 106, 111, 105, 110, 61, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 106, 111, 105, 110, 34, 44, 65, 114, 114, 97, 121, 74, 111, 105, 110, 41, 59, 10, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 111, 112, 61, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 112, 111, 112, 34, 44, 65, 114, 114, 97, 121, 80, 111, 112, 41, 59, 10, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 117, 115, 104, 61, 103, 101, 116, 70, 117, 110, 99, 116, 105, 111, 110, 40, 34, 112, 117, 115, 104, 34, 44, 65, 114, 114, 97, 121, 80, 117, 115, 104, 41, 59, 10, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 73, 110, 116, 101, 114, 110, 97, 108, 32, 65, 114, 114, 97, 121, 44, 32, 108, 101, 110, 103, 116, 104, 32, 34, 43, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 125, 10, 10, 10, 83, 101, 116, 117, 112, 65, 114, 114, 97, 121, 40, 41, 59, 10, 10, 0 };
 
-  static const char string[] = { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 83, 116, 114, 105, 110, 103, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 48, 63, 39, 39, 58, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 95, 83, 101, 116, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 125, 41, 59, 10, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 116, 114, 105, 110, 103, 44, 110, 101, 119, 32, 36, 83, 116, 114, 105, 110, 103, 40, 41, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 38, 38, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 86, 97, 108, 117, 101, 79, 102, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 38, 38, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101, 79, 102, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 41, 123, 10, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 41, 123, 10, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 49, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 43, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 97, 43, 49, 41, 59, 10, 99, 91, 48, 93, 61, 98, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 97, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 99, 91, 100, 43, 49, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 103, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 103, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 103, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 99, 44, 97, 43, 49, 44, 34, 34, 41, 59, 10, 125, 10, 10, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 76, 101, 110, 103, 116, 104, 40, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 44, 49, 41, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 99, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 99, 41, 41, 63, 99, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 99, 41, 41, 41, 59, 10, 105, 102, 40, 99, 60, 48, 41, 99, 61, 48, 59, 10, 105, 102, 40, 99, 62, 98, 46, 108, 101, 110, 103, 116, 104, 41, 99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 97, 44, 99, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 103, 61, 99, 45, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 118, 97, 114, 32, 104, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 41, 59, 10, 105, 102, 40, 33, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 38, 38, 33, 40, 104, 61, 61, 104, 41, 41, 41, 123, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 63, 104, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 104, 41, 41, 41, 59, 10, 105, 102, 40, 104, 60, 48, 41, 123, 10, 104, 61, 48, 59, 10, 125, 10, 105, 102, 40, 104, 43, 100, 60, 99, 41, 123, 10, 103, 61, 104, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 97, 44, 103, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 105, 102, 40, 33, 97, 46, 103, 108, 111, 98, 97, 108, 41, 114, 101, 116, 117, 114, 110, 32, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 78, 111, 84, 101, 115, 116, 115, 40, 97, 44, 98, 44, 48, 41, 59, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 109, 97, 116, 99, 104, 44, 37, 48, 83, 44, 37, 49, 114, 39, 44, 91, 98, 44, 97, 93, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 40, 98, 44, 97, 44, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 59, 10, 125, 10, 10, 97, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 78, 111, 84, 101, 115, 116, 115, 40, 97, 44, 98, 44, 48, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 105, 102, 40, 98, 43, 49, 61, 61, 99, 41, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 97, 44, 98, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 61, 91, 50, 44, 34, 34, 44, 34, 34, 44, 45, 49, 44, 45, 49, 93, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 114, 101, 112, 108, 97, 99, 101, 44, 37, 48, 114, 44, 37, 49, 83, 39, 44, 91, 97, 44, 99, 93, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 41, 123, 10, 105, 102, 40, 97, 46, 103, 108, 111, 98, 97, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 97, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 78, 111, 110, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 10, 97, 44, 10, 98, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 83, 116, 114, 105, 110, 103, 40, 99, 44, 10, 97, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 98, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 41, 41, 44, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 59, 10, 125, 10, 125, 10, 10, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 99, 44, 97, 44, 48, 41, 59, 10, 105, 102, 40, 100, 60, 48, 41, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 118, 97, 114, 32, 103, 61, 100, 43, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 118, 97, 114, 32, 104, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 99, 41, 59, 10, 10, 104, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 100, 41, 59, 10, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 41, 123, 10, 104, 46, 97, 100, 100, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 44, 10, 97, 44, 10, 100, 44, 10, 99, 44, 10, 98, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 91, 51, 93, 61, 100, 59, 10, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 91, 52, 93, 61, 103, 59, 10, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 98, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 41, 41, 59, 10, 69, 120, 112, 97, 110, 100, 82, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 40, 98, 44, 99, 44, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 44, 104, 41, 59, 10, 125, 10, 10, 10, 104, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 103, 44, 99, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 104, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 112, 97, 110, 100, 82, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 104, 61, 100, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 118, 97, 114, 32, 105, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 39, 36, 39, 44, 48, 41, 59, 10, 105, 102, 40, 105, 60, 48, 41, 123, 10, 105, 102, 40, 103, 62, 48, 41, 104, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 106, 61, 40, 40, 99, 41, 91, 48, 93, 41, 62, 62, 49, 59, 10, 10, 105, 102, 40, 105, 62, 48, 41, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 48, 44, 105, 41, 41, 59, 10, 10, 119, 104, 105, 108, 101, 40, 116, 114, 117, 101, 41, 123, 10, 118, 97, 114, 32, 107, 61, 39, 36, 39, 59, 10, 118, 97, 114, 32, 108, 61, 105, 43, 49, 59, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 118, 97, 114, 32, 109, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 44, 108, 41, 59, 10, 105, 102, 40, 109, 61, 61, 51, 54, 41, 123, 10, 43, 43, 108, 59, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 51, 56, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 99, 91, 51, 93, 44, 10, 99, 91, 52, 93, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 57, 54, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 99, 91, 51, 93, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 51, 57, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 99, 91, 52, 93, 44, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 62, 61, 52, 56, 38, 38, 109, 60, 61, 53, 55, 41, 123, 10, 43, 43, 108, 59, 10, 118, 97, 114, 32, 110, 61, 109, 45, 52, 56, 59, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 109, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 44, 108, 41, 59, 10, 10, 105, 102, 40, 110, 33, 61, 48, 38, 38, 109, 61, 61, 52, 56, 124, 124, 109, 62, 61, 52, 57, 38, 38, 109, 60, 61, 53, 55, 41, 123, 10, 118, 97, 114, 32, 111, 61, 110, 42, 49, 48, 43, 40, 109, 45, 52, 56, 41, 59, 10, 105, 102, 40, 111, 60, 106, 41, 123, 10, 10, 10, 10, 10, 10, 43, 43, 108, 59, 10, 110, 61, 111, 59, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 48, 60, 110, 38, 38, 110, 60, 106, 41, 123, 10, 97, 100, 100, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 100, 44, 99, 44, 110, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 10, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 45, 45, 108, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 10, 10, 10, 105, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 39, 36, 39, 44, 108, 41, 59, 10, 10, 10, 10, 105, 102, 40, 105, 60, 48, 41, 123, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 108, 44, 103, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 10, 105, 102, 40, 105, 62, 108, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 108, 44, 105, 41, 41, 59, 10, 125, 10, 125, 10, 125, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 118, 97, 114, 32, 100, 61, 99, 60, 60, 49, 59, 10, 10, 118, 97, 114, 32, 103, 61, 98, 91, 40, 51, 43, 40, 100, 41, 41, 93, 59, 10, 10, 105, 102, 40, 103, 60, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32, 104, 61, 98, 91, 40, 51, 43, 40, 100, 43, 49, 41, 41, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 103, 44, 104, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100, 100, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 118, 97, 114, 32, 100, 61, 99, 60, 60, 49, 59, 10, 10, 118, 97, 114, 32, 103, 61, 98, 91, 40, 51, 43, 40, 100, 41, 41, 93, 59, 10, 105, 102, 40, 103, 60, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32, 104, 61, 98, 91, 40, 51, 43, 40, 100, 43, 49, 41, 41, 93, 59, 10, 97, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 103, 44, 104, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 118, 97, 114, 32, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 49, 54, 41, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 59, 10, 105, 102, 40, 100, 41, 123, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 110, 117, 108, 108, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 10, 10, 100, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 49, 54, 41, 59, 10, 125, 10, 118, 97, 114, 32, 103, 61, 37, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 77, 117, 108, 116, 105, 112, 108, 101, 40, 98, 44, 10, 97, 44, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 44, 10, 100, 41, 59, 10, 98, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 61, 48, 59, 10, 105, 102, 40, 40, 103, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 125, 10, 118, 97, 114, 32, 104, 61, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 105, 102, 40, 40, 40, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 91, 48, 93, 41, 61, 61, 50, 41, 123, 10, 118, 97, 114, 32, 106, 61, 48, 59, 10, 118, 97, 114, 32, 107, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 110, 117, 108, 108, 44, 48, 44, 97, 41, 59, 10, 118, 97, 114, 32, 108, 61, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 59, 10, 119, 104, 105, 108, 101, 40, 105, 60, 104, 41, 123, 10, 118, 97, 114, 32, 109, 61, 103, 91, 105, 93, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 109, 41, 41, 123, 10, 105, 102, 40, 109, 62, 48, 41, 123, 10, 106, 61, 40, 109, 62, 62, 49, 49, 41, 43, 40, 109, 38, 48, 120, 55, 102, 102, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 106, 61, 103, 91, 43, 43, 105, 93, 45, 109, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 107, 91, 48, 93, 61, 109, 59, 10, 107, 91, 49, 93, 61, 106, 59, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 79, 118, 101, 114, 114, 105, 100, 101, 61, 107, 59, 10, 118, 97, 114, 32, 110, 61, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 108, 44, 109, 44, 106, 44, 97, 44, 99, 41, 59, 10, 103, 91, 105, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 110, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 110, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 110, 41, 41, 59, 10, 106, 43, 61, 109, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 105, 43, 43, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 119, 104, 105, 108, 101, 40, 105, 60, 104, 41, 123, 10, 118, 97, 114, 32, 109, 61, 103, 91, 105, 93, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 109, 41, 41, 123, 10, 10, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 79, 118, 101, 114, 114, 105, 100, 101, 61, 109, 59, 10, 118, 97, 114, 32, 110, 61, 99, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 109, 41, 59, 10, 103, 91, 105, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 110, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 110, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 110, 41, 41, 59, 10, 125, 10, 105, 43, 43, 59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 111, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 44, 103, 41, 59, 10, 118, 97, 114, 32, 113, 61, 111, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 100, 46, 108, 101, 110, 103, 116, 104, 61, 48, 59, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 113, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 78, 111, 110, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 98, 44, 97, 44, 48, 41, 59, 10, 105, 102, 40, 40, 100, 61, 61, 61, 110, 117, 108, 108, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 41, 59, 10, 118, 97, 114, 32, 104, 61, 100, 91, 51, 93, 59, 10, 103, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 104, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 91, 52, 93, 59, 10, 10, 10, 10, 118, 97, 114, 32, 106, 61, 40, 40, 100, 41, 91, 48, 93, 41, 62, 62, 49, 59, 10, 118, 97, 114, 32, 107, 59, 10, 105, 102, 40, 106, 61, 61, 49, 41, 123, 10, 10, 118, 97, 114, 32, 108, 61, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 104, 44, 105, 41, 59, 10, 10, 107, 61, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 44, 108, 44, 104, 44, 97, 44, 99, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 109, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 106, 43, 50, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 110, 61, 48, 59, 110, 60, 106, 59, 110, 43, 43, 41, 123, 10, 109, 91, 110, 93, 61, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 100, 44, 110, 41, 59, 10, 125, 10, 109, 91, 110, 93, 61, 104, 59, 10, 109, 91, 110, 43, 49, 93, 61, 97, 59, 10, 10, 107, 61, 99, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 109, 41, 59, 10, 125, 10, 10, 103, 46, 97, 100, 100, 40, 107, 41, 59, 10, 10, 10, 103, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 105, 44, 97, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 103, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 101, 97, 114, 99, 104, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 98, 61, 37, 95, 71, 101, 116, 70, 114, 111, 109, 67, 97, 99, 104, 101, 40, 48, 44, 97, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 98, 61, 97, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 97, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 98, 44, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 48, 41, 59, 10, 105, 102, 40, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 91, 51, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 108, 105, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 103, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 118, 97, 114, 32, 104, 61, 100, 59, 10, 105, 102, 40, 98, 33, 61, 61, 118, 111, 105, 100, 32, 48, 41, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 103, 43, 61, 100, 59, 10, 105, 102, 40, 103, 60, 48, 41, 10, 103, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 103, 62, 100, 41, 10, 103, 61, 100, 59, 10, 125, 10, 10, 105, 102, 40, 104, 60, 48, 41, 123, 10, 104, 43, 61, 100, 59, 10, 105, 102, 40, 104, 60, 48, 41, 10, 104, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 62, 100, 41, 10, 104, 61, 100, 59, 10, 125, 10, 10, 118, 97, 114, 32, 105, 61, 104, 45, 103, 59, 10, 105, 102, 40, 105, 60, 48, 41, 10, 105, 61, 48, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 103, 44, 103, 43, 105, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 63, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 58, 40, 98, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 98, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10, 10, 10, 10, 10, 10, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 61, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 99, 93, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 103, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 10, 105, 102, 40, 103, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 65, 114, 114, 97, 121, 40, 99, 44, 98, 41, 59, 10, 10, 118, 97, 114, 32, 104, 61, 37, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 99, 44, 97, 44, 98, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 115, 112, 108, 105, 116, 44, 37, 48, 83, 44, 37, 49, 114, 39, 44, 91, 99, 44, 97, 93, 41, 59, 10, 10, 105, 102, 40, 100, 61, 61, 61, 48, 41, 123, 10, 105, 102, 40, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 97, 44, 99, 44, 48, 44, 48, 41, 33, 61, 110, 117, 108, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 91, 99, 93, 59, 10, 125, 10, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 118, 97, 114, 32, 106, 61, 48, 59, 10, 118, 97, 114, 32, 107, 61, 48, 59, 10, 118, 97, 114, 32, 104, 61, 91, 93, 59, 10, 10, 111, 117, 116, 101, 114, 95, 108, 111, 111, 112, 58, 10, 119, 104, 105, 108, 101, 40, 116, 114, 117, 101, 41, 123, 10, 10, 105, 102, 40, 106, 61, 61, 61, 100, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 100, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 10, 118, 97, 114, 32, 108, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 97, 44, 99, 44, 106, 41, 59, 10, 105, 102, 40, 108, 61, 61, 110, 117, 108, 108, 124, 124, 100, 61, 61, 61, 40, 107, 61, 108, 91, 51, 93, 41, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 100, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 118, 97, 114, 32, 109, 61, 108, 91, 52, 93, 59, 10, 10, 10, 105, 102, 40, 106, 61, 61, 61, 109, 38, 38, 109, 61, 61, 61, 105, 41, 123, 10, 106, 43, 43, 59, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 125, 10, 10, 105, 102, 40, 105, 43, 49, 61, 61, 107, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 105, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 107, 41, 41, 59, 10, 125, 10, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 98, 41, 98, 114, 101, 97, 107, 59, 10, 10, 118, 97, 114, 32, 110, 61, 40, 40, 108, 41, 91, 48, 93, 41, 43, 51, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 111, 61, 51, 43, 50, 59, 111, 60, 110, 59, 41, 123, 10, 118, 97, 114, 32, 113, 61, 108, 91, 111, 43, 43, 93, 59, 10, 118, 97, 114, 32, 114, 61, 108, 91, 111, 43, 43, 93, 59, 10, 105, 102, 40, 114, 33, 61, 45, 49, 41, 123, 10, 105, 102, 40, 113, 43, 49, 61, 61, 114, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 113, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 113, 44, 114, 41, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 98, 41, 98, 114, 101, 97, 107, 32, 111, 117, 116, 101, 114, 95, 108, 111, 111, 112, 59, 10, 125, 10, 10, 106, 61, 105, 61, 109, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 105, 110, 103, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 118, 97, 114, 32, 103, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 103, 61, 48, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 103, 62, 100, 41, 123, 10, 103, 61, 100, 59, 10, 125, 10, 10, 118, 97, 114, 32, 104, 61, 100, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 104, 62, 100, 41, 123, 10, 104, 61, 100, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 60, 48, 41, 104, 61, 48, 59, 10, 105, 102, 40, 103, 62, 104, 41, 123, 10, 118, 97, 114, 32, 105, 61, 104, 59, 10, 104, 61, 103, 59, 10, 103, 61, 105, 59, 10, 125, 10, 125, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 40, 103, 43, 49, 61, 61, 104, 10, 63, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 103, 41, 10, 58, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 103, 44, 104, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10, 10, 10, 10, 105, 102, 40, 98, 61, 61, 61, 118, 111, 105, 100, 32, 48, 41, 123, 10, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 100, 60, 61, 48, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 125, 10, 10, 10, 10, 105, 102, 40, 97, 61, 61, 61, 118, 111, 105, 100, 32, 48, 41, 123, 10, 97, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 10, 10, 105, 102, 40, 97, 62, 61, 99, 46, 108, 101, 110, 103, 116, 104, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 10, 10, 105, 102, 40, 97, 60, 48, 41, 123, 10, 97, 43, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 97, 60, 48, 41, 97, 61, 48, 59, 10, 125, 10, 125, 10, 10, 118, 97, 114, 32, 103, 61, 97, 43, 100, 59, 10, 105, 102, 40, 103, 62, 99, 46, 108, 101, 110, 103, 116, 104, 41, 103, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 114, 101, 116, 117, 114, 110, 40, 97, 43, 49, 61, 61, 103, 10, 63, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 97, 41, 10, 58, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 97, 44, 103, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 116, 114, 117, 101, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 76, 101, 102, 116, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 116, 114, 117, 101, 44, 102, 97, 108, 115, 101, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 82, 105, 103, 104, 116, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 102, 97, 108, 115, 101, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 115, 116, 97, 116, 105, 99, 95, 99, 104, 97, 114, 99, 111, 100, 101, 95, 97, 114, 114, 97, 121, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 52, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 105, 102, 40, 98, 61, 61, 49, 41, 123, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 97, 41, 41, 97, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 70, 114, 111, 109, 67, 111, 100, 101, 40, 97, 38, 48, 120, 102, 102, 102, 102, 41, 59, 10, 125, 10, 10, 10, 10, 10, 118, 97, 114, 32, 99, 61, 115, 116, 97, 116, 105, 99, 95, 99, 104, 97, 114, 99, 111, 100, 101, 95, 97, 114, 114, 97, 121, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 98, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 97, 41, 41, 97, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 99, 91, 100, 93, 61, 97, 59, 10, 125, 10, 99, 46, 108, 101, 110, 103, 116, 104, 61, 98, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 60, 47, 103, 44, 34, 38, 108, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 62, 47, 103, 44, 34, 38, 103, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 34, 47, 103, 44, 34, 38, 113, 117, 111, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 39, 47, 103, 44, 34, 38, 35, 48, 51, 57, 59, 34, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 105, 110, 107, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 97, 32, 104, 114, 101, 102, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 97, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 65, 110, 99, 104, 111, 114, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 97, 32, 110, 97, 109, 101, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 97, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 99, 111, 108, 111, 114, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 102, 111, 110, 116, 32, 99, 111, 108, 111, 114, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 102, 111, 110, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 115, 105, 122, 101, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 102, 111, 110, 116, 32, 115, 105, 122, 101, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 102, 111, 110, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 105, 103, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 105, 103, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 105, 103, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 108, 105, 110, 107, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 108, 105, 110, 107, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 108, 105, 110, 107, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 111, 108, 100, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 105, 120, 101, 100, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 116, 116, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 116, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 73, 116, 97, 108, 105, 99, 115, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 105, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 105, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 109, 97, 108, 108, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 109, 97, 108, 108, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 109, 97, 108, 108, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 116, 114, 105, 107, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 116, 114, 105, 107, 101, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 116, 114, 105, 107, 101, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 117, 98, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 117, 98, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 112, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 117, 112, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 117, 112, 62, 34, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 41, 59, 10, 125, 10, 116, 104, 105, 115, 46, 115, 112, 101, 99, 105, 97, 108, 95, 115, 116, 114, 105, 110, 103, 61, 97, 59, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 98, 45, 97, 59, 10, 105, 102, 40, 97, 60, 48, 124, 124, 99, 60, 61, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 105, 102, 40, 97, 60, 48, 120, 56, 48, 48, 48, 48, 38, 38, 99, 60, 48, 120, 56, 48, 48, 41, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 46, 112, 117, 115, 104, 40, 40, 97, 60, 60, 49, 49, 41, 124, 99, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 100, 46, 112, 117, 115, 104, 40, 45, 99, 41, 59, 10, 100, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 125, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 110, 101, 114, 97, 116, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 97, 44, 97, 46, 108, 101, 110, 103, 116, 104, 44, 116, 104, 105, 115, 46, 115, 112, 101, 99, 105, 97, 108, 95, 115, 116, 114, 105, 110, 103, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 83, 116, 114, 105, 110, 103, 44, 50, 41, 59, 10, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 34, 44, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 10, 41, 41, 59, 10, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 79, 110, 72, 105, 100, 100, 101, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 118, 97, 108, 117, 101, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 86, 97, 108, 117, 101, 79, 102, 44, 10, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 44, 10, 34, 99, 104, 97, 114, 65, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 44, 10, 34, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 44, 10, 34, 99, 111, 110, 99, 97, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 44, 10, 34, 105, 110, 100, 101, 120, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 44, 10, 34, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 44, 10, 34, 108, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 34, 44, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 44, 10, 34, 109, 97, 116, 99, 104, 34, 44, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 44, 10, 34, 114, 101, 112, 108, 97, 99, 101, 34, 44, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 44, 10, 34, 115, 101, 97, 114, 99, 104, 34, 44, 83, 116, 114, 105, 110, 103, 83, 101, 97, 114, 99, 104, 44, 10, 34, 115, 108, 105, 99, 101, 34, 44, 83, 116, 114, 105, 110, 103, 83, 108, 105, 99, 101, 44, 10, 34, 115, 112, 108, 105, 116, 34, 44, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 44, 10, 34, 115, 117, 98, 115, 116, 114, 105, 110, 103, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 105, 110, 103, 44, 10, 34, 115, 117, 98, 115, 116, 114, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 44, 10, 34, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 114, 105, 109, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 44, 10, 34, 116, 114, 105, 109, 76, 101, 102, 116, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 76, 101, 102, 116, 44, 10, 34, 116, 114, 105, 109, 82, 105, 103, 104, 116, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 82, 105, 103, 104, 116, 44, 10, 34, 108, 105, 110, 107, 34, 44, 83, 116, 114, 105, 110, 103, 76, 105, 110, 107, 44, 10, 34, 97, 110, 99, 104, 111, 114, 34, 44, 83, 116, 114, 105, 110, 103, 65, 110, 99, 104, 111, 114, 44, 10, 34, 102, 111, 110, 116, 99, 111, 108, 111, 114, 34, 44, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 99, 111, 108, 111, 114, 44, 10, 34, 102, 111, 110, 116, 115, 105, 122, 101, 34, 44, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 115, 105, 122, 101, 44, 10, 34, 98, 105, 103, 34, 44, 83, 116, 114, 105, 110, 103, 66, 105, 103, 44, 10, 34, 98, 108, 105, 110, 107, 34, 44, 83, 116, 114, 105, 110, 103, 66, 108, 105, 110, 107, 44, 10, 34, 98, 111, 108, 100, 34, 44, 83, 116, 114, 105, 110, 103, 66, 111, 108, 100, 44, 10, 34, 102, 105, 120, 101, 100, 34, 44, 83, 116, 114, 105, 110, 103, 70, 105, 120, 101, 100, 44, 10, 34, 105, 116, 97, 108, 105, 99, 115, 34, 44, 83, 116, 114, 105, 110, 103, 73, 116, 97, 108, 105, 99, 115, 44, 10, 34, 115, 109, 97, 108, 108, 34, 44, 83, 116, 114, 105, 110, 103, 83, 109, 97, 108, 108, 44, 10, 34, 115, 116, 114, 105, 107, 101, 34, 44, 83, 116, 114, 105, 110, 103, 83, 116, 114, 105, 107, 101, 44, 10, 34, 115, 117, 98, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 44, 10, 34, 115, 117, 112, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 112, 10, 41, 41, 59, 10, 125, 10, 10, 10, 83, 101, 116, 117, 112, 83, 116, 114, 105, 110, 103, 40, 41, 59, 10, 10, 0 };
+  static const char string[] = { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 36, 83, 116, 114, 105, 110, 103, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 48, 63, 39, 39, 58, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 37, 95, 83, 101, 116, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 125, 41, 59, 10, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 116, 114, 105, 110, 103, 44, 110, 101, 119, 32, 36, 83, 116, 114, 105, 110, 103, 40, 41, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 38, 38, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 86, 97, 108, 117, 101, 79, 102, 40, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 38, 38, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 83, 116, 114, 105, 110, 103, 39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101, 79, 102, 32, 105, 115, 32, 110, 111, 116, 32, 103, 101, 110, 101, 114, 105, 99, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 86, 97, 108, 117, 101, 79, 102, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 41, 123, 10, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 98, 41, 41, 123, 10, 98, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 49, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 43, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 97, 43, 49, 41, 59, 10, 99, 91, 48, 93, 61, 98, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 97, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 103, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 99, 91, 100, 43, 49, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 103, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 103, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 103, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 99, 44, 97, 43, 49, 44, 34, 34, 41, 59, 10, 125, 10, 10, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 76, 101, 110, 103, 116, 104, 40, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 44, 49, 41, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 99, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 99, 41, 41, 63, 99, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 99, 41, 41, 41, 59, 10, 105, 102, 40, 99, 60, 48, 41, 99, 61, 48, 59, 10, 105, 102, 40, 99, 62, 98, 46, 108, 101, 110, 103, 116, 104, 41, 99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 97, 44, 99, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 103, 61, 99, 45, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 118, 97, 114, 32, 104, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 41, 59, 10, 105, 102, 40, 33, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 38, 38, 33, 40, 104, 61, 61, 104, 41, 41, 41, 123, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 63, 104, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 104, 41, 41, 41, 59, 10, 105, 102, 40, 104, 60, 48, 41, 123, 10, 104, 61, 48, 59, 10, 125, 10, 105, 102, 40, 104, 43, 100, 60, 99, 41, 123, 10, 103, 61, 104, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 97, 44, 103, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 105, 102, 40, 33, 97, 46, 103, 108, 111, 98, 97, 108, 41, 114, 101, 116, 117, 114, 110, 32, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 78, 111, 84, 101, 115, 116, 115, 40, 97, 44, 98, 44, 48, 41, 59, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 109, 97, 116, 99, 104, 44, 37, 48, 83, 44, 37, 49, 114, 39, 44, 91, 98, 44, 97, 93, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 40, 98, 44, 97, 44, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 59, 10, 125, 10, 10, 97, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 78, 111, 84, 101, 115, 116, 115, 40, 97, 44, 98, 44, 48, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 105, 102, 40, 98, 43, 49, 61, 61, 99, 41, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 97, 44, 98, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 59, 10, 125, 10, 10, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 61, 91, 50, 44, 34, 34, 44, 34, 34, 44, 45, 49, 44, 45, 49, 93, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 114, 101, 112, 108, 97, 99, 101, 44, 37, 48, 114, 44, 37, 49, 83, 39, 44, 91, 97, 44, 99, 93, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 41, 123, 10, 105, 102, 40, 97, 46, 103, 108, 111, 98, 97, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 97, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 78, 111, 110, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 10, 97, 44, 10, 98, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 83, 116, 114, 105, 110, 103, 40, 99, 44, 10, 97, 44, 10, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 98, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 41, 41, 44, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 59, 10, 125, 10, 125, 10, 10, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 99, 44, 97, 44, 48, 41, 59, 10, 105, 102, 40, 100, 60, 48, 41, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 118, 97, 114, 32, 103, 61, 100, 43, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 118, 97, 114, 32, 104, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 99, 41, 59, 10, 10, 104, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 100, 41, 59, 10, 10, 10, 105, 102, 40, 40, 37, 95, 73, 115, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 41, 123, 10, 104, 46, 97, 100, 100, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 44, 10, 97, 44, 10, 100, 44, 10, 99, 44, 10, 98, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 91, 51, 93, 61, 100, 59, 10, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 91, 52, 93, 61, 103, 59, 10, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 98, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 98, 41, 41, 59, 10, 69, 120, 112, 97, 110, 100, 82, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 40, 98, 44, 99, 44, 114, 101, 117, 115, 97, 98, 108, 101, 77, 97, 116, 99, 104, 73, 110, 102, 111, 44, 104, 41, 59, 10, 125, 10, 10, 10, 104, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 103, 44, 99, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 104, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 112, 97, 110, 100, 82, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 104, 61, 100, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 118, 97, 114, 32, 105, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 39, 36, 39, 44, 48, 41, 59, 10, 105, 102, 40, 105, 60, 48, 41, 123, 10, 105, 102, 40, 103, 62, 48, 41, 104, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 10, 118, 97, 114, 32, 106, 61, 40, 40, 99, 41, 91, 48, 93, 41, 62, 62, 49, 59, 10, 10, 105, 102, 40, 105, 62, 48, 41, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 48, 44, 105, 41, 41, 59, 10, 10, 119, 104, 105, 108, 101, 40, 116, 114, 117, 101, 41, 123, 10, 118, 97, 114, 32, 107, 61, 39, 36, 39, 59, 10, 118, 97, 114, 32, 108, 61, 105, 43, 49, 59, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 118, 97, 114, 32, 109, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 44, 108, 41, 59, 10, 105, 102, 40, 109, 61, 61, 51, 54, 41, 123, 10, 43, 43, 108, 59, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 51, 56, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 99, 91, 51, 93, 44, 10, 99, 91, 52, 93, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 57, 54, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 99, 91, 51, 93, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 61, 61, 51, 57, 41, 123, 10, 43, 43, 108, 59, 10, 100, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 99, 91, 52, 93, 44, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 109, 62, 61, 52, 56, 38, 38, 109, 60, 61, 53, 55, 41, 123, 10, 43, 43, 108, 59, 10, 118, 97, 114, 32, 110, 61, 109, 45, 52, 56, 59, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 109, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 97, 44, 108, 41, 59, 10, 10, 105, 102, 40, 110, 33, 61, 48, 38, 38, 109, 61, 61, 52, 56, 124, 124, 109, 62, 61, 52, 57, 38, 38, 109, 60, 61, 53, 55, 41, 123, 10, 118, 97, 114, 32, 111, 61, 110, 42, 49, 48, 43, 40, 109, 45, 52, 56, 41, 59, 10, 105, 102, 40, 111, 60, 106, 41, 123, 10, 10, 10, 10, 10, 10, 43, 43, 108, 59, 10, 110, 61, 111, 59, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 48, 60, 110, 38, 38, 110, 60, 106, 41, 123, 10, 97, 100, 100, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 100, 44, 99, 44, 110, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 10, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 45, 45, 108, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 39, 36, 39, 41, 59, 10, 125, 10, 10, 10, 105, 61, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 40, 97, 44, 39, 36, 39, 44, 108, 41, 59, 10, 10, 10, 10, 105, 102, 40, 105, 60, 48, 41, 123, 10, 105, 102, 40, 108, 60, 103, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 108, 44, 103, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 10, 10, 105, 102, 40, 105, 62, 108, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 108, 44, 105, 41, 41, 59, 10, 125, 10, 125, 10, 125, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 118, 97, 114, 32, 100, 61, 99, 60, 60, 49, 59, 10, 10, 118, 97, 114, 32, 103, 61, 98, 91, 40, 51, 43, 40, 100, 41, 41, 93, 59, 10, 10, 105, 102, 40, 103, 60, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32, 104, 61, 98, 91, 40, 51, 43, 40, 100, 43, 49, 41, 41, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 103, 44, 104, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100, 100, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 98, 44, 99, 41, 123, 10, 10, 118, 97, 114, 32, 100, 61, 99, 60, 60, 49, 59, 10, 10, 118, 97, 114, 32, 103, 61, 98, 91, 40, 51, 43, 40, 100, 41, 41, 93, 59, 10, 105, 102, 40, 103, 60, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118, 97, 114, 32, 104, 61, 98, 91, 40, 51, 43, 40, 100, 43, 49, 41, 41, 93, 59, 10, 97, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 103, 44, 104, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 118, 97, 114, 32, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 49, 54, 41, 59, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 59, 10, 105, 102, 40, 100, 41, 123, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 110, 117, 108, 108, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 10, 10, 100, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 49, 54, 41, 59, 10, 125, 10, 118, 97, 114, 32, 103, 61, 37, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 77, 117, 108, 116, 105, 112, 108, 101, 40, 98, 44, 10, 97, 44, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 44, 10, 100, 41, 59, 10, 98, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 61, 48, 59, 10, 105, 102, 40, 40, 103, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 125, 10, 118, 97, 114, 32, 104, 61, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 105, 102, 40, 40, 40, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 91, 48, 93, 41, 61, 61, 50, 41, 123, 10, 118, 97, 114, 32, 106, 61, 48, 59, 10, 118, 97, 114, 32, 107, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 110, 117, 108, 108, 44, 48, 44, 97, 41, 59, 10, 118, 97, 114, 32, 108, 61, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 59, 10, 119, 104, 105, 108, 101, 40, 105, 60, 104, 41, 123, 10, 118, 97, 114, 32, 109, 61, 103, 91, 105, 93, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 109, 41, 41, 123, 10, 105, 102, 40, 109, 62, 48, 41, 123, 10, 106, 61, 40, 109, 62, 62, 49, 49, 41, 43, 40, 109, 38, 48, 120, 55, 102, 102, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 106, 61, 103, 91, 43, 43, 105, 93, 45, 109, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 107, 91, 48, 93, 61, 109, 59, 10, 107, 91, 49, 93, 61, 106, 59, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 79, 118, 101, 114, 114, 105, 100, 101, 61, 107, 59, 10, 118, 97, 114, 32, 110, 61, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 108, 44, 109, 44, 106, 44, 97, 44, 99, 41, 59, 10, 103, 91, 105, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 110, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 110, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 110, 41, 41, 59, 10, 106, 43, 61, 109, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 10, 105, 43, 43, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 118, 97, 114, 32, 106, 61, 40, 40, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 41, 91, 48, 93, 41, 62, 62, 49, 59, 10, 118, 97, 114, 32, 107, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 106, 43, 50, 41, 59, 10, 107, 91, 106, 43, 49, 93, 61, 97, 59, 10, 118, 97, 114, 32, 108, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 105, 60, 104, 41, 123, 10, 118, 97, 114, 32, 109, 61, 103, 91, 105, 93, 59, 10, 105, 102, 40, 37, 95, 73, 115, 83, 109, 105, 40, 109, 41, 41, 123, 10, 103, 91, 108, 43, 43, 93, 61, 109, 59, 10, 105, 102, 40, 109, 60, 61, 48, 41, 103, 91, 108, 43, 43, 93, 61, 103, 91, 43, 43, 105, 93, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 102, 111, 114, 40, 118, 97, 114, 32, 110, 61, 48, 59, 110, 60, 61, 106, 59, 110, 43, 43, 41, 107, 91, 110, 93, 61, 103, 91, 105, 43, 110, 93, 59, 10, 105, 43, 61, 106, 59, 10, 108, 97, 115, 116, 77, 97, 116, 99, 104, 73, 110, 102, 111, 79, 118, 101, 114, 114, 105, 100, 101, 61, 107, 59, 10, 118, 97, 114, 32, 114, 61, 99, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 107, 41, 59, 10, 103, 91, 108, 43, 43, 93, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 114, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 114, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 114, 41, 41, 59, 10, 125, 10, 105, 43, 43, 59, 10, 125, 10, 103, 46, 108, 101, 110, 103, 116, 104, 61, 108, 59, 10, 125, 10, 118, 97, 114, 32, 111, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 44, 103, 41, 59, 10, 118, 97, 114, 32, 113, 61, 111, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 100, 46, 108, 101, 110, 103, 116, 104, 61, 48, 59, 10, 114, 101, 117, 115, 97, 98, 108, 101, 82, 101, 112, 108, 97, 99, 101, 65, 114, 114, 97, 121, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 113, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 78, 111, 110, 71, 108, 111, 98, 97, 108, 82, 101, 103, 69, 120, 112, 87, 105, 116, 104, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 98, 44, 97, 44, 48, 41, 59, 10, 105, 102, 40, 40, 100, 61, 61, 61, 110, 117, 108, 108, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 118, 97, 114, 32, 103, 61, 110, 101, 119, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 41, 59, 10, 118, 97, 114, 32, 104, 61, 100, 91, 51, 93, 59, 10, 103, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 48, 44, 104, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 91, 52, 93, 59, 10, 10, 10, 10, 118, 97, 114, 32, 106, 61, 40, 40, 100, 41, 91, 48, 93, 41, 62, 62, 49, 59, 10, 118, 97, 114, 32, 107, 59, 10, 105, 102, 40, 106, 61, 61, 49, 41, 123, 10, 10, 118, 97, 114, 32, 108, 61, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 97, 44, 104, 44, 105, 41, 59, 10, 10, 107, 61, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 37, 71, 101, 116, 71, 108, 111, 98, 97, 108, 82, 101, 99, 101, 105, 118, 101, 114, 40, 41, 44, 108, 44, 104, 44, 97, 44, 99, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 109, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 106, 43, 50, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 110, 61, 48, 59, 110, 60, 106, 59, 110, 43, 43, 41, 123, 10, 109, 91, 110, 93, 61, 67, 97, 112, 116, 117, 114, 101, 83, 116, 114, 105, 110, 103, 40, 97, 44, 100, 44, 110, 41, 59, 10, 125, 10, 109, 91, 110, 93, 61, 104, 59, 10, 109, 91, 110, 43, 49, 93, 61, 97, 59, 10, 10, 107, 61, 99, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 109, 41, 59, 10, 125, 10, 10, 103, 46, 97, 100, 100, 40, 107, 41, 59, 10, 10, 10, 103, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 40, 105, 44, 97, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 103, 46, 103, 101, 110, 101, 114, 97, 116, 101, 40, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 101, 97, 114, 99, 104, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 59, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 98, 61, 37, 95, 71, 101, 116, 70, 114, 111, 109, 67, 97, 99, 104, 101, 40, 48, 44, 97, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 98, 61, 97, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 97, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 98, 44, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 48, 41, 59, 10, 105, 102, 40, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 91, 51, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 108, 105, 99, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 103, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 118, 97, 114, 32, 104, 61, 100, 59, 10, 105, 102, 40, 98, 33, 61, 61, 118, 111, 105, 100, 32, 48, 41, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 103, 43, 61, 100, 59, 10, 105, 102, 40, 103, 60, 48, 41, 10, 103, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 103, 62, 100, 41, 10, 103, 61, 100, 59, 10, 125, 10, 10, 105, 102, 40, 104, 60, 48, 41, 123, 10, 104, 43, 61, 100, 59, 10, 105, 102, 40, 104, 60, 48, 41, 10, 104, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 62, 100, 41, 10, 104, 61, 100, 59, 10, 125, 10, 10, 118, 97, 114, 32, 105, 61, 104, 45, 103, 59, 10, 105, 102, 40, 105, 60, 48, 41, 10, 105, 61, 48, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 103, 44, 103, 43, 105, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 63, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 58, 40, 98, 62, 62, 62, 48, 41, 59, 10, 105, 102, 40, 98, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10, 10, 10, 10, 10, 10, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 61, 61, 61, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 99, 93, 59, 10, 125, 10, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 103, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 10, 105, 102, 40, 103, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 65, 114, 114, 97, 121, 40, 99, 44, 98, 41, 59, 10, 10, 118, 97, 114, 32, 104, 61, 37, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 40, 99, 44, 97, 44, 98, 41, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 37, 95, 76, 111, 103, 40, 39, 114, 101, 103, 101, 120, 112, 39, 44, 39, 114, 101, 103, 101, 120, 112, 45, 115, 112, 108, 105, 116, 44, 37, 48, 83, 44, 37, 49, 114, 39, 44, 91, 99, 44, 97, 93, 41, 59, 10, 10, 105, 102, 40, 100, 61, 61, 61, 48, 41, 123, 10, 105, 102, 40, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 97, 44, 99, 44, 48, 44, 48, 41, 33, 61, 110, 117, 108, 108, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 91, 99, 93, 59, 10, 125, 10, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 118, 97, 114, 32, 106, 61, 48, 59, 10, 118, 97, 114, 32, 107, 61, 48, 59, 10, 118, 97, 114, 32, 104, 61, 91, 93, 59, 10, 10, 111, 117, 116, 101, 114, 95, 108, 111, 111, 112, 58, 10, 119, 104, 105, 108, 101, 40, 116, 114, 117, 101, 41, 123, 10, 10, 105, 102, 40, 106, 61, 61, 61, 100, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 100, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 10, 118, 97, 114, 32, 108, 61, 68, 111, 82, 101, 103, 69, 120, 112, 69, 120, 101, 99, 40, 97, 44, 99, 44, 106, 41, 59, 10, 105, 102, 40, 108, 61, 61, 110, 117, 108, 108, 124, 124, 100, 61, 61, 61, 40, 107, 61, 108, 91, 51, 93, 41, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 100, 41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 118, 97, 114, 32, 109, 61, 108, 91, 52, 93, 59, 10, 10, 10, 105, 102, 40, 106, 61, 61, 61, 109, 38, 38, 109, 61, 61, 61, 105, 41, 123, 10, 106, 43, 43, 59, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 125, 10, 10, 105, 102, 40, 105, 43, 49, 61, 61, 107, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 105, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 105, 44, 107, 41, 41, 59, 10, 125, 10, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 98, 41, 98, 114, 101, 97, 107, 59, 10, 10, 118, 97, 114, 32, 110, 61, 40, 40, 108, 41, 91, 48, 93, 41, 43, 51, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 111, 61, 51, 43, 50, 59, 111, 60, 110, 59, 41, 123, 10, 118, 97, 114, 32, 113, 61, 108, 91, 111, 43, 43, 93, 59, 10, 118, 97, 114, 32, 114, 61, 108, 91, 111, 43, 43, 93, 59, 10, 105, 102, 40, 114, 33, 61, 45, 49, 41, 123, 10, 105, 102, 40, 113, 43, 49, 61, 61, 114, 41, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 113, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 113, 44, 114, 41, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 104, 46, 112, 117, 115, 104, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 105, 102, 40, 104, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 98, 41, 98, 114, 101, 97, 107, 32, 111, 117, 116, 101, 114, 95, 108, 111, 111, 112, 59, 10, 125, 10, 10, 106, 61, 105, 61, 109, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 105, 110, 103, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 118, 97, 114, 32, 103, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 105, 102, 40, 103, 60, 48, 41, 123, 10, 103, 61, 48, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 103, 62, 100, 41, 123, 10, 103, 61, 100, 59, 10, 125, 10, 10, 118, 97, 114, 32, 104, 61, 100, 59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 98, 41, 61, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 41, 41, 123, 10, 104, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 104, 62, 100, 41, 123, 10, 104, 61, 100, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 104, 60, 48, 41, 104, 61, 48, 59, 10, 105, 102, 40, 103, 62, 104, 41, 123, 10, 118, 97, 114, 32, 105, 61, 104, 59, 10, 104, 61, 103, 59, 10, 103, 61, 105, 59, 10, 125, 10, 125, 10, 125, 10, 10, 114, 101, 116, 117, 114, 110, 40, 103, 43, 49, 61, 61, 104, 10, 63, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 103, 41, 10, 58, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 103, 44, 104, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10, 10, 10, 10, 105, 102, 40, 98, 61, 61, 61, 118, 111, 105, 100, 32, 48, 41, 123, 10, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 59, 10, 105, 102, 40, 100, 60, 61, 48, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 125, 10, 10, 10, 10, 105, 102, 40, 97, 61, 61, 61, 118, 111, 105, 100, 32, 48, 41, 123, 10, 97, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 97, 61, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 10, 10, 105, 102, 40, 97, 62, 61, 99, 46, 108, 101, 110, 103, 116, 104, 41, 114, 101, 116, 117, 114, 110, 39, 39, 59, 10, 10, 10, 105, 102, 40, 97, 60, 48, 41, 123, 10, 97, 43, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 97, 60, 48, 41, 97, 61, 48, 59, 10, 125, 10, 125, 10, 10, 118, 97, 114, 32, 103, 61, 97, 43, 100, 59, 10, 105, 102, 40, 103, 62, 99, 46, 108, 101, 110, 103, 116, 104, 41, 103, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 114, 101, 116, 117, 114, 110, 40, 97, 43, 49, 61, 61, 103, 10, 63, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 40, 99, 44, 97, 41, 10, 58, 37, 95, 83, 117, 98, 83, 116, 114, 105, 110, 103, 40, 99, 44, 97, 44, 103, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 116, 114, 117, 101, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 76, 101, 102, 116, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 116, 114, 117, 101, 44, 102, 97, 108, 115, 101, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 82, 105, 103, 104, 116, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 44, 102, 97, 108, 115, 101, 44, 116, 114, 117, 101, 41, 59, 10, 125, 10, 10, 118, 97, 114, 32, 115, 116, 97, 116, 105, 99, 95, 99, 104, 97, 114, 99, 111, 100, 101, 95, 97, 114, 114, 97, 121, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 52, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 105, 102, 40, 98, 61, 61, 49, 41, 123, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 97, 41, 41, 97, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 70, 114, 111, 109, 67, 111, 100, 101, 40, 97, 38, 48, 120, 102, 102, 102, 102, 41, 59, 10, 125, 10, 10, 10, 10, 10, 118, 97, 114, 32, 99, 61, 115, 116, 97, 116, 105, 99, 95, 99, 104, 97, 114, 99, 111, 100, 101, 95, 97, 114, 114, 97, 121, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 98, 59, 100, 43, 43, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115, 83, 109, 105, 40, 97, 41, 41, 97, 61, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 99, 91, 100, 93, 61, 97, 59, 10, 125, 10, 99, 46, 108, 101, 110, 103, 116, 104, 61, 98, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 60, 47, 103, 44, 34, 38, 108, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 62, 47, 103, 44, 34, 38, 103, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 34, 47, 103, 44, 34, 38, 113, 117, 111, 116, 59, 34, 41, 10, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 39, 47, 103, 44, 34, 38, 35, 48, 51, 57, 59, 34, 41, 59, 10, 125, 59, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 76, 105, 110, 107, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 97, 32, 104, 114, 101, 102, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 97, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 65, 110, 99, 104, 111, 114, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 97, 32, 110, 97, 109, 101, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 97, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 99, 111, 108, 111, 114, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 102, 111, 110, 116, 32, 99, 111, 108, 111, 114, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 102, 111, 110, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 115, 105, 122, 101, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 102, 111, 110, 116, 32, 115, 105, 122, 101, 61, 92, 34, 34, 43, 72, 116, 109, 108, 69, 115, 99, 97, 112, 101, 40, 97, 41, 43, 34, 92, 34, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 102, 111, 110, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 105, 103, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 105, 103, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 105, 103, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 108, 105, 110, 107, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 108, 105, 110, 107, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 108, 105, 110, 107, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 66, 111, 108, 100, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 98, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 98, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 105, 120, 101, 100, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 116, 116, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 116, 116, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 73, 116, 97, 108, 105, 99, 115, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 105, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 105, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 109, 97, 108, 108, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 109, 97, 108, 108, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 109, 97, 108, 108, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 116, 114, 105, 107, 101, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 116, 114, 105, 107, 101, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 116, 114, 105, 107, 101, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 98, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 117, 98, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 117, 98, 62, 34, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 117, 112, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 34, 60, 115, 117, 112, 62, 34, 43, 116, 104, 105, 115, 43, 34, 60, 47, 115, 117, 112, 62, 34, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 41, 59, 10, 125, 10, 116, 104, 105, 115, 46, 115, 112, 101, 99, 105, 97, 108, 95, 115, 116, 114, 105, 110, 103, 61, 97, 59, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 83, 112, 101, 99, 105, 97, 108, 83, 108, 105, 99, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 98, 45, 97, 59, 10, 105, 102, 40, 97, 60, 48, 124, 124, 99, 60, 61, 48, 41, 114, 101, 116, 117, 114, 110, 59, 10, 105, 102, 40, 97, 60, 48, 120, 56, 48, 48, 48, 48, 38, 38, 99, 60, 48, 120, 56, 48, 48, 41, 123, 10, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 46, 112, 117, 115, 104, 40, 40, 97, 60, 60, 49, 49, 41, 124, 99, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 10, 10, 118, 97, 114, 32, 100, 61, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 100, 46, 112, 117, 115, 104, 40, 45, 99, 41, 59, 10, 100, 46, 112, 117, 115, 104, 40, 97, 41, 59, 10, 125, 10, 125, 10, 10, 10, 82, 101, 112, 108, 97, 99, 101, 82, 101, 115, 117, 108, 116, 66, 117, 105, 108, 100, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 110, 101, 114, 97, 116, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 101, 108, 101, 109, 101, 110, 116, 115, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 66, 117, 105, 108, 100, 101, 114, 67, 111, 110, 99, 97, 116, 40, 97, 44, 97, 46, 108, 101, 110, 103, 116, 104, 44, 116, 104, 105, 115, 46, 115, 112, 101, 99, 105, 97, 108, 95, 115, 116, 114, 105, 110, 103, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 83, 116, 114, 105, 110, 103, 40, 41, 123, 10, 10, 37, 83, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 34, 44, 36, 83, 116, 114, 105, 110, 103, 44, 50, 41, 59, 10, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 34, 44, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 10, 41, 41, 59, 10, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 79, 110, 72, 105, 100, 100, 101, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 118, 97, 108, 117, 101, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 86, 97, 108, 117, 101, 79, 102, 44, 10, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 44, 10, 34, 99, 104, 97, 114, 65, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 65, 116, 44, 10, 34, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65, 116, 44, 10, 34, 99, 111, 110, 99, 97, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 111, 110, 99, 97, 116, 44, 10, 34, 105, 110, 100, 101, 120, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102, 44, 10, 34, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 34, 44, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 44, 10, 34, 108, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 34, 44, 83, 116, 114, 105, 110, 103, 76, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 44, 10, 34, 109, 97, 116, 99, 104, 34, 44, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 44, 10, 34, 114, 101, 112, 108, 97, 99, 101, 34, 44, 83, 116, 114, 105, 110, 103, 82, 101, 112, 108, 97, 99, 101, 44, 10, 34, 115, 101, 97, 114, 99, 104, 34, 44, 83, 116, 114, 105, 110, 103, 83, 101, 97, 114, 99, 104, 44, 10, 34, 115, 108, 105, 99, 101, 34, 44, 83, 116, 114, 105, 110, 103, 83, 108, 105, 99, 101, 44, 10, 34, 115, 112, 108, 105, 116, 34, 44, 83, 116, 114, 105, 110, 103, 83, 112, 108, 105, 116, 44, 10, 34, 115, 117, 98, 115, 116, 114, 105, 110, 103, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 105, 110, 103, 44, 10, 34, 115, 117, 98, 115, 116, 114, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 115, 116, 114, 44, 10, 34, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 76, 111, 119, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 34, 44, 83, 116, 114, 105, 110, 103, 84, 111, 76, 111, 99, 97, 108, 101, 85, 112, 112, 101, 114, 67, 97, 115, 101, 44, 10, 34, 116, 114, 105, 109, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 44, 10, 34, 116, 114, 105, 109, 76, 101, 102, 116, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 76, 101, 102, 116, 44, 10, 34, 116, 114, 105, 109, 82, 105, 103, 104, 116, 34, 44, 83, 116, 114, 105, 110, 103, 84, 114, 105, 109, 82, 105, 103, 104, 116, 44, 10, 34, 108, 105, 110, 107, 34, 44, 83, 116, 114, 105, 110, 103, 76, 105, 110, 107, 44, 10, 34, 97, 110, 99, 104, 111, 114, 34, 44, 83, 116, 114, 105, 110, 103, 65, 110, 99, 104, 111, 114, 44, 10, 34, 102, 111, 110, 116, 99, 111, 108, 111, 114, 34, 44, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 99, 111, 108, 111, 114, 44, 10, 34, 102, 111, 110, 116, 115, 105, 122, 101, 34, 44, 83, 116, 114, 105, 110, 103, 70, 111, 110, 116, 115, 105, 122, 101, 44, 10, 34, 98, 105, 103, 34, 44, 83, 116, 114, 105, 110, 103, 66, 105, 103, 44, 10, 34, 98, 108, 105, 110, 107, 34, 44, 83, 116, 114, 105, 110, 103, 66, 108, 105, 110, 107, 44, 10, 34, 98, 111, 108, 100, 34, 44, 83, 116, 114, 105, 110, 103, 66, 111, 108, 100, 44, 10, 34, 102, 105, 120, 101, 100, 34, 44, 83, 116, 114, 105, 110, 103, 70, 105, 120, 101, 100, 44, 10, 34, 105, 116, 97, 108, 105, 99, 115, 34, 44, 83, 116, 114, 105, 110, 103, 73, 116, 97, 108, 105, 99, 115, 44, 10, 34, 115, 109, 97, 108, 108, 34, 44, 83, 116, 114, 105, 110, 103, 83, 109, 97, 108, 108, 44, 10, 34, 115, 116, 114, 105, 107, 101, 34, 44, 83, 116, 114, 105, 110, 103, 83, 116, 114, 105, 107, 101, 44, 10, 34, 115, 117, 98, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 98, 44, 10, 34, 115, 117, 112, 34, 44, 83, 116, 114, 105, 110, 103, 83, 117, 112, 10, 41, 41, 59, 10, 125, 10, 10, 10, 83, 101, 116, 117, 112, 83, 116, 114, 105, 110, 103, 40, 41, 59, 10, 10, 0 };
 
   static const char uri[] = { 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 118, 97, 114, 32, 104, 101, 120, 67, 104, 97, 114, 65, 114, 114, 97, 121, 61, 48, 59, 10, 118, 97, 114, 32, 104, 101, 120, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 61, 48, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 65, 100, 100, 69, 110, 99, 111, 100, 101, 100, 79, 99, 116, 101, 116, 84, 111, 66, 117, 102, 102, 101, 114, 40, 97, 44, 98, 44, 99, 41, 123, 10, 98, 91, 99, 43, 43, 93, 61, 51, 55, 59, 10, 98, 91, 99, 43, 43, 93, 61, 104, 101, 120, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 91, 97, 62, 62, 52, 93, 59, 10, 98, 91, 99, 43, 43, 93, 61, 104, 101, 120, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 91, 97, 38, 48, 120, 48, 70, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 79, 99, 116, 101, 116, 115, 40, 97, 44, 98, 44, 99, 41, 123, 10, 105, 102, 40, 104, 101, 120, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 61, 61, 61, 48, 41, 123, 10, 104, 101, 120, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 61, 91, 52, 56, 44, 52, 57, 44, 53, 48, 44, 53, 49, 44, 53, 50, 44, 53, 51, 44, 53, 52, 44, 53, 53, 44, 53, 54, 44, 53, 55, 44, 10, 54, 53, 44, 54, 54, 44, 54, 55, 44, 54, 56, 44, 54, 57, 44, 55, 48, 93, 59, 10, 125, 10, 99, 61, 85, 82, 73, 65, 100, 100, 69, 110, 99, 111, 100, 101, 100, 79, 99, 116, 101, 116, 84, 111, 66, 117, 102, 102, 101, 114, 40, 97, 91, 48, 93, 44, 98, 44, 99, 41, 59, 10, 105, 102, 40, 97, 91, 49, 93, 41, 99, 61, 85, 82, 73, 65, 100, 100, 69, 110, 99, 111, 100, 101, 100, 79, 99, 116, 101, 116, 84, 111, 66, 117, 102, 102, 101, 114, 40, 97, 91, 49, 93, 44, 98, 44, 99, 41, 59, 10, 105, 102, 40, 97, 91, 50, 93, 41, 99, 61, 85, 82, 73, 65, 100, 100, 69, 110, 99, 111, 100, 101, 100, 79, 99, 116, 101, 116, 84, 111, 66, 117, 102, 102, 101, 114, 40, 97, 91, 50, 93, 44, 98, 44, 99, 41, 59, 10, 105, 102, 40, 97, 91, 51, 93, 41, 99, 61, 85, 82, 73, 65, 100, 100, 69, 110, 99, 111, 100, 101, 100, 79, 99, 116, 101, 116, 84, 111, 66, 117, 102, 102, 101, 114, 40, 97, 91, 51, 93, 44, 98, 44, 99, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 83, 105, 110, 103, 108, 101, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 40, 97, 62, 62, 49, 50, 41, 38, 48, 120, 70, 59, 10, 118, 97, 114, 32, 103, 61, 40, 97, 62, 62, 54, 41, 38, 54, 51, 59, 10, 118, 97, 114, 32, 104, 61, 97, 38, 54, 51, 59, 10, 118, 97, 114, 32, 105, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 51, 41, 59, 10, 105, 102, 40, 97, 60, 61, 48, 120, 48, 48, 55, 70, 41, 123, 10, 105, 91, 48, 93, 61, 97, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97, 60, 61, 48, 120, 48, 55, 70, 70, 41, 123, 10, 105, 91, 48, 93, 61, 103, 43, 49, 57, 50, 59, 10, 105, 91, 49, 93, 61, 104, 43, 49, 50, 56, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 91, 48, 93, 61, 100, 43, 50, 50, 52, 59, 10, 105, 91, 49, 93, 61, 103, 43, 49, 50, 56, 59, 10, 105, 91, 50, 93, 61, 104, 43, 49, 50, 56, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 79, 99, 116, 101, 116, 115, 40, 105, 44, 98, 44, 99, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 80, 97, 105, 114, 40, 97, 44, 98, 44, 99, 44, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 40, 40, 97, 62, 62, 54, 41, 38, 48, 120, 70, 41, 43, 49, 59, 10, 118, 97, 114, 32, 104, 61, 40, 97, 62, 62, 50, 41, 38, 48, 120, 70, 59, 10, 118, 97, 114, 32, 105, 61, 97, 38, 51, 59, 10, 118, 97, 114, 32, 106, 61, 40, 98, 62, 62, 54, 41, 38, 48, 120, 70, 59, 10, 118, 97, 114, 32, 107, 61, 98, 38, 54, 51, 59, 10, 118, 97, 114, 32, 108, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 52, 41, 59, 10, 108, 91, 48, 93, 61, 40, 103, 62, 62, 50, 41, 43, 50, 52, 48, 59, 10, 108, 91, 49, 93, 61, 40, 40, 40, 103, 38, 51, 41, 60, 60, 52, 41, 124, 104, 41, 43, 49, 50, 56, 59, 10, 108, 91, 50, 93, 61, 40, 40, 105, 60, 60, 52, 41, 124, 106, 41, 43, 49, 50, 56, 59, 10, 108, 91, 51, 93, 61, 107, 43, 49, 50, 56, 59, 10, 114, 101, 116, 117, 114, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 79, 99, 116, 101, 116, 115, 40, 108, 44, 99, 44, 100, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 72, 101, 120, 67, 104, 97, 114, 115, 84, 111, 67, 104, 97, 114, 67, 111, 100, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 72, 101, 120, 86, 97, 108, 117, 101, 79, 102, 40, 97, 41, 59, 10, 118, 97, 114, 32, 100, 61, 72, 101, 120, 86, 97, 108, 117, 101, 79, 102, 40, 98, 41, 59, 10, 105, 102, 40, 99, 61, 61, 45, 49, 124, 124, 100, 61, 61, 45, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 40, 99, 60, 60, 52, 41, 124, 100, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 68, 101, 99, 111, 100, 101, 79, 99, 116, 101, 116, 115, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 59, 10, 118, 97, 114, 32, 103, 61, 97, 91, 48, 93, 59, 10, 105, 102, 40, 103, 60, 48, 120, 56, 48, 41, 123, 10, 100, 61, 103, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 103, 60, 48, 120, 99, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 104, 61, 97, 91, 49, 93, 59, 10, 105, 102, 40, 103, 60, 48, 120, 101, 48, 41, 123, 10, 118, 97, 114, 32, 105, 61, 103, 38, 48, 120, 49, 102, 59, 10, 105, 102, 40, 40, 104, 60, 48, 120, 56, 48, 41, 124, 124, 40, 104, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 106, 61, 104, 38, 48, 120, 51, 102, 59, 10, 100, 61, 40, 105, 60, 60, 54, 41, 43, 106, 59, 10, 105, 102, 40, 100, 60, 48, 120, 56, 48, 124, 124, 100, 62, 48, 120, 55, 102, 102, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 107, 61, 97, 91, 50, 93, 59, 10, 105, 102, 40, 103, 60, 48, 120, 102, 48, 41, 123, 10, 118, 97, 114, 32, 105, 61, 103, 38, 48, 120, 48, 102, 59, 10, 105, 102, 40, 40, 104, 60, 48, 120, 56, 48, 41, 124, 124, 40, 104, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 106, 61, 104, 38, 48, 120, 51, 102, 59, 10, 105, 102, 40, 40, 107, 60, 48, 120, 56, 48, 41, 124, 124, 40, 107, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 108, 61, 107, 38, 48, 120, 51, 102, 59, 10, 100, 61, 40, 105, 60, 60, 49, 50, 41, 43, 40, 106, 60, 60, 54, 41, 43, 108, 59, 10, 105, 102, 40, 40, 100, 60, 48, 120, 56, 48, 48, 41, 124, 124, 40, 100, 62, 48, 120, 102, 102, 102, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 109, 61, 97, 91, 51, 93, 59, 10, 105, 102, 40, 103, 60, 48, 120, 102, 56, 41, 123, 10, 118, 97, 114, 32, 105, 61, 40, 103, 38, 48, 120, 48, 55, 41, 59, 10, 105, 102, 40, 40, 104, 60, 48, 120, 56, 48, 41, 124, 124, 40, 104, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 106, 61, 40, 104, 38, 48, 120, 51, 102, 41, 59, 10, 105, 102, 40, 40, 107, 60, 48, 120, 56, 48, 41, 124, 124, 40, 107, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 108, 61, 40, 107, 38, 48, 120, 51, 102, 41, 59, 10, 105, 102, 40, 40, 109, 60, 48, 120, 56, 48, 41, 124, 124, 40, 109, 62, 48, 120, 98, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 111, 61, 40, 109, 38, 48, 120, 51, 102, 41, 59, 10, 100, 61, 40, 105, 60, 60, 49, 56, 41, 43, 40, 106, 60, 60, 49, 50, 41, 43, 40, 108, 60, 60, 54, 41, 43, 111, 59, 10, 105, 102, 40, 40, 100, 60, 48, 120, 49, 48, 48, 48, 48, 41, 124, 124, 40, 100, 62, 48, 120, 49, 48, 102, 102, 102, 102, 41, 41, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125, 10, 105, 102, 40, 100, 60, 48, 120, 49, 48, 48, 48, 48, 41, 123, 10, 98, 91, 99, 43, 43, 93, 61, 100, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 91, 99, 43, 43, 93, 61, 40, 100, 62, 62, 49, 48, 41, 43, 48, 120, 100, 55, 99, 48, 59, 10, 98, 91, 99, 43, 43, 93, 61, 40, 100, 38, 48, 120, 51, 102, 102, 41, 43, 48, 120, 100, 99, 48, 48, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 110, 99, 111, 100, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 118, 97, 114, 32, 103, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 104, 61, 48, 59, 104, 60, 99, 59, 104, 43, 43, 41, 123, 10, 118, 97, 114, 32, 105, 61, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 104, 41, 59, 10, 105, 102, 40, 98, 40, 105, 41, 41, 123, 10, 100, 91, 103, 43, 43, 93, 61, 105, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 105, 62, 61, 48, 120, 68, 67, 48, 48, 38, 38, 105, 60, 61, 48, 120, 68, 70, 70, 70, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 105, 102, 40, 105, 60, 48, 120, 68, 56, 48, 48, 124, 124, 105, 62, 48, 120, 68, 66, 70, 70, 41, 123, 10, 103, 61, 85, 82, 73, 69, 110, 99, 111, 100, 101, 83, 105, 110, 103, 108, 101, 40, 105, 44, 100, 44, 103, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 104, 43, 43, 59, 10, 105, 102, 40, 104, 61, 61, 99, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 106, 61, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 104, 41, 59, 10, 105, 102, 40, 106, 60, 48, 120, 68, 67, 48, 48, 124, 124, 106, 62, 48, 120, 68, 70, 70, 70, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 103, 61, 85, 82, 73, 69, 110, 99, 111, 100, 101, 80, 97, 105, 114, 40, 105, 44, 106, 44, 100, 44, 103, 41, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 40, 100, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 99, 111, 100, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 118, 97, 114, 32, 103, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 104, 61, 48, 59, 104, 60, 99, 59, 104, 43, 43, 41, 123, 10, 118, 97, 114, 32, 105, 61, 97, 46, 99, 104, 97, 114, 65, 116, 40, 104, 41, 59, 10, 105, 102, 40, 105, 61, 61, 39, 37, 39, 41, 123, 10, 105, 102, 40, 104, 43, 50, 62, 61, 99, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 106, 61, 85, 82, 73, 72, 101, 120, 67, 104, 97, 114, 115, 84, 111, 67, 104, 97, 114, 67, 111, 100, 101, 40, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 43, 43, 104, 41, 44, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 43, 43, 104, 41, 41, 59, 10, 105, 102, 40, 106, 62, 62, 55, 41, 123, 10, 118, 97, 114, 32, 107, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40, 40, 40, 106, 60, 60, 43, 43, 107, 41, 38, 48, 120, 56, 48, 41, 33, 61, 48, 41, 59, 10, 105, 102, 40, 107, 61, 61, 49, 124, 124, 107, 62, 52, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 118, 97, 114, 32, 108, 61, 110, 101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 107, 41, 59, 10, 108, 91, 48, 93, 61, 106, 59, 10, 105, 102, 40, 104, 43, 51, 42, 40, 107, 45, 49, 41, 62, 61, 99, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 109, 61, 49, 59, 109, 60, 107, 59, 109, 43, 43, 41, 123, 10, 105, 102, 40, 97, 46, 99, 104, 97, 114, 65, 116, 40, 43, 43, 104, 41, 33, 61, 39, 37, 39, 41, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 85, 82, 73, 69, 114, 114, 111, 114, 40, 34, 85, 82, 73, 32, 109, 97, 108, 102, 111, 114, 109, 101, 100, 34, 41, 59, 10, 108, 91, 109, 93, 61, 85, 82, 73, 72, 101, 120, 67, 104, 97, 114, 115, 84, 111, 67, 104, 97, 114, 67, 111, 100, 101, 40, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 43, 43, 104, 41, 44, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 43, 43, 104, 41, 41, 59, 10, 125, 10, 103, 61, 85, 82, 73, 68, 101, 99, 111, 100, 101, 79, 99, 116, 101, 116, 115, 40, 108, 44, 100, 44, 103, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 98, 40, 106, 41, 41, 123, 10, 100, 91, 103, 43, 43, 93, 61, 51, 55, 59, 10, 100, 91, 103, 43, 43, 93, 61, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 104, 45, 49, 41, 59, 10, 100, 91, 103, 43, 43, 93, 61, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 104, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 91, 103, 43, 43, 93, 61, 106, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 100, 91, 103, 43, 43, 93, 61, 105, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 48, 41, 59, 10, 125, 10, 125, 10, 100, 46, 108, 101, 110, 103, 116, 104, 61, 103, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 104, 97, 114, 67, 111, 100, 101, 65, 114, 114, 97, 121, 40, 100, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 68, 101, 99, 111, 100, 101, 40, 97, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 115, 101, 114, 118, 101, 100, 80, 114, 101, 100, 105, 99, 97, 116, 101, 40, 98, 41, 123, 10, 10, 105, 102, 40, 51, 53, 60, 61, 98, 38, 38, 98, 60, 61, 51, 54, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 51, 56, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 52, 51, 60, 61, 98, 38, 38, 98, 60, 61, 52, 52, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 52, 55, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 53, 56, 60, 61, 98, 38, 38, 98, 60, 61, 53, 57, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 54, 49, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 54, 51, 60, 61, 98, 38, 38, 98, 60, 61, 54, 52, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 68, 101, 99, 111, 100, 101, 40, 99, 44, 114, 101, 115, 101, 114, 118, 101, 100, 80, 114, 101, 100, 105, 99, 97, 116, 101, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 68, 101, 99, 111, 100, 101, 67, 111, 109, 112, 111, 110, 101, 110, 116, 40, 97, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 115, 101, 114, 118, 101, 100, 80, 114, 101, 100, 105, 99, 97, 116, 101, 40, 98, 41, 123, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 125, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 68, 101, 99, 111, 100, 101, 40, 99, 44, 114, 101, 115, 101, 114, 118, 101, 100, 80, 114, 101, 100, 105, 99, 97, 116, 101, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 115, 65, 108, 112, 104, 97, 78, 117, 109, 101, 114, 105, 99, 40, 97, 41, 123, 10, 10, 105, 102, 40, 57, 55, 60, 61, 97, 38, 38, 97, 60, 61, 49, 50, 50, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 54, 53, 60, 61, 97, 38, 38, 97, 60, 61, 57, 48, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 52, 56, 60, 61, 97, 38, 38, 97, 60, 61, 53, 55, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 40, 97, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 110, 101, 115, 99, 97, 112, 101, 80, 114, 101, 100, 105, 99, 97, 116, 101, 40, 98, 41, 123, 10, 105, 102, 40, 105, 115, 65, 108, 112, 104, 97, 78, 117, 109, 101, 114, 105, 99, 40, 98, 41, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 51, 51, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 51, 53, 60, 61, 98, 38, 38, 98, 60, 61, 51, 54, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 51, 56, 60, 61, 98, 38, 38, 98, 60, 61, 52, 55, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 53, 56, 60, 61, 98, 38, 38, 98, 60, 61, 53, 57, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 54, 49, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 54, 51, 60, 61, 98, 38, 38, 98, 60, 61, 54, 52, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 57, 53, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 49, 50, 54, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 10, 118, 97, 114, 32, 99, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 69, 110, 99, 111, 100, 101, 40, 99, 44, 117, 110, 101, 115, 99, 97, 112, 101, 80, 114, 101, 100, 105, 99, 97, 116, 101, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 110, 99, 111, 100, 101, 67, 111, 109, 112, 111, 110, 101, 110, 116, 40, 97, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 110, 101, 115, 99, 97, 112, 101, 80, 114, 101, 100, 105, 99, 97, 116, 101, 40, 98, 41, 123, 10, 105, 102, 40, 105, 115, 65, 108, 112, 104, 97, 78, 117, 109, 101, 114, 105, 99, 40, 98, 41, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 51, 51, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 51, 57, 60, 61, 98, 38, 38, 98, 60, 61, 52, 50, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 52, 53, 60, 61, 98, 38, 38, 98, 60, 61, 52, 54, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 57, 53, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 105, 102, 40, 98, 61, 61, 49, 50, 54, 41, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 10, 118, 97, 114, 32, 99, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 69, 110, 99, 111, 100, 101, 40, 99, 44, 117, 110, 101, 115, 99, 97, 112, 101, 80, 114, 101, 100, 105, 99, 97, 116, 101, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 101, 120, 86, 97, 108, 117, 101, 79, 102, 40, 97, 41, 123, 10, 10, 105, 102, 40, 97, 62, 61, 52, 56, 38, 38, 97, 60, 61, 53, 55, 41, 114, 101, 116, 117, 114, 110, 32, 97, 45, 52, 56, 59, 10, 10, 105, 102, 40, 97, 62, 61, 54, 53, 38, 38, 97, 60, 61, 55, 48, 41, 114, 101, 116, 117, 114, 110, 32, 97, 45, 53, 53, 59, 10, 10, 105, 102, 40, 97, 62, 61, 57, 55, 38, 38, 97, 60, 61, 49, 48, 50, 41, 114, 101, 116, 117, 114, 110, 32, 97, 45, 56, 55, 59, 10, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 67, 104, 97, 114, 67, 111, 100, 101, 84, 111, 72, 101, 120, 52, 83, 116, 114, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 34, 34, 59, 10, 105, 102, 40, 104, 101, 120, 67, 104, 97, 114, 65, 114, 114, 97, 121, 61, 61, 61, 48, 41, 123, 10, 104, 101, 120, 67, 104, 97, 114, 65, 114, 114, 97, 121, 61, 91, 34, 48, 34, 44, 34, 49, 34, 44, 34, 50, 34, 44, 34, 51, 34, 44, 34, 52, 34, 44, 34, 53, 34, 44, 34, 54, 34, 44, 34, 55, 34, 44, 34, 56, 34, 44, 34, 57, 34, 44, 10, 34, 65, 34, 44, 34, 66, 34, 44, 34, 67, 34, 44, 34, 68, 34, 44, 34, 69, 34, 44, 34, 70, 34, 93, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 52, 59, 43, 43, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 104, 101, 120, 67, 104, 97, 114, 65, 114, 114, 97, 121, 91, 97, 38, 48, 120, 48, 70, 93, 59, 10, 98, 61, 100, 43, 98, 59, 10, 97, 61, 97, 62, 62, 62, 52, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 115, 86, 97, 108, 105, 100, 72, 101, 120, 40, 97, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 98, 61, 48, 59, 98, 60, 97, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 97, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 98, 41, 59, 10, 105, 102, 40, 40, 52, 56, 60, 61, 99, 38, 38, 99, 60, 61, 53, 55, 41, 124, 124, 40, 54, 53, 60, 61, 99, 38, 38, 99, 60, 61, 55, 48, 41, 124, 124, 40, 57, 55, 60, 61, 99, 38, 38, 99, 60, 61, 49, 48, 50, 41, 41, 123, 10, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 69, 115, 99, 97, 112, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 85, 82, 73, 69, 115, 99, 97, 112, 101, 40, 98, 41, 59, 10, 125, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 82, 73, 85, 110, 101, 115, 99, 97, 112, 101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 37, 85, 82, 73, 85, 110, 101, 115, 99, 97, 112, 101, 40, 98, 41, 59, 10, 125, 10, 10, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 117, 112, 85, 82, 73, 40, 41, 123, 10, 10, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 101, 115, 99, 97, 112, 101, 34, 44, 85, 82, 73, 69, 115, 99, 97, 112, 101, 44, 10, 34, 117, 110, 101, 115, 99, 97, 112, 101, 34, 44, 85, 82, 73, 85, 110, 101, 115, 99, 97, 112, 101, 44, 10, 34, 100, 101, 99, 111, 100, 101, 85, 82, 73, 34, 44, 85, 82, 73, 68, 101, 99, 111, 100, 101, 44, 10, 34, 100, 101, 99, 111, 100, 101, 85, 82, 73, 67, 111, 109, 112, 111, 110, 101, 110, 116, 34, 44, 85, 82, 73, 68, 101, 99, 111, 100, 101, 67, 111, 109, 112, 111, 110, 101, 110, 116, 44, 10, 34, 101, 110, 99, 111, 100, 101, 85, 82, 73, 34, 44, 85, 82, 73, 69, 110, 99, 111, 100, 101, 44, 10, 34, 101, 110, 99, 111, 100, 101, 85, 82, 73, 67, 111, 109, 112, 111, 110, 101, 110, 116, 34, 44, 85, 82, 73, 69, 110, 99, 111, 100, 101, 67, 111, 109, 112, 111, 110, 101, 110, 116, 10, 41, 41, 59, 10, 125, 10, 10, 83, 101, 116, 117, 112, 85, 82, 73, 40, 41, 59, 10, 10, 0 };
 
@@ -75,7 +75,7 @@ namespace internal {
     if (index == 3) return Vector<const char>(runtime, 10048);
     if (index == 4) return Vector<const char>(v8natives, 21174);
     if (index == 5) return Vector<const char>(array, 15753);
-    if (index == 6) return Vector<const char>(string, 13422);
+    if (index == 6) return Vector<const char>(string, 13597);
     if (index == 7) return Vector<const char>(uri, 5771);
     if (index == 8) return Vector<const char>(math, 3751);
     if (index == 9) return Vector<const char>(messages, 19902);
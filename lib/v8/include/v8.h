@@ -2535,6 +2535,7 @@ class V8EXPORT HeapStatistics {
   size_t total_heap_size_executable() { return total_heap_size_executable_; }
   size_t used_heap_size() { return used_heap_size_; }
   size_t heap_size_limit() { return heap_size_limit_; }
+  size_t external_memory_size() { return external_memory_size_; }
 
  private:
   void set_total_heap_size(size_t size) { total_heap_size_ = size; }
@@ -2543,11 +2544,13 @@ class V8EXPORT HeapStatistics {
   }
   void set_used_heap_size(size_t size) { used_heap_size_ = size; }
   void set_heap_size_limit(size_t size) { heap_size_limit_ = size; }
+  void set_external_memory_size(size_t size) { external_memory_size_ = size; }
 
   size_t total_heap_size_;
   size_t total_heap_size_executable_;
   size_t used_heap_size_;
   size_t heap_size_limit_;
+  size_t external_memory_size_;
 
   friend class V8;
 };
@@ -2975,6 +2978,15 @@ class V8EXPORT V8 {
    */
   static void TerminateExecution(Isolate* isolate = NULL);
 
+  /**
+   * Withdraws a request to terminate execution that has not taken effect
+   * yet, because no JavaScript ran after it was made. Without this, the
+   * next JavaScript to run in the isolate would be terminated instead.
+   *
+   * \param isolate The isolate in which to resume normal execution.
+   */
+  static void CancelTerminateExecution(Isolate* isolate = NULL);
+
   /**
    * Is V8 terminating JavaScript execution.
    *
@@ -3607,7 +3607,8 @@ bool v8::V8::Dispose() {
 HeapStatistics::HeapStatistics(): total_heap_size_(0),
                                   total_heap_size_executable_(0),
                                   used_heap_size_(0),
-                                  heap_size_limit_(0) { }
+                                  heap_size_limit_(0),
+                                  external_memory_size_(0) { }
 
 
 void v8::V8::GetHeapStatistics(HeapStatistics* heap_statistics) {
@@ -3617,6 +3618,7 @@ void v8::V8::GetHeapStatistics(HeapStatistics* heap_statistics) {
       heap->CommittedMemoryExecutable());
   heap_statistics->set_used_heap_size(heap->SizeOfObjects());
   heap_statistics->set_heap_size_limit(heap->MaxReserved());
+  heap_statistics->set_external_memory_size(heap->ExternalMemorySize());
 }
 
 
@@ -3632,6 +3634,7 @@ void v8::V8::LowMemoryNotification() {
   i::Isolate* isolate = i::Isolate::Current();
   if (!isolate->IsInitialized()) return;
   isolate->heap()->CollectAllGarbage(true);
+  isolate->zone()->ReleasePooledSegments();
 }
 
 
@@ -4656,6 +4659,17 @@ void V8::TerminateExecution(Isolate* isolate) {
 }
 
 
+void V8::CancelTerminateExecution(Isolate* isolate) {
+  // If no isolate is supplied, use the default isolate.
+  if (isolate != NULL) {
+    reinterpret_cast<i::Isolate*>(isolate)->stack_guard()->Continue(
+        i::TERMINATE);
+  } else {
+    i::Isolate::GetDefaultIsolateStackGuard()->Continue(i::TERMINATE);
+  }
+}
+
+
 bool V8::IsExecutionTerminating() {
   i::Isolate* isolate = i::Isolate::Current();
   return IsExecutionTerminatingCheck(isolate);
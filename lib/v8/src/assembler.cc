@@ -823,6 +823,14 @@ ExternalReference ExternalReference::re_word_character_map() {
       NativeRegExpMacroAssembler::word_character_map_address());
 }
 
+ExternalReference ExternalReference::re_skip_until_one_of(Isolate* isolate,
+                                                          bool is_ascii) {
+  Address function = is_ascii
+      ? FUNCTION_ADDR(NativeRegExpMacroAssembler::SkipUntilOneOfASCII)
+      : FUNCTION_ADDR(NativeRegExpMacroAssembler::SkipUntilOneOfUC16);
+  return ExternalReference(Redirect(isolate, function));
+}
+
 ExternalReference ExternalReference::address_of_static_offsets_vector(
     Isolate* isolate) {
   return ExternalReference(
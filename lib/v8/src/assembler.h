@@ -643,6 +643,10 @@ class ExternalReference BASE_EMBEDDED {
   // byte NativeRegExpMacroAssembler::word_character_bitmap
   static ExternalReference re_word_character_map();
 
+  // Function NativeRegExpMacroAssembler::SkipUntilOneOf{ASCII,UC16}()
+  static ExternalReference re_skip_until_one_of(Isolate* isolate,
+                                                bool is_ascii);
+
 #endif
 
   // This lets you register a function that rewrites all external references.
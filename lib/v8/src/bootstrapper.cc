@@ -1518,6 +1518,7 @@ bool Genesis::InstallNatives() {
   }
 
   // Install natives.
+  int64_t natives_start = OS::Ticks();
   for (int i = Natives::GetDebuggerCount();
        i < Natives::GetBuiltinsCount();
        i++) {
@@ -1527,6 +1528,8 @@ bool Genesis::InstallNatives() {
     // runtime.js.
     if (!InstallJSBuiltins(builtins)) return false;
   }
+  isolate()->counters()->natives_bootstrap_time()->Increment(
+      static_cast<int>(OS::Ticks() - natives_start));
 
   InstallNativeFunctions();
 
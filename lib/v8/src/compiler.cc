@@ -39,6 +39,7 @@
 #include "hydrogen.h"
 #include "lithium.h"
 #include "liveedit.h"
+#include "opt-report.h"
 #include "parser.h"
 #include "rewriter.h"
 #include "runtime-profiler.h"
@@ -59,7 +60,8 @@ CompilationInfo::CompilationInfo(Handle<Script> script)
       extension_(NULL),
       pre_parse_data_(NULL),
       supports_deoptimization_(false),
-      osr_ast_id_(AstNode::kNoNumber) {
+      osr_ast_id_(AstNode::kNoNumber),
+      bailout_reason_(NULL) {
   Initialize(NONOPT);
 }
 
@@ -74,7 +76,8 @@ CompilationInfo::CompilationInfo(Handle<SharedFunctionInfo> shared_info)
       extension_(NULL),
       pre_parse_data_(NULL),
       supports_deoptimization_(false),
-      osr_ast_id_(AstNode::kNoNumber) {
+      osr_ast_id_(AstNode::kNoNumber),
+      bailout_reason_(NULL) {
   Initialize(BASE);
 }
 
@@ -90,7 +93,8 @@ CompilationInfo::CompilationInfo(Handle<JSFunction> closure)
       extension_(NULL),
       pre_parse_data_(NULL),
       supports_deoptimization_(false),
-      osr_ast_id_(AstNode::kNoNumber) {
+      osr_ast_id_(AstNode::kNoNumber),
+      bailout_reason_(NULL) {
   Initialize(BASE);
 }
 
@@ -140,6 +144,10 @@ static void FinishOptimization(Handle<JSFunction> function, int64_t start) {
   int opt_count = function->shared()->opt_count();
   function->shared()->set_opt_count(opt_count + 1);
   double ms = static_cast<double>(OS::Ticks() - start) / 1000;
+  if (FLAG_opt_report) {
+    function->GetIsolate()->optimization_report()->OptimizationSucceeded(
+        function->shared(), ms);
+  }
   if (FLAG_trace_opt) {
     PrintF("[optimizing: ");
     function->PrintName();
@@ -178,6 +186,11 @@ static void AbortAndDisable(CompilationInfo* info) {
   info->SetCode(code);
   Isolate* isolate = code->GetIsolate();
   isolate->compilation_cache()->MarkForLazyOptimizing(info->closure());
+  if (FLAG_opt_report) {
+    const char* reason = info->bailout_reason();
+    isolate->optimization_report()->OptimizationFailed(
+        *shared, reason != NULL ? reason : "optimized compilation failed");
+  }
   if (FLAG_trace_opt) {
     PrintF("[disabled optimization for: ");
     info->closure()->PrintName();
@@ -215,11 +228,17 @@ static bool MakeCrankshaftCode(CompilationInfo* info) {
     return true;
   }
 
+  if (FLAG_opt_report) {
+    info->isolate()->optimization_report()->OptimizationStarted(
+        *info->shared_info());
+  }
+
   // Limit the number of times we re-compile a functions with
   // the optimizing compiler.
   const int kMaxOptCount =
       FLAG_deopt_every_n_times == 0 ? Compiler::kDefaultMaxOptCount : 1000;
   if (info->shared_info()->opt_count() > kMaxOptCount) {
+    info->set_bailout_reason("optimized too many times");
     AbortAndDisable(info);
     // True indicates the compilation pipeline is still going, not
     // necessarily that we optimized the code.
@@ -237,6 +256,7 @@ static bool MakeCrankshaftCode(CompilationInfo* info) {
   Scope* scope = info->scope();
   if ((scope->num_parameters() + 1) > limit ||
       scope->num_stack_slots() > limit) {
+    info->set_bailout_reason("too many parameters or stack slots");
     AbortAndDisable(info);
     // True indicates the compilation pipeline is still going, not
     // necessarily that we optimized the code.
@@ -115,6 +115,11 @@ class CompilationInfo BASE_EMBEDDED {
     osr_ast_id_ = osr_ast_id;
   }
 
+  // Why the optimizing compiler gave up, for --opt-report. The reason is
+  // expected to be a string literal.
+  const char* bailout_reason() const { return bailout_reason_; }
+  void set_bailout_reason(const char* reason) { bailout_reason_ = reason; }
+
   bool has_global_object() const {
     return !closure().is_null() && (closure()->context()->global() != NULL);
   }
@@ -217,6 +222,8 @@ class CompilationInfo BASE_EMBEDDED {
   bool supports_deoptimization_;
   int osr_ast_id_;
 
+  const char* bailout_reason_;
+
   DISALLOW_COPY_AND_ASSIGN(CompilationInfo);
 };
 
@@ -33,6 +33,7 @@
 #include "full-codegen.h"
 #include "global-handles.h"
 #include "macro-assembler.h"
+#include "opt-report.h"
 #include "prettyprinter.h"
 
 
@@ -234,6 +235,11 @@ Deoptimizer::Deoptimizer(Isolate* isolate,
            reinterpret_cast<intptr_t>(from),
            fp_to_sp_delta - (2 * kPointerSize));
   }
+  if (FLAG_opt_report && type != OSR) {
+    isolate->optimization_report()->Deoptimized(function,
+                                                type == LAZY,
+                                                bailout_id);
+  }
   // Find the optimized code.
   if (type == EAGER) {
     ASSERT(from == NULL);
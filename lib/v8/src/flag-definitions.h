@@ -206,6 +206,8 @@ DEFINE_bool(prepare_always_opt, false, "prepare for turning on always opt")
 DEFINE_bool(debug_info, true, "add debug information to compiled functions")
 DEFINE_bool(deopt, true, "support deoptimization")
 DEFINE_bool(trace_deopt, false, "trace deoptimization")
+DEFINE_bool(opt_report, false,
+            "print optimizations, bailouts and deoptimizations per function")
 
 // compiler.cc
 DEFINE_bool(strict, false, "strict error checking")
@@ -336,6 +338,10 @@ DEFINE_bool(preallocate_message_memory, false,
 DEFINE_bool(preemption, false,
             "activate a 100ms timer that switches between V8 threads")
 
+// zone.cc
+DEFINE_int(zone_segment_pool_size, 1024,
+           "max size of the free zone segments kept for reuse (in kBytes)")
+
 // Regexp
 DEFINE_bool(trace_regexps, false, "trace regexp execution")
 DEFINE_bool(regexp_optimization, true, "generate optimized regexp code")
@@ -510,6 +516,8 @@ DEFINE_bool(sliding_state_window, false,
             "Update sliding state window counters.")
 DEFINE_string(logfile, "v8.log", "Specify the name of the log file.")
 DEFINE_bool(ll_prof, false, "Enable low-level linux profiler.")
+DEFINE_bool(perf_map, false,
+            "Write /tmp/perf-<pid>.map for the Linux perf profiler.")
 
 //
 // Heap protection flags
@@ -384,6 +384,10 @@ class Heap {
   // Returns of size of all objects residing in the heap.
   intptr_t SizeOfObjects();
 
+  // Returns the amount of memory outside of the heap that the embedder
+  // reported as kept alive by heap objects.
+  int ExternalMemorySize() { return amount_of_external_allocated_memory_; }
+
   // Return the starting address and a mask for the new space.  And-masking an
   // address with the mask will result in the start address of the new space
   // for all addresses in either semispace.
@@ -592,6 +592,7 @@ Handle<Code> HGraph::Compile(CompilationInfo* info) {
   int values = GetMaximumValueID();
   if (values > LAllocator::max_initial_value_ids()) {
     if (FLAG_trace_bailout) PrintF("Function is too big\n");
+    info->set_bailout_reason("function is too big");
     return Handle<Code>::null();
   }
 
@@ -2095,6 +2096,7 @@ void HGraphBuilder::Bailout(const char* reason) {
     SmartPointer<char> name(info()->shared_info()->DebugName()->ToCString());
     PrintF("Bailout in HGraphBuilder: @\"%s\": %s\n", *name, reason);
   }
+  info()->set_bailout_reason(reason);
   SetStackOverflow();
 }
 
@@ -94,6 +94,7 @@ void LCodeGen::Abort(const char* format, ...) {
     va_end(arguments);
     PrintF("\n");
   }
+  info()->set_bailout_reason(format);
   status_ = ABORTED;
 }
 
@@ -549,6 +549,7 @@ void LChunkBuilder::Abort(const char* format, ...) {
     va_end(arguments);
     PrintF("\n");
   }
+  info()->set_bailout_reason(format);
   status_ = ABORTED;
 }
 
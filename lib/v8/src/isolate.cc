@@ -40,6 +40,7 @@
 #include "isolate.h"
 #include "lithium-allocator.h"
 #include "log.h"
+#include "opt-report.h"
 #include "regexp-stack.h"
 #include "runtime-profiler.h"
 #include "scanner.h"
@@ -424,6 +425,7 @@ Isolate::Isolate()
       stats_table_(new StatsTable()),
       stub_cache_(NULL),
       deoptimizer_data_(NULL),
+      optimization_report_(NULL),
       capture_stack_trace_for_uncaught_exceptions_(false),
       stack_trace_for_uncaught_exceptions_frame_limit_(0),
       stack_trace_for_uncaught_exceptions_options_(StackTrace::kOverview),
@@ -520,6 +522,12 @@ void Isolate::Deinit() {
 
     if (FLAG_hydrogen_stats) HStatistics::Instance()->Print();
 
+    if (optimization_report_ != NULL) {
+      optimization_report_->Print();
+      delete optimization_report_;
+      optimization_report_ = NULL;
+    }
+
     // We must stop the logger before we tear down other components.
     logger_->EnsureTickerStopped();
 
@@ -546,6 +554,7 @@ void Isolate::Deinit() {
     }
     heap_.TearDown();
     logger_->TearDown();
+    zone_.ReleasePooledSegments();
 
     // The default isolate is re-initializable due to legacy API.
     state_ = PREINITIALIZED;
@@ -811,6 +820,7 @@ bool Isolate::Init(Deserializer* des) {
   heap_.SetStackLimits();
 
   deoptimizer_data_ = new DeoptimizerData;
+  if (FLAG_opt_report) optimization_report_ = new OptimizationReport;
   runtime_profiler_ = new RuntimeProfiler(this);
   runtime_profiler_->Setup();
 
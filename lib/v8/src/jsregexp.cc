@@ -2689,6 +2689,11 @@ void LoopChoiceNode::Emit(RegExpCompiler* compiler, Trace* trace) {
     trace->Flush(compiler, this);
     return;
   }
+  if (search_characters_ != NULL) {
+    // With a trivial trace nothing is preloaded, so we are free to move the
+    // current position to the next place where a match can start.
+    macro_assembler->SkipUntilOneOf(search_characters_->ToConstVector());
+  }
   ChoiceNode::Emit(compiler, trace);
 }
 
@@ -5276,6 +5281,44 @@ void DispatchTableConstructor::VisitAction(ActionNode* that) {
 }
 
 
+// Returns the characters a match starting at the given node must begin with,
+// or NULL if they are unknown or too many to be worth skipping ahead for.
+static ZoneList<uc16>* SearchCharacters(RegExpNode* node,
+                                        bool ignore_case,
+                                        bool is_ascii) {
+  ZoneList<CharacterRange>* first_set = node->FirstCharacterSet();
+  ZoneList<CharacterRange>* ranges =
+      new ZoneList<CharacterRange>(first_set->length());
+  ranges->AddAll(*first_set);
+  if (ignore_case) {
+    // Character classes have already been made case independent, but the
+    // first character of an atom has not.
+    int range_count = ranges->length();
+    for (int i = 0; i < range_count; i++) {
+      ranges->at(i).AddCaseEquivalents(ranges, is_ascii);
+    }
+  }
+  CharacterRange::Canonicalize(ranges);
+  int max_char = is_ascii ? String::kMaxAsciiCharCode
+                          : String::kMaxUC16CharCode;
+  ZoneList<uc16>* characters =
+      new ZoneList<uc16>(RegExpMacroAssembler::kMaxSkipCharacters);
+  for (int i = 0; i < ranges->length(); i++) {
+    CharacterRange range = ranges->at(i);
+    if (range.from() > max_char) break;
+    int to = Min(static_cast<int>(range.to()), max_char);
+    if (characters->length() + to - range.from() + 1 >
+        RegExpMacroAssembler::kMaxSkipCharacters) {
+      return NULL;
+    }
+    for (int c = range.from(); c <= to; c++) {
+      characters->Add(static_cast<uc16>(c));
+    }
+  }
+  return characters;
+}
+
+
 RegExpEngine::CompilationResult RegExpEngine::Compile(RegExpCompileData* data,
                                                       bool ignore_case,
                                                       bool is_multiline,
@@ -5291,6 +5334,7 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(RegExpCompileData* data,
                                                     &compiler,
                                                     compiler.accept());
   RegExpNode* node = captured_body;
+  LoopChoiceNode* search_loop = NULL;
   bool is_end_anchored = data->tree->IsAnchoredAtEnd();
   bool is_start_anchored = data->tree->IsAnchoredAtStart();
   int max_length = data->tree->max_match();
@@ -5305,6 +5349,9 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(RegExpCompileData* data,
                                  &compiler,
                                  captured_body,
                                  data->contains_anchor);
+    // An unbounded quantifier over a non-empty body needs no counter
+    // register, so the loop node itself is returned.
+    search_loop = static_cast<LoopChoiceNode*>(loop_node);
 
     if (data->contains_anchor) {
       // Unroll loop once, to take care of the case that might start
@@ -5326,6 +5373,11 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(RegExpCompileData* data,
     return CompilationResult(error_message);
   }
 
+  if (search_loop != NULL && FLAG_regexp_optimization) {
+    search_loop->set_search_characters(
+        SearchCharacters(search_loop->continue_node(), ignore_case, is_ascii));
+  }
+
   NodeInfo info = *node->info();
 
   // Create the correct assembler for the architecture.
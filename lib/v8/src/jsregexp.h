@@ -1118,7 +1118,8 @@ class LoopChoiceNode: public ChoiceNode {
       : ChoiceNode(2),
         loop_node_(NULL),
         continue_node_(NULL),
-        body_can_be_zero_length_(body_can_be_zero_length) { }
+        body_can_be_zero_length_(body_can_be_zero_length),
+        search_characters_(NULL) { }
   void AddLoopAlternative(GuardedAlternative alt);
   void AddContinueAlternative(GuardedAlternative alt);
   virtual void Emit(RegExpCompiler* compiler, Trace* trace);
@@ -1134,6 +1135,13 @@ class LoopChoiceNode: public ChoiceNode {
   RegExpNode* loop_node() { return loop_node_; }
   RegExpNode* continue_node() { return continue_node_; }
   bool body_can_be_zero_length() { return body_can_be_zero_length_; }
+  // For the .*? loop in front of unanchored regexps: the characters that
+  // the continue node can start with.  If set, positions that don't hold
+  // one of them are skipped before trying to match.
+  ZoneList<uc16>* search_characters() { return search_characters_; }
+  void set_search_characters(ZoneList<uc16>* characters) {
+    search_characters_ = characters;
+  }
   virtual void Accept(NodeVisitor* visitor);
 
  private:
@@ -1147,6 +1155,7 @@ class LoopChoiceNode: public ChoiceNode {
   RegExpNode* loop_node_;
   RegExpNode* continue_node_;
   bool body_can_be_zero_length_;
+  ZoneList<uc16>* search_characters_;
 };
 
 
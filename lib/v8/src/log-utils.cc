@@ -222,10 +222,87 @@ void Log::Initialize() {
       }
     }
   }
+
+  if (FLAG_perf_map) OpenPerfMap();
 #endif
 }
 
 
+// The perf profiler looks for the symbols of JIT code in a map file
+// named after the process. Isolates on other threads write to it too,
+// each line under the lock.
+static Mutex* perf_map_mutex = NULL;
+static FILE* perf_map_handle = NULL;
+
+
+static FILE* OpenPerfMapFile(int pid) {
+  EmbeddedVector<char, 64> name;
+  OS::SNPrintF(name, "/tmp/perf-%d.map", pid);
+  return OS::FOpen(name.start(), "a+");
+}
+
+
+// The lock is held across fork(), so that no line is left half written,
+// and the map is flushed, so that the child doesn't write the lines the
+// parent had buffered.
+static void BeforeFork() {
+  perf_map_mutex->Lock();
+  if (perf_map_handle != NULL) fflush(perf_map_handle);
+}
+
+
+static void AfterForkInParent() {
+  perf_map_mutex->Unlock();
+}
+
+
+// The child runs the code it inherits, so its map starts as a copy of
+// the parent's. The inherited lock is owned by the parent's thread id,
+// which the child can't unlock, so the child takes a fresh one.
+static void AfterForkInChild() {
+  FILE* parent = perf_map_handle;
+  if (parent != NULL) {
+    perf_map_handle = OpenPerfMapFile(OS::GetCurrentProcessId());
+    if (perf_map_handle != NULL) {
+      char buffer[4096];
+      size_t length;
+      fseek(parent, 0, SEEK_SET);
+      while ((length = fread(buffer, 1, sizeof(buffer), parent)) > 0) {
+        fwrite(buffer, 1, length, perf_map_handle);
+      }
+    }
+    fclose(parent);
+  }
+  perf_map_mutex = OS::CreateMutex();
+}
+
+
+void Log::OpenPerfMap() {
+  // The default isolate, which is set up first, creates the lock before
+  // there are other threads.
+  if (perf_map_mutex == NULL) perf_map_mutex = OS::CreateMutex();
+  ScopedLock lock(perf_map_mutex);
+  if (perf_map_handle != NULL) return;
+  perf_map_handle = OpenPerfMapFile(OS::GetCurrentProcessId());
+  OS::RegisterForkHandlers(BeforeFork, AfterForkInParent, AfterForkInChild);
+}
+
+
+bool Log::HasPerfMap() {
+  return perf_map_handle != NULL;
+}
+
+
+void Log::WritePerfMapEntry(Address start, int size, const char* symbol) {
+  ScopedLock lock(perf_map_mutex);
+  if (perf_map_handle == NULL) return;
+  fprintf(perf_map_handle, "%" V8PRIxPTR " %x %s\n",
+          reinterpret_cast<intptr_t>(start), size, symbol);
+  // Forked workers leave with _exit(), which drops buffered lines.
+  fflush(perf_map_handle);
+}
+
+
 void Log::OpenStdout() {
   ASSERT(!IsEnabled());
   output_handle_ = stdout;
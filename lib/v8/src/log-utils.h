@@ -106,6 +106,13 @@ class Log {
   // See description in include/v8.h.
   int GetLogLines(int from_pos, char* dest_buf, int max_size);
 
+  // With --perf-map, generated code is listed for the perf profiler in
+  // /tmp/perf-<pid>.map. There is one map per process, which the
+  // isolates share; a forked child gets a copy under its own pid.
+  static void OpenPerfMap();
+  static bool HasPerfMap();
+  static void WritePerfMapEntry(Address start, int size, const char* symbol);
+
   // Returns whether logging is enabled.
   bool IsEnabled() {
     return !is_stopped_ && (output_handle_ != NULL || output_buffer_ != NULL);
@@ -338,6 +338,65 @@ void Profiler::Run() {
 // Logger class implementation.
 //
 
+// Remembers the perf map entry of each live code object, keyed by the
+// address of the code object, so that it can be listed again when the
+// code moves.
+class PerfMapNames {
+ public:
+  PerfMapNames() : map_(&AddressesMatch) { }
+
+  ~PerfMapNames() {
+    for (HashMap::Entry* p = map_.Start(); p != NULL; p = map_.Next(p)) {
+      delete static_cast<Entry*>(p->value);
+    }
+  }
+
+  void Insert(Address code, const char* name, int size) {
+    HashMap::Entry* p = map_.Lookup(code, Hash(code), true);
+    delete static_cast<Entry*>(p->value);
+    p->value = new Entry(name, size);
+  }
+
+  // Returns the moved entry, or NULL if the code was not listed.
+  const char* Move(Address from, Address to, int* size) {
+    HashMap::Entry* p = map_.Lookup(from, Hash(from), false);
+    if (p == NULL) return NULL;
+    Entry* entry = static_cast<Entry*>(p->value);
+    map_.Remove(from, Hash(from));
+    HashMap::Entry* q = map_.Lookup(to, Hash(to), true);
+    delete static_cast<Entry*>(q->value);
+    q->value = entry;
+    *size = entry->size;
+    return *entry->name;
+  }
+
+  void Remove(Address code) {
+    HashMap::Entry* p = map_.Lookup(code, Hash(code), false);
+    if (p == NULL) return;
+    delete static_cast<Entry*>(p->value);
+    map_.Remove(code, Hash(code));
+  }
+
+ private:
+  struct Entry {
+    Entry(const char* name, int size) : name(StrDup(name)), size(size) { }
+    SmartPointer<char> name;
+    int size;
+  };
+
+  static bool AddressesMatch(void* key1, void* key2) {
+    return key1 == key2;
+  }
+
+  static uint32_t Hash(Address code) {
+    return ComputeIntegerHash(
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(code)));
+  }
+
+  HashMap map_;
+};
+
+
 Logger::Logger()
   : ticker_(NULL),
     profiler_(NULL),
@@ -352,11 +411,13 @@ Logger::Logger()
     prev_sp_(NULL),
     prev_function_(NULL),
     prev_to_(NULL),
-    prev_code_(NULL) {
+    prev_code_(NULL),
+    perf_map_names_(NULL) {
 }
 
 Logger::~Logger() {
   delete log_;
+  delete perf_map_names_;
 }
 
 #define DECLARE_EVENT(ignore1, name) name,
@@ -735,6 +796,7 @@ void Logger::CodeCreateEvent(LogEventsAndTags tag,
                              Code* code,
                              const char* comment) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) PerfMapCodeCreateEvent(tag, code, "", comment);
   if (!log_->IsEnabled() || !FLAG_log_code) return;
   LogMessageBuilder msg(this);
   msg.Append("%s,%s,",
@@ -788,10 +850,15 @@ void Logger::CodeCreateEvent(LogEventsAndTags tag,
                              SharedFunctionInfo* shared,
                              String* name) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
-  if (!log_->IsEnabled() || !FLAG_log_code) return;
   if (code == Isolate::Current()->builtins()->builtin(
       Builtins::kLazyCompile))
     return;
+  if (FLAG_perf_map) {
+    SmartPointer<char> str =
+        name->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+    PerfMapCodeCreateEvent(tag, code, ComputeMarker(code), *str);
+  }
+  if (!log_->IsEnabled() || !FLAG_log_code) return;
 
   LogMessageBuilder msg(this);
   SmartPointer<char> str =
@@ -818,6 +885,17 @@ void Logger::CodeCreateEvent(LogEventsAndTags tag,
                              SharedFunctionInfo* shared,
                              String* source, int line) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) {
+    SmartPointer<char> name =
+        shared->DebugName()->ToCString(DISALLOW_NULLS,
+                                       ROBUST_STRING_TRAVERSAL);
+    SmartPointer<char> sourcestr =
+        source->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+    EmbeddedVector<char, 256> description;
+    OS::SNPrintF(description, "%s %s:%d", *name, *sourcestr, line);
+    PerfMapCodeCreateEvent(tag, code, ComputeMarker(code),
+                           description.start());
+  }
   if (!log_->IsEnabled() || !FLAG_log_code) return;
   LogMessageBuilder msg(this);
   SmartPointer<char> name =
@@ -844,6 +922,11 @@ void Logger::CodeCreateEvent(LogEventsAndTags tag,
 
 void Logger::CodeCreateEvent(LogEventsAndTags tag, Code* code, int args_count) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) {
+    EmbeddedVector<char, 32> description;
+    OS::SNPrintF(description, "args_count: %d", args_count);
+    PerfMapCodeCreateEvent(tag, code, "", description.start());
+  }
   if (!log_->IsEnabled() || !FLAG_log_code) return;
   LogMessageBuilder msg(this);
   msg.Append("%s,%s,",
@@ -871,6 +954,11 @@ void Logger::CodeMovingGCEvent() {
 
 void Logger::RegExpCodeCreateEvent(Code* code, String* source) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) {
+    SmartPointer<char> str =
+        source->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+    PerfMapCodeCreateEvent(REG_EXP_TAG, code, "", *str);
+  }
   if (!log_->IsEnabled() || !FLAG_log_code) return;
   LogMessageBuilder msg(this);
   msg.Append("%s,%s,",
@@ -889,6 +977,7 @@ void Logger::RegExpCodeCreateEvent(Code* code, String* source) {
 
 void Logger::CodeMoveEvent(Address from, Address to) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) PerfMapCodeMoveEvent(from, to);
   MoveEventInternal(CODE_MOVE_EVENT, from, to);
 #endif
 }
@@ -896,6 +985,7 @@ void Logger::CodeMoveEvent(Address from, Address to) {
 
 void Logger::CodeDeleteEvent(Address from) {
 #ifdef ENABLE_LOGGING_AND_PROFILING
+  if (FLAG_perf_map) PerfMapCodeDeleteEvent(from);
   DeleteEventInternal(CODE_DELETE_EVENT, from);
 #endif
 }
@@ -1397,6 +1487,39 @@ void Logger::LowLevelCodeCreateEvent(Code* code, LogMessageBuilder* msg) {
 }
 
 
+void Logger::PerfMapCodeCreateEvent(LogEventsAndTags tag,
+                                    Code* code,
+                                    const char* marker,
+                                    const char* name) {
+  if (!Log::HasPerfMap()) return;
+  if (perf_map_names_ == NULL) perf_map_names_ = new PerfMapNames();
+  EmbeddedVector<char, 256> symbol;
+  OS::SNPrintF(symbol, "%s:%s%s", kLogEventsNames[tag], marker, name);
+  // One symbol per line: fold any line breaks, e.g. from regexp sources.
+  for (char* p = symbol.start(); *p != '\0'; p++) {
+    if (*p == '\n' || *p == '\r') *p = ' ';
+  }
+  perf_map_names_->Insert(code->address(), symbol.start(),
+                          code->instruction_size());
+  Log::WritePerfMapEntry(code->instruction_start(), code->instruction_size(),
+                         symbol.start());
+}
+
+
+void Logger::PerfMapCodeMoveEvent(Address from, Address to) {
+  if (!Log::HasPerfMap() || perf_map_names_ == NULL || from == to) return;
+  int size;
+  const char* symbol = perf_map_names_->Move(from, to, &size);
+  if (symbol == NULL) return;
+  Log::WritePerfMapEntry(to + Code::kHeaderSize, size, symbol);
+}
+
+
+void Logger::PerfMapCodeDeleteEvent(Address from) {
+  if (perf_map_names_ != NULL) perf_map_names_->Remove(from);
+}
+
+
 void Logger::LogCodeObjects() {
   AssertNoAllocation no_alloc;
   HeapIterator iterator;
@@ -1523,7 +1646,7 @@ bool Logger::Setup() {
 
   bool start_logging = FLAG_log || FLAG_log_runtime || FLAG_log_api
     || FLAG_log_code || FLAG_log_gc || FLAG_log_handles || FLAG_log_suspect
-    || FLAG_log_regexp || FLAG_log_state_changes;
+    || FLAG_log_regexp || FLAG_log_state_changes || FLAG_perf_map;
 
   if (start_logging) {
     logging_nesting_ = 1;
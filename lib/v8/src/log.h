@@ -74,6 +74,7 @@ class Profiler;
 class Semaphore;
 class SlidingStateWindow;
 class LogMessageBuilder;
+class PerfMapNames;
 
 #undef LOG
 #ifdef ENABLE_LOGGING_AND_PROFILING
@@ -329,6 +330,15 @@ class Logger {
   // Handles code creation when low-level profiling is active.
   void LowLevelCodeCreateEvent(Code* code, LogMessageBuilder* msg);
 
+  // Handle code events for --perf-map. The perf map cannot forget
+  // symbols, so moved code is simply listed again at its new address.
+  void PerfMapCodeCreateEvent(LogEventsAndTags tag,
+                              Code* code,
+                              const char* marker,
+                              const char* name);
+  void PerfMapCodeMoveEvent(Address from, Address to);
+  void PerfMapCodeDeleteEvent(Address from);
+
   // Emits a profiler tick event. Used by the profiler thread.
   void TickEvent(TickSample* sample, bool overflow);
 
@@ -394,6 +404,9 @@ class Logger {
   //  Logger::FunctionCreateEvent(...)
   Address prev_code_;
 
+  // Names of the live code objects listed in the perf map.
+  PerfMapNames* perf_map_names_;
+
   friend class CpuProfiler;
 #else
   bool is_logging() { return false; }
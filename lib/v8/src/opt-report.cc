@@ -0,0 +1,222 @@
+// Copyright 2011 the V8 project authors. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//     * Neither the name of Google Inc. nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "v8.h"
+
+#include "opt-report.h"
+
+#include "handles.h"
+#include "log.h"
+#include "objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+OptimizationReport::OptimizationReport()
+    : records_(MatchRecords) {
+}
+
+
+OptimizationReport::~OptimizationReport() {
+  for (int i = 0; i < record_list_.length(); i++) {
+    DeleteArray(record_list_[i]->name);
+    delete record_list_[i];
+  }
+}
+
+
+bool OptimizationReport::MatchRecords(void* key1, void* key2) {
+  Record* a = reinterpret_cast<Record*>(key1);
+  Record* b = reinterpret_cast<Record*>(key2);
+  return a->script_id == b->script_id && a->position == b->position;
+}
+
+
+// Functions are told apart by their script and their position in it, which
+// unlike the function objects survive garbage collection.
+OptimizationReport::Record* OptimizationReport::Lookup(
+    SharedFunctionInfo* shared, bool allow_allocation) {
+  Record key;
+  key.script_id = -1;
+  key.position = shared->start_position();
+  Object* script_object = shared->script();
+  if (script_object->IsScript()) {
+    Object* id = Script::cast(script_object)->id();
+    if (id->IsSmi()) key.script_id = Smi::cast(id)->value();
+  }
+
+  uint32_t hash = ComputeIntegerHash(key.position ^ (key.script_id << 16));
+  HashMap::Entry* entry = records_.Lookup(&key, hash, true);
+  if (entry->value != NULL) return reinterpret_cast<Record*>(entry->value);
+
+  Record* record = new Record;
+  record->script_id = key.script_id;
+  record->position = key.position;
+  record->attempts = 0;
+  record->optimizations = 0;
+  record->optimize_ms = 0;
+  record->deopts = 0;
+  record->unoptimized_ticks = 0;
+  record->optimized_ticks = 0;
+
+  // Name the function after its source location, e.g. "it jshint.js:899".
+  // Without allocation the line is only known if the script has its line
+  // ends computed already; it falls back to the character position.
+  HandleScope scope;
+  SmartPointer<char> name = shared->DebugName()->ToCString();
+  SmartPointer<char> script_name;
+  int line = -1;
+  if (script_object->IsScript()) {
+    Handle<Script> script(Script::cast(script_object));
+    if (script->name()->IsString()) {
+      script_name = String::cast(script->name())->ToCString();
+    }
+    if (allow_allocation) {
+      line = GetScriptLineNumber(script, key.position) + 1;
+    } else if (!script->line_ends()->IsUndefined()) {
+      line = GetScriptLineNumberSafe(script, key.position) + 1;
+    }
+  }
+  const char* function_name = (*name)[0] != '\0' ? *name : "(anonymous)";
+  const char* source = !script_name.is_empty() ? *script_name : "(unknown)";
+  EmbeddedVector<char, 256> buffer;
+  if (line > 0) {
+    OS::SNPrintF(buffer, "%s %s:%d", function_name, source, line);
+  } else {
+    OS::SNPrintF(buffer, "%s %s@%d", function_name, source, key.position);
+  }
+  record->name = StrDup(buffer.start());
+
+  // The key of the new entry still points at the stack copy.
+  entry->key = record;
+  entry->value = record;
+  record_list_.Add(record);
+  return record;
+}
+
+
+void OptimizationReport::OptimizationStarted(SharedFunctionInfo* shared) {
+  Lookup(shared, true)->attempts++;
+}
+
+
+void OptimizationReport::OptimizationSucceeded(SharedFunctionInfo* shared,
+                                               double ms) {
+  Record* record = Lookup(shared, true);
+  record->optimizations++;
+  record->optimize_ms += ms;
+}
+
+
+void OptimizationReport::OptimizationFailed(SharedFunctionInfo* shared,
+                                            const char* reason) {
+  Record* record = Lookup(shared, true);
+  for (int i = 0; i < record->reasons.length(); i++) {
+    if (strcmp(record->reasons[i].text, reason) == 0) {
+      record->reasons[i].count++;
+      return;
+    }
+  }
+  Reason entry = { reason, 1 };
+  record->reasons.Add(entry);
+}
+
+
+void OptimizationReport::Deoptimized(JSFunction* function,
+                                     bool lazy,
+                                     unsigned id) {
+  // Deoptimization runs without a chance to allocate.
+  Record* record = Lookup(function->shared(), false);
+  record->deopts++;
+  for (int i = 0; i < record->deopt_sites.length(); i++) {
+    DeoptSite& site = record->deopt_sites[i];
+    if (site.lazy == lazy && site.id == id) {
+      site.count++;
+      return;
+    }
+  }
+  DeoptSite site = { lazy, id, 1 };
+  record->deopt_sites.Add(site);
+}
+
+
+void OptimizationReport::Tick(JSFunction* function, bool optimized) {
+  Record* record = Lookup(function->shared(), true);
+  if (optimized) {
+    record->optimized_ticks++;
+  } else {
+    record->unoptimized_ticks++;
+  }
+}
+
+
+int OptimizationReport::CompareRecords(Record* const* a, Record* const* b) {
+  int time_a = (*a)->unoptimized_ticks + (*a)->optimized_ticks;
+  int time_b = (*b)->unoptimized_ticks + (*b)->optimized_ticks;
+  if (time_a != time_b) return time_a > time_b ? -1 : 1;
+  if ((*a)->deopts != (*b)->deopts) return (*b)->deopts - (*a)->deopts;
+  return (*b)->attempts - (*a)->attempts;
+}
+
+
+void OptimizationReport::Print() {
+  // Ticks come in at the sampling interval of the runtime profiler.
+  const double kMsPerTick = Logger::kSamplingIntervalMs;
+  record_list_.Sort(CompareRecords);
+
+  OS::FPrint(stderr, "%-48s %10s %10s %8s %9s %7s\n",
+             "Function", "Unopt (ms)", "Opt (ms)", "Attempts", "Optimized",
+             "Deopts");
+  int unoptimized_ticks = 0;
+  int optimized_ticks = 0;
+  for (int i = 0; i < record_list_.length(); i++) {
+    Record* record = record_list_[i];
+    unoptimized_ticks += record->unoptimized_ticks;
+    optimized_ticks += record->optimized_ticks;
+    OS::FPrint(stderr, "%-48s %10.3f %10.3f %8d %9d %7d\n",
+               record->name,
+               record->unoptimized_ticks * kMsPerTick,
+               record->optimized_ticks * kMsPerTick,
+               record->attempts,
+               record->optimizations,
+               record->deopts);
+    for (int j = 0; j < record->reasons.length(); j++) {
+      OS::FPrint(stderr, "    bailout: %s (x%d)\n",
+                 record->reasons[j].text, record->reasons[j].count);
+    }
+    for (int j = 0; j < record->deopt_sites.length(); j++) {
+      DeoptSite& site = record->deopt_sites[j];
+      OS::FPrint(stderr, "    deopt: %s at bailout #%u (x%d)\n",
+                 site.lazy ? "lazy" : "eager", site.id, site.count);
+    }
+  }
+  OS::FPrint(stderr, "%-48s %10.3f %10.3f\n", "total",
+             unoptimized_ticks * kMsPerTick,
+             optimized_ticks * kMsPerTick);
+}
+
+} }  // namespace v8::internal
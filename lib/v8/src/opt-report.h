@@ -0,0 +1,105 @@
+// Copyright 2011 the V8 project authors. All rights reserved.
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+//       copyright notice, this list of conditions and the following
+//       disclaimer in the documentation and/or other materials provided
+//       with the distribution.
+//     * Neither the name of Google Inc. nor the names of its
+//       contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef V8_OPT_REPORT_H_
+#define V8_OPT_REPORT_H_
+
+#include "allocation.h"
+#include "hashmap.h"
+#include "list.h"
+
+namespace v8 {
+namespace internal {
+
+class JSFunction;
+class SharedFunctionInfo;
+
+// Aggregates, per JavaScript function, what the optimizing compiler did
+// with it when --opt-report is on: optimization attempts and the reasons
+// for bailing out, deoptimizations, and the time the runtime profiler saw
+// it running in unoptimized and in optimized code. The report is printed to
+// stderr when the isolate is torn down.
+class OptimizationReport : public Malloced {
+ public:
+  OptimizationReport();
+  ~OptimizationReport();
+
+  void OptimizationStarted(SharedFunctionInfo* shared);
+  void OptimizationSucceeded(SharedFunctionInfo* shared, double ms);
+  // The reason is expected to be a string literal.
+  void OptimizationFailed(SharedFunctionInfo* shared, const char* reason);
+
+  // The id is the bailout id of the deoptimization point in the
+  // optimized code. Entries for on-stack replacement are not reported.
+  void Deoptimized(JSFunction* function, bool lazy, unsigned id);
+
+  // Samples the function running at the top of the stack, once per tick
+  // of the runtime profiler.
+  void Tick(JSFunction* function, bool optimized);
+
+  void Print();
+
+ private:
+  struct Reason {
+    const char* text;
+    int count;
+  };
+
+  struct DeoptSite {
+    bool lazy;
+    unsigned id;
+    int count;
+  };
+
+  struct Record {
+    int script_id;
+    int position;
+    char* name;
+    int attempts;
+    int optimizations;
+    double optimize_ms;
+    int deopts;
+    int unoptimized_ticks;
+    int optimized_ticks;
+    List<Reason> reasons;
+    List<DeoptSite> deopt_sites;
+  };
+
+  Record* Lookup(SharedFunctionInfo* shared, bool allow_allocation);
+
+  static bool MatchRecords(void* key1, void* key2);
+  static int CompareRecords(Record* const* a, Record* const* b);
+
+  HashMap records_;
+  List<Record*> record_list_;
+
+  DISALLOW_COPY_AND_ASSIGN(OptimizationReport);
+};
+
+} }  // namespace v8::internal
+
+#endif  // V8_OPT_REPORT_H_
@@ -107,6 +107,18 @@ int OS::GetLastError() {
 }
 
 
+int OS::GetCurrentProcessId() {
+  UNIMPLEMENTED();
+  return 0;
+}
+
+
+void OS::RegisterForkHandlers(void (*prepare)(),
+                              void (*parent)(),
+                              void (*child)()) {
+}
+
+
 // Returns the local time offset in milliseconds east of UTC without
 // taking daylight savings time into account.
 double OS::LocalTimeOffset() {
@@ -29,6 +29,7 @@
 // own but contains the parts which are the same across POSIX platforms Linux,
 // Mac OS, FreeBSD and OpenBSD.
 
+#include <pthread.h>
 #include <unistd.h>
 #include <errno.h>
 #include <time.h>
@@ -113,6 +114,18 @@ int OS::GetLastError() {
 }
 
 
+int OS::GetCurrentProcessId() {
+  return static_cast<int>(getpid());
+}
+
+
+void OS::RegisterForkHandlers(void (*prepare)(),
+                              void (*parent)(),
+                              void (*child)()) {
+  pthread_atfork(prepare, parent, child);
+}
+
+
 // ----------------------------------------------------------------------------
 // POSIX stdio support.
 //
@@ -645,6 +645,17 @@ int OS::GetLastError() {
 }
 
 
+int OS::GetCurrentProcessId() {
+  return static_cast<int>(::GetCurrentProcessId());
+}
+
+
+void OS::RegisterForkHandlers(void (*prepare)(),
+                              void (*parent)(),
+                              void (*child)()) {
+}
+
+
 // ----------------------------------------------------------------------------
 // Win32 console output.
 //
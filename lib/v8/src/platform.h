@@ -174,6 +174,16 @@ class OS {
   // Returns last OS error.
   static int GetLastError();
 
+  // Returns the id of the current process.
+  static int GetCurrentProcessId();
+
+  // Registers functions to call around fork(): in the parent before it
+  // forks, and then in the parent and in the child. Does nothing where
+  // processes don't fork.
+  static void RegisterForkHandlers(void (*prepare)(),
+                                   void (*parent)(),
+                                   void (*child)());
+
   static FILE* FOpen(const char* path, const char* mode);
   static bool Remove(const char* path);
 
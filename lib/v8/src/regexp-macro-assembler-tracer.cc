@@ -148,6 +148,16 @@ void RegExpMacroAssemblerTracer::SetRegister(int register_index, int to) {
 }
 
 
+void RegExpMacroAssemblerTracer::SkipUntilOneOf(Vector<const uc16> characters) {
+  PrintF(" SkipUntilOneOf(chars=\"");
+  for (int i = 0; i < characters.length(); i++) {
+    PrintF("u%04x", characters[i]);
+  }
+  PrintF("\");\n");
+  assembler_->SkipUntilOneOf(characters);
+}
+
+
 void RegExpMacroAssemblerTracer::WriteCurrentPositionToRegister(int reg,
                                                                 int cp_offset) {
   PrintF(" WriteCurrentPositionToRegister(register=%d,cp_offset=%d);\n",
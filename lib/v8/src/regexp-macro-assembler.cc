@@ -32,6 +32,11 @@
 #include "regexp-macro-assembler.h"
 #include "simulator.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define V8_REGEXP_SKIP_SSE2 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -52,6 +57,22 @@ bool RegExpMacroAssembler::CanReadUnaligned() {
 }
 
 
+void RegExpMacroAssembler::SkipUntilOneOf(Vector<const uc16> characters) {
+  ASSERT(characters.length() <= kMaxSkipCharacters);
+  Label again;
+  Label found;
+  Bind(&again);
+  // Running into the end of input stops the skip as well.
+  LoadCurrentCharacter(0, &found);
+  for (int i = 0; i < characters.length(); i++) {
+    CheckCharacter(characters[i], &found);
+  }
+  AdvanceCurrentPosition(1);
+  GoTo(&again);
+  Bind(&found);
+}
+
+
 #ifndef V8_INTERPRETED_REGEXP  // Avoid unused code, e.g., on ARM.
 
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler() {
@@ -100,6 +121,94 @@ const byte* NativeRegExpMacroAssembler::StringCharacterPosition(
 }
 
 
+#ifdef V8_REGEXP_SKIP_SSE2
+// Index of the lowest set bit of a non-zero movemask result.
+static inline int LowestBitIndex(int mask) {
+  ASSERT(mask != 0);
+  int index = 0;
+  while ((mask & 1) == 0) {
+    mask >>= 1;
+    index++;
+  }
+  return index;
+}
+#endif
+
+
+const byte* NativeRegExpMacroAssembler::SkipUntilOneOfASCII(
+    const byte* position,
+    const byte* end,
+    uint64_t characters) {
+  byte c0 = static_cast<byte>(characters);
+  byte c1 = static_cast<byte>(characters >> 16);
+  byte c2 = static_cast<byte>(characters >> 32);
+  byte c3 = static_cast<byte>(characters >> 48);
+#ifdef V8_REGEXP_SKIP_SSE2
+  // Compare sixteen characters at a time against all four candidates.
+  __m128i v0 = _mm_set1_epi8(static_cast<char>(c0));
+  __m128i v1 = _mm_set1_epi8(static_cast<char>(c1));
+  __m128i v2 = _mm_set1_epi8(static_cast<char>(c2));
+  __m128i v3 = _mm_set1_epi8(static_cast<char>(c3));
+  while (end - position >= 16) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+    __m128i hits = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(block, v0), _mm_cmpeq_epi8(block, v1)),
+        _mm_or_si128(_mm_cmpeq_epi8(block, v2), _mm_cmpeq_epi8(block, v3)));
+    int mask = _mm_movemask_epi8(hits);
+    if (mask != 0) return position + LowestBitIndex(mask);
+    position += 16;
+  }
+#endif
+  for (; position < end; position++) {
+    byte c = *position;
+    if (c == c0 || c == c1 || c == c2 || c == c3) return position;
+  }
+  return end;
+}
+
+
+const byte* NativeRegExpMacroAssembler::SkipUntilOneOfUC16(
+    const byte* position,
+    const byte* end,
+    uint64_t characters) {
+  uc16 c0 = static_cast<uc16>(characters);
+  uc16 c1 = static_cast<uc16>(characters >> 16);
+  uc16 c2 = static_cast<uc16>(characters >> 32);
+  uc16 c3 = static_cast<uc16>(characters >> 48);
+  const uc16* current = reinterpret_cast<const uc16*>(position);
+  const uc16* limit = reinterpret_cast<const uc16*>(end);
+#ifdef V8_REGEXP_SKIP_SSE2
+  // Compare eight characters at a time; the byte mask has two bits per
+  // character.
+  __m128i v0 = _mm_set1_epi16(static_cast<int16_t>(c0));
+  __m128i v1 = _mm_set1_epi16(static_cast<int16_t>(c1));
+  __m128i v2 = _mm_set1_epi16(static_cast<int16_t>(c2));
+  __m128i v3 = _mm_set1_epi16(static_cast<int16_t>(c3));
+  while (limit - current >= 8) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+    __m128i hits = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(block, v0), _mm_cmpeq_epi16(block, v1)),
+        _mm_or_si128(_mm_cmpeq_epi16(block, v2), _mm_cmpeq_epi16(block, v3)));
+    int mask = _mm_movemask_epi8(hits);
+    if (mask != 0) {
+      current += LowestBitIndex(mask) >> 1;
+      return reinterpret_cast<const byte*>(current);
+    }
+    current += 8;
+  }
+#endif
+  for (; current < limit; current++) {
+    uc16 c = *current;
+    if (c == c0 || c == c1 || c == c2 || c == c3) {
+      return reinterpret_cast<const byte*>(current);
+    }
+  }
+  return end;
+}
+
+
 NativeRegExpMacroAssembler::Result NativeRegExpMacroAssembler::Match(
     Handle<Code> regexp_code,
     Handle<String> subject,
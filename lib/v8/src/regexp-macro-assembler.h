@@ -45,6 +45,8 @@ class RegExpMacroAssembler {
   static const int kMaxRegister = (1 << 16) - 1;
   static const int kMaxCPOffset = (1 << 15) - 1;
   static const int kMinCPOffset = -(1 << 15);
+  // The maximal number of characters SkipUntilOneOf can look for.
+  static const int kMaxSkipCharacters = 4;
   enum IrregexpImplementation {
     kIA32Implementation,
     kARMImplementation,
@@ -158,6 +160,12 @@ class RegExpMacroAssembler {
   virtual void ReadStackPointerFromRegister(int reg) = 0;
   virtual void SetCurrentPositionFromEnd(int by) = 0;
   virtual void SetRegister(int register_index, int to) = 0;
+  // Advances the current position to the first character at or after it
+  // that is one of the given characters (at most kMaxSkipCharacters), or to
+  // the end of input if there is none.  Used by unanchored searches to skip
+  // positions where the regexp cannot start a match.  May clobber the
+  // current loaded character.
+  virtual void SkipUntilOneOf(Vector<const uc16> characters);
   virtual void Succeed() = 0;
   virtual void WriteCurrentPositionToRegister(int reg, int cp_offset) = 0;
   virtual void ClearRegisters(int reg_from, int reg_to) = 0;
@@ -211,6 +219,17 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
 
   static const byte* StringCharacterPosition(String* subject, int start_index);
 
+  // Scans the characters from position up to end for the first one that is
+  // equal to one of the four 16-bit characters packed into characters.
+  // Returns its address, or end if there is no such character.
+  // Called from generated RegExp code.
+  static const byte* SkipUntilOneOfASCII(const byte* position,
+                                         const byte* end,
+                                         uint64_t characters);
+  static const byte* SkipUntilOneOfUC16(const byte* position,
+                                        const byte* end,
+                                        uint64_t characters);
+
   // Byte map of ASCII characters with a 0xff if the character is a word
   // character (digit, letter or underscore) and 0x00 otherwise.
   // Used by generated RegExp code.
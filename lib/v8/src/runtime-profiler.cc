@@ -36,6 +36,7 @@
 #include "execution.h"
 #include "global-handles.h"
 #include "mark-compact.h"
+#include "opt-report.h"
 #include "platform.h"
 #include "scopeinfo.h"
 
@@ -258,6 +259,15 @@ void RuntimeProfiler::OptimizeNow() {
   }
   optimize_soon_list_ = NULL;
 
+  if (FLAG_opt_report) {
+    JavaScriptFrameIterator it(isolate_);
+    if (!it.done()) {
+      JavaScriptFrame* frame = it.frame();
+      isolate_->optimization_report()->Tick(
+          JSFunction::cast(frame->function()), frame->is_optimized());
+    }
+  }
+
   // Run through the JavaScript frames and collect them. If we already
   // have a sample of the function, we mark it for optimizations
   // (eagerly or lazily).
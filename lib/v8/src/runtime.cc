@@ -3376,7 +3376,11 @@ static RegExpImpl::IrregexpResult SearchRegExpMultiple(
 
     do {
       int match_start = register_vector[0];
-      builder->EnsureCapacity(kMaxBuilderEntriesPerRegExpMatch);
+      // The match, its captures and its index are added directly to the
+      // builder rather than wrapped in an array per match, so the caller
+      // can reuse a single arguments array for the replace function.
+      builder->EnsureCapacity(kMaxBuilderEntriesPerRegExpMatch +
+                              capture_count);
       if (match_end < match_start) {
         ReplacementStringBuilder::AddSubjectSlice(builder,
                                                   match_end,
@@ -3387,14 +3391,10 @@ static RegExpImpl::IrregexpResult SearchRegExpMultiple(
       {
         // Avoid accumulating new handles inside loop.
         HandleScope temp_scope(isolate);
-        // Arguments array to replace function is match, captures, index and
-        // subject, i.e., 3 + capture count in total.
-        Handle<FixedArray> elements =
-            isolate->factory()->NewFixedArray(3 + capture_count);
         Handle<String> match = isolate->factory()->NewSubString(subject,
                                                                 match_start,
                                                                 match_end);
-        elements->set(0, *match);
+        builder->Add(*match);
         for (int i = 1; i <= capture_count; i++) {
           int start = register_vector[i * 2];
           if (start >= 0) {
@@ -3403,15 +3403,13 @@ static RegExpImpl::IrregexpResult SearchRegExpMultiple(
             Handle<String> substring = isolate->factory()->NewSubString(subject,
                                                                         start,
                                                                         end);
-            elements->set(i, *substring);
+            builder->Add(*substring);
           } else {
             ASSERT(register_vector[i * 2 + 1] < 0);
-            elements->set(i, isolate->heap()->undefined_value());
+            builder->Add(isolate->heap()->undefined_value());
           }
         }
-        elements->set(capture_count + 1, Smi::FromInt(match_start));
-        elements->set(capture_count + 2, *subject);
-        builder->Add(*isolate->factory()->NewJSArrayWithElements(elements));
+        builder->Add(Smi::FromInt(match_start));
       }
       // Swap register vectors, so the last successful match is in
       // prev_register_vector.
@@ -31,9 +31,132 @@
 #include "scanner-base.h"
 #include "char-predicates-inl.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define V8_SCANNER_SKIP_SSE2 1
+#endif
+
 namespace v8 {
 namespace internal {
 
+// ----------------------------------------------------------------------------
+// UC16CharacterStream
+
+#ifdef V8_SCANNER_SKIP_SSE2
+// Index of the lowest set bit of a non-zero movemask result.
+static inline int LowestBitIndex(int mask) {
+  ASSERT(mask != 0);
+  int index = 0;
+  while ((mask & 1) == 0) {
+    mask >>= 1;
+    index++;
+  }
+  return index;
+}
+
+
+// Lanes holding a character above 0x7f.
+static inline __m128i NonAsciiLanes(__m128i block) {
+  __m128i above = _mm_subs_epu16(block, _mm_set1_epi16(0x7f));
+  return _mm_xor_si128(_mm_cmpeq_epi16(above, _mm_setzero_si128()),
+                       _mm_set1_epi16(-1));
+}
+#endif
+
+
+bool UC16CharacterStream::SkipBufferedWhiteSpace() {
+  const uc16* cursor = buffer_cursor_;
+  const uc16* end = buffer_end_;
+  int line_terminators = 0;
+#ifdef V8_SCANNER_SKIP_SSE2
+  // Eight characters at a time; the byte mask has two bits per character.
+  while (end - cursor >= 8) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i newlines =
+        _mm_or_si128(_mm_cmpeq_epi16(block, _mm_set1_epi16('\n')),
+                     _mm_cmpeq_epi16(block, _mm_set1_epi16('\r')));
+    __m128i blanks =
+        _mm_or_si128(_mm_cmpeq_epi16(block, _mm_set1_epi16(' ')),
+                     _mm_cmpeq_epi16(block, _mm_set1_epi16('\t')));
+    int white = _mm_movemask_epi8(_mm_or_si128(blanks, newlines));
+    int lines = _mm_movemask_epi8(newlines);
+    if (white != 0xffff) {
+      int stop = LowestBitIndex(~white);
+      line_terminators |= lines & ((1 << stop) - 1);
+      cursor += stop >> 1;
+      break;
+    }
+    line_terminators |= lines;
+    cursor += 8;
+  }
+#endif
+  for (; cursor < end; cursor++) {
+    uc16 c = *cursor;
+    if (c == ' ' || c == '\t' || c == '\v' || c == '\f') continue;
+    if (c != '\n' && c != '\r') break;
+    line_terminators = 1;
+  }
+  pos_ += static_cast<unsigned>(cursor - buffer_cursor_);
+  buffer_cursor_ = cursor;
+  return line_terminators != 0;
+}
+
+
+void UC16CharacterStream::SkipBufferedSingleLineComment() {
+  const uc16* cursor = buffer_cursor_;
+  const uc16* end = buffer_end_;
+#ifdef V8_SCANNER_SKIP_SSE2
+  while (end - cursor >= 8) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i stops = _mm_or_si128(
+        NonAsciiLanes(block),
+        _mm_or_si128(_mm_cmpeq_epi16(block, _mm_set1_epi16('\n')),
+                     _mm_cmpeq_epi16(block, _mm_set1_epi16('\r'))));
+    int mask = _mm_movemask_epi8(stops);
+    if (mask != 0) {
+      cursor += LowestBitIndex(mask) >> 1;
+      end = cursor;
+      break;
+    }
+    cursor += 8;
+  }
+#endif
+  for (; cursor < end; cursor++) {
+    uc16 c = *cursor;
+    if (c == '\n' || c == '\r' || c > 0x7f) break;
+  }
+  pos_ += static_cast<unsigned>(cursor - buffer_cursor_);
+  buffer_cursor_ = cursor;
+}
+
+
+void UC16CharacterStream::SkipBufferedMultiLineComment() {
+  const uc16* cursor = buffer_cursor_;
+  const uc16* end = buffer_end_;
+#ifdef V8_SCANNER_SKIP_SSE2
+  while (end - cursor >= 8) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i stops =
+        _mm_or_si128(NonAsciiLanes(block),
+                     _mm_cmpeq_epi16(block, _mm_set1_epi16('*')));
+    int mask = _mm_movemask_epi8(stops);
+    if (mask != 0) {
+      cursor += LowestBitIndex(mask) >> 1;
+      end = cursor;
+      break;
+    }
+    cursor += 8;
+  }
+#endif
+  for (; cursor < end; cursor++) {
+    uc16 c = *cursor;
+    if (c == '*' || c > 0x7f) break;
+  }
+  pos_ += static_cast<unsigned>(cursor - buffer_cursor_);
+  buffer_cursor_ = cursor;
+}
+
+
 // ----------------------------------------------------------------------------
 // Scanner
 
@@ -133,6 +256,9 @@ bool JavaScriptScanner::SkipWhiteSpace() {
         // for automatic semicolon insertion.
         has_line_terminator_before_next_ = true;
       }
+      if (source_->SkipBufferedWhiteSpace()) {
+        has_line_terminator_before_next_ = true;
+      }
       Advance();
     }
 
@@ -169,6 +295,7 @@ Token::Value JavaScriptScanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4, page 12).
   while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+    source_->SkipBufferedSingleLineComment();
     Advance();
   }
 
@@ -182,6 +309,9 @@ Token::Value JavaScriptScanner::SkipMultiLineComment() {
 
   while (c0_ >= 0) {
     char ch = c0_;
+    // Nothing skipped here can be a '*', so only the character after
+    // the skipped run can start the end of the comment.
+    if (ch != '*') source_->SkipBufferedMultiLineComment();
     Advance();
     // If we have reached the end of the multi-line comment, we
     // consume the '/' and insert a whitespace. This way all
@@ -224,15 +354,14 @@ void JavaScriptScanner::Scan() {
     next_.location.beg_pos = source_pos();
 
     switch (c0_) {
+      case '\n':
+        has_line_terminator_before_next_ = true;
+        // Fall through.
       case ' ':
       case '\t':
         Advance();
-        token = Token::WHITESPACE;
-        break;
-
-      case '\n':
-        Advance();
-        has_line_terminator_before_next_ = true;
+        // Longer runs, such as indentation, take the buffered path.
+        if (c0_ == ' ' || c0_ == '\t' || c0_ == '\n') SkipWhiteSpace();
         token = Token::WHITESPACE;
         break;
 
@@ -103,6 +103,19 @@ class UC16CharacterStream {
   // Must not be used right after calling SeekForward.
   virtual void PushBack(int32_t character) = 0;
 
+  // Skip forward over the buffered characters that cannot end a run of
+  // white space or a comment, stopping in front of the first character
+  // that needs a closer look or at the end of the buffer. They never
+  // read a new block; the caller continues with Advance, which does.
+
+  // Skips ASCII white space and returns whether it contained a line
+  // terminator.
+  bool SkipBufferedWhiteSpace();
+  // Skips up to the next '\n', '\r' or non-ASCII character.
+  void SkipBufferedSingleLineComment();
+  // Skips up to the next '*' or non-ASCII character.
+  void SkipBufferedMultiLineComment();
+
  protected:
   static const uc32 kEndOfInput = -1;
 
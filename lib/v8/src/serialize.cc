@@ -516,6 +516,16 @@ void ExternalReferenceTable::PopulateTable(Isolate* isolate) {
       UNCLASSIFIED,
       42,
       "Factory::arguments_marker().location()");
+#ifndef V8_INTERPRETED_REGEXP
+  Add(ExternalReference::re_skip_until_one_of(isolate, true).address(),
+      UNCLASSIFIED,
+      43,
+      "NativeRegExpMacroAssembler::SkipUntilOneOfASCII()");
+  Add(ExternalReference::re_skip_until_one_of(isolate, false).address(),
+      UNCLASSIFIED,
+      44,
+      "NativeRegExpMacroAssembler::SkipUntilOneOfUC16()");
+#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -105,6 +105,8 @@ namespace internal {
   SC(contexts_created_from_scratch, V8.ContextsCreatedFromScratch)    \
   /* Number of contexts created by partial snapshot. */               \
   SC(contexts_created_by_snapshot, V8.ContextsCreatedBySnapshot)      \
+  /* Microseconds spent compiling and running the natives. */         \
+  SC(natives_bootstrap_time, V8.NativesBootstrapMicroseconds)         \
   /* Number of code objects found from pc. */                         \
   SC(pc_to_code, V8.PcToCode)                                         \
   SC(pc_to_code_cached, V8.PcToCodeCached)
@@ -205,6 +207,9 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                               \
   SC(enum_cache_misses, V8.EnumCacheMisses)                           \
   SC(zone_segment_bytes, V8.ZoneSegmentBytes)                         \
+  SC(zone_segment_pool_hits, V8.ZoneSegmentPoolHits)                  \
+  SC(zone_segment_pool_misses, V8.ZoneSegmentPoolMisses)              \
+  SC(zone_segment_pool_bytes, V8.ZoneSegmentPoolBytes)                \
   SC(compute_entry_frame, V8.ComputeEntryFrame)                       \
   SC(generic_binary_stub_calls, V8.GenericBinaryStubCalls)            \
   SC(generic_binary_stub_calls_regs, V8.GenericBinaryStubCallsRegs)   \
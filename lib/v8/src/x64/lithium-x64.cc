@@ -548,6 +548,7 @@ void LChunkBuilder::Abort(const char* format, ...) {
     va_end(arguments);
     PrintF("\n");
   }
+  info()->set_bailout_reason(format);
   status_ = ABORTED;
 }
 
@@ -1564,7 +1565,7 @@ LInstruction* LChunkBuilder::DoHasCachedArrayIndex(
 
 
 LInstruction* LChunkBuilder::DoClassOfTest(HClassOfTest* instr) {
-  Abort("Unimplemented: %s", "DoClassOfTest");
+  Abort("Unimplemented: DoClassOfTest");
   return NULL;
 }
 
@@ -1083,6 +1083,80 @@ void RegExpMacroAssemblerX64::SetRegister(int register_index, int to) {
 }
 
 
+void RegExpMacroAssemblerX64::SkipUntilOneOf(Vector<const uc16> characters) {
+  ASSERT(characters.length() <= kMaxSkipCharacters);
+  if (characters.length() == 0) {
+    // Only an empty match at the end of input is possible.
+    __ xorl(rdi, rdi);
+    return;
+  }
+  uint64_t packed = 0;
+  for (int i = 0; i < kMaxSkipCharacters; i++) {
+    // Unused slots repeat the first character.
+    uc16 c = characters[i < characters.length() ? i : 0];
+    packed |= static_cast<uint64_t>(c) << (16 * i);
+  }
+
+  // Look at the next few characters inline, so that dense candidates
+  // don't pay for the call.
+  static const int kInlineLookahead = 2;
+  Label found;
+  Label loop;
+  __ movl(r9, Immediate(kInlineLookahead));
+  __ bind(&loop);
+  CheckPosition(0, &found);
+  LoadCurrentCharacterUnchecked(0, 1);
+  for (int i = 0; i < characters.length(); i++) {
+    __ cmpl(current_character(), Immediate(characters[i]));
+    __ j(equal, &found);
+  }
+  __ addq(rdi, Immediate(char_size()));
+  __ subl(r9, Immediate(1));
+  __ j(not_zero, &loop);
+
+  // Save important/volatile registers before calling C function.
+#ifndef _WIN64
+  // Caller save on Linux and callee save in Windows.
+  __ push(rsi);
+  __ push(rdi);
+#endif
+  __ push(backtrack_stackpointer());
+
+  static const int num_arguments = 3;
+  __ PrepareCallCFunction(num_arguments);
+
+  // Put arguments into parameter registers. Parameters are
+  //   const byte* position - Address of the current character.
+  //   const byte* end - End of input.
+  //   uint64_t characters - The characters to look for, 16 bits each.
+#ifdef _WIN64
+  __ lea(rcx, Operand(rsi, rdi, times_1, 0));
+  __ movq(rdx, rsi);
+  __ Set(r8, static_cast<int64_t>(packed));
+#else  // AMD64 calling convention
+  __ lea(rax, Operand(rsi, rdi, times_1, 0));
+  __ movq(rdi, rax);
+  __ Set(rdx, static_cast<int64_t>(packed));
+#endif
+  ExternalReference skip =
+      ExternalReference::re_skip_until_one_of(masm_.isolate(), mode_ == ASCII);
+  __ CallCFunction(skip, num_arguments);
+
+  // Restore original values.
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  __ pop(backtrack_stackpointer());
+#ifndef _WIN64
+  __ pop(rdi);
+  __ pop(rsi);
+#endif
+
+  // The result is the address of the new current position.
+  __ movq(rdi, rax);
+  __ subq(rdi, rsi);
+  __ bind(&found);
+}
+
+
 void RegExpMacroAssemblerX64::Succeed() {
   __ jmp(&success_label_);
 }
@@ -40,7 +40,9 @@ Zone::Zone()
       position_(0),
       limit_(0),
       scope_nesting_(0),
-      segment_head_(NULL) {
+      segment_head_(NULL),
+      segment_pool_bytes_(0) {
+  for (int i = 0; i < kSegmentSizeClasses; i++) segment_pool_[i] = NULL;
 }
 unsigned Zone::allocation_size_ = 0;
 
@@ -82,10 +84,35 @@ class Segment {
 };
 
 
+int Zone::SizeClass(int size) {
+  int size_class = 0;
+  for (int class_size = kMinimumSegmentSize;
+       class_size <= kMaximumSegmentSize;
+       class_size <<= 1) {
+    if (class_size == size) return size_class;
+    size_class++;
+  }
+  return -1;
+}
+
+
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(int size) {
-  Segment* result = reinterpret_cast<Segment*>(Malloced::New(size));
+  Segment* result;
+  int size_class = SizeClass(size);
+  if (size_class >= 0 && segment_pool_[size_class] != NULL) {
+    result = segment_pool_[size_class];
+    segment_pool_[size_class] = result->next();
+    segment_pool_bytes_ -= size;
+    isolate_->counters()->zone_segment_pool_hits()->Increment();
+    isolate_->counters()->zone_segment_pool_bytes()->Set(segment_pool_bytes_);
+  } else {
+    result = reinterpret_cast<Segment*>(Malloced::New(size));
+    if (size_class >= 0) {
+      isolate_->counters()->zone_segment_pool_misses()->Increment();
+    }
+  }
   adjust_segment_bytes_allocated(size);
   if (result != NULL) {
     result->next_ = segment_head_;
@@ -99,10 +126,34 @@ Segment* Zone::NewSegment(int size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, int size) {
   adjust_segment_bytes_allocated(-size);
+  int size_class = SizeClass(size);
+  if (size_class >= 0 &&
+      segment_pool_bytes_ + size <= FLAG_zone_segment_pool_size * KB) {
+    segment->next_ = segment_pool_[size_class];
+    segment_pool_[size_class] = segment;
+    segment_pool_bytes_ += size;
+    isolate_->counters()->zone_segment_pool_bytes()->Set(segment_pool_bytes_);
+    return;
+  }
   Malloced::Delete(segment);
 }
 
 
+void Zone::ReleasePooledSegments() {
+  for (int i = 0; i < kSegmentSizeClasses; i++) {
+    Segment* current = segment_pool_[i];
+    while (current != NULL) {
+      Segment* next = current->next();
+      Malloced::Delete(current);
+      current = next;
+    }
+    segment_pool_[i] = NULL;
+  }
+  segment_pool_bytes_ = 0;
+  isolate_->counters()->zone_segment_pool_bytes()->Set(0);
+}
+
+
 void Zone::DeleteAll() {
 #ifdef DEBUG
   // Constant byte value used for zapping dead memory in debug mode.
@@ -178,6 +229,14 @@ Address Zone::NewExpand(int size) {
     // requested size.
     new_size = Max(kSegmentOverhead + size, kMaximumSegmentSize);
   }
+  if (new_size <= kMaximumSegmentSize) {
+    // Round to a size class so that the segment can be pooled: down to
+    // keep the growth rate, unless that leaves no room for the request.
+    int class_size = kMinimumSegmentSize;
+    while ((class_size << 1) <= new_size) class_size <<= 1;
+    if (class_size < kSegmentOverhead + size) class_size <<= 1;
+    new_size = class_size;
+  }
   Segment* segment = NewSegment(new_size);
   if (segment == NULL) {
     V8::FatalProcessOutOfMemory("Zone");
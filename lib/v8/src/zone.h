@@ -66,6 +66,9 @@ class Zone {
   // Delete all objects and free all memory allocated in the Zone.
   void DeleteAll();
 
+  // Free the segments kept in the segment pool.
+  void ReleasePooledSegments();
+
   // Returns true if more memory has been allocated in zones than
   // the limit allows.
   inline bool excess_allocation();
@@ -90,6 +93,12 @@ class Zone {
   // Never keep segments larger than this size in bytes around.
   static const int kMaximumKeptSegmentSize = 64 * KB;
 
+  // Segments up to kMaximumSegmentSize come in power of two size
+  // classes, starting at kMinimumSegmentSize. Freed segments of these
+  // sizes go to a pool, limited by --zone-segment-pool-size, and are
+  // handed out again before asking malloc() for new ones.
+  static const int kSegmentSizeClasses = 8;
+
   // Report zone excess when allocation exceeds this limit.
   int zone_excess_limit_;
 
@@ -114,6 +123,10 @@ class Zone {
   // Deletes the given segment. Does not touch the segment chain.
   void DeleteSegment(Segment* segment, int size);
 
+  // Returns the index of the size class of a segment of the given
+  // size, or -1 if segments of that size are not pooled.
+  static int SizeClass(int size);
+
   // The free region in the current (front) segment is represented as
   // the half-open interval [position, limit). The 'position' variable
   // is guaranteed to be aligned as dictated by kAlignment.
@@ -124,6 +137,10 @@ class Zone {
 
   Segment* segment_head_;
   Isolate* isolate_;
+
+  // Free segments by size class, chained through their next pointers.
+  Segment* segment_pool_[kSegmentSizeClasses];
+  int segment_pool_bytes_;
 };
 
 
@@ -0,0 +1,291 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "watchdog.h"
+
+#include <v8.h>
+
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+using namespace v8;
+
+static int timeout = 0;
+
+// One entry per isolate armed at the moment; --bundle arms one per
+// thread. An entry is dropped when its isolate is disarmed.
+#ifdef _WIN32
+typedef DWORD Deadline;
+#else
+typedef timespec Deadline;
+#endif
+
+struct Watch
+{
+    Isolate* isolate;
+    Deadline deadline;
+    bool fired;
+};
+
+static std::vector<Watch> watches;
+
+// Call with the lock held.
+static Watch* find_watch(Isolate* isolate)
+{
+    for (size_t i = 0; i < watches.size(); ++i) {
+        if (watches[i].isolate == isolate)
+            return &watches[i];
+    }
+    return 0;
+}
+
+static bool take_fired(Isolate* isolate)
+{
+    for (size_t i = 0; i < watches.size(); ++i) {
+        if (watches[i].isolate == isolate) {
+            bool fired = watches[i].fired;
+            watches.erase(watches.begin() + i);
+            return fired;
+        }
+    }
+    return false;
+}
+
+// The deadlines are checked again after every wake-up, since waits can
+// return early.
+#ifdef _WIN32
+
+static CRITICAL_SECTION lock;
+static HANDLE wake = 0;
+
+static DWORD WINAPI watch(LPVOID)
+{
+    for (;;) {
+        EnterCriticalSection(&lock);
+        DWORD wait = INFINITE;
+        DWORD now = GetTickCount();
+        for (size_t i = 0; i < watches.size(); ++i) {
+            Watch& entry = watches[i];
+            if (entry.fired)
+                continue;
+            long remaining = static_cast<long>(entry.deadline - now);
+            if (remaining <= 0) {
+                entry.fired = true;
+                V8::TerminateExecution(entry.isolate);
+            } else if (static_cast<DWORD>(remaining) < wait) {
+                wait = remaining;
+            }
+        }
+        LeaveCriticalSection(&lock);
+        WaitForSingleObject(wake, wait);
+    }
+    return 0;
+}
+
+static void init_lock()
+{
+    InitializeCriticalSection(&lock);
+}
+
+// Call with the lock held.
+static void start_watching()
+{
+    if (wake)
+        return;
+    wake = CreateEvent(0, FALSE, FALSE, 0);
+    CloseHandle(CreateThread(0, 0, watch, 0, 0, 0));
+}
+
+void watchdog_arm()
+{
+    if (!timeout)
+        return;
+    EnterCriticalSection(&lock);
+    start_watching();
+    Isolate* isolate = Isolate::GetCurrent();
+    Watch* entry = find_watch(isolate);
+    if (!entry) {
+        watches.push_back(Watch());
+        entry = &watches.back();
+        entry->isolate = isolate;
+    }
+    entry->deadline = GetTickCount() + timeout;
+    entry->fired = false;
+    LeaveCriticalSection(&lock);
+    SetEvent(wake);
+}
+
+bool watchdog_disarm()
+{
+    if (!timeout)
+        return false;
+    Isolate* isolate = Isolate::GetCurrent();
+    EnterCriticalSection(&lock);
+    bool result = take_fired(isolate);
+    LeaveCriticalSection(&lock);
+    if (result)
+        V8::CancelTerminateExecution(isolate);
+    return result;
+}
+
+#else
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static bool watching = false;
+
+static bool past(const timespec& deadline, const timeval& now)
+{
+    return now.tv_sec > deadline.tv_sec
+        || (now.tv_sec == deadline.tv_sec && now.tv_usec * 1000L >= deadline.tv_nsec);
+}
+
+static bool earlier(const timespec& a, const timespec& b)
+{
+    return a.tv_sec < b.tv_sec || (a.tv_sec == b.tv_sec && a.tv_nsec < b.tv_nsec);
+}
+
+static void* watch(void*)
+{
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        timeval now;
+        gettimeofday(&now, 0);
+        timespec next;
+        bool waiting = false;
+        for (size_t i = 0; i < watches.size(); ++i) {
+            Watch& entry = watches[i];
+            if (entry.fired)
+                continue;
+            if (past(entry.deadline, now)) {
+                entry.fired = true;
+                V8::TerminateExecution(entry.isolate);
+            } else if (!waiting || earlier(entry.deadline, next)) {
+                next = entry.deadline;
+                waiting = true;
+            }
+        }
+        if (waiting)
+            pthread_cond_timedwait(&wake, &lock, &next);
+        else
+            pthread_cond_wait(&wake, &lock);
+    }
+    return 0;
+}
+
+// A forked child, a --prefork worker, gets none of the threads but all
+// of the state, so it starts its own watchdog when it needs one.
+static void before_fork()
+{
+    pthread_mutex_lock(&lock);
+}
+
+static void after_fork_in_parent()
+{
+    pthread_mutex_unlock(&lock);
+}
+
+static void after_fork_in_child()
+{
+    watching = false;
+    pthread_cond_init(&wake, 0);
+    pthread_mutex_unlock(&lock);
+}
+
+static void init_lock()
+{
+}
+
+// Call with the lock held.
+static void start_watching()
+{
+    if (watching)
+        return;
+    static bool registered = false;
+    if (!registered) {
+        registered = true;
+        pthread_atfork(before_fork, after_fork_in_parent, after_fork_in_child);
+    }
+    watching = true;
+    pthread_t thread;
+    pthread_create(&thread, 0, watch, 0);
+    pthread_detach(thread);
+}
+
+void watchdog_arm()
+{
+    if (!timeout)
+        return;
+    pthread_mutex_lock(&lock);
+    start_watching();
+    Isolate* isolate = Isolate::GetCurrent();
+    Watch* entry = find_watch(isolate);
+    if (!entry) {
+        watches.push_back(Watch());
+        entry = &watches.back();
+        entry->isolate = isolate;
+    }
+    timeval now;
+    gettimeofday(&now, 0);
+    long nsec = now.tv_usec * 1000L + (timeout % 1000) * 1000000L;
+    entry->deadline.tv_sec = now.tv_sec + timeout / 1000 + nsec / 1000000000L;
+    entry->deadline.tv_nsec = nsec % 1000000000L;
+    entry->fired = false;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+}
+
+bool watchdog_disarm()
+{
+    if (!timeout)
+        return false;
+    Isolate* isolate = Isolate::GetCurrent();
+    pthread_mutex_lock(&lock);
+    bool result = take_fired(isolate);
+    pthread_mutex_unlock(&lock);
+    // The script may have finished just before the budget ran out, and
+    // then the termination would hit whatever runs next.
+    if (result)
+        V8::CancelTerminateExecution(isolate);
+    return result;
+}
+
+#endif
+
+// Called while the options are parsed, before there are other threads.
+void watchdog_set_timeout(int milliseconds)
+{
+    if (!timeout)
+        init_lock();
+    timeout = milliseconds;
+}
+
+int watchdog_timeout()
+{
+    return timeout;
+}
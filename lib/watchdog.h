@@ -0,0 +1,47 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#ifndef EIGHTPACK_WATCHDOG_H
+#define EIGHTPACK_WATCHDOG_H
+
+// Execution budget for --timeout: a thread that waits for the deadline
+// and then terminates the JavaScript running in the isolate, which the
+// script can't catch. The budget applies to each unit of work, such as
+// one input file, between watchdog_arm and watchdog_disarm.
+
+// Exit status when a run ran out of its budget, the same as that of
+// timeout(1).
+static const int kTimedOutStatus = 124;
+
+// Sets the budget in milliseconds; zero, the default, means none.
+void watchdog_set_timeout(int milliseconds);
+int watchdog_timeout();
+
+// Starts counting for the current isolate; isolates on other threads
+// count on their own. Does nothing without a budget.
+void watchdog_arm();
+
+// Stops counting. Returns true if the budget ran out, in which case the
+// JavaScript that was running has been terminated.
+bool watchdog_disarm();
+
+#endif
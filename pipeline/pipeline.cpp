@@ -0,0 +1,238 @@
+/*
+    Copyright (C) 2011 Ariya Hidayat.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+    THE SOFTWARE.
+*/
+
+#include "eightpack.h"
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+struct ToolName
+{
+    const char* name;
+    eightpack::Tool tool;
+};
+
+static const ToolName tool_names[] = {
+    { "jshint", eightpack::JSHint },
+    { "jslint", eightpack::JSLint },
+    { "jsbeautify", eightpack::JSBeautify },
+    { "jsmin", eightpack::JSMin },
+    { "cssbeautify", eightpack::CSSBeautify },
+    { "cssmin", eightpack::CSSMin }
+};
+
+static const int tool_count = sizeof(tool_names) / sizeof(tool_names[0]);
+
+static void usage()
+{
+    std::cout << "Usage:" << std::endl;
+    std::cout << "    eightpack pipeline --tools=tool,... [options] filename..." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Runs the tools one after another on each file, which is read once." << std::endl;
+    std::cout << "A linter that finds a problem stops that file; the other tools" << std::endl;
+    std::cout << "pass what they produce on to the next one." << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "    --tools=LIST         jshint, jslint, jsbeautify, jsmin, cssbeautify, cssmin" << std::endl;
+    std::cout << "    --TOOL.OPTION[=V]    Pass --OPTION[=V] to TOOL, e.g. --jsmin.aggressive" << std::endl;
+    std::cout << "    --out-dir=DIR        Write each output to DIR instead of to stdout" << std::endl;
+    std::cout << std::endl;
+    ::exit(-1);
+}
+
+static int find_tool(const std::string& name)
+{
+    for (int i = 0; i < tool_count; ++i) {
+        if (name == tool_names[i].name)
+            return i;
+    }
+    return -1;
+}
+
+static std::string base_name(const std::string& name)
+{
+    std::string::size_type slash = name.find_last_of("/\\");
+    return slash == std::string::npos ? name : name.substr(slash + 1);
+}
+
+// Whether both names lead to one file, through links or not. A file that
+// doesn't exist is no other.
+static bool same_file(const std::string& a, const std::string& b)
+{
+#ifdef _WIN32
+    char fullA[_MAX_PATH];
+    char fullB[_MAX_PATH];
+    struct _stat stat;
+    if (_stat(a.c_str(), &stat) != 0 || _stat(b.c_str(), &stat) != 0)
+        return false;
+    if (!_fullpath(fullA, a.c_str(), sizeof(fullA)) || !_fullpath(fullB, b.c_str(), sizeof(fullB)))
+        return false;
+    return _stricmp(fullA, fullB) == 0;
+#else
+    struct stat statA;
+    struct stat statB;
+    if (stat(a.c_str(), &statA) != 0 || stat(b.c_str(), &statB) != 0)
+        return false;
+    return statA.st_dev == statB.st_dev && statA.st_ino == statB.st_ino;
+#endif
+}
+
+// With --out-dir, every file gets an output of its own, and none of them
+// may be one of the inputs. Reports what is wrong before anything runs.
+static bool check_outputs(const std::string& out_dir, const std::vector<std::string>& files)
+{
+    bool valid = true;
+    std::map<std::string, std::string> outputs;
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::string path = out_dir + "/" + base_name(files[i]);
+        std::map<std::string, std::string>::iterator found = outputs.find(path);
+        if (found != outputs.end()) {
+            std::cerr << "Error: " << found->second << " and " << files[i]
+                      << " would both be written to " << path << std::endl;
+            valid = false;
+            continue;
+        }
+        outputs[path] = files[i];
+        for (size_t j = 0; j < files.size(); ++j) {
+            if (same_file(path, files[j])) {
+                std::cerr << "Error: writing the output of " << files[i] << " to " << path
+                          << " would overwrite " << files[j] << std::endl;
+                valid = false;
+                break;
+            }
+        }
+    }
+    return valid;
+}
+
+static int run_pipeline(int argc, char* argv[])
+{
+    std::vector<int> tools;
+    eightpack::Options options[tool_count];
+    std::string out_dir;
+    std::vector<std::string> files;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.length() <= 2 || arg.compare(0, 2, "--") != 0) {
+            files.push_back(arg);
+            continue;
+        }
+        std::string option = arg.substr(2);
+        if (option.compare(0, 6, "tools=") == 0) {
+            std::stringstream list(option.substr(6));
+            std::string name;
+            while (std::getline(list, name, ',')) {
+                int tool = find_tool(name);
+                if (tool < 0) {
+                    std::cout << "Unknown tool: " << name << std::endl;
+                    std::cout << std::endl;
+                    ::exit(-1);
+                }
+                tools.push_back(tool);
+            }
+            continue;
+        }
+        if (option.compare(0, 8, "out-dir=") == 0) {
+            out_dir = option.substr(8);
+            continue;
+        }
+        std::string::size_type dot = option.find('.');
+        int tool = dot == std::string::npos ? -1 : find_tool(option.substr(0, dot));
+        if (tool < 0) {
+            std::cout << "Unknown option: " << arg << std::endl;
+            std::cout << std::endl;
+            ::exit(-1);
+        }
+        options[tool].push_back("--" + option.substr(dot + 1));
+    }
+
+    if (tools.empty() || files.empty())
+        usage();
+    if (!out_dir.empty() && !check_outputs(out_dir, files))
+        return 1;
+
+    eightpack::Pipeline pipeline;
+    for (size_t i = 0; i < tools.size(); ++i)
+        pipeline.add(tool_names[tools[i]].tool, options[tools[i]]);
+
+    int status = 0;
+    std::string input;
+    eightpack::Buffer output;
+    std::vector<eightpack::Diagnostic> diagnostics;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const std::string& name = files[i];
+        if (!eightpack::read_file(name, input)) {
+            std::cerr << name << ": Exception: Can't open the file" << std::endl;
+            status = 1;
+            continue;
+        }
+
+        if (!pipeline.run(input.data(), input.length(), output, diagnostics)) {
+            for (size_t j = 0; j < diagnostics.size(); ++j) {
+                const eightpack::Diagnostic& diagnostic = diagnostics[j];
+                std::cerr << name << ": At line " << diagnostic.line << " column " << diagnostic.column
+                          << " : " << diagnostic.reason << std::endl;
+            }
+            if (diagnostics.empty()) {
+                std::string error = pipeline.error();
+                error.erase(error.find_last_not_of('\n') + 1);
+                std::cerr << name << ": " << error << std::endl;
+            }
+            status = 1;
+            continue;
+        }
+
+        // Nothing to write when every tool was a linter.
+        if (output.empty())
+            continue;
+        output.append(1, '\n');
+        if (out_dir.empty()) {
+            std::cout.write(output.data(), output.length());
+            continue;
+        }
+        std::string path = out_dir + "/" + base_name(name);
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+        file.write(output.data(), output.length());
+        if (!file) {
+            std::cerr << path << ": Exception: Can't write the file" << std::endl;
+            status = 1;
+        }
+    }
+    std::cout.flush();
+    return status;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || strcmp(argv[1], "pipeline") != 0)
+        usage();
+    return run_pipeline(argc, argv);
+}